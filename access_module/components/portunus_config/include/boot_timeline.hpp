@@ -0,0 +1,58 @@
+/**
+ * @file boot_timeline.hpp
+ * @brief When each boot phase finished, for the log and the first heartbeat.
+ *
+ * main.cpp brings the I/O side (reader, strike, LED, FSM) up while WiFi
+ * associates and DHCP runs; wifi_mgr and server_comm mark the network
+ * phases as they complete.  Times are ms since the CPU started (esp_timer),
+ * so they include the ROM and second-stage bootloader only as far as
+ * esp_timer does.  server_comm reports the timeline in heartbeats until
+ * the server has answered one carrying all of it.
+ *
+ * Marks may come from any task.  The first mark of a phase wins, so a
+ * later reconnect does not move BOOT_PHASE_IP or BOOT_PHASE_SERVER.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    BOOT_PHASE_CONFIG = 0,      /**< NVS up, device configuration loaded */
+    BOOT_PHASE_WIFI_START,      /**< WiFi driver started, association under way */
+    BOOT_PHASE_IO_READY,        /**< Reader, strike, LED and FSM initialised */
+    BOOT_PHASE_FSM,             /**< FSM started: taps are read */
+    BOOT_PHASE_IP,              /**< Station obtained an IP address */
+    BOOT_PHASE_SERVER,          /**< First connection to the server */
+    BOOT_PHASE_COUNT
+} boot_phase_t;
+
+/** Record that @p phase finished at @p now_ms.  No-op once it is set. */
+void boot_timeline_mark(boot_phase_t phase, uint32_t now_ms);
+
+/** When @p phase finished, or 0 if it has not. */
+uint32_t boot_timeline_get(boot_phase_t phase);
+
+/** True once every phase has been marked. */
+bool boot_timeline_complete(void);
+
+/**
+ * Boot to ready: when the module could first act on a server decision,
+ * i.e. the later of BOOT_PHASE_FSM and BOOT_PHASE_SERVER.  0 until both.
+ */
+uint32_t boot_timeline_ready_ms(void);
+
+/** Short name of @p phase for logs ("config", "wifi_start", ...). */
+const char *boot_phase_name(boot_phase_t phase);
+
+/** Forget all marks (tests only; a boot marks each phase once). */
+void boot_timeline_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
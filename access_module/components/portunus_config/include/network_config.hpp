@@ -20,18 +20,72 @@ extern "C" {
 
 /* ── WiFi timing ───────────────────────────────────────────────────────────── */
 
-/** Maximum time (ms) wifi_mgr_start() blocks waiting for an IP. */
-#define PORTUNUS_WIFI_CONNECT_TIMEOUT_MS    CONFIG_PORTUNUS_WIFI_CONNECT_TIMEOUT_MS
-
 /** Base interval (ms) between reconnection attempts after disconnect.
  *  The manager doubles this on each failure up to a 60 s ceiling. */
 #define PORTUNUS_WIFI_RECONNECT_INTERVAL_MS CONFIG_PORTUNUS_WIFI_RECONNECT_INTERVAL_MS
 
+/** Time (ms) the radio stays out of power save after a card read. */
+#define PORTUNUS_WIFI_AWAKE_WINDOW_MS       CONFIG_PORTUNUS_WIFI_AWAKE_WINDOW_MS
+
 /* ── Portunus server ───────────────────────────────────────────────────────── */
 
 /** Server request timeout (ms) for gRPC connect and RPC calls. */
 #define PORTUNUS_SERVER_REQUEST_TIMEOUT_MS  CONFIG_PORTUNUS_SERVER_REQUEST_TIMEOUT_MS
 
+/** Floor (ms) for the RTT-derived RPC timeout; 0 = fixed request timeout. */
+#define PORTUNUS_GRPC_MIN_RPC_TIMEOUT_MS    CONFIG_PORTUNUS_GRPC_MIN_RPC_TIMEOUT_MS
+
+/** Bounds (s) for the adaptive keepalive PING interval. */
+#define PORTUNUS_GRPC_KEEPALIVE_MIN_S       CONFIG_PORTUNUS_GRPC_KEEPALIVE_MIN_S
+#define PORTUNUS_GRPC_KEEPALIVE_MAX_S       CONFIG_PORTUNUS_GRPC_KEEPALIVE_MAX_S
+
+/** Reconnect pacing (ms): spread after a lost link / first backoff, and ceiling. */
+#define PORTUNUS_GRPC_RECONNECT_BASE_MS     CONFIG_PORTUNUS_GRPC_RECONNECT_BASE_MS
+#define PORTUNUS_GRPC_RECONNECT_MAX_MS      CONFIG_PORTUNUS_GRPC_RECONNECT_MAX_MS
+
+/** Lifetime (s) of a resolved server address (background refresh from 3/4). */
+#define PORTUNUS_GRPC_DNS_TTL_S             CONFIG_PORTUNUS_GRPC_DNS_TTL_S
+
+/** Connect to expired server addresses while DNS is unreachable. */
+#ifdef CONFIG_PORTUNUS_GRPC_DNS_STALE_FALLBACK
+  #define PORTUNUS_GRPC_DNS_STALE_FALLBACK  1
+#else
+  #define PORTUNUS_GRPC_DNS_STALE_FALLBACK  0
+#endif
+
+/** Attempts per access request when the connection fails (1 = no retry). */
+#define PORTUNUS_TAP_RETRY_ATTEMPTS         CONFIG_PORTUNUS_TAP_RETRY_ATTEMPTS
+
+/** First-attempt timeout (ms) on a reused, possibly half-open connection. */
+#define PORTUNUS_TAP_PROBE_TIMEOUT_MS       CONFIG_PORTUNUS_TAP_PROBE_TIMEOUT_MS
+
+/** Largest clock error bound (ms) at which requests carry requested_at_us. */
+#define PORTUNUS_CLOCK_MAX_ERROR_MS         CONFIG_PORTUNUS_CLOCK_MAX_ERROR_MS
+
+/** Grants kept for local re-use within the server's cache TTL (0 = off). */
+#ifdef CONFIG_PORTUNUS_DECISION_CACHE_ENTRIES
+  #define PORTUNUS_DECISION_CACHE_ENTRIES   CONFIG_PORTUNUS_DECISION_CACHE_ENTRIES
+#else
+  #define PORTUNUS_DECISION_CACHE_ENTRIES   0
+#endif
+
+/** Longest TTL (s) a cached grant is kept for, whatever the server sends. */
+#ifdef CONFIG_PORTUNUS_DECISION_CACHE_MAX_TTL_S
+  #define PORTUNUS_DECISION_CACHE_MAX_TTL_S CONFIG_PORTUNUS_DECISION_CACHE_MAX_TTL_S
+#else
+  #define PORTUNUS_DECISION_CACHE_MAX_TTL_S 3600
+#endif
+
+/** Largest revocation filter (bytes) the module accepts (0 = off). */
+#ifdef CONFIG_PORTUNUS_REVOCATION_FILTER_MAX_BYTES
+  #define PORTUNUS_REVOCATION_FILTER_MAX_BYTES  CONFIG_PORTUNUS_REVOCATION_FILTER_MAX_BYTES
+#else
+  #define PORTUNUS_REVOCATION_FILTER_MAX_BYTES  0
+#endif
+
+/** Size (bytes) of the dedicated nghttp2 session arena (0 = system heap). */
+#define PORTUNUS_GRPC_SESSION_ARENA_SIZE    CONFIG_PORTUNUS_GRPC_SESSION_ARENA_SIZE
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
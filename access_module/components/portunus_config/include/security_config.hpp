@@ -64,7 +64,7 @@ extern "C" {
  * @brief Pin to a custom CA certificate embedded in the firmware.
  *
  * When enabled, the ESP32 validates the server cert against the PEM at
- * access_module/certs/ca_cert.pem (embedded via EMBED_TXTFILES in
+ * access_module/certs/ca_cert.pem (embedded as DER by
  * server_comm/CMakeLists.txt) instead of the Mozilla CA bundle.
  *
  * This is the recommended mode for LAN deployments with a private CA.
@@ -76,6 +76,39 @@ extern "C" {
   #define PORTUNUS_TLS_USE_CUSTOM_CA  0
 #endif
 
+/**
+ * @brief Server key pin: SHA-256 of its SubjectPublicKeyInfo, 64 hex digits.
+ *
+ * Empty = verify against the CA.  When set, the key alone is trusted and
+ * the CA is not consulted (see tls_trust.hpp).  generate_certs.sh prints it.
+ */
+#ifdef CONFIG_PORTUNUS_TLS_SPKI_PIN
+  #define PORTUNUS_TLS_SPKI_PIN  CONFIG_PORTUNUS_TLS_SPKI_PIN
+#else
+  #define PORTUNUS_TLS_SPKI_PIN  ""
+#endif
+
+/**
+ * @brief TLS transport profile (see tls_profile.hpp).
+ *
+ * 0 = compat (mbedTLS defaults), 1 = ECC-only TLS 1.3, 2 = TLS 1.3 PSK with
+ * the module's "tls_psk" key from NVS and no certificates.
+ */
+#if defined(CONFIG_PORTUNUS_TLS_PROFILE_PSK)
+  #define PORTUNUS_TLS_PROFILE  2
+#elif defined(CONFIG_PORTUNUS_TLS_PROFILE_ECC)
+  #define PORTUNUS_TLS_PROFILE  1
+#else
+  #define PORTUNUS_TLS_PROFILE  0
+#endif
+
+/** PSK profile: add an X25519 exchange (psk_dhe_ke) for forward secrecy. */
+#ifdef CONFIG_PORTUNUS_TLS_PSK_DHE
+  #define PORTUNUS_TLS_PSK_DHE  1
+#else
+  #define PORTUNUS_TLS_PSK_DHE  0
+#endif
+
 /* ── HMAC-SHA256 request signing ─────────────────────────────────────────── */
 
 /** 1 when HMAC signing is enabled; 0 otherwise. */
@@ -0,0 +1,27 @@
+/**
+ * @file tap_stats.hpp
+ * @brief Stale tap count shared by the components that refuse them.
+ *
+ * server_comm denies a tap whose deadline passes before or during its
+ * request; the FSM refuses to energize the strike for a grant that arrives
+ * after it.  Both count here, and server_comm reports the total in
+ * heartbeat stale_taps.  Safe from any task.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Count one tap refused or denied for missing its deadline. */
+void tap_stats_note_stale(void);
+
+/** Stale taps since boot. */
+uint32_t tap_stats_stale(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,47 @@
+/**
+ * @file task_config.hpp
+ * @brief Core affinity and priority plan for the firmware's FreeRTOS tasks.
+ *
+ * Two groups: network (radio, lwIP, TLS/gRPC) and I/O (reader polling,
+ * FSM, actuation).  With CONFIG_PORTUNUS_TASK_CORE_ISOLATION each group is
+ * pinned to its own core; otherwise, and always on single-core targets,
+ * both resolve to tskNO_AFFINITY and the scheduler places tasks freely.
+ *
+ * The TASK_CORE_* macros expand to tskNO_AFFINITY, so use them only where
+ * freertos/FreeRTOS.h is included (i.e. at xTaskCreatePinnedToCore calls).
+ */
+
+#pragma once
+
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ── Core affinity ─────────────────────────────────────────────────────────── */
+#ifdef CONFIG_PORTUNUS_TASK_CORE_ISOLATION
+#define TASK_CORE_NET               CONFIG_PORTUNUS_NET_CORE
+#define TASK_CORE_IO                CONFIG_PORTUNUS_IO_CORE
+#else
+#define TASK_CORE_NET               tskNO_AFFINITY
+#define TASK_CORE_IO                tskNO_AFFINITY
+#endif
+
+/* ── Priorities ────────────────────────────────────────────────────────────── */
+#define REACTOR_TASK_PRIORITY       CONFIG_PORTUNUS_REACTOR_TASK_PRIORITY
+#define READER_TASK_PRIORITY        CONFIG_PORTUNUS_READER_TASK_PRIORITY
+#define SERVER_COMM_TASK_PRIORITY   CONFIG_PORTUNUS_SERVER_COMM_TASK_PRIORITY
+#define WIFI_RECONNECT_TASK_PRIORITY CONFIG_PORTUNUS_WIFI_RECONNECT_TASK_PRIORITY
+
+/* server_comm priority while a tap request is pending; equal to the
+   baseline when boosting is disabled. */
+#ifdef CONFIG_PORTUNUS_SERVER_COMM_BOOST_ON_TAP
+#define SERVER_COMM_BOOST_PRIORITY  CONFIG_PORTUNUS_SERVER_COMM_BOOST_PRIORITY
+#else
+#define SERVER_COMM_BOOST_PRIORITY  SERVER_COMM_TASK_PRIORITY
+#endif
+
+#ifdef __cplusplus
+}
+#endif
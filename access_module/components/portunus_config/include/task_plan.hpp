@@ -0,0 +1,76 @@
+/**
+ * @file task_plan.hpp
+ * @brief Boot-time check of the task affinity/priority plan (task_config.hpp).
+ *
+ * main.cpp describes where each task should run, probes where it actually
+ * runs once everything is started, and hands both to task_plan_check().
+ * The resulting report is logged and carried in every heartbeat so the
+ * fleet shows which modules really have latency isolation.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Planned/observed core value meaning "not pinned". */
+#define TASK_PLAN_ANY_CORE   (-1)
+
+/** Planned priority value meaning "owned by ESP-IDF, do not check". */
+#define TASK_PLAN_ANY_PRIO   0
+
+typedef enum {
+    TASK_GROUP_NET = 0,   /**< Radio, lwIP, TLS / gRPC */
+    TASK_GROUP_IO,        /**< Reader polling, FSM, actuation */
+} task_group_t;
+
+typedef struct {
+    const char  *name;      /**< FreeRTOS task name */
+    task_group_t group;
+    int8_t       core;      /**< Planned core or TASK_PLAN_ANY_CORE */
+    uint8_t      priority;  /**< Planned priority or TASK_PLAN_ANY_PRIO */
+} task_plan_entry_t;
+
+typedef struct {
+    bool    present;        /**< false if the task does not exist in this variant */
+    int8_t  core;           /**< Observed core or TASK_PLAN_ANY_CORE */
+    uint8_t priority;
+} task_observed_t;
+
+typedef struct {
+    uint8_t  cores;         /**< CPU cores the scheduler runs on */
+    bool     isolation;     /**< Network and I/O groups confirmed on distinct cores */
+    uint8_t  faults;        /**< Present tasks whose core or priority is off-plan */
+    uint32_t fault_mask;    /**< Bit i set when plan entry i is a fault */
+} task_plan_report_t;
+
+/**
+ * @brief Compare observed placement against the plan.
+ *
+ * Absent tasks are skipped.  A pinned entry faults if the task runs on a
+ * different core or the planned core does not exist; any entry faults on
+ * a priority mismatch.  Isolation holds only on multi-core targets when
+ * every present network task is pinned to one core, every present I/O
+ * task to another, and none of them faulted.
+ *
+ * @param plan      Planned placement, @p n entries (at most 32).
+ * @param seen      Observed placement, index-aligned with @p plan.
+ * @param num_cores Cores available to the scheduler.
+ */
+void task_plan_check(const task_plan_entry_t *plan, const task_observed_t *seen,
+                     size_t n, uint8_t num_cores, task_plan_report_t *out);
+
+/** Record the boot report for later readers (heartbeat).  Call once. */
+void task_plan_set_report(const task_plan_report_t *report);
+
+/** Report recorded by task_plan_set_report(); zeroed before that. */
+const task_plan_report_t *task_plan_get_report(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -16,6 +16,11 @@ extern "C" {
 
 /* ── Heartbeat ─────────────────────────────────────────────────────────────── */
 #define HEARTBEAT_INTERVAL_MS       CONFIG_PORTUNUS_HEARTBEAT_INTERVAL_MS
+#define HEARTBEAT_MAX_INTERVAL_MS   CONFIG_PORTUNUS_HEARTBEAT_MAX_INTERVAL_MS
+#define HEARTBEAT_LOW_HEAP_BYTES    CONFIG_PORTUNUS_HEARTBEAT_LOW_HEAP_BYTES
+#ifdef CONFIG_PORTUNUS_HEALTH_TELEMETRY
+#define HEARTBEAT_HEALTH_TASKS      CONFIG_PORTUNUS_HEALTH_COMPACT_TASKS
+#endif
 
 /* ── MFRC522 card polling ──────────────────────────────────────────────────── */
 #define MFRC522_POLL_INTERVAL_MS    CONFIG_PORTUNUS_MFRC522_POLL_INTERVAL_MS
@@ -31,6 +36,7 @@ extern "C" {
 /* ── Door / FSM ───────────────────────────────────────────────────────────── */
 #define UNLOCK_HOLD_MS              CONFIG_PORTUNUS_UNLOCK_HOLD_MS
 #define FSM_POLL_INTERVAL_MS        CONFIG_PORTUNUS_FSM_POLL_INTERVAL_MS
+#define TAP_DEADLINE_MS             CONFIG_PORTUNUS_TAP_DEADLINE_MS
 
 #ifdef CONFIG_PORTUNUS_ENABLE_REED_SWITCH
 #define REED_SWITCH_DEBOUNCE_MS     CONFIG_PORTUNUS_REED_SWITCH_DEBOUNCE_MS
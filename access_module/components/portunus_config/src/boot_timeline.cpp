@@ -0,0 +1,69 @@
+/**
+ * @file boot_timeline.cpp
+ * @brief Boot phase timestamps — implementation.
+ */
+
+#include "boot_timeline.hpp"
+
+#include <atomic>
+
+/* 0 = not reached; a mark at 0 ms is stored as 1 ms. */
+static std::atomic<uint32_t> s_marks[BOOT_PHASE_COUNT];
+
+void boot_timeline_mark(boot_phase_t phase, uint32_t now_ms)
+{
+    if ((unsigned)phase >= BOOT_PHASE_COUNT) {
+        return;
+    }
+    uint32_t unset = 0;
+    s_marks[phase].compare_exchange_strong(unset, now_ms != 0 ? now_ms : 1,
+                                           std::memory_order_relaxed);
+}
+
+uint32_t boot_timeline_get(boot_phase_t phase)
+{
+    if ((unsigned)phase >= BOOT_PHASE_COUNT) {
+        return 0;
+    }
+    return s_marks[phase].load(std::memory_order_relaxed);
+}
+
+bool boot_timeline_complete(void)
+{
+    for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+        if (s_marks[i].load(std::memory_order_relaxed) == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+uint32_t boot_timeline_ready_ms(void)
+{
+    uint32_t fsm    = boot_timeline_get(BOOT_PHASE_FSM);
+    uint32_t server = boot_timeline_get(BOOT_PHASE_SERVER);
+    if (fsm == 0 || server == 0) {
+        return 0;
+    }
+    return fsm > server ? fsm : server;
+}
+
+const char *boot_phase_name(boot_phase_t phase)
+{
+    switch (phase) {
+    case BOOT_PHASE_CONFIG:     return "config";
+    case BOOT_PHASE_WIFI_START: return "wifi_start";
+    case BOOT_PHASE_IO_READY:   return "io_ready";
+    case BOOT_PHASE_FSM:        return "fsm";
+    case BOOT_PHASE_IP:         return "ip";
+    case BOOT_PHASE_SERVER:     return "server";
+    default:                    return "?";
+    }
+}
+
+void boot_timeline_reset(void)
+{
+    for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+        s_marks[i].store(0, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,20 @@
+/**
+ * @file tap_stats.cpp
+ * @brief Stale tap count — implementation.
+ */
+
+#include "tap_stats.hpp"
+
+#include <atomic>
+
+static std::atomic<uint32_t> s_stale{0};
+
+void tap_stats_note_stale(void)
+{
+    s_stale.fetch_add(1, std::memory_order_relaxed);
+}
+
+uint32_t tap_stats_stale(void)
+{
+    return s_stale.load(std::memory_order_relaxed);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file task_plan.cpp
+ * @brief Boot-time check of the task affinity/priority plan — implementation.
+ */
+
+#include "task_plan.hpp"
+
+static task_plan_report_t s_report = {};
+
+void task_plan_check(const task_plan_entry_t *plan, const task_observed_t *seen,
+                     size_t n, uint8_t num_cores, task_plan_report_t *out)
+{
+    *out = {};
+    out->cores = num_cores;
+
+    int  group_core[2]   = { TASK_PLAN_ANY_CORE, TASK_PLAN_ANY_CORE };
+    bool group_pinned[2] = { true, true };
+    bool group_seen[2]   = { false, false };
+
+    for (size_t i = 0; i < n && i < 32; i++) {
+        if (!seen[i].present) {
+            continue;
+        }
+
+        bool fault = false;
+        if (plan[i].core != TASK_PLAN_ANY_CORE &&
+            (plan[i].core >= num_cores || seen[i].core != plan[i].core)) {
+            fault = true;
+        }
+        if (plan[i].priority != TASK_PLAN_ANY_PRIO && seen[i].priority != plan[i].priority) {
+            fault = true;
+        }
+        if (fault) {
+            out->faults++;
+            out->fault_mask |= 1u << i;
+        }
+
+        int g = (plan[i].group == TASK_GROUP_NET) ? 0 : 1;
+        group_seen[g] = true;
+        if (fault || plan[i].core == TASK_PLAN_ANY_CORE) {
+            group_pinned[g] = false;
+        } else if (group_core[g] == TASK_PLAN_ANY_CORE) {
+            group_core[g] = plan[i].core;
+        } else if (group_core[g] != plan[i].core) {
+            group_pinned[g] = false;
+        }
+    }
+
+    out->isolation = num_cores > 1 &&
+                     group_seen[0] && group_seen[1] &&
+                     group_pinned[0] && group_pinned[1] &&
+                     group_core[0] != group_core[1];
+}
+
+void task_plan_set_report(const task_plan_report_t *report)
+{
+    s_report = *report;
+}
+
+const task_plan_report_t *task_plan_get_report(void)
+{
+    return &s_report;
+}
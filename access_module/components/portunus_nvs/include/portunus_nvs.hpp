@@ -16,6 +16,16 @@
  *   grpc_port   — u16
  *   hmac_secret — string, 64 hex chars  (empty string = HMAC disabled)
  *
+ * Optional keys (absent or empty = DHCP):
+ *   static_ip, static_netmask, static_gateway, static_dns
+ *               — strings, IPv4 dotted quad.  With static_ip set the
+ *                 station skips DHCP; static_netmask defaults to
+ *                 255.255.255.0 and static_dns to static_gateway.
+ *
+ * Optional key (absent or empty = none):
+ *   tls_psk     — string, 64 hex chars: this module's TLS pre-shared key,
+ *                 required by the PSK transport profile (identity: module_id).
+ *
  * Partition layout note: the nvs_keys partition at 0x18000 is reserved for
  * NVS encryption keys when flash encryption is enabled (future).  Until then
  * the partition exists but is unused; no application code reads it directly.
@@ -36,6 +46,8 @@ extern "C" {
 #define PORTUNUS_NVS_WIFI_PSK_LEN   65    /* 64 chars + NUL (WPA2 PSK limit) */
 #define PORTUNUS_NVS_SERVER_HOST_LEN 256  /* hostname or dotted-quad IP + NUL */
 #define PORTUNUS_NVS_HMAC_SECRET_LEN 65   /* 64 hex chars + NUL */
+#define PORTUNUS_NVS_IPV4_LEN       16    /* dotted quad + NUL */
+#define PORTUNUS_NVS_TLS_PSK_LEN    65    /* 64 hex chars + NUL */
 
 typedef struct {
     char     module_id[PORTUNUS_NVS_MODULE_ID_LEN];
@@ -44,13 +56,19 @@ typedef struct {
     char     server_host[PORTUNUS_NVS_SERVER_HOST_LEN];
     uint16_t grpc_port;
     char     hmac_secret[PORTUNUS_NVS_HMAC_SECRET_LEN];
+    char     static_ip[PORTUNUS_NVS_IPV4_LEN];        /**< "" = DHCP */
+    char     static_netmask[PORTUNUS_NVS_IPV4_LEN];
+    char     static_gateway[PORTUNUS_NVS_IPV4_LEN];
+    char     static_dns[PORTUNUS_NVS_IPV4_LEN];
+    char     tls_psk[PORTUNUS_NVS_TLS_PSK_LEN];       /**< "" = none */
 } portunus_device_config_t;
 
 /**
  * @brief Load device configuration from the "portunus" NVS namespace.
  *
  * nvs_flash_init() must have been called successfully before this function.
- * On success all fields of @p out are populated.  On error @p out is left
+ * On success all required fields of @p out are populated, and the optional
+ * static-address and tls_psk fields are set or emptied.  On error @p out is left
  * unchanged so the caller can decide whether to use compile-time dev defaults
  * (PORTUNUS_ENV_DEV builds) or halt (production builds).
  *
@@ -37,6 +37,24 @@ esp_err_t portunus_nvs_load(portunus_device_config_t *out)
     err = nvs_get_u16(h, "grpc_port", &out->grpc_port);
     if (err != ESP_OK) {
         ESP_LOGE(TAG, "Missing NVS key 'grpc_port': %s", esp_err_to_name(err));
+        goto done;
+    }
+
+    {
+        struct { const char *key; char *buf; size_t cap; } optional[] = {
+            { "static_ip",      out->static_ip,      sizeof(out->static_ip)      },
+            { "static_netmask", out->static_netmask, sizeof(out->static_netmask) },
+            { "static_gateway", out->static_gateway, sizeof(out->static_gateway) },
+            { "static_dns",     out->static_dns,     sizeof(out->static_dns)     },
+            { "tls_psk",        out->tls_psk,        sizeof(out->tls_psk)        },
+        };
+
+        for (auto &s : optional) {
+            size_t len = s.cap;
+            if (nvs_get_str(h, s.key, s.buf, &len) != ESP_OK) {
+                s.buf[0] = '\0';
+            }
+        }
     }
 
 done:
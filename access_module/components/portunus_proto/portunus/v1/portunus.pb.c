@@ -24,6 +24,12 @@ PB_BIND(portunus_v1_ProvisionCredentialRequest, portunus_v1_ProvisionCredentialR
 PB_BIND(portunus_v1_ProvisionCredentialResponse, portunus_v1_ProvisionCredentialResponse, AUTO)
 
 
+PB_BIND(portunus_v1_HealthTelemetry, portunus_v1_HealthTelemetry, AUTO)
+
+
+PB_BIND(portunus_v1_TaskHealth, portunus_v1_TaskHealth, AUTO)
+
+
 
 
 
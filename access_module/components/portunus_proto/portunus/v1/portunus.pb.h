@@ -25,7 +25,80 @@ typedef enum _portunus_v1_ProvisionStatus {
     portunus_v1_ProvisionStatus_PROVISION_STATUS_PENDING_CREATED = 7
 } portunus_v1_ProvisionStatus;
 
+/* Reason codes for AccessResponse.reason_code.  Each value is the reason
+ string upper-cased with the ACCESS_REASON_ prefix, so a reason the enum
+ does not list yet maps to UNSPECIFIED and travels as text. */
+typedef enum _portunus_v1_AccessReason {
+    portunus_v1_AccessReason_ACCESS_REASON_UNSPECIFIED = 0,
+    portunus_v1_AccessReason_ACCESS_REASON_ALLOW_ALL = 1,
+    portunus_v1_AccessReason_ACCESS_REASON_CREDENTIAL_ALLOWED = 2,
+    portunus_v1_AccessReason_ACCESS_REASON_DENIED = 3,
+    portunus_v1_AccessReason_ACCESS_REASON_UNKNOWN_MODULE = 4,
+    portunus_v1_AccessReason_ACCESS_REASON_INVALID_CREDENTIAL_FORMAT = 5,
+    portunus_v1_AccessReason_ACCESS_REASON_CREDENTIAL_NOT_FOUND = 6,
+    portunus_v1_AccessReason_ACCESS_REASON_MEMBER_EXPIRED = 7,
+    portunus_v1_AccessReason_ACCESS_REASON_MEMBER_SUSPENDED = 8,
+    portunus_v1_AccessReason_ACCESS_REASON_MEMBER_ARCHIVED = 9,
+    portunus_v1_AccessReason_ACCESS_REASON_MEMBER_DISABLED = 10,
+    portunus_v1_AccessReason_ACCESS_REASON_CREDENTIAL_NOT_AUTHORIZED = 11,
+    portunus_v1_AccessReason_ACCESS_REASON_AUTHORIZATION_REVOKED = 12,
+    portunus_v1_AccessReason_ACCESS_REASON_AUTHORIZATION_EXPIRED = 13
+} portunus_v1_AccessReason;
+
 /* Struct definitions */
+/* One task in HealthTelemetry.tasks.
+
+ Server Go equivalent: types.TaskHealth */
+typedef struct _portunus_v1_TaskHealth {
+    /* FreeRTOS task name (at most 15 characters). */
+    char name[16];
+    /* Share of all cores' time since the previous sample, in permille. */
+    uint32_t cpu_permille;
+    /* Stack the task has never touched since it started (high-water mark),
+ in bytes.  Near 0 means it is close to overflowing. */
+    uint32_t stack_free_bytes;
+    /* Dumps only: core the task is pinned to (-1 = either) and its current
+ priority. */
+    int32_t core;
+    uint32_t priority;
+} portunus_v1_TaskHealth;
+
+/* Runtime health of the module, sampled at each heartbeat tick and sent in
+ HeartbeatRequest.health.  Counters are since boot.  CPU shares cover the
+ time since the previous tick, in permille of all cores together; they
+ are 0 on the first sample and on firmware without run-time stats.
+
+ Server Go equivalent: types.HealthTelemetry */
+typedef struct _portunus_v1_HealthTelemetry {
+    /* Lowest free heap since boot, and the largest block that can be
+ allocated now, in bytes.  A largest block far below free_heap_bytes
+ means the heap is fragmented. */
+    uint32_t min_free_heap_bytes;
+    uint32_t largest_free_block_bytes;
+    /* Server connections established and connect attempts that failed;
+ TLS handshakes that failed, those refused by the SPKI pin among them,
+ and how long the last successful handshake took in ms. */
+    uint32_t server_connects;
+    uint32_t server_connect_failures;
+    uint32_t tls_failures;
+    uint32_t tls_pin_mismatches;
+    uint32_t tls_handshake_ms;
+    /* Tasks on the module (0 if there were too many to sample), and the
+ share of CPU their idle tasks had. */
+    uint32_t task_count;
+    uint32_t idle_permille;
+    /* What taking this sample cost the module, and the most any sample has
+ cost since boot, in µs. */
+    uint32_t sample_us;
+    uint32_t sample_max_us;
+    /* Set on a dump (HeartbeatResponse.health_dump): tasks lists every task.
+ Otherwise it names a few: those with the least stack headroom, then
+ the busiest. */
+    bool detailed;
+    pb_size_t tasks_count;
+    portunus_v1_TaskHealth tasks[24];
+} portunus_v1_HealthTelemetry;
+
 /* Sent by the access module at a regular interval to report health
  telemetry and confirm connectivity.
 
@@ -49,10 +122,127 @@ typedef struct _portunus_v1_HeartbeatRequest {
     char ip[46];
     /* Free heap in bytes at the time of the heartbeat. */
     uint32_t free_heap_bytes;
-    /* Monotonically increasing heartbeat counter (resets on reboot). */
+    /* Monotonically increasing heartbeat counter (resets on reboot).  It
+ counts ticks of the module's heartbeat timer, so a paced module
+ (static_omitted, heartbeat_interval_s) leaves gaps for the ticks it
+ did not send. */
     uint32_t sequence;
+    /* CPU cores the firmware schedules across (1 on single-core targets). */
+    uint32_t cpu_cores;
+    /* True when the boot-time check confirmed network/TLS tasks and
+ reader/FSM/actuation tasks are pinned to separate cores. */
+    bool core_isolation;
+    /* Tasks found on a different core or priority than configured at boot. */
+    uint32_t task_plan_faults;
+    /* Taps whose per-tap deadline passed before a decision could act on them
+ (dropped in the queue, before send, on a late response, or refused by the
+ FSM), since boot. */
+    uint32_t stale_taps;
+    /* Keepalive PING round trip percentiles over the last 32 PINGs, in ms.
+ 0 until the first PING has been answered. */
+    uint32_t rtt_p50_ms;
+    uint32_t rtt_p90_ms;
+    uint32_t rtt_p99_ms;
+    /* Current RPC timeout derived from observed call times (SRTT + 4·RTTVAR). */
+    uint32_t rpc_timeout_ms;
+    /* Connections closed because a keepalive PING went unanswered, since boot. */
+    uint32_t dead_links;
+    /* Decision cache counters since boot: taps granted from the cache, taps
+ that had to ask the server, entries pushed out by newer grants, and
+ entries dropped because the server said the grant no longer holds
+ (policy_version change or a deny on the audit report). */
+    uint32_t decision_cache_hits;
+    uint32_t decision_cache_misses;
+    uint32_t decision_cache_evictions;
+    uint32_t decision_cache_invalidations;
+    /* Revocation filter the module holds (0 = none), the largest filter it
+ can accept in bytes (0 = filtering disabled), and taps it has denied
+ from the filter since boot. */
+    uint32_t revocation_filter_version;
+    uint32_t revocation_filter_capacity;
+    uint32_t revocation_filter_denials;
+    /* Wire protocol the module speaks (see "Protocol versions" above).
+ At 2 it signs the binary projection and reads server_time_us. */
+    uint32_t protocol_version;
+    /* Clock discipline, from the server times in heartbeat and access
+ responses: the module's wall clock minus the server's at the last
+ sample, the bound on the module's estimate of server time now (0 =
+ not synced), and the measured crystal drift against the server in
+ parts per billion (0 until known). */
+    int32_t clock_offset_us;
+    uint32_t clock_error_us;
+    int32_t clock_drift_ppb;
+    /* Set when firmware_version, ip, cpu_cores, core_isolation,
+ task_plan_faults and revocation_filter_capacity are left out because
+ they have not changed since a heartbeat the server answered.  The
+ server uses the values it holds, or asks for them with
+ HeartbeatResponse.resend_static if it holds none. */
+    bool static_omitted;
+    /* Longest the module will now go without a heartbeat.  The interval
+ stretches while the module is healthy and is cut back to the base
+ interval on any anomaly; other RPCs also count as a sign of life. */
+    uint32_t heartbeat_interval_s;
+    /* Heartbeat ticks not sent to the server since boot, and the protobuf
+ bytes (request and response) that pacing and static_omitted saved. */
+    uint32_t heartbeats_skipped;
+    uint32_t heartbeat_bytes_saved;
+    /* Boot timeline, in ms since the CPU started, at which the module had
+ loaded its configuration, started WiFi, initialised the reader, strike,
+ LED and FSM, started the FSM, obtained an IP address and first
+ connected to the server (0 = not reached yet).  Sent until a heartbeat
+ carrying all of them is answered, then left out. */
+    uint32_t boot_config_ms;
+    uint32_t boot_wifi_start_ms;
+    uint32_t boot_io_ready_ms;
+    uint32_t boot_fsm_ms;
+    uint32_t boot_ip_ms;
+    uint32_t boot_server_ms;
+    /* WiFi connects since boot (an IP address obtained), how many of them
+ went straight to the saved AP and channel without a scan, and how many
+ times the saved AP did not answer and the module fell back to a scan. */
+    uint32_t wifi_connects;
+    uint32_t wifi_hinted_connects;
+    uint32_t wifi_scan_fallbacks;
+    /* Association to IP address on the last connect, and the slowest since
+ boot, in ms (0 = not connected yet). */
+    uint32_t wifi_assoc_to_ip_ms;
+    uint32_t wifi_assoc_to_ip_max_ms;
+    /* Link quality (0-100, from the averaged RSSI less beacon losses and
+ failing RPCs), the averaged RSSI in dBm and its trend in dB per minute
+ (0 = not connected yet). */
+    uint32_t wifi_link_quality;
+    int32_t wifi_rssi_avg_dbm;
+    int32_t wifi_rssi_trend_db_per_min;
+    /* Since boot: beacon timeouts, RPCs that got no answer, background scans
+ or 802.11v transition queries made because the link degraded, moves
+ to another AP that followed, and the RSSI the last of them gained. */
+    uint32_t wifi_beacon_losses;
+    uint32_t wifi_rpc_failures;
+    uint32_t wifi_roam_scans;
+    uint32_t wifi_roams;
+    int32_t wifi_last_roam_gain_db;
+    /* Since boot, in seconds: radio fully awake (during credential RPCs and
+ TLS handshakes, and for a while after each card read) and in power
+ save; and how many times it was woken. */
+    uint32_t wifi_awake_s;
+    uint32_t wifi_power_save_s;
+    uint32_t wifi_wakes;
+    /* Access RPCs since boot, and their average round trip in ms, split by
+ whether the radio was already awake when the tap came or was woken
+ from power save for it (0 = none yet). */
+    uint32_t access_rpcs_awake;
+    uint32_t access_rpc_awake_avg_ms;
+    uint32_t access_rpcs_woken;
+    uint32_t access_rpc_woken_avg_ms;
+    /* Runtime health: heap low-water marks, server connection and TLS
+ counters, and per-task CPU share and stack headroom.  Omitted by
+ firmware built without it (CONFIG_PORTUNUS_HEALTH_TELEMETRY). */
+    bool has_health;
+    portunus_v1_HealthTelemetry health;
 } portunus_v1_HeartbeatRequest;
 
+typedef PB_BYTES_ARRAY_T(32) portunus_v1_HeartbeatResponse_revocation_filter_key_t;
+typedef PB_BYTES_ARRAY_T(128) portunus_v1_HeartbeatResponse_revocation_filter_exceptions_t;
 /* Returned by the server to acknowledge the heartbeat.
 
  Server Go equivalent: types.HeartbeatResponse */
@@ -65,6 +255,41 @@ typedef struct _portunus_v1_HeartbeatResponse {
     char module_id[33];
     /* Server wall-clock time (RFC 3339 with nanoseconds). */
     char server_time[40];
+    /* Current access policy version.  Changes whenever a grant may have been
+ withdrawn (revocation, member disabled/archived/expired); the module
+ drops its whole decision cache when it sees a new value. */
+    uint32_t policy_version;
+    /*Revocation filter: an 8-bit xor filter over the tags of credentials
+ every door would deny (member disabled, expired or archived).  A tag is
+ the first 8 bytes, little-endian, of HMAC-SHA256(key, raw UID).  The
+ module denies a matching tap on the spot and reports it afterwards.
+
+ The version is always set; 0 means "no filter" and the module drops
+ its copy.  The other fields are only sent when the module's
+ revocation_filter_version differs and the fingerprints fit its
+ revocation_filter_capacity.  exceptions lists tags of active members
+ that the filter matches (8 bytes each, little-endian, at most 16); the
+ module must pass those through to the server. */
+    uint32_t revocation_filter_version;
+    uint64_t revocation_filter_seed;
+    portunus_v1_HeartbeatResponse_revocation_filter_key_t revocation_filter_key;
+    portunus_v1_HeartbeatResponse_revocation_filter_exceptions_t revocation_filter_exceptions;
+    pb_callback_t revocation_filter_fingerprints;
+    /* Server wall-clock time in microseconds since the Unix epoch.  Sent
+ alongside server_time; to a protocol_version 2 module it is sent
+ instead of it. */
+    int64_t server_time_us;
+    /* The server holds no static fields for this module (it restarted, or
+ never saw a full heartbeat from it); the next heartbeat carries them. */
+    bool resend_static;
+    /* Hold the next heartbeat this many ms past its normal schedule (0 =
+ none).  Set while heartbeats arrive faster than the server's pacing
+ rate, each module getting a different delay, so a fleet that came up
+ in step is spread out over the following rounds. */
+    uint32_t heartbeat_delay_ms;
+    /* Ask for a health dump: the module sends its next heartbeat at once,
+ with HealthTelemetry.tasks listing every task (detailed set). */
+    bool health_dump;
 } portunus_v1_HeartbeatResponse;
 
 typedef PB_BYTES_ARRAY_T(16) portunus_v1_AccessRequest_nonce_t;
@@ -88,6 +313,25 @@ typedef struct _portunus_v1_AccessRequest {
  enabled; the server rejects requests with a missing or previously-seen
  nonce when replay protection is active. */
     portunus_v1_AccessRequest_nonce_t nonce;
+    /* Set on the report for a tap the module already granted from its
+ decision cache.  The server decides afresh and audits the event as
+ served from cache; a deny tells the module to drop the entry. */
+    bool cached;
+    /* Set on the report for a tap the module already denied from its
+ revocation filter.  The server decides afresh and audits the event as
+ denied by the filter; a grant means a false positive, and the module
+ adds the credential to the filter's exceptions. */
+    bool filtered;
+    /* Wire protocol the module speaks.  At 2 the module sends
+ requested_at_us instead of requested_at, signs the binary projection
+ (see "Protocol versions" above), and expects the server to sign its
+ response the same way and to send reason_code and server_time_us in
+ place of the text fields. */
+    uint32_t protocol_version;
+    /* Device-local timestamp of the read in microseconds since the Unix
+ epoch; 0 when the module's clock is not synced.  Used instead of
+ requested_at when set. */
+    int64_t requested_at_us;
 } portunus_v1_AccessRequest;
 
 /* Returned by the server with the access decision.
@@ -118,6 +362,18 @@ typedef struct _portunus_v1_AccessResponse {
     char module_id[33];
     /* Server wall-clock time (RFC 3339 with nanoseconds). */
     char server_time[40];
+    /* Seconds the module may reuse this grant for the same credential without
+ asking again.  0 = do not cache.  Never set on a deny. */
+    uint32_t cache_ttl_s;
+    /* Access policy version the decision was made under (see
+ HeartbeatResponse.policy_version). */
+    uint32_t policy_version;
+    /* The reason above as a code.  To a protocol_version 2 module the reason
+ string is only sent when the code is ACCESS_REASON_UNSPECIFIED. */
+    portunus_v1_AccessReason reason_code;
+    /* Server wall-clock time in microseconds since the Unix epoch (see
+ HeartbeatResponse.server_time_us). */
+    int64_t server_time_us;
 } portunus_v1_AccessResponse;
 
 typedef PB_BYTES_ARRAY_T(10) portunus_v1_ProvisionCredentialRequest_credential_uid_t;
@@ -132,6 +388,9 @@ typedef struct _portunus_v1_ProvisionCredentialRequest {
     /* Raw RFID UID bytes read from the new-member card (1–10 bytes).
  The server computes HMAC-SHA256(secret, credential_uid) before storing. */
     portunus_v1_ProvisionCredentialRequest_credential_uid_t credential_uid;
+    /* Wire protocol the console speaks (see AccessRequest.protocol_version);
+ at 2 it signs the binary projection. */
+    uint32_t protocol_version;
 } portunus_v1_ProvisionCredentialRequest;
 
 /* Returned by the server after processing a provisioning request.
@@ -155,27 +414,36 @@ extern "C" {
 #define _portunus_v1_ProvisionStatus_MAX portunus_v1_ProvisionStatus_PROVISION_STATUS_PENDING_CREATED
 #define _portunus_v1_ProvisionStatus_ARRAYSIZE ((portunus_v1_ProvisionStatus)(portunus_v1_ProvisionStatus_PROVISION_STATUS_PENDING_CREATED+1))
 
+#define _portunus_v1_AccessReason_MIN portunus_v1_AccessReason_ACCESS_REASON_UNSPECIFIED
+#define _portunus_v1_AccessReason_MAX portunus_v1_AccessReason_ACCESS_REASON_AUTHORIZATION_EXPIRED
+#define _portunus_v1_AccessReason_ARRAYSIZE ((portunus_v1_AccessReason)(portunus_v1_AccessReason_ACCESS_REASON_AUTHORIZATION_EXPIRED+1))
 
 
 
 
+#define portunus_v1_AccessResponse_reason_code_ENUMTYPE portunus_v1_AccessReason
+
 
 #define portunus_v1_ProvisionCredentialResponse_status_ENUMTYPE portunus_v1_ProvisionStatus
 
 
 /* Initializer values for message structs */
-#define portunus_v1_HeartbeatRequest_init_default {"", "", 0, false, 0, false, 0, "", 0, 0}
-#define portunus_v1_HeartbeatResponse_init_default {0, 0, "", ""}
-#define portunus_v1_AccessRequest_init_default   {"", "", false, 0, "", {0, {0}}}
-#define portunus_v1_AccessResponse_init_default  {0, 0, 0, "", "", ""}
-#define portunus_v1_ProvisionCredentialRequest_init_default {"", {0, {0}}}
+#define portunus_v1_HeartbeatRequest_init_default {"", "", 0, false, 0, false, 0, "", 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, portunus_v1_HealthTelemetry_init_default}
+#define portunus_v1_HeartbeatResponse_init_default {0, 0, "", "", 0, 0, 0, {0, {0}}, {0, {0}}, {{NULL}, NULL}, 0, 0, 0, 0}
+#define portunus_v1_AccessRequest_init_default   {"", "", false, 0, "", {0, {0}}, 0, 0, 0, 0}
+#define portunus_v1_AccessResponse_init_default  {0, 0, 0, "", "", "", 0, 0, _portunus_v1_AccessReason_MIN, 0}
+#define portunus_v1_ProvisionCredentialRequest_init_default {"", {0, {0}}, 0}
 #define portunus_v1_ProvisionCredentialResponse_init_default {"", _portunus_v1_ProvisionStatus_MIN, ""}
-#define portunus_v1_HeartbeatRequest_init_zero   {"", "", 0, false, 0, false, 0, "", 0, 0}
-#define portunus_v1_HeartbeatResponse_init_zero  {0, 0, "", ""}
-#define portunus_v1_AccessRequest_init_zero      {"", "", false, 0, "", {0, {0}}}
-#define portunus_v1_AccessResponse_init_zero     {0, 0, 0, "", "", ""}
-#define portunus_v1_ProvisionCredentialRequest_init_zero {"", {0, {0}}}
+#define portunus_v1_HealthTelemetry_init_default {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, {portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default, portunus_v1_TaskHealth_init_default}}
+#define portunus_v1_TaskHealth_init_default      {"", 0, 0, 0, 0}
+#define portunus_v1_HeartbeatRequest_init_zero   {"", "", 0, false, 0, false, 0, "", 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, false, portunus_v1_HealthTelemetry_init_zero}
+#define portunus_v1_HeartbeatResponse_init_zero  {0, 0, "", "", 0, 0, 0, {0, {0}}, {0, {0}}, {{NULL}, NULL}, 0, 0, 0, 0}
+#define portunus_v1_AccessRequest_init_zero      {"", "", false, 0, "", {0, {0}}, 0, 0, 0, 0}
+#define portunus_v1_AccessResponse_init_zero     {0, 0, 0, "", "", "", 0, 0, _portunus_v1_AccessReason_MIN, 0}
+#define portunus_v1_ProvisionCredentialRequest_init_zero {"", {0, {0}}, 0}
 #define portunus_v1_ProvisionCredentialResponse_init_zero {"", _portunus_v1_ProvisionStatus_MIN, ""}
+#define portunus_v1_HealthTelemetry_init_zero    {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, {portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero, portunus_v1_TaskHealth_init_zero}}
+#define portunus_v1_TaskHealth_init_zero         {"", 0, 0, 0, 0}
 
 /* Field tags (for use in manual encoding/decoding) */
 #define portunus_v1_HeartbeatRequest_module_id_tag 1
@@ -186,26 +454,114 @@ extern "C" {
 #define portunus_v1_HeartbeatRequest_ip_tag      6
 #define portunus_v1_HeartbeatRequest_free_heap_bytes_tag 7
 #define portunus_v1_HeartbeatRequest_sequence_tag 8
+#define portunus_v1_HeartbeatRequest_cpu_cores_tag 9
+#define portunus_v1_HeartbeatRequest_core_isolation_tag 10
+#define portunus_v1_HeartbeatRequest_task_plan_faults_tag 11
+#define portunus_v1_HeartbeatRequest_stale_taps_tag 12
+#define portunus_v1_HeartbeatRequest_rtt_p50_ms_tag 13
+#define portunus_v1_HeartbeatRequest_rtt_p90_ms_tag 14
+#define portunus_v1_HeartbeatRequest_rtt_p99_ms_tag 15
+#define portunus_v1_HeartbeatRequest_rpc_timeout_ms_tag 16
+#define portunus_v1_HeartbeatRequest_dead_links_tag 17
+#define portunus_v1_HeartbeatRequest_decision_cache_hits_tag 18
+#define portunus_v1_HeartbeatRequest_decision_cache_misses_tag 19
+#define portunus_v1_HeartbeatRequest_decision_cache_evictions_tag 20
+#define portunus_v1_HeartbeatRequest_decision_cache_invalidations_tag 21
+#define portunus_v1_HeartbeatRequest_revocation_filter_version_tag 22
+#define portunus_v1_HeartbeatRequest_revocation_filter_capacity_tag 23
+#define portunus_v1_HeartbeatRequest_revocation_filter_denials_tag 24
+#define portunus_v1_HeartbeatRequest_protocol_version_tag 25
+#define portunus_v1_HeartbeatRequest_clock_offset_us_tag 26
+#define portunus_v1_HeartbeatRequest_clock_error_us_tag 27
+#define portunus_v1_HeartbeatRequest_clock_drift_ppb_tag 28
+#define portunus_v1_HeartbeatRequest_static_omitted_tag 29
+#define portunus_v1_HeartbeatRequest_heartbeat_interval_s_tag 30
+#define portunus_v1_HeartbeatRequest_heartbeats_skipped_tag 31
+#define portunus_v1_HeartbeatRequest_heartbeat_bytes_saved_tag 32
+#define portunus_v1_HeartbeatRequest_boot_config_ms_tag 33
+#define portunus_v1_HeartbeatRequest_boot_wifi_start_ms_tag 34
+#define portunus_v1_HeartbeatRequest_boot_io_ready_ms_tag 35
+#define portunus_v1_HeartbeatRequest_boot_fsm_ms_tag 36
+#define portunus_v1_HeartbeatRequest_boot_ip_ms_tag 37
+#define portunus_v1_HeartbeatRequest_boot_server_ms_tag 38
+#define portunus_v1_HeartbeatRequest_wifi_connects_tag 39
+#define portunus_v1_HeartbeatRequest_wifi_hinted_connects_tag 40
+#define portunus_v1_HeartbeatRequest_wifi_scan_fallbacks_tag 41
+#define portunus_v1_HeartbeatRequest_wifi_assoc_to_ip_ms_tag 42
+#define portunus_v1_HeartbeatRequest_wifi_assoc_to_ip_max_ms_tag 43
+#define portunus_v1_HeartbeatRequest_wifi_link_quality_tag 44
+#define portunus_v1_HeartbeatRequest_wifi_rssi_avg_dbm_tag 45
+#define portunus_v1_HeartbeatRequest_wifi_rssi_trend_db_per_min_tag 46
+#define portunus_v1_HeartbeatRequest_wifi_beacon_losses_tag 47
+#define portunus_v1_HeartbeatRequest_wifi_rpc_failures_tag 48
+#define portunus_v1_HeartbeatRequest_wifi_roam_scans_tag 49
+#define portunus_v1_HeartbeatRequest_wifi_roams_tag 50
+#define portunus_v1_HeartbeatRequest_wifi_last_roam_gain_db_tag 51
+#define portunus_v1_HeartbeatRequest_wifi_awake_s_tag 52
+#define portunus_v1_HeartbeatRequest_wifi_power_save_s_tag 53
+#define portunus_v1_HeartbeatRequest_wifi_wakes_tag 54
+#define portunus_v1_HeartbeatRequest_access_rpcs_awake_tag 55
+#define portunus_v1_HeartbeatRequest_access_rpc_awake_avg_ms_tag 56
+#define portunus_v1_HeartbeatRequest_access_rpcs_woken_tag 57
+#define portunus_v1_HeartbeatRequest_access_rpc_woken_avg_ms_tag 58
+#define portunus_v1_HeartbeatRequest_health_tag  59
 #define portunus_v1_HeartbeatResponse_ok_tag     1
 #define portunus_v1_HeartbeatResponse_known_tag  2
 #define portunus_v1_HeartbeatResponse_module_id_tag 3
 #define portunus_v1_HeartbeatResponse_server_time_tag 4
+#define portunus_v1_HeartbeatResponse_policy_version_tag 5
+#define portunus_v1_HeartbeatResponse_revocation_filter_version_tag 6
+#define portunus_v1_HeartbeatResponse_revocation_filter_seed_tag 7
+#define portunus_v1_HeartbeatResponse_revocation_filter_key_tag 8
+#define portunus_v1_HeartbeatResponse_revocation_filter_exceptions_tag 9
+#define portunus_v1_HeartbeatResponse_revocation_filter_fingerprints_tag 10
+#define portunus_v1_HeartbeatResponse_server_time_us_tag 11
+#define portunus_v1_HeartbeatResponse_resend_static_tag 12
+#define portunus_v1_HeartbeatResponse_heartbeat_delay_ms_tag 13
+#define portunus_v1_HeartbeatResponse_health_dump_tag 14
 #define portunus_v1_AccessRequest_module_id_tag  1
 #define portunus_v1_AccessRequest_credential_id_tag 2
 #define portunus_v1_AccessRequest_door_closed_tag 3
 #define portunus_v1_AccessRequest_requested_at_tag 4
 #define portunus_v1_AccessRequest_nonce_tag      5
+#define portunus_v1_AccessRequest_cached_tag     6
+#define portunus_v1_AccessRequest_filtered_tag   7
+#define portunus_v1_AccessRequest_protocol_version_tag 8
+#define portunus_v1_AccessRequest_requested_at_us_tag 9
 #define portunus_v1_AccessResponse_ok_tag        1
 #define portunus_v1_AccessResponse_known_tag     2
 #define portunus_v1_AccessResponse_granted_tag   3
 #define portunus_v1_AccessResponse_reason_tag    4
 #define portunus_v1_AccessResponse_module_id_tag 5
 #define portunus_v1_AccessResponse_server_time_tag 6
+#define portunus_v1_AccessResponse_cache_ttl_s_tag 7
+#define portunus_v1_AccessResponse_policy_version_tag 8
+#define portunus_v1_AccessResponse_reason_code_tag 9
+#define portunus_v1_AccessResponse_server_time_us_tag 10
 #define portunus_v1_ProvisionCredentialRequest_module_id_tag 2
 #define portunus_v1_ProvisionCredentialRequest_credential_uid_tag 5
+#define portunus_v1_ProvisionCredentialRequest_protocol_version_tag 8
 #define portunus_v1_ProvisionCredentialResponse_member_uuid_tag 1
 #define portunus_v1_ProvisionCredentialResponse_status_tag 2
 #define portunus_v1_ProvisionCredentialResponse_detail_tag 3
+#define portunus_v1_HealthTelemetry_min_free_heap_bytes_tag 1
+#define portunus_v1_HealthTelemetry_largest_free_block_bytes_tag 2
+#define portunus_v1_HealthTelemetry_server_connects_tag 3
+#define portunus_v1_HealthTelemetry_server_connect_failures_tag 4
+#define portunus_v1_HealthTelemetry_tls_failures_tag 5
+#define portunus_v1_HealthTelemetry_tls_pin_mismatches_tag 6
+#define portunus_v1_HealthTelemetry_tls_handshake_ms_tag 7
+#define portunus_v1_HealthTelemetry_task_count_tag 8
+#define portunus_v1_HealthTelemetry_idle_permille_tag 9
+#define portunus_v1_HealthTelemetry_sample_us_tag 10
+#define portunus_v1_HealthTelemetry_sample_max_us_tag 11
+#define portunus_v1_HealthTelemetry_detailed_tag 12
+#define portunus_v1_HealthTelemetry_tasks_tag    13
+#define portunus_v1_TaskHealth_name_tag          1
+#define portunus_v1_TaskHealth_cpu_permille_tag  2
+#define portunus_v1_TaskHealth_stack_free_bytes_tag 3
+#define portunus_v1_TaskHealth_core_tag          4
+#define portunus_v1_TaskHealth_priority_tag      5
 
 /* Struct field encoding specification for nanopb */
 #define portunus_v1_HeartbeatRequest_FIELDLIST(X, a) \
@@ -216,16 +572,78 @@ X(a, STATIC,   OPTIONAL, BOOL,     door_closed,       4) \
 X(a, STATIC,   OPTIONAL, INT32,    rssi_dbm,          5) \
 X(a, STATIC,   SINGULAR, STRING,   ip,                6) \
 X(a, STATIC,   SINGULAR, UINT32,   free_heap_bytes,   7) \
-X(a, STATIC,   SINGULAR, UINT32,   sequence,          8)
+X(a, STATIC,   SINGULAR, UINT32,   sequence,          8) \
+X(a, STATIC,   SINGULAR, UINT32,   cpu_cores,         9) \
+X(a, STATIC,   SINGULAR, BOOL,     core_isolation,   10) \
+X(a, STATIC,   SINGULAR, UINT32,   task_plan_faults,  11) \
+X(a, STATIC,   SINGULAR, UINT32,   stale_taps,       12) \
+X(a, STATIC,   SINGULAR, UINT32,   rtt_p50_ms,       13) \
+X(a, STATIC,   SINGULAR, UINT32,   rtt_p90_ms,       14) \
+X(a, STATIC,   SINGULAR, UINT32,   rtt_p99_ms,       15) \
+X(a, STATIC,   SINGULAR, UINT32,   rpc_timeout_ms,   16) \
+X(a, STATIC,   SINGULAR, UINT32,   dead_links,       17) \
+X(a, STATIC,   SINGULAR, UINT32,   decision_cache_hits,  18) \
+X(a, STATIC,   SINGULAR, UINT32,   decision_cache_misses,  19) \
+X(a, STATIC,   SINGULAR, UINT32,   decision_cache_evictions,  20) \
+X(a, STATIC,   SINGULAR, UINT32,   decision_cache_invalidations,  21) \
+X(a, STATIC,   SINGULAR, UINT32,   revocation_filter_version,  22) \
+X(a, STATIC,   SINGULAR, UINT32,   revocation_filter_capacity,  23) \
+X(a, STATIC,   SINGULAR, UINT32,   revocation_filter_denials,  24) \
+X(a, STATIC,   SINGULAR, UINT32,   protocol_version,  25) \
+X(a, STATIC,   SINGULAR, SINT32,   clock_offset_us,  26) \
+X(a, STATIC,   SINGULAR, UINT32,   clock_error_us,   27) \
+X(a, STATIC,   SINGULAR, SINT32,   clock_drift_ppb,  28) \
+X(a, STATIC,   SINGULAR, BOOL,     static_omitted,   29) \
+X(a, STATIC,   SINGULAR, UINT32,   heartbeat_interval_s,  30) \
+X(a, STATIC,   SINGULAR, UINT32,   heartbeats_skipped,  31) \
+X(a, STATIC,   SINGULAR, UINT32,   heartbeat_bytes_saved,  32) \
+X(a, STATIC,   SINGULAR, UINT32,   boot_config_ms,   33) \
+X(a, STATIC,   SINGULAR, UINT32,   boot_wifi_start_ms,  34) \
+X(a, STATIC,   SINGULAR, UINT32,   boot_io_ready_ms,  35) \
+X(a, STATIC,   SINGULAR, UINT32,   boot_fsm_ms,      36) \
+X(a, STATIC,   SINGULAR, UINT32,   boot_ip_ms,       37) \
+X(a, STATIC,   SINGULAR, UINT32,   boot_server_ms,   38) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_connects,    39) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_hinted_connects,  40) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_scan_fallbacks,  41) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_assoc_to_ip_ms,  42) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_assoc_to_ip_max_ms,  43) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_link_quality,  44) \
+X(a, STATIC,   SINGULAR, INT32,    wifi_rssi_avg_dbm,  45) \
+X(a, STATIC,   SINGULAR, INT32,    wifi_rssi_trend_db_per_min,  46) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_beacon_losses,  47) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_rpc_failures,  48) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_roam_scans,  49) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_roams,       50) \
+X(a, STATIC,   SINGULAR, INT32,    wifi_last_roam_gain_db,  51) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_awake_s,     52) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_power_save_s,  53) \
+X(a, STATIC,   SINGULAR, UINT32,   wifi_wakes,       54) \
+X(a, STATIC,   SINGULAR, UINT32,   access_rpcs_awake,  55) \
+X(a, STATIC,   SINGULAR, UINT32,   access_rpc_awake_avg_ms,  56) \
+X(a, STATIC,   SINGULAR, UINT32,   access_rpcs_woken,  57) \
+X(a, STATIC,   SINGULAR, UINT32,   access_rpc_woken_avg_ms,  58) \
+X(a, STATIC,   OPTIONAL, MESSAGE,  health,           59)
 #define portunus_v1_HeartbeatRequest_CALLBACK NULL
 #define portunus_v1_HeartbeatRequest_DEFAULT NULL
+#define portunus_v1_HeartbeatRequest_health_MSGTYPE portunus_v1_HealthTelemetry
 
 #define portunus_v1_HeartbeatResponse_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, BOOL,     ok,                1) \
 X(a, STATIC,   SINGULAR, BOOL,     known,             2) \
 X(a, STATIC,   SINGULAR, STRING,   module_id,         3) \
-X(a, STATIC,   SINGULAR, STRING,   server_time,       4)
-#define portunus_v1_HeartbeatResponse_CALLBACK NULL
+X(a, STATIC,   SINGULAR, STRING,   server_time,       4) \
+X(a, STATIC,   SINGULAR, UINT32,   policy_version,    5) \
+X(a, STATIC,   SINGULAR, UINT32,   revocation_filter_version,   6) \
+X(a, STATIC,   SINGULAR, UINT64,   revocation_filter_seed,   7) \
+X(a, STATIC,   SINGULAR, BYTES,    revocation_filter_key,   8) \
+X(a, STATIC,   SINGULAR, BYTES,    revocation_filter_exceptions,   9) \
+X(a, CALLBACK, SINGULAR, BYTES,    revocation_filter_fingerprints,  10) \
+X(a, STATIC,   SINGULAR, INT64,    server_time_us,   11) \
+X(a, STATIC,   SINGULAR, BOOL,     resend_static,    12) \
+X(a, STATIC,   SINGULAR, UINT32,   heartbeat_delay_ms,  13) \
+X(a, STATIC,   SINGULAR, BOOL,     health_dump,      14)
+#define portunus_v1_HeartbeatResponse_CALLBACK pb_default_field_callback
 #define portunus_v1_HeartbeatResponse_DEFAULT NULL
 
 #define portunus_v1_AccessRequest_FIELDLIST(X, a) \
@@ -233,7 +651,11 @@ X(a, STATIC,   SINGULAR, STRING,   module_id,         1) \
 X(a, STATIC,   SINGULAR, STRING,   credential_id,     2) \
 X(a, STATIC,   OPTIONAL, BOOL,     door_closed,       3) \
 X(a, STATIC,   SINGULAR, STRING,   requested_at,      4) \
-X(a, STATIC,   SINGULAR, BYTES,    nonce,             5)
+X(a, STATIC,   SINGULAR, BYTES,    nonce,             5) \
+X(a, STATIC,   SINGULAR, BOOL,     cached,            6) \
+X(a, STATIC,   SINGULAR, BOOL,     filtered,          7) \
+X(a, STATIC,   SINGULAR, UINT32,   protocol_version,   8) \
+X(a, STATIC,   SINGULAR, INT64,    requested_at_us,   9)
 #define portunus_v1_AccessRequest_CALLBACK NULL
 #define portunus_v1_AccessRequest_DEFAULT NULL
 
@@ -243,13 +665,18 @@ X(a, STATIC,   SINGULAR, BOOL,     known,             2) \
 X(a, STATIC,   SINGULAR, BOOL,     granted,           3) \
 X(a, STATIC,   SINGULAR, STRING,   reason,            4) \
 X(a, STATIC,   SINGULAR, STRING,   module_id,         5) \
-X(a, STATIC,   SINGULAR, STRING,   server_time,       6)
+X(a, STATIC,   SINGULAR, STRING,   server_time,       6) \
+X(a, STATIC,   SINGULAR, UINT32,   cache_ttl_s,       7) \
+X(a, STATIC,   SINGULAR, UINT32,   policy_version,    8) \
+X(a, STATIC,   SINGULAR, UENUM,    reason_code,       9) \
+X(a, STATIC,   SINGULAR, INT64,    server_time_us,   10)
 #define portunus_v1_AccessResponse_CALLBACK NULL
 #define portunus_v1_AccessResponse_DEFAULT NULL
 
 #define portunus_v1_ProvisionCredentialRequest_FIELDLIST(X, a) \
 X(a, STATIC,   SINGULAR, STRING,   module_id,         2) \
-X(a, STATIC,   SINGULAR, BYTES,    credential_uid,    5)
+X(a, STATIC,   SINGULAR, BYTES,    credential_uid,    5) \
+X(a, STATIC,   SINGULAR, UINT32,   protocol_version,   8)
 #define portunus_v1_ProvisionCredentialRequest_CALLBACK NULL
 #define portunus_v1_ProvisionCredentialRequest_DEFAULT NULL
 
@@ -260,12 +687,41 @@ X(a, STATIC,   SINGULAR, STRING,   detail,            3)
 #define portunus_v1_ProvisionCredentialResponse_CALLBACK NULL
 #define portunus_v1_ProvisionCredentialResponse_DEFAULT NULL
 
+#define portunus_v1_HealthTelemetry_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, UINT32,   min_free_heap_bytes,   1) \
+X(a, STATIC,   SINGULAR, UINT32,   largest_free_block_bytes,   2) \
+X(a, STATIC,   SINGULAR, UINT32,   server_connects,   3) \
+X(a, STATIC,   SINGULAR, UINT32,   server_connect_failures,   4) \
+X(a, STATIC,   SINGULAR, UINT32,   tls_failures,      5) \
+X(a, STATIC,   SINGULAR, UINT32,   tls_pin_mismatches,   6) \
+X(a, STATIC,   SINGULAR, UINT32,   tls_handshake_ms,   7) \
+X(a, STATIC,   SINGULAR, UINT32,   task_count,        8) \
+X(a, STATIC,   SINGULAR, UINT32,   idle_permille,     9) \
+X(a, STATIC,   SINGULAR, UINT32,   sample_us,        10) \
+X(a, STATIC,   SINGULAR, UINT32,   sample_max_us,    11) \
+X(a, STATIC,   SINGULAR, BOOL,     detailed,         12) \
+X(a, STATIC,   REPEATED, MESSAGE,  tasks,            13)
+#define portunus_v1_HealthTelemetry_CALLBACK NULL
+#define portunus_v1_HealthTelemetry_DEFAULT NULL
+#define portunus_v1_HealthTelemetry_tasks_MSGTYPE portunus_v1_TaskHealth
+
+#define portunus_v1_TaskHealth_FIELDLIST(X, a) \
+X(a, STATIC,   SINGULAR, STRING,   name,              1) \
+X(a, STATIC,   SINGULAR, UINT32,   cpu_permille,      2) \
+X(a, STATIC,   SINGULAR, UINT32,   stack_free_bytes,   3) \
+X(a, STATIC,   SINGULAR, SINT32,   core,              4) \
+X(a, STATIC,   SINGULAR, UINT32,   priority,          5)
+#define portunus_v1_TaskHealth_CALLBACK NULL
+#define portunus_v1_TaskHealth_DEFAULT NULL
+
 extern const pb_msgdesc_t portunus_v1_HeartbeatRequest_msg;
 extern const pb_msgdesc_t portunus_v1_HeartbeatResponse_msg;
 extern const pb_msgdesc_t portunus_v1_AccessRequest_msg;
 extern const pb_msgdesc_t portunus_v1_AccessResponse_msg;
 extern const pb_msgdesc_t portunus_v1_ProvisionCredentialRequest_msg;
 extern const pb_msgdesc_t portunus_v1_ProvisionCredentialResponse_msg;
+extern const pb_msgdesc_t portunus_v1_HealthTelemetry_msg;
+extern const pb_msgdesc_t portunus_v1_TaskHealth_msg;
 
 /* Defines for backwards compatibility with code written before nanopb-0.4.0 */
 #define portunus_v1_HeartbeatRequest_fields &portunus_v1_HeartbeatRequest_msg
@@ -274,15 +730,19 @@ extern const pb_msgdesc_t portunus_v1_ProvisionCredentialResponse_msg;
 #define portunus_v1_AccessResponse_fields &portunus_v1_AccessResponse_msg
 #define portunus_v1_ProvisionCredentialRequest_fields &portunus_v1_ProvisionCredentialRequest_msg
 #define portunus_v1_ProvisionCredentialResponse_fields &portunus_v1_ProvisionCredentialResponse_msg
+#define portunus_v1_HealthTelemetry_fields &portunus_v1_HealthTelemetry_msg
+#define portunus_v1_TaskHealth_fields &portunus_v1_TaskHealth_msg
 
 /* Maximum encoded size of messages (where known) */
 #define PORTUNUS_V1_PORTUNUS_V1_PORTUNUS_PB_H_MAX_SIZE portunus_v1_HeartbeatRequest_size
-#define portunus_v1_AccessRequest_size           126
-#define portunus_v1_AccessResponse_size          115
-#define portunus_v1_HeartbeatRequest_size        142
-#define portunus_v1_HeartbeatResponse_size       79
-#define portunus_v1_ProvisionCredentialRequest_size 46
+#define portunus_v1_AccessRequest_size           147
+#define portunus_v1_AccessResponse_size          140
+#define portunus_v1_HealthTelemetry_size         1100
+#define portunus_v1_HeartbeatRequest_size        1596
+/* portunus_v1_HeartbeatResponse_size depends on runtime parameters */
+#define portunus_v1_ProvisionCredentialRequest_size 52
 #define portunus_v1_ProvisionCredentialResponse_size 105
+#define portunus_v1_TaskHealth_size              41
 
 #ifdef __cplusplus
 } /* extern "C" */
@@ -0,0 +1,71 @@
+/**
+ * @file access_reason.h
+ * @brief Reason codes carried by EVENT_ACCESS_GRANTED / EVENT_ACCESS_DENIED.
+ *
+ * Server decisions use the values of portunus_v1_AccessReason (the wire
+ * reason_code) so server_comm can pass them through unchanged; the module's
+ * own outcomes start at ACCESS_REASON_MODULE_FIRST.  Names match the
+ * server's reason strings, so logs read the same as before codes existed.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    ACCESS_REASON_UNSPECIFIED               = 0,
+
+    /* Decided by the server — values match portunus_v1_AccessReason. */
+    ACCESS_REASON_ALLOW_ALL                 = 1,
+    ACCESS_REASON_CREDENTIAL_ALLOWED        = 2,
+    ACCESS_REASON_DENIED                    = 3,
+    ACCESS_REASON_UNKNOWN_MODULE            = 4,
+    ACCESS_REASON_INVALID_CREDENTIAL_FORMAT = 5,
+    ACCESS_REASON_CREDENTIAL_NOT_FOUND      = 6,
+    ACCESS_REASON_MEMBER_EXPIRED            = 7,
+    ACCESS_REASON_MEMBER_SUSPENDED          = 8,
+    ACCESS_REASON_MEMBER_ARCHIVED           = 9,
+    ACCESS_REASON_MEMBER_DISABLED           = 10,
+    ACCESS_REASON_CREDENTIAL_NOT_AUTHORIZED = 11,
+    ACCESS_REASON_AUTHORIZATION_REVOKED     = 12,
+    ACCESS_REASON_AUTHORIZATION_EXPIRED     = 13,
+
+    /* Decided on the module. */
+    ACCESS_REASON_MODULE_FIRST              = 64,
+    ACCESS_REASON_CACHED                    = ACCESS_REASON_MODULE_FIRST, /**< Decision-cache grant */
+    ACCESS_REASON_REVOKED,                  /**< Revocation-filter match */
+    ACCESS_REASON_NO_NETWORK,
+    ACCESS_REASON_STALE,                    /**< Tap deadline passed */
+    ACCESS_REASON_ENCODE_ERROR,
+    ACCESS_REASON_GRPC_ERROR,
+    ACCESS_REASON_GRPC_STATUS_ERROR,
+    ACCESS_REASON_DECODE_ERROR,
+    ACCESS_REASON_MISSING_RESPONSE_SIG,
+    ACCESS_REASON_SIG_COMPUTE_ERROR,
+    ACCESS_REASON_INVALID_RESPONSE_SIG,
+} access_reason_t;
+
+/** Highest value the server sends; anything above it is read as UNSPECIFIED. */
+#define ACCESS_REASON_SERVER_MAX  ACCESS_REASON_AUTHORIZATION_EXPIRED
+
+/**
+ * @brief Convert a wire reason_code to an access_reason_t.
+ *
+ * A code newer than this firmware maps to ACCESS_REASON_UNSPECIFIED.
+ */
+access_reason_t access_reason_from_server(uint32_t code);
+
+/**
+ * @brief Log name of a reason, e.g. "credential_not_found".
+ *
+ * Never NULL; unknown values give "unspecified".
+ */
+const char *access_reason_name(access_reason_t reason);
+
+#ifdef __cplusplus
+}
+#endif
@@ -12,6 +12,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "credential_types.h"
+#include "access_reason.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -56,6 +57,9 @@ typedef enum {
 
     /* PEU arm events: 0x07xx (PROVISIONING_CONSOLE firmware only) */
     EVENT_ARM_REQUESTED = 0x0700,     /**< Arm button pressed; PEU FSM transitions state */
+
+    /* Network events: 0x08xx */
+    EVENT_NETWORK_UP = 0x0800,        /**< Station obtained an IP address (wifi_mgr, for server_comm) */
 } portunus_event_id_t;
 
 /* ── Event payloads ────────────────────────────────────────────────────────── */
@@ -66,6 +70,11 @@ typedef enum {
 typedef struct {
     credential_t credential;           /**< The credential that was read */
     int64_t      timestamp_ms;         /**< Reading timestamp (esp_timer) */
+    int64_t      deadline_ms;          /**< timestamp_ms + TAP_DEADLINE_MS; 0 = none */
+    bool         cached_grant;         /**< Internal to server_comm: already granted from
+                                            its decision cache, queued only as an audit report */
+    bool         filter_denied;        /**< Internal to server_comm: already denied from
+                                            its revocation filter, queued only as an audit report */
 } event_credential_read_t;
 
 /**
@@ -75,6 +84,9 @@ typedef struct {
     uint32_t sequence;                 /**< Monotonic heartbeat counter */
     uint32_t uptime_sec;               /**< Seconds since boot */
     uint32_t free_heap_bytes;          /**< Free heap at time of heartbeat */
+    uint8_t  cpu_cores;                /**< Cores the scheduler runs on */
+    bool     core_isolation;           /**< Boot check confirmed NET/IO on separate cores */
+    uint8_t  task_plan_faults;         /**< Tasks off their planned core/priority at boot */
 } event_heartbeat_t;
 
 /**
@@ -86,9 +98,11 @@ typedef struct {
  */
 typedef struct {
     char     credential_id[30];        /**< FNV-1a log fingerprint of the credential (never raw UID) */
-    char     reason[33];               /**< Server reason code, e.g. "allow_all" */
+    access_reason_t reason;            /**< Why — server reason_code or a module-local cause */
     bool     granted;                  /**< true = access granted */
     bool     known;                    /**< true = module is registered on server */
+    int64_t  deadline_ms;              /**< Tap deadline (esp_timer ms) a grant must be
+                                            acted on by; 0 = none */
 } event_access_decision_t;
 
 /**
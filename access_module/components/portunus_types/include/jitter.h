@@ -0,0 +1,43 @@
+/**
+ * @file jitter.h
+ * @brief Randomized delays that keep a fleet of modules out of step.
+ *
+ * After a power cut every module in a building boots within a second of
+ * the others, and any fixed schedule — the heartbeat timer, WiFi reconnect
+ * backoff, gRPC reconnects — then runs in lockstep across the fleet: the AP
+ * and the server see every module at the same instant, round after round.
+ * These helpers break that up.  Periodic timers start at a random phase;
+ * retries use "equal jitter" backoff, half of each delay fixed and half
+ * random, which keeps a floor under every wait and still decorrelates the
+ * fleet within a few rounds.
+ *
+ * The caller supplies the random word (esp_random() on the module), so the
+ * results are reproducible under test.  Pure C: no ESP-IDF, builds with a
+ * bare host compiler (see test/host/test_jitter.c).
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Uniform in [0, @p period_ms) (0 when @p period_ms is 0). */
+uint32_t jitter_phase_ms(uint32_t period_ms, uint32_t rnd);
+
+/** Uniform in [@p delay_ms - @p delay_ms / 2, @p delay_ms]. */
+uint32_t jitter_equal_ms(uint32_t delay_ms, uint32_t rnd);
+
+/**
+ * @brief Delay before the next attempt after @p failures failed ones.
+ *
+ * Equal jitter of min(@p max_ms, @p base_ms · 2^(failures - 1)); 0 when
+ * nothing has failed yet.
+ */
+uint32_t jitter_backoff_ms(uint32_t base_ms, uint32_t max_ms, uint32_t failures, uint32_t rnd);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,56 @@
+#include "access_reason.h"
+
+#include <stddef.h>
+
+static const char *const s_server_names[] = {
+    [ACCESS_REASON_UNSPECIFIED]               = "unspecified",
+    [ACCESS_REASON_ALLOW_ALL]                 = "allow_all",
+    [ACCESS_REASON_CREDENTIAL_ALLOWED]        = "credential_allowed",
+    [ACCESS_REASON_DENIED]                    = "denied",
+    [ACCESS_REASON_UNKNOWN_MODULE]            = "unknown_module",
+    [ACCESS_REASON_INVALID_CREDENTIAL_FORMAT] = "invalid_credential_format",
+    [ACCESS_REASON_CREDENTIAL_NOT_FOUND]      = "credential_not_found",
+    [ACCESS_REASON_MEMBER_EXPIRED]            = "member_expired",
+    [ACCESS_REASON_MEMBER_SUSPENDED]          = "member_suspended",
+    [ACCESS_REASON_MEMBER_ARCHIVED]           = "member_archived",
+    [ACCESS_REASON_MEMBER_DISABLED]           = "member_disabled",
+    [ACCESS_REASON_CREDENTIAL_NOT_AUTHORIZED] = "credential_not_authorized",
+    [ACCESS_REASON_AUTHORIZATION_REVOKED]     = "authorization_revoked",
+    [ACCESS_REASON_AUTHORIZATION_EXPIRED]     = "authorization_expired",
+};
+
+static const char *const s_module_names[] = {
+    "cached",
+    "revoked",
+    "no_network",
+    "stale",
+    "encode_error",
+    "grpc_error",
+    "grpc_status_error",
+    "decode_error",
+    "missing_response_sig",
+    "sig_compute_error",
+    "invalid_response_sig",
+};
+
+access_reason_t access_reason_from_server(uint32_t code)
+{
+    if (code > ACCESS_REASON_SERVER_MAX) {
+        return ACCESS_REASON_UNSPECIFIED;
+    }
+    return (access_reason_t)code;
+}
+
+const char *access_reason_name(access_reason_t reason)
+{
+    size_t i = (size_t)reason;
+    if (i <= ACCESS_REASON_SERVER_MAX) {
+        return s_server_names[i];
+    }
+    i -= ACCESS_REASON_MODULE_FIRST;
+    if (reason >= ACCESS_REASON_MODULE_FIRST &&
+        i < sizeof(s_module_names) / sizeof(s_module_names[0])) {
+        return s_module_names[i];
+    }
+    return "unspecified";
+}
@@ -0,0 +1,28 @@
+#include "jitter.h"
+
+uint32_t jitter_phase_ms(uint32_t period_ms, uint32_t rnd)
+{
+    /* Multiply-shift rather than %, which favours small values. */
+    return (uint32_t)(((uint64_t)rnd * period_ms) >> 32);
+}
+
+uint32_t jitter_equal_ms(uint32_t delay_ms, uint32_t rnd)
+{
+    uint32_t half = delay_ms / 2;
+    return delay_ms - half + jitter_phase_ms(half + 1, rnd);
+}
+
+uint32_t jitter_backoff_ms(uint32_t base_ms, uint32_t max_ms, uint32_t failures, uint32_t rnd)
+{
+    if (failures == 0) {
+        return 0;
+    }
+    uint64_t delay = base_ms;
+    for (uint32_t i = 1; i < failures && delay < max_ms; i++) {
+        delay *= 2;
+    }
+    if (delay > max_ms) {
+        delay = max_ms;
+    }
+    return jitter_equal_ms((uint32_t)delay, rnd);
+}
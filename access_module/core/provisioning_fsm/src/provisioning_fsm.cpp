@@ -15,6 +15,7 @@
 #include "event_bus.hpp"
 #include "error_codes.hpp"
 #include "credential_types.h"
+#include "task_config.hpp"
 #include "sdkconfig.h"
 
 #ifdef CONFIG_PORTUNUS_ENABLE_WIFI
@@ -34,9 +35,7 @@ static const char *TAG = "peu_fsm";
 /* ── Task configuration ───────────────────────────────────────────────────── */
 
 static const int FSM_TASK_STACK      = 4096;
-static const int FSM_TASK_PRIORITY   = 5;
 static const int POLL_TASK_STACK     = 4096;
-static const int POLL_TASK_PRIORITY  = 4;
 static const int FSM_EVENT_QUEUE_LEN = 8;
 static const int FSM_POLL_INTERVAL_MS = 100;
 
@@ -131,17 +130,17 @@ portunus_err_t ProvisioningFSM::start()
     event_bus_subscribe(EVENT_CREDENTIAL_READ,   on_event_bus_event, this);
     event_bus_subscribe(EVENT_ARM_REQUESTED,     on_event_bus_event, this);
 
-    BaseType_t ret = xTaskCreate(
+    BaseType_t ret = xTaskCreatePinnedToCore(
         fsm_task_entry, "peu_fsm",
-        FSM_TASK_STACK, this, FSM_TASK_PRIORITY, &m_fsm_task_handle);
+        FSM_TASK_STACK, this, REACTOR_TASK_PRIORITY, &m_fsm_task_handle, TASK_CORE_IO);
     if (ret != pdPASS) {
         ESP_LOGE(TAG, "Failed to create FSM task");
         return PORTUNUS_ERR_TASK_CREATE;
     }
 
-    ret = xTaskCreate(
+    ret = xTaskCreatePinnedToCore(
         poll_task_entry, "peu_poll",
-        POLL_TASK_STACK, this, POLL_TASK_PRIORITY, &m_poll_task_handle);
+        POLL_TASK_STACK, this, READER_TASK_PRIORITY, &m_poll_task_handle, TASK_CORE_IO);
     if (ret != pdPASS) {
         ESP_LOGE(TAG, "Failed to create poll task");
         return PORTUNUS_ERR_TASK_CREATE;
@@ -167,7 +166,8 @@ void ProvisioningFSM::on_event_bus_event(const portunus_event_t *event, void *ct
 {
     auto *fsm = static_cast<ProvisioningFSM *>(ctx);
     if (fsm->m_event_queue == nullptr) { return; }
-    if (xQueueSend(fsm->m_event_queue, event, pdMS_TO_TICKS(10)) != pdTRUE) {
+    /* Runs on the reactor — never block it waiting for queue space. */
+    if (xQueueSend(fsm->m_event_queue, event, 0) != pdTRUE) {
         ESP_LOGW(TAG, "FSM queue full — dropped event 0x%04x", event->id);
     }
 }
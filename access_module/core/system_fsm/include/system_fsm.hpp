@@ -4,7 +4,7 @@
  *
  * The FSM orchestrates all module interactions:
  *   - Initialises modules and records capability flags.
- *   - Owns the credential-polling sub-task.
+ *   - Runs on the reactor task; owns the credential-polling sub-task.
  *   - Subscribes to event bus events and processes them.
  *   - Manages unlock timing (energize → hold → re-lock).
  *   - Polls the reed switch and publishes door state change events.
@@ -25,6 +25,7 @@
 #include "i_access_point.hpp"
 #include "i_feedback.hpp"
 #include "i_clock.hpp"
+#include "reactor.hpp"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -64,11 +65,12 @@ public:
     portunus_err_t init();
 
     /**
-     * @brief Start the FSM task and credential-polling sub-task.
+     * @brief Attach the FSM to the reactor and start credential polling.
      *
      * Must be called after init() and after the event bus is initialised.
-     * Subscribes to relevant event bus events and starts the FreeRTOS
-     * tasks.
+     * Subscribes to relevant event bus events, registers the FSM's event
+     * source and poll timer with the reactor, and starts the
+     * credential-polling FreeRTOS task.
      *
      * @return PORTUNUS_OK on success.
      */
@@ -82,7 +84,7 @@ public:
 
 private:
     /* Tier B test fixture needs access to process_event and check_unlock_timer
-     * to inject events and advance the timer without starting FreeRTOS tasks. */
+     * to inject events and advance the timer without starting the reactor. */
     friend class SystemFSMTestFixture;
 
     /* ── Injected dependencies ────────────────────────────────────────────── */
@@ -99,20 +101,28 @@ private:
     bool    m_strike_energized = false;
     int64_t m_unlock_deadline_ms = 0;  /**< esp_timer timestamp when hold expires */
 
+    /* ── Tap-to-unlock latency (scheduling jitter instrumentation) ─────────── */
+    int64_t m_last_tap_ms    = 0;          /**< timestamp_ms of the last credential read */
+    int64_t m_latency_min_ms = INT64_MAX;
+    int64_t m_latency_max_ms = 0;
+
     /* ── Reed switch tracking ─────────────────────────────────────────────── */
     bool m_last_door_open = false;
 
-    /* ── FreeRTOS handles ─────────────────────────────────────────────────── */
-    TaskHandle_t  m_fsm_task_handle  = nullptr;
-    TaskHandle_t  m_poll_task_handle = nullptr;
-    QueueHandle_t m_event_queue      = nullptr;  /**< Internal event queue */
+    /* ── FreeRTOS / reactor handles ───────────────────────────────────────── */
+    TaskHandle_t     m_poll_task_handle = nullptr;
+    QueueHandle_t    m_event_queue      = nullptr;  /**< Internal event queue */
+    reactor_source_t m_event_source     = {};       /**< Signalled by the bus bridge */
+    reactor_timer_t  m_tick_timer       = {};       /**< FSM_POLL_INTERVAL_MS checks */
 
-    /* ── Task entry points ────────────────────────────────────────────────── */
-    static void fsm_task_entry(void *arg);
+    /* ── Reactor / task entry points ──────────────────────────────────────── */
+    static void on_events_ready(void *ctx);
+    static void on_tick_timer(void *ctx);
     static void credential_poll_task_entry(void *arg);
 
     /* ── Internal methods ─────────────────────────────────────────────────── */
-    void run();                                  /**< FSM main loop */
+    void drain_events();                         /**< Process all queued events */
+    void tick();                                 /**< Reed / unlock timer / network checks */
     void poll_credential();                      /**< Credential polling loop */
     void process_event(const portunus_event_t &event);
     void poll_reed_switch();
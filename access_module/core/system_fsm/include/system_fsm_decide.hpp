@@ -20,13 +20,17 @@ enum class door_cmd_t : uint8_t { NONE, UNLOCK_AND_HOLD, LOCK };
 /** Ordered feedback list mirrors the real preemptive indicate() sequence. */
 struct fsm_actions_t {
     door_cmd_t      door = door_cmd_t::NONE;
+    bool            stale = false;   /**< Grant refused: past its tap deadline */
     uint8_t         feedback_count = 0;
     feedback_type_t feedback[FSM_MAX_FEEDBACK] =
         { feedback_type_t::NONE, feedback_type_t::NONE };
 };
 
-/** Pure decision: (capabilities, event) -> intended effects. Mirrors
+/** Pure decision: (capabilities, event, now) -> intended effects. Mirrors
  *  process_event. `state` is intentionally not an input: the MVP process_event
- *  does not branch on system state. */
+ *  does not branch on system state. `now_ms` is only used to refuse a grant
+ *  whose tap deadline (access_decision.deadline_ms, same clock) has passed;
+ *  such a grant is treated as a deny. */
 fsm_actions_t decide_system_event(const system_capabilities_t &caps,
-                                  const portunus_event_t       &event);
+                                  const portunus_event_t       &event,
+                                  int64_t                       now_ms);
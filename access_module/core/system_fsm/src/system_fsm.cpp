@@ -2,16 +2,16 @@
  * @file system_fsm.cpp
  * @brief System FSM implementation.
  *
- * The FSM runs a single FreeRTOS task (fsm_task) that:
- *   1. Waits for events on an internal queue (timeout = FSM_POLL_INTERVAL_MS).
- *   2. Processes any received event (access decisions, door state, etc.).
- *   3. Polls the reed switch for door state changes.
- *   4. Checks the unlock hold timer.
+ * The FSM runs as two handlers on the reactor task (see reactor.hpp):
+ *   1. An event source: drains the internal queue and processes each event
+ *      (access decisions, door state, etc.), then runs the periodic checks.
+ *   2. A periodic timer (FSM_POLL_INTERVAL_MS) running the checks: reed
+ *      switch, unlock hold timer, network capability.
  *
  * Events arrive via an event bus bridge: the FSM subscribes to relevant
  * event bus event types, and the bridge callback copies each event into
- * the FSM's internal queue.  This decouples the FSM's processing from
- * the event bus dispatcher task.
+ * the FSM's internal queue and signals the event source.  This keeps FSM
+ * processing out of the subscriber callback itself.
  *
  * The credential-polling sub-task runs independently and publishes credential
  * events to the event bus (not directly to the FSM queue).  The FSM
@@ -24,8 +24,11 @@
 #include "system_fsm_decide.hpp"
 #include "event_bus.hpp"
 #include "timing_config.hpp"
+#include "task_config.hpp"
+#include "tap_stats.hpp"
 #include "error_codes.hpp"
 #include "credential_types.h"
+#include "reactor.hpp"
 #ifdef CONFIG_PORTUNUS_ENABLE_WIFI
 #include "wifi_mgr.hpp"
 #endif
@@ -43,10 +46,7 @@ static const char *TAG = "fsm";
 
 /* ── Task configuration ───────────────────────────────────────────────────── */
 
-static const int FSM_TASK_STACK             = 4096;
-static const int FSM_TASK_PRIORITY          = 5;   /* Above card polling, same as dispatcher */
 static const int POLL_TASK_STACK            = 4096;
-static const int POLL_TASK_PRIORITY         = 4;   /* Between heartbeat (3) and FSM (5) */
 static const int FSM_EVENT_QUEUE_LEN        = 8;
 static const int READER_HW_ERROR_THRESHOLD  = 5;    /* consecutive non-NO_CREDENTIAL errors before degraded */
 static const int READER_RECOVERY_INTERVAL_MS = 5000; /* ms between reconnection attempts when degraded */
@@ -156,30 +156,29 @@ portunus_err_t SystemFSM::start()
     event_bus_subscribe(EVENT_ACCESS_GRANTED,  on_event_bus_event, this);
     event_bus_subscribe(EVENT_ACCESS_DENIED,   on_event_bus_event, this);
 
-    /* ── Start FSM task ─────────────────────────────────────────────────── */
-    BaseType_t ret = xTaskCreate(
-        fsm_task_entry,
-        "fsm",
-        FSM_TASK_STACK,
-        this,
-        FSM_TASK_PRIORITY,
-        &m_fsm_task_handle
-    );
-    if (ret != pdPASS) {
-        ESP_LOGE(TAG, "Failed to create FSM task");
+    /* ── Attach to the reactor ───────────────────────────────────────────── */
+    portunus_err_t err = reactor_source_register(&m_event_source, on_events_ready, this);
+    if (err == PORTUNUS_OK) {
+        err = reactor_timer_start(&m_tick_timer, FSM_POLL_INTERVAL_MS, FSM_POLL_INTERVAL_MS,
+                                  on_tick_timer, this);
+    }
+    if (err != PORTUNUS_OK) {
+        ESP_LOGE(TAG, "Failed to attach FSM to reactor: err=%d", (int)err);
         m_state = SYSTEM_STATE_ERROR;
-        return PORTUNUS_ERR_TASK_CREATE;
+        return err;
     }
+    ESP_LOGD(TAG, "FSM on reactor (poll_interval=%d ms)", FSM_POLL_INTERVAL_MS);
 
     /* ── Start credential polling sub-task ──────────────────────────────── */
     if (m_caps.has_reader) {
-        ret = xTaskCreate(
+        BaseType_t ret = xTaskCreatePinnedToCore(
             credential_poll_task_entry,
             "credential_poll",
             POLL_TASK_STACK,
             this,
-            POLL_TASK_PRIORITY,
-            &m_poll_task_handle
+            READER_TASK_PRIORITY,
+            &m_poll_task_handle,
+            TASK_CORE_IO
         );
         if (ret != pdPASS) {
             ESP_LOGE(TAG, "Failed to create credential polling task");
@@ -217,22 +216,27 @@ void SystemFSM::on_event_bus_event(const portunus_event_t *event, void *ctx)
     }
 
     /*
-     * Copy the event into the FSM's internal queue.  Use a short
-     * timeout — if the queue is full we drop the event rather than
-     * blocking the event bus dispatcher (which would stall all
-     * other subscribers).
+     * Copy the event into the FSM's internal queue.  No timeout — the bus
+     * dispatches on the reactor, the same task that drains this queue, so
+     * waiting could never succeed; if the queue is full we drop the event.
      */
-    if (xQueueSend(fsm->m_event_queue, event, pdMS_TO_TICKS(10)) != pdTRUE) {
+    if (xQueueSend(fsm->m_event_queue, event, 0) != pdTRUE) {
         ESP_LOGW(TAG, "FSM event queue full — dropped event 0x%04x", event->id);
+        return;
     }
+    reactor_signal(&fsm->m_event_source);
 }
 
-/* ── Task entry points ────────────────────────────────────────────────────── */
+/* ── Reactor / task entry points ──────────────────────────────────────────── */
 
-void SystemFSM::fsm_task_entry(void *arg)
+void SystemFSM::on_events_ready(void *ctx)
 {
-    auto *fsm = static_cast<SystemFSM *>(arg);
-    fsm->run();
+    static_cast<SystemFSM *>(ctx)->drain_events();
+}
+
+void SystemFSM::on_tick_timer(void *ctx)
+{
+    static_cast<SystemFSM *>(ctx)->tick();
 }
 
 void SystemFSM::credential_poll_task_entry(void *arg)
@@ -241,44 +245,47 @@ void SystemFSM::credential_poll_task_entry(void *arg)
     fsm->poll_credential();
 }
 
-/* ── FSM main loop ────────────────────────────────────────────────────────── */
+/* ── FSM handlers ─────────────────────────────────────────────────────────── */
 
-void SystemFSM::run()
+void SystemFSM::drain_events()
 {
     portunus_event_t event;
-    const TickType_t poll_timeout = pdMS_TO_TICKS(FSM_POLL_INTERVAL_MS);
+    bool any = false;
 
-    ESP_LOGD(TAG, "FSM task running (poll_interval=%d ms)", FSM_POLL_INTERVAL_MS);
+    while (xQueueReceive(m_event_queue, &event, 0) == pdTRUE) {
+        process_event(event);
+        any = true;
+    }
 
-    for (;;) {
-        /* 1. Wait for an event or timeout. */
-        if (xQueueReceive(m_event_queue, &event, poll_timeout) == pdTRUE) {
-            /* 2. Process received event. */
-            process_event(event);
-        }
+    /* Same ordering as the old task loop: checks follow every event. */
+    if (any) {
+        tick();
+    }
+}
 
-        /* 3. Poll reed switch for door state changes. */
-        if (m_caps.has_access_point) {
-            poll_reed_switch();
-        }
+void SystemFSM::tick()
+{
+    /* Poll reed switch for door state changes. */
+    if (m_caps.has_access_point) {
+        poll_reed_switch();
+    }
 
-        /* 4. Check unlock hold timer. */
-        if (m_strike_energized) {
-            check_unlock_timer();
-        }
+    /* Check unlock hold timer. */
+    if (m_strike_energized) {
+        check_unlock_timer();
+    }
 
-        /* 5. Update network capability dynamically. */
+    /* Update network capability dynamically. */
 #ifdef CONFIG_PORTUNUS_ENABLE_WIFI
-        m_caps.has_network = wifi_mgr_is_connected();
+    m_caps.has_network = wifi_mgr_is_connected();
 #endif
-    }
 }
 
 /* ── Event processing ─────────────────────────────────────────────────────── */
 
 void SystemFSM::process_event(const portunus_event_t &event)
 {
-    const fsm_actions_t actions = decide_system_event(m_caps, event);
+    const fsm_actions_t actions = decide_system_event(m_caps, event, m_clock->now_ms());
 
     /* Audit logging — preserved verbatim from the original handlers. */
     switch (event.id) {
@@ -287,6 +294,7 @@ void SystemFSM::process_event(const portunus_event_t &event)
         char log_id[CREDENTIAL_LOG_ID_LEN];
         credential_uid_to_log_id(&cred->credential, log_id, sizeof(log_id));
         ESP_LOGI(TAG, "Credential read — id=%s", log_id);
+        m_last_tap_ms = cred->timestamp_ms;
         if (!m_caps.has_network) {
             ESP_LOGW(TAG, "Network unavailable — credential logged locally only");
         }
@@ -295,8 +303,12 @@ void SystemFSM::process_event(const portunus_event_t &event)
     case EVENT_ACCESS_GRANTED: {
         const event_access_decision_t *ad = &event.payload.access_decision;
         ESP_LOGI(TAG, "ACCESS GRANTED — credential=%s reason=%s",
-                 ad->credential_id, ad->reason);
-        if (!m_caps.has_access_point) {
+                 ad->credential_id, access_reason_name(ad->reason));
+        if (actions.stale) {
+            tap_stats_note_stale();
+            ESP_LOGW(TAG, "Grant arrived %" PRId64 " ms past the tap deadline — not unlocking",
+                     m_clock->now_ms() - ad->deadline_ms);
+        } else if (!m_caps.has_access_point) {
             ESP_LOGW(TAG, "Access granted but no access point — cannot unlock");
         }
         break;
@@ -304,7 +316,7 @@ void SystemFSM::process_event(const portunus_event_t &event)
     case EVENT_ACCESS_DENIED: {
         const event_access_decision_t *ad = &event.payload.access_decision;
         ESP_LOGW(TAG, "ACCESS DENIED — credential=%s reason=%s known=%d",
-                 ad->credential_id, ad->reason, ad->known);
+                 ad->credential_id, access_reason_name(ad->reason), ad->known);
         break;
     }
     default:
@@ -319,6 +331,14 @@ void SystemFSM::process_event(const portunus_event_t &event)
             start_unlock_timer();
             ESP_LOGI(TAG, "Strike energized — hold timer started (%d ms)",
                      UNLOCK_HOLD_MS);
+            if (m_last_tap_ms != 0) {
+                int64_t latency = m_clock->now_ms() - m_last_tap_ms;
+                m_last_tap_ms = 0;
+                if (latency < m_latency_min_ms) m_latency_min_ms = latency;
+                if (latency > m_latency_max_ms) m_latency_max_ms = latency;
+                ESP_LOGI(TAG, "Tap-to-unlock %" PRId64 " ms (min %" PRId64 " max %" PRId64 ")",
+                         latency, m_latency_min_ms, m_latency_max_ms);
+            }
         } else {
             ESP_LOGE(TAG, "Failed to unlock: 0x%" PRIx32, (uint32_t)err);
         }
@@ -457,6 +477,8 @@ void SystemFSM::poll_credential()
             event.id                                   = EVENT_CREDENTIAL_READ;
             event.payload.credential_read.credential   = cred;
             event.payload.credential_read.timestamp_ms = m_clock->now_ms();
+            event.payload.credential_read.deadline_ms  =
+                event.payload.credential_read.timestamp_ms + TAP_DEADLINE_MS;
             event_bus_publish(&event);
 
             m_reader->halt();
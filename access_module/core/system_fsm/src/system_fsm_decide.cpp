@@ -5,7 +5,8 @@ static inline void push_feedback(fsm_actions_t &a, feedback_type_t f) {
 }
 
 fsm_actions_t decide_system_event(const system_capabilities_t &caps,
-                                  const portunus_event_t       &event)
+                                  const portunus_event_t       &event,
+                                  int64_t                       now_ms)
 {
     fsm_actions_t a;
     switch (event.id) {
@@ -16,6 +17,12 @@ fsm_actions_t decide_system_event(const system_capabilities_t &caps,
         }
         break;
     case EVENT_ACCESS_GRANTED:
+        if (event.payload.access_decision.deadline_ms != 0 &&
+            now_ms >= event.payload.access_decision.deadline_ms) {
+            a.stale = true;
+            if (caps.has_feedback) push_feedback(a, feedback_type_t::ACCESS_DENIED);
+            break;
+        }
         if (caps.has_access_point) a.door = door_cmd_t::UNLOCK_AND_HOLD;
         if (caps.has_feedback)     push_feedback(a, feedback_type_t::ACCESS_GRANTED);
         break;
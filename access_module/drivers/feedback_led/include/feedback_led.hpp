@@ -2,9 +2,9 @@
  * @file feedback_led.h
  * @brief IFeedback implementation using a single status LED.
  *
- * Owns a FreeRTOS task that executes LED blink patterns.  indicate()
- * is non-blocking — it sends the new pattern to the task via a
- * FreeRTOS task notification, which preempts any in-progress pattern.
+ * Executes LED blink patterns on the reactor task.  indicate() is
+ * non-blocking — it records the new pattern and signals the reactor,
+ * which preempts any in-progress pattern.
  *
  * Pattern types:
  *   - One-shot (ACCESS_GRANTED, ACCESS_DENIED): run to completion,
@@ -20,8 +20,9 @@
 
 #include "i_feedback.hpp"
 
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
+#include "reactor.hpp"
+
+#include <atomic>
 
 /**
  * @brief Concrete feedback module backed by a single GPIO LED.
@@ -34,8 +35,16 @@ public:
     void           indicate(feedback_type_t type) override;
 
 private:
-    TaskHandle_t m_task_handle = nullptr;
+    reactor_source_t      m_source   = {};  /**< Signalled by indicate() */
+    reactor_timer_t       m_timer    = {};  /**< 50ms pattern tick */
+    std::atomic<uint32_t> m_pending{0};     /**< Requested type + 1; 0 = none */
+    bool                  m_attached = false;
+
+    /* Reactor-task only. */
+    feedback_type_t m_current = feedback_type_t::NONE;
+    int             m_tick    = 0;
 
-    static void pattern_task(void *arg);
-    void run_patterns();
+    static void on_pattern_changed(void *ctx);
+    static void on_tick(void *ctx);
+    void step();                            /**< Advance the current pattern one tick */
 };
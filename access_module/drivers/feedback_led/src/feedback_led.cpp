@@ -2,12 +2,13 @@
  * @file feedback_led.cpp
  * @brief IFeedback implementation using a single status LED.
  *
- * The pattern task loops at a 50ms tick rate.  On each tick it:
- *   1. Checks for a new pattern via xTaskNotifyWait (non-blocking).
- *   2. Advances the current pattern state machine by one tick.
- *
- * A new indicate() call sends a task notification that is picked up
- * on the next tick, immediately preempting any in-progress pattern.
+ * Patterns run on the reactor task (see reactor.hpp) at a 50ms tick rate:
+ *   - indicate() stores the requested pattern and signals a reactor source.
+ *   - The source handler swaps in the new pattern, runs tick 0 at once and
+ *     (re)starts a 50ms periodic reactor timer, preempting any in-progress
+ *     pattern.
+ *   - Each timer expiry advances the pattern state machine by one tick;
+ *     the timer stops itself when a one-shot pattern finishes.
  */
 
 #include "feedback_led.hpp"
@@ -17,15 +18,12 @@
 #include <inttypes.h>
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
-
-#include <climits>
 
 static const char *TAG = "feedback_led";
 
 /* ── Pattern timing (in ticks, 1 tick = 50ms) ────────────────────────────── */
 
-static const TickType_t TICK_MS = 50;
+static const uint32_t TICK_MS = 50;
 
 /* ACCESS_GRANTED: solid on for 1000ms = 20 ticks */
 static const int GRANTED_ON_TICKS = 20;
@@ -85,11 +83,6 @@ static const int PEU_PENDING_ON    = 4;   /* 200ms */
 static const int PEU_PENDING_OFF   = 12;  /* 600ms */
 static const int PEU_PENDING_COUNT = 3;
 
-/* ── Task configuration ───────────────────────────────────────────────────── */
-
-static const int PATTERN_TASK_STACK = 2048;
-static const int PATTERN_TASK_PRIORITY = 3;
-
 /* ── Implementation ───────────────────────────────────────────────────────── */
 
 portunus_err_t FeedbackLed::init()
@@ -102,19 +95,12 @@ portunus_err_t FeedbackLed::init()
         return err;
     }
 
-    BaseType_t ret = xTaskCreate(
-        pattern_task,
-        "led_pattern",
-        PATTERN_TASK_STACK,
-        this,
-        PATTERN_TASK_PRIORITY,
-        &m_task_handle
-    );
-
-    if (ret != pdPASS) {
-        ESP_LOGE(TAG, "Failed to create pattern task");
-        return PORTUNUS_ERR_TASK_CREATE;
+    err = reactor_source_register(&m_source, on_pattern_changed, this);
+    if (err != PORTUNUS_OK) {
+        ESP_LOGE(TAG, "Failed to attach to reactor: 0x%" PRIx32, (uint32_t)err);
+        return err;
     }
+    m_attached = true;
 
     ESP_LOGI(TAG, "LED feedback driver initialised");
     return PORTUNUS_OK;
@@ -122,300 +108,304 @@ portunus_err_t FeedbackLed::init()
 
 void FeedbackLed::indicate(feedback_type_t type)
 {
-    if (m_task_handle == nullptr) {
+    if (!m_attached) {
+        return;
+    }
+
+    /* Latest request wins; the reactor picks it up on its next pass. */
+    m_pending.store(static_cast<uint32_t>(type) + 1);
+    reactor_signal(&m_source);
+}
+
+void FeedbackLed::on_pattern_changed(void *ctx)
+{
+    auto *self = static_cast<FeedbackLed *>(ctx);
+    uint32_t pending = self->m_pending.exchange(0);
+    if (pending == 0) {
+        return;
+    }
+
+    self->m_current = static_cast<feedback_type_t>(pending - 1);
+    self->m_tick    = 0;
+
+    if (self->m_current == feedback_type_t::NONE) {
+        reactor_timer_stop(&self->m_timer);
+        led_off();
         return;
     }
 
-    xTaskNotify(m_task_handle,
-                static_cast<uint32_t>(type),
-                eSetValueWithOverwrite);
+    /* Tick 0 runs now; later ticks are paced by the timer. */
+    self->step();
+    reactor_timer_start(&self->m_timer, TICK_MS, TICK_MS, on_tick, self);
 }
 
-void FeedbackLed::pattern_task(void *arg)
+void FeedbackLed::on_tick(void *ctx)
 {
-    auto *self = static_cast<FeedbackLed *>(arg);
-    self->run_patterns();
+    auto *self = static_cast<FeedbackLed *>(ctx);
+    self->step();
+
+    /* One-shot finished — nothing to do until the next indicate(). */
+    if (self->m_current == feedback_type_t::NONE) {
+        reactor_timer_stop(&self->m_timer);
+    }
 }
 
-void FeedbackLed::run_patterns()
+void FeedbackLed::step()
 {
-    feedback_type_t current = feedback_type_t::NONE;
-    int tick = 0;
-
-    for (;;) {
-        uint32_t notify_value = 0;
-        BaseType_t got_notify = xTaskNotifyWait(
-            0,
-            ULONG_MAX,
-            &notify_value,
-            pdMS_TO_TICKS(TICK_MS)
-        );
-
-        if (got_notify == pdTRUE) {
-            current = static_cast<feedback_type_t>(notify_value);
-            tick = 0;
-
-            if (current == feedback_type_t::NONE) {
-                led_off();
-                continue;
-            }
+    switch (m_current) {
+    case feedback_type_t::NONE:
+        break;
+
+    case feedback_type_t::ACCESS_GRANTED:
+        if (m_tick == 0) {
+            led_on();
+        }
+        if (m_tick >= GRANTED_ON_TICKS) {
+            led_off();
+            m_current = feedback_type_t::NONE;
         }
+        break;
 
-        switch (current) {
-        case feedback_type_t::NONE:
-            break;
+    case feedback_type_t::ACCESS_DENIED: {
+        int cycle_len = DENIED_BLINK_ON_TICKS + DENIED_BLINK_OFF_TICKS;
+        int total_ticks = cycle_len * DENIED_BLINK_COUNT;
 
-        case feedback_type_t::ACCESS_GRANTED:
-            if (tick == 0) {
+        if (m_tick < total_ticks) {
+            int pos_in_cycle = m_tick % cycle_len;
+            if (pos_in_cycle < DENIED_BLINK_ON_TICKS) {
                 led_on();
-            }
-            if (tick >= GRANTED_ON_TICKS) {
-                led_off();
-                current = feedback_type_t::NONE;
-            }
-            break;
-
-        case feedback_type_t::ACCESS_DENIED: {
-            int cycle_len = DENIED_BLINK_ON_TICKS + DENIED_BLINK_OFF_TICKS;
-            int total_ticks = cycle_len * DENIED_BLINK_COUNT;
-
-            if (tick < total_ticks) {
-                int pos_in_cycle = tick % cycle_len;
-                if (pos_in_cycle < DENIED_BLINK_ON_TICKS) {
-                    led_on();
-                } else {
-                    led_off();
-                }
             } else {
                 led_off();
-                current = feedback_type_t::NONE;
             }
-            break;
+        } else {
+            led_off();
+            m_current = feedback_type_t::NONE;
         }
+        break;
+    }
 
-        case feedback_type_t::SYSTEM_READY:
-            {
-                int pos = tick % READY_CYCLE_TICKS;
-                if (pos < READY_ON_TICKS) {
-                    led_on();
-                } else {
-                    led_off();
-                }
-            }
-            break;
-
-        case feedback_type_t::SYSTEM_ERROR:
-            {
-                int pos = tick % (ERROR_HALF_CYCLE_TICKS * 2);
-                if (pos < ERROR_HALF_CYCLE_TICKS) {
-                    led_on();
-                } else {
-                    led_off();
-                }
-            }
-            break;
-
-        case feedback_type_t::CARD_READ:
-            if (tick == 0) {
-                led_on();
-            }
-            break;
-
-        case feedback_type_t::PROVISIONING_IDLE: {
-            /* Double-blink every 4 s: pulse–gap–pulse–long-off */
-            int pos = tick % PROV_IDLE_CYCLE_TICKS;
-            int second_pulse_start = PROV_IDLE_ON_TICKS + PROV_IDLE_GAP_TICKS;
-            if (pos == 0 || pos == second_pulse_start) {
+    case feedback_type_t::SYSTEM_READY:
+        {
+            int pos = m_tick % READY_CYCLE_TICKS;
+            if (pos < READY_ON_TICKS) {
                 led_on();
-            } else if (pos == PROV_IDLE_ON_TICKS ||
-                       pos == second_pulse_start + PROV_IDLE_ON_TICKS) {
+            } else {
                 led_off();
             }
-            break;
         }
+        break;
 
-        case feedback_type_t::PROVISIONING_AWAITING: {
-            /* 1 s on / 1 s off slow pulse */
-            int pos = tick % (PROV_AWAIT_HALF_TICKS * 2);
-            if (pos == 0) {
+    case feedback_type_t::SYSTEM_ERROR:
+        {
+            int pos = m_tick % (ERROR_HALF_CYCLE_TICKS * 2);
+            if (pos < ERROR_HALF_CYCLE_TICKS) {
                 led_on();
-            } else if (pos == PROV_AWAIT_HALF_TICKS) {
+            } else {
                 led_off();
             }
-            break;
         }
+        break;
 
-        case feedback_type_t::PROVISIONING_SUCCESS: {
-            /* 5× rapid blinks then off (one-shot) */
-            int cycle = PROV_SUCCESS_ON + PROV_SUCCESS_OFF;
-            int total = cycle * PROV_SUCCESS_COUNT;
-            if (tick < total) {
-                int pos = tick % cycle;
-                if (pos == 0) led_on();
-                else if (pos == PROV_SUCCESS_ON) led_off();
-            } else {
-                led_off();
-                current = feedback_type_t::NONE;
-            }
-            break;
+    case feedback_type_t::CARD_READ:
+        if (m_tick == 0) {
+            led_on();
+        }
+        break;
+
+    case feedback_type_t::PROVISIONING_IDLE: {
+        /* Double-blink every 4 s: pulse–gap–pulse–long-off */
+        int pos = m_tick % PROV_IDLE_CYCLE_TICKS;
+        int second_pulse_start = PROV_IDLE_ON_TICKS + PROV_IDLE_GAP_TICKS;
+        if (pos == 0 || pos == second_pulse_start) {
+            led_on();
+        } else if (pos == PROV_IDLE_ON_TICKS ||
+                   pos == second_pulse_start + PROV_IDLE_ON_TICKS) {
+            led_off();
         }
+        break;
+    }
 
-        case feedback_type_t::PROVISIONING_DUPLICATE: {
-            /* 2× medium blinks then off (one-shot) */
-            int cycle = PROV_DUP_ON + PROV_DUP_OFF;
-            int total = cycle * PROV_DUP_COUNT;
-            if (tick < total) {
-                int pos = tick % cycle;
-                if (pos == 0) led_on();
-                else if (pos == PROV_DUP_ON) led_off();
-            } else {
-                led_off();
-                current = feedback_type_t::NONE;
-            }
-            break;
+    case feedback_type_t::PROVISIONING_AWAITING: {
+        /* 1 s on / 1 s off slow pulse */
+        int pos = m_tick % (PROV_AWAIT_HALF_TICKS * 2);
+        if (pos == 0) {
+            led_on();
+        } else if (pos == PROV_AWAIT_HALF_TICKS) {
+            led_off();
         }
+        break;
+    }
 
-        case feedback_type_t::PROVISIONING_UNAUTHORIZED: {
-            /* 500ms solid on, then 3× rapid blinks, then off (one-shot) */
-            if (tick == 0) {
-                led_on();
-            } else if (tick == PROV_UNAUTH_LONG_ON) {
-                led_off();
-            } else if (tick > PROV_UNAUTH_LONG_ON) {
-                int pos_in_rapid = tick - PROV_UNAUTH_LONG_ON;
-                int cycle  = PROV_UNAUTH_RAPID_ON + PROV_UNAUTH_RAPID_OFF;
-                int total  = cycle * PROV_UNAUTH_RAPID_COUNT;
-                if (pos_in_rapid < total) {
-                    int pos = pos_in_rapid % cycle;
-                    if (pos == 0) led_on();
-                    else if (pos == PROV_UNAUTH_RAPID_ON) led_off();
-                } else {
-                    led_off();
-                    current = feedback_type_t::NONE;
-                }
-            }
-            break;
+    case feedback_type_t::PROVISIONING_SUCCESS: {
+        /* 5× rapid blinks then off (one-shot) */
+        int cycle = PROV_SUCCESS_ON + PROV_SUCCESS_OFF;
+        int total = cycle * PROV_SUCCESS_COUNT;
+        if (m_tick < total) {
+            int pos = m_tick % cycle;
+            if (pos == 0) led_on();
+            else if (pos == PROV_SUCCESS_ON) led_off();
+        } else {
+            led_off();
+            m_current = feedback_type_t::NONE;
         }
+        break;
+    }
 
-        /* ── PEU 7-state FSM feedback ──────────────────────────────────── */
+    case feedback_type_t::PROVISIONING_DUPLICATE: {
+        /* 2× medium blinks then off (one-shot) */
+        int cycle = PROV_DUP_ON + PROV_DUP_OFF;
+        int total = cycle * PROV_DUP_COUNT;
+        if (m_tick < total) {
+            int pos = m_tick % cycle;
+            if (pos == 0) led_on();
+            else if (pos == PROV_DUP_ON) led_off();
+        } else {
+            led_off();
+            m_current = feedback_type_t::NONE;
+        }
+        break;
+    }
 
-        case feedback_type_t::PEU_IDLE: {
-            /* Double-blink every 6 s: pulse–gap–pulse–long-off */
-            int pos = tick % PEU_IDLE_CYCLE_TICKS;
-            int second_pulse_start = PEU_IDLE_ON_TICKS + PEU_IDLE_GAP_TICKS;
-            if (pos == 0 || pos == second_pulse_start) {
-                led_on();
-            } else if (pos == PEU_IDLE_ON_TICKS ||
-                       pos == second_pulse_start + PEU_IDLE_ON_TICKS) {
+    case feedback_type_t::PROVISIONING_UNAUTHORIZED: {
+        /* 500ms solid on, then 3× rapid blinks, then off (one-shot) */
+        if (m_tick == 0) {
+            led_on();
+        } else if (m_tick == PROV_UNAUTH_LONG_ON) {
+            led_off();
+        } else if (m_tick > PROV_UNAUTH_LONG_ON) {
+            int pos_in_rapid = m_tick - PROV_UNAUTH_LONG_ON;
+            int cycle  = PROV_UNAUTH_RAPID_ON + PROV_UNAUTH_RAPID_OFF;
+            int total  = cycle * PROV_UNAUTH_RAPID_COUNT;
+            if (pos_in_rapid < total) {
+                int pos = pos_in_rapid % cycle;
+                if (pos == 0) led_on();
+                else if (pos == PROV_UNAUTH_RAPID_ON) led_off();
+            } else {
                 led_off();
+                m_current = feedback_type_t::NONE;
             }
-            break;
         }
+        break;
+    }
 
-        case feedback_type_t::PEU_ARMED_CAPTURE: {
-            /* Triple rapid pulse every 2 s — continuous */
-            int burst_len = (PEU_ARM_CAP_ON_TICKS + PEU_ARM_CAP_OFF_TICKS) * PEU_ARM_CAP_PULSES;
-            int pos = tick % PEU_ARM_CAP_CYCLE;
-            if (pos < burst_len) {
-                int sub = pos % (PEU_ARM_CAP_ON_TICKS + PEU_ARM_CAP_OFF_TICKS);
-                if (sub == 0) led_on();
-                else if (sub == PEU_ARM_CAP_ON_TICKS) led_off();
-            } else if (pos == burst_len) {
-                led_off(); /* ensure off during gap */
-            }
-            break;
+    /* ── PEU 7-state FSM feedback ──────────────────────────────────── */
+
+    case feedback_type_t::PEU_IDLE: {
+        /* Double-blink every 6 s: pulse–gap–pulse–long-off */
+        int pos = m_tick % PEU_IDLE_CYCLE_TICKS;
+        int second_pulse_start = PEU_IDLE_ON_TICKS + PEU_IDLE_GAP_TICKS;
+        if (pos == 0 || pos == second_pulse_start) {
+            led_on();
+        } else if (pos == PEU_IDLE_ON_TICKS ||
+                   pos == second_pulse_start + PEU_IDLE_ON_TICKS) {
+            led_off();
         }
+        break;
+    }
 
-        case feedback_type_t::PEU_ARMED_ENROLL: {
-            /* 500ms on / 500ms off fast 50/50 pulse — continuous */
-            int pos = tick % (PEU_ARM_ENR_HALF_TICKS * 2);
-            if (pos == 0) {
-                led_on();
-            } else if (pos == PEU_ARM_ENR_HALF_TICKS) {
-                led_off();
-            }
-            break;
+    case feedback_type_t::PEU_ARMED_CAPTURE: {
+        /* Triple rapid pulse every 2 s — continuous */
+        int burst_len = (PEU_ARM_CAP_ON_TICKS + PEU_ARM_CAP_OFF_TICKS) * PEU_ARM_CAP_PULSES;
+        int pos = m_tick % PEU_ARM_CAP_CYCLE;
+        if (pos < burst_len) {
+            int sub = pos % (PEU_ARM_CAP_ON_TICKS + PEU_ARM_CAP_OFF_TICKS);
+            if (sub == 0) led_on();
+            else if (sub == PEU_ARM_CAP_ON_TICKS) led_off();
+        } else if (pos == burst_len) {
+            led_off(); /* ensure off during gap */
         }
+        break;
+    }
 
-        case feedback_type_t::PEU_RESULT_PENDING: {
-            /* 3× slow blinks 200ms on / 600ms off then off (one-shot) */
-            int cycle = PEU_PENDING_ON + PEU_PENDING_OFF;
-            int total = cycle * PEU_PENDING_COUNT;
-            if (tick < total) {
-                int pos = tick % cycle;
-                if (pos == 0) led_on();
-                else if (pos == PEU_PENDING_ON) led_off();
-            } else {
-                led_off();
-                current = feedback_type_t::NONE;
-            }
-            break;
+    case feedback_type_t::PEU_ARMED_ENROLL: {
+        /* 500ms on / 500ms off fast 50/50 pulse — continuous */
+        int pos = m_tick % (PEU_ARM_ENR_HALF_TICKS * 2);
+        if (pos == 0) {
+            led_on();
+        } else if (pos == PEU_ARM_ENR_HALF_TICKS) {
+            led_off();
         }
+        break;
+    }
 
-        case feedback_type_t::PEU_RESULT_SUCCESS: {
-            /* 5× rapid blinks then off (one-shot) — same as PROVISIONING_SUCCESS */
-            int cycle = PROV_SUCCESS_ON + PROV_SUCCESS_OFF;
-            int total = cycle * PROV_SUCCESS_COUNT;
-            if (tick < total) {
-                int pos = tick % cycle;
-                if (pos == 0) led_on();
-                else if (pos == PROV_SUCCESS_ON) led_off();
-            } else {
-                led_off();
-                current = feedback_type_t::NONE;
-            }
-            break;
+    case feedback_type_t::PEU_RESULT_PENDING: {
+        /* 3× slow blinks 200ms on / 600ms off then off (one-shot) */
+        int cycle = PEU_PENDING_ON + PEU_PENDING_OFF;
+        int total = cycle * PEU_PENDING_COUNT;
+        if (m_tick < total) {
+            int pos = m_tick % cycle;
+            if (pos == 0) led_on();
+            else if (pos == PEU_PENDING_ON) led_off();
+        } else {
+            led_off();
+            m_current = feedback_type_t::NONE;
         }
+        break;
+    }
 
-        case feedback_type_t::PEU_RESULT_DUPLICATE: {
-            /* 2× medium blinks then off (one-shot) — same as PROVISIONING_DUPLICATE */
-            int cycle = PROV_DUP_ON + PROV_DUP_OFF;
-            int total = cycle * PROV_DUP_COUNT;
-            if (tick < total) {
-                int pos = tick % cycle;
-                if (pos == 0) led_on();
-                else if (pos == PROV_DUP_ON) led_off();
-            } else {
-                led_off();
-                current = feedback_type_t::NONE;
-            }
-            break;
+    case feedback_type_t::PEU_RESULT_SUCCESS: {
+        /* 5× rapid blinks then off (one-shot) — same as PROVISIONING_SUCCESS */
+        int cycle = PROV_SUCCESS_ON + PROV_SUCCESS_OFF;
+        int total = cycle * PROV_SUCCESS_COUNT;
+        if (m_tick < total) {
+            int pos = m_tick % cycle;
+            if (pos == 0) led_on();
+            else if (pos == PROV_SUCCESS_ON) led_off();
+        } else {
+            led_off();
+            m_current = feedback_type_t::NONE;
         }
+        break;
+    }
 
-        case feedback_type_t::PEU_RESULT_UNAUTHORIZED: {
-            /* 500ms solid on + 3× rapid blinks then off (one-shot) */
-            if (tick == 0) {
-                led_on();
-            } else if (tick == PROV_UNAUTH_LONG_ON) {
-                led_off();
-            } else if (tick > PROV_UNAUTH_LONG_ON) {
-                int pos_in_rapid = tick - PROV_UNAUTH_LONG_ON;
-                int cycle  = PROV_UNAUTH_RAPID_ON + PROV_UNAUTH_RAPID_OFF;
-                int total  = cycle * PROV_UNAUTH_RAPID_COUNT;
-                if (pos_in_rapid < total) {
-                    int pos = pos_in_rapid % cycle;
-                    if (pos == 0) led_on();
-                    else if (pos == PROV_UNAUTH_RAPID_ON) led_off();
-                } else {
-                    led_off();
-                    current = feedback_type_t::NONE;
-                }
-            }
-            break;
+    case feedback_type_t::PEU_RESULT_DUPLICATE: {
+        /* 2× medium blinks then off (one-shot) — same as PROVISIONING_DUPLICATE */
+        int cycle = PROV_DUP_ON + PROV_DUP_OFF;
+        int total = cycle * PROV_DUP_COUNT;
+        if (m_tick < total) {
+            int pos = m_tick % cycle;
+            if (pos == 0) led_on();
+            else if (pos == PROV_DUP_ON) led_off();
+        } else {
+            led_off();
+            m_current = feedback_type_t::NONE;
         }
+        break;
+    }
 
-        case feedback_type_t::PEU_RESULT_ERROR: {
-            /* Rapid blink 200ms on/off — continuous (same as SYSTEM_ERROR) */
-            int pos = tick % (ERROR_HALF_CYCLE_TICKS * 2);
-            if (pos == 0) {
-                led_on();
-            } else if (pos == ERROR_HALF_CYCLE_TICKS) {
+    case feedback_type_t::PEU_RESULT_UNAUTHORIZED: {
+        /* 500ms solid on + 3× rapid blinks then off (one-shot) */
+        if (m_tick == 0) {
+            led_on();
+        } else if (m_tick == PROV_UNAUTH_LONG_ON) {
+            led_off();
+        } else if (m_tick > PROV_UNAUTH_LONG_ON) {
+            int pos_in_rapid = m_tick - PROV_UNAUTH_LONG_ON;
+            int cycle  = PROV_UNAUTH_RAPID_ON + PROV_UNAUTH_RAPID_OFF;
+            int total  = cycle * PROV_UNAUTH_RAPID_COUNT;
+            if (pos_in_rapid < total) {
+                int pos = pos_in_rapid % cycle;
+                if (pos == 0) led_on();
+                else if (pos == PROV_UNAUTH_RAPID_ON) led_off();
+            } else {
                 led_off();
+                m_current = feedback_type_t::NONE;
             }
-            break;
-        }
         }
+        break;
+    }
 
-        tick++;
+    case feedback_type_t::PEU_RESULT_ERROR: {
+        /* Rapid blink 200ms on/off — continuous (same as SYSTEM_ERROR) */
+        int pos = m_tick % (ERROR_HALF_CYCLE_TICKS * 2);
+        if (pos == 0) {
+            led_on();
+        } else if (pos == ERROR_HALF_CYCLE_TICKS) {
+            led_off();
+        }
+        break;
     }
+    }
+
+    m_tick++;
 }
@@ -4,7 +4,11 @@
  *
  * Low-level SPI driver for the NXP MFRC522 contactless reader IC.
  * Supports credential detection, anti-collision, and UID extraction for
- * MIFARE credentials with 4-byte and 7-byte UIDs.
+ * MIFARE credentials with 4-, 7- and 10-byte UIDs.
+ *
+ * Register access goes through an mfrc522_spi_t transport: the SPI master
+ * bus on the device (mfrc522_spi_esp_open()), or an emulated chip on the
+ * linux target (test/mfrc522_bench).
  *
  * This is an internal HAL header, private to the reader_mfrc522 driver.
 ReaderMfrc522 exposes this functionality via ICredentialReader.
@@ -16,20 +20,50 @@ ReaderMfrc522 exposes this functionality via ICredentialReader.
 #include "credential_types.h"
 #include "portunus_types.hpp"
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** SPI clock — well within the MFRC522's 10 MHz maximum. */
+#define MFRC522_SPI_CLOCK_HZ  5000000
+
+/**
+ * @brief How the HAL reaches the chip's registers.
+ *
+ * transfer() clocks @p len bytes out of @p tx and into @p rx (full duplex,
+ * NULL @p rx to discard) with chip select held for the whole transfer.
+ * Each call is one SPI transaction.
+ */
+typedef struct {
+    portunus_err_t (*transfer)(void *ctx, const uint8_t *tx, uint8_t *rx, size_t len);
+    void *ctx;
+} mfrc522_spi_t;
+
+/**
+ * @brief Open the MFRC522 on the SPI master bus (device builds only).
+ *
+ * Initialises the bus and device on the first call and pulses RST (if
+ * wired) on every call, so the reader's recovery path gets a hardware
+ * reset.
+ *
+ * @param[out] out  Transport for mfrc522_init().
+ * @return PORTUNUS_OK, or PORTUNUS_ERR_SPI_INIT.
+ */
+portunus_err_t mfrc522_spi_esp_open(mfrc522_spi_t *out);
+
 /**
  * @brief Initialise the MFRC522 driver.
  *
- * Configures the SPI bus and device, performs a soft reset, and sets up
- * default register values (gain, timer, CRC preset). Verifies
- * communication by reading the version register.
+ * Performs a soft reset over @p spi and sets up default register values
+ * (gain, timer, CRC preset). Verifies communication by reading the
+ * version register.
  *
+ * @param spi  Register transport (copied).
  * @return PORTUNUS_OK on success, or an error code.
  */
-portunus_err_t mfrc522_init(void);
+portunus_err_t mfrc522_init(const mfrc522_spi_t *spi);
 
 /**
  * @brief Attempt to read a credential UID from the reader field.
@@ -3,15 +3,13 @@
  * @brief MFRC522 HAL implementation — private to reader_mfrc522.
  *
  * Register-level SPI driver implementing ISO 14443A card detection,
- * anti-collision cascade levels 1 and 2, and UID extraction.
+ * anti-collision cascade levels 1 to 3, and UID extraction.  The SPI bus
+ * itself is behind mfrc522_spi_t (mfrc522_spi_esp.cpp on the device).
  */
 
 #include "mfrc522.hpp"
-#include "pin_config.hpp"
 #include "error_codes.hpp"
 
-#include "driver/spi_master.h"
-#include "driver/gpio.h"
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -83,15 +81,10 @@ static const char *TAG = "mfrc522";
 #define IRQ_ERR            0x02
 #define IRQ_TIMER          0x01
 
-/* ── SPI configuration ─────────────────────────────────────────────────────── */
-
-#define MFRC522_SPI_CLOCK_HZ  5000000   /* 5 MHz — well within MFRC522 max of 10 MHz */
-
 /* ── Module state ──────────────────────────────────────────────────────────── */
 
-static spi_device_handle_t s_spi_handle     = NULL;
-static bool                s_spi_error      = false; /* set by reg_read on transfer failure */
-static bool                s_spi_initialized = false; /* SPI bus + device added; skip on re-init */
+static mfrc522_spi_t s_spi         = {};
+static bool          s_spi_error   = false; /* set by reg_read on transfer failure */
 
 /* ── Low-level SPI register access ─────────────────────────────────────────── */
 
@@ -105,14 +98,8 @@ static uint8_t reg_read(uint8_t reg)
     uint8_t tx[2] = { (uint8_t)(((reg & 0x3F) << 1) | 0x80), 0x00 };
     uint8_t rx[2] = { 0 };
 
-    spi_transaction_t txn = {};
-    txn.length    = 16;     /* 2 bytes = 16 bits */
-    txn.tx_buffer = tx;
-    txn.rx_buffer = rx;
-
-    esp_err_t err = spi_device_transmit(s_spi_handle, &txn);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "SPI read reg 0x%02x failed: %s", reg, esp_err_to_name(err));
+    if (s_spi.transfer(s_spi.ctx, tx, rx, sizeof(tx)) != PORTUNUS_OK) {
+        ESP_LOGE(TAG, "SPI read reg 0x%02x failed", reg);
         s_spi_error = true;
         return 0;
     }
@@ -123,13 +110,8 @@ static void reg_write(uint8_t reg, uint8_t value)
 {
     uint8_t tx[2] = { (uint8_t)((reg & 0x3F) << 1), value };
 
-    spi_transaction_t txn = {};
-    txn.length    = 16;
-    txn.tx_buffer = tx;
-
-    esp_err_t err = spi_device_transmit(s_spi_handle, &txn);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "SPI write reg 0x%02x failed: %s", reg, esp_err_to_name(err));
+    if (s_spi.transfer(s_spi.ctx, tx, NULL, sizeof(tx)) != PORTUNUS_OK) {
+        ESP_LOGE(TAG, "SPI write reg 0x%02x failed", reg);
     }
 }
 
@@ -207,7 +189,7 @@ static portunus_err_t transceive(const uint8_t *send_buf, uint8_t send_len,
     if (s_spi_error) {
         return PORTUNUS_ERR_SPI_TRANSFER;
     }
-    if (error_reg & 0x13) {  /* BufferOvfl | ParityErr | ProtocolErr */
+    if (error_reg & 0x1B) {  /* BufferOvfl | CollErr | ParityErr | ProtocolErr */
         ESP_LOGD(TAG, "Transceive error: 0x%02x", error_reg);
         if (error_reg & 0x08) {  /* CollErr */
             return PORTUNUS_ERR_CREDENTIAL_COLLISION;
@@ -355,56 +337,12 @@ static portunus_err_t picc_anticoll_select(uint8_t sel_cmd, uint8_t *uid_part)
 
 /* ── Public API ────────────────────────────────────────────────────────────── */
 
-portunus_err_t mfrc522_init(void)
+portunus_err_t mfrc522_init(const mfrc522_spi_t *spi)
 {
-    /* ── RST pin: configure on first call, toggle on every call ─────────── */
-    if (PIN_MFRC522_RST >= 0) {
-        if (!s_spi_initialized) {
-            gpio_config_t rst_cfg = {};
-            rst_cfg.pin_bit_mask = (1ULL << PIN_MFRC522_RST);
-            rst_cfg.mode         = GPIO_MODE_OUTPUT;
-            rst_cfg.pull_up_en   = GPIO_PULLUP_DISABLE;
-            rst_cfg.pull_down_en = GPIO_PULLDOWN_DISABLE;
-            rst_cfg.intr_type    = GPIO_INTR_DISABLE;
-            gpio_config(&rst_cfg);
-        }
-        gpio_set_level((gpio_num_t)PIN_MFRC522_RST, 0);
-        vTaskDelay(pdMS_TO_TICKS(10));
-        gpio_set_level((gpio_num_t)PIN_MFRC522_RST, 1);
-        vTaskDelay(pdMS_TO_TICKS(50));
-    }
-
-    /* ── SPI bus and device: initialise once, reuse on recovery calls ─────── */
-    if (!s_spi_initialized) {
-        spi_bus_config_t bus_cfg = {};
-        bus_cfg.mosi_io_num     = PIN_SPI_MOSI;
-        bus_cfg.miso_io_num     = PIN_SPI_MISO;
-        bus_cfg.sclk_io_num     = PIN_SPI_SCLK;
-        bus_cfg.quadwp_io_num   = -1;
-        bus_cfg.quadhd_io_num   = -1;
-        bus_cfg.max_transfer_sz = 64;
-
-        esp_err_t ret = spi_bus_initialize(MFRC522_SPI_HOST, &bus_cfg, SPI_DMA_CH_AUTO);
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "SPI bus init failed: %s", esp_err_to_name(ret));
-            return PORTUNUS_ERR_SPI_INIT;
-        }
-
-        spi_device_interface_config_t dev_cfg = {};
-        dev_cfg.clock_speed_hz = MFRC522_SPI_CLOCK_HZ;
-        dev_cfg.mode           = 0;          /* CPOL=0, CPHA=0 */
-        dev_cfg.spics_io_num   = PIN_MFRC522_CS;
-        dev_cfg.queue_size     = 4;
-
-        ret = spi_bus_add_device(MFRC522_SPI_HOST, &dev_cfg, &s_spi_handle);
-        if (ret != ESP_OK) {
-            ESP_LOGE(TAG, "SPI add device failed: %s", esp_err_to_name(ret));
-            spi_bus_free(MFRC522_SPI_HOST);
-            return PORTUNUS_ERR_SPI_INIT;
-        }
-
-        s_spi_initialized = true;
+    if (spi == NULL || spi->transfer == NULL) {
+        return PORTUNUS_ERR_INVALID_ARG;
     }
+    s_spi = *spi;
 
     /* ── Soft reset ──────────────────────────────────────────────────────── */
     reg_write(REG_COMMAND, CMD_SOFT_RESET);
@@ -461,30 +399,26 @@ portunus_err_t mfrc522_read_credential(credential_t *cred)
     }
     ESP_LOGD(TAG, "ATQA: 0x%02x 0x%02x", atqa[0], atqa[1]);
 
-    /* Step 2 — Cascade level 1 anti-collision + select */
-    uint8_t uid_cl1[5];  /* 4 UID bytes + BCC */
-    err = picc_anticoll_select(PICC_SEL_CL1, uid_cl1);
-    if (err != PORTUNUS_OK) {
-        return err;
-    }
-
-    if (uid_cl1[0] == PICC_CASCADE_TAG) {
-        /* 7- or 10-byte UID: first byte is cascade tag, real UID starts at [1] */
-        memcpy(&cred->uid[0], &uid_cl1[1], 3);
-
-        /* Cascade level 2 */
-        uint8_t uid_cl2[5];
-        err = picc_anticoll_select(PICC_SEL_CL2, uid_cl2);
+    /* Step 2 — Anti-collision + select, one cascade level per 3 or 4 UID
+       bytes.  A cascade tag in the first byte means more levels follow:
+       4-byte UIDs take one level, 7-byte two, 10-byte three. */
+    static const uint8_t sel_cmds[] = { PICC_SEL_CL1, PICC_SEL_CL2, PICC_SEL_CL3 };
+    for (size_t level = 0; level < sizeof(sel_cmds); level++) {
+        uint8_t uid_part[5];  /* 4 UID bytes (or CT + 3) + BCC */
+        err = picc_anticoll_select(sel_cmds[level], uid_part);
         if (err != PORTUNUS_OK) {
             return err;
         }
 
-        memcpy(&cred->uid[3], uid_cl2, 4);
-        cred->uid_len = 7;
-    } else {
-        /* Single-size 4-byte UID */
-        memcpy(cred->uid, uid_cl1, 4);
-        cred->uid_len = 4;
+        bool more = uid_part[0] == PICC_CASCADE_TAG && level + 1 < sizeof(sel_cmds);
+        if (more) {
+            memcpy(&cred->uid[cred->uid_len], &uid_part[1], 3);
+            cred->uid_len += 3;
+            continue;
+        }
+        memcpy(&cred->uid[cred->uid_len], uid_part, 4);
+        cred->uid_len += 4;
+        break;
     }
 
     return PORTUNUS_OK;
@@ -0,0 +1,90 @@
+/**
+ * @file mfrc522_spi_esp.cpp
+ * @brief MFRC522 SPI transport on the ESP32 SPI master — private to reader_mfrc522.
+ */
+
+#include "mfrc522.hpp"
+#include "pin_config.hpp"
+#include "error_codes.hpp"
+
+#include "driver/spi_master.h"
+#include "driver/gpio.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+static const char *TAG = "mfrc522";
+
+static spi_device_handle_t s_spi_handle      = NULL;
+static bool                s_spi_initialized = false; /* SPI bus + device added; skip on re-init */
+
+static portunus_err_t spi_transfer(void *ctx, const uint8_t *tx, uint8_t *rx, size_t len)
+{
+    spi_transaction_t txn = {};
+    txn.length    = len * 8;
+    txn.tx_buffer = tx;
+    txn.rx_buffer = rx;
+
+    esp_err_t err = spi_device_transmit((spi_device_handle_t)ctx, &txn);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "SPI transfer failed: %s", esp_err_to_name(err));
+        return PORTUNUS_ERR_SPI_TRANSFER;
+    }
+    return PORTUNUS_OK;
+}
+
+portunus_err_t mfrc522_spi_esp_open(mfrc522_spi_t *out)
+{
+    /* ── RST pin: configure on first call, toggle on every call ─────────── */
+    if (PIN_MFRC522_RST >= 0) {
+        if (!s_spi_initialized) {
+            gpio_config_t rst_cfg = {};
+            rst_cfg.pin_bit_mask = (1ULL << PIN_MFRC522_RST);
+            rst_cfg.mode         = GPIO_MODE_OUTPUT;
+            rst_cfg.pull_up_en   = GPIO_PULLUP_DISABLE;
+            rst_cfg.pull_down_en = GPIO_PULLDOWN_DISABLE;
+            rst_cfg.intr_type    = GPIO_INTR_DISABLE;
+            gpio_config(&rst_cfg);
+        }
+        gpio_set_level((gpio_num_t)PIN_MFRC522_RST, 0);
+        vTaskDelay(pdMS_TO_TICKS(10));
+        gpio_set_level((gpio_num_t)PIN_MFRC522_RST, 1);
+        vTaskDelay(pdMS_TO_TICKS(50));
+    }
+
+    /* ── SPI bus and device: initialise once, reuse on recovery calls ─────── */
+    if (!s_spi_initialized) {
+        spi_bus_config_t bus_cfg = {};
+        bus_cfg.mosi_io_num     = PIN_SPI_MOSI;
+        bus_cfg.miso_io_num     = PIN_SPI_MISO;
+        bus_cfg.sclk_io_num     = PIN_SPI_SCLK;
+        bus_cfg.quadwp_io_num   = -1;
+        bus_cfg.quadhd_io_num   = -1;
+        bus_cfg.max_transfer_sz = 64;
+
+        esp_err_t ret = spi_bus_initialize(MFRC522_SPI_HOST, &bus_cfg, SPI_DMA_CH_AUTO);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "SPI bus init failed: %s", esp_err_to_name(ret));
+            return PORTUNUS_ERR_SPI_INIT;
+        }
+
+        spi_device_interface_config_t dev_cfg = {};
+        dev_cfg.clock_speed_hz = MFRC522_SPI_CLOCK_HZ;
+        dev_cfg.mode           = 0;          /* CPOL=0, CPHA=0 */
+        dev_cfg.spics_io_num   = PIN_MFRC522_CS;
+        dev_cfg.queue_size     = 4;
+
+        ret = spi_bus_add_device(MFRC522_SPI_HOST, &dev_cfg, &s_spi_handle);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "SPI add device failed: %s", esp_err_to_name(ret));
+            spi_bus_free(MFRC522_SPI_HOST);
+            return PORTUNUS_ERR_SPI_INIT;
+        }
+
+        s_spi_initialized = true;
+    }
+
+    out->transfer = spi_transfer;
+    out->ctx      = s_spi_handle;
+    return PORTUNUS_OK;
+}
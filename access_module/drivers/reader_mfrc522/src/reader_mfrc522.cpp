@@ -17,7 +17,12 @@ static const char *TAG = "reader_mfrc522";
 portunus_err_t ReaderMfrc522::init()
 {
     ESP_LOGI(TAG, "Initialising MFRC522 credential reader");
-    return mfrc522_init();
+    mfrc522_spi_t spi;
+    portunus_err_t err = mfrc522_spi_esp_open(&spi);
+    if (err != PORTUNUS_OK) {
+        return err;
+    }
+    return mfrc522_init(&spi);
 }
 
 portunus_err_t ReaderMfrc522::read(credential_t *cred)
@@ -10,6 +10,18 @@
  *   5. Starts the FSM (which owns card polling, event processing,
  *      unlock timing, door state monitoring, and feedback).
  *
+ * Boot runs as two branches once the configuration is loaded:
+ *
+ *   network:  wifi_mgr_init → wifi_mgr_start ─ ─ ▶ IP ─ ─ ▶ TLS (server_comm)
+ *   I/O:      reactor → event bus → reader/strike/LED → FSM init
+ *
+ * The network branch runs on its own task (boot_net, network core) and
+ * returns as soon as the radio is started; association, DHCP and the TLS
+ * handshake then proceed on the WiFi, lwIP and server_comm tasks while
+ * app_main resets the reader and brings up the FSM.  The two branches
+ * join before server_comm and the FSM start.  Each phase is timestamped
+ * (boot_timeline.hpp) and reported in the first heartbeat.
+ *
  * All inter-component communication flows through the event bus.
  * The FSM is the top-level decision maker — main.cpp does not
  * subscribe to events or manage system state directly.
@@ -23,6 +35,10 @@
 #include "system_states.hpp"
 #include "timing_config.hpp"
 #include "event_bus.hpp"
+#include "reactor.hpp"
+#include "task_config.hpp"
+#include "task_plan.hpp"
+#include "boot_timeline.hpp"
 #ifdef CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT
 #include "system_fsm.hpp"
 #endif
@@ -65,7 +81,9 @@
 #include "nvs_flash.h"
 #include "esp_log.h"
 #include "esp_system.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
 
 #include <inttypes.h>
@@ -97,6 +115,110 @@ static portunus_err_t init_nvs(void)
     return PORTUNUS_OK;
 }
 
+/**
+ * @brief Compare where each task actually runs against task_config.hpp.
+ *
+ * Runs once every task is up.  The network group (radio, lwIP, TLS/gRPC)
+ * and the I/O group (reader poll, reactor/FSM, actuation) should sit on
+ * different cores so a TLS handshake cannot delay a tap.  ESP-IDF's own
+ * "wifi" and "tiT" (lwIP) tasks are pinned through sdkconfig.defaults;
+ * their priorities belong to IDF and are not checked.  The report is
+ * logged and carried in every heartbeat.
+ */
+static void check_task_plan(void)
+{
+    auto planned = [](BaseType_t core) -> int8_t {
+        return (core == tskNO_AFFINITY) ? TASK_PLAN_ANY_CORE : (int8_t)core;
+    };
+
+    const task_plan_entry_t plan[] = {
+        { "reactor",         TASK_GROUP_IO,  planned(TASK_CORE_IO),  REACTOR_TASK_PRIORITY },
+        { "credential_poll", TASK_GROUP_IO,  planned(TASK_CORE_IO),  READER_TASK_PRIORITY },
+        { "peu_fsm",         TASK_GROUP_IO,  planned(TASK_CORE_IO),  REACTOR_TASK_PRIORITY },
+        { "peu_poll",        TASK_GROUP_IO,  planned(TASK_CORE_IO),  READER_TASK_PRIORITY },
+        { "server_comm",     TASK_GROUP_NET, planned(TASK_CORE_NET), SERVER_COMM_TASK_PRIORITY },
+        { "wifi_reconn",     TASK_GROUP_NET, planned(TASK_CORE_NET), WIFI_RECONNECT_TASK_PRIORITY },
+        { "wifi",            TASK_GROUP_NET, planned(TASK_CORE_NET), TASK_PLAN_ANY_PRIO },
+        { "tiT",             TASK_GROUP_NET, planned(TASK_CORE_NET), TASK_PLAN_ANY_PRIO },
+    };
+    const size_t n = sizeof(plan) / sizeof(plan[0]);
+
+    task_observed_t seen[n] = {};
+    for (size_t i = 0; i < n; i++) {
+        TaskHandle_t h = xTaskGetHandle(plan[i].name);
+        if (h == NULL) {
+            continue;
+        }
+        BaseType_t core  = xTaskGetCoreID(h);
+        seen[i].present  = true;
+        seen[i].core     = (core == tskNO_AFFINITY) ? TASK_PLAN_ANY_CORE : (int8_t)core;
+        seen[i].priority = (uint8_t)uxTaskPriorityGet(h);
+    }
+
+    task_plan_report_t report;
+    task_plan_check(plan, seen, n, portNUM_PROCESSORS, &report);
+    task_plan_set_report(&report);
+
+    for (size_t i = 0; i < n; i++) {
+        if (report.fault_mask & (1u << i)) {
+            ESP_LOGW(TAG, "Task '%s' off-plan: core %d prio %u (planned core %d prio %u)",
+                     plan[i].name, seen[i].core, seen[i].priority,
+                     plan[i].core, plan[i].priority);
+        }
+    }
+    if (report.isolation) {
+        ESP_LOGI(TAG, "Task plan: %u cores, network on core %d, I/O on core %d",
+                 report.cores, (int)TASK_CORE_NET, (int)TASK_CORE_IO);
+    } else {
+        ESP_LOGW(TAG, "Task plan: %u cores, no latency isolation (%u faults)",
+                 report.cores, report.faults);
+    }
+}
+
+/** Mark a boot phase at the current esp_timer time. */
+static void boot_mark(boot_phase_t phase)
+{
+    boot_timeline_mark(phase, (uint32_t)(esp_timer_get_time() / 1000));
+}
+
+#ifdef CONFIG_PORTUNUS_ENABLE_WIFI
+/* ── Network boot branch ───────────────────────────────────────────────────── */
+
+#define BOOT_NET_TASK_STACK_SIZE  4096
+
+typedef struct {
+    const portunus_device_config_t *cfg;
+    SemaphoreHandle_t               done;
+    portunus_err_t                  err;
+    const char                     *failed;   /**< Step that failed, for the halt message */
+} boot_net_t;
+
+/**
+ * @brief Bring WiFi up off app_main's critical path.
+ *
+ * wifi_mgr_init() (netif, driver, calibration data) and wifi_mgr_start()
+ * take long enough to matter; the connection itself is not waited for.
+ * Signals @c done and deletes itself.
+ */
+static void boot_net_task(void *arg)
+{
+    boot_net_t *b = static_cast<boot_net_t *>(arg);
+
+    b->err = wifi_mgr_init(b->cfg);
+    if (b->err != PORTUNUS_OK) {
+        b->failed = "WiFi init";
+    } else {
+        b->err = wifi_mgr_start();
+        if (b->err != PORTUNUS_OK) {
+            b->failed = "WiFi start";
+        }
+    }
+
+    xSemaphoreGive(b->done);
+    vTaskDelete(NULL);
+}
+#endif
+
 /* ── Application entry point ──────────────────────────────────────────────── */
 
 extern "C" void app_main(void)
@@ -141,24 +263,31 @@ extern "C" void app_main(void)
         }
     }
 
-    /* ── 3. WiFi connection ──────────────────────────────────────────────── */
-    if (wifi_mgr_init(&s_device_cfg) != PORTUNUS_OK) {
-        ESP_LOGE(TAG, "System halted: WiFi init failure");
-        return;
-    }
-
-    portunus_err_t wifi_err = wifi_mgr_start();
-    if (wifi_err == PORTUNUS_ERR_TIMEOUT) {
-        ESP_LOGW(TAG, "WiFi not connected yet — continuing startup");
-    } else if (wifi_err != PORTUNUS_OK) {
-        ESP_LOGE(TAG, "System halted: WiFi start failure");
+    boot_mark(BOOT_PHASE_CONFIG);
+
+    /* ── 3. WiFi (network branch, runs alongside steps 4–6) ─────────────── */
+    static boot_net_t s_boot_net{};
+    s_boot_net.cfg  = &s_device_cfg;
+    s_boot_net.done = xSemaphoreCreateBinary();
+    if (s_boot_net.done == NULL ||
+        xTaskCreatePinnedToCore(boot_net_task, "boot_net", BOOT_NET_TASK_STACK_SIZE,
+                                &s_boot_net, uxTaskPriorityGet(NULL), NULL,
+                                TASK_CORE_NET) != pdPASS) {
+        ESP_LOGE(TAG, "System halted: network boot task create failure");
         return;
     }
 #else
     ESP_LOGW(TAG, "WiFi disabled — skipping NVS config load and running offline");
+    boot_mark(BOOT_PHASE_CONFIG);
 #endif
 
-    /* ── 4. Event bus ────────────────────────────────────────────────────── */
+    /* ── 4. Reactor + event bus ──────────────────────────────────────────── */
+    /* The reactor task hosts event dispatch, the FSM, LED patterns and the
+       heartbeat; it must exist before any of them attach. */
+    if (reactor_init() != PORTUNUS_OK) {
+        ESP_LOGE(TAG, "System halted: reactor init failure");
+        return;
+    }
     if (event_bus_init() != PORTUNUS_OK) {
         ESP_LOGE(TAG, "System halted: event bus init failure");
         return;
@@ -227,6 +356,18 @@ extern "C" void app_main(void)
         ESP_LOGE(TAG, "System halted: FSM init failure");
         return;
     }
+    boot_mark(BOOT_PHASE_IO_READY);
+
+#ifdef CONFIG_PORTUNUS_ENABLE_WIFI
+    /* Join the network branch: WiFi is started (not necessarily connected),
+       which server_comm_init() below expects. */
+    xSemaphoreTake(s_boot_net.done, portMAX_DELAY);
+    vSemaphoreDelete(s_boot_net.done);
+    if (s_boot_net.err != PORTUNUS_OK) {
+        ESP_LOGE(TAG, "System halted: %s failure", s_boot_net.failed);
+        return;
+    }
+#endif
 
     /* ── 7. Start independent services ───────────────────────────────────── */
 
@@ -249,8 +390,14 @@ extern "C" void app_main(void)
         ESP_LOGE(TAG, "System halted: FSM start failure");
         return;
     }
+    boot_mark(BOOT_PHASE_FSM);
+
+    check_task_plan();
 
-    ESP_LOGI(TAG, "System operational — FSM running");
+    ESP_LOGI(TAG, "System operational — FSM running at %" PRIu32 " ms "
+             "(config %" PRIu32 " ms, I/O ready %" PRIu32 " ms)",
+             boot_timeline_get(BOOT_PHASE_FSM), boot_timeline_get(BOOT_PHASE_CONFIG),
+             boot_timeline_get(BOOT_PHASE_IO_READY));
     ESP_LOGI(TAG, "Free heap: %" PRIu32 " bytes", esp_get_free_heap_size());
 
     /* app_main returns; FreeRTOS scheduler continues running tasks. */
@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+"""Load-test a Portunus server with a fleet of simulated access modules.
+
+Each module is one process of the fleet simulator (test/fleet_sim, an
+ESP-IDF linux-target build of the real event bus, heartbeat_service,
+grpc_client and server_comm).  For every fleet size in --counts the script
+starts that many modules at once, lets them tap for --duration seconds,
+and reports what the modules saw (tap-to-decision latency, errors,
+throughput) next to what the server saw (RPC handling time from its gRPC
+log lines).
+
+The fleet file is a CSV with one module per row:
+
+    module_id,hmac_secret
+    sim-0001,<secret>
+    sim-0002,<secret>
+
+Rows are used in order, so a run of 50 modules uses the first 50.  The
+server verifies every module against its single PORTUNUS_HMAC_SECRET, so
+today all rows carry that secret; per-module secrets are accepted here so
+the file does not change when the server learns them.  --generate N writes
+a fleet file of N modules.
+
+Start the server with the fleet's module IDs in PORTUNUS_KNOWN_MODULES (the
+script prints the list) and PORTUNUS_GRPC_ADDR set, with stdout going to the
+file passed as --server-log if server-side latency is wanted.
+
+Usage (from access_module/; task fleet:sim -- <args> builds the simulator
+first):
+    python scripts/fleet_sim.py --generate 200 --secret "$PORTUNUS_HMAC_SECRET" \\
+        --fleet fleet.csv
+    python scripts/fleet_sim.py --fleet fleet.csv --counts 1,10,50,200 \\
+        --duration 60 --taps-per-min 6 --server-log server.log
+
+Exit codes:
+    0 — every step ran
+    1 — bad arguments, or the simulator binary is missing
+"""
+
+import argparse
+import csv
+import json
+import math
+import os
+import re
+import subprocess
+import sys
+import time
+from pathlib import Path
+
+DEFAULT_ELF = Path("test") / "fleet_sim" / "build" / "portunus_fleet_sim.elf"
+
+# LoggingInterceptor: "grpc /portunus.v1.PortunusService/RequestAccess
+# from=127.0.0.1:41234 status=OK dur=1.234ms"
+SERVER_LOG_LINE = re.compile(r"grpc /portunus\.v1\.PortunusService/(\w+) from=\S+ "
+                             r"status=(\w+) dur=(\S+)")
+
+GO_DURATION_UNITS = {"ns": 1e-6, "µs": 1e-3, "us": 1e-3, "ms": 1.0, "s": 1e3, "m": 60e3, "h": 3600e3}
+GO_DURATION_PART = re.compile(r"([0-9.]+)(ns|µs|us|ms|s|m|h)")
+
+
+# ── Fleet file ──────────────────────────────────────────────────────────────
+
+def load_fleet(path: Path) -> list[dict]:
+    with path.open(newline="") as f:
+        rows = [r for r in csv.DictReader(f) if r.get("module_id")]
+    for r in rows:
+        if not r.get("hmac_secret"):
+            sys.exit(f"error: {path}: module {r['module_id']!r} has no hmac_secret")
+    return rows
+
+
+def generate_fleet(path: Path, count: int, secret: str) -> None:
+    with path.open("w", newline="") as f:
+        w = csv.writer(f)
+        w.writerow(["module_id", "hmac_secret"])
+        for i in range(1, count + 1):
+            w.writerow([f"sim-{i:04d}", secret])
+    print(f"wrote {count} modules to {path}")
+
+
+# ── Statistics ──────────────────────────────────────────────────────────────
+
+def percentile(sorted_values: list[float], p: float) -> float:
+    if not sorted_values:
+        return float("nan")
+    k = math.ceil(p / 100.0 * len(sorted_values)) - 1
+    return sorted_values[min(len(sorted_values) - 1, max(0, k))]
+
+
+def go_duration_ms(text: str) -> float | None:
+    parts = GO_DURATION_PART.findall(text)
+    if not parts:
+        return None
+    return sum(float(v) * GO_DURATION_UNITS[u] for v, u in parts)
+
+
+def read_server_log(path: Path | None, offset: int) -> tuple[dict, int]:
+    """Per-method handling times (ms) and non-OK counts logged after offset."""
+    methods: dict[str, dict] = {}
+    if path is None or not path.exists():
+        return methods, offset
+    with path.open("rb") as f:
+        f.seek(offset)
+        data = f.read()
+        offset = f.tell()
+    for line in data.decode("utf-8", "replace").splitlines():
+        m = SERVER_LOG_LINE.search(line)
+        if not m:
+            continue
+        method, status, dur = m.groups()
+        entry = methods.setdefault(method, {"dur_ms": [], "errors": 0})
+        ms = go_duration_ms(dur)
+        if ms is not None:
+            entry["dur_ms"].append(ms)
+        if status != "OK":
+            entry["errors"] += 1
+    return methods, offset
+
+
+# ── One step ────────────────────────────────────────────────────────────────
+
+def run_step(args, fleet: list[dict], count: int) -> dict:
+    procs = []
+    for row in fleet[:count]:
+        env = dict(os.environ,
+                   PORTUNUS_SIM_MODULE_ID=row["module_id"],
+                   PORTUNUS_SIM_HMAC_SECRET=row["hmac_secret"],
+                   PORTUNUS_SIM_SERVER_HOST=args.server_host,
+                   PORTUNUS_SIM_GRPC_PORT=str(args.grpc_port),
+                   PORTUNUS_SIM_TAPS_PER_MIN=str(args.taps_per_min),
+                   PORTUNUS_SIM_DURATION_S=str(args.duration),
+                   PORTUNUS_SIM_UIDS=args.uids)
+        procs.append(subprocess.Popen([str(args.elf.resolve())], env=env, stdout=subprocess.PIPE,
+                                      stderr=subprocess.DEVNULL, text=True))
+
+    results, crashed = [], 0
+    deadline = time.monotonic() + args.duration + 60
+    for p in procs:
+        try:
+            out, _ = p.communicate(timeout=max(1.0, deadline - time.monotonic()))
+        except subprocess.TimeoutExpired:
+            p.kill()
+            out, _ = p.communicate()
+        line = next((l for l in out.splitlines() if l.startswith("FLEET_RESULT ")), None)
+        if line is None:
+            crashed += 1
+            continue
+        results.append(json.loads(line[len("FLEET_RESULT "):]))
+
+    total = {k: sum(r[k] for r in results) for k in
+             ("taps", "granted", "denied", "errors", "timeouts", "local")}
+    total["modules"] = count
+    total["crashed"] = crashed
+    total["latency_ms"] = sorted(v for r in results for v in r["latency_ms"])
+    elapsed = max((r["elapsed_s"] for r in results), default=float(args.duration))
+    total["decisions_per_s"] = (total["granted"] + total["denied"]) / elapsed if elapsed else 0.0
+    return total
+
+
+def report(step: dict, server: dict) -> None:
+    lat = step["latency_ms"]
+    print(f"\n── {step['modules']} modules ──")
+    print(f"  taps {step['taps']}: granted {step['granted']}, denied {step['denied']}, "
+          f"errors {step['errors']}, no decision {step['timeouts']}, "
+          f"decided locally {step['local']}, modules lost {step['crashed']}")
+    print(f"  throughput {step['decisions_per_s']:.1f} server decisions/s")
+    print(f"  client tap->decision ms  p50 {percentile(lat, 50):.0f}  p90 {percentile(lat, 90):.0f}  "
+          f"p99 {percentile(lat, 99):.0f}  max {lat[-1] if lat else float('nan'):.0f}")
+    for method in sorted(server):
+        d = sorted(server[method]["dur_ms"])
+        print(f"  server {method:<26} n {len(d):<6} ms p50 {percentile(d, 50):.2f}  "
+              f"p90 {percentile(d, 90):.2f}  p99 {percentile(d, 99):.2f}  "
+              f"non-OK {server[method]['errors']}")
+
+
+# ── Entry point ─────────────────────────────────────────────────────────────
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Load-test a Portunus server with simulated access modules.")
+    parser.add_argument("--fleet", type=Path, required=True, help="fleet CSV (module_id,hmac_secret)")
+    parser.add_argument("--generate", type=int, metavar="N",
+                        help="write a fleet file of N modules and exit")
+    parser.add_argument("--secret", default=os.environ.get("PORTUNUS_HMAC_SECRET", ""),
+                        help="HMAC secret for --generate (default $PORTUNUS_HMAC_SECRET)")
+    parser.add_argument("--elf", type=Path, default=DEFAULT_ELF, help="fleet simulator binary")
+    parser.add_argument("--counts", default="1,10,50,100",
+                        help="comma-separated fleet sizes to step through")
+    parser.add_argument("--duration", type=int, default=60, help="seconds of tapping per step")
+    parser.add_argument("--taps-per-min", type=float, default=6.0, help="mean taps per module per minute")
+    parser.add_argument("--uids", default="04A32B1C,04A32B1D,045F221A9B8033",
+                        help="comma-separated hex UIDs the modules tap")
+    parser.add_argument("--server-host", default="127.0.0.1")
+    parser.add_argument("--grpc-port", type=int, default=50051)
+    parser.add_argument("--server-log", type=Path, help="server stdout, for server-side timings")
+    args = parser.parse_args()
+
+    if args.generate:
+        if not args.secret:
+            sys.exit("error: --generate needs --secret or $PORTUNUS_HMAC_SECRET")
+        generate_fleet(args.fleet, args.generate, args.secret)
+        return
+
+    if not args.elf.exists():
+        print(f"error: {args.elf} not found; build it with task fleet:sim",
+              file=sys.stderr)
+        sys.exit(1)
+    fleet = load_fleet(args.fleet)
+    counts = [int(c) for c in args.counts.split(",") if c.strip()]
+    if not counts or max(counts) > len(fleet):
+        sys.exit(f"error: --counts needs at most {len(fleet)} modules (the fleet file's size)")
+
+    print("PORTUNUS_KNOWN_MODULES=" + ",".join(r["module_id"] for r in fleet[:max(counts)]))
+    log_offset = args.server_log.stat().st_size if args.server_log and args.server_log.exists() else 0
+    for count in counts:
+        step = run_step(args, fleet, count)
+        server, log_offset = read_server_log(args.server_log, log_offset)
+        report(step, server)
+
+
+if __name__ == "__main__":
+    main()
@@ -4,10 +4,12 @@
  *
  * Architecture: single dispatcher queue (MVP topology — see project plan §3.5).
  *
- * Publishers call event_bus_publish() to enqueue an event. A dedicated
- * dispatcher task dequeues events and invokes all registered subscriber
- * callbacks whose event ID filter matches. Callbacks execute on the
- * dispatcher task's stack, so they must be short and non-blocking.
+ * Publishers call event_bus_publish() to enqueue an event and signal the
+ * dispatcher, a readiness source on the reactor task (see reactor.hpp).
+ * It dequeues events and invokes all registered subscriber callbacks whose
+ * event ID filter matches. Callbacks execute on the reactor task's stack,
+ * alongside timers and other handlers, so they must be short and
+ * non-blocking.
  *
  * Thread safety:
  *   - event_bus_publish() is safe to call from any task or ISR (uses
@@ -38,7 +40,8 @@ typedef void (*event_bus_handler_t)(const portunus_event_t *event, void *ctx);
 /**
  * @brief Initialise the event bus.
  *
- * Creates the dispatcher queue and starts the dispatcher FreeRTOS task.
+ * Creates the dispatcher queue and registers the dispatcher with the
+ * reactor, starting the reactor task if main.cpp has not already done so.
  * Must be called exactly once before any publish or subscribe calls.
  *
  * @return PORTUNUS_OK on success, or an error code.
@@ -50,7 +53,8 @@ portunus_err_t event_bus_init(void);
  *
  * The event is copied into the dispatcher queue by value. If the queue
  * is full the call blocks for up to EVENT_QUEUE_TIMEOUT_MS before
- * returning PORTUNUS_ERR_QUEUE_FULL.
+ * returning PORTUNUS_ERR_QUEUE_FULL (without blocking when called from a
+ * reactor handler, since only the reactor can drain the queue).
  *
  * Safe to call from any task. For ISR context use event_bus_publish_from_isr().
  *
@@ -73,7 +77,7 @@ portunus_err_t event_bus_publish_from_isr(const portunus_event_t *event,
  * @brief Register a subscriber callback for a specific event type.
  *
  * @param event_id  The event type to listen for.
- * @param handler   Callback function invoked on the dispatcher task.
+ * @param handler   Callback function invoked on the reactor task.
  * @param ctx       Opaque context pointer passed to the handler (may be NULL).
  * @return PORTUNUS_OK on success, PORTUNUS_ERR_MAX_SUBSCRIBERS if the table is full.
  */
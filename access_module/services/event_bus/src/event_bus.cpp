@@ -2,16 +2,17 @@
  * @file event_bus.cpp
  * @brief Single-dispatcher-queue event bus implementation.
  *
- * MVP topology: one FreeRTOS queue, one dispatcher task, static subscriber
- * table. See project plan §3.5 for the rationale and scaling notes.
+ * MVP topology: one FreeRTOS queue, static subscriber table. See project
+ * plan §3.5 for the rationale and scaling notes.  Dispatch runs as a
+ * readiness source on the reactor task rather than on a dedicated task.
  */
 
 #include "event_bus.hpp"
 #include "error_codes.hpp"
 #include "timing_config.hpp"
+#include "reactor.hpp"
 
 #include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 #include "freertos/queue.h"
 #include "freertos/semphr.h"
 #include "esp_log.h"
@@ -33,43 +34,46 @@ typedef struct {
 static subscriber_entry_t s_subscribers[MAX_EVENT_SUBSCRIBERS];
 static size_t             s_subscriber_count = 0;
 
-/* ── Queue and task handles ────────────────────────────────────────────────── */
+/* ── Queue and reactor source ──────────────────────────────────────────────── */
 
-static QueueHandle_t s_event_queue  = NULL;
-static TaskHandle_t  s_dispatch_task = NULL;
+static QueueHandle_t    s_event_queue = NULL;
+static reactor_source_t s_dispatch_source;
 
-#define DISPATCH_TASK_STACK_SIZE  4096
-#define DISPATCH_TASK_PRIORITY    5
+/* ── Dispatcher ────────────────────────────────────────────────────────────── */
 
-/* ── Dispatcher task ───────────────────────────────────────────────────────── */
-
-static void event_bus_dispatch_task(void *arg)
+/** Reactor handler: drain the queue.  Bounded per activation so a publish
+ *  storm cannot starve the reactor's timers; leftovers re-signal. */
+static void event_bus_dispatch(void *arg)
 {
     (void)arg;
     portunus_event_t event;
 
-    ESP_LOGI(TAG, "Dispatcher task started");
-
-    for (;;) {
-        if (xQueueReceive(s_event_queue, &event, portMAX_DELAY) == pdTRUE) {
-            /* Snapshot the subscriber table under the lock, then dispatch
-               without it.  This prevents deadlock if a callback calls
-               event_bus_subscribe() (e.g. a component that registers
-               new subscriptions in response to EVENT_SYSTEM_BOOT_COMPLETE). */
-            xSemaphoreTake(s_subscriber_mutex, portMAX_DELAY);
-            size_t count = s_subscriber_count;
-            subscriber_entry_t snapshot[MAX_EVENT_SUBSCRIBERS];
-            memcpy(snapshot, s_subscribers, count * sizeof(subscriber_entry_t));
-            xSemaphoreGive(s_subscriber_mutex);
-
-            for (size_t i = 0; i < count; i++) {
-                if (snapshot[i].active &&
-                    snapshot[i].event_id == event.id) {
-                    snapshot[i].handler(&event, snapshot[i].ctx);
-                }
+    for (int n = 0; n < EVENT_QUEUE_LENGTH; n++) {
+        if (xQueueReceive(s_event_queue, &event, 0) != pdTRUE) {
+            return;
+        }
+
+        /* Snapshot the subscriber table under the lock, then dispatch
+           without it.  This prevents deadlock if a callback calls
+           event_bus_subscribe() (e.g. a component that registers
+           new subscriptions in response to EVENT_SYSTEM_BOOT_COMPLETE). */
+        xSemaphoreTake(s_subscriber_mutex, portMAX_DELAY);
+        size_t count = s_subscriber_count;
+        subscriber_entry_t snapshot[MAX_EVENT_SUBSCRIBERS];
+        memcpy(snapshot, s_subscribers, count * sizeof(subscriber_entry_t));
+        xSemaphoreGive(s_subscriber_mutex);
+
+        for (size_t i = 0; i < count; i++) {
+            if (snapshot[i].active &&
+                snapshot[i].event_id == event.id) {
+                snapshot[i].handler(&event, snapshot[i].ctx);
             }
         }
     }
+
+    if (uxQueueMessagesWaiting(s_event_queue) > 0) {
+        reactor_signal(&s_dispatch_source);
+    }
 }
 
 /* ── Public API ────────────────────────────────────────────────────────────── */
@@ -99,21 +103,16 @@ portunus_err_t event_bus_init(void)
         return PORTUNUS_ERR_QUEUE_CREATE;
     }
 
-    /* Start the dispatcher task. */
-    BaseType_t ret = xTaskCreate(
-        event_bus_dispatch_task,
-        "evt_dispatch",
-        DISPATCH_TASK_STACK_SIZE,
-        NULL,
-        DISPATCH_TASK_PRIORITY,
-        &s_dispatch_task
-    );
-
-    if (ret != pdPASS) {
-        ESP_LOGE(TAG, "Failed to create dispatcher task");
+    /* Dispatch on the reactor.  main.cpp normally starts it first. */
+    portunus_err_t err = reactor_init();
+    if (err == PORTUNUS_OK || err == PORTUNUS_ERR_ALREADY_INIT) {
+        err = reactor_source_register(&s_dispatch_source, event_bus_dispatch, NULL);
+    }
+    if (err != PORTUNUS_OK) {
+        ESP_LOGE(TAG, "Failed to attach dispatcher to reactor: err=%d", (int)err);
         vQueueDelete(s_event_queue);
         s_event_queue = NULL;
-        return PORTUNUS_ERR_TASK_CREATE;
+        return err;
     }
 
     ESP_LOGI(TAG, "Event bus initialised (queue depth=%d, max subscribers=%d)",
@@ -130,12 +129,14 @@ portunus_err_t event_bus_publish(const portunus_event_t *event)
         return PORTUNUS_ERR_NOT_INIT;
     }
 
-    TickType_t timeout = pdMS_TO_TICKS(EVENT_QUEUE_TIMEOUT_MS);
+    /* On the reactor itself nothing can drain the queue while we wait. */
+    TickType_t timeout = reactor_in_context() ? 0 : pdMS_TO_TICKS(EVENT_QUEUE_TIMEOUT_MS);
     if (xQueueSendToBack(s_event_queue, event, timeout) != pdTRUE) {
         ESP_LOGW(TAG, "Event queue full, dropping event id=0x%04x", event->id);
         return PORTUNUS_ERR_QUEUE_FULL;
     }
 
+    reactor_signal(&s_dispatch_source);
     return PORTUNUS_OK;
 }
 
@@ -153,6 +154,7 @@ portunus_err_t event_bus_publish_from_isr(const portunus_event_t *event,
         return PORTUNUS_ERR_QUEUE_FULL;
     }
 
+    reactor_signal_from_isr(&s_dispatch_source, higher_priority_woken);
     return PORTUNUS_OK;
 }
 
@@ -0,0 +1,111 @@
+/**
+ * @file dns_cache.hpp
+ * @brief Server addresses kept between connects, refreshed in the background.
+ *
+ * Resolving server_host on every connect puts a DNS round trip, or a slow
+ * or dead LAN DNS server's full timeout, in front of the TLS handshake on
+ * the tap path.  grpc_client keeps the addresses DNS returned here and
+ * connects to them directly; a lookup never waits for DNS.
+ *
+ *   - An address is fresh for ttl_ms after DNS last returned it.  A refresh
+ *     is due three quarters of the way through, so with any traffic at all
+ *     the cache is renewed before it runs dry.
+ *   - lwIP answers a query with one IPv4 address, and a round-robin name
+ *     rotates its records between queries, so the cache collects up to
+ *     DNS_CACHE_MAX_ADDRS of them across refreshes.
+ *   - Candidates come out in connect order: the address that last worked,
+ *     then the others, those that failed to connect last.  grpc_client
+ *     races them, starting the next a short delay after the previous.
+ *   - When DNS fails and nothing is fresh, expired addresses are offered
+ *     if stale_fallback is set; the last known-good one comes first.
+ *   - A failed resolve is retried no sooner than retry_ms later.
+ *
+ * Addresses are opaque 32-bit values (IPv4, network byte order).
+ *
+ * Not thread-safe; grpc_client serialises calls with a spinlock.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Addresses remembered per name. */
+#define DNS_CACHE_MAX_ADDRS  4
+
+typedef struct {
+    uint32_t ttl_ms;            /**< An address is fresh this long after DNS returned it */
+    uint32_t retry_ms;          /**< Least time between a failed resolve and the next */
+    uint32_t resolve_timeout_ms;/**< A resolve with no answer by then has failed */
+    bool     stale_fallback;    /**< Offer expired addresses when DNS fails */
+} dns_cache_config_t;
+
+typedef struct {
+    uint32_t resolves;          /**< Answers received */
+    uint32_t failures;          /**< Resolves that failed or timed out */
+    uint32_t stale_uses;        /**< Lookups answered with expired addresses */
+    uint32_t misses;            /**< Lookups with nothing to offer */
+    uint32_t last_resolve_ms;   /**< Time the last answer took */
+} dns_cache_stats_t;
+
+typedef struct {
+    uint32_t addr;
+    int64_t  seen_ms;           /**< Last returned by DNS */
+    uint8_t  fails;             /**< Connects failed since it last worked */
+} dns_cache_entry_t;
+
+typedef struct {
+    dns_cache_config_t cfg;
+    dns_cache_stats_t  stats;
+
+    dns_cache_entry_t  entries[DNS_CACHE_MAX_ADDRS];
+    uint8_t            count;
+    uint32_t           good;            /**< Last address a connect succeeded on */
+    bool               have_good;
+
+    bool               in_flight;
+    int64_t            started_ms;
+    bool               failed;          /**< The last resolve failed... */
+    int64_t            failed_ms;       /**< ...at this time */
+} dns_cache_t;
+
+/** Defaults: 5 min TTL, 5 s retry, 15 s resolve timeout, stale fallback on. */
+void dns_cache_default_config(dns_cache_config_t *cfg);
+
+void dns_cache_init(dns_cache_t *c, const dns_cache_config_t *cfg);
+
+/**
+ * True if a resolve should start now: nothing fresh, or past the refresh
+ * point, with none in flight and the retry delay over.  Also fails a
+ * resolve that has outlived resolve_timeout_ms.
+ */
+bool dns_cache_refresh_due(dns_cache_t *c, int64_t now_ms);
+
+/** The caller started a resolve. */
+void dns_cache_resolve_started(dns_cache_t *c, int64_t now_ms);
+
+/** DNS answered with @p addr. */
+void dns_cache_resolved(dns_cache_t *c, int64_t now_ms, uint32_t addr);
+
+/** DNS did not answer, or answered that the name does not exist. */
+void dns_cache_resolve_failed(dns_cache_t *c, int64_t now_ms);
+
+/**
+ * Addresses to try, in order, into @p out (at most @p max).  Fresh ones if
+ * there are any, else expired ones if stale_fallback is set.  Returns the
+ * count; 0 means wait for DNS.
+ */
+size_t dns_cache_lookup(dns_cache_t *c, int64_t now_ms, uint32_t *out, size_t max);
+
+/** A connect to @p addr succeeded / failed. */
+void dns_cache_connected(dns_cache_t *c, uint32_t addr);
+void dns_cache_connect_failed(dns_cache_t *c, uint32_t addr);
+
+#ifdef __cplusplus
+}
+#endif
@@ -12,7 +12,9 @@
  *   Each unary call opens an HTTP/2 stream, sends the gRPC-framed request,
  *   receives the gRPC-framed response + trailers, and closes the stream.
  *   The connection is reused across calls and automatically re-established
- *   on failure.
+ *   on failure.  The server name is resolved in the background and the
+ *   answers cached (dns_cache.hpp), so a connect waits for DNS only when
+ *   nothing has been resolved yet.
  *
  * gRPC wire format (sent in HTTP/2 DATA frames):
  *   [1 byte: compression flag (0x00)] [4 bytes: message length (big-endian)]
@@ -25,6 +27,8 @@
 #pragma once
 
 #include "portunus_types.hpp"
+#include "session_arena.hpp"
+#include "tls_profile.hpp"
 #include <stddef.h>
 #include <stdint.h>
 #include <stdbool.h>
@@ -39,13 +43,28 @@ typedef struct {
     const char *host;           /**< Server hostname or IP address. */
     uint16_t    port;           /**< Server port (e.g. 50051 or 8443). */
 
+    /* Name resolution (see dns_cache.hpp); ignored when host is an IP address */
+    uint32_t    dns_ttl_ms;         /**< Resolved addresses are reused this long (0 = 5 min). */
+    bool        dns_stale_fallback; /**< Connect to expired addresses while DNS is down. */
+
     /* TLS settings */
-    const char *ca_cert_pem;    /**< PEM CA certificate for pinning (NULL = use bundle). */
+    const uint8_t *ca_cert_der;     /**< DER CA certificate for pinning (NULL = use bundle). */
+    size_t         ca_cert_der_len;
+    const uint8_t *spki_pin_sha256; /**< Server key pin, 32 bytes; overrides the CA (NULL = none). */
     bool        skip_cert_verify; /**< INSECURE: skip TLS cert verification (dev only). */
+    tls_profile_t tls_profile;  /**< What the handshake may negotiate (zero = compat). */
 
     /* Timeouts */
     int         connect_timeout_ms; /**< TCP + TLS handshake timeout. */
-    int         rpc_timeout_ms;     /**< Per-RPC timeout (send + receive). */
+    int         rpc_timeout_ms;     /**< Per-RPC timeout ceiling (send + receive). */
+    int         min_rpc_timeout_ms; /**< Floor for the RTT-derived timeout (0 = always rpc_timeout_ms). */
+
+    /* Reconnect pacing (see grpc_client_connect_due()) */
+    uint32_t    reconnect_base_ms;  /**< Backoff after the first failed connect; spread after a lost link. */
+    uint32_t    reconnect_max_ms;   /**< Backoff ceiling. */
+
+    /* Memory */
+    size_t      session_arena_bytes; /**< Dedicated nghttp2 session region (0 = system heap). */
 } grpc_client_config_t;
 
 /* ── Handle ────────────────────────────────────────────────────────────────── */
@@ -66,6 +85,10 @@ typedef struct grpc_client *grpc_client_handle_t;
 #define GRPC_STATUS_UNAVAILABLE        14
 #define GRPC_STATUS_INTERNAL           13
 
+/** Largest request message a unary call takes (the largest HeartbeatRequest,
+ *  with a full health dump, and margin). */
+#define GRPC_CLIENT_MAX_REQUEST_BYTES   1664
+
 /* ── Lifecycle ─────────────────────────────────────────────────────────────── */
 
 /**
@@ -115,6 +138,21 @@ void grpc_client_disconnect(grpc_client_handle_t handle);
  */
 bool grpc_client_is_connected(grpc_client_handle_t handle);
 
+/**
+ * @brief Whether a connect attempt is due.
+ *
+ * After a failed connect the next one is due after a jittered exponential
+ * backoff (reconnect_base_ms doubling up to reconnect_max_ms); after a link
+ * is lost (server closed it, or a PING went unanswered) it is due at a
+ * random point within reconnect_base_ms.  A server that restarts thus sees
+ * its modules come back spread out rather than all at once.  The pacing
+ * is advisory: grpc_client_connect() and grpc_client_unary_call() always
+ * try, so a caller with a person waiting can ignore it.
+ *
+ * @return true if connected, or if background work may connect now.
+ */
+bool grpc_client_connect_due(grpc_client_handle_t handle);
+
 /* ── RPC ───────────────────────────────────────────────────────────────────── */
 
 /**
@@ -131,7 +169,8 @@ bool grpc_client_is_connected(grpc_client_handle_t handle);
  * @param service_method Full gRPC method path, e.g.
  *                       "/portunus.v1.PortunusService/SendHeartbeat".
  * @param req_buf        Protobuf-encoded request body (no gRPC prefix).
- * @param req_len        Length of req_buf in bytes.
+ * @param req_len        Length of req_buf in bytes, at most
+ *                       GRPC_CLIENT_MAX_REQUEST_BYTES.
  * @param resp_buf       Buffer to receive the protobuf response (prefix stripped).
  * @param resp_cap       Capacity of resp_buf in bytes.
  * @param resp_len       [out] Actual protobuf bytes written to resp_buf.
@@ -143,7 +182,8 @@ bool grpc_client_is_connected(grpc_client_handle_t handle);
  *
  * @return PORTUNUS_OK        Round-trip succeeded (check grpc_status for app errors).
  *         PORTUNUS_ERR_HTTP_CONNECT  Could not establish connection.
- *         PORTUNUS_ERR_TIMEOUT       RPC timed out.
+ *         PORTUNUS_ERR_TIMEOUT       RPC timed out (rpc_timeout_ms, or the budget
+ *                                    from grpc_client_set_call_timeout()).
  *         PORTUNUS_ERR_PROTO_ENCODE  gRPC frame encoding error.
  *         PORTUNUS_ERR_PROTO_DECODE  gRPC frame decoding error (bad response).
  */
@@ -154,14 +194,32 @@ portunus_err_t grpc_client_unary_call(grpc_client_handle_t handle,
                                        int *resp_len, int *grpc_status,
                                        char *out_sig_hex);
 
+/**
+ * @brief Set the budget of the next grpc_client_unary_call() to @p timeout_ms.
+ *
+ * Applies to exactly one call and is then cleared.  The call gives up
+ * locally after min(@p timeout_ms, rpc_timeout_ms), counting any reconnect
+ * it has to do first, and sends the remainder as the grpc-timeout header
+ * so the server can drop work the caller will no longer use.  Without it
+ * the call uses the RTT-derived timeout (see grpc_link_stats_t) and
+ * advertises that instead.
+ *
+ * @param timeout_ms  Remaining budget in ms; <= 0 clears a pending value.
+ */
+void grpc_client_set_call_timeout(grpc_client_handle_t handle, int timeout_ms);
+
 /**
  * @brief Send an HTTP/2 PING and wait for the ACK (B18).
  *
  * Call periodically during idle periods to prevent NAT/firewall entries
- * from expiring between heartbeats.  No-op and returns
- * PORTUNUS_ERR_INVALID_ARG if the client is not connected.
+ * from expiring between heartbeats and to find a dead connection before a
+ * tap does.  The ACK round trip is an RTT sample.  If the ACK does not
+ * arrive within the PING RTO the connection is closed, so the caller can
+ * reconnect right away.  No-op and returns PORTUNUS_ERR_INVALID_ARG if the
+ * client is not connected.
  *
- * @return PORTUNUS_OK on success (ACK received within rpc_timeout_ms).
+ * @return PORTUNUS_OK on success (ACK received).
+ *         PORTUNUS_ERR_TIMEOUT      no ACK in time (connection closed).
  *         PORTUNUS_ERR_HTTP_CONNECT if the ping fails (connection gone).
  */
 portunus_err_t grpc_client_send_ping(grpc_client_handle_t handle);
@@ -180,6 +238,49 @@ portunus_err_t grpc_client_set_metadata(grpc_client_handle_t handle,
                                          const char *key,
                                          const char *value);
 
+/* ── Diagnostics ───────────────────────────────────────────────────────────── */
+
+/**
+ * @brief Snapshot the HTTP/2 session arena usage.
+ *
+ * peak is the largest region any session has needed since init and is the
+ * number to size CONFIG_PORTUNUS_GRPC_SESSION_ARENA_SIZE from;
+ * heap_fallbacks > 0 means the configured region is too small.
+ *
+ * @return PORTUNUS_OK, or PORTUNUS_ERR_INVALID_ARG on NULL arguments.
+ */
+portunus_err_t grpc_client_get_arena_stats(grpc_client_handle_t handle,
+                                            session_arena_stats_t *out);
+
+/** Link timing snapshot (see link_timing.hpp). */
+typedef struct {
+    uint32_t ping_p50_ms;       /**< PING round trip, median of recent samples */
+    uint32_t ping_p90_ms;
+    uint32_t ping_p99_ms;
+    uint32_t call_srtt_ms;      /**< Smoothed unary call time */
+    uint32_t call_timeout_ms;   /**< Current timeout for calls without a budget */
+    uint32_t dead_links;        /**< Connections closed by an unanswered PING */
+    uint32_t connects;          /**< Connections established since init */
+    uint32_t failed_connects;   /**< Connect attempts that failed since init */
+    uint32_t dns_resolves;      /**< DNS answers received for host */
+    uint32_t dns_failures;      /**< Resolves that failed or timed out */
+    uint32_t dns_stale_uses;    /**< Connects made to expired addresses */
+    uint32_t dns_resolve_ms;    /**< Time the last DNS answer took */
+    uint32_t tls_pin_mismatches; /**< Handshakes refused by the SPKI pin */
+    uint32_t tls_handshake_ms;  /**< Time the last TLS handshake took */
+    uint32_t tls_failures;      /**< Handshakes that failed (pin mismatches included) */
+} grpc_link_stats_t;
+
+/**
+ * @brief Snapshot RTT percentiles and the current call timeout.
+ *
+ * Percentiles are 0 until the first PING has been answered.
+ *
+ * @return PORTUNUS_OK, or PORTUNUS_ERR_INVALID_ARG on NULL arguments.
+ */
+portunus_err_t grpc_client_get_link_stats(grpc_client_handle_t handle,
+                                           grpc_link_stats_t *out);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,49 @@
+/**
+ * @file grpc_frame.hpp
+ * @brief gRPC length-prefixed message framing.
+ *
+ * Layout: [0x00 (no compression)] [4-byte big-endian length] [protobuf bytes].
+ * Compressed messages are not supported.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Compression flag plus the 4-byte length. */
+#define GRPC_FRAME_HEADER_LEN  5
+
+/**
+ * @brief Build a gRPC message frame.
+ *
+ * @param proto_buf   Protobuf-encoded message.
+ * @param proto_len   Length of the protobuf message.
+ * @param out_buf     Output buffer (must be at least proto_len + 5).
+ * @param out_cap     Capacity of out_buf.
+ * @param out_len     [out] Total bytes written (5 + proto_len).
+ * @return true on success, false if out_buf is too small.
+ */
+bool grpc_frame_encode(const uint8_t *proto_buf, size_t proto_len,
+                       uint8_t *out_buf, size_t out_cap, size_t *out_len);
+
+/**
+ * @brief Strip the 5-byte gRPC frame header from a received message.
+ *
+ * @param frame_buf   Buffer containing the full gRPC frame.
+ * @param frame_len   Length of the frame.
+ * @param proto_buf   [out] Points into frame_buf past the header.
+ * @param proto_len   [out] Length of the protobuf payload.
+ * @return true on success, false if the frame is compressed or truncated.
+ */
+bool grpc_frame_decode(const uint8_t *frame_buf, size_t frame_len,
+                       const uint8_t **proto_buf, size_t *proto_len);
+
+#ifdef __cplusplus
+}
+#endif
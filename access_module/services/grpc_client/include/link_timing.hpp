@@ -0,0 +1,88 @@
+/**
+ * @file link_timing.hpp
+ * @brief RTT estimation and keepalive pacing for the persistent gRPC link.
+ *
+ * rtt_estimator_t keeps a TCP-style smoothed RTT and variance (RFC 6298:
+ * SRTT and RTTVAR with gains 1/8 and 1/4, RTO = SRTT + 4·RTTVAR, doubled
+ * per timeout until the next sample) plus the last RTT_WINDOW samples for
+ * percentiles.  grpc_client runs one over PING round trips and one over
+ * unary call times, and uses the latter as the per-call timeout.
+ *
+ * keepalive_t paces idle PINGs.  Every KEEPALIVE_GROW_STREAK answered
+ * PINGs stretch the interval by half, up to the configured maximum and
+ * below any idle spell that has already killed the connection; a PING that
+ * goes unanswered halves the idle time that killed it.  The interval thus
+ * settles just under whatever NAT or server idle limit sits on the path.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Samples kept for percentiles. */
+#define RTT_WINDOW             32
+
+/** Answered PINGs in a row before the keepalive interval grows. */
+#define KEEPALIVE_GROW_STREAK  4
+
+typedef struct {
+    uint32_t srtt_x8;               /**< Smoothed RTT, ms × 8 */
+    uint32_t rttvar_x4;             /**< RTT variance, ms × 4 */
+    uint32_t samples;               /**< Samples since init */
+    uint8_t  backoff;               /**< Timeouts since the last sample */
+    uint8_t  head;                  /**< Next slot in window */
+    uint16_t window[RTT_WINDOW];    /**< Recent samples, ms (saturated) */
+    uint32_t min_rto_ms;
+    uint32_t max_rto_ms;
+} rtt_estimator_t;
+
+/** Reset; until the first sample the RTO is @p max_rto_ms. */
+void rtt_estimator_init(rtt_estimator_t *e, uint32_t min_rto_ms, uint32_t max_rto_ms);
+
+/** Feed one measured round trip and clear any timeout back-off. */
+void rtt_estimator_sample(rtt_estimator_t *e, uint32_t rtt_ms);
+
+/** An exchange timed out: double the RTO until the next sample. */
+void rtt_estimator_timeout(rtt_estimator_t *e);
+
+/** Current retransmission-style timeout, clamped to [min_rto_ms, max_rto_ms]. */
+uint32_t rtt_estimator_rto_ms(const rtt_estimator_t *e);
+
+/** Smoothed RTT in ms (0 before the first sample). */
+uint32_t rtt_estimator_srtt_ms(const rtt_estimator_t *e);
+
+/**
+ * @brief Nearest-rank percentile over the last RTT_WINDOW samples.
+ * @param pct  1..100
+ * @return RTT in ms, or 0 before the first sample.
+ */
+uint32_t rtt_estimator_percentile(const rtt_estimator_t *e, uint8_t pct);
+
+typedef struct {
+    uint32_t min_ms;
+    uint32_t max_ms;
+    uint32_t interval_ms;   /**< Current idle time before a PING */
+    uint32_t ceiling_ms;    /**< Shortest idle known to kill the link (0 = none) */
+    uint8_t  streak;        /**< Answered PINGs since the last change */
+} keepalive_t;
+
+/** Start at @p initial_ms, clamped to [@p min_ms, @p max_ms]. */
+void keepalive_init(keepalive_t *k, uint32_t min_ms, uint32_t max_ms, uint32_t initial_ms);
+
+/** A PING sent after the current interval was answered. */
+void keepalive_on_ack(keepalive_t *k);
+
+/** The link was found dead after @p idle_ms without traffic. */
+void keepalive_on_dead(keepalive_t *k, uint32_t idle_ms);
+
+/** True once @p idle_ms of silence calls for a PING. */
+bool keepalive_due(const keepalive_t *k, uint32_t idle_ms);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,95 @@
+/**
+ * @file session_arena.hpp
+ * @brief Bump/pool allocator dedicated to one nghttp2 session.
+ *
+ * Every reconnect builds a fresh nghttp2_session: HPACK tables, stream
+ * objects and frame buffers arrive as a burst of small allocations and are
+ * all released again by nghttp2_session_del().  Routing them through a
+ * fixed region owned by the gRPC client keeps that churn off the system
+ * heap — the region is allocated once and reclaimed wholesale with
+ * session_arena_reset() after the session is deleted.
+ *
+ * Layout: blocks are bump-allocated from the region with an 8-byte header
+ * recording the payload size.  Freed blocks go onto per-size-class free
+ * lists (16 B … 512 B, powers of two) or a first-fit list for larger
+ * blocks, so a long-lived session reuses memory instead of exhausting the
+ * region.  When the region is full the allocator falls back to malloc()
+ * and counts the event, so an undersized arena degrades to the old
+ * behaviour instead of failing the connection.
+ *
+ * Not thread-safe; the owning grpc_client is single-task by design.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of power-of-two size classes: 16, 32, … 512 bytes. */
+#define SESSION_ARENA_NUM_CLASSES 6
+
+/** Snapshot of arena usage, for logs and sizing the Kconfig capacity. */
+typedef struct {
+    size_t   capacity;        /**< Region size in bytes. */
+    size_t   in_use;          /**< Bytes currently handed out (headers included). */
+    size_t   peak;            /**< High-water of the bump offset since init — the
+                                   region size actually needed by the sessions seen. */
+    size_t   largest_free;    /**< Largest block servable without touching the heap. */
+    uint32_t heap_fallbacks;  /**< Allocations that did not fit and went to malloc(). */
+    uint32_t resets;          /**< Sessions reclaimed via session_arena_reset(). */
+} session_arena_stats_t;
+
+/** Arena state.  Treat as opaque; embedded by value in the owner. */
+typedef struct {
+    uint8_t *base;
+    size_t   capacity;
+    size_t   bump;
+    size_t   in_use;
+    size_t   peak;
+    void    *free_small[SESSION_ARENA_NUM_CLASSES];
+    void    *free_large;
+    uint32_t heap_fallbacks;
+    uint32_t heap_live;       /**< Outstanding fallback blocks (must be 0 at reset). */
+    uint32_t resets;
+} session_arena_t;
+
+/**
+ * @brief Bind an arena to a caller-owned region.
+ *
+ * @param a        Arena to initialise.
+ * @param buf      Region start (8-byte aligned; malloc() output qualifies).
+ * @param capacity Region size in bytes.
+ */
+void session_arena_init(session_arena_t *a, void *buf, size_t capacity);
+
+/** malloc() semantics; never returns NULL unless the heap fallback fails. */
+void *session_arena_alloc(session_arena_t *a, size_t size);
+
+/** calloc() semantics, including the nmemb * size overflow check. */
+void *session_arena_calloc(session_arena_t *a, size_t nmemb, size_t size);
+
+/** realloc() semantics.  Grows in place when the block is the last one bumped. */
+void *session_arena_realloc(session_arena_t *a, void *ptr, size_t size);
+
+/** free() semantics.  Accepts both arena blocks and heap-fallback blocks. */
+void session_arena_free(session_arena_t *a, void *ptr);
+
+/**
+ * @brief Reclaim every arena block at once.
+ *
+ * Call only after the session that used the arena has been deleted.  Peak
+ * and fallback counters survive the reset so they describe the worst
+ * session seen since init.
+ */
+void session_arena_reset(session_arena_t *a);
+
+/** Fill @p out with the current usage snapshot. */
+void session_arena_get_stats(const session_arena_t *a, session_arena_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,74 @@
+/**
+ * @file tls_profile.hpp
+ * @brief Transport profiles: what a handshake may negotiate.
+ *
+ * Most of a connect's CPU goes to the handshake's public-key operations,
+ * and which ones run is decided by what the client offers.  A profile
+ * narrows the offer on the client's mbedtls_ssl_config:
+ *
+ *   COMPAT  whatever the mbedTLS build enables (TLS 1.2 with the default
+ *           sdkconfig); any server certificate the trust accepts.
+ *   ECC     TLS 1.3 only, TLS_AES_128_GCM_SHA256 only, X25519 or P-256
+ *           key exchange, and an ECDSA P-256 server certificate
+ *           (scripts/generate_certs.sh --key-type ecdsa).  The chain is
+ *           checked against the suite B certificate profile.
+ *   PSK     TLS 1.3 with a key provisioned per module and no certificates
+ *           at all: the identity is the module_id.  psk_ke by default, or
+ *           psk_dhe_ke (X25519) for forward secrecy.
+ *
+ * The ECC and PSK profiles need CONFIG_MBEDTLS_SSL_PROTO_TLS1_3; PSK also
+ * needs the matching TLS 1.3 key exchange mode enabled in mbedTLS.
+ *
+ * Stateless.  Builds on the host against upstream mbedtls
+ * (see test/host/bench_tls_profiles.cpp).
+ */
+
+#pragma once
+
+#include "mbedtls/ssl.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    TLS_PROFILE_COMPAT = 0,
+    TLS_PROFILE_ECC,
+    TLS_PROFILE_PSK,
+} tls_profile_id_t;
+
+/** Longest PSK accepted (bytes); mbedTLS caps it at MBEDTLS_PSK_MAX_LEN. */
+#define TLS_PROFILE_PSK_MAX_LEN  32
+
+typedef struct {
+    tls_profile_id_t id;
+    const uint8_t   *psk;          /**< PSK profile: the module's key */
+    size_t           psk_len;
+    const char      *psk_identity; /**< PSK profile: NUL-terminated, usually the module_id */
+    bool             psk_dhe;      /**< PSK profile: add an X25519/P-256 exchange */
+} tls_profile_t;
+
+/** True if @p p can be applied (a PSK profile has its key and identity). */
+bool tls_profile_valid(const tls_profile_t *p);
+
+/** True if the profile authenticates the server without a certificate. */
+bool tls_profile_skips_certificates(const tls_profile_t *p);
+
+/**
+ * Narrow @p conf (client side, after mbedtls_ssl_config_defaults()) to
+ * @p p.  Certificate trust is separate (tls_trust.hpp) and not touched.
+ * @return 0, or an mbedtls error (MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE if
+ *         this mbedTLS build lacks what the profile needs).
+ */
+int tls_profile_apply(const tls_profile_t *p, mbedtls_ssl_config *conf);
+
+/** "compat", "ecc", "psk" or "psk_dhe". */
+const char *tls_profile_name(const tls_profile_t *p);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,86 @@
+/**
+ * @file tls_trust.hpp
+ * @brief Server trust anchors parsed once and reused on every handshake.
+ *
+ * Handing esp-tls the CA as cacert_buf makes mbedTLS base64-decode and
+ * parse it again on every connect; leaving it NULL walks the whole Mozilla
+ * bundle instead.  grpc_client keeps a tls_trust_t for the life of the
+ * client and attaches it to each handshake's mbedtls_ssl_config.
+ *
+ *   - CA: the certificate is embedded as DER and parsed in place
+ *     (mbedtls_x509_crt_parse_der_nocopy), so the chain references the
+ *     flash copy rather than holding its own.  The server's chain must
+ *     verify against it and name the host (authmode REQUIRED).
+ *   - SPKI pin: SHA-256 of the server certificate's SubjectPublicKeyInfo,
+ *     the same value as an HPKP pin.  When set, the pin alone decides:
+ *     the leaf's key must hash to it, and no CA, name or validity period
+ *     is consulted.  One SHA-256 over the key and no signature check on
+ *     the chain; the handshake still proves the server holds the key.
+ *
+ * An attached trust is only read during a handshake, apart from the
+ * mismatch counter.  Builds on the host against upstream mbedtls
+ * (see test/host/test_tls_trust.cpp, bench_tls_handshake.cpp).
+ */
+
+#pragma once
+
+#include "mbedtls/ssl.h"
+#include "mbedtls/x509_crt.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TLS_TRUST_PIN_LEN  32
+
+typedef struct {
+    mbedtls_x509_crt chain;             /**< CA certificate(s), parsed in place */
+    bool             has_chain;
+    mbedtls_x509_crt no_chain;          /**< Empty, for pin-only verification */
+    uint8_t          pin[TLS_TRUST_PIN_LEN];
+    bool             has_pin;
+    uint32_t         pin_mismatches;    /**< Handshakes refused by the pin */
+} tls_trust_t;
+
+/**
+ * Parse @p ca_der once and remember @p spki_pin (TLS_TRUST_PIN_LEN bytes).
+ * Either may be NULL.  @p ca_der must outlive the trust (it is not copied).
+ * False if the certificate does not parse; the trust is then empty.
+ */
+bool tls_trust_init(tls_trust_t *t, const uint8_t *ca_der, size_t ca_der_len,
+                    const uint8_t *spki_pin);
+
+void tls_trust_free(tls_trust_t *t);
+
+/** True if there is anything to attach. */
+bool tls_trust_configured(const tls_trust_t *t);
+
+/** Make @p conf require the server to pass @p t (authmode, CA chain, verify callback). */
+void tls_trust_attach(tls_trust_t *t, mbedtls_ssl_config *conf);
+
+/**
+ * The verify callback tls_trust_attach() installs when a pin is set
+ * (mbedtls f_vrfy, @p ctx is the tls_trust_t).
+ */
+int tls_trust_verify(void *ctx, mbedtls_x509_crt *crt, int depth, uint32_t *flags);
+
+/** SHA-256 of @p crt's SubjectPublicKeyInfo.  False on an mbedtls error. */
+bool tls_trust_spki_sha256(const mbedtls_x509_crt *crt, uint8_t out[TLS_TRUST_PIN_LEN]);
+
+/**
+ * Decode @p hex into at most @p cap bytes.  Returns the number of bytes
+ * written, or 0 if @p hex is empty, has an odd length, a non-hex digit, or
+ * more than @p cap bytes.
+ */
+size_t tls_trust_parse_hex(const char *hex, uint8_t *out, size_t cap);
+
+/** Parse a pin written as 64 hex digits (a Kconfig string).  False if malformed. */
+bool tls_trust_parse_pin(const char *hex, uint8_t out[TLS_TRUST_PIN_LEN]);
+
+#ifdef __cplusplus
+}
+#endif
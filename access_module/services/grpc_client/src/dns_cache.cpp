@@ -0,0 +1,176 @@
+/**
+ * @file dns_cache.cpp
+ * @brief Server address cache — implementation.
+ */
+
+#include "dns_cache.hpp"
+
+#include <string.h>
+
+void dns_cache_default_config(dns_cache_config_t *cfg)
+{
+    cfg->ttl_ms             = 300000;
+    cfg->retry_ms           = 5000;
+    cfg->resolve_timeout_ms = 15000;
+    cfg->stale_fallback     = true;
+}
+
+void dns_cache_init(dns_cache_t *c, const dns_cache_config_t *cfg)
+{
+    memset(c, 0, sizeof(*c));
+    c->cfg = *cfg;
+}
+
+static dns_cache_entry_t *find(dns_cache_t *c, uint32_t addr)
+{
+    for (uint8_t i = 0; i < c->count; i++) {
+        if (c->entries[i].addr == addr) {
+            return &c->entries[i];
+        }
+    }
+    return NULL;
+}
+
+static bool fresh(const dns_cache_t *c, const dns_cache_entry_t *e, int64_t now_ms)
+{
+    return now_ms - e->seen_ms < (int64_t)c->cfg.ttl_ms;
+}
+
+bool dns_cache_refresh_due(dns_cache_t *c, int64_t now_ms)
+{
+    if (c->in_flight) {
+        if (now_ms - c->started_ms < (int64_t)c->cfg.resolve_timeout_ms) {
+            return false;
+        }
+        dns_cache_resolve_failed(c, now_ms);
+    }
+    if (c->failed && now_ms - c->failed_ms < (int64_t)c->cfg.retry_ms) {
+        return false;
+    }
+    if (c->count == 0) {
+        return true;
+    }
+
+    int64_t newest = c->entries[0].seen_ms;
+    for (uint8_t i = 1; i < c->count; i++) {
+        if (c->entries[i].seen_ms > newest) {
+            newest = c->entries[i].seen_ms;
+        }
+    }
+    return now_ms - newest >= (int64_t)c->cfg.ttl_ms / 4 * 3;
+}
+
+void dns_cache_resolve_started(dns_cache_t *c, int64_t now_ms)
+{
+    c->in_flight  = true;
+    c->started_ms = now_ms;
+}
+
+void dns_cache_resolved(dns_cache_t *c, int64_t now_ms, uint32_t addr)
+{
+    c->stats.resolves++;
+    c->stats.last_resolve_ms = c->in_flight ? (uint32_t)(now_ms - c->started_ms) : 0;
+    c->in_flight = false;
+    c->failed    = false;
+
+    dns_cache_entry_t *e = find(c, addr);
+    if (e == NULL) {
+        if (c->count < DNS_CACHE_MAX_ADDRS) {
+            e = &c->entries[c->count++];
+        } else {
+            /* Full: the longest unseen address goes, never the one that works. */
+            for (uint8_t i = 0; i < c->count; i++) {
+                dns_cache_entry_t *x = &c->entries[i];
+                if (c->have_good && x->addr == c->good) {
+                    continue;
+                }
+                if (e == NULL || x->seen_ms < e->seen_ms) {
+                    e = x;
+                }
+            }
+        }
+        e->addr  = addr;
+        e->fails = 0;
+    }
+    e->seen_ms = now_ms;
+}
+
+void dns_cache_resolve_failed(dns_cache_t *c, int64_t now_ms)
+{
+    c->stats.failures++;
+    c->in_flight = false;
+    c->failed    = true;
+    c->failed_ms = now_ms;
+}
+
+/** True if @p a should be tried before @p b. */
+static bool before(const dns_cache_t *c, const dns_cache_entry_t *a, const dns_cache_entry_t *b)
+{
+    bool a_good = c->have_good && a->addr == c->good;
+    bool b_good = c->have_good && b->addr == c->good;
+    if (a_good != b_good) {
+        return a_good;
+    }
+    if (a->fails != b->fails) {
+        return a->fails < b->fails;
+    }
+    return a->seen_ms > b->seen_ms;
+}
+
+size_t dns_cache_lookup(dns_cache_t *c, int64_t now_ms, uint32_t *out, size_t max)
+{
+    const dns_cache_entry_t *pick[DNS_CACHE_MAX_ADDRS];
+    size_t n = 0;
+    for (uint8_t i = 0; i < c->count; i++) {
+        if (fresh(c, &c->entries[i], now_ms)) {
+            pick[n++] = &c->entries[i];
+        }
+    }
+    if (n == 0) {
+        if (!c->cfg.stale_fallback || c->count == 0) {
+            c->stats.misses++;
+            return 0;
+        }
+        for (uint8_t i = 0; i < c->count; i++) {
+            pick[n++] = &c->entries[i];
+        }
+        c->stats.stale_uses++;
+    }
+
+    /* Insertion sort: at most DNS_CACHE_MAX_ADDRS entries. */
+    for (size_t i = 1; i < n; i++) {
+        const dns_cache_entry_t *e = pick[i];
+        size_t j = i;
+        while (j > 0 && before(c, e, pick[j - 1])) {
+            pick[j] = pick[j - 1];
+            j--;
+        }
+        pick[j] = e;
+    }
+
+    if (n > max) {
+        n = max;
+    }
+    for (size_t i = 0; i < n; i++) {
+        out[i] = pick[i]->addr;
+    }
+    return n;
+}
+
+void dns_cache_connected(dns_cache_t *c, uint32_t addr)
+{
+    c->good      = addr;
+    c->have_good = true;
+    dns_cache_entry_t *e = find(c, addr);
+    if (e != NULL) {
+        e->fails = 0;
+    }
+}
+
+void dns_cache_connect_failed(dns_cache_t *c, uint32_t addr)
+{
+    dns_cache_entry_t *e = find(c, addr);
+    if (e != NULL && e->fails < UINT8_MAX) {
+        e->fails++;
+    }
+}
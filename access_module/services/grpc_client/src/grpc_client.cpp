@@ -12,47 +12,88 @@
  * synchronously via blocking esp-tls reads/writes.
  *
  * Connection lifecycle:
- *   1. esp_tls_conn_new() with ALPN "h2"
- *   2. nghttp2_session_client_new() with send/recv callbacks
+ *   1. TCP connect to the cached server addresses, raced (see race_connect),
+ *      then esp_tls_conn_new_sync() on the winning socket with ALPN "h2"
+ *   2. nghttp2_session_client_new3() with send/recv callbacks, allocating
+ *      from the client's session arena (see session_arena.hpp)
  *   3. Exchange HTTP/2 SETTINGS frames
  *   4. For each unary RPC: open stream → send HEADERS+DATA → recv DATA+trailers
  *   5. Connection kept alive between RPCs; reconnect on error
+ *   6. On disconnect the session is deleted and its arena reset wholesale
+ *
+ * Timeouts: unary call times and PING round trips each feed an RTT
+ * estimator (link_timing.hpp).  A call waits SRTT + 4·RTTVAR of past call
+ * times, bounded by min_rpc_timeout_ms and rpc_timeout_ms, and a PING
+ * waits the same bound over PING times; an unanswered PING tears the
+ * connection down at once instead of leaving it for the next RPC.
+ *
+ * Name resolution: server_host is resolved by lwIP's asynchronous DNS
+ * (dns_gethostbyname() on the tcpip thread) and the answers kept in a
+ * dns_cache_t.  Connects, calls and PINGs kick a refresh when one is due
+ * but never wait for it; only a connect with nothing cached at all waits,
+ * within connect_timeout_ms.
+ *
+ * Trust: a custom CA arrives as DER and is parsed once at init into a
+ * tls_trust_t (tls_trust.hpp), optionally with an SPKI pin; each handshake
+ * attaches it instead of handing esp-tls a PEM to decode and parse.  The
+ * transport profile (tls_profile.hpp) narrows versions, suites, groups and
+ * signature algorithms on the same config, or replaces certificates with
+ * the module's PSK.
  */
 
 #include "grpc_client.hpp"
+#include "session_arena.hpp"
+#include "link_timing.hpp"
+#include "grpc_frame.hpp"
+#include "dns_cache.hpp"
+#include "tls_trust.hpp"
+#include "tls_profile.hpp"
 #include "error_codes.hpp"
+#include "jitter.h"
 
 #include "esp_tls.h"
 #include "esp_crt_bundle.h"
 #include "esp_log.h"
 #include "esp_timer.h"
+#include "esp_random.h"
 
 #include "nghttp2/nghttp2.h"
 
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 
+#include "lwip/dns.h"
+#include "lwip/tcpip.h"
+
 #include <cstring>
 #include <cstdlib>
-#include <arpa/inet.h>  /* htonl / ntohl */
+#include <cstdio>
 #include <sys/socket.h> /* setsockopt / SO_RCVTIMEO */
+#include <sys/select.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
 
 static const char *TAG = "grpc_client";
 
 /* ── Constants ─────────────────────────────────────────────────────────────── */
 
-/** gRPC frame header: 1 byte compression flag + 4 bytes message length. */
-static constexpr size_t GRPC_FRAME_HEADER_LEN = 5;
-
 /** Maximum number of custom metadata entries. */
 static constexpr int MAX_CUSTOM_METADATA = 4;
 
 /** Maximum length for a metadata key or value. */
 static constexpr size_t MAX_METADATA_LEN = 128;
 
-/** Upper bound on outbound RPC payload; avoids heap allocation on the hot path.
- *  Sized to HeartbeatRequest_size (142) + margin. */
-static constexpr size_t GRPC_MAX_REQUEST_PAYLOAD = 192;
+/** Upper bound on outbound RPC payload; avoids heap allocation on the hot path. */
+static constexpr size_t GRPC_MAX_REQUEST_PAYLOAD = GRPC_CLIENT_MAX_REQUEST_BYTES;
+
+/** Head start each server address gets before the next is tried (RFC 8305). */
+static constexpr int CONNECT_ATTEMPT_DELAY_MS = 250;
+
+/** How often a connect with nothing cached checks for the first DNS answer. */
+static constexpr int DNS_POLL_MS = 10;
 
 /* ── Internal types ────────────────────────────────────────────────────────── */
 
@@ -96,11 +137,66 @@ struct grpc_client {
     /* HTTP/2 session */
     nghttp2_session      *session;
     bool                  settings_received; /**< True after server SETTINGS frame received. */
+    nghttp2_session_callbacks *callbacks;    /**< Built once in init, reused per connect. */
+
+    /* Session allocator: every nghttp2 allocation lands here instead of the
+     * system heap, and the whole region is reclaimed on disconnect. */
+    session_arena_t       arena;
+    nghttp2_mem           mem;
+    uint32_t              logged_fallbacks;  /**< heap_fallbacks already reported. */
 
     /* Custom metadata headers sent with every RPC */
     metadata_entry_t      metadata[MAX_CUSTOM_METADATA];
+
+    /* The framed request of the call in progress; too big for the caller's
+     * stack since heartbeats carry health telemetry. */
+    uint8_t               req_frame[GRPC_FRAME_HEADER_LEN + GRPC_MAX_REQUEST_PAYLOAD];
+
+    /* One-shot budget for the next unary call (0 = RTT-derived timeout). */
+    int                   next_call_timeout_ms;
+
+    /* Link timing: call and PING round trips, outstanding PING. */
+    rtt_estimator_t       call_rtt;
+    rtt_estimator_t       ping_rtt;
+    bool                  ping_outstanding;
+    int64_t               ping_sent_us;
+    uint32_t              dead_links;        /**< Connections torn down by an unanswered PING. */
+    uint32_t              connects;          /**< Connections established. */
+    uint32_t              failed_connects;   /**< Connect attempts that failed. */
+
+    /* Reconnect pacing: failed connects in a row, and when the next is due. */
+    uint32_t              connect_failures;
+    int64_t               next_connect_us;
+
+    /* Server address: fixed when host is an IP literal, else resolved and
+     * cached.  dns and dns_req are shared with the tcpip thread (s_dns_lock). */
+    bool                  host_is_literal;
+    uint32_t              literal_addr;
+    dns_cache_t           dns;
+    struct dns_request_t *dns_req;           /**< Resolve in flight, if any. */
+
+    /* Server trust: CA chain parsed once at init, optional SPKI pin. */
+    tls_trust_t           trust;
+    uint32_t              tls_handshake_ms;  /**< Last handshake's duration. */
+    uint32_t              tls_failures;      /**< Handshakes that failed. */
+};
+
+/**
+ * One resolve handed to lwIP, freed by its callback.  If the client is
+ * destroyed, or gives up on the resolve, first, client is cleared and the
+ * answer dropped.
+ */
+struct dns_request_t {
+    grpc_client *client;
+    char        *host;                       /**< Copy, stored after the struct. */
 };
 
+static portMUX_TYPE s_dns_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/** Client whose handshake is in progress: esp-tls gives the attach hook no
+ *  context.  Connects run on one task at a time. */
+static grpc_client *s_attach_client = nullptr;
+
 /* ── Helper: build an nghttp2_nv from string literals / buffers ────────────── */
 
 static nghttp2_nv make_nv(const char *name, const char *value)
@@ -114,76 +210,6 @@ static nghttp2_nv make_nv(const char *name, const char *value)
     return nv;
 }
 
-/* ── gRPC frame helpers ────────────────────────────────────────────────────── */
-
-/**
- * @brief Build a gRPC length-prefixed message frame.
- *
- * Layout: [0x00 (no compression)] [4-byte big-endian length] [protobuf bytes]
- *
- * @param proto_buf   Protobuf-encoded message.
- * @param proto_len   Length of the protobuf message.
- * @param out_buf     Output buffer (must be at least proto_len + 5).
- * @param out_cap     Capacity of out_buf.
- * @param out_len     [out] Total bytes written (5 + proto_len).
- * @return true on success, false if out_buf is too small.
- */
-static bool grpc_frame_encode(const uint8_t *proto_buf, size_t proto_len,
-                               uint8_t *out_buf, size_t out_cap, size_t *out_len)
-{
-    size_t total = GRPC_FRAME_HEADER_LEN + proto_len;
-    if (total > out_cap) {
-        return false;
-    }
-
-    out_buf[0] = 0x00; /* No compression */
-    uint32_t len_be = htonl(static_cast<uint32_t>(proto_len));
-    memcpy(&out_buf[1], &len_be, 4);
-    memcpy(&out_buf[GRPC_FRAME_HEADER_LEN], proto_buf, proto_len);
-
-    *out_len = total;
-    return true;
-}
-
-/**
- * @brief Strip the 5-byte gRPC frame header from a received message.
- *
- * @param frame_buf   Buffer containing the full gRPC frame.
- * @param frame_len   Length of the frame.
- * @param proto_buf   [out] Points into frame_buf past the header.
- * @param proto_len   [out] Length of the protobuf payload.
- * @return true on success, false if frame is malformed.
- */
-static bool grpc_frame_decode(const uint8_t *frame_buf, size_t frame_len,
-                               const uint8_t **proto_buf, size_t *proto_len)
-{
-    if (frame_len < GRPC_FRAME_HEADER_LEN) {
-        return false;
-    }
-
-    /* Byte 0: compression flag (we only support uncompressed). */
-    if (frame_buf[0] != 0x00) {
-        ESP_LOGE(TAG, "Compressed gRPC messages not supported (flag=0x%02x)",
-                 frame_buf[0]);
-        return false;
-    }
-
-    uint32_t msg_len;
-    memcpy(&msg_len, &frame_buf[1], 4);
-    msg_len = ntohl(msg_len);
-
-    if (GRPC_FRAME_HEADER_LEN + msg_len > frame_len) {
-        ESP_LOGE(TAG, "gRPC frame truncated: header says %lu bytes, have %zu",
-                 static_cast<unsigned long>(msg_len),
-                 frame_len - GRPC_FRAME_HEADER_LEN);
-        return false;
-    }
-
-    *proto_buf = &frame_buf[GRPC_FRAME_HEADER_LEN];
-    *proto_len = static_cast<size_t>(msg_len);
-    return true;
-}
-
 /* ── nghttp2 callbacks ─────────────────────────────────────────────────────── */
 
 /**
@@ -316,12 +342,19 @@ static int cb_on_frame_recv(nghttp2_session *session,
                              void *user_data)
 {
     if (frame->hd.stream_id == 0) {
+        auto *c = static_cast<grpc_client *>(user_data);
         /* Track server SETTINGS arrival for handshake completion (B19). */
         if (frame->hd.type == NGHTTP2_SETTINGS &&
             !(frame->hd.flags & NGHTTP2_FLAG_ACK)) {
-            auto *c = static_cast<grpc_client *>(user_data);
             c->settings_received = true;
         }
+        /* Our keepalive PING came back: one RTT sample. */
+        if (frame->hd.type == NGHTTP2_PING &&
+            (frame->hd.flags & NGHTTP2_FLAG_ACK) && c->ping_outstanding) {
+            c->ping_outstanding = false;
+            rtt_estimator_sample(&c->ping_rtt, static_cast<uint32_t>(
+                (esp_timer_get_time() - c->ping_sent_us) / 1000));
+        }
         return 0; /* Connection-level frame (SETTINGS, PING, etc.) */
     }
     (void)user_data;
@@ -364,58 +397,147 @@ static int cb_on_stream_close(nghttp2_session *session, int32_t stream_id,
     return 0;
 }
 
+/* ── nghttp2_mem adapters onto the session arena ──────────────────────────── */
+
+static void *arena_malloc(size_t size, void *mem_user_data)
+{
+    return session_arena_alloc(static_cast<session_arena_t *>(mem_user_data), size);
+}
+
+static void arena_free(void *ptr, void *mem_user_data)
+{
+    session_arena_free(static_cast<session_arena_t *>(mem_user_data), ptr);
+}
+
+static void *arena_calloc(size_t nmemb, size_t size, void *mem_user_data)
+{
+    return session_arena_calloc(static_cast<session_arena_t *>(mem_user_data), nmemb, size);
+}
+
+static void *arena_realloc(void *ptr, size_t size, void *mem_user_data)
+{
+    return session_arena_realloc(static_cast<session_arena_t *>(mem_user_data), ptr, size);
+}
+
 /* ── Session helpers ───────────────────────────────────────────────────────── */
 
 /**
- * @brief Create the nghttp2 session with all callbacks registered.
+ * @brief Build the callbacks object once; it is immutable and shared by
+ *        every session this client creates.
  */
-static portunus_err_t create_nghttp2_session(grpc_client *c)
+static portunus_err_t create_nghttp2_callbacks(grpc_client *c)
 {
-    nghttp2_session_callbacks *cbs = nullptr;
-
-    int rv = nghttp2_session_callbacks_new(&cbs);
+    int rv = nghttp2_session_callbacks_new(&c->callbacks);
     if (rv != 0) {
         ESP_LOGE(TAG, "nghttp2_session_callbacks_new failed: %d", rv);
         return PORTUNUS_ERR_NO_MEMORY;
     }
 
-    nghttp2_session_callbacks_set_send_callback(cbs, cb_send);
-    nghttp2_session_callbacks_set_recv_callback(cbs, cb_recv);
-    nghttp2_session_callbacks_set_on_header_callback(cbs, cb_on_header);
-    nghttp2_session_callbacks_set_on_data_chunk_recv_callback(cbs, cb_on_data_chunk);
-    nghttp2_session_callbacks_set_on_frame_recv_callback(cbs, cb_on_frame_recv);
-    nghttp2_session_callbacks_set_on_stream_close_callback(cbs, cb_on_stream_close);
+    nghttp2_session_callbacks_set_send_callback(c->callbacks, cb_send);
+    nghttp2_session_callbacks_set_recv_callback(c->callbacks, cb_recv);
+    nghttp2_session_callbacks_set_on_header_callback(c->callbacks, cb_on_header);
+    nghttp2_session_callbacks_set_on_data_chunk_recv_callback(c->callbacks, cb_on_data_chunk);
+    nghttp2_session_callbacks_set_on_frame_recv_callback(c->callbacks, cb_on_frame_recv);
+    nghttp2_session_callbacks_set_on_stream_close_callback(c->callbacks, cb_on_stream_close);
+
+    return PORTUNUS_OK;
+}
 
-    rv = nghttp2_session_client_new(&c->session, cbs, c);
-    nghttp2_session_callbacks_del(cbs);
+/**
+ * @brief Create the nghttp2 session, allocating from the session arena
+ *        when one is configured.
+ */
+static portunus_err_t create_nghttp2_session(grpc_client *c)
+{
+    nghttp2_mem *mem = (c->arena.base != nullptr) ? &c->mem : nullptr;
 
+    int rv = nghttp2_session_client_new3(&c->session, c->callbacks, c, nullptr, mem);
     if (rv != 0) {
-        ESP_LOGE(TAG, "nghttp2_session_client_new failed: %d", rv);
+        ESP_LOGE(TAG, "nghttp2_session_client_new3 failed: %d", rv);
         return PORTUNUS_ERR_NO_MEMORY;
     }
 
     return PORTUNUS_OK;
 }
 
+/**
+ * @brief Delete the nghttp2 session and reclaim its arena in one step.
+ *
+ * nghttp2_session_del() returns every block to the arena first, so the
+ * reset only discards free-list bookkeeping.  Heap fallbacks since the
+ * last report mean the arena is undersized for this server's traffic.
+ */
+static void destroy_nghttp2_session(grpc_client *c)
+{
+    if (c->session == nullptr) { return; }
+
+    nghttp2_session_del(c->session);
+    c->session = nullptr;
+
+    if (c->arena.base == nullptr) { return; }
+
+    session_arena_stats_t st;
+    session_arena_get_stats(&c->arena, &st);
+    if (st.heap_fallbacks != c->logged_fallbacks) {
+        ESP_LOGW(TAG, "Session arena overflowed %" PRIu32 " time(s); peak %zu/%zu B — "
+                 "raise CONFIG_PORTUNUS_GRPC_SESSION_ARENA_SIZE",
+                 st.heap_fallbacks - c->logged_fallbacks, st.peak, st.capacity);
+        c->logged_fallbacks = st.heap_fallbacks;
+    }
+    ESP_LOGD(TAG, "Session arena reclaimed: peak %zu/%zu B, %zu B still live at reset",
+             st.peak, st.capacity, st.in_use);
+
+    session_arena_reset(&c->arena);
+}
+
+/** Timeout for a unary call with no explicit budget. */
+static int call_timeout_ms(const grpc_client *c)
+{
+    if (c->cfg.min_rpc_timeout_ms <= 0) {
+        return c->cfg.rpc_timeout_ms;
+    }
+    return static_cast<int>(rtt_estimator_rto_ms(&c->call_rtt));
+}
+
+/** Time to wait for a PING ACK before declaring the connection dead. */
+static int ping_timeout_ms(const grpc_client *c)
+{
+    if (c->cfg.min_rpc_timeout_ms <= 0) {
+        return c->cfg.rpc_timeout_ms;
+    }
+    return static_cast<int>(rtt_estimator_rto_ms(&c->ping_rtt));
+}
+
+/** The link went away under us: the next connect is due within reconnect_base_ms.
+    Every module on a server that restarts loses its link in the same instant. */
+static void spread_reconnect(grpc_client *c)
+{
+    uint32_t delay_ms = jitter_phase_ms(c->cfg.reconnect_base_ms, esp_random());
+    c->next_connect_us = esp_timer_get_time() + static_cast<int64_t>(delay_ms) * 1000;
+}
+
+static portunus_err_t connect_once(grpc_client *c);
+
 /**
  * @brief Pump the nghttp2 session: send pending frames and receive incoming.
  *
  * Continues until nghttp2 has no more data to send and has processed
  * all pending receives, or until the stream_state indicates completion.
  *
- * @param c  Client handle.
- * @param ss Stream state to monitor for completion (nullptr for connection-level).
+ * @param c          Client handle.
+ * @param ss         Stream state to monitor for completion (nullptr for connection-level).
+ * @param timeout_ms Give up after this long.
  * @return PORTUNUS_OK on success, error code on failure.
  */
-static portunus_err_t pump_session(grpc_client *c, stream_state_t *ss)
+static portunus_err_t pump_session(grpc_client *c, stream_state_t *ss, int timeout_ms)
 {
     int64_t start_us = esp_timer_get_time();
-    int64_t timeout_us = static_cast<int64_t>(c->cfg.rpc_timeout_ms) * 1000;
+    int64_t timeout_us = static_cast<int64_t>(timeout_ms) * 1000;
 
     while (true) {
         /* Check timeout. */
         if ((esp_timer_get_time() - start_us) > timeout_us) {
-            ESP_LOGW(TAG, "Session pump timed out after %d ms", c->cfg.rpc_timeout_ms);
+            ESP_LOGW(TAG, "Session pump timed out after %d ms", timeout_ms);
             return PORTUNUS_ERR_TIMEOUT;
         }
 
@@ -438,6 +560,7 @@ static portunus_err_t pump_session(grpc_client *c, stream_state_t *ss)
             if (rv == NGHTTP2_ERR_EOF) {
                 ESP_LOGW(TAG, "Server closed connection");
                 c->connected = false;
+                spread_reconnect(c);
                 return PORTUNUS_ERR_HTTP_CONNECT;
             }
             ESP_LOGE(TAG, "nghttp2_session_recv error: %s", nghttp2_strerror(rv));
@@ -446,10 +569,11 @@ static portunus_err_t pump_session(grpc_client *c, stream_state_t *ss)
         }
 
         /* Connection-level pump (initial SETTINGS exchange or PING keepalive).
-         * Exit once the server's SETTINGS has been received and we have
-         * nothing left to send (our SETTINGS ACK has been flushed). */
+         * Exit once the server's SETTINGS has been received, any PING we
+         * sent has been answered, and we have nothing left to send (our
+         * SETTINGS ACK has been flushed). */
         if (ss == nullptr) {
-            if (c->settings_received &&
+            if (c->settings_received && !c->ping_outstanding &&
                 nghttp2_session_want_write(c->session) == 0) {
                 return PORTUNUS_OK;
             }
@@ -460,6 +584,278 @@ static portunus_err_t pump_session(grpc_client *c, stream_state_t *ss)
     }
 }
 
+/* ── Server address: background DNS and the connect race ───────────────────── */
+
+static int64_t now_ms()
+{
+    return esp_timer_get_time() / 1000;
+}
+
+static void addr_to_str(uint32_t addr, char *buf, size_t len)
+{
+    const auto *b = reinterpret_cast<const uint8_t *>(&addr);
+    snprintf(buf, len, "%u.%u.%u.%u", b[0], b[1], b[2], b[3]);
+}
+
+/** lwIP found callback; runs on the tcpip thread. */
+static void dns_found(const char *name, const ip_addr_t *ipaddr, void *arg)
+{
+    auto *req = static_cast<dns_request_t *>(arg);
+    bool ok = (ipaddr != nullptr && IP_IS_V4(ipaddr));
+    uint32_t addr = ok ? ip4_addr_get_u32(ip_2_ip4(ipaddr)) : 0;
+    uint32_t took_ms = 0;
+
+    portENTER_CRITICAL(&s_dns_lock);
+    grpc_client *c = req->client;
+    if (c != nullptr) {
+        c->dns_req = nullptr;
+        if (ok) {
+            dns_cache_resolved(&c->dns, now_ms(), addr);
+            took_ms = c->dns.stats.last_resolve_ms;
+        } else {
+            dns_cache_resolve_failed(&c->dns, now_ms());
+        }
+    }
+    portEXIT_CRITICAL(&s_dns_lock);
+
+    if (c != nullptr) {
+        if (ok) {
+            char a[16];
+            addr_to_str(addr, a, sizeof(a));
+            ESP_LOGD(TAG, "Resolved %s to %s in %" PRIu32 " ms", name, a, took_ms);
+        } else {
+            ESP_LOGW(TAG, "DNS lookup for %s failed", name);
+        }
+    }
+    free(req);
+}
+
+/** Runs on the tcpip thread, where lwIP's DNS must be called. */
+static void dns_start(void *arg)
+{
+    auto *req = static_cast<dns_request_t *>(arg);
+    ip_addr_t addr = {};
+    err_t err = dns_gethostbyname(req->host, &addr, dns_found, req);
+    if (err == ERR_OK) {
+        dns_found(req->host, &addr, req);           /* lwIP had it cached */
+    } else if (err != ERR_INPROGRESS) {
+        dns_found(req->host, nullptr, req);
+    }
+}
+
+/** Start a background resolve of host if one is due.  Never waits. */
+static void dns_refresh(grpc_client *c)
+{
+    if (c->host_is_literal) {
+        return;
+    }
+
+    int64_t now = now_ms();
+    portENTER_CRITICAL(&s_dns_lock);
+    bool due = dns_cache_refresh_due(&c->dns, now);
+    if (due && c->dns_req != nullptr) {
+        /* Timed out: let its answer, if it ever comes, fall on the floor. */
+        c->dns_req->client = nullptr;
+        c->dns_req = nullptr;
+    }
+    portEXIT_CRITICAL(&s_dns_lock);
+    if (!due) {
+        return;
+    }
+
+    size_t len = strlen(c->cfg.host);
+    auto *req = static_cast<dns_request_t *>(malloc(sizeof(dns_request_t) + len + 1));
+    if (req == nullptr) {
+        return;                                     /* try again next time */
+    }
+    req->client = c;
+    req->host   = reinterpret_cast<char *>(req + 1);
+    memcpy(req->host, c->cfg.host, len + 1);
+
+    portENTER_CRITICAL(&s_dns_lock);
+    dns_cache_resolve_started(&c->dns, now);
+    c->dns_req = req;
+    portEXIT_CRITICAL(&s_dns_lock);
+
+    if (tcpip_callback(dns_start, req) != ERR_OK) {
+        portENTER_CRITICAL(&s_dns_lock);
+        c->dns_req = nullptr;
+        dns_cache_resolve_failed(&c->dns, now);
+        portEXIT_CRITICAL(&s_dns_lock);
+        free(req);
+    }
+}
+
+/**
+ * @brief Addresses to connect to, in order.
+ *
+ * Takes what is cached; waits up to @p wait_ms for DNS only when nothing
+ * is (first connect after boot, or everything expired with stale fallback
+ * off).  Returns the count, 0 if DNS did not come through.
+ */
+static size_t server_addrs(grpc_client *c, uint32_t *out, int wait_ms)
+{
+    if (c->host_is_literal) {
+        out[0] = c->literal_addr;
+        return 1;
+    }
+
+    int64_t give_up = now_ms() + wait_ms;
+    for (;;) {
+        dns_refresh(c);
+        portENTER_CRITICAL(&s_dns_lock);
+        size_t n = dns_cache_lookup(&c->dns, now_ms(), out, DNS_CACHE_MAX_ADDRS);
+        bool waiting = c->dns.in_flight;
+        portEXIT_CRITICAL(&s_dns_lock);
+        if (n > 0 || !waiting || now_ms() >= give_up) {
+            return n;
+        }
+        vTaskDelay(pdMS_TO_TICKS(DNS_POLL_MS));
+    }
+}
+
+static void note_connect(grpc_client *c, uint32_t addr, bool ok)
+{
+    if (c->host_is_literal) {
+        return;
+    }
+    portENTER_CRITICAL(&s_dns_lock);
+    if (ok) {
+        dns_cache_connected(&c->dns, addr);
+    } else {
+        dns_cache_connect_failed(&c->dns, addr);
+    }
+    portEXIT_CRITICAL(&s_dns_lock);
+}
+
+/** Open a non-blocking socket and start a TCP connect to @p addr.  -1 if it failed outright. */
+static int start_connect(grpc_client *c, uint32_t addr)
+{
+    int fd = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (fd < 0) {
+        ESP_LOGE(TAG, "socket() failed: errno %d", errno);
+        return -1;
+    }
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) | O_NONBLOCK);
+
+    struct sockaddr_in sa = {};
+    sa.sin_family      = AF_INET;
+    sa.sin_port        = htons(c->cfg.port);
+    sa.sin_addr.s_addr = addr;
+    if (connect(fd, reinterpret_cast<struct sockaddr *>(&sa), sizeof(sa)) < 0 &&
+        errno != EINPROGRESS) {
+        char a[16];
+        addr_to_str(addr, a, sizeof(a));
+        ESP_LOGW(TAG, "Connect to %s failed: errno %d", a, errno);
+        note_connect(c, addr, false);
+        close(fd);
+        return -1;
+    }
+    return fd;
+}
+
+/**
+ * @brief TCP connect to whichever of @p addrs answers first.
+ *
+ * Happy eyeballs over IPv4 (RFC 8305 §5): attempts start in order, each
+ * CONNECT_ATTEMPT_DELAY_MS after the one before or at once when it fails,
+ * and run side by side; the first to complete wins and the rest are
+ * closed.  An address that has gone dark costs the next one a 250 ms head
+ * start instead of the whole connect timeout.  Outcomes go back to the
+ * DNS cache so the address that works is tried first next time.
+ *
+ * @return The connected socket, in blocking mode, or -1.
+ */
+static int race_connect(grpc_client *c, const uint32_t *addrs, size_t n, int timeout_ms)
+{
+    int     fds[DNS_CACHE_MAX_ADDRS];
+    size_t  started = 0;
+    size_t  live    = 0;
+    int     winner  = -1;
+    int64_t deadline_us   = esp_timer_get_time() + static_cast<int64_t>(timeout_ms) * 1000;
+    int64_t next_start_us = 0;
+
+    while (winner < 0) {
+        int64_t now_us = esp_timer_get_time();
+        if (now_us >= deadline_us) {
+            break;
+        }
+
+        if (started < n && (now_us >= next_start_us || live == 0)) {
+            fds[started] = start_connect(c, addrs[started]);
+            if (fds[started] >= 0) {
+                live++;
+            }
+            started++;
+            next_start_us = now_us + static_cast<int64_t>(CONNECT_ATTEMPT_DELAY_MS) * 1000;
+            continue;
+        }
+        if (live == 0) {
+            break;
+        }
+
+        fd_set wr;
+        FD_ZERO(&wr);
+        int max_fd = -1;
+        for (size_t i = 0; i < started; i++) {
+            if (fds[i] >= 0) {
+                FD_SET(fds[i], &wr);
+                max_fd = (fds[i] > max_fd) ? fds[i] : max_fd;
+            }
+        }
+        int64_t wake_us = (started < n && next_start_us < deadline_us) ? next_start_us : deadline_us;
+        struct timeval tv = {};
+        tv.tv_sec  = static_cast<time_t>((wake_us - now_us) / 1000000);
+        tv.tv_usec = static_cast<suseconds_t>((wake_us - now_us) % 1000000);
+        if (select(max_fd + 1, nullptr, &wr, nullptr, &tv) < 0) {
+            ESP_LOGE(TAG, "select() failed: errno %d", errno);
+            break;
+        }
+
+        for (size_t i = 0; i < started; i++) {
+            if (fds[i] < 0 || !FD_ISSET(fds[i], &wr)) {
+                continue;
+            }
+            int so_err = 0;
+            socklen_t so_len = sizeof(so_err);
+            getsockopt(fds[i], SOL_SOCKET, SO_ERROR, &so_err, &so_len);
+            if (so_err == 0) {
+                if (winner < 0) {
+                    winner = static_cast<int>(i);
+                }
+                continue;
+            }
+            char a[16];
+            addr_to_str(addrs[i], a, sizeof(a));
+            ESP_LOGW(TAG, "Connect to %s failed: errno %d", a, so_err);
+            note_connect(c, addrs[i], false);
+            close(fds[i]);
+            fds[i] = -1;
+            live--;
+            next_start_us = now_us;                 /* next one now */
+        }
+    }
+
+    for (size_t i = 0; i < started; i++) {
+        if (fds[i] >= 0 && static_cast<int>(i) != winner) {
+            close(fds[i]);
+        }
+    }
+    if (winner < 0) {
+        return -1;
+    }
+
+    int fd = fds[winner];
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL, 0) & ~O_NONBLOCK);
+    note_connect(c, addrs[winner], true);
+    if (winner > 0) {
+        char a[16];
+        addr_to_str(addrs[winner], a, sizeof(a));
+        ESP_LOGI(TAG, "Connected to %s (address %d of %u)", a, winner + 1, (unsigned)n);
+    }
+    return fd;
+}
+
 /* ── Data provider for nghttp2_submit_request ──────────────────────────────── */
 
 /** Context for the data provider callback. */
@@ -523,8 +919,64 @@ portunus_err_t grpc_client_init(const grpc_client_config_t *cfg,
     c->tls       = nullptr;
     c->session   = nullptr;
 
+    if (!tls_profile_valid(&cfg->tls_profile)) {
+        ESP_LOGE(TAG, "TLS profile '%s' is missing its key or identity",
+                 tls_profile_name(&cfg->tls_profile));
+        free(c);
+        return PORTUNUS_ERR_INVALID_ARG;
+    }
+
+    /* Parse the CA once; every handshake reuses the chain. */
+    if (!tls_trust_init(&c->trust, cfg->ca_cert_der, cfg->ca_cert_der_len,
+                        cfg->spki_pin_sha256)) {
+        ESP_LOGE(TAG, "CA certificate (%zu B) does not parse as DER", cfg->ca_cert_der_len);
+        free(c);
+        return PORTUNUS_ERR_INVALID_ARG;
+    }
+
+    portunus_err_t err = create_nghttp2_callbacks(c);
+    if (err != PORTUNUS_OK) {
+        tls_trust_free(&c->trust);
+        free(c);
+        return err;
+    }
+
+    /* The arena region lives as long as the client, so reconnects never
+     * touch the system heap.  0 keeps nghttp2 on the default allocator. */
+    void *region = nullptr;
+    if (cfg->session_arena_bytes > 0) {
+        region = malloc(cfg->session_arena_bytes);
+        if (region == nullptr) {
+            ESP_LOGW(TAG, "Session arena (%zu B) unavailable — using system heap",
+                     cfg->session_arena_bytes);
+        }
+    }
+    session_arena_init(&c->arena, region, cfg->session_arena_bytes);
+
+    uint32_t rto_floor = (cfg->min_rpc_timeout_ms > 0)
+                         ? static_cast<uint32_t>(cfg->min_rpc_timeout_ms) : 0;
+    rtt_estimator_init(&c->call_rtt, rto_floor, static_cast<uint32_t>(cfg->rpc_timeout_ms));
+    rtt_estimator_init(&c->ping_rtt, rto_floor, static_cast<uint32_t>(cfg->rpc_timeout_ms));
+    c->mem.mem_user_data = &c->arena;
+    c->mem.malloc        = arena_malloc;
+    c->mem.free          = arena_free;
+    c->mem.calloc        = arena_calloc;
+    c->mem.realloc       = arena_realloc;
+
+    struct in_addr literal = {};
+    c->host_is_literal = (cfg->host != nullptr && inet_aton(cfg->host, &literal) != 0);
+    c->literal_addr    = literal.s_addr;
+    dns_cache_config_t dns_cfg;
+    dns_cache_default_config(&dns_cfg);
+    if (cfg->dns_ttl_ms > 0) {
+        dns_cfg.ttl_ms = cfg->dns_ttl_ms;
+    }
+    dns_cfg.stale_fallback = cfg->dns_stale_fallback;
+    dns_cache_init(&c->dns, &dns_cfg);
+
     *handle = c;
-    ESP_LOGI(TAG, "gRPC client created for %s:%u", cfg->host, cfg->port);
+    ESP_LOGI(TAG, "gRPC client created for %s:%u (session arena %zu B)",
+             cfg->host, cfg->port, c->arena.capacity);
     return PORTUNUS_OK;
 }
 
@@ -533,6 +985,14 @@ void grpc_client_destroy(grpc_client_handle_t handle)
     if (handle == nullptr) { return; }
 
     grpc_client_disconnect(handle);
+    portENTER_CRITICAL(&s_dns_lock);
+    if (handle->dns_req != nullptr) {
+        handle->dns_req->client = nullptr;
+    }
+    portEXIT_CRITICAL(&s_dns_lock);
+    nghttp2_session_callbacks_del(handle->callbacks);
+    tls_trust_free(&handle->trust);
+    free(handle->arena.base);
     free(handle);
     ESP_LOGI(TAG, "gRPC client destroyed");
 }
@@ -545,6 +1005,67 @@ portunus_err_t grpc_client_connect(grpc_client_handle_t c)
         return PORTUNUS_OK;
     }
 
+    portunus_err_t err = connect_once(c);
+    if (err == PORTUNUS_OK) {
+        c->connect_failures = 0;
+        c->next_connect_us  = 0;
+        return PORTUNUS_OK;
+    }
+    c->connect_failures++;
+    c->failed_connects++;
+    uint32_t backoff_ms = jitter_backoff_ms(c->cfg.reconnect_base_ms, c->cfg.reconnect_max_ms,
+                                            c->connect_failures, esp_random());
+    c->next_connect_us = esp_timer_get_time() + static_cast<int64_t>(backoff_ms) * 1000;
+    ESP_LOGW(TAG, "Connect failed %" PRIu32 " time(s) in a row — next in %" PRIu32 " ms",
+             c->connect_failures, backoff_ms);
+    return err;
+}
+
+bool grpc_client_connect_due(grpc_client_handle_t c)
+{
+    if (c == nullptr) { return false; }
+    dns_refresh(c);
+    return c->connected || esp_timer_get_time() >= c->next_connect_us;
+}
+
+/**
+ * esp-tls crt_bundle_attach hook, the one place it hands over the
+ * mbedtls_ssl_config: narrow it to the transport profile, then attach the
+ * pre-parsed trust, or the Mozilla bundle if there is none.  A PSK profile
+ * needs neither, and dev mode verifies nothing.
+ */
+static esp_err_t transport_attach(void *conf)
+{
+    grpc_client *c = s_attach_client;
+    if (c == nullptr) {
+        return ESP_FAIL;
+    }
+    auto *ssl_conf = static_cast<mbedtls_ssl_config *>(conf);
+    int ret = tls_profile_apply(&c->cfg.tls_profile, ssl_conf);
+    if (ret != 0) {
+        ESP_LOGE(TAG, "TLS profile '%s' unavailable in this mbedTLS build (-0x%04x)",
+                 tls_profile_name(&c->cfg.tls_profile), (unsigned)-ret);
+        return ESP_FAIL;
+    }
+    if (tls_profile_skips_certificates(&c->cfg.tls_profile)) {
+        return ESP_OK;
+    }
+    if (c->cfg.skip_cert_verify) {
+        mbedtls_ssl_conf_authmode(ssl_conf, MBEDTLS_SSL_VERIFY_NONE);
+        return ESP_OK;
+    }
+    if (tls_trust_configured(&c->trust)) {
+        tls_trust_attach(&c->trust, ssl_conf);
+        return ESP_OK;
+    }
+    return esp_crt_bundle_attach(conf);
+}
+
+/**
+ * @brief Open the TLS connection and HTTP/2 session once, no pacing.
+ */
+static portunus_err_t connect_once(grpc_client *c)
+{
     /* Clean up any stale state. */
     grpc_client_disconnect(c);
 
@@ -558,38 +1079,91 @@ portunus_err_t grpc_client_connect(grpc_client_handle_t c)
     tls_cfg.non_block      = false;
     tls_cfg.skip_common_name = c->cfg.skip_cert_verify;
 
-    if (c->cfg.skip_cert_verify) {
-        /* Dev mode: accept any cert. */
-        tls_cfg.skip_common_name = true;
+    s_attach_client = c;
+    if (tls_profile_skips_certificates(&c->cfg.tls_profile)) {
+        /* PSK: the module's key authenticates the server. */
+        tls_cfg.crt_bundle_attach = transport_attach;
+    } else if (c->cfg.skip_cert_verify) {
+        /* Dev mode: accept any cert, but still offer only the profile. */
+        tls_cfg.skip_common_name  = true;
+        tls_cfg.crt_bundle_attach = transport_attach;
         ESP_LOGW(TAG, "TLS cert verification DISABLED (dev mode)");
-    } else if (c->cfg.ca_cert_pem != nullptr) {
-        /* LAN pinning: use embedded CA cert. */
-        tls_cfg.cacert_buf   = reinterpret_cast<const unsigned char *>(c->cfg.ca_cert_pem);
-        tls_cfg.cacert_bytes = strlen(c->cfg.ca_cert_pem) + 1;
     } else {
-        /* Public CA: validate against the ESP-IDF Mozilla CA bundle
-         * (covers Let's Encrypt, DigiCert, etc.). */
-        tls_cfg.crt_bundle_attach = esp_crt_bundle_attach;
+        /* LAN pinning (the CA chain parsed at init and/or the SPKI pin) or
+         * the ESP-IDF Mozilla CA bundle (Let's Encrypt, DigiCert, etc.),
+         * attached with the profile through the bundle hook. */
+        tls_cfg.crt_bundle_attach = transport_attach;
     }
 
     ESP_LOGI(TAG, "Connecting TLS+HTTP/2 to %s:%u ...", c->cfg.host, c->cfg.port);
 
+    /* ── TCP to the cached addresses; TLS on whichever answers first ──── */
+
+    int64_t start_us = esp_timer_get_time();
+    uint32_t addrs[DNS_CACHE_MAX_ADDRS];
+    size_t n_addrs = server_addrs(c, addrs, c->cfg.connect_timeout_ms);
+    if (n_addrs == 0) {
+        ESP_LOGE(TAG, "No address for %s (DNS unavailable)", c->cfg.host);
+        return PORTUNUS_ERR_HTTP_CONNECT;
+    }
+    int left_ms = c->cfg.connect_timeout_ms -
+                  static_cast<int>((esp_timer_get_time() - start_us) / 1000);
+    int sock_fd = race_connect(c, addrs, n_addrs, left_ms);
+    if (sock_fd < 0) {
+        ESP_LOGE(TAG, "TCP connect to %s:%u failed", c->cfg.host, c->cfg.port);
+        return PORTUNUS_ERR_HTTP_CONNECT;
+    }
+
+    /* esp-tls would have bounded its own TCP connect and handshake with
+     * timeout_ms; the handshake gets what the connect left of it. */
+    left_ms = c->cfg.connect_timeout_ms -
+              static_cast<int>((esp_timer_get_time() - start_us) / 1000);
+    if (left_ms < 1) {
+        left_ms = 1;
+    }
+    struct timeval hs_tv = {};
+    hs_tv.tv_sec  = left_ms / 1000;
+    hs_tv.tv_usec = (left_ms % 1000) * 1000;
+    setsockopt(sock_fd, SOL_SOCKET, SO_RCVTIMEO, &hs_tv, sizeof(hs_tv));
+    setsockopt(sock_fd, SOL_SOCKET, SO_SNDTIMEO, &hs_tv, sizeof(hs_tv));
+
     c->tls = esp_tls_init();
     if (c->tls == nullptr) {
         ESP_LOGE(TAG, "esp_tls_init failed");
+        close(sock_fd);
+        return PORTUNUS_ERR_HTTP_CONNECT;
+    }
+    if (esp_tls_set_conn_sockfd(c->tls, sock_fd) != ESP_OK ||
+        esp_tls_set_conn_state(c->tls, ESP_TLS_CONNECTING) != ESP_OK) {
+        ESP_LOGE(TAG, "Could not hand the socket to esp-tls");
+        close(sock_fd);
+        esp_tls_conn_destroy(c->tls);
+        c->tls = nullptr;
         return PORTUNUS_ERR_HTTP_CONNECT;
     }
 
+    /* The socket is already connected, so this is the TLS handshake only;
+     * host still names the server for SNI and certificate verification. */
+    int64_t hs_start_us = esp_timer_get_time();
     int rv = esp_tls_conn_new_sync(c->cfg.host, strlen(c->cfg.host),
                                     c->cfg.port, &tls_cfg, c->tls);
     if (rv < 0) {
         ESP_LOGE(TAG, "TLS connection failed (rv=%d)", rv);
+        c->tls_failures++;
         esp_tls_conn_destroy(c->tls);
         c->tls = nullptr;
         return PORTUNUS_ERR_HTTP_CONNECT;
     }
+    c->tls_handshake_ms = static_cast<uint32_t>((esp_timer_get_time() - hs_start_us) / 1000);
 
-    ESP_LOGI(TAG, "TLS connected, setting up HTTP/2 session");
+    {
+        auto *ssl = static_cast<mbedtls_ssl_context *>(esp_tls_get_ssl_context(c->tls));
+        ESP_LOGI(TAG, "TLS connected in %u ms (%s, %s, profile %s), setting up HTTP/2 session",
+                 (unsigned)c->tls_handshake_ms,
+                 ssl != nullptr ? mbedtls_ssl_get_version(ssl) : "?",
+                 ssl != nullptr ? mbedtls_ssl_get_ciphersuite(ssl) : "?",
+                 tls_profile_name(&c->cfg.tls_profile));
+    }
 
     /* ── Set a short read timeout on the underlying socket ────────────── */
     /* Without this, esp_tls_conn_read() blocks indefinitely when no data
@@ -599,12 +1173,12 @@ portunus_err_t grpc_client_connect(grpc_client_handle_t c)
      * NGHTTP2_ERR_WOULDBLOCK, allowing the pump to loop, send pending
      * frames (e.g. WINDOW_UPDATE), and retry the read. */
     {
-        int sock_fd = -1;
-        if (esp_tls_get_conn_sockfd(c->tls, &sock_fd) == ESP_OK && sock_fd >= 0) {
+        int tls_fd = -1;
+        if (esp_tls_get_conn_sockfd(c->tls, &tls_fd) == ESP_OK && tls_fd >= 0) {
             struct timeval tv = {};
             tv.tv_sec  = 0;
             tv.tv_usec = 100000; /* 100 ms */
-            setsockopt(sock_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+            setsockopt(tls_fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
         } else {
             ESP_LOGW(TAG, "Could not set socket read timeout — pump may block");
         }
@@ -630,8 +1204,7 @@ portunus_err_t grpc_client_connect(grpc_client_handle_t c)
                                   settings, 2);
     if (rv != 0) {
         ESP_LOGE(TAG, "nghttp2_submit_settings failed: %s", nghttp2_strerror(rv));
-        nghttp2_session_del(c->session);
-        c->session = nullptr;
+        destroy_nghttp2_session(c);
         esp_tls_conn_destroy(c->tls);
         c->tls = nullptr;
         return PORTUNUS_ERR_HTTP_CONNECT;
@@ -639,17 +1212,17 @@ portunus_err_t grpc_client_connect(grpc_client_handle_t c)
 
     /* Pump to exchange SETTINGS — reset the flag so pump_session knows to wait. */
     c->settings_received = false;
-    err = pump_session(c, nullptr);
+    err = pump_session(c, nullptr, c->cfg.rpc_timeout_ms);
     if (err != PORTUNUS_OK) {
         ESP_LOGE(TAG, "HTTP/2 SETTINGS exchange failed");
-        nghttp2_session_del(c->session);
-        c->session = nullptr;
+        destroy_nghttp2_session(c);
         esp_tls_conn_destroy(c->tls);
         c->tls = nullptr;
         return err;
     }
 
     c->connected = true;
+    c->connects++;
     ESP_LOGI(TAG, "HTTP/2 connection established to %s:%u", c->cfg.host, c->cfg.port);
     return PORTUNUS_OK;
 }
@@ -658,10 +1231,7 @@ void grpc_client_disconnect(grpc_client_handle_t c)
 {
     if (c == nullptr) { return; }
 
-    if (c->session != nullptr) {
-        nghttp2_session_del(c->session);
-        c->session = nullptr;
-    }
+    destroy_nghttp2_session(c);
 
     if (c->tls != nullptr) {
         esp_tls_conn_destroy(c->tls);
@@ -669,6 +1239,7 @@ void grpc_client_disconnect(grpc_client_handle_t c)
     }
 
     c->connected = false;
+    c->ping_outstanding = false;
     memset(c->metadata, 0, sizeof(c->metadata));
 }
 
@@ -719,6 +1290,7 @@ portunus_err_t grpc_client_send_ping(grpc_client_handle_t c)
     if (c == nullptr || !c->connected) {
         return PORTUNUS_ERR_INVALID_ARG;
     }
+    dns_refresh(c);
 
     static const uint8_t opaque[8] = {'P','O','R','T','U','N','U','S'};
     int rv = nghttp2_submit_ping(c->session, NGHTTP2_FLAG_NONE, opaque);
@@ -728,13 +1300,33 @@ portunus_err_t grpc_client_send_ping(grpc_client_handle_t c)
         return PORTUNUS_ERR_HTTP_CONNECT;
     }
 
-    portunus_err_t err = pump_session(c, nullptr);
+    int timeout_ms = ping_timeout_ms(c);
+    c->ping_outstanding = true;
+    c->ping_sent_us     = esp_timer_get_time();
+
+    portunus_err_t err = pump_session(c, nullptr, timeout_ms);
     if (err != PORTUNUS_OK) {
-        c->connected = false;
+        if (err == PORTUNUS_ERR_TIMEOUT) {
+            rtt_estimator_timeout(&c->ping_rtt);
+        }
+        /* Half-open or gone: drop it now so the next RPC starts on a fresh
+           connection instead of finding out the hard way. */
+        ESP_LOGW(TAG, "Keepalive PING failed (0x%04x, waited up to %d ms) — closing connection",
+                 (unsigned)err, timeout_ms);
+        c->dead_links++;
+        grpc_client_disconnect(c);
+        spread_reconnect(c);
     }
     return err;
 }
 
+void grpc_client_set_call_timeout(grpc_client_handle_t c, int timeout_ms)
+{
+    if (c != nullptr) {
+        c->next_call_timeout_ms = (timeout_ms > 0) ? timeout_ms : 0;
+    }
+}
+
 portunus_err_t grpc_client_unary_call(grpc_client_handle_t c,
                                        const char *service_method,
                                        const uint8_t *req_buf, size_t req_len,
@@ -749,6 +1341,16 @@ portunus_err_t grpc_client_unary_call(grpc_client_handle_t c,
 
     *resp_len = 0;
     *grpc_status = GRPC_STATUS_UNKNOWN;
+    dns_refresh(c);
+
+    int budget_ms = call_timeout_ms(c);
+    if (c->next_call_timeout_ms > 0) {
+        budget_ms = (c->next_call_timeout_ms < c->cfg.rpc_timeout_ms)
+                    ? c->next_call_timeout_ms : c->cfg.rpc_timeout_ms;
+    }
+    bool adaptive_budget = (budget_ms >= call_timeout_ms(c));
+    c->next_call_timeout_ms = 0;
+    int64_t call_start_us = esp_timer_get_time();
 
     /* ── Ensure connection ─────────────────────────────────────────────── */
 
@@ -759,13 +1361,20 @@ portunus_err_t grpc_client_unary_call(grpc_client_handle_t c,
         }
     }
 
+    /* A reconnect may have used up the caller's budget. */
+    budget_ms -= static_cast<int>((esp_timer_get_time() - call_start_us) / 1000);
+    if (budget_ms <= 0) {
+        ESP_LOGW(TAG, "Call budget spent before %s was sent", service_method);
+        return PORTUNUS_ERR_TIMEOUT;
+    }
+
     /* ── Build gRPC frame (5-byte prefix + protobuf) ───────────────────── */
 
     if (req_len > GRPC_MAX_REQUEST_PAYLOAD) {
         ESP_LOGE(TAG, "Request payload too large: %zu > %zu", req_len, GRPC_MAX_REQUEST_PAYLOAD);
         return PORTUNUS_ERR_PROTO_ENCODE;
     }
-    uint8_t grpc_frame[GRPC_FRAME_HEADER_LEN + GRPC_MAX_REQUEST_PAYLOAD];
+    uint8_t *grpc_frame = c->req_frame;
     size_t grpc_frame_len = GRPC_FRAME_HEADER_LEN + req_len;
 
     size_t encoded_len = 0;
@@ -775,14 +1384,19 @@ portunus_err_t grpc_client_unary_call(grpc_client_handle_t c,
 
     /* ── Build HTTP/2 headers ──────────────────────────────────────────── */
 
-    /* Base headers: :method, :scheme, :path, content-type, te */
-    static constexpr size_t BASE_HDR_COUNT = 5;
+    /* grpc-timeout: at most 8 ASCII digits followed by a unit; "m" = ms. */
+    char timeout_hdr[16];
+    snprintf(timeout_hdr, sizeof(timeout_hdr), "%dm", budget_ms);
+
+    /* Base headers: :method, :scheme, :path, content-type, te, grpc-timeout */
+    static constexpr size_t BASE_HDR_COUNT = 6;
     nghttp2_nv base_hdrs[BASE_HDR_COUNT] = {
         make_nv(":method",      "POST"),
         make_nv(":scheme",      "https"),
         make_nv(":path",        service_method),
         make_nv("content-type", "application/grpc"),
         make_nv("te",           "trailers"),
+        make_nv("grpc-timeout", timeout_hdr),
     };
 
     /* Count active custom metadata. */
@@ -845,9 +1459,15 @@ portunus_err_t grpc_client_unary_call(grpc_client_handle_t c,
 
     /* ── Pump until stream completes ───────────────────────────────────── */
 
-    portunus_err_t err = pump_session(c, &ss);
+    int64_t sent_us = esp_timer_get_time();
+    portunus_err_t err = pump_session(c, &ss, budget_ms);
 
     if (err != PORTUNUS_OK) {
+        /* Only a wait at least as long as the estimate says anything about
+           the link; a caller's shorter budget running out does not. */
+        if (err == PORTUNUS_ERR_TIMEOUT && adaptive_budget) {
+            rtt_estimator_timeout(&c->call_rtt);
+        }
         return err;
     }
 
@@ -859,6 +1479,9 @@ portunus_err_t grpc_client_unary_call(grpc_client_handle_t c,
         return PORTUNUS_ERR_HTTP_CONNECT;
     }
 
+    rtt_estimator_sample(&c->call_rtt,
+                         static_cast<uint32_t>((esp_timer_get_time() - sent_us) / 1000));
+
     /* ── Parse the gRPC response ───────────────────────────────────────── */
 
     if (ss.grpc_status < 0) {
@@ -879,7 +1502,8 @@ portunus_err_t grpc_client_unary_call(grpc_client_handle_t c,
             memmove(resp_buf, proto_ptr, proto_len);
             *resp_len = static_cast<int>(proto_len);
         } else {
-            ESP_LOGW(TAG, "Failed to decode gRPC response frame");
+            ESP_LOGW(TAG, "Failed to decode gRPC response frame (flag=0x%02x, %zu bytes)",
+                     resp_buf[0], ss.resp_len);
             *resp_len = 0;
             return PORTUNUS_ERR_PROTO_DECODE;
         }
@@ -904,4 +1528,39 @@ portunus_err_t grpc_client_unary_call(grpc_client_handle_t c,
     }
 
     return PORTUNUS_OK;
-}
\ No newline at end of file
+}
+
+portunus_err_t grpc_client_get_arena_stats(grpc_client_handle_t c,
+                                            session_arena_stats_t *out)
+{
+    if (c == nullptr || out == nullptr) { return PORTUNUS_ERR_INVALID_ARG; }
+
+    session_arena_get_stats(&c->arena, out);
+    return PORTUNUS_OK;
+}
+
+portunus_err_t grpc_client_get_link_stats(grpc_client_handle_t c,
+                                           grpc_link_stats_t *out)
+{
+    if (c == nullptr || out == nullptr) { return PORTUNUS_ERR_INVALID_ARG; }
+
+    out->ping_p50_ms     = rtt_estimator_percentile(&c->ping_rtt, 50);
+    out->ping_p90_ms     = rtt_estimator_percentile(&c->ping_rtt, 90);
+    out->ping_p99_ms     = rtt_estimator_percentile(&c->ping_rtt, 99);
+    out->call_srtt_ms    = rtt_estimator_srtt_ms(&c->call_rtt);
+    out->call_timeout_ms = static_cast<uint32_t>(call_timeout_ms(c));
+    out->dead_links      = c->dead_links;
+    out->connects        = c->connects;
+    out->failed_connects = c->failed_connects;
+
+    portENTER_CRITICAL(&s_dns_lock);
+    out->dns_resolves    = c->dns.stats.resolves;
+    out->dns_failures    = c->dns.stats.failures;
+    out->dns_stale_uses  = c->dns.stats.stale_uses;
+    out->dns_resolve_ms  = c->dns.stats.last_resolve_ms;
+    portEXIT_CRITICAL(&s_dns_lock);
+    out->tls_pin_mismatches = c->trust.pin_mismatches;
+    out->tls_handshake_ms   = c->tls_handshake_ms;
+    out->tls_failures       = c->tls_failures;
+    return PORTUNUS_OK;
+}
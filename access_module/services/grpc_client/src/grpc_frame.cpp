@@ -0,0 +1,50 @@
+/**
+ * @file grpc_frame.cpp
+ * @brief gRPC length-prefixed message framing — implementation.
+ */
+
+#include "grpc_frame.hpp"
+
+#include <string.h>
+
+bool grpc_frame_encode(const uint8_t *proto_buf, size_t proto_len,
+                       uint8_t *out_buf, size_t out_cap, size_t *out_len)
+{
+    size_t total = GRPC_FRAME_HEADER_LEN + proto_len;
+    if (total > out_cap || proto_len > UINT32_MAX) {
+        return false;
+    }
+
+    out_buf[0] = 0x00; /* No compression */
+    out_buf[1] = (uint8_t)(proto_len >> 24);
+    out_buf[2] = (uint8_t)(proto_len >> 16);
+    out_buf[3] = (uint8_t)(proto_len >> 8);
+    out_buf[4] = (uint8_t)proto_len;
+    memcpy(&out_buf[GRPC_FRAME_HEADER_LEN], proto_buf, proto_len);
+
+    *out_len = total;
+    return true;
+}
+
+bool grpc_frame_decode(const uint8_t *frame_buf, size_t frame_len,
+                       const uint8_t **proto_buf, size_t *proto_len)
+{
+    if (frame_len < GRPC_FRAME_HEADER_LEN) {
+        return false;
+    }
+
+    /* Byte 0: compression flag (we only support uncompressed). */
+    if (frame_buf[0] != 0x00) {
+        return false;
+    }
+
+    uint32_t msg_len = (uint32_t)frame_buf[1] << 24 | (uint32_t)frame_buf[2] << 16 |
+                       (uint32_t)frame_buf[3] << 8 | frame_buf[4];
+    if (msg_len > frame_len - GRPC_FRAME_HEADER_LEN) {
+        return false;
+    }
+
+    *proto_buf = &frame_buf[GRPC_FRAME_HEADER_LEN];
+    *proto_len = (size_t)msg_len;
+    return true;
+}
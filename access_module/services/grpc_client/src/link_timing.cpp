@@ -0,0 +1,143 @@
+/**
+ * @file link_timing.cpp
+ * @brief RTT estimation and keepalive pacing — implementation.
+ */
+
+#include "link_timing.hpp"
+
+#include <string.h>
+
+/* ── RTT estimator ─────────────────────────────────────────────────────────── */
+
+void rtt_estimator_init(rtt_estimator_t *e, uint32_t min_rto_ms, uint32_t max_rto_ms)
+{
+    memset(e, 0, sizeof(*e));
+    e->min_rto_ms = min_rto_ms;
+    e->max_rto_ms = (max_rto_ms < min_rto_ms) ? min_rto_ms : max_rto_ms;
+}
+
+void rtt_estimator_sample(rtt_estimator_t *e, uint32_t rtt_ms)
+{
+    if (e->samples == 0) {
+        e->srtt_x8   = rtt_ms << 3;
+        e->rttvar_x4 = rtt_ms << 1;             /* RTTVAR = R/2 */
+    } else {
+        int32_t delta = (int32_t)rtt_ms - (int32_t)(e->srtt_x8 >> 3);
+        e->srtt_x8 = (uint32_t)((int32_t)e->srtt_x8 + delta);   /* += delta/8 */
+        int32_t mag = (delta < 0) ? -delta : delta;
+        e->rttvar_x4 = (uint32_t)((int32_t)e->rttvar_x4 + mag - (int32_t)(e->rttvar_x4 >> 2));
+    }
+    e->samples++;
+    e->backoff = 0;
+
+    e->window[e->head] = (rtt_ms > UINT16_MAX) ? UINT16_MAX : (uint16_t)rtt_ms;
+    e->head = (uint8_t)((e->head + 1) % RTT_WINDOW);
+}
+
+void rtt_estimator_timeout(rtt_estimator_t *e)
+{
+    if (e->backoff < 16) {
+        e->backoff++;
+    }
+}
+
+uint32_t rtt_estimator_rto_ms(const rtt_estimator_t *e)
+{
+    if (e->samples == 0) {
+        return e->max_rto_ms;
+    }
+    /* SRTT + 4·RTTVAR; rttvar_x4 already is 4·RTTVAR. */
+    uint64_t rto = (uint64_t)(e->srtt_x8 >> 3) + e->rttvar_x4;
+    rto <<= e->backoff;
+    if (rto < e->min_rto_ms) {
+        rto = e->min_rto_ms;
+    }
+    if (rto > e->max_rto_ms) {
+        rto = e->max_rto_ms;
+    }
+    return (uint32_t)rto;
+}
+
+uint32_t rtt_estimator_srtt_ms(const rtt_estimator_t *e)
+{
+    return e->srtt_x8 >> 3;
+}
+
+uint32_t rtt_estimator_percentile(const rtt_estimator_t *e, uint8_t pct)
+{
+    uint32_t n = (e->samples < RTT_WINDOW) ? e->samples : RTT_WINDOW;
+    if (n == 0) {
+        return 0;
+    }
+
+    uint16_t sorted[RTT_WINDOW];
+    for (uint32_t i = 0; i < n; i++) {
+        uint16_t v = e->window[i];
+        uint32_t j = i;
+        while (j > 0 && sorted[j - 1] > v) {
+            sorted[j] = sorted[j - 1];
+            j--;
+        }
+        sorted[j] = v;
+    }
+
+    if (pct == 0) {
+        pct = 1;
+    } else if (pct > 100) {
+        pct = 100;
+    }
+    uint32_t rank = (pct * n + 99) / 100;    /* ceil(pct/100 · n), 1-based */
+    return sorted[rank - 1];
+}
+
+/* ── Keepalive pacing ──────────────────────────────────────────────────────── */
+
+static uint32_t clamp_interval(const keepalive_t *k, uint32_t ms)
+{
+    if (ms > k->max_ms) {
+        ms = k->max_ms;
+    }
+    if (ms < k->min_ms) {
+        ms = k->min_ms;
+    }
+    return ms;
+}
+
+void keepalive_init(keepalive_t *k, uint32_t min_ms, uint32_t max_ms, uint32_t initial_ms)
+{
+    memset(k, 0, sizeof(*k));
+    k->min_ms = min_ms;
+    k->max_ms = (max_ms < min_ms) ? min_ms : max_ms;
+    k->interval_ms = clamp_interval(k, initial_ms);
+}
+
+void keepalive_on_ack(keepalive_t *k)
+{
+    if (++k->streak < KEEPALIVE_GROW_STREAK) {
+        return;
+    }
+    k->streak = 0;
+
+    uint32_t next = k->interval_ms + k->interval_ms / 2;
+    /* Stay a quarter below the idle spell that already killed the link. */
+    if (k->ceiling_ms != 0 && next > k->ceiling_ms - k->ceiling_ms / 4) {
+        next = k->ceiling_ms - k->ceiling_ms / 4;
+    }
+    if (next > k->interval_ms) {
+        k->interval_ms = clamp_interval(k, next);
+    }
+}
+
+void keepalive_on_dead(keepalive_t *k, uint32_t idle_ms)
+{
+    k->streak = 0;
+    if (k->ceiling_ms == 0 || idle_ms < k->ceiling_ms) {
+        k->ceiling_ms = idle_ms;
+    }
+    k->interval_ms = clamp_interval(k, idle_ms / 2);
+}
+
+bool keepalive_due(const keepalive_t *k, uint32_t idle_ms)
+{
+    return idle_ms >= k->interval_ms;
+}
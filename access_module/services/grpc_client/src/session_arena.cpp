@@ -0,0 +1,283 @@
+/**
+ * @file session_arena.cpp
+ * @brief Bump/pool allocator dedicated to one nghttp2 session — implementation.
+ */
+
+#include "session_arena.hpp"
+
+#include <cstdlib>
+#include <cstring>
+
+/* ── Block layout ──────────────────────────────────────────────────────────── */
+
+/** Precedes every block (arena and heap fallback alike).  8 bytes on both the
+ *  ESP32 and 64-bit hosts, so payloads stay 8-byte aligned. */
+struct alignas(8) block_hdr_t {
+    uint32_t size;      /**< Payload capacity in bytes. */
+    uint32_t reserved;
+};
+
+/** Free blocks store the list link in their payload. */
+struct free_node_t {
+    free_node_t *next;
+};
+
+static constexpr size_t HDR_LEN        = sizeof(block_hdr_t);
+static constexpr size_t MIN_CLASS_SIZE = 16;
+static constexpr size_t MAX_CLASS_SIZE = MIN_CLASS_SIZE << (SESSION_ARENA_NUM_CLASSES - 1);
+
+static_assert(sizeof(block_hdr_t) == 8, "block header must stay 8 bytes");
+static_assert(sizeof(free_node_t) <= MIN_CLASS_SIZE, "free link must fit the smallest class");
+
+static size_t round_up8(size_t n)
+{
+    return (n + 7u) & ~static_cast<size_t>(7u);
+}
+
+/** Size class for @p n, or -1 for large blocks. */
+static int class_index(size_t n)
+{
+    if (n > MAX_CLASS_SIZE) {
+        return -1;
+    }
+    int idx = 0;
+    size_t sz = MIN_CLASS_SIZE;
+    while (sz < n) {
+        sz <<= 1;
+        idx++;
+    }
+    return idx;
+}
+
+static size_t class_size(int idx)
+{
+    return MIN_CLASS_SIZE << idx;
+}
+
+static block_hdr_t *hdr_of(void *ptr)
+{
+    return reinterpret_cast<block_hdr_t *>(static_cast<uint8_t *>(ptr) - HDR_LEN);
+}
+
+static bool owns(const session_arena_t *a, const void *ptr)
+{
+    auto *p = static_cast<const uint8_t *>(ptr);
+    return a->base != nullptr && p >= a->base && p < a->base + a->capacity;
+}
+
+/* ── Internal allocation paths ─────────────────────────────────────────────── */
+
+static void *bump_alloc(session_arena_t *a, size_t payload)
+{
+    size_t need = HDR_LEN + payload;
+    if (a->capacity - a->bump < need) {
+        return nullptr;
+    }
+
+    auto *hdr = reinterpret_cast<block_hdr_t *>(a->base + a->bump);
+    hdr->size     = static_cast<uint32_t>(payload);
+    hdr->reserved = 0;
+
+    a->bump   += need;
+    a->in_use += need;
+    if (a->bump > a->peak) {
+        a->peak = a->bump;
+    }
+    return reinterpret_cast<uint8_t *>(hdr) + HDR_LEN;
+}
+
+static void *heap_alloc(session_arena_t *a, size_t size)
+{
+    auto *hdr = static_cast<block_hdr_t *>(malloc(HDR_LEN + size));
+    if (hdr == nullptr) {
+        return nullptr;
+    }
+    hdr->size     = static_cast<uint32_t>(size);
+    hdr->reserved = 0;
+
+    a->heap_fallbacks++;
+    a->heap_live++;
+    return reinterpret_cast<uint8_t *>(hdr) + HDR_LEN;
+}
+
+/** First-fit search of the large free list; unlinks and returns the block. */
+static void *take_large(session_arena_t *a, size_t payload)
+{
+    auto **link = reinterpret_cast<free_node_t **>(&a->free_large);
+    while (*link != nullptr) {
+        free_node_t *node = *link;
+        if (hdr_of(node)->size >= payload) {
+            *link = node->next;
+            a->in_use += HDR_LEN + hdr_of(node)->size;
+            return node;
+        }
+        link = &node->next;
+    }
+    return nullptr;
+}
+
+/* ── Public API ────────────────────────────────────────────────────────────── */
+
+void session_arena_init(session_arena_t *a, void *buf, size_t capacity)
+{
+    memset(a, 0, sizeof(*a));
+    a->base     = static_cast<uint8_t *>(buf);
+    a->capacity = (buf != nullptr) ? capacity : 0;
+}
+
+void *session_arena_alloc(session_arena_t *a, size_t size)
+{
+    if (size == 0) {
+        size = 1;
+    }
+
+    int idx = class_index(size);
+    size_t payload;
+
+    if (idx >= 0) {
+        auto *node = static_cast<free_node_t *>(a->free_small[idx]);
+        if (node != nullptr) {
+            a->free_small[idx] = node->next;
+            a->in_use += HDR_LEN + class_size(idx);
+            return node;
+        }
+        payload = class_size(idx);
+    } else {
+        payload = round_up8(size);
+        void *p = take_large(a, payload);
+        if (p != nullptr) {
+            return p;
+        }
+    }
+
+    void *p = bump_alloc(a, payload);
+    if (p != nullptr) {
+        return p;
+    }
+    return heap_alloc(a, size);
+}
+
+void *session_arena_calloc(session_arena_t *a, size_t nmemb, size_t size)
+{
+    if (size != 0 && nmemb > SIZE_MAX / size) {
+        return nullptr;
+    }
+    size_t total = nmemb * size;
+    void *p = session_arena_alloc(a, total);
+    if (p != nullptr) {
+        memset(p, 0, total);
+    }
+    return p;
+}
+
+void *session_arena_realloc(session_arena_t *a, void *ptr, size_t size)
+{
+    if (ptr == nullptr) {
+        return session_arena_alloc(a, size);
+    }
+    if (size == 0) {
+        session_arena_free(a, ptr);
+        return nullptr;
+    }
+
+    block_hdr_t *hdr = hdr_of(ptr);
+    size_t old = hdr->size;
+    if (size <= old) {
+        return ptr;
+    }
+
+    /* The most recently bumped block can grow in place. */
+    if (owns(a, ptr) && static_cast<uint8_t *>(ptr) + old == a->base + a->bump) {
+        size_t grow = round_up8(size) - old;
+        if (a->capacity - a->bump >= grow) {
+            hdr->size  = static_cast<uint32_t>(old + grow);
+            a->bump   += grow;
+            a->in_use += grow;
+            if (a->bump > a->peak) {
+                a->peak = a->bump;
+            }
+            return ptr;
+        }
+    }
+
+    void *p = session_arena_alloc(a, size);
+    if (p == nullptr) {
+        return nullptr;
+    }
+    memcpy(p, ptr, old);
+    session_arena_free(a, ptr);
+    return p;
+}
+
+void session_arena_free(session_arena_t *a, void *ptr)
+{
+    if (ptr == nullptr) {
+        return;
+    }
+
+    block_hdr_t *hdr = hdr_of(ptr);
+
+    if (!owns(a, ptr)) {
+        a->heap_live--;
+        free(hdr);
+        return;
+    }
+
+    size_t size = hdr->size;
+    a->in_use -= HDR_LEN + size;
+
+    /* Top-of-arena block: give it straight back to the bump region. */
+    if (static_cast<uint8_t *>(ptr) + size == a->base + a->bump) {
+        a->bump -= HDR_LEN + size;
+        return;
+    }
+
+    auto *node = static_cast<free_node_t *>(ptr);
+    int idx = class_index(size);
+    if (idx >= 0 && class_size(idx) == size) {
+        node->next = static_cast<free_node_t *>(a->free_small[idx]);
+        a->free_small[idx] = node;
+    } else {
+        node->next = static_cast<free_node_t *>(a->free_large);
+        a->free_large = node;
+    }
+}
+
+void session_arena_reset(session_arena_t *a)
+{
+    a->bump       = 0;
+    a->in_use     = 0;
+    a->free_large = nullptr;
+    memset(a->free_small, 0, sizeof(a->free_small));
+    a->resets++;
+}
+
+void session_arena_get_stats(const session_arena_t *a, session_arena_stats_t *out)
+{
+    size_t largest = 0;
+    if (a->capacity - a->bump > HDR_LEN) {
+        largest = a->capacity - a->bump - HDR_LEN;
+    }
+
+    for (int i = SESSION_ARENA_NUM_CLASSES - 1; i >= 0; i--) {
+        if (a->free_small[i] != nullptr) {
+            if (class_size(i) > largest) {
+                largest = class_size(i);
+            }
+            break;
+        }
+    }
+    for (auto *n = static_cast<const free_node_t *>(a->free_large); n != nullptr; n = n->next) {
+        size_t sz = hdr_of(const_cast<free_node_t *>(n))->size;
+        if (sz > largest) {
+            largest = sz;
+        }
+    }
+
+    out->capacity       = a->capacity;
+    out->in_use         = a->in_use;
+    out->peak           = a->peak;
+    out->largest_free   = largest;
+    out->heap_fallbacks = a->heap_fallbacks;
+    out->resets         = a->resets;
+}
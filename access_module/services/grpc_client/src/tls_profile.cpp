@@ -0,0 +1,107 @@
+/**
+ * @file tls_profile.cpp
+ * @brief Transport profiles — implementation.
+ */
+
+#include "tls_profile.hpp"
+
+#include "mbedtls/x509_crt.h"
+
+#include <string.h>
+
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+/* One AEAD: the S3 has AES in hardware, and every TLS 1.3 server has it. */
+static const int k_tls13_suites[] = {
+    MBEDTLS_TLS1_3_AES_128_GCM_SHA256,
+    0,
+};
+#endif
+
+/* X25519 first: one scalar multiplication each way, cheapest in software. */
+static const uint16_t k_ecc_groups[] = {
+    MBEDTLS_SSL_IANA_TLS_GROUP_X25519,
+    MBEDTLS_SSL_IANA_TLS_GROUP_SECP256R1,
+    MBEDTLS_SSL_IANA_TLS_GROUP_NONE,
+};
+
+static const uint16_t k_ecc_sig_algs[] = {
+    MBEDTLS_TLS1_3_SIG_ECDSA_SECP256R1_SHA256,
+    MBEDTLS_TLS1_3_SIG_NONE,
+};
+
+bool tls_profile_valid(const tls_profile_t *p)
+{
+    switch (p->id) {
+    case TLS_PROFILE_COMPAT:
+    case TLS_PROFILE_ECC:
+        return true;
+    case TLS_PROFILE_PSK:
+        return p->psk != NULL && p->psk_len > 0 && p->psk_len <= TLS_PROFILE_PSK_MAX_LEN &&
+               p->psk_identity != NULL && p->psk_identity[0] != '\0';
+    }
+    return false;
+}
+
+bool tls_profile_skips_certificates(const tls_profile_t *p)
+{
+    return p->id == TLS_PROFILE_PSK;
+}
+
+int tls_profile_apply(const tls_profile_t *p, mbedtls_ssl_config *conf)
+{
+    if (!tls_profile_valid(p)) {
+        return MBEDTLS_ERR_SSL_BAD_INPUT_DATA;
+    }
+    if (p->id == TLS_PROFILE_COMPAT) {
+        return 0;
+    }
+
+#if defined(MBEDTLS_SSL_PROTO_TLS1_3)
+    mbedtls_ssl_conf_min_tls_version(conf, MBEDTLS_SSL_VERSION_TLS1_3);
+    mbedtls_ssl_conf_max_tls_version(conf, MBEDTLS_SSL_VERSION_TLS1_3);
+    mbedtls_ssl_conf_ciphersuites(conf, k_tls13_suites);
+    mbedtls_ssl_conf_groups(conf, k_ecc_groups);
+
+    if (p->id == TLS_PROFILE_ECC) {
+        mbedtls_ssl_conf_sig_algs(conf, k_ecc_sig_algs);
+        mbedtls_ssl_conf_cert_profile(conf, &mbedtls_x509_crt_profile_suiteb);
+        mbedtls_ssl_conf_tls13_key_exchange_modes(
+            conf, MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_EPHEMERAL);
+        return 0;
+    }
+
+    /* PSK: only PSK modes are offered, so a server cannot fall back to a
+       certificate handshake. */
+    int modes = 0;
+  #if defined(MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_PSK_ENABLED)
+    if (!p->psk_dhe) {
+        modes = MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_PSK;
+    }
+  #endif
+  #if defined(MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_PSK_EPHEMERAL_ENABLED)
+    if (p->psk_dhe) {
+        modes = MBEDTLS_SSL_TLS1_3_KEY_EXCHANGE_MODE_PSK_EPHEMERAL;
+    }
+  #endif
+    if (modes == 0) {
+        return MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+    }
+    mbedtls_ssl_conf_tls13_key_exchange_modes(conf, modes);
+    return mbedtls_ssl_conf_psk(conf, p->psk, p->psk_len,
+                                reinterpret_cast<const unsigned char *>(p->psk_identity),
+                                strlen(p->psk_identity));
+#else
+    (void)conf;
+    return MBEDTLS_ERR_SSL_FEATURE_UNAVAILABLE;
+#endif
+}
+
+const char *tls_profile_name(const tls_profile_t *p)
+{
+    switch (p->id) {
+    case TLS_PROFILE_COMPAT: return "compat";
+    case TLS_PROFILE_ECC:    return "ecc";
+    case TLS_PROFILE_PSK:    return p->psk_dhe ? "psk_dhe" : "psk";
+    }
+    return "?";
+}
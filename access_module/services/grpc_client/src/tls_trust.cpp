@@ -0,0 +1,118 @@
+/**
+ * @file tls_trust.cpp
+ * @brief Server trust anchors parsed once — implementation.
+ */
+
+#include "tls_trust.hpp"
+
+#include "mbedtls/sha256.h"
+
+#include <string.h>
+
+bool tls_trust_init(tls_trust_t *t, const uint8_t *ca_der, size_t ca_der_len,
+                    const uint8_t *spki_pin)
+{
+    memset(t, 0, sizeof(*t));
+    mbedtls_x509_crt_init(&t->chain);
+    mbedtls_x509_crt_init(&t->no_chain);
+
+    if (ca_der != NULL && ca_der_len > 0) {
+        if (mbedtls_x509_crt_parse_der_nocopy(&t->chain, ca_der, ca_der_len) != 0) {
+            mbedtls_x509_crt_free(&t->chain);
+            mbedtls_x509_crt_init(&t->chain);
+            return false;
+        }
+        t->has_chain = true;
+    }
+    if (spki_pin != NULL) {
+        memcpy(t->pin, spki_pin, TLS_TRUST_PIN_LEN);
+        t->has_pin = true;
+    }
+    return true;
+}
+
+void tls_trust_free(tls_trust_t *t)
+{
+    mbedtls_x509_crt_free(&t->chain);
+    mbedtls_x509_crt_free(&t->no_chain);
+    t->has_chain = false;
+    t->has_pin   = false;
+}
+
+bool tls_trust_configured(const tls_trust_t *t)
+{
+    return t->has_chain || t->has_pin;
+}
+
+void tls_trust_attach(tls_trust_t *t, mbedtls_ssl_config *conf)
+{
+    mbedtls_ssl_conf_authmode(conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+    if (t->has_pin) {
+        /* mbedtls wants a CA chain with REQUIRED; an empty one finds no
+           parent, so no signature is checked, and the callback clears the
+           NOT_TRUSTED that leaves.  A mismatch fails the handshake. */
+        mbedtls_ssl_conf_ca_chain(conf, &t->no_chain, NULL);
+        mbedtls_ssl_conf_verify(conf, tls_trust_verify, t);
+        return;
+    }
+    if (t->has_chain) {
+        mbedtls_ssl_conf_ca_chain(conf, &t->chain, NULL);
+    }
+}
+
+int tls_trust_verify(void *ctx, mbedtls_x509_crt *crt, int depth, uint32_t *flags)
+{
+    auto *t = static_cast<tls_trust_t *>(ctx);
+    if (depth > 0) {
+        *flags = 0;                     /* the leaf's key is the anchor */
+        return 0;
+    }
+
+    uint8_t h[TLS_TRUST_PIN_LEN];
+    if (!tls_trust_spki_sha256(crt, h) || memcmp(h, t->pin, sizeof(h)) != 0) {
+        t->pin_mismatches++;
+        return MBEDTLS_ERR_X509_FATAL_ERROR;
+    }
+    *flags = 0;
+    return 0;
+}
+
+bool tls_trust_spki_sha256(const mbedtls_x509_crt *crt, uint8_t out[TLS_TRUST_PIN_LEN])
+{
+    /* pk_raw is the certificate's own SubjectPublicKeyInfo bytes. */
+    const mbedtls_x509_buf *spki = &crt->MBEDTLS_PRIVATE(pk_raw);
+    return mbedtls_sha256(spki->p, spki->len, out, 0) == 0;
+}
+
+static int hex_nibble(char c)
+{
+    if (c >= '0' && c <= '9') { return c - '0'; }
+    if (c >= 'a' && c <= 'f') { return c - 'a' + 10; }
+    if (c >= 'A' && c <= 'F') { return c - 'A' + 10; }
+    return -1;
+}
+
+size_t tls_trust_parse_hex(const char *hex, uint8_t *out, size_t cap)
+{
+    if (hex == NULL) {
+        return 0;
+    }
+    size_t len = strlen(hex);
+    if (len == 0 || len % 2 != 0 || len / 2 > cap) {
+        return 0;
+    }
+    for (size_t i = 0; i < len / 2; i++) {
+        int hi = hex_nibble(hex[2 * i]);
+        int lo = hex_nibble(hex[2 * i + 1]);
+        if (hi < 0 || lo < 0) {
+            return 0;
+        }
+        out[i] = (uint8_t)((hi << 4) | lo);
+    }
+    return len / 2;
+}
+
+bool tls_trust_parse_pin(const char *hex, uint8_t out[TLS_TRUST_PIN_LEN])
+{
+    return tls_trust_parse_hex(hex, out, TLS_TRUST_PIN_LEN) == TLS_TRUST_PIN_LEN;
+}
@@ -0,0 +1,101 @@
+/**
+ * @file health_stats.hpp
+ * @brief Per-task CPU share and stack headroom from a task-list sample.
+ *
+ * heartbeat_service samples the scheduler's task list every tick
+ * (uxTaskGetSystemState: run-time counter and stack high-water mark of
+ * each task) and hands it here.  CPU shares are the counter deltas since
+ * the previous sample, so they describe the last heartbeat interval; the
+ * average since boot hides a task that has only just started spinning.
+ * Tasks are matched by task number, which the scheduler never reuses, so
+ * a task that exits and one created in its place are not mixed up.
+ *
+ * A compact report names only the tasks worth watching: half of its slots
+ * go to the least stack headroom, the rest to the busiest tasks.  Idle
+ * tasks are never named; their share is idle_permille.  A detailed report
+ * (the server asked for a dump) lists every task sampled.
+ *
+ * A task list longer than HEALTH_MAX_TASKS is truncated to its first
+ * HEALTH_MAX_TASKS entries; task_count still says how many there were.
+ * An empty sample (the task list could not be read) reports nothing and
+ * leaves the previous counters alone, so the next CPU shares span both
+ * intervals rather than being lost.
+ *
+ * Not thread-safe; heartbeat_service calls it from the reactor only.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Most tasks one sample holds.  The firmware runs about 20. */
+#define HEALTH_MAX_TASKS      24
+
+/** configMAX_TASK_NAME_LEN on ESP-IDF, NUL included. */
+#define HEALTH_TASK_NAME_LEN  16
+
+/** One task as the scheduler reports it. */
+typedef struct {
+    char     name[HEALTH_TASK_NAME_LEN];
+    uint32_t number;            /**< Task number, unique since boot */
+    uint32_t run_time;          /**< Run-time counter; wraps */
+    uint32_t stack_free_bytes;  /**< Stack never used (high-water mark) */
+    int8_t   core;              /**< Core it is pinned to, -1 = either */
+    uint8_t  priority;
+    bool     idle;              /**< One of the scheduler's idle tasks */
+} health_task_sample_t;
+
+/** One task as reported to the server. */
+typedef struct {
+    char     name[HEALTH_TASK_NAME_LEN];
+    uint16_t cpu_permille;      /**< Share of all cores since the last sample */
+    uint32_t stack_free_bytes;
+    int8_t   core;
+    uint8_t  priority;
+} health_task_t;
+
+typedef struct {
+    uint32_t      task_count;       /**< Tasks running; above n_tasks in a truncated detailed report */
+    uint16_t      idle_permille;    /**< Idle tasks' share of all cores */
+    bool          cpu_valid;        /**< CPU shares cover an interval (not the first sample) */
+    bool          detailed;         /**< tasks lists every task sampled */
+    uint8_t       n_tasks;
+    health_task_t tasks[HEALTH_MAX_TASKS];
+} health_report_t;
+
+/** Run-time counters of the previous sample. */
+typedef struct {
+    uint32_t number[HEALTH_MAX_TASKS];
+    uint32_t run_time[HEALTH_MAX_TASKS];
+    uint8_t  n;
+    uint32_t total;
+    bool     primed;
+} health_stats_t;
+
+void health_stats_init(health_stats_t *h);
+
+/**
+ * Report on a sample and keep its counters for the next one.
+ *
+ * @param tasks          The sample; at most HEALTH_MAX_TASKS are read.
+ * @param n              Tasks running, which may exceed HEALTH_MAX_TASKS;
+ *                       0 reports nothing and keeps @p h as it was.
+ * @param total_run_time Run-time counter at the sample (what
+ *                       uxTaskGetSystemState returns); wraps.
+ * @param cores          Cores the counters are spread across.
+ * @param detailed       List every task instead of the compact selection.
+ * @param compact_tasks  Tasks a compact report names.
+ */
+void health_stats_update(health_stats_t *h, const health_task_sample_t *tasks, size_t n,
+                         uint32_t total_run_time, uint32_t cores,
+                         bool detailed, size_t compact_tasks, health_report_t *out);
+
+#ifdef __cplusplus
+}
+#endif
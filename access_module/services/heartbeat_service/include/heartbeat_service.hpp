@@ -6,11 +6,17 @@
  * (HEARTBEAT_INTERVAL_MS from timing_config.h). Each heartbeat carries
  * a monotonic sequence number, uptime, and free heap — enough telemetry
  * for the MVP. Server transmission is added in Phase 3.
+ *
+ * With CONFIG_PORTUNUS_HEALTH_TELEMETRY each tick also samples runtime
+ * health (health_stats.hpp): per-task CPU share and stack headroom, the
+ * lowest free heap since boot and the largest free block.  server_comm
+ * reads the latest sample when it sends a heartbeat.
  */
 
 #pragma once
 
 #include "portunus_types.hpp"
+#include "health_stats.hpp"
 
 #ifdef __cplusplus
 extern "C" {
@@ -19,8 +25,9 @@ extern "C" {
 /**
  * @brief Start the heartbeat service.
  *
- * Creates a FreeRTOS task that periodically publishes heartbeat events.
- * The event bus must be initialised before calling this function.
+ * Arms a periodic reactor timer that publishes heartbeat events.
+ * The event bus (and with it the reactor) must be initialised before
+ * calling this function.
  *
  * @return PORTUNUS_OK on success, or an error code.
  */
@@ -29,10 +36,34 @@ portunus_err_t heartbeat_service_start(void);
 /**
  * @brief Stop the heartbeat service.
  *
- * Deletes the heartbeat task. Safe to call if the service is not running.
+ * Disarms the heartbeat timer. Safe to call if the service is not running.
  */
 void heartbeat_service_stop(void);
 
+/** Runtime health as of the last heartbeat tick. */
+typedef struct {
+    uint32_t        min_free_heap_bytes;       /**< Lowest free heap since boot */
+    uint32_t        largest_free_block_bytes;  /**< Largest single allocation possible */
+    uint32_t        sample_us;                 /**< Time the last sample took */
+    uint32_t        sample_max_us;             /**< Slowest sample since boot */
+    health_report_t tasks;
+} heartbeat_health_t;
+
+/**
+ * @brief Copy the latest health sample.
+ *
+ * @return false if CONFIG_PORTUNUS_HEALTH_TELEMETRY is off or no tick has
+ *         sampled yet.
+ */
+bool heartbeat_service_get_health(heartbeat_health_t *out);
+
+/**
+ * @brief Make the next tick's sample list every task (a detailed dump).
+ *
+ * One sample only; later ticks go back to the compact selection.
+ */
+void heartbeat_service_request_dump(void);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,114 @@
+/**
+ * @file health_stats.cpp
+ * @brief Task-list health report — implementation.
+ */
+
+#include "health_stats.hpp"
+
+#include <string.h>
+
+void health_stats_init(health_stats_t *h)
+{
+    memset(h, 0, sizeof(*h));
+}
+
+/** Run time of task @p number at the previous sample, or 0 if it is new. */
+static uint32_t previous_run_time(const health_stats_t *h, uint32_t number)
+{
+    for (uint8_t i = 0; i < h->n; i++) {
+        if (h->number[i] == number) {
+            return h->run_time[i];
+        }
+    }
+    return 0;  /* created since: all of its run time is in the interval */
+}
+
+static void copy_task(health_task_t *dst, const health_task_sample_t *src, uint16_t cpu_permille)
+{
+    memcpy(dst->name, src->name, sizeof(dst->name));
+    dst->name[sizeof(dst->name) - 1] = '\0';
+    dst->cpu_permille     = cpu_permille;
+    dst->stack_free_bytes = src->stack_free_bytes;
+    dst->core             = src->core;
+    dst->priority         = src->priority;
+}
+
+void health_stats_update(health_stats_t *h, const health_task_sample_t *tasks, size_t n,
+                         uint32_t total_run_time, uint32_t cores,
+                         bool detailed, size_t compact_tasks, health_report_t *out)
+{
+    memset(out, 0, sizeof(*out));
+    out->task_count = (uint32_t)n;
+    out->detailed   = detailed;
+    if (n == 0) {
+        return;  /* no sample: the next one is measured from the last good one */
+    }
+
+    /* A larger task list is truncated: the report says how many there were. */
+    if (n > HEALTH_MAX_TASKS) {
+        n = HEALTH_MAX_TASKS;
+    }
+    if (cores == 0) {
+        cores = 1;
+    }
+
+    /* Unsigned differences survive one wrap of the counters, which at a
+       1 MHz run-time clock is over an hour; heartbeats are far closer. */
+    uint32_t elapsed = total_run_time - h->total;
+    out->cpu_valid   = h->primed && elapsed > 0;
+
+    uint16_t cpu[HEALTH_MAX_TASKS] = {};
+    uint32_t idle = 0;
+    for (size_t i = 0; i < n && out->cpu_valid; i++) {
+        uint64_t ran = (uint32_t)(tasks[i].run_time - previous_run_time(h, tasks[i].number));
+        uint64_t permille = ran * 1000 / ((uint64_t)elapsed * cores);
+        cpu[i] = (uint16_t)(permille > 1000 ? 1000 : permille);
+        if (tasks[i].idle) {
+            idle += cpu[i];
+        }
+    }
+    out->idle_permille = (uint16_t)(idle > 1000 ? 1000 : idle);
+
+    h->n = (uint8_t)n;
+    for (size_t i = 0; i < n; i++) {
+        h->number[i]   = tasks[i].number;
+        h->run_time[i] = tasks[i].run_time;
+    }
+    h->total  = total_run_time;
+    h->primed = true;
+
+    if (detailed) {
+        for (size_t i = 0; i < n; i++) {
+            copy_task(&out->tasks[out->n_tasks++], &tasks[i], cpu[i]);
+        }
+        return;
+    }
+
+    /* Compact: repeatedly take the task with the least stack headroom (first
+       half of the slots), then the busiest (the rest), skipping idle tasks
+       and those already taken.  Without CPU shares all slots go to stack. */
+    if (compact_tasks > HEALTH_MAX_TASKS) {
+        compact_tasks = HEALTH_MAX_TASKS;
+    }
+    size_t by_stack = out->cpu_valid ? (compact_tasks + 1) / 2 : compact_tasks;
+    bool taken[HEALTH_MAX_TASKS] = {};
+    while (out->n_tasks < compact_tasks) {
+        bool   want_stack = out->n_tasks < by_stack;
+        size_t best       = n;
+        for (size_t i = 0; i < n; i++) {
+            if (taken[i] || tasks[i].idle) {
+                continue;
+            }
+            if (best == n ||
+                (want_stack ? tasks[i].stack_free_bytes < tasks[best].stack_free_bytes
+                            : cpu[i] > cpu[best])) {
+                best = i;
+            }
+        }
+        if (best == n) {
+            break;
+        }
+        taken[best] = true;
+        copy_task(&out->tasks[out->n_tasks++], &tasks[best], cpu[best]);
+    }
+}
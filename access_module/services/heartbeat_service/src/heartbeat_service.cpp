@@ -2,8 +2,14 @@
  * @file heartbeat_service.cpp
  * @brief Heartbeat service implementation.
  *
- * A FreeRTOS task wakes at HEARTBEAT_INTERVAL_MS, collects basic health
- * telemetry, and publishes an EVENT_HEARTBEAT to the event bus.
+ * A periodic reactor timer fires every HEARTBEAT_INTERVAL_MS, collects
+ * basic health telemetry, and publishes an EVENT_HEARTBEAT to the event bus.
+ * The first tick comes at a random point within the first interval, so
+ * modules that boot together do not tick together (jitter.h).
+ *
+ * With CONFIG_PORTUNUS_HEALTH_TELEMETRY the tick first samples runtime
+ * health, so the heartbeat it triggers carries a sample from the same
+ * moment.  The sample is kept here for server_comm to read.
  */
 
 #include "heartbeat_service.hpp"
@@ -11,98 +17,275 @@
 #include "event_types.hpp"
 #include "error_codes.hpp"
 #include "timing_config.hpp"
+#include "reactor.hpp"
+#include "task_plan.hpp"
+#include "jitter.h"
 
-#include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
 #include "esp_log.h"
 #include "esp_timer.h"
 #include "esp_system.h"
+#include "esp_random.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#if CONFIG_PORTUNUS_HEALTH_TELEMETRY
+#include "esp_heap_caps.h"
+#endif
 
 #include <string.h>
 #include <inttypes.h>
+#include <stdlib.h>
 
 static const char *TAG = "heartbeat";
 
-#define HEARTBEAT_TASK_STACK_SIZE  3072
-#define HEARTBEAT_TASK_PRIORITY    3       /* Lower priority than event dispatcher */
+static reactor_timer_t s_heartbeat_timer = {};
+static bool            s_running         = false;
+static uint32_t        s_sequence        = 0;
+
+#if CONFIG_PORTUNUS_HEALTH_TELEMETRY
+/* Sampling state (reactor only).  Static rather than on the reactor's
+   stack: the task list alone is about 1 KB. */
+static TaskStatus_t         s_task_status[HEALTH_MAX_TASKS];
+static health_task_sample_t s_task_samples[HEALTH_MAX_TASKS];
+static health_stats_t       s_health_stats;
+static heartbeat_health_t   s_health_next;
+static uint32_t             s_sample_max_us = 0;
 
-static TaskHandle_t s_heartbeat_task = NULL;
-static uint32_t     s_sequence       = 0;
+/* The latest sample and a pending dump request, shared with server_comm. */
+static portMUX_TYPE       s_health_lock    = portMUX_INITIALIZER_UNLOCKED;
+static heartbeat_health_t s_health;
+static bool               s_health_valid   = false;
+static bool               s_dump_requested = false;
 
-static void heartbeat_task(void *arg)
+/** qsort order: oldest task (lowest task number) first. */
+static int by_task_number(const void *a, const void *b)
 {
-    (void)arg;
-    TickType_t interval = pdMS_TO_TICKS(HEARTBEAT_INTERVAL_MS);
-    TickType_t last_wake = xTaskGetTickCount();
-
-    ESP_LOGI(TAG, "Heartbeat task started (interval=%d ms)", HEARTBEAT_INTERVAL_MS);
-
-    for (;;) {
-        vTaskDelayUntil(&last_wake, interval);
-
-        int64_t now_us = esp_timer_get_time();
-
-        portunus_event_t event;
-        memset(&event, 0, sizeof(event));
-        event.id = EVENT_HEARTBEAT;
-        event.payload.heartbeat.sequence        = s_sequence;
-        event.payload.heartbeat.uptime_sec      = (uint32_t)(now_us / 1000000);
-        event.payload.heartbeat.free_heap_bytes = esp_get_free_heap_size();
-
-        portunus_err_t err = event_bus_publish(&event);
-        if (err != PORTUNUS_OK) {
-            ESP_LOGW(TAG, "Failed to publish heartbeat #%" PRIu32 ": err=%d",
-                     s_sequence, (int)err);
-            /* Sequence not incremented — the same number will be retried
-               on the next interval so the server sees no gaps. */
-        } else {
-            s_sequence++;
+    UBaseType_t x = ((const TaskStatus_t *)a)->xTaskNumber;
+    UBaseType_t y = ((const TaskStatus_t *)b)->xTaskNumber;
+    return (x > y) - (x < y);
+}
+
+/**
+ * Sample runtime health into s_health.
+ *
+ * uxTaskGetSystemState() walks the task list with the scheduler suspended
+ * and scans the unused part of every task's stack for its high-water mark,
+ * so the cost grows with the number of tasks and their stack sizes.  It is
+ * timed: sample_us and sample_max_us go out with the heartbeat.
+ *
+ * The call fills a caller-sized array or nothing at all, so with more than
+ * HEALTH_MAX_TASKS tasks the list is read into a heap array for the one
+ * sample and cut down to the HEALTH_MAX_TASKS oldest tasks.  Task numbers
+ * only grow, so that set stays the same from one sample to the next and
+ * the CPU shares remain deltas; the report is marked truncated.
+ */
+static void sample_health(void)
+{
+    int64_t start_us = esp_timer_get_time();
+
+    portENTER_CRITICAL(&s_health_lock);
+    bool detailed    = s_dump_requested;
+    s_dump_requested = false;
+    portEXIT_CRITICAL(&s_health_lock);
+
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    TaskStatus_t *status = s_task_status;
+    UBaseType_t   cap    = HEALTH_MAX_TASKS;
+    UBaseType_t   count  = uxTaskGetNumberOfTasks();
+    if (count > HEALTH_MAX_TASKS) {
+        cap    = count + 2;  /* room for a task or two created meanwhile */
+        status = (TaskStatus_t *)malloc(cap * sizeof(TaskStatus_t));
+        if (status == NULL) {
+            cap = 0;
         }
+    }
+    /* 0 if more tasks were created since the count. */
+    UBaseType_t n = cap ? uxTaskGetSystemState(status, cap, &total) : 0;
+    if (n > HEALTH_MAX_TASKS) {
+        qsort(status, n, sizeof(TaskStatus_t), by_task_number);
+    }
+
+    UBaseType_t kept = n < HEALTH_MAX_TASKS ? n : HEALTH_MAX_TASKS;
+    for (UBaseType_t i = 0; i < kept; i++) {
+        const TaskStatus_t   *t = &status[i];
+        health_task_sample_t *s = &s_task_samples[i];
+        strlcpy(s->name, t->pcTaskName, sizeof(s->name));
+        s->number   = (uint32_t)t->xTaskNumber;
+        s->run_time = (uint32_t)t->ulRunTimeCounter;
+        /* StackType_t is a byte on ESP-IDF, so the mark is in bytes. */
+        s->stack_free_bytes = (uint32_t)t->usStackHighWaterMark;
+        BaseType_t core = xTaskGetCoreID(t->xHandle);
+        s->core     = (core == tskNO_AFFINITY) ? -1 : (int8_t)core;
+        s->priority = (uint8_t)t->uxCurrentPriority;
+        s->idle     = false;
+        for (BaseType_t c = 0; c < portNUM_PROCESSORS; c++) {
+            if (t->xHandle == xTaskGetIdleTaskHandleForCore(c)) {
+                s->idle = true;
+            }
+        }
+    }
+
+    health_stats_update(&s_health_stats, s_task_samples, n, (uint32_t)total,
+                        portNUM_PROCESSORS, detailed, HEARTBEAT_HEALTH_TASKS,
+                        &s_health_next.tasks);
+    if (status != s_task_status) {
+        free(status);
+    }
+    s_health_next.min_free_heap_bytes      = heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT);
+    s_health_next.largest_free_block_bytes = heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT);
+
+    uint32_t took_us = (uint32_t)(esp_timer_get_time() - start_us);
+    if (took_us > s_sample_max_us) {
+        s_sample_max_us = took_us;
+    }
+    s_health_next.sample_us     = took_us;
+    s_health_next.sample_max_us = s_sample_max_us;
 
-        if (event.payload.heartbeat.sequence % 100 == 0) {
-            ESP_LOGI(TAG, "Heartbeat #%" PRIu32 " | uptime=%" PRIu32 "s | heap=%" PRIu32,
-                     event.payload.heartbeat.sequence,
-                     event.payload.heartbeat.uptime_sec,
-                     event.payload.heartbeat.free_heap_bytes);
-        } else {
-            ESP_LOGD(TAG, "Heartbeat #%" PRIu32 " | uptime=%" PRIu32 "s | heap=%" PRIu32,
+    portENTER_CRITICAL(&s_health_lock);
+    memcpy(&s_health, &s_health_next, sizeof(s_health));
+    s_health_valid = true;
+    if (detailed && n == 0) {
+        s_dump_requested = true;  /* no task list this time: dump on the next tick */
+    }
+    portEXIT_CRITICAL(&s_health_lock);
+
+    if (detailed && n > 0) {
+        ESP_LOGI(TAG, "Health dump sampled: %u of %u tasks in %" PRIu32 " us",
+                 (unsigned)kept, (unsigned)n, took_us);
+    }
+}
+#endif
+
+#if CONFIG_PORTUNUS_TASK_RUNTIME_STATS
+/**
+ * Log core, priority and CPU share (since boot) of every task.
+ * Diagnostic only: walks the whole task list with the scheduler suspended.
+ */
+static void log_task_runtime_stats(void)
+{
+    UBaseType_t    count = uxTaskGetNumberOfTasks();
+    TaskStatus_t  *tasks = (TaskStatus_t *)malloc(count * sizeof(TaskStatus_t));
+    if (tasks == NULL) {
+        return;
+    }
+
+    configRUN_TIME_COUNTER_TYPE total = 0;
+    count = uxTaskGetSystemState(tasks, count, &total);
+
+    for (UBaseType_t i = 0; i < count && total > 0; i++) {
+        BaseType_t core = xTaskGetCoreID(tasks[i].xHandle);
+        ESP_LOGI(TAG, "  %-16s core=%2d prio=%2u cpu=%3u%%",
+                 tasks[i].pcTaskName,
+                 (core == tskNO_AFFINITY) ? -1 : (int)core,
+                 (unsigned)tasks[i].uxCurrentPriority,
+                 (unsigned)((uint64_t)tasks[i].ulRunTimeCounter * 100 /
+                            ((uint64_t)total * portNUM_PROCESSORS)));
+    }
+    free(tasks);
+}
+#endif
+
+static void heartbeat_tick(void *arg)
+{
+    (void)arg;
+
+#if CONFIG_PORTUNUS_HEALTH_TELEMETRY
+    sample_health();
+#endif
+
+    int64_t now_us = esp_timer_get_time();
+
+    portunus_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.id = EVENT_HEARTBEAT;
+    event.payload.heartbeat.sequence        = s_sequence;
+    event.payload.heartbeat.uptime_sec      = (uint32_t)(now_us / 1000000);
+    event.payload.heartbeat.free_heap_bytes = esp_get_free_heap_size();
+
+    const task_plan_report_t *plan = task_plan_get_report();
+    event.payload.heartbeat.cpu_cores        = plan->cores;
+    event.payload.heartbeat.core_isolation   = plan->isolation;
+    event.payload.heartbeat.task_plan_faults = plan->faults;
+
+    portunus_err_t err = event_bus_publish(&event);
+    if (err != PORTUNUS_OK) {
+        ESP_LOGW(TAG, "Failed to publish heartbeat #%" PRIu32 ": err=%d",
+                 s_sequence, (int)err);
+        /* Sequence not incremented — the same number will be retried
+           on the next interval so the server sees no gaps. */
+    } else {
+        s_sequence++;
+    }
+
+    if (event.payload.heartbeat.sequence % 100 == 0) {
+        ESP_LOGI(TAG, "Heartbeat #%" PRIu32 " | uptime=%" PRIu32 "s | heap=%" PRIu32,
                  event.payload.heartbeat.sequence,
                  event.payload.heartbeat.uptime_sec,
                  event.payload.heartbeat.free_heap_bytes);
-        }
+#if CONFIG_PORTUNUS_TASK_RUNTIME_STATS
+        log_task_runtime_stats();
+#endif
+    } else {
+        ESP_LOGD(TAG, "Heartbeat #%" PRIu32 " | uptime=%" PRIu32 "s | heap=%" PRIu32,
+             event.payload.heartbeat.sequence,
+             event.payload.heartbeat.uptime_sec,
+             event.payload.heartbeat.free_heap_bytes);
     }
 }
 
 portunus_err_t heartbeat_service_start(void)
 {
-    if (s_heartbeat_task != NULL) {
+    if (s_running) {
         ESP_LOGW(TAG, "Heartbeat service already running");
         return PORTUNUS_ERR_ALREADY_INIT;
     }
 
-    BaseType_t ret = xTaskCreate(
-        heartbeat_task,
-        "heartbeat",
-        HEARTBEAT_TASK_STACK_SIZE,
-        NULL,
-        HEARTBEAT_TASK_PRIORITY,
-        &s_heartbeat_task
-    );
-
-    if (ret != pdPASS) {
-        ESP_LOGE(TAG, "Failed to create heartbeat task");
-        return PORTUNUS_ERR_TASK_CREATE;
+    /* In (0, interval]: a random phase, never an immediate tick. */
+    uint32_t first_ms = HEARTBEAT_INTERVAL_MS - jitter_phase_ms(HEARTBEAT_INTERVAL_MS, esp_random());
+    portunus_err_t err = reactor_timer_start(&s_heartbeat_timer,
+                                             first_ms, HEARTBEAT_INTERVAL_MS,
+                                             heartbeat_tick, NULL);
+    if (err != PORTUNUS_OK) {
+        ESP_LOGE(TAG, "Failed to start heartbeat timer");
+        return err;
     }
 
+    s_running = true;
+    ESP_LOGI(TAG, "Heartbeat service started (interval=%d ms, first in %" PRIu32 " ms)",
+             HEARTBEAT_INTERVAL_MS, first_ms);
     return PORTUNUS_OK;
 }
 
 void heartbeat_service_stop(void)
 {
-    if (s_heartbeat_task != NULL) {
-        vTaskDelete(s_heartbeat_task);
-        s_heartbeat_task = NULL;
+    if (s_running) {
+        reactor_timer_stop(&s_heartbeat_timer);
+        s_running = false;
         s_sequence = 0;
         ESP_LOGI(TAG, "Heartbeat service stopped");
     }
-}
\ No newline at end of file
+}
+
+bool heartbeat_service_get_health(heartbeat_health_t *out)
+{
+#if CONFIG_PORTUNUS_HEALTH_TELEMETRY
+    portENTER_CRITICAL(&s_health_lock);
+    bool valid = s_health_valid;
+    if (valid) {
+        memcpy(out, &s_health, sizeof(*out));
+    }
+    portEXIT_CRITICAL(&s_health_lock);
+    return valid;
+#else
+    (void)out;
+    return false;
+#endif
+}
+
+void heartbeat_service_request_dump(void)
+{
+#if CONFIG_PORTUNUS_HEALTH_TELEMETRY
+    portENTER_CRITICAL(&s_health_lock);
+    s_dump_requested = true;
+    portEXIT_CRITICAL(&s_health_lock);
+#endif
+}
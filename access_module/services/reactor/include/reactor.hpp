@@ -0,0 +1,102 @@
+/**
+ * @file reactor.hpp
+ * @brief Cooperative single-task reactor for the module's housekeeping work.
+ *
+ * Event dispatch, FSM event processing, input polling, LED patterns and the
+ * heartbeat used to each own a FreeRTOS task, most of them idle almost all
+ * of the time.  They now run as handlers on one "reactor" task instead:
+ *
+ *   - Timers: reactor_timer_start() arms a one-shot or periodic callback on
+ *     a hashed timer wheel (REACTOR_TICK_MS resolution, see timer_wheel.hpp).
+ *   - Readiness sources: reactor_source_register() binds a callback to one
+ *     task-notification bit; reactor_signal() (any task) or
+ *     reactor_signal_from_isr() sets the bit and the callback runs on the
+ *     reactor shortly after.  Signals coalesce — a source signalled five
+ *     times before it runs is called once, so handlers drain their queue.
+ *
+ * Handlers run to completion on the reactor stack and must not block: no
+ * portMAX_DELAY waits, no SPI or network I/O.  Work that blocks (the
+ * credential reader poll, grpc/server_comm) keeps its own task and talks to
+ * the reactor through queues + reactor_signal().
+ *
+ * Thread safety: every function except the handlers themselves is safe to
+ * call from any task; reactor_signal_from_isr() is the only ISR-safe entry.
+ */
+
+#pragma once
+
+#include "portunus_types.hpp"
+#include "timer_wheel.hpp"
+#include "freertos/FreeRTOS.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Wheel resolution.  Timer delays are rounded up to a multiple of this. */
+#define REACTOR_TICK_MS      10
+
+/** Notification bits available to readiness sources (one bit is reserved). */
+#define REACTOR_MAX_SOURCES  31
+
+typedef void (*reactor_cb_t)(void *ctx);
+
+/** Software timer.  Caller-owned; zero-initialise before first use. */
+typedef wheel_timer_t reactor_timer_t;
+
+/** Readiness source.  Caller-owned; zero-initialise before registering. */
+typedef struct {
+    reactor_cb_t cb;
+    void        *ctx;
+    uint32_t     mask;   /**< Notification bit assigned at registration. */
+} reactor_source_t;
+
+/**
+ * @brief Create the reactor task.
+ *
+ * Call once at boot before any component that schedules work on it.
+ *
+ * @return PORTUNUS_OK, PORTUNUS_ERR_ALREADY_INIT if already running, or
+ *         PORTUNUS_ERR_TASK_CREATE.
+ */
+portunus_err_t reactor_init(void);
+
+/**
+ * @brief Bind @p src to a notification bit and a handler.
+ *
+ * May be called before reactor_init(); signals raised before the task
+ * exists are dropped, so register and start producing only after init.
+ *
+ * @return PORTUNUS_OK, PORTUNUS_ERR_INVALID_ARG, or
+ *         PORTUNUS_ERR_MAX_SUBSCRIBERS when all bits are taken.
+ */
+portunus_err_t reactor_source_register(reactor_source_t *src, reactor_cb_t cb, void *ctx);
+
+/** Mark @p src ready.  Safe from any task, including the reactor itself. */
+void reactor_signal(reactor_source_t *src);
+
+/** ISR variant of reactor_signal(). */
+void reactor_signal_from_isr(reactor_source_t *src, BaseType_t *higher_priority_woken);
+
+/**
+ * @brief Arm (or re-arm) a timer.
+ *
+ * @param delay_ms   Time to first expiry.
+ * @param period_ms  Interval between later expiries; 0 for one-shot.
+ * @return PORTUNUS_OK or PORTUNUS_ERR_INVALID_ARG.
+ */
+portunus_err_t reactor_timer_start(reactor_timer_t *t, uint32_t delay_ms, uint32_t period_ms,
+                                   reactor_cb_t cb, void *ctx);
+
+/** Disarm a timer.  Safe if it is not armed. */
+void reactor_timer_stop(reactor_timer_t *t);
+
+/** True when called from a reactor handler (blocking here stalls everything). */
+bool reactor_in_context(void);
+
+/** Minimum free stack ever seen on the reactor task, in bytes (0 before init). */
+uint32_t reactor_stack_high_water_bytes(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,93 @@
+/**
+ * @file timer_wheel.hpp
+ * @brief Hashed timer wheel driving the reactor's software timers.
+ *
+ * Fixed ring of TIMER_WHEEL_SLOTS buckets; one advance() moves the cursor
+ * one tick.  A timer due d ticks from now lands in bucket (cursor + d) mod
+ * SLOTS with d / SLOTS full revolutions left to wait, so arming and
+ * disarming are O(1) regardless of how many timers exist.  Timers are
+ * intrusive (caller-owned storage, no allocation).
+ *
+ * Periodic timers are re-armed relative to the tick they expired on, not
+ * the tick their callback ran on, so a 10 s heartbeat does not drift by the
+ * callback latency each period.
+ *
+ * Not thread-safe; reactor.cpp serialises access.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Ring size.  Power of two; one revolution = SLOTS reactor ticks. */
+#define TIMER_WHEEL_SLOTS 64
+
+/** timer_wheel_ticks_to_next() result when nothing is armed. */
+#define TIMER_WHEEL_NONE UINT32_MAX
+
+typedef void (*wheel_cb_t)(void *ctx);
+
+/** One timer.  Zero-initialise before first use; treat fields as private. */
+typedef struct wheel_timer {
+    wheel_cb_t          cb;
+    void               *ctx;
+    uint32_t            period;     /**< Re-arm interval in ticks; 0 = one-shot. */
+    uint32_t            rounds;     /**< Revolutions left before it is due. */
+    uint16_t            slot;
+    bool                armed;
+    uint32_t            generation; /**< Bumped by every arm and disarm. */
+    uint32_t            fired_gen;  /**< generation when advance() returned it. */
+    struct wheel_timer *next;
+    struct wheel_timer *prev;
+    struct wheel_timer *fire_next;  /**< Link in the list advance() returns. */
+} wheel_timer_t;
+
+typedef struct {
+    wheel_timer_t *slots[TIMER_WHEEL_SLOTS];
+    uint32_t       cursor;          /**< Ticks advanced since init. */
+    uint32_t       armed;           /**< Number of armed timers. */
+} timer_wheel_t;
+
+void timer_wheel_init(timer_wheel_t *w);
+
+/**
+ * @brief Arm (or re-arm) a timer.
+ *
+ * @param delay   Ticks until the first expiry; 0 is treated as 1 (next tick).
+ * @param period  Ticks between later expiries; 0 for a one-shot timer.
+ */
+void timer_wheel_arm(timer_wheel_t *w, wheel_timer_t *t, uint32_t delay, uint32_t period);
+
+/** Disarm a timer.  No-op if it is not armed. */
+void timer_wheel_disarm(timer_wheel_t *w, wheel_timer_t *t);
+
+/**
+ * @brief Advance the wheel by one tick.
+ *
+ * @return Expired timers linked through fire_next (NULL if none).  One-shot
+ *         timers are already disarmed and periodic ones re-armed, so the
+ *         caller may run the callbacks without holding any lock and a
+ *         callback may freely re-arm or disarm any timer.
+ */
+wheel_timer_t *timer_wheel_advance(timer_wheel_t *w);
+
+/**
+ * @brief Whether an expired timer should still run its callback.
+ *
+ * False once the timer has been armed or disarmed since advance() returned
+ * it, e.g. by an earlier callback in the same batch.  Call with the same
+ * serialisation as arm/disarm, just before running the callback.
+ */
+bool timer_wheel_still_due(const wheel_timer_t *t);
+
+/** Ticks until the earliest armed timer expires, or TIMER_WHEEL_NONE. */
+uint32_t timer_wheel_ticks_to_next(const timer_wheel_t *w);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,237 @@
+/**
+ * @file reactor.cpp
+ * @brief Cooperative single-task reactor — implementation.
+ *
+ * Loop: sleep on the task notification until either a source bit is set or
+ * the earliest timer is due, run the ready sources, then advance the wheel
+ * to the current tick and run whatever expired.  The wheel is only touched
+ * under s_lock; callbacks always run with the lock released.
+ */
+
+#include "reactor.hpp"
+#include "error_codes.hpp"
+#include "task_config.hpp"
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+
+static const char *TAG = "reactor";
+
+#define REACTOR_TASK_STACK_SIZE  4096
+
+/** Set by reactor_timer_start/stop from other tasks so the loop recomputes
+ *  its sleep.  Never handed to a source. */
+#define WHEEL_CHANGED_BIT  (1u << 31)
+
+static TaskHandle_t      s_task = NULL;
+static portMUX_TYPE      s_lock = portMUX_INITIALIZER_UNLOCKED;
+static timer_wheel_t     s_wheel;
+static TickType_t        s_wheel_time;   /**< RTOS tick the wheel cursor corresponds to. */
+static reactor_source_t *s_sources[REACTOR_MAX_SOURCES];
+static uint32_t          s_source_count = 0;
+
+static TickType_t wheel_tick(void)
+{
+    TickType_t t = pdMS_TO_TICKS(REACTOR_TICK_MS);
+    return (t == 0) ? 1 : t;
+}
+
+/** Re-anchor an idle wheel to now so a long idle spell is not replayed. Lock held. */
+static void resync_if_idle(TickType_t now)
+{
+    if (s_wheel.armed == 0) {
+        s_wheel_time = now;
+    }
+}
+
+static TickType_t next_wait(void)
+{
+    TickType_t now = xTaskGetTickCount();
+
+    portENTER_CRITICAL(&s_lock);
+    uint32_t ticks = timer_wheel_ticks_to_next(&s_wheel);
+    TickType_t due = s_wheel_time + (TickType_t)ticks * wheel_tick();
+    portEXIT_CRITICAL(&s_lock);
+
+    if (ticks == TIMER_WHEEL_NONE) {
+        return portMAX_DELAY;
+    }
+    TickType_t remaining = due - now;
+    /* Unsigned wrap means `due` is already behind us. */
+    return (remaining > (TickType_t)ticks * wheel_tick()) ? 0 : remaining;
+}
+
+static void run_due_timers(void)
+{
+    TickType_t now = xTaskGetTickCount();
+
+    for (;;) {
+        portENTER_CRITICAL(&s_lock);
+        if ((TickType_t)(now - s_wheel_time) < wheel_tick()) {
+            resync_if_idle(now);
+            portEXIT_CRITICAL(&s_lock);
+            return;
+        }
+        s_wheel_time += wheel_tick();
+        wheel_timer_t *expired = timer_wheel_advance(&s_wheel);
+        portEXIT_CRITICAL(&s_lock);
+
+        while (expired != NULL) {
+            wheel_timer_t *t = expired;
+            /* An earlier callback in this batch, or another task, may have
+               stopped or restarted t since it expired. */
+            portENTER_CRITICAL(&s_lock);
+            expired = t->fire_next;
+            bool due = timer_wheel_still_due(t);
+            reactor_cb_t cb = t->cb;
+            void *ctx = t->ctx;
+            portEXIT_CRITICAL(&s_lock);
+            if (due) {
+                cb(ctx);
+            }
+        }
+    }
+}
+
+static void reactor_task(void *arg)
+{
+    (void)arg;
+    ESP_LOGI(TAG, "Reactor started (tick=%d ms, stack=%d)",
+             REACTOR_TICK_MS, REACTOR_TASK_STACK_SIZE);
+
+    for (;;) {
+        uint32_t bits = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &bits, next_wait());
+
+        bits &= ~WHEEL_CHANGED_BIT;
+        while (bits != 0) {
+            uint32_t idx = (uint32_t)__builtin_ctz(bits);
+            bits &= bits - 1;
+            reactor_source_t *src = s_sources[idx];
+            src->cb(src->ctx);
+        }
+
+        run_due_timers();
+    }
+}
+
+/* ── Public API ────────────────────────────────────────────────────────────── */
+
+portunus_err_t reactor_init(void)
+{
+    if (s_task != NULL) {
+        return PORTUNUS_ERR_ALREADY_INIT;
+    }
+
+    portENTER_CRITICAL(&s_lock);
+    timer_wheel_init(&s_wheel);
+    s_wheel_time = xTaskGetTickCount();
+    portEXIT_CRITICAL(&s_lock);
+
+    BaseType_t ret = xTaskCreatePinnedToCore(
+        reactor_task,
+        "reactor",
+        REACTOR_TASK_STACK_SIZE,
+        NULL,
+        REACTOR_TASK_PRIORITY,
+        &s_task,
+        TASK_CORE_IO
+    );
+
+    if (ret != pdPASS) {
+        ESP_LOGE(TAG, "Failed to create reactor task");
+        s_task = NULL;
+        return PORTUNUS_ERR_TASK_CREATE;
+    }
+    return PORTUNUS_OK;
+}
+
+portunus_err_t reactor_source_register(reactor_source_t *src, reactor_cb_t cb, void *ctx)
+{
+    if (src == NULL || cb == NULL) {
+        return PORTUNUS_ERR_INVALID_ARG;
+    }
+
+    portENTER_CRITICAL(&s_lock);
+    if (s_source_count >= REACTOR_MAX_SOURCES) {
+        portEXIT_CRITICAL(&s_lock);
+        ESP_LOGE(TAG, "Source table full (%d)", REACTOR_MAX_SOURCES);
+        return PORTUNUS_ERR_MAX_SUBSCRIBERS;
+    }
+    src->cb   = cb;
+    src->ctx  = ctx;
+    src->mask = 1u << s_source_count;
+    s_sources[s_source_count++] = src;
+    portEXIT_CRITICAL(&s_lock);
+    return PORTUNUS_OK;
+}
+
+void reactor_signal(reactor_source_t *src)
+{
+    if (s_task != NULL && src != NULL && src->mask != 0) {
+        xTaskNotify(s_task, src->mask, eSetBits);
+    }
+}
+
+void reactor_signal_from_isr(reactor_source_t *src, BaseType_t *higher_priority_woken)
+{
+    if (s_task != NULL && src != NULL && src->mask != 0) {
+        xTaskNotifyFromISR(s_task, src->mask, eSetBits, higher_priority_woken);
+    }
+}
+
+portunus_err_t reactor_timer_start(reactor_timer_t *t, uint32_t delay_ms, uint32_t period_ms,
+                                   reactor_cb_t cb, void *ctx)
+{
+    if (t == NULL || cb == NULL) {
+        return PORTUNUS_ERR_INVALID_ARG;
+    }
+
+    TickType_t step = wheel_tick();
+    uint32_t delay  = (pdMS_TO_TICKS(delay_ms) + step - 1) / step;
+    uint32_t period = (period_ms == 0) ? 0 : (pdMS_TO_TICKS(period_ms) + step - 1) / step;
+    if (period_ms != 0 && period == 0) {
+        period = 1;
+    }
+
+    TickType_t now = xTaskGetTickCount();
+
+    portENTER_CRITICAL(&s_lock);
+    resync_if_idle(now);
+    /* The cursor may trail real time while the reactor sleeps; measure the
+       delay from now, not from the cursor. */
+    uint32_t lag = (uint32_t)((TickType_t)(now - s_wheel_time) / step);
+    t->cb  = cb;
+    t->ctx = ctx;
+    timer_wheel_arm(&s_wheel, t, delay + lag, period);
+    portEXIT_CRITICAL(&s_lock);
+
+    if (s_task != NULL && xTaskGetCurrentTaskHandle() != s_task) {
+        xTaskNotify(s_task, WHEEL_CHANGED_BIT, eSetBits);
+    }
+    return PORTUNUS_OK;
+}
+
+void reactor_timer_stop(reactor_timer_t *t)
+{
+    if (t == NULL) {
+        return;
+    }
+    portENTER_CRITICAL(&s_lock);
+    timer_wheel_disarm(&s_wheel, t);
+    portEXIT_CRITICAL(&s_lock);
+}
+
+bool reactor_in_context(void)
+{
+    return s_task != NULL && xTaskGetCurrentTaskHandle() == s_task;
+}
+
+uint32_t reactor_stack_high_water_bytes(void)
+{
+    if (s_task == NULL) {
+        return 0;
+    }
+    return (uint32_t)uxTaskGetStackHighWaterMark(s_task);
+}
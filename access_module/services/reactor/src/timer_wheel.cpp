@@ -0,0 +1,121 @@
+/**
+ * @file timer_wheel.cpp
+ * @brief Hashed timer wheel — implementation.
+ */
+
+#include "timer_wheel.hpp"
+
+#include <cstring>
+
+static constexpr uint32_t SLOT_MASK = TIMER_WHEEL_SLOTS - 1;
+
+static_assert((TIMER_WHEEL_SLOTS & SLOT_MASK) == 0, "slot count must be a power of two");
+
+static void link(timer_wheel_t *w, wheel_timer_t *t, uint32_t delay)
+{
+    if (delay == 0) {
+        delay = 1;
+    }
+    /* Bucket visited after `delay` advances; due once rounds reaches 0. */
+    t->slot   = static_cast<uint16_t>((w->cursor + delay) & SLOT_MASK);
+    t->rounds = (delay - 1) / TIMER_WHEEL_SLOTS;
+    t->prev   = nullptr;
+    t->next   = w->slots[t->slot];
+    if (t->next != nullptr) {
+        t->next->prev = t;
+    }
+    w->slots[t->slot] = t;
+    t->armed = true;
+    w->armed++;
+}
+
+static void unlink(timer_wheel_t *w, wheel_timer_t *t)
+{
+    if (t->prev != nullptr) {
+        t->prev->next = t->next;
+    } else {
+        w->slots[t->slot] = t->next;
+    }
+    if (t->next != nullptr) {
+        t->next->prev = t->prev;
+    }
+    t->next  = nullptr;
+    t->prev  = nullptr;
+    t->armed = false;
+    w->armed--;
+}
+
+void timer_wheel_init(timer_wheel_t *w)
+{
+    memset(w, 0, sizeof(*w));
+}
+
+void timer_wheel_arm(timer_wheel_t *w, wheel_timer_t *t, uint32_t delay, uint32_t period)
+{
+    if (t->armed) {
+        unlink(w, t);
+    }
+    t->generation++;
+    t->period = period;
+    link(w, t, delay);
+}
+
+void timer_wheel_disarm(timer_wheel_t *w, wheel_timer_t *t)
+{
+    t->generation++;
+    if (t->armed) {
+        unlink(w, t);
+    }
+}
+
+wheel_timer_t *timer_wheel_advance(timer_wheel_t *w)
+{
+    w->cursor++;
+    wheel_timer_t *expired = nullptr;
+    wheel_timer_t *t = w->slots[w->cursor & SLOT_MASK];
+
+    while (t != nullptr) {
+        wheel_timer_t *next = t->next;
+        if (t->rounds > 0) {
+            t->rounds--;
+        } else {
+            unlink(w, t);
+            if (t->period != 0) {
+                link(w, t, t->period);
+            }
+            t->fired_gen = t->generation;
+            t->fire_next = expired;
+            expired = t;
+        }
+        t = next;
+    }
+    return expired;
+}
+
+bool timer_wheel_still_due(const wheel_timer_t *t)
+{
+    return t->fired_gen == t->generation;
+}
+
+uint32_t timer_wheel_ticks_to_next(const timer_wheel_t *w)
+{
+    if (w->armed == 0) {
+        return TIMER_WHEEL_NONE;
+    }
+
+    uint32_t best = TIMER_WHEEL_NONE;
+    for (uint32_t d = 1; d <= TIMER_WHEEL_SLOTS; d++) {
+        for (const wheel_timer_t *t = w->slots[(w->cursor + d) & SLOT_MASK];
+             t != nullptr; t = t->next) {
+            uint32_t due = d + t->rounds * TIMER_WHEEL_SLOTS;
+            if (due < best) {
+                best = due;
+            }
+        }
+        /* Nothing in a later bucket can beat a zero-round hit here. */
+        if (best <= d) {
+            break;
+        }
+    }
+    return best;
+}
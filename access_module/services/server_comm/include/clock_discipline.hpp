@@ -0,0 +1,113 @@
+/**
+ * @file clock_discipline.hpp
+ * @brief Server-time estimate with a hard error bound, from RPC round trips.
+ *
+ * Every RPC whose response carries the server's time is a sample: the
+ * server stamped it somewhere between our send and our receive, so the
+ * server clock at the exchange midpoint is known to within RTT/2.  Samples
+ * are kept against the monotonic clock (esp_timer), not the wall clock,
+ * so corrections applied to the wall clock never disturb them.
+ *
+ * The window holds one sample per bucket_us interval: within an interval
+ * a new sample replaces the kept one only if it gives a smaller bound, so
+ * each slot holds the interval's minimum-RTT exchange and the window
+ * spans CLOCK_DISCIPLINE_SAMPLES intervals however often RPCs run.
+ *
+ * The estimate at any moment comes from the sample that gives the
+ * smallest bound then — normally the lowest-RTT one, unless it has aged
+ * past a fresher one — advanced by the estimated drift between the
+ * monotonic crystal and the server clock.  Drift is a least-squares fit
+ * over the window once it spans min_span_us; its uncertainty follows from
+ * the samples' RTT/2 and the span, so the bound
+ *
+ *     error = RTT/2 of that sample + age × drift uncertainty
+ *
+ * holds for any sample error within its RTT/2 at constant drift.  Until
+ * drift is known the uncertainty is the crystal tolerance (wander_ppm).
+ * A sample that contradicts the current bound (the server clock was
+ * stepped, or ours was) restarts the window.
+ *
+ * clock_discipline_sample() also says how to bring the wall clock to the
+ * estimate: step it the first time and for large errors, otherwise slew
+ * it (adjtime) so timestamps never jump.
+ *
+ * Not thread-safe; the caller serialises access.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Intervals kept (the most recent ones). */
+#define CLOCK_DISCIPLINE_SAMPLES  16
+
+typedef struct {
+    int64_t step_threshold_us;  /**< Wall-clock error above which it is stepped, not slewed */
+    int64_t bucket_us;          /**< One sample is kept per interval of this length */
+    int64_t min_span_us;        /**< Window span needed before drift is estimated */
+    uint32_t wander_ppm;        /**< Assumed frequency error while drift is unknown */
+    uint32_t floor_ppb;         /**< Least drift uncertainty ever assumed (temperature wander) */
+} clock_discipline_config_t;
+
+typedef struct {
+    int64_t mono_us;    /**< Monotonic time at the exchange midpoint */
+    int64_t theta_us;   /**< Server time minus mono_us */
+    int64_t rtt_us;
+} clock_sample_t;
+
+typedef enum {
+    CLOCK_CORRECT_NONE = 0,
+    CLOCK_CORRECT_SLEW,         /**< adjtime(delta_us) */
+    CLOCK_CORRECT_STEP,         /**< settimeofday(wall + delta_us) */
+} clock_correct_kind_t;
+
+typedef struct {
+    clock_correct_kind_t kind;
+    int64_t              delta_us;  /**< Estimated server time minus wall clock */
+} clock_correction_t;
+
+typedef struct {
+    clock_discipline_config_t cfg;
+    clock_sample_t samples[CLOCK_DISCIPLINE_SAMPLES];
+    uint8_t  count;
+    uint8_t  next;
+    int64_t  bucket_start_us;   /**< Start of the newest sample's interval */
+    bool     stepped;           /**< Wall clock set at least once */
+    bool     drift_known;
+    int64_t  drift_ppb;         /**< Server clock rate minus monotonic rate */
+    int64_t  drift_err_ppb;     /**< Uncertainty of drift_ppb */
+    int64_t  last_offset_us;    /**< Wall minus server time at the last sample (0 before the first set) */
+    uint32_t samples_taken;
+    uint32_t restarts;          /**< Windows dropped for an inconsistent sample */
+} clock_discipline_t;
+
+void clock_discipline_init(clock_discipline_t *c, const clock_discipline_config_t *cfg);
+
+/**
+ * @brief Add one round trip and say how to correct the wall clock.
+ *
+ * @param sent_mono_us  Monotonic time the request was sent.
+ * @param recv_mono_us  Monotonic time the response arrived.
+ * @param server_us     Server time carried in the response (Unix µs).
+ * @param wall_us       Wall clock (Unix µs) read at recv_mono_us.
+ */
+clock_correction_t clock_discipline_sample(clock_discipline_t *c,
+                                           int64_t sent_mono_us, int64_t recv_mono_us,
+                                           int64_t server_us, int64_t wall_us);
+
+/**
+ * @brief Estimated server time at @p mono_us and its error bound.
+ *
+ * @return false before the first sample.
+ */
+bool clock_discipline_now(const clock_discipline_t *c, int64_t mono_us,
+                          int64_t *server_us, int64_t *error_us);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,97 @@
+/**
+ * @file decision_cache.hpp
+ * @brief Short-lived memo of server grants, keyed by a hashed credential.
+ *
+ * A member who taps again within the server's cache TTL is granted from
+ * here without a round trip; server_comm still reports the tap to the
+ * server (marked cached) so it lands in the audit log, and drops the
+ * entry if the server no longer agrees.
+ *
+ * Only grants are stored — a deny always goes to the server.  Keys are an
+ * opaque DECISION_CACHE_KEY_LEN-byte keyed hash of the credential; the
+ * raw UID never enters the cache.
+ *
+ * Every grant is stamped with the server's policy version.  Seeing a
+ * different version (in any access or heartbeat response) drops the whole
+ * cache, and a grant decided under a version older than the one already
+ * seen is refused, so a revocation cannot be undone by a late answer.
+ *
+ * When full, an expired entry is reused first, otherwise the least
+ * recently used one is evicted.
+ *
+ * Not thread-safe; the caller serialises access.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Bytes of keyed hash kept per credential. */
+#define DECISION_CACHE_KEY_LEN       16
+
+/** Upper bound for the configured capacity. */
+#define DECISION_CACHE_MAX_ENTRIES   32
+
+typedef struct {
+    uint8_t  key[DECISION_CACHE_KEY_LEN];
+    int64_t  expires_ms;        /**< Monotonic ms; 0 = slot free */
+    uint32_t last_used;         /**< Cache clock at insert or last hit */
+} decision_cache_entry_t;
+
+typedef struct {
+    uint32_t hits;              /**< Taps granted from the cache */
+    uint32_t misses;            /**< Lookups that had to ask the server */
+    uint32_t evictions;         /**< Live entries pushed out to make room */
+    uint32_t invalidations;     /**< Entries dropped because the server withdrew them */
+} decision_cache_stats_t;
+
+typedef struct {
+    decision_cache_entry_t entries[DECISION_CACHE_MAX_ENTRIES];
+    uint8_t                capacity;
+    uint32_t               clock;       /**< Bumped on every insert and hit */
+    uint32_t               version;     /**< Server policy version; 0 = none seen */
+    decision_cache_stats_t stats;
+} decision_cache_t;
+
+/** Empty cache holding at most @p capacity entries (clamped; 0 disables). */
+void decision_cache_init(decision_cache_t *c, uint8_t capacity);
+
+/** True if @p key has an unexpired grant at @p now_ms.  Counts a hit or miss. */
+bool decision_cache_lookup(decision_cache_t *c, const uint8_t key[DECISION_CACHE_KEY_LEN],
+                           int64_t now_ms);
+
+/**
+ * @brief Remember a grant for @p ttl_ms.
+ *
+ * @p version is the policy version the grant was decided under; a newer
+ * one than the cache holds is adopted first (dropping older grants), an
+ * older one is refused.  Version 0 means the server sent none and is
+ * accepted as-is.
+ *
+ * @return false if nothing was stored (disabled, ttl 0, or stale version).
+ */
+bool decision_cache_insert(decision_cache_t *c, const uint8_t key[DECISION_CACHE_KEY_LEN],
+                           uint32_t ttl_ms, uint32_t version, int64_t now_ms);
+
+/** Drop the grant for @p key (server denied on re-check).  True if one was held. */
+bool decision_cache_remove(decision_cache_t *c, const uint8_t key[DECISION_CACHE_KEY_LEN]);
+
+/**
+ * @brief Note the server's current policy version.
+ *
+ * A change drops every entry (counted as invalidations); 0 is ignored.
+ * @return Number of entries dropped.
+ */
+uint32_t decision_cache_set_version(decision_cache_t *c, uint32_t version);
+
+/** Drop every entry without counting it; stats and version are kept. */
+void decision_cache_clear(decision_cache_t *c);
+
+#ifdef __cplusplus
+}
+#endif
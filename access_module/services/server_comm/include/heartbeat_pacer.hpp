@@ -0,0 +1,95 @@
+/**
+ * @file heartbeat_pacer.hpp
+ * @brief Decides which heartbeat ticks go to the server.
+ *
+ * heartbeat_service ticks every HEARTBEAT_INTERVAL_MS (base_ms) whatever
+ * happens; the pacer decides whether a tick becomes an RPC.  While the
+ * module is healthy the interval doubles after every answered heartbeat,
+ * up to max_ms.  Any RPC the server answers — a tap, a provisioning call,
+ * a heartbeat — proves the module alive, so the next heartbeat is due an
+ * interval after the latest of them; a busy door still sends one at least
+ * every max_ms so telemetry, the policy version and the revocation filter
+ * keep flowing.
+ *
+ * An anomaly (reader fault, low heap, a reconnect, a static field that
+ * changed, a server asking for the static fields) makes the next tick a
+ * heartbeat and cuts the interval back to base_ms, as does a heartbeat
+ * that got no answer.
+ *
+ * The server can push the next heartbeat back (HeartbeatResponse.
+ * heartbeat_delay_ms) to spread a fleet that is in step; the delay is
+ * added to the schedule, holds anomalies back too, and is capped at max_ms.
+ *
+ * The pacer also keeps the savings counters reported in heartbeats: ticks
+ * not sent, and the protobuf bytes those and static_omitted heartbeats
+ * did not carry.  A skipped tick is charged the size of the last full
+ * exchange.
+ *
+ * Not thread-safe; server_comm uses it from comm_task only.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint32_t base_ms;   /**< Tick period; interval after an anomaly */
+    uint32_t max_ms;    /**< Longest interval (clamped to at least base_ms) */
+} heartbeat_pacer_config_t;
+
+typedef struct {
+    uint32_t sent;          /**< Heartbeats sent */
+    uint32_t skipped;       /**< Ticks not sent (RPCs saved) */
+    uint32_t bytes_saved;   /**< Protobuf bytes not sent, both directions */
+    uint32_t anomalies;     /**< Ticks forced by an anomaly */
+} heartbeat_pacer_stats_t;
+
+typedef struct {
+    heartbeat_pacer_config_t cfg;
+    uint32_t interval_ms;       /**< Current interval */
+    bool     started;           /**< A heartbeat has been sent */
+    bool     urgent;            /**< Next tick sends */
+    uint32_t defer_ms;          /**< Server-requested delay on top of the schedule */
+    int64_t  last_sent_ms;
+    int64_t  last_proof_ms;     /**< Last RPC the server answered */
+    uint32_t exchange_bytes;    /**< Request + response size of the last full heartbeat */
+    heartbeat_pacer_stats_t stats;
+} heartbeat_pacer_t;
+
+void heartbeat_pacer_init(heartbeat_pacer_t *p, const heartbeat_pacer_config_t *cfg);
+
+/** The server answered an RPC at @p now_ms. */
+void heartbeat_pacer_note_rpc(heartbeat_pacer_t *p, int64_t now_ms);
+
+/** Something the server should hear about now: send on the next tick. */
+void heartbeat_pacer_note_anomaly(heartbeat_pacer_t *p);
+
+/** The server asked for the next heartbeat @p delay_ms later than scheduled. */
+void heartbeat_pacer_defer(heartbeat_pacer_t *p, uint32_t delay_ms);
+
+/**
+ * @brief Whether the tick at @p now_ms should be sent.
+ *
+ * A tick that is not sent is counted as skipped.
+ */
+bool heartbeat_pacer_due(heartbeat_pacer_t *p, int64_t now_ms);
+
+/**
+ * @brief Record a heartbeat that was sent at @p now_ms.
+ *
+ * @param answered       The server answered it.
+ * @param req_bytes      Encoded request size as sent.
+ * @param resp_bytes     Encoded response size (0 if not answered).
+ * @param omitted_bytes  Bytes left out by static_omitted (0 for a full one).
+ */
+void heartbeat_pacer_sent(heartbeat_pacer_t *p, int64_t now_ms, bool answered,
+                          uint32_t req_bytes, uint32_t resp_bytes, uint32_t omitted_bytes);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,90 @@
+/**
+ * @file revocation_filter.hpp
+ * @brief Xor filter of revoked credentials, built by the server.
+ *
+ * The server publishes (in heartbeat responses) an 8-bit xor filter over
+ * the tags of every credential it would deny at any door — member
+ * disabled, suspended, expired or archived.  server_comm checks a tap
+ * against it on the reactor and denies a hit locally, without a round
+ * trip, so a lost or revoked card never reaches the comm queue.
+ *
+ * A tag is the first 8 bytes (little-endian) of HMAC-SHA256(filter key,
+ * UID); the key comes with the filter.  Lookups never miss a revoked tag
+ * but match about 1 in 256 others.  The server lists the tags of active
+ * credentials that collide as exceptions, and server_comm adds any the
+ * server later grants, so a false positive is passed through to the
+ * server instead of denied.  The server only knows a tag once it has seen
+ * the card, so it withholds the filter while any active credential is
+ * still untagged.
+ *
+ * Construction (revocation_filter_build) is here for host tooling and
+ * tests; it must stay bit-for-bit identical to server/internal/revfilter.
+ *
+ * Not thread-safe; the caller serialises access.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Bytes of HMAC key sent with each filter. */
+#define REVOCATION_FILTER_KEY_LEN         32
+
+/** Collision exceptions a filter can carry (server list plus local passes). */
+#define REVOCATION_FILTER_MAX_EXCEPTIONS  16
+
+typedef struct {
+    const uint8_t *fingerprints;    /**< 3 * block_length bytes; not owned */
+    uint32_t       block_length;    /**< 0 = empty filter, matches nothing */
+    uint64_t       seed;
+    uint64_t       exceptions[REVOCATION_FILTER_MAX_EXCEPTIONS];
+    uint8_t        exception_count;
+} revocation_filter_t;
+
+/** Fingerprint bytes a filter over @p entries distinct tags occupies. */
+size_t revocation_filter_bytes(uint32_t entries);
+
+/** Tag for an HMAC digest (its first 8 bytes, LE).  Never 0. */
+uint64_t revocation_filter_tag(const uint8_t digest[8]);
+
+/**
+ * @brief Point @p f at a received filter.
+ *
+ * @p exceptions holds @p exceptions_len / 8 little-endian tags.
+ * @return false (and @p f left empty) if @p len is not a multiple of 3 or
+ *         there are more exceptions than fit.
+ */
+bool revocation_filter_load(revocation_filter_t *f,
+                            const uint8_t *fingerprints, size_t len, uint64_t seed,
+                            const uint8_t *exceptions, size_t exceptions_len);
+
+/** Empty filter: matches nothing. */
+void revocation_filter_clear(revocation_filter_t *f);
+
+/** True if @p tag is (probably) revoked and not an exception. */
+bool revocation_filter_contains(const revocation_filter_t *f, uint64_t tag);
+
+/** Pass @p tag through from now on.  False if the exception list is full. */
+bool revocation_filter_add_exception(revocation_filter_t *f, uint64_t tag);
+
+/**
+ * @brief Build a filter over @p n tags into @p out (host tooling).
+ *
+ * Duplicates are ignored.  Tries successive seeds from @p seed until the
+ * peeling succeeds; the one used is left in f->seed.  @p out must hold
+ * revocation_filter_bytes(n).
+ *
+ * @return false if @p out is too small or no seed worked.
+ */
+bool revocation_filter_build(revocation_filter_t *f, uint8_t *out, size_t out_cap,
+                             const uint64_t *tags, uint32_t n, uint64_t seed);
+
+#ifdef __cplusplus
+}
+#endif
@@ -14,14 +14,21 @@
  *     and publishes access decision events back to the event bus.
  *
  * Handles two event types:
- *   EVENT_HEARTBEAT       → SendHeartbeat RPC      → sync clock, log result
+ *   EVENT_HEARTBEAT       → SendHeartbeat RPC      → clock sample, log result
  *   EVENT_CREDENTIAL_READ → RequestAccess RPC      → publish
  *                           EVENT_ACCESS_GRANTED or EVENT_ACCESS_DENIED
  *
- * Clock synchronisation: each successful heartbeat response carries a
- * server_time field (RFC 3339 UTC).  server_comm applies an RTT/2 correction
- * and calls settimeofday() so the module has a usable wall-clock time.
- * server_comm_clock_synced() returns true once the first sync has succeeded.
+ * Clock synchronisation: heartbeat and access responses carry the server's
+ * time.  server_comm keeps the tightest of those round trips, estimates the
+ * crystal's drift against the server, and derives server time with an
+ * error bound (clock_discipline.hpp).  The wall clock is slewed with
+ * adjtime() towards the estimate; settimeofday() is used only for the first
+ * sample and for errors over 128 ms.
+ *
+ * Connection: the gRPC connection is opened as soon as wifi_mgr reports an
+ * IP address (wifi_mgr_set_ip_callback), not on the first RPC, so at boot
+ * the TLS handshake overlaps the reader and FSM start-up.  Heartbeats carry
+ * the boot timeline (boot_timeline.hpp) until the server has one.
  *
  * Call server_comm_init() after event_bus_init() and wifi_mgr_init().
  */
@@ -56,11 +63,12 @@ extern "C" {
 portunus_err_t server_comm_init(const portunus_device_config_t *cfg);
 
 /**
- * @brief Return true if the module clock has been synchronised at least once.
+ * @brief Return true if server time is known to within PORTUNUS_CLOCK_MAX_ERROR_MS.
  *
- * False at boot and until the first successful heartbeat response is decoded
- * and settimeofday() succeeds.  Used by the access path to decide whether
- * to populate AccessRequest.requested_at for replay protection.
+ * False at boot until the first response with a server time, and again
+ * whenever no sample has arrived for long enough that the error bound has
+ * grown past the limit.  The access path uses the same test to decide
+ * whether to populate AccessRequest.requested_at_us for replay protection.
  */
 bool server_comm_clock_synced(void);
 
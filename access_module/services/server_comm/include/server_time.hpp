@@ -0,0 +1,31 @@
+/**
+ * @file server_time.hpp
+ * @brief Parse the server's RFC 3339 timestamps.
+ *
+ * Protocol v2 servers send Unix microseconds; the RFC 3339 string is only
+ * read from servers that predate it.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <sys/time.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Parse an RFC 3339 UTC timestamp into a struct timeval.
+ *
+ * Accepts the format produced by the Go server: "2006-01-02T15:04:05.999999999Z".
+ * Fractional seconds are optional; the 'Z' suffix is assumed (UTC).
+ * Requires the process timezone to be set to UTC0 (done in server_comm_init).
+ *
+ * @return true on success, false if @p s is empty or malformed.
+ */
+bool parse_server_time(const char *s, struct timeval *out);
+
+#ifdef __cplusplus
+}
+#endif
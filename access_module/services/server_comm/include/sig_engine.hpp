@@ -0,0 +1,73 @@
+/**
+ * @file sig_engine.hpp
+ * @brief HMAC-SHA256 with the key schedule computed once.
+ *
+ * HMAC hashes (key ^ ipad) and (key ^ opad) as the first block of its
+ * inner and outer hash.  Those blocks depend only on the key, so
+ * sig_engine_init() absorbs them once and keeps the two SHA-256 states;
+ * every signature then clones them and hashes just the message and the
+ * inner digest — two compressions for a short projection instead of
+ * mbedtls_md_hmac()'s four, and no md context set up and torn down per
+ * call.
+ *
+ * The key is used as given.  server_comm passes the NVS secret string,
+ * because that is what the server keys its HMAC with ([]byte(secret)).
+ *
+ * The states are plain mbedtls_sha256_context values; the ESP32-S3 SHA
+ * driver keeps a block-mode hash's state in the context between updates,
+ * so a midstate can sit idle without holding the SHA peripheral.
+ *
+ * An initialised engine is only read, so one engine can sign from several
+ * tasks.  Builds on the host against upstream mbedtls
+ * (see test/host/test_sig_engine.cpp).
+ */
+
+#pragma once
+
+#include "mbedtls/sha256.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define SIG_ENGINE_MAC_LEN  32
+/** Lowercase hex MAC plus NUL (same as PORTUNUS_HMAC_HEX_LEN). */
+#define SIG_ENGINE_HEX_LEN  (SIG_ENGINE_MAC_LEN * 2 + 1)
+
+typedef struct {
+    mbedtls_sha256_context inner;   /**< After absorbing key ^ ipad */
+    mbedtls_sha256_context outer;   /**< After absorbing key ^ opad */
+    bool                   ready;
+} sig_engine_t;
+
+/** Precompute the key schedule.  False on an mbedtls error (engine unusable). */
+bool sig_engine_init(sig_engine_t *e, const uint8_t *key, size_t key_len);
+
+/** Release the states and wipe them. */
+void sig_engine_free(sig_engine_t *e);
+
+/** HMAC-SHA256(key, data). */
+bool sig_engine_mac(const sig_engine_t *e, const uint8_t *data, size_t len,
+                    uint8_t mac[SIG_ENGINE_MAC_LEN]);
+
+/** HMAC-SHA256(key, data) as lowercase hex, NUL-terminated. */
+bool sig_engine_sign_hex(const sig_engine_t *e, const uint8_t *data, size_t len,
+                         char out_hex[SIG_ENGINE_HEX_LEN]);
+
+/**
+ * @brief True if @p sig_hex is the lowercase hex MAC of @p data.
+ *
+ * Reads exactly SIG_ENGINE_HEX_LEN - 1 chars of @p sig_hex and compares
+ * all of them whatever the first mismatch, so the time taken says nothing
+ * about how much of a forged signature was right.
+ */
+bool sig_engine_verify_hex(const sig_engine_t *e, const uint8_t *data, size_t len,
+                           const char *sig_hex);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,81 @@
+/**
+ * @file tap_retry.hpp
+ * @brief Retry policy for access requests that hit a dead connection.
+ *
+ * The first RequestAccess after an idle spell often rides a connection the
+ * server or a NAT has already dropped without telling us.  Instead of
+ * denying the member, tap_retry_run() gives the first attempt on a reused
+ * connection only a short probe budget, drops the connection on a
+ * connection-level failure, and tries again on a fresh one with whatever
+ * is left of the tap deadline.
+ *
+ * Every attempt sends the same encoded request (same nonce, same
+ * requested_at); the server answers a repeated nonce with the decision it
+ * already made, so a retry never produces a second decision.
+ */
+
+#pragma once
+
+#include "error_codes.hpp"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    uint8_t  max_attempts;    /**< Attempts per tap, including the first (>= 1) */
+    uint32_t probe_ms;        /**< Cap for an attempt on a reused connection */
+    uint32_t min_attempt_ms;  /**< Do not start a retry with less budget than this */
+    uint32_t max_attempt_ms;  /**< Cap for any attempt (the RPC timeout) */
+} tap_retry_policy_t;
+
+/** Hooks into the transport.  All take the ctx passed to tap_retry_run(). */
+typedef struct {
+    /** Milliseconds left before the tap deadline (INT64_MAX if none). */
+    int64_t        (*remaining_ms)(void *ctx);
+    /** True if the next attempt would reuse an already-open connection. */
+    bool           (*connection_open)(void *ctx);
+    /** Send the request with at most @p budget_ms to get an answer. */
+    portunus_err_t (*attempt)(void *ctx, uint32_t budget_ms);
+    /** Tear down the connection so the next attempt reconnects. */
+    void           (*drop_connection)(void *ctx);
+} tap_retry_ops_t;
+
+typedef struct {
+    portunus_err_t err;       /**< Result of the last attempt */
+    uint8_t        attempts;  /**< Attempts made (0 if the budget was already gone) */
+} tap_retry_result_t;
+
+/** True for failures a fresh connection can fix (reset, EOF, no answer). */
+bool tap_retry_is_retryable(portunus_err_t err);
+
+/**
+ * @brief Budget for the next attempt.
+ *
+ * An attempt on a reused connection is capped at probe_ms when a retry
+ * would still fit after it; otherwise, and on a fresh connection or the
+ * last attempt, it gets everything left (up to max_attempt_ms).
+ *
+ * @param attempt  Zero-based index of the attempt about to start.
+ * @param reused   The attempt will use an already-open connection.
+ * @return Budget in ms, or 0 if the attempt should not be started.
+ */
+uint32_t tap_retry_attempt_ms(const tap_retry_policy_t *policy, uint8_t attempt,
+                              int64_t remaining_ms, bool reused);
+
+/**
+ * @brief Send one tap request, retrying connection-level failures.
+ *
+ * Stops at the first attempt that gets an answer (PORTUNUS_OK, whatever the
+ * gRPC status), on a non-retryable error, when attempts run out, or when
+ * the remaining budget is below min_attempt_ms.
+ */
+tap_retry_result_t tap_retry_run(const tap_retry_policy_t *policy,
+                                 const tap_retry_ops_t *ops, void *ctx);
+
+#ifdef __cplusplus
+}
+#endif
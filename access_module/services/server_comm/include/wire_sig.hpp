@@ -0,0 +1,60 @@
+/**
+ * @file wire_sig.hpp
+ * @brief Binary projections signed with the module HMAC (protocol version 2).
+ *
+ * A projection is a kind byte, the version byte, then the signed fields in
+ * a fixed order: strings and byte arrays as a 1-byte length and the bytes,
+ * integers little-endian at fixed width.  Building one is a handful of
+ * memcpys — no snprintf, no hex or timestamp formatting — and the
+ * length prefixes keep fields apart without reserving a separator.
+ *
+ * The layout is documented under "Protocol versions" in
+ * proto/portunus/v1/portunus.proto and must stay byte-for-byte identical
+ * to server/internal/wiresig; test/host/test_wire_sig.cpp pins the same
+ * golden projections as the server's tests.
+ *
+ * Each builder writes into @p out and returns the projection length, or 0
+ * if a field is over 255 bytes or the projection does not fit in @p cap.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** protocol_version sent by this firmware. */
+#define WIRE_SIG_VERSION  2
+
+/** Room for any projection of fields within their nanopb sizes (access: 90). */
+#define WIRE_SIG_MAX_LEN  96
+
+size_t wire_sig_heartbeat(uint8_t *out, size_t cap,
+                          const char *module_id, uint32_t sequence);
+
+size_t wire_sig_access(uint8_t *out, size_t cap,
+                       const char *module_id, const char *credential_id,
+                       const uint8_t *nonce, size_t nonce_len,
+                       int64_t requested_at_us);
+
+/**
+ * Projection the server signs over its decision; verify before acting.
+ * Covers the cache TTL and policy version too, since both decide how long
+ * the module may reuse a grant.
+ */
+size_t wire_sig_access_response(uint8_t *out, size_t cap,
+                                const char *module_id, const char *credential_id,
+                                bool granted, uint32_t cache_ttl_s,
+                                uint32_t policy_version);
+
+size_t wire_sig_provision(uint8_t *out, size_t cap,
+                          const char *module_id,
+                          const uint8_t *credential_uid, size_t uid_len);
+
+#ifdef __cplusplus
+}
+#endif
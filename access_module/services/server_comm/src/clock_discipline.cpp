@@ -0,0 +1,178 @@
+/**
+ * @file clock_discipline.cpp
+ * @brief Server-time estimate with a hard error bound — implementation.
+ */
+
+#include "clock_discipline.hpp"
+
+#include <string.h>
+
+/* Past this the fit is taken to be wrong, not the crystal. */
+#define MAX_DRIFT_PPB        500000
+/* Samples slower than this multiple of the fastest are left out of the fit. */
+#define FIT_RTT_FACTOR       4
+
+static int64_t abs64(int64_t v) { return v < 0 ? -v : v; }
+
+static int64_t uncertainty_ppb(const clock_discipline_t *c)
+{
+    if (!c->drift_known) {
+        return (int64_t)c->cfg.wander_ppm * 1000;
+    }
+    return c->drift_err_ppb > (int64_t)c->cfg.floor_ppb ? c->drift_err_ppb
+                                                       : (int64_t)c->cfg.floor_ppb;
+}
+
+static int64_t predict_theta(const clock_discipline_t *c, const clock_sample_t *s, int64_t mono_us)
+{
+    int64_t drift = c->drift_known ? c->drift_ppb : 0;
+    return s->theta_us + (mono_us - s->mono_us) * drift / 1000000000LL;
+}
+
+static int64_t bound_at(const clock_discipline_t *c, const clock_sample_t *s, int64_t mono_us)
+{
+    return s->rtt_us / 2 + abs64(mono_us - s->mono_us) * uncertainty_ppb(c) / 1000000000LL + 1;
+}
+
+static const clock_sample_t *best_at(const clock_discipline_t *c, int64_t mono_us)
+{
+    const clock_sample_t *best = NULL;
+    int64_t best_bound = 0;
+    for (uint8_t i = 0; i < c->count; i++) {
+        int64_t b = bound_at(c, &c->samples[i], mono_us);
+        if (best == NULL || b < best_bound) {
+            best = &c->samples[i];
+            best_bound = b;
+        }
+    }
+    return best;
+}
+
+/* Least squares of theta against mono over the fast samples.  The slope
+   error is sum(|dx| * rtt/2) / sum(dx^2) at worst, for sample errors
+   within RTT/2. */
+static void fit_drift(clock_discipline_t *c)
+{
+    c->drift_known = false;
+    int64_t min_rtt = INT64_MAX;
+    for (uint8_t i = 0; i < c->count; i++) {
+        if (c->samples[i].rtt_us < min_rtt) { min_rtt = c->samples[i].rtt_us; }
+    }
+    int64_t rtt_cap = min_rtt * FIT_RTT_FACTOR + 1000;
+
+    int64_t first = INT64_MAX, last = INT64_MIN;
+    double n = 0, mx = 0, my = 0;
+    for (uint8_t i = 0; i < c->count; i++) {
+        const clock_sample_t *s = &c->samples[i];
+        if (s->rtt_us > rtt_cap) { continue; }
+        if (s->mono_us < first) { first = s->mono_us; }
+        if (s->mono_us > last)  { last = s->mono_us; }
+        n  += 1;
+        mx += (double)s->mono_us;
+        my += (double)s->theta_us;
+    }
+    if (n < 3 || last - first < c->cfg.min_span_us) {
+        return;
+    }
+    mx /= n;
+    my /= n;
+
+    double sxx = 0, sxy = 0, worst = 0;
+    for (uint8_t i = 0; i < c->count; i++) {
+        const clock_sample_t *s = &c->samples[i];
+        if (s->rtt_us > rtt_cap) { continue; }
+        double dx = (double)s->mono_us - mx;
+        sxx   += dx * dx;
+        sxy   += dx * ((double)s->theta_us - my);
+        worst += (dx < 0 ? -dx : dx) * (double)(s->rtt_us / 2 + 1);
+    }
+    int64_t drift = (int64_t)(sxy / sxx * 1e9);
+    if (abs64(drift) > MAX_DRIFT_PPB) {
+        return;
+    }
+    c->drift_ppb     = drift;
+    c->drift_err_ppb = (int64_t)(worst / sxx * 1e9) + 1;
+    c->drift_known   = c->drift_err_ppb < (int64_t)c->cfg.wander_ppm * 1000;
+}
+
+static void restart(clock_discipline_t *c)
+{
+    c->count       = 0;
+    c->next        = 0;
+    c->drift_known = false;
+    c->restarts++;
+}
+
+void clock_discipline_init(clock_discipline_t *c, const clock_discipline_config_t *cfg)
+{
+    memset(c, 0, sizeof(*c));
+    c->cfg = *cfg;
+}
+
+clock_correction_t clock_discipline_sample(clock_discipline_t *c,
+                                           int64_t sent_mono_us, int64_t recv_mono_us,
+                                           int64_t server_us, int64_t wall_us)
+{
+    clock_correction_t out = {CLOCK_CORRECT_NONE, 0};
+    if (recv_mono_us < sent_mono_us || server_us <= 0) {
+        return out;
+    }
+
+    clock_sample_t s;
+    s.rtt_us   = recv_mono_us - sent_mono_us;
+    s.mono_us  = sent_mono_us + s.rtt_us / 2;
+    s.theta_us = server_us - s.mono_us;
+    c->samples_taken++;
+
+    /* Both bounds hold if nothing moved, so disagreement beyond them means
+       a clock was stepped: start over from this sample. */
+    const clock_sample_t *best = best_at(c, s.mono_us);
+    if (best != NULL &&
+        abs64(s.theta_us - predict_theta(c, best, s.mono_us)) >
+            bound_at(c, best, s.mono_us) + s.rtt_us / 2) {
+        restart(c);
+    }
+
+    uint8_t newest = (uint8_t)((c->next + CLOCK_DISCIPLINE_SAMPLES - 1) % CLOCK_DISCIPLINE_SAMPLES);
+    if (c->count > 0 && s.mono_us - c->bucket_start_us < c->cfg.bucket_us) {
+        /* Same interval: keep whichever is tighter now. */
+        if (s.rtt_us / 2 < bound_at(c, &c->samples[newest], s.mono_us)) {
+            c->samples[newest] = s;
+        }
+    } else {
+        c->samples[c->next] = s;
+        c->next = (uint8_t)((c->next + 1) % CLOCK_DISCIPLINE_SAMPLES);
+        if (c->count < CLOCK_DISCIPLINE_SAMPLES) { c->count++; }
+        c->bucket_start_us = s.mono_us;
+    }
+    fit_drift(c);
+
+    int64_t est_us, err_us;
+    clock_discipline_now(c, recv_mono_us, &est_us, &err_us);
+    out.delta_us = est_us - wall_us;
+    if (!c->stepped) {
+        /* Setting the clock at boot is not an error worth reporting. */
+        out.kind   = CLOCK_CORRECT_STEP;
+        c->stepped = true;
+        return out;
+    }
+    c->last_offset_us = -out.delta_us;
+    if (abs64(out.delta_us) > c->cfg.step_threshold_us) {
+        out.kind = CLOCK_CORRECT_STEP;
+    } else {
+        out.kind = CLOCK_CORRECT_SLEW;
+    }
+    return out;
+}
+
+bool clock_discipline_now(const clock_discipline_t *c, int64_t mono_us,
+                          int64_t *server_us, int64_t *error_us)
+{
+    const clock_sample_t *best = best_at(c, mono_us);
+    if (best == NULL) {
+        return false;
+    }
+    *server_us = mono_us + predict_theta(c, best, mono_us);
+    *error_us  = bound_at(c, best, mono_us);
+    return true;
+}
@@ -0,0 +1,137 @@
+/**
+ * @file decision_cache.cpp
+ * @brief Short-lived memo of server grants — implementation.
+ */
+
+#include "decision_cache.hpp"
+
+#include <string.h>
+
+static bool live(const decision_cache_entry_t *e, int64_t now_ms)
+{
+    return e->expires_ms != 0 && now_ms < e->expires_ms;
+}
+
+static decision_cache_entry_t *find(decision_cache_t *c, const uint8_t *key)
+{
+    for (uint8_t i = 0; i < c->capacity; i++) {
+        decision_cache_entry_t *e = &c->entries[i];
+        if (e->expires_ms != 0 && memcmp(e->key, key, DECISION_CACHE_KEY_LEN) == 0) {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+/** Free slot, else an expired one, else the least recently used (evicted). */
+static decision_cache_entry_t *victim(decision_cache_t *c, int64_t now_ms)
+{
+    decision_cache_entry_t *lru = NULL;
+    for (uint8_t i = 0; i < c->capacity; i++) {
+        decision_cache_entry_t *e = &c->entries[i];
+        if (!live(e, now_ms)) {
+            return e;
+        }
+        /* Wrap-safe: older means further behind the clock. */
+        if (lru == NULL || c->clock - e->last_used > c->clock - lru->last_used) {
+            lru = e;
+        }
+    }
+    c->stats.evictions++;
+    return lru;
+}
+
+static uint32_t drop_all(decision_cache_t *c)
+{
+    uint32_t n = 0;
+    for (uint8_t i = 0; i < c->capacity; i++) {
+        if (c->entries[i].expires_ms != 0) {
+            c->entries[i].expires_ms = 0;
+            n++;
+        }
+    }
+    return n;
+}
+
+void decision_cache_init(decision_cache_t *c, uint8_t capacity)
+{
+    memset(c, 0, sizeof(*c));
+    c->capacity = (capacity > DECISION_CACHE_MAX_ENTRIES) ? DECISION_CACHE_MAX_ENTRIES : capacity;
+}
+
+bool decision_cache_lookup(decision_cache_t *c, const uint8_t key[DECISION_CACHE_KEY_LEN],
+                           int64_t now_ms)
+{
+    if (c->capacity == 0) {
+        return false;
+    }
+    decision_cache_entry_t *e = find(c, key);
+    if (e != NULL && !live(e, now_ms)) {
+        e->expires_ms = 0;
+        e = NULL;
+    }
+    if (e == NULL) {
+        c->stats.misses++;
+        return false;
+    }
+    e->last_used = ++c->clock;
+    c->stats.hits++;
+    return true;
+}
+
+bool decision_cache_insert(decision_cache_t *c, const uint8_t key[DECISION_CACHE_KEY_LEN],
+                           uint32_t ttl_ms, uint32_t version, int64_t now_ms)
+{
+    if (c->capacity == 0 || ttl_ms == 0) {
+        return false;
+    }
+    if (version != 0 && c->version != 0 && version != c->version) {
+        /* Server versions only move forward; compare wrap-safe. */
+        if ((int32_t)(version - c->version) < 0) {
+            return false;
+        }
+        decision_cache_set_version(c, version);
+    } else if (version != 0) {
+        c->version = version;
+    }
+
+    decision_cache_entry_t *e = find(c, key);
+    if (e == NULL) {
+        e = victim(c, now_ms);
+        memcpy(e->key, key, DECISION_CACHE_KEY_LEN);
+    }
+    e->expires_ms = now_ms + ttl_ms;
+    e->last_used  = ++c->clock;
+    return true;
+}
+
+bool decision_cache_remove(decision_cache_t *c, const uint8_t key[DECISION_CACHE_KEY_LEN])
+{
+    decision_cache_entry_t *e = find(c, key);
+    if (e == NULL) {
+        return false;
+    }
+    e->expires_ms = 0;
+    c->stats.invalidations++;
+    return true;
+}
+
+uint32_t decision_cache_set_version(decision_cache_t *c, uint32_t version)
+{
+    if (version == 0 || version == c->version) {
+        return 0;
+    }
+    bool first = (c->version == 0);
+    c->version = version;
+    if (first) {
+        return 0;
+    }
+    uint32_t n = drop_all(c);
+    c->stats.invalidations += n;
+    return n;
+}
+
+void decision_cache_clear(decision_cache_t *c)
+{
+    drop_all(c);
+}
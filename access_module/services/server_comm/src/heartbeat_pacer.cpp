@@ -0,0 +1,88 @@
+/**
+ * @file heartbeat_pacer.cpp
+ * @brief Decides which heartbeat ticks go to the server — implementation.
+ */
+
+#include "heartbeat_pacer.hpp"
+
+#include <string.h>
+
+void heartbeat_pacer_init(heartbeat_pacer_t *p, const heartbeat_pacer_config_t *cfg)
+{
+    memset(p, 0, sizeof(*p));
+    p->cfg = *cfg;
+    if (p->cfg.max_ms < p->cfg.base_ms) {
+        p->cfg.max_ms = p->cfg.base_ms;
+    }
+    p->interval_ms = p->cfg.base_ms;
+}
+
+void heartbeat_pacer_note_rpc(heartbeat_pacer_t *p, int64_t now_ms)
+{
+    if (now_ms > p->last_proof_ms) {
+        p->last_proof_ms = now_ms;
+    }
+}
+
+void heartbeat_pacer_note_anomaly(heartbeat_pacer_t *p)
+{
+    p->urgent      = true;
+    p->interval_ms = p->cfg.base_ms;
+}
+
+void heartbeat_pacer_defer(heartbeat_pacer_t *p, uint32_t delay_ms)
+{
+    p->defer_ms = delay_ms < p->cfg.max_ms ? delay_ms : p->cfg.max_ms;
+}
+
+bool heartbeat_pacer_due(heartbeat_pacer_t *p, int64_t now_ms)
+{
+    if (!p->started) {
+        if (p->urgent) {
+            p->stats.anomalies++;
+        }
+        return true;
+    }
+
+    /* Ticks land a base period apart; one within half a tick of the
+       deadline is the one that meets it. */
+    int64_t slack_ms = p->cfg.base_ms / 2;
+    int64_t defer_ms = p->defer_ms;
+    int64_t since_sent_ms = now_ms - p->last_sent_ms;
+    if (since_sent_ms + slack_ms >= defer_ms) {
+        if (p->urgent) {
+            p->stats.anomalies++;
+            return true;
+        }
+        if (since_sent_ms + slack_ms >= (int64_t)p->cfg.max_ms + defer_ms) {
+            return true;
+        }
+        int64_t last_ms = p->last_proof_ms > p->last_sent_ms ? p->last_proof_ms : p->last_sent_ms;
+        if (now_ms - last_ms + slack_ms >= (int64_t)p->interval_ms + defer_ms) {
+            return true;
+        }
+    }
+
+    p->stats.skipped++;
+    p->stats.bytes_saved += p->exchange_bytes;
+    return false;
+}
+
+void heartbeat_pacer_sent(heartbeat_pacer_t *p, int64_t now_ms, bool answered,
+                          uint32_t req_bytes, uint32_t resp_bytes, uint32_t omitted_bytes)
+{
+    p->started      = true;
+    p->urgent       = false;
+    p->defer_ms     = 0;
+    p->last_sent_ms = now_ms;
+    p->stats.sent++;
+    p->stats.bytes_saved += omitted_bytes;
+
+    if (!answered) {
+        p->interval_ms = p->cfg.base_ms;
+        return;
+    }
+    heartbeat_pacer_note_rpc(p, now_ms);
+    p->exchange_bytes = req_bytes + omitted_bytes + resp_bytes;
+    p->interval_ms = p->interval_ms > p->cfg.max_ms / 2 ? p->cfg.max_ms : p->interval_ms * 2;
+}
@@ -0,0 +1,267 @@
+/**
+ * @file revocation_filter.cpp
+ * @brief Xor filter of revoked credentials — implementation.
+ *
+ * Hashing, sizing and construction mirror server/internal/revfilter/xor.go;
+ * test_revocation_filter.cpp pins both to the same golden filter.
+ */
+
+#include "revocation_filter.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+/* Peeling fails with small probability; each retry uses a fresh seed. */
+#define BUILD_MAX_ATTEMPTS  64
+
+static uint64_t mix64(uint64_t h)
+{
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static uint64_t next_seed(uint64_t seed)
+{
+    return mix64(seed + 0x9e3779b97f4a7c15ULL);
+}
+
+static uint64_t rotl64(uint64_t x, unsigned r)
+{
+    return (x << r) | (x >> (64 - r));
+}
+
+static uint32_t reduce(uint32_t x, uint32_t n)
+{
+    return (uint32_t)(((uint64_t)x * n) >> 32);
+}
+
+static uint8_t fingerprint(uint64_t h)
+{
+    return (uint8_t)(h ^ (h >> 32));
+}
+
+static void slots(uint64_t h, uint32_t block_length, uint32_t out[3])
+{
+    out[0] = reduce((uint32_t)h, block_length);
+    out[1] = reduce((uint32_t)rotl64(h, 21), block_length) + block_length;
+    out[2] = reduce((uint32_t)rotl64(h, 42), block_length) + 2 * block_length;
+}
+
+static uint32_t block_length_for(uint32_t entries)
+{
+    if (entries == 0) {
+        return 0;
+    }
+    /* 1.23 slots per entry plus slack, in integers so both sides agree. */
+    uint64_t capacity = 32 + ((uint64_t)entries * 123 + 99) / 100;
+    return (uint32_t)(capacity / 3);
+}
+
+size_t revocation_filter_bytes(uint32_t entries)
+{
+    return (size_t)block_length_for(entries) * 3;
+}
+
+uint64_t revocation_filter_tag(const uint8_t digest[8])
+{
+    uint64_t t = 0;
+    for (int i = 7; i >= 0; i--) {
+        t = (t << 8) | digest[i];
+    }
+    return (t == 0) ? 1 : t;
+}
+
+void revocation_filter_clear(revocation_filter_t *f)
+{
+    memset(f, 0, sizeof(*f));
+}
+
+bool revocation_filter_load(revocation_filter_t *f,
+                            const uint8_t *fingerprints, size_t len, uint64_t seed,
+                            const uint8_t *exceptions, size_t exceptions_len)
+{
+    revocation_filter_clear(f);
+    if (len % 3 != 0 || exceptions_len % 8 != 0 ||
+        exceptions_len / 8 > REVOCATION_FILTER_MAX_EXCEPTIONS) {
+        return false;
+    }
+    f->fingerprints = fingerprints;
+    f->block_length = (uint32_t)(len / 3);
+    f->seed         = seed;
+    for (size_t i = 0; i < exceptions_len / 8; i++) {
+        f->exceptions[i] = revocation_filter_tag(exceptions + 8 * i);
+    }
+    f->exception_count = (uint8_t)(exceptions_len / 8);
+    return true;
+}
+
+bool revocation_filter_contains(const revocation_filter_t *f, uint64_t tag)
+{
+    if (f->block_length == 0) {
+        return false;
+    }
+    uint64_t h = mix64(tag + f->seed);
+    uint32_t s[3];
+    slots(h, f->block_length, s);
+    if (fingerprint(h) != (f->fingerprints[s[0]] ^ f->fingerprints[s[1]] ^ f->fingerprints[s[2]])) {
+        return false;
+    }
+    for (uint8_t i = 0; i < f->exception_count; i++) {
+        if (f->exceptions[i] == tag) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool revocation_filter_add_exception(revocation_filter_t *f, uint64_t tag)
+{
+    for (uint8_t i = 0; i < f->exception_count; i++) {
+        if (f->exceptions[i] == tag) {
+            return true;
+        }
+    }
+    if (f->exception_count >= REVOCATION_FILTER_MAX_EXCEPTIONS) {
+        return false;
+    }
+    f->exceptions[f->exception_count++] = tag;
+    return true;
+}
+
+/* ── Construction (host tooling) ─────────────────────────────────────────── */
+
+static int cmp_u64(const void *a, const void *b)
+{
+    uint64_t x = *(const uint64_t *)a;
+    uint64_t y = *(const uint64_t *)b;
+    return (x > y) - (x < y);
+}
+
+/** One peeling attempt; fills @p fp on success. */
+static bool peel(const uint64_t *keys, uint32_t n, uint64_t seed, uint32_t block_length,
+                 uint8_t *fp, uint64_t *xormask, uint32_t *count,
+                 uint32_t *queue, uint64_t *stack_hash, uint32_t *stack_slot)
+{
+    uint32_t capacity = 3 * block_length;
+    memset(xormask, 0, capacity * sizeof(*xormask));
+    memset(count, 0, capacity * sizeof(*count));
+
+    for (uint32_t k = 0; k < n; k++) {
+        uint64_t h = mix64(keys[k] + seed);
+        uint32_t s[3];
+        slots(h, block_length, s);
+        for (int j = 0; j < 3; j++) {
+            xormask[s[j]] ^= h;
+            count[s[j]]++;
+        }
+    }
+
+    uint32_t qlen = 0;
+    for (uint32_t i = 0; i < capacity; i++) {
+        if (count[i] == 1) {
+            queue[qlen++] = i;
+        }
+    }
+
+    uint32_t peeled = 0;
+    while (qlen > 0) {
+        uint32_t i = queue[--qlen];
+        if (count[i] != 1) {
+            continue;
+        }
+        uint64_t h = xormask[i];
+        stack_hash[peeled] = h;
+        stack_slot[peeled] = i;
+        peeled++;
+        uint32_t s[3];
+        slots(h, block_length, s);
+        for (int j = 0; j < 3; j++) {
+            xormask[s[j]] ^= h;
+            if (--count[s[j]] == 1) {
+                queue[qlen++] = s[j];
+            }
+        }
+    }
+    if (peeled != n) {
+        return false;
+    }
+
+    memset(fp, 0, capacity);
+    for (uint32_t p = n; p-- > 0;) {
+        uint64_t h = stack_hash[p];
+        uint32_t s[3];
+        slots(h, block_length, s);
+        fp[stack_slot[p]] = 0;
+        fp[stack_slot[p]] = (uint8_t)(fingerprint(h) ^ fp[s[0]] ^ fp[s[1]] ^ fp[s[2]]);
+    }
+    return true;
+}
+
+bool revocation_filter_build(revocation_filter_t *f, uint8_t *out, size_t out_cap,
+                             const uint64_t *tags, uint32_t n, uint64_t seed)
+{
+    revocation_filter_clear(f);
+
+    uint64_t *keys = (uint64_t *)malloc((n ? n : 1) * sizeof(*keys));
+    if (keys == NULL) {
+        return false;
+    }
+    if (n > 0) {
+        memcpy(keys, tags, n * sizeof(*keys));
+        qsort(keys, n, sizeof(*keys), cmp_u64);
+    }
+    uint32_t unique = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        if (unique == 0 || keys[unique - 1] != keys[i]) {
+            keys[unique++] = keys[i];
+        }
+    }
+
+    uint32_t block_length = block_length_for(unique);
+    uint32_t capacity     = 3 * block_length;
+    if (out_cap < capacity) {
+        free(keys);
+        return false;
+    }
+    if (unique == 0) {
+        free(keys);
+        f->fingerprints = out;
+        f->seed         = seed;
+        return true;
+    }
+
+    uint64_t *xormask    = (uint64_t *)malloc(capacity * sizeof(uint64_t));
+    uint32_t *count      = (uint32_t *)malloc(capacity * sizeof(uint32_t));
+    uint32_t *queue      = (uint32_t *)malloc(capacity * sizeof(uint32_t));
+    uint64_t *stack_hash = (uint64_t *)malloc(unique * sizeof(uint64_t));
+    uint32_t *stack_slot = (uint32_t *)malloc(unique * sizeof(uint32_t));
+
+    bool ok = false;
+    if (xormask && count && queue && stack_hash && stack_slot) {
+        for (int attempt = 0; attempt < BUILD_MAX_ATTEMPTS && !ok; attempt++) {
+            ok = peel(keys, unique, seed, block_length, out,
+                      xormask, count, queue, stack_hash, stack_slot);
+            if (!ok) {
+                seed = next_seed(seed);
+            }
+        }
+    }
+
+    free(stack_slot);
+    free(stack_hash);
+    free(queue);
+    free(count);
+    free(xormask);
+    free(keys);
+
+    if (ok) {
+        f->fingerprints = out;
+        f->block_length = block_length;
+        f->seed         = seed;
+    }
+    return ok;
+}
@@ -8,11 +8,69 @@
  *   encodes protobuf, sends the request to the server via gRPC, and publishes
  *   the result (access decisions) back to the event bus.
  *
- *   A single persistent HTTP/2+TLS connection is reused across calls with
- *   exponential-backoff reconnect and periodic keepalive PINGs.
+ *   A single persistent HTTP/2+TLS connection is reused across calls.  Idle
+ *   periods are covered by keepalive PINGs whose interval adapts to the
+ *   path (link_timing.hpp); a PING that goes unanswered closes the
+ *   connection and comm_task reconnects in the background, before the
+ *   next tap, at a random point within PORTUNUS_GRPC_RECONNECT_BASE_MS so
+ *   a fleet that lost the same server does not come back in one burst.
+ *   Heartbeats wait out grpc_client's reconnect backoff; taps never do.
  *
  *   All I/O is blocking and runs entirely on the comm_task stack, so the
  *   event bus dispatcher is never blocked.
+ *
+ *   Tap requests (credential reads, provisioning) go to the front of the
+ *   queue and hold a task_boost: comm_task runs at SERVER_COMM_BOOST_PRIORITY
+ *   from the moment one is queued until none is pending, then drops back to
+ *   SERVER_COMM_TASK_PRIORITY for heartbeats.
+ *
+ *   Every credential read carries a deadline (tap time + TAP_DEADLINE_MS).
+ *   It is checked when the request is dequeued, again just before it is
+ *   sent, and when the decision comes back; the remainder goes to the
+ *   server as grpc-timeout.  A tap that misses it is denied as "stale"
+ *   and counted in tap_stats (heartbeat stale_taps), as are grants the FSM
+ *   refuses for arriving after it.
+ *
+ *   An access request that hits a dead connection is retried on a fresh
+ *   one within the same deadline (tap_retry.hpp); the first attempt on a
+ *   reused connection gets only PORTUNUS_TAP_PROBE_TIMEOUT_MS so a
+ *   half-open connection is noticed early.
+ *
+ *   Grants the server marks cacheable (cache_ttl_s) are remembered in
+ *   s_decision_cache (decision_cache.hpp).  A repeat tap that hits it is
+ *   granted on the reactor, without a round trip, and queued behind any
+ *   taps, unboosted, as an audit report (AccessRequest.cached).  A deny on
+ *   that report drops the entry; a new policy_version in any heartbeat
+ *   or verified access response drops them all.
+ *
+ *   Heartbeats also keep a revocation filter current (revocation_filter.hpp):
+ *   an xor filter over the tags of credentials the server denies
+ *   everywhere.  It is checked on the reactor before the decision cache; a
+ *   hit is denied at once and queued, unboosted, as an audit report
+ *   (AccessRequest.filtered).  A grant on that report is a false positive
+ *   and becomes a local exception.
+ *
+ *   Every heartbeat and verified access response is a clock sample
+ *   (clock_discipline.hpp).  The estimate of server time it yields carries
+ *   an error bound; requests are stamped with requested_at_us only while
+ *   that bound is within PORTUNUS_CLOCK_MAX_ERROR_MS.  The wall clock is
+ *   slewed towards the estimate, and stepped only at boot or when far off.
+ *
+ *   Heartbeat ticks are paced (heartbeat_pacer.hpp): while the module is
+ *   healthy only some become RPCs, up to HEARTBEAT_MAX_INTERVAL_MS apart,
+ *   and an answered tap counts as one.  A reader fault, low heap, a
+ *   reconnect, a stale tap or a new IP sends the next tick at once.  Once
+ *   the server has answered a heartbeat, the fields that do not change
+ *   (firmware version, IP, core layout, filter capacity) are left out
+ *   (static_omitted) until one of them changes or the server asks for them
+ *   again (resend_static).  The server can push the next heartbeat back
+ *   (heartbeat_delay_ms) to spread a fleet that is in step.
+ *
+ *   Heartbeats carry the module's runtime health (heartbeat_service.hpp):
+ *   heap low-water marks, connect and TLS failure counters, and the CPU
+ *   share and stack headroom of the few tasks worth watching.  When the
+ *   server asks for a dump (health_dump), the next tick lists every task
+ *   and is sent at once.
  */
 
 #include "server_comm.hpp"
@@ -21,9 +79,24 @@
 #include "error_codes.hpp"
 #include "network_config.hpp"
 #include "security_config.hpp"
+#include "task_config.hpp"
+#include "timing_config.hpp"
 #include "wifi_mgr.hpp"
 #include "portunus_types.hpp"
 #include "credential_types.h"
+#include "task_boost.hpp"
+#include "tap_retry.hpp"
+#include "link_timing.hpp"
+#include "decision_cache.hpp"
+#include "revocation_filter.hpp"
+#include "wire_sig.hpp"
+#include "sig_engine.hpp"
+#include "clock_discipline.hpp"
+#include "heartbeat_pacer.hpp"
+#include "server_time.hpp"
+#include "boot_timeline.hpp"
+#include "tap_stats.hpp"
+#include "heartbeat_service.hpp"
 
 /* Nanopb */
 #include "portunus/v1/portunus.pb.h"
@@ -50,21 +123,27 @@
 /* TLS / HMAC */
 #if PORTUNUS_USE_TLS
   #if PORTUNUS_TLS_USE_CUSTOM_CA
-    /* Embedded CA certificate for LAN TLS pinning.
-     * The PEM is compiled into the binary by EMBED_TXTFILES in CMakeLists.txt.
+    /* Embedded CA certificate for LAN TLS pinning, as DER; grpc_client
+     * parses it once, in place (tls_trust.hpp).  Compiled into the binary by
+     * target_add_binary_data in CMakeLists.txt.
      * Generated by: ./scripts/generate_certs.sh --ip <SERVER_IP> */
-    extern const char ca_cert_pem_start[] asm("_binary_ca_cert_pem_start");
-    extern const char ca_cert_pem_end[]   asm("_binary_ca_cert_pem_end");
+    extern const uint8_t ca_cert_der_start[] asm("_binary_ca_cert_der_start");
+    extern const uint8_t ca_cert_der_end[]   asm("_binary_ca_cert_der_end");
   #else
     #include "esp_crt_bundle.h"
   #endif
 #endif
-#if PORTUNUS_HMAC_ENABLED
-  #include "mbedtls/md.h"
-#endif
+
+/* Server reason codes pass straight through to the event bus. */
+static_assert(ACCESS_REASON_CREDENTIAL_NOT_FOUND ==
+              (int)portunus_v1_AccessReason_ACCESS_REASON_CREDENTIAL_NOT_FOUND,
+              "access_reason_t must mirror portunus_v1_AccessReason");
+static_assert(ACCESS_REASON_SERVER_MAX == (int)_portunus_v1_AccessReason_MAX,
+              "a new AccessReason needs an access_reason_t value");
 
 /* ESP-IDF */
 #include "grpc_client.hpp"
+#include "tls_trust.hpp"
 #include "esp_wifi.h"
 #include "esp_netif.h"
 #include "esp_log.h"
@@ -82,11 +161,14 @@
 #include <time.h>
 #include <sys/time.h>
 
+/* A full heartbeat, health dump included, must fit one unary call. */
+static_assert(portunus_v1_HeartbeatRequest_size <= GRPC_CLIENT_MAX_REQUEST_BYTES,
+              "HeartbeatRequest outgrew GRPC_CLIENT_MAX_REQUEST_BYTES");
+
 static const char *TAG = "server_comm";
 
 /* ── Configuration ─────────────────────────────────────────────────────────── */
 #define COMM_TASK_STACK_SIZE    10240   /* nghttp2 session requires larger stack */
-#define COMM_TASK_PRIORITY      2       /* Below heartbeat(3) and credential_poll(4) */
 #define COMM_QUEUE_LENGTH       8       /* Pending events waiting for I/O */
 
 /* ── Module state ──────────────────────────────────────────────────────────── */
@@ -94,79 +176,97 @@ static QueueHandle_t  s_comm_queue    = NULL;
 static TaskHandle_t   s_comm_task     = NULL;
 static bool           s_initialized   = false;
 static bool           s_reader_degraded = false; /* set by EVENT_CREDENTIAL_READ_ERROR, cleared by RECOVERED */
-static bool           s_clock_synced    = false; /* true after first successful settimeofday() from heartbeat */
 
 /* gRPC client handle — persistent HTTP/2+TLS connection to the server. */
 static grpc_client_handle_t s_grpc_handle = NULL;
 
+/* Raised priority while a tap request is queued or in flight. */
+static task_boost_t s_boost;
+
 /* Deployment config stored at init from NVS, used across the lifetime of the task */
 static char     s_module_id[PORTUNUS_NVS_MODULE_ID_LEN];
 static char     s_server_host[PORTUNUS_NVS_SERVER_HOST_LEN];
 static uint16_t s_grpc_port;
 #if PORTUNUS_HMAC_ENABLED
-static char   s_hmac_secret[PORTUNUS_NVS_HMAC_SECRET_LEN];
-static size_t s_hmac_secret_len;
+/* Keyed with the NVS secret at init; signs requests, verifies responses. */
+static sig_engine_t s_sig_engine;
 #endif
-/* Idle-tick counter for keepalive PINGs (1 tick ≈ 1 s). */
-static int s_idle_ticks = 0;
-#define GRPC_PING_INTERVAL_TICKS 30
-
-/* ── HMAC helper ───────────────────────────────────────────────────────────── */
-
-#if PORTUNUS_HMAC_ENABLED
-/**
- * @brief Compute HMAC-SHA256(PORTUNUS_HMAC_SECRET, data) and write the
- *        hex-encoded result (64 chars + NUL) into @p out_hex.
- *
- * @return true on success, false on mbedTLS error.
- */
-static bool compute_hmac_hex(const uint8_t *data, size_t data_len,
-                              char out_hex[PORTUNUS_HMAC_HEX_LEN])
-{
-    const char  *secret     = s_hmac_secret;
-    const size_t secret_len = s_hmac_secret_len;
-
-    uint8_t raw[32]; /* SHA-256 output is 32 bytes */
 
-    const mbedtls_md_info_t *info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
-    if (!info) { return false; }
+/* Server-time estimate (clock_discipline.hpp).  Fed on comm_task, read by
+   server_comm_clock_synced() from any task, hence the lock.  Samples are
+   kept one per 2 minutes, so the window spans about half an hour and
+   drift is fitted once it spans 10.  Steps above 128 ms, as ntpd does. */
+static const clock_discipline_config_t s_clock_cfg = {
+    128000,             /* step_threshold_us */
+    120000000LL,        /* bucket_us */
+    600000000LL,        /* min_span_us */
+    100,                /* wander_ppm: ESP32-S3 crystal plus temperature */
+    1000,               /* floor_ppb */
+};
+static clock_discipline_t s_clock;
+static portMUX_TYPE       s_clock_lock = portMUX_INITIALIZER_UNLOCKED;
+
+/* Heartbeat pacing (comm_task only).  s_hb_static holds the static fields
+   of the last full heartbeat the server answered; s_hb_static_acked is
+   false until there is one, and again after resend_static. */
+typedef struct {
+    char     firmware_version[sizeof(((portunus_v1_HeartbeatRequest *)0)->firmware_version)];
+    char     ip[sizeof(((portunus_v1_HeartbeatRequest *)0)->ip)];
+    uint32_t cpu_cores;
+    bool     core_isolation;
+    uint32_t task_plan_faults;
+    uint32_t revocation_filter_capacity;
+} heartbeat_static_t;
+static heartbeat_pacer_t  s_pacer;
+static heartbeat_static_t s_hb_static;
+static bool               s_hb_static_acked = false;
+static uint32_t           s_hb_connects     = 0;    /* grpc connects at the last tick */
+static uint32_t           s_hb_stale_taps   = 0;    /* tap_stats_stale() at the last tick */
+/* Keepalive: PING after s_keepalive.interval_ms without traffic. */
+#define GRPC_KEEPALIVE_INITIAL_MS 30000
+static keepalive_t s_keepalive;
+static int64_t     s_last_traffic_us = 0;
+static bool        s_reconnect_pending = false;  /* link found dead; reconnect when due */
+/* Heartbeats carry the boot timeline until one carrying all of it is answered. */
+static bool        s_boot_reported = false;
 
-    int rc = mbedtls_md_hmac(info,
-                              (const unsigned char *)secret, secret_len,
-                              data, data_len,
-                              raw);
-    if (rc != 0) {
-        ESP_LOGE(TAG, "mbedtls_md_hmac failed: -0x%04x", (unsigned)(-rc));
-        return false;
-    }
+#ifdef CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT
+/* Grants re-usable within the server's cache TTL.  Looked up on the
+   reactor, filled and invalidated on comm_task, hence the lock.  Keys are
+   HMAC-SHA256 of the UID under a secret drawn fresh at every boot, like
+   the cache itself, truncated. */
+static decision_cache_t s_decision_cache;
+static portMUX_TYPE     s_decision_cache_lock = portMUX_INITIALIZER_UNLOCKED;
+static sig_engine_t     s_cache_key_engine;
+/* Cached grants and filter denies whose audit report found the queue full (reactor only). */
+static uint32_t         s_audit_reports_lost = 0;
+
+/* Revocation filter, double-buffered: heartbeat decoding fills the spare
+   slot while the reactor reads the live one, then the two swap under the
+   lock.  Each slot keeps a sig_engine keyed with the tag key it was sent
+   with, so a tap's tag costs two SHA-256 compressions.  Version 0 means
+   no filter. */
+#define REVOCATION_FILTER_SLOT_BYTES \
+    (PORTUNUS_REVOCATION_FILTER_MAX_BYTES > 0 ? PORTUNUS_REVOCATION_FILTER_MAX_BYTES : 1)
+typedef struct {
+    uint8_t fingerprints[REVOCATION_FILTER_SLOT_BYTES];
+    sig_engine_t tag_engine;
+} revocation_filter_slot_t;
+static revocation_filter_slot_t s_filter_slots[2];
+static revocation_filter_t      s_filter;
+static uint8_t                  s_filter_live    = 0;
+static uint32_t                 s_filter_version = 0;
+static uint32_t                 s_filter_denials = 0;
+static portMUX_TYPE             s_filter_lock    = portMUX_INITIALIZER_UNLOCKED;
+#endif
 
-    /* Hex-encode into out_hex */
-    static const char hex_chars[] = "0123456789abcdef";
-    for (int i = 0; i < 32; ++i) {
-        out_hex[i * 2]     = hex_chars[(raw[i] >> 4) & 0x0F];
-        out_hex[i * 2 + 1] = hex_chars[ raw[i]       & 0x0F];
-    }
-    out_hex[64] = '\0';
-    return true;
-}
-/**
- * @brief Constant-time comparison of two 64-char hex HMAC strings.
- *
- * Runs all 64 iterations regardless of the first mismatch to avoid
- * leaking timing information about partial matches.
- */
-static bool sig_hex_equal(const char *a, const char *b)
-{
-    uint8_t diff = 0;
-    for (int i = 0; i < 64; ++i) {
-        diff |= static_cast<uint8_t>(a[i]) ^ static_cast<uint8_t>(b[i]);
-    }
-    return diff == 0;
-}
-#endif /* PORTUNUS_HMAC_ENABLED */
+#if PORTUNUS_HMAC_ENABLED
+static_assert(SIG_ENGINE_HEX_LEN == PORTUNUS_HMAC_HEX_LEN, "signature header length");
+#endif
 
 /* ── Forward declarations ──────────────────────────────────────────────────── */
 static void comm_task(void *arg);
+static bool heartbeat_due(const event_heartbeat_t *hb);
 static void handle_heartbeat(const event_heartbeat_t *hb);
 #ifdef CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT
 static void handle_credential(const event_credential_read_t *cred);
@@ -208,91 +308,95 @@ static bool get_rssi(int32_t *out)
 /* ── Clock sync helpers ────────────────────────────────────────────────────── */
 
 /**
- * @brief Parse an RFC 3339 UTC timestamp into a struct timeval.
+ * @brief Feed one round trip to the clock discipline and correct the wall clock.
  *
- * Accepts the format produced by the Go server: "2006-01-02T15:04:05.999999999Z".
- * Fractional seconds are optional; the 'Z' suffix is assumed (UTC).
- * Requires the process timezone to be set to UTC0 (done in server_comm_init).
+ * The wall clock is stepped (settimeofday) the first time and when it is
+ * off by more than the step threshold, and slewed (adjtime) otherwise, so
+ * audit timestamps never jump backwards in normal operation.
+ * AccessRequest.requested_at_us is taken from the discipline's estimate,
+ * not the wall clock, while its error bound is within
+ * PORTUNUS_CLOCK_MAX_ERROR_MS (see clock_server_now()).
  *
- * @return true on success, false if @p s is empty or malformed.
+ * @param sent_us         esp_timer time the request was sent.
+ * @param recv_us         esp_timer time the response arrived.
+ * @param server_time_us  Unix µs from a protocol v2 server; 0 if not sent.
+ * @param server_time     RFC 3339 string, used only when server_time_us is 0
+ *                        (a server that predates protocol v2).
  */
-static bool parse_server_time(const char *s, struct timeval *out)
+static void clock_sample_from_response(int64_t sent_us, int64_t recv_us,
+                                       int64_t server_time_us, const char *server_time)
 {
-    if (s == NULL || s[0] == '\0') { return false; }
-
-    int year, mon, mday, hour, min, sec;
-    if (sscanf(s, "%4d-%2d-%2dT%2d:%2d:%2d",
-               &year, &mon, &mday, &hour, &min, &sec) < 6) {
-        return false;
+    int64_t server_us = server_time_us;
+    if (server_us <= 0) {
+        struct timeval tv;
+        if (!parse_server_time(server_time, &tv)) {
+            ESP_LOGW(TAG, "Clock sample skipped — unparseable server_time");
+            return;
+        }
+        server_us = (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
     }
 
-    struct tm tm = {};
-    tm.tm_year  = year - 1900;
-    tm.tm_mon   = mon - 1;
-    tm.tm_mday  = mday;
-    tm.tm_hour  = hour;
-    tm.tm_min   = min;
-    tm.tm_sec   = sec;
-    tm.tm_isdst = 0;
-
-    /* TZ=UTC0 ensures mktime() treats this as UTC, not local time. */
-    time_t t = mktime(&tm);
-    if (t == (time_t)-1) { return false; }
-
-    /* Parse fractional seconds (e.g. ".123456789") → microseconds. */
-    long usec = 0;
-    const char *dot = strchr(s, '.');
-    if (dot != NULL) {
-        /* Copy up to 9 digits, right-pad with '0' to get nanoseconds. */
-        char frac[10] = {'0','0','0','0','0','0','0','0','0','\0'};
-        int i = 0;
-        const char *p = dot + 1;
-        while (i < 9 && *p >= '0' && *p <= '9') { frac[i++] = *p++; }
-        usec = strtol(frac, NULL, 10) / 1000;  /* ns → µs */
-    }
-
-    out->tv_sec  = t;
-    out->tv_usec = (suseconds_t)usec;
-    return true;
+    /* Wall clock as it read when the response arrived. */
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    int64_t since_recv_us = esp_timer_get_time() - recv_us;
+    int64_t wall_us = (int64_t)now.tv_sec * 1000000LL + now.tv_usec - since_recv_us;
+
+    portENTER_CRITICAL(&s_clock_lock);
+    uint32_t restarts = s_clock.restarts;
+    clock_correction_t fix = clock_discipline_sample(&s_clock, sent_us, recv_us,
+                                                     server_us, wall_us);
+    bool restarted = s_clock.restarts != restarts;
+    portEXIT_CRITICAL(&s_clock_lock);
+
+    if (restarted) {
+        ESP_LOGW(TAG, "Clock sample inconsistent with the estimate — window restarted");
+    }
+    if (fix.kind == CLOCK_CORRECT_STEP) {
+        /* Step from the clock as it reads now; delta is the same offset. */
+        gettimeofday(&now, NULL);
+        int64_t target_us = (int64_t)now.tv_sec * 1000000LL + now.tv_usec + fix.delta_us;
+        struct timeval tv;
+        tv.tv_sec  = (time_t)(target_us / 1000000LL);
+        tv.tv_usec = (suseconds_t)(target_us % 1000000LL);
+        if (settimeofday(&tv, NULL) != 0) {
+            ESP_LOGW(TAG, "Clock step failed — settimeofday error");
+            return;
+        }
+        ESP_LOGI(TAG, "Clock stepped by %" PRId64 " us (rtt=%" PRId64 "us)",
+                 fix.delta_us, recv_us - sent_us);
+    } else if (fix.kind == CLOCK_CORRECT_SLEW) {
+        /* Normalised: tv_usec in [0, 1 s), tv_sec carries the sign. */
+        struct timeval delta;
+        delta.tv_sec  = (time_t)(fix.delta_us / 1000000LL);
+        delta.tv_usec = (suseconds_t)(fix.delta_us % 1000000LL);
+        if (delta.tv_usec < 0) {
+            delta.tv_sec  -= 1;
+            delta.tv_usec += 1000000L;
+        }
+        if (adjtime(&delta, NULL) != 0) {
+            ESP_LOGW(TAG, "Clock slew failed — adjtime error");
+        }
+    }
 }
 
 /**
- * @brief Set the system clock from a heartbeat response server_time field.
+ * @brief Estimated server time now and its error bound.
  *
- * Applies an RTT/2 correction: the server captures server_time before the
- * response travels back, so we add half the observed round-trip to center
- * the synchronisation error.  On a LAN the residual error is sub-millisecond.
- *
- * Sets s_clock_synced = true on success so that handle_credential() can
- * populate AccessRequest.requested_at for replay protection (phase 2).
- *
- * @param server_time  NUL-terminated RFC 3339 string from HeartbeatResponse.
- * @param rtt_us       Round-trip time of the heartbeat RPC in microseconds.
+ * @return false until the first sample.
  */
-static void sync_clock_from_response(const char *server_time, int64_t rtt_us)
+static bool clock_server_now(int64_t *server_us, int64_t *error_us)
 {
-    struct timeval tv;
-    if (!parse_server_time(server_time, &tv)) {
-        ESP_LOGW(TAG, "Clock sync skipped — unparseable server_time");
-        return;
-    }
-
-    /* Apply RTT/2 offset, carrying microseconds into seconds if needed. */
-    int64_t half_rtt_us = rtt_us / 2;
-    tv.tv_usec += (suseconds_t)(half_rtt_us % 1000000LL);
-    tv.tv_sec  += (time_t)(half_rtt_us / 1000000LL);
-    if (tv.tv_usec >= 1000000L) {
-        tv.tv_sec  += 1;
-        tv.tv_usec -= 1000000L;
-    }
-
-    if (settimeofday(&tv, NULL) != 0) {
-        ESP_LOGW(TAG, "Clock sync failed — settimeofday error");
-        return;
-    }
+    portENTER_CRITICAL(&s_clock_lock);
+    bool ok = clock_discipline_now(&s_clock, esp_timer_get_time(), server_us, error_us);
+    portEXIT_CRITICAL(&s_clock_lock);
+    return ok;
+}
 
-    s_clock_synced = true;
-    ESP_LOGI(TAG, "Clock synced — server_time=%s rtt=%" PRId64 "us", server_time, rtt_us);
+/** True while the estimate is good enough to stamp requests with. */
+static bool clock_usable(int64_t error_us)
+{
+    return error_us <= (int64_t)PORTUNUS_CLOCK_MAX_ERROR_MS * 1000LL;
 }
 
 /* ── Transport helpers ─────────────────────────────────────────────────────── */
@@ -301,21 +405,20 @@ static void sync_clock_from_response(const char *server_time, int64_t rtt_us)
  * @brief Perform a gRPC unary call with HMAC signing.
  *
  * Wraps grpc_client_unary_call() with HMAC metadata attachment.
- * The HMAC is computed over @p sig_projection — a canonical string built
- * from key request fields — and sent as a custom gRPC metadata header
- * (x-portunus-sig).  The server interceptor validates the same projection,
- * making verification independent of wire-format differences between Nanopb
- * and the Go protobuf library.
+ * The HMAC is computed over a projection of key request fields and sent as
+ * a custom gRPC metadata header (x-portunus-sig).  The server interceptor
+ * validates the same projection, making verification independent of
+ * wire-format differences between Nanopb and the Go protobuf library.
  *
- * Projection formats (must match hmacProjection() in grpcapi/interceptors.go):
- *   Heartbeat:   "heartbeat|{module_id}|{sequence}"
- *   Access:      "access|{module_id}|{credential_id}"
- *   Provision:   "provision|{module_id}|{hex(credential_uid)}"
+ * Requests carry protocol_version = WIRE_SIG_VERSION, so projections are
+ * the binary ones from wire_sig.hpp (hmacProjection() in
+ * grpcapi/interceptors.go picks the same layout from the version).
  *
  * @param method         gRPC method path (e.g. "/portunus.v1.PortunusService/SendHeartbeat")
  * @param req_buf        Nanopb-encoded protobuf request body
  * @param req_len        Length of req_buf
- * @param sig_projection NUL-terminated canonical string to sign for HMAC
+ * @param sig_data       Projection to sign for HMAC (wire_sig_*())
+ * @param sig_len        Length of sig_data; 0 means the projection failed
  * @param resp_buf       Buffer to receive the protobuf response
  * @param resp_cap       Capacity of resp_buf
  * @param resp_len       [out] Actual protobuf bytes written to resp_buf
@@ -328,36 +431,43 @@ static void sync_clock_from_response(const char *server_time, int64_t rtt_us)
  */
 static portunus_err_t grpc_post_proto(const char *method,
                                        const uint8_t *req_buf, size_t req_len,
-                                       const char *sig_projection,
+                                       const uint8_t *sig_data, size_t sig_len,
                                        uint8_t *resp_buf, size_t resp_cap,
                                        int *resp_len, int *grpc_status,
                                        char *out_sig_hex)
 {
 #if PORTUNUS_HMAC_ENABLED
-    /* Sign the canonical projection string, not the raw protobuf bytes.
+    /* Sign the projection, not the raw protobuf bytes.
      * The server interceptor computes the same projection from parsed fields,
      * so both sides agree even when Nanopb and Go encode the same message
      * with different field ordering or varint padding. */
     char sig_hex[PORTUNUS_HMAC_HEX_LEN];
-    if (compute_hmac_hex((const uint8_t *)sig_projection, strlen(sig_projection), sig_hex)) {
+    if (sig_len > 0 && sig_engine_sign_hex(&s_sig_engine, sig_data, sig_len, sig_hex)) {
         grpc_client_set_metadata(s_grpc_handle, PORTUNUS_HMAC_HEADER_NAME, sig_hex);
     } else {
         ESP_LOGE(TAG, "HMAC computation failed — aborting RPC");
         return PORTUNUS_ERR_HTTP_CONNECT;
     }
 #else
-    (void)sig_projection;
+    (void)sig_data;
+    (void)sig_len;
 #endif /* PORTUNUS_HMAC_ENABLED */
 
-    return grpc_client_unary_call(s_grpc_handle, method,
-                                  req_buf, req_len,
-                                  resp_buf, resp_cap,
-                                  resp_len, grpc_status,
-                                  out_sig_hex);
+    wifi_mgr_rpc_begin();
+    portunus_err_t err = grpc_client_unary_call(s_grpc_handle, method,
+                                                req_buf, req_len,
+                                                resp_buf, resp_cap,
+                                                resp_len, grpc_status,
+                                                out_sig_hex);
+    wifi_mgr_rpc_end(err != PORTUNUS_ERR_HTTP_CONNECT && err != PORTUNUS_ERR_TIMEOUT);
+    if (err == PORTUNUS_OK) {
+        boot_timeline_mark(BOOT_PHASE_SERVER, (uint32_t)(esp_timer_get_time() / 1000));
+    }
+    return err;
 }
 
 /* ── Event bus subscriber callbacks ────────────────────────────────────────── */
-/* These run on the event bus dispatcher task and must be non-blocking.
+/* These run on the event bus dispatcher (reactor task) and must be non-blocking.
    They simply copy the event into the server_comm queue. */
 
 static void on_heartbeat_event(const portunus_event_t *event, void *ctx)
@@ -375,12 +485,352 @@ static void on_reader_fault_event(const portunus_event_t *event, void *ctx)
     xQueueSend(s_comm_queue, event, 0);
 }
 
+static void on_network_up_event(const portunus_event_t *event, void *ctx)
+{
+    (void)ctx;
+    if (s_comm_queue == NULL) { return; }
+    xQueueSend(s_comm_queue, event, 0);
+}
+
+/* wifi_mgr callback, on the default event loop: open the connection now
+   rather than on the first heartbeat or tap.  Published on the event bus
+   rather than queued directly, so the comm queue keeps a single producer
+   task (the reactor). */
+static void on_ip_obtained(void *ctx)
+{
+    (void)ctx;
+    portunus_event_t event;
+    memset(&event, 0, sizeof(event));
+    event.id = EVENT_NETWORK_UP;
+    event_bus_publish(&event);
+}
+
+/**
+ * @brief Queue a tap request ahead of heartbeats and boost comm_task.
+ *
+ * The boost is taken before the send so comm_task can never dequeue the
+ * item while still at baseline; comm_task releases it after handling.
+ * Two taps queued at once are served newest first, which is the one the
+ * person at the door is still waiting on.
+ */
+static void enqueue_tap_request(const portunus_event_t *event)
+{
+    task_boost_hold(&s_boost);
+    if (xQueueSendToFront(s_comm_queue, event, 0) != pdTRUE) {
+        task_boost_release(&s_boost);
+        ESP_LOGW(TAG, "Comm queue full — dropping event 0x%04x", (unsigned)event->id);
+    }
+}
+
+/** True for queued items that hold the boost (not cached-grant or filter reports). */
+static bool is_tap_request(const portunus_event_t *event)
+{
+    if (event->id == EVENT_CREDENTIAL_READ) {
+        return !event->payload.credential_read.cached_grant &&
+               !event->payload.credential_read.filter_denied;
+    }
+    return event->id == EVENT_PROVISION_REQUEST;
+}
+
 #ifdef CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT
+/* ── Decision cache ────────────────────────────────────────────────────────── */
+
+/** Keyed hash of a credential for s_decision_cache. */
+static bool decision_cache_key(const credential_t *cred, uint8_t key[DECISION_CACHE_KEY_LEN])
+{
+    uint8_t digest[SIG_ENGINE_MAC_LEN];
+    if (!sig_engine_mac(&s_cache_key_engine, cred->uid, cred->uid_len, digest)) {
+        return false;
+    }
+    memcpy(key, digest, DECISION_CACHE_KEY_LEN);
+    return true;
+}
+
+static void decision_cache_store_grant(const uint8_t key[DECISION_CACHE_KEY_LEN],
+                                       uint32_t ttl_s, uint32_t version)
+{
+    int64_t now_ms = esp_timer_get_time() / 1000;
+    uint64_t ttl_ms = (uint64_t)(ttl_s < PORTUNUS_DECISION_CACHE_MAX_TTL_S
+                                 ? ttl_s : PORTUNUS_DECISION_CACHE_MAX_TTL_S) * 1000u;
+    portENTER_CRITICAL(&s_decision_cache_lock);
+    decision_cache_insert(&s_decision_cache, key, (uint32_t)ttl_ms, version, now_ms);
+    portEXIT_CRITICAL(&s_decision_cache_lock);
+}
+
+static bool decision_cache_withdraw(const uint8_t key[DECISION_CACHE_KEY_LEN])
+{
+    portENTER_CRITICAL(&s_decision_cache_lock);
+    bool held = decision_cache_remove(&s_decision_cache, key);
+    portEXIT_CRITICAL(&s_decision_cache_lock);
+    return held;
+}
+
+static void decision_cache_note_version(uint32_t version)
+{
+    portENTER_CRITICAL(&s_decision_cache_lock);
+    uint32_t dropped = decision_cache_set_version(&s_decision_cache, version);
+    portEXIT_CRITICAL(&s_decision_cache_lock);
+    if (dropped > 0) {
+        ESP_LOGI(TAG, "Policy version now %" PRIu32 " — dropped %" PRIu32 " cached grant(s)",
+                 version, dropped);
+    }
+}
+
+/**
+ * @brief Grant a repeat tap from the decision cache (reactor context).
+ *
+ * On a hit the grant is published at once and the tap is queued, behind
+ * any taps and without a boost, as an audit report for comm_task.
+ * Returns false — and the tap goes to the server as usual — on a miss or
+ * if either cannot be queued.  Every comm-queue producer runs on the
+ * reactor (EVENT_NETWORK_UP too, via the event bus), so the free slot
+ * checked here is still free at the send; a failed send is logged and
+ * counted in s_audit_reports_lost all the same.
+ */
+static bool grant_from_cache(const portunus_event_t *event)
+{
+    if (PORTUNUS_DECISION_CACHE_ENTRIES == 0 || uxQueueSpacesAvailable(s_comm_queue) == 0) {
+        return false;
+    }
+    const event_credential_read_t *cred = &event->payload.credential_read;
+    uint8_t key[DECISION_CACHE_KEY_LEN];
+    if (!decision_cache_key(&cred->credential, key)) {
+        return false;
+    }
+
+    int64_t now_ms = esp_timer_get_time() / 1000;
+    portENTER_CRITICAL(&s_decision_cache_lock);
+    bool hit = decision_cache_lookup(&s_decision_cache, key, now_ms);
+    portEXIT_CRITICAL(&s_decision_cache_lock);
+    if (!hit) {
+        return false;
+    }
+
+    char log_id[CREDENTIAL_LOG_ID_LEN];
+    credential_uid_to_log_id(&cred->credential, log_id, sizeof(log_id));
+
+    portunus_event_t grant;
+    memset(&grant, 0, sizeof(grant));
+    grant.id = EVENT_ACCESS_GRANTED;
+    strncpy(grant.payload.access_decision.credential_id, log_id,
+            sizeof(grant.payload.access_decision.credential_id) - 1);
+    grant.payload.access_decision.reason      = ACCESS_REASON_CACHED;
+    grant.payload.access_decision.granted     = true;
+    grant.payload.access_decision.known       = true;
+    grant.payload.access_decision.deadline_ms = cred->deadline_ms;
+    if (event_bus_publish(&grant) != PORTUNUS_OK) {
+        return false;
+    }
+
+    /* The report has no one waiting on it: no deadline, no boost. */
+    portunus_event_t report = *event;
+    report.payload.credential_read.cached_grant = true;
+    report.payload.credential_read.deadline_ms  = 0;
+    if (xQueueSend(s_comm_queue, &report, 0) != pdTRUE) {
+        s_audit_reports_lost++;
+        ESP_LOGW(TAG, "Comm queue full — audit report for cached grant lost (%" PRIu32 " lost)",
+                 s_audit_reports_lost);
+    }
+
+    ESP_LOGI(TAG, "Access granted from cache — id=%s", log_id);
+    return true;
+}
+
+/* ── Revocation filter ─────────────────────────────────────────────────────── */
+
+/* A card tapped again and again while revoked is reported once per
+   FILTER_REPORT_HOLDOFF_MS; the denials are still counted. */
+#define FILTER_REPORT_HOLDOFF_MS  60000
+#define FILTER_REPORT_RING        4
+static uint64_t s_filter_reported_tag[FILTER_REPORT_RING];
+static int64_t  s_filter_reported_ms[FILTER_REPORT_RING];
+static uint8_t  s_filter_reported_next = 0;
+
+/** Reactor only: true if @p tag has not been reported recently (and notes it). */
+static bool filter_report_due(uint64_t tag, int64_t now_ms)
+{
+    for (int i = 0; i < FILTER_REPORT_RING; i++) {
+        if (s_filter_reported_tag[i] == tag &&
+            now_ms - s_filter_reported_ms[i] < FILTER_REPORT_HOLDOFF_MS) {
+            return false;
+        }
+    }
+    s_filter_reported_tag[s_filter_reported_next] = tag;
+    s_filter_reported_ms[s_filter_reported_next]  = now_ms;
+    s_filter_reported_next = (uint8_t)((s_filter_reported_next + 1) % FILTER_REPORT_RING);
+    return true;
+}
+
+/**
+ * Filter tag of @p cred under the live filter's key; false if there is no filter.
+ *
+ * The MAC runs outside the lock on the live slot's engine.  comm_task only
+ * re-keys the spare slot, so this one is re-keyed under it only if two
+ * filters are installed meanwhile; callers compare @p version again
+ * before using the tag, which discards that case.
+ */
+static bool revocation_filter_tag_for(const credential_t *cred, uint64_t *tag, uint32_t *version)
+{
+    portENTER_CRITICAL(&s_filter_lock);
+    *version = s_filter_version;
+    const sig_engine_t *engine = &s_filter_slots[s_filter_live].tag_engine;
+    portEXIT_CRITICAL(&s_filter_lock);
+
+    uint8_t digest[SIG_ENGINE_MAC_LEN];
+    if (*version == 0 || !sig_engine_mac(engine, cred->uid, cred->uid_len, digest)) {
+        return false;
+    }
+    *tag = revocation_filter_tag(digest);
+    return true;
+}
+
+static void revocation_filter_drop(const char *why)
+{
+    portENTER_CRITICAL(&s_filter_lock);
+    bool held = s_filter_version != 0;
+    revocation_filter_clear(&s_filter);
+    s_filter_version = 0;
+    portEXIT_CRITICAL(&s_filter_lock);
+    if (held) {
+        ESP_LOGW(TAG, "Revocation filter dropped: %s", why);
+    }
+}
+
+/**
+ * @brief Deny a tap whose credential is in the revocation filter (reactor context).
+ *
+ * The HMAC runs outside the lock on the live slot's precomputed key
+ * schedule; the lookup is skipped if the filter was replaced meanwhile,
+ * since the tag may be under the old key.  On a hit the deny is published at once and the tap queued,
+ * behind any taps and without a boost, as an audit report — unless the
+ * same card was reported within FILTER_REPORT_HOLDOFF_MS, or the queue is
+ * too full to spare a slot for a tap.  Returns false on a miss: the tap
+ * goes on to the decision cache and the server.
+ */
+static bool deny_from_filter(const portunus_event_t *event)
+{
+    if (PORTUNUS_REVOCATION_FILTER_MAX_BYTES == 0) {
+        return false;
+    }
+    const event_credential_read_t *cred = &event->payload.credential_read;
+    uint64_t tag;
+    uint32_t version;
+    if (!revocation_filter_tag_for(&cred->credential, &tag, &version)) {
+        return false;
+    }
+
+    portENTER_CRITICAL(&s_filter_lock);
+    bool hit = s_filter_version == version && revocation_filter_contains(&s_filter, tag);
+    portEXIT_CRITICAL(&s_filter_lock);
+    if (!hit) {
+        return false;
+    }
+
+    char log_id[CREDENTIAL_LOG_ID_LEN];
+    credential_uid_to_log_id(&cred->credential, log_id, sizeof(log_id));
+
+    portunus_event_t deny;
+    memset(&deny, 0, sizeof(deny));
+    deny.id = EVENT_ACCESS_DENIED;
+    strncpy(deny.payload.access_decision.credential_id, log_id,
+            sizeof(deny.payload.access_decision.credential_id) - 1);
+    deny.payload.access_decision.reason      = ACCESS_REASON_REVOKED;
+    deny.payload.access_decision.granted     = false;
+    deny.payload.access_decision.known       = true;
+    deny.payload.access_decision.deadline_ms = cred->deadline_ms;
+    if (event_bus_publish(&deny) != PORTUNUS_OK) {
+        return false;
+    }
+    s_filter_denials++;
+
+    int64_t now_ms = esp_timer_get_time() / 1000;
+    if (uxQueueSpacesAvailable(s_comm_queue) >= 2 && filter_report_due(tag, now_ms)) {
+        portunus_event_t report = *event;
+        report.payload.credential_read.filter_denied = true;
+        report.payload.credential_read.deadline_ms   = 0;
+        if (xQueueSend(s_comm_queue, &report, 0) != pdTRUE) {
+            s_audit_reports_lost++;
+            ESP_LOGW(TAG, "Comm queue full — audit report for filter deny lost "
+                     "(%" PRIu32 " lost)", s_audit_reports_lost);
+        }
+    }
+
+    ESP_LOGI(TAG, "Access denied from revocation filter — id=%s", log_id);
+    return true;
+}
+
+/**
+ * @brief Install the filter a heartbeat response carried (comm_task).
+ *
+ * @p len bytes of fingerprints are already in the spare slot.  Version 0
+ * withdraws the filter; the held version means nothing changed.
+ */
+static void revocation_filter_apply(const portunus_v1_HeartbeatResponse *resp,
+                                    size_t len, bool complete)
+{
+    uint32_t version = resp->revocation_filter_version;
+    if (version == s_filter_version) {
+        return;
+    }
+    if (version == 0) {
+        revocation_filter_drop("withdrawn by server");
+        return;
+    }
+
+    uint8_t spare = (uint8_t)(s_filter_live ^ 1);
+    revocation_filter_t next;
+    if (!complete || len == 0 ||
+        resp->revocation_filter_key.size != REVOCATION_FILTER_KEY_LEN ||
+        !revocation_filter_load(&next, s_filter_slots[spare].fingerprints, len,
+                                resp->revocation_filter_seed,
+                                resp->revocation_filter_exceptions.bytes,
+                                resp->revocation_filter_exceptions.size)) {
+        revocation_filter_drop("invalid update");
+        return;
+    }
+    sig_engine_t *engine = &s_filter_slots[spare].tag_engine;
+    sig_engine_free(engine);
+    if (!sig_engine_init(engine, resp->revocation_filter_key.bytes, REVOCATION_FILTER_KEY_LEN)) {
+        revocation_filter_drop("tag key set-up failed");
+        return;
+    }
+
+    portENTER_CRITICAL(&s_filter_lock);
+    s_filter         = next;
+    s_filter_live    = spare;
+    s_filter_version = version;
+    portEXIT_CRITICAL(&s_filter_lock);
+    ESP_LOGI(TAG, "Revocation filter v%" PRIu32 ": %u bytes, %u exception(s)",
+             version, (unsigned)len, (unsigned)next.exception_count);
+}
+
+/** A filtered tap the server granted: pass that card through from now on. */
+static void revocation_filter_except(const credential_t *cred, const char *log_id)
+{
+    uint64_t tag;
+    uint32_t version;
+    if (!revocation_filter_tag_for(cred, &tag, &version)) {
+        return;
+    }
+    portENTER_CRITICAL(&s_filter_lock);
+    bool added = s_filter_version != version ||
+                 revocation_filter_add_exception(&s_filter, tag);
+    portEXIT_CRITICAL(&s_filter_lock);
+    if (!added) {
+        revocation_filter_drop("exception list full");
+        return;
+    }
+    ESP_LOGW(TAG, "Server grants filtered credential %s — added as exception", log_id);
+}
+
 static void on_credential_event(const portunus_event_t *event, void *ctx)
 {
     (void)ctx;
+    wifi_mgr_note_activity();   /* a follow-up tap finds the radio awake */
     if (s_comm_queue == NULL) { return; }
-    xQueueSend(s_comm_queue, event, 0);
+    if (deny_from_filter(event)) { return; }
+    if (grant_from_cache(event)) { return; }
+    enqueue_tap_request(event);
 }
 #endif /* CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT */
 
@@ -389,7 +839,7 @@ static void on_provision_event(const portunus_event_t *event, void *ctx)
 {
     (void)ctx;
     if (s_comm_queue == NULL) { return; }
-    xQueueSend(s_comm_queue, event, 0);
+    enqueue_tap_request(event);
 }
 #endif
 
@@ -403,9 +853,9 @@ static void on_provision_event(const portunus_event_t *event, void *ctx)
  * rather than the CARD_READ LED stuck on indefinitely.
  *
  * @param credential_id  FNV-1a log fingerprint of the credential (never raw UID).
- * @param reason         Short reason string for logs / audit trail.
+ * @param reason         Module-local cause, for logs / audit trail.
  */
-static void publish_access_denied(const char *credential_id, const char *reason)
+static void publish_access_denied(const char *credential_id, access_reason_t reason)
 {
     portunus_event_t deny;
     memset(&deny, 0, sizeof(deny));
@@ -415,24 +865,212 @@ static void publish_access_denied(const char *credential_id, const char *reason)
         strncpy(deny.payload.access_decision.credential_id, credential_id,
                 sizeof(deny.payload.access_decision.credential_id) - 1);
     }
-    strncpy(deny.payload.access_decision.reason, reason,
-            sizeof(deny.payload.access_decision.reason) - 1);
+    deny.payload.access_decision.reason  = reason;
     deny.payload.access_decision.granted = false;
     deny.payload.access_decision.known   = false;
 
     event_bus_publish(&deny);
 }
 
+/** Milliseconds left before @p deadline_ms (esp_timer clock); INT64_MAX if none. */
+static int64_t tap_remaining_ms(int64_t deadline_ms)
+{
+    if (deadline_ms == 0) {
+        return INT64_MAX;
+    }
+    return deadline_ms - esp_timer_get_time() / 1000;
+}
+
+/** Deny a tap whose deadline passed at @p stage and count it. */
+static void deny_stale_tap(const char *credential_id, const char *stage)
+{
+    tap_stats_note_stale();
+    ESP_LOGW(TAG, "Tap %s past its deadline at %s — denying as stale",
+             credential_id, stage);
+    publish_access_denied(credential_id, ACCESS_REASON_STALE);
+}
+
+/* Everything in a HeartbeatResponse but the filter fingerprints, with room
+   to spare (about 280 bytes with a full exception list).  Static rather
+   than on the comm_task stack, since it also holds the fingerprints. */
+#define HEARTBEAT_RESP_BASE_BYTES 320
+static uint8_t s_heartbeat_resp_buf[HEARTBEAT_RESP_BASE_BYTES + PORTUNUS_REVOCATION_FILTER_MAX_BYTES];
+
+/* The request, its encoding and the health sample it is built from: with a
+   dump (every task) about 3 KB together, too much for the comm_task stack.
+   Only comm_task builds heartbeats. */
+static portunus_v1_HeartbeatRequest s_heartbeat_req;
+static uint8_t                      s_heartbeat_req_buf[portunus_v1_HeartbeatRequest_size];
+static heartbeat_health_t           s_heartbeat_health;
+
+#ifdef CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT
+/** Where revocation_filter_fingerprints is decoded to (the spare slot). */
+typedef struct {
+    uint8_t *buf;
+    size_t   cap;
+    size_t   len;
+    bool     complete;  /* false if the field was larger than cap */
+} filter_sink_t;
+
+static bool decode_filter_fingerprints(pb_istream_t *stream, const pb_field_t *field, void **arg)
+{
+    (void)field;
+    filter_sink_t *sink = static_cast<filter_sink_t *>(*arg);
+    size_t n = stream->bytes_left;
+    if (n > sink->cap) {
+        sink->complete = false;
+        return pb_read(stream, NULL, n);
+    }
+    sink->len      = n;
+    sink->complete = true;
+    return pb_read(stream, sink->buf, n);
+}
+#endif
+
+/**
+ * @brief Decide whether this heartbeat tick goes to the server.
+ *
+ * Anything the server should hear about now is raised with the pacer
+ * first, so the tick that notices it is the one sent.
+ */
+static bool heartbeat_due(const event_heartbeat_t *hb)
+{
+    /* Not connected and still backing off: the tick is not sent, and not
+       counted as skipped either. */
+    if (!grpc_client_connect_due(s_grpc_handle)) {
+        return false;
+    }
+
+    const char *why = NULL;
+
+    grpc_link_stats_t link;
+    if (grpc_client_get_link_stats(s_grpc_handle, &link) == PORTUNUS_OK &&
+        link.connects != s_hb_connects) {
+        s_hb_connects = link.connects;
+        why = "reconnected";
+    }
+    uint32_t stale_taps = tap_stats_stale();
+    if (stale_taps != s_hb_stale_taps) {
+        s_hb_stale_taps = stale_taps;
+        why = "stale tap";
+    }
+    if (HEARTBEAT_LOW_HEAP_BYTES > 0 && hb->free_heap_bytes < HEARTBEAT_LOW_HEAP_BYTES) {
+        why = "low heap";
+    }
+    char ip[sizeof(s_hb_static.ip)] = "";
+    get_sta_ip_str(ip, sizeof(ip));
+    if (s_hb_static_acked && strcmp(ip, s_hb_static.ip) != 0) {
+        why = "new IP";
+    }
+
+    if (why != NULL) {
+        ESP_LOGI(TAG, "Heartbeat sent early — %s", why);
+        heartbeat_pacer_note_anomaly(&s_pacer);
+    }
+    return heartbeat_pacer_due(&s_pacer, esp_timer_get_time() / 1000);
+}
+
+/**
+ * @brief Fill HeartbeatRequest.health from the last heartbeat tick's sample.
+ *
+ * @param link  Connect and TLS counters, or NULL if there are none.
+ * @return false if there is no sample (CONFIG_PORTUNUS_HEALTH_TELEMETRY
+ *         off, or no tick yet).
+ */
+static bool fill_health(portunus_v1_HealthTelemetry *out, const grpc_link_stats_t *link)
+{
+    heartbeat_health_t *h = &s_heartbeat_health;
+    if (!heartbeat_service_get_health(h)) {
+        return false;
+    }
+
+    out->min_free_heap_bytes      = h->min_free_heap_bytes;
+    out->largest_free_block_bytes = h->largest_free_block_bytes;
+    if (link != NULL) {
+        out->server_connects         = link->connects;
+        out->server_connect_failures = link->failed_connects;
+        out->tls_failures            = link->tls_failures;
+        out->tls_pin_mismatches      = link->tls_pin_mismatches;
+        out->tls_handshake_ms        = link->tls_handshake_ms;
+    }
+    out->task_count    = h->tasks.task_count;
+    out->idle_permille = h->tasks.idle_permille;
+    out->sample_us     = h->sample_us;
+    out->sample_max_us = h->sample_max_us;
+    out->detailed      = h->tasks.detailed;
+
+    const size_t cap = sizeof(out->tasks) / sizeof(out->tasks[0]);
+    out->tasks_count = 0;
+    for (size_t i = 0; i < h->tasks.n_tasks && i < cap; i++) {
+        const health_task_t   *src = &h->tasks.tasks[i];
+        portunus_v1_TaskHealth *dst = &out->tasks[out->tasks_count++];
+        strncpy(dst->name, src->name, sizeof(dst->name) - 1);
+        dst->cpu_permille     = src->cpu_permille;
+        dst->stack_free_bytes = src->stack_free_bytes;
+        /* Core and priority barely change; only dumps spend bytes on them. */
+        if (h->tasks.detailed) {
+            dst->core     = src->core;
+            dst->priority = src->priority;
+        }
+    }
+    return true;
+}
+
 static void handle_heartbeat(const event_heartbeat_t *hb)
 {
     /* Build protobuf request */
-    portunus_v1_HeartbeatRequest req = portunus_v1_HeartbeatRequest_init_zero;
+    portunus_v1_HeartbeatRequest &req = s_heartbeat_req;
+    req = portunus_v1_HeartbeatRequest_init_zero;
 
     strncpy(req.module_id, s_module_id, sizeof(req.module_id) - 1);
     strncpy(req.firmware_version, PORTUNUS_FW_VERSION, sizeof(req.firmware_version) - 1);
     req.uptime_s        = hb->uptime_sec;
     req.free_heap_bytes = hb->free_heap_bytes;
     req.sequence        = hb->sequence;
+    req.protocol_version = WIRE_SIG_VERSION;
+    req.cpu_cores        = hb->cpu_cores;
+    req.core_isolation   = hb->core_isolation;
+    req.task_plan_faults = hb->task_plan_faults;
+    req.stale_taps       = tap_stats_stale();
+
+    grpc_link_stats_t link;
+    bool link_ok = grpc_client_get_link_stats(s_grpc_handle, &link) == PORTUNUS_OK;
+    if (link_ok) {
+        req.rtt_p50_ms     = link.ping_p50_ms;
+        req.rtt_p90_ms     = link.ping_p90_ms;
+        req.rtt_p99_ms     = link.ping_p99_ms;
+        req.rpc_timeout_ms = link.call_timeout_ms;
+        req.dead_links     = link.dead_links;
+    }
+    req.has_health = fill_health(&req.health, link_ok ? &link : NULL);
+
+    int64_t clock_now_us, clock_error_us;
+    if (clock_server_now(&clock_now_us, &clock_error_us)) {
+        portENTER_CRITICAL(&s_clock_lock);
+        int64_t offset_us = s_clock.last_offset_us;
+        int64_t drift_ppb = s_clock.drift_known ? s_clock.drift_ppb : 0;
+        portEXIT_CRITICAL(&s_clock_lock);
+        req.clock_offset_us = (int32_t)(offset_us > INT32_MAX ? INT32_MAX :
+                                        offset_us < INT32_MIN ? INT32_MIN : offset_us);
+        req.clock_error_us  = (uint32_t)(clock_error_us > UINT32_MAX ? UINT32_MAX : clock_error_us);
+        req.clock_drift_ppb = (int32_t)drift_ppb;
+    }
+
+#ifdef CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT
+    portENTER_CRITICAL(&s_decision_cache_lock);
+    decision_cache_stats_t cache = s_decision_cache.stats;
+    portEXIT_CRITICAL(&s_decision_cache_lock);
+    req.decision_cache_hits          = cache.hits;
+    req.decision_cache_misses        = cache.misses;
+    req.decision_cache_evictions     = cache.evictions;
+    req.decision_cache_invalidations = cache.invalidations;
+
+    portENTER_CRITICAL(&s_filter_lock);
+    req.revocation_filter_version  = s_filter_version;
+    req.revocation_filter_denials  = s_filter_denials;
+    portEXIT_CRITICAL(&s_filter_lock);
+    req.revocation_filter_capacity = PORTUNUS_REVOCATION_FILTER_MAX_BYTES;
+#endif
 
     if (get_sta_ip_str(req.ip, sizeof(req.ip))) {
         /* ip populated */
@@ -444,58 +1082,270 @@ static void handle_heartbeat(const event_heartbeat_t *hb)
         req.rssi_dbm     = rssi;
     }
 
+    wifi_connect_stats_t wifi;
+    wifi_mgr_get_stats(&wifi);
+    req.wifi_connects           = wifi.connects;
+    req.wifi_hinted_connects    = wifi.hinted_connects;
+    req.wifi_scan_fallbacks     = wifi.scan_fallbacks;
+    req.wifi_assoc_to_ip_ms     = wifi.assoc_to_ip_ms;
+    req.wifi_assoc_to_ip_max_ms = wifi.assoc_to_ip_max_ms;
+
+    link_monitor_stats_t radio;
+    wifi_mgr_get_link(&radio);
+    req.wifi_link_quality          = radio.quality;
+    req.wifi_rssi_avg_dbm          = radio.rssi_avg_dbm;
+    req.wifi_rssi_trend_db_per_min = radio.rssi_trend_db_per_min;
+    req.wifi_beacon_losses         = radio.beacon_losses;
+    req.wifi_rpc_failures          = radio.rpc_failures;
+    req.wifi_roam_scans            = radio.roam_scans;
+    req.wifi_roams                 = radio.roams;
+    req.wifi_last_roam_gain_db     = radio.last_roam_gain_db;
+
+    power_policy_stats_t power;
+    wifi_mgr_get_power(&power);
+    req.wifi_awake_s            = (uint32_t)(power.awake_ms / 1000);
+    req.wifi_power_save_s       = (uint32_t)(power.saving_ms / 1000);
+    req.wifi_wakes              = power.wakes;
+    req.access_rpcs_awake       = power.rpcs_awake;
+    req.access_rpc_awake_avg_ms = power.rpc_awake_avg_ms;
+    req.access_rpcs_woken       = power.rpcs_woken;
+    req.access_rpc_woken_avg_ms = power.rpc_woken_avg_ms;
+
+    req.heartbeat_interval_s  = s_pacer.interval_ms / 1000;
+    req.heartbeats_skipped    = s_pacer.stats.skipped;
+    req.heartbeat_bytes_saved = s_pacer.stats.bytes_saved;
+
+    bool boot_complete = false;
+    if (!s_boot_reported) {
+        boot_complete           = boot_timeline_complete();
+        req.boot_config_ms      = boot_timeline_get(BOOT_PHASE_CONFIG);
+        req.boot_wifi_start_ms  = boot_timeline_get(BOOT_PHASE_WIFI_START);
+        req.boot_io_ready_ms    = boot_timeline_get(BOOT_PHASE_IO_READY);
+        req.boot_fsm_ms         = boot_timeline_get(BOOT_PHASE_FSM);
+        req.boot_ip_ms          = boot_timeline_get(BOOT_PHASE_IP);
+        req.boot_server_ms      = boot_timeline_get(BOOT_PHASE_SERVER);
+    }
+
+    /* Leave the static fields out if the server already has these values.
+       Zeroed first so the comparison does not see padding. */
+    heartbeat_static_t statics;
+    memset(&statics, 0, sizeof(statics));
+    strlcpy(statics.firmware_version, req.firmware_version, sizeof(statics.firmware_version));
+    strlcpy(statics.ip, req.ip, sizeof(statics.ip));
+    statics.cpu_cores                  = req.cpu_cores;
+    statics.core_isolation             = req.core_isolation;
+    statics.task_plan_faults           = req.task_plan_faults;
+    statics.revocation_filter_capacity = req.revocation_filter_capacity;
+
+    size_t full_len = 0;
+    if (s_hb_static_acked && memcmp(&statics, &s_hb_static, sizeof(statics)) == 0 &&
+        pb_get_encoded_size(&full_len, portunus_v1_HeartbeatRequest_fields, &req)) {
+        req.static_omitted             = true;
+        req.firmware_version[0]        = '\0';
+        req.ip[0]                      = '\0';
+        req.cpu_cores                  = 0;
+        req.core_isolation             = false;
+        req.task_plan_faults           = 0;
+        req.revocation_filter_capacity = 0;
+    }
+
     /* Encode */
-    uint8_t req_buf[portunus_v1_HeartbeatRequest_size];
-    pb_ostream_t ostream = pb_ostream_from_buffer(req_buf, sizeof(req_buf));
+    uint8_t *req_buf = s_heartbeat_req_buf;
+    pb_ostream_t ostream = pb_ostream_from_buffer(req_buf, sizeof(s_heartbeat_req_buf));
     if (!pb_encode(&ostream, portunus_v1_HeartbeatRequest_fields, &req)) {
         ESP_LOGE(TAG, "Heartbeat encode failed: %s", PB_GET_ERROR(&ostream));
         return;
     }
+    uint32_t omitted_len = full_len > ostream.bytes_written
+                           ? (uint32_t)(full_len - ostream.bytes_written) : 0;
 
     /* POST */
-    uint8_t resp_buf[portunus_v1_HeartbeatResponse_size + 16];  /* small margin */
+    uint8_t *resp_buf = s_heartbeat_resp_buf;
     int resp_len = 0;
-    int64_t t_before = esp_timer_get_time();
-
-    char proj[128];
-    snprintf(proj, sizeof(proj), "heartbeat|%s|%" PRIu32, req.module_id, req.sequence);
+    uint8_t proj[WIRE_SIG_MAX_LEN];
+    size_t proj_len = wire_sig_heartbeat(proj, sizeof(proj), req.module_id, req.sequence);
     int grpc_status = 0;
+    int64_t sent_us = esp_timer_get_time();
     portunus_err_t err = grpc_post_proto(
         "/portunus.v1.PortunusService/SendHeartbeat",
         req_buf, ostream.bytes_written,
-        proj,
-        resp_buf, sizeof(resp_buf),
+        proj, proj_len,
+        resp_buf, sizeof(s_heartbeat_resp_buf),
         &resp_len, &grpc_status, nullptr);
+    int64_t recv_us = esp_timer_get_time();
     if (err != PORTUNUS_OK) {
         ESP_LOGW(TAG, "Heartbeat gRPC failed: err=0x%04x", (unsigned)err);
+        heartbeat_pacer_sent(&s_pacer, sent_us / 1000, false,
+                             (uint32_t)ostream.bytes_written, 0, omitted_len);
         return;
     }
     if (grpc_status != GRPC_STATUS_OK) {
         ESP_LOGW(TAG, "Heartbeat gRPC status: %d", grpc_status);
+        heartbeat_pacer_sent(&s_pacer, sent_us / 1000, false,
+                             (uint32_t)ostream.bytes_written, 0, omitted_len);
         return;
     }
 
     /* Decode response */
     portunus_v1_HeartbeatResponse resp = portunus_v1_HeartbeatResponse_init_zero;
+#ifdef CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT
+    /* Only comm_task writes the spare slot; the reactor reads the live one. */
+    filter_sink_t filter_sink = {};
+    filter_sink.buf = s_filter_slots[s_filter_live ^ 1].fingerprints;
+    filter_sink.cap = PORTUNUS_REVOCATION_FILTER_MAX_BYTES;
+    resp.revocation_filter_fingerprints.funcs.decode = decode_filter_fingerprints;
+    resp.revocation_filter_fingerprints.arg          = &filter_sink;
+#endif
     pb_istream_t istream = pb_istream_from_buffer(resp_buf, (size_t)resp_len);
     if (!pb_decode(&istream, portunus_v1_HeartbeatResponse_fields, &resp)) {
         ESP_LOGW(TAG, "Heartbeat decode failed: %s", PB_GET_ERROR(&istream));
+        heartbeat_pacer_sent(&s_pacer, sent_us / 1000, false,
+                             (uint32_t)ostream.bytes_written, 0, omitted_len);
         return;
     }
 
-    int64_t rtt_us = esp_timer_get_time() - t_before;
-    sync_clock_from_response(resp.server_time, rtt_us);
+    heartbeat_pacer_sent(&s_pacer, sent_us / 1000, true,
+                         (uint32_t)ostream.bytes_written, (uint32_t)resp_len, omitted_len);
+    if (resp.heartbeat_delay_ms > 0) {
+        ESP_LOGD(TAG, "Server pushed the next heartbeat back %" PRIu32 " ms",
+                 resp.heartbeat_delay_ms);
+        heartbeat_pacer_defer(&s_pacer, resp.heartbeat_delay_ms);
+    }
+    if (!req.static_omitted) {
+        memcpy(&s_hb_static, &statics, sizeof(s_hb_static));
+        s_hb_static_acked = true;
+    }
+    if (boot_complete) {
+        s_boot_reported = true;
+        ESP_LOGI(TAG, "Boot timeline reported — config %" PRIu32 " ms, wifi %" PRIu32
+                 " ms, io %" PRIu32 " ms, fsm %" PRIu32 " ms, ip %" PRIu32
+                 " ms, server %" PRIu32 " ms, ready %" PRIu32 " ms",
+                 req.boot_config_ms, req.boot_wifi_start_ms, req.boot_io_ready_ms,
+                 req.boot_fsm_ms, req.boot_ip_ms, req.boot_server_ms,
+                 boot_timeline_ready_ms());
+    }
+    if (resp.resend_static) {
+        ESP_LOGI(TAG, "Server asked for the static heartbeat fields");
+        s_hb_static_acked = false;
+        heartbeat_pacer_note_anomaly(&s_pacer);
+    }
+    /* The server asks until a dump arrives; firmware without health
+       telemetry cannot send one, and must not be rushed for it. */
+    if (resp.health_dump && req.has_health && !req.health.detailed) {
+        ESP_LOGI(TAG, "Server asked for a health dump");
+        heartbeat_service_request_dump();
+        heartbeat_pacer_note_anomaly(&s_pacer);
+    }
+
+    clock_sample_from_response(sent_us, recv_us, resp.server_time_us, resp.server_time);
 
+#ifdef CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT
+    decision_cache_note_version(resp.policy_version);
+    if (PORTUNUS_REVOCATION_FILTER_MAX_BYTES > 0) {
+        revocation_filter_apply(&resp, filter_sink.len, filter_sink.complete);
+    }
+#endif
+
+    bool synced = clock_server_now(&clock_now_us, &clock_error_us) && clock_usable(clock_error_us);
     if (s_reader_degraded) {
         ESP_LOGW(TAG, "Heartbeat OK — known=%d clock_synced=%d [READER DEGRADED]",
-                 resp.known, s_clock_synced);
+                 resp.known, synced);
     } else {
-        ESP_LOGI(TAG, "Heartbeat OK — known=%d clock_synced=%d",
-                 resp.known, s_clock_synced);
+        ESP_LOGI(TAG, "Heartbeat OK — known=%d clock_synced=%d error=%" PRId64 "us",
+                 resp.known, synced, synced ? clock_error_us : (int64_t)-1);
     }
 }
 
 #ifdef CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT
+/* ── Access request transport (tap_retry hooks) ────────────────────────────── */
+
+/** One encoded AccessRequest and the slot its answer lands in. */
+typedef struct {
+    const uint8_t *req_buf;
+    size_t         req_len;
+    const uint8_t *proj;
+    size_t         proj_len;
+    uint8_t       *resp_buf;
+    size_t         resp_cap;
+    char          *sig_hex;
+    int64_t        deadline_ms;
+    int            resp_len;
+    int            grpc_status;
+    int64_t        sent_us;         /**< esp_timer times of the last attempt */
+    int64_t        recv_us;
+} access_call_t;
+
+static int64_t access_call_remaining_ms(void *ctx)
+{
+    return tap_remaining_ms(static_cast<access_call_t *>(ctx)->deadline_ms);
+}
+
+static bool access_call_connection_open(void *ctx)
+{
+    (void)ctx;
+    return grpc_client_is_connected(s_grpc_handle);
+}
+
+static portunus_err_t access_call_attempt(void *ctx, uint32_t budget_ms)
+{
+    access_call_t *call = static_cast<access_call_t *>(ctx);
+    call->resp_len    = 0;
+    call->grpc_status = 0;
+    grpc_client_set_call_timeout(s_grpc_handle, (int)budget_ms);
+    call->sent_us = esp_timer_get_time();
+    portunus_err_t err = grpc_post_proto("/portunus.v1.PortunusService/RequestAccess",
+                                         call->req_buf, call->req_len,
+                                         call->proj, call->proj_len,
+                                         call->resp_buf, call->resp_cap,
+                                         &call->resp_len, &call->grpc_status, call->sig_hex);
+    call->recv_us = esp_timer_get_time();
+    return err;
+}
+
+static void access_call_drop_connection(void *ctx)
+{
+    (void)ctx;
+    grpc_client_disconnect(s_grpc_handle);
+}
+
+static const tap_retry_ops_t s_access_call_ops = {
+    access_call_remaining_ms,
+    access_call_connection_open,
+    access_call_attempt,
+    access_call_drop_connection,
+};
+
+/* A retry needs a reconnect plus a round trip; one probe's worth of time
+   is the least worth starting with. */
+static const tap_retry_policy_t s_tap_retry_policy = {
+    PORTUNUS_TAP_RETRY_ATTEMPTS,
+    PORTUNUS_TAP_PROBE_TIMEOUT_MS,
+    PORTUNUS_TAP_PROBE_TIMEOUT_MS,
+    PORTUNUS_SERVER_REQUEST_TIMEOUT_MS,
+};
+
+/* Extra access-request attempts since boot. */
+static uint32_t s_tap_retries = 0;
+
+/**
+ * @brief Deny a tap that could not be decided.
+ *
+ * For a cached-grant or filter-deny report the door has already acted and
+ * nobody is waiting: log only.  A cached entry stays until its TTL runs
+ * out, a filter entry until the next filter.
+ */
+static void fail_credential(const event_credential_read_t *cred,
+                            const char *log_id, access_reason_t reason)
+{
+    if (cred->cached_grant || cred->filter_denied) {
+        ESP_LOGW(TAG, "%s report for %s not delivered: %s",
+                 cred->cached_grant ? "Cached-grant" : "Filter-deny", log_id,
+                 access_reason_name(reason));
+        return;
+    }
+    publish_access_denied(log_id, reason);
+}
+
 static void handle_credential(const event_credential_read_t *cred)
 {
     /* Build protobuf request */
@@ -503,6 +1353,9 @@ static void handle_credential(const event_credential_read_t *cred)
 
     strncpy(req.module_id, s_module_id, sizeof(req.module_id) - 1);
     credential_uid_to_hex(&cred->credential, req.credential_id, sizeof(req.credential_id));
+    req.cached   = cred->cached_grant;
+    req.filtered = cred->filter_denied;
+    req.protocol_version = WIRE_SIG_VERSION;
 
     char req_log_id[CREDENTIAL_LOG_ID_LEN];
     credential_uid_to_log_id(&cred->credential, req_log_id, sizeof(req_log_id));
@@ -511,19 +1364,11 @@ static void handle_credential(const event_credential_read_t *cred)
     req.nonce.size = 16;
     esp_fill_random(req.nonce.bytes, req.nonce.size);
 
-    /* Replay protection: populate requested_at when the clock is synced. */
-    if (s_clock_synced) {
-        struct timeval tv;
-        gettimeofday(&tv, NULL);
-        struct tm tm_utc;
-        gmtime_r(&tv.tv_sec, &tm_utc);
-        /* Format: "2006-01-02T15:04:05.000000Z" (microsecond precision) */
-        int n = strftime(req.requested_at, sizeof(req.requested_at) - 1,
-                         "%Y-%m-%dT%H:%M:%S", &tm_utc);
-        if (n > 0) {
-            snprintf(req.requested_at + n, sizeof(req.requested_at) - n,
-                     ".%06ldZ", (long)tv.tv_usec);
-        }
+    /* Replay protection: populate requested_at_us only while the server-time
+       estimate is known to within PORTUNUS_CLOCK_MAX_ERROR_MS. */
+    int64_t now_us, error_us;
+    if (clock_server_now(&now_us, &error_us) && clock_usable(error_us)) {
+        req.requested_at_us = now_us;
     }
 
     /* Encode */
@@ -531,13 +1376,12 @@ static void handle_credential(const event_credential_read_t *cred)
     pb_ostream_t ostream = pb_ostream_from_buffer(req_buf, sizeof(req_buf));
     if (!pb_encode(&ostream, portunus_v1_AccessRequest_fields, &req)) {
         ESP_LOGE(TAG, "Access encode failed: %s", PB_GET_ERROR(&ostream));
-        publish_access_denied(req_log_id, "encode_error");
+        fail_credential(cred, req_log_id, ACCESS_REASON_ENCODE_ERROR);
         return;
     }
 
     /* POST */
     uint8_t resp_buf[portunus_v1_AccessResponse_size + 16];
-    int resp_len = 0;
 #if PORTUNUS_HMAC_ENABLED
     char resp_sig_hex[PORTUNUS_HMAC_HEX_LEN] = {};
     char *p_resp_sig = resp_sig_hex;
@@ -545,32 +1389,69 @@ static void handle_credential(const event_credential_read_t *cred)
     char *p_resp_sig = nullptr;
 #endif
 
-    /* Hex-encode nonce for the HMAC projection.
-     * Format: "access|{module_id}|{credential_id}|{nonce_hex}|{requested_at}"
-     * Must match hmacProjection() in grpcapi/interceptors.go. */
-    char nonce_hex[33] = {};
-    for (size_t i = 0; i < req.nonce.size && i * 2 + 2 < sizeof(nonce_hex); ++i) {
-        snprintf(&nonce_hex[i * 2], 3, "%02x",
-                 static_cast<unsigned>(req.nonce.bytes[i]));
-    }
-    char proj[192];
-    snprintf(proj, sizeof(proj), "access|%s|%s|%s|%s",
-             req.module_id, req.credential_id, nonce_hex, req.requested_at);
-    int grpc_status = 0;
-    portunus_err_t err = grpc_post_proto(
-        "/portunus.v1.PortunusService/RequestAccess",
-        req_buf, ostream.bytes_written,
-        proj,
-        resp_buf, sizeof(resp_buf),
-        &resp_len, &grpc_status, p_resp_sig);
+    uint8_t proj[WIRE_SIG_MAX_LEN];
+    size_t proj_len = wire_sig_access(proj, sizeof(proj), req.module_id, req.credential_id,
+                                      req.nonce.bytes, req.nonce.size, req.requested_at_us);
+
+    /* Last check before the network: send only what is left of the budget. */
+    if (tap_remaining_ms(cred->deadline_ms) <= 0) {
+        deny_stale_tap(req_log_id, "send");
+        return;
+    }
+
+    /* Same bytes (nonce, requested_at, signature) on every attempt. */
+    access_call_t call = {};
+    call.req_buf     = req_buf;
+    call.req_len     = ostream.bytes_written;
+    call.proj        = proj;
+    call.proj_len    = proj_len;
+    call.resp_buf    = resp_buf;
+    call.resp_cap    = sizeof(resp_buf);
+    call.sig_hex     = p_resp_sig;
+    call.deadline_ms = cred->deadline_ms;
+
+    /* Probe no longer than the link's own timeout says an answer takes. */
+    tap_retry_policy_t policy = s_tap_retry_policy;
+    grpc_link_stats_t link;
+    if (grpc_client_get_link_stats(s_grpc_handle, &link) == PORTUNUS_OK &&
+        link.call_timeout_ms < policy.probe_ms) {
+        policy.probe_ms = link.call_timeout_ms;
+    }
+
+    /* Out of power save for the call: the answer must not wait at the AP
+       for the next DTIM beacon. */
+    wifi_mgr_awake_begin();
+    tap_retry_result_t sent = tap_retry_run(&policy, &s_access_call_ops, &call);
+    wifi_mgr_awake_end();
+    portunus_err_t err = sent.err;
+    int resp_len    = call.resp_len;
+    int grpc_status = call.grpc_status;
+    if (sent.attempts > 1) {
+        s_tap_retries += sent.attempts - 1;
+        ESP_LOGW(TAG, "Access request for %s took %u attempts (err=0x%04x, %" PRIu32
+                 " retries since boot)",
+                 req_log_id, (unsigned)sent.attempts, (unsigned)err, s_tap_retries);
+    }
+
+    if (tap_retry_is_retryable(err) && tap_remaining_ms(cred->deadline_ms) <= 0) {
+        deny_stale_tap(req_log_id, "response wait");
+        return;
+    }
+    if (err == PORTUNUS_OK) {
+        wifi_mgr_note_access_rpc((uint32_t)((call.recv_us - call.sent_us) / 1000));
+    }
     if (err != PORTUNUS_OK) {
         ESP_LOGW(TAG, "Access gRPC failed: err=0x%04x", (unsigned)err);
-        publish_access_denied(req_log_id, "grpc_error");
+        fail_credential(cred, req_log_id, ACCESS_REASON_GRPC_ERROR);
+        return;
+    }
+    if (grpc_status == GRPC_STATUS_DEADLINE_EXCEEDED) {
+        deny_stale_tap(req_log_id, "server");
         return;
     }
     if (grpc_status != GRPC_STATUS_OK) {
         ESP_LOGW(TAG, "Access gRPC status: %d", grpc_status);
-        publish_access_denied(req_log_id, "grpc_status_error");
+        fail_credential(cred, req_log_id, ACCESS_REASON_GRPC_STATUS_ERROR);
         return;
     }
 
@@ -579,37 +1460,88 @@ static void handle_credential(const event_credential_read_t *cred)
     pb_istream_t istream = pb_istream_from_buffer(resp_buf, (size_t)resp_len);
     if (!pb_decode(&istream, portunus_v1_AccessResponse_fields, &resp)) {
         ESP_LOGW(TAG, "Access decode failed: %s", PB_GET_ERROR(&istream));
-        publish_access_denied(req_log_id, "decode_error");
+        fail_credential(cred, req_log_id, ACCESS_REASON_DECODE_ERROR);
         return;
     }
 
 #if PORTUNUS_HMAC_ENABLED
     /* Verify the server's response signature before acting on the decision.
-     * Projection: "access|{module_id}|{credential_id}|{0 or 1}" — must match
-     * AccessResponseProjection() in server/internal/grpcapi/interceptors.go. */
+     * Projection: wire_sig_access_response() — must match
+     * accessResponseProjection() in server/internal/grpcapi/interceptors.go. */
     if (resp_sig_hex[0] == '\0') {
         ESP_LOGE(TAG, "Access response missing X-Portunus-Sig — denying");
-        publish_access_denied(req_log_id, "missing_response_sig");
+        fail_credential(cred, req_log_id, ACCESS_REASON_MISSING_RESPONSE_SIG);
         return;
     }
-    char resp_proj[128];
-    snprintf(resp_proj, sizeof(resp_proj), "access|%s|%s|%d",
-             req.module_id, req.credential_id, resp.granted ? 1 : 0);
-    char expected_sig[PORTUNUS_HMAC_HEX_LEN];
-    if (!compute_hmac_hex((const uint8_t *)resp_proj, strlen(resp_proj), expected_sig)) {
-        ESP_LOGE(TAG, "HMAC compute failed during response verify");
-        publish_access_denied(req_log_id, "sig_compute_error");
+    uint8_t resp_proj[WIRE_SIG_MAX_LEN];
+    size_t resp_proj_len = wire_sig_access_response(resp_proj, sizeof(resp_proj),
+                                                    req.module_id, req.credential_id,
+                                                    resp.granted, resp.cache_ttl_s,
+                                                    resp.policy_version);
+    if (resp_proj_len == 0) {
+        ESP_LOGE(TAG, "Response projection failed during verify");
+        fail_credential(cred, req_log_id, ACCESS_REASON_SIG_COMPUTE_ERROR);
         return;
     }
-    if (!sig_hex_equal(resp_sig_hex, expected_sig)) {
+    if (!sig_engine_verify_hex(&s_sig_engine, resp_proj, resp_proj_len, resp_sig_hex)) {
         ESP_LOGE(TAG, "Access response HMAC mismatch — denying");
-        publish_access_denied(req_log_id, "invalid_response_sig");
+        fail_credential(cred, req_log_id, ACCESS_REASON_INVALID_RESPONSE_SIG);
         return;
     }
 #endif /* PORTUNUS_HMAC_ENABLED */
 
-    ESP_LOGI(TAG, "Access decision — id=%s granted=%d reason=%s known=%d",
-             req_log_id, resp.granted, resp.reason, resp.known);
+    /* A verified response is a clock sample like a heartbeat, and carries
+       the policy version: a deny after a revoke drops the cached grants at
+       once rather than at the next (paced) heartbeat. */
+    clock_sample_from_response(call.sent_us, call.recv_us, resp.server_time_us, resp.server_time);
+    heartbeat_pacer_note_rpc(&s_pacer, call.recv_us / 1000);
+    decision_cache_note_version(resp.policy_version);
+
+    /* A code this firmware predates arrives as UNSPECIFIED plus the text. */
+    access_reason_t reason = access_reason_from_server((uint32_t)resp.reason_code);
+    const char *reason_name = (reason == ACCESS_REASON_UNSPECIFIED && resp.reason[0] != '\0')
+                              ? resp.reason : access_reason_name(reason);
+
+    ESP_LOGI(TAG, "Access decision — id=%s granted=%d reason=%s known=%d%s",
+             req_log_id, resp.granted, reason_name, resp.known,
+             cred->cached_grant ? " (cached-grant report)" :
+             cred->filter_denied ? " (filter-deny report)" : "");
+
+    if (cred->filter_denied) {
+        /* The door already stayed shut.  A grant means the filter matched
+           an active card; pass it through from now on. */
+        if (resp.granted) {
+            revocation_filter_except(&cred->credential, req_log_id);
+        }
+        return;
+    }
+
+    uint8_t cache_key[DECISION_CACHE_KEY_LEN];
+    bool keyed = PORTUNUS_DECISION_CACHE_ENTRIES > 0 &&
+                 decision_cache_key(&cred->credential, cache_key);
+
+    if (cred->cached_grant) {
+        /* The door already opened.  A grant refreshes the entry; a deny
+           means access was withdrawn since it was cached. */
+        if (keyed && resp.granted) {
+            decision_cache_store_grant(cache_key, resp.cache_ttl_s, resp.policy_version);
+        } else if (keyed && decision_cache_withdraw(cache_key)) {
+            ESP_LOGW(TAG, "Server no longer grants %s (%s) — cached grant dropped",
+                     req_log_id, reason_name);
+        }
+        return;
+    }
+
+    /* A grant that arrives after the deadline must not open the door. */
+    if (resp.granted && tap_remaining_ms(cred->deadline_ms) <= 0) {
+        deny_stale_tap(req_log_id, "decision");
+        return;
+    }
+
+    /* Only a verified, on-time grant is worth remembering. */
+    if (keyed && resp.granted) {
+        decision_cache_store_grant(cache_key, resp.cache_ttl_s, resp.policy_version);
+    }
 
     /* Publish decision event back to the bus */
     portunus_event_t decision;
@@ -618,10 +1550,10 @@ static void handle_credential(const event_credential_read_t *cred)
 
     strncpy(decision.payload.access_decision.credential_id, req_log_id,
             sizeof(decision.payload.access_decision.credential_id) - 1);
-    strncpy(decision.payload.access_decision.reason, resp.reason,
-            sizeof(decision.payload.access_decision.reason) - 1);
-    decision.payload.access_decision.granted = resp.granted;
-    decision.payload.access_decision.known   = resp.known;
+    decision.payload.access_decision.reason      = reason;
+    decision.payload.access_decision.granted     = resp.granted;
+    decision.payload.access_decision.known       = resp.known;
+    decision.payload.access_decision.deadline_ms = cred->deadline_ms;
 
     event_bus_publish(&decision);
 }
@@ -661,6 +1593,7 @@ static void handle_provision(const event_provision_request_t *req)
 
     strncpy(pb_req.module_id, s_module_id,
             sizeof(pb_req.module_id) - 1);
+    pb_req.protocol_version = WIRE_SIG_VERSION;
 
     /* New member card UID — server applies HMAC-SHA256 before storing. */
     size_t uid_n = req->credential_uid_len;
@@ -683,22 +1616,15 @@ static void handle_provision(const event_provision_request_t *req)
     uint8_t resp_buf[portunus_v1_ProvisionCredentialResponse_size + 16];
     int resp_len = 0;
 
-    /* Hex-encode credential_uid for the HMAC projection.
-     * Must match hmacProjection() in grpcapi/interceptors.go. */
-    char uid_hex[64] = {};
-    for (size_t i = 0;
-         i < pb_req.credential_uid.size && i * 2 + 2 < sizeof(uid_hex);
-         ++i) {
-        snprintf(&uid_hex[i * 2], 3, "%02x",
-                 static_cast<unsigned>(pb_req.credential_uid.bytes[i]));
-    }
-    char proj[128];
-    snprintf(proj, sizeof(proj), "provision|%s|%s", pb_req.module_id, uid_hex);
+    uint8_t proj[WIRE_SIG_MAX_LEN];
+    size_t proj_len = wire_sig_provision(proj, sizeof(proj), pb_req.module_id,
+                                         pb_req.credential_uid.bytes,
+                                         pb_req.credential_uid.size);
     int grpc_status = 0;
     portunus_err_t err = grpc_post_proto(
         "/portunus.v1.PortunusService/ProvisionCredential",
         req_buf, ostream.bytes_written,
-        proj,
+        proj, proj_len,
         resp_buf, sizeof(resp_buf),
         &resp_len, &grpc_status, nullptr);
     if (err != PORTUNUS_OK) {
@@ -721,6 +1647,7 @@ static void handle_provision(const event_provision_request_t *req)
         publish_provision_result(PROVISION_RESULT_COMM_ERROR, NULL, "decode_error");
         return;
     }
+    heartbeat_pacer_note_rpc(&s_pacer, esp_timer_get_time() / 1000);
 
     ESP_LOGI(TAG, "Provision response — status=%d member_uuid=%s detail=%s",
              pb_resp.status, pb_resp.member_uuid, pb_resp.detail);
@@ -749,6 +1676,84 @@ static void handle_provision(const event_provision_request_t *req)
 
 /* ── Task ──────────────────────────────────────────────────────────────────── */
 
+/**
+ * @brief PING an idle connection and replace it at once if it is dead.
+ *
+ * Runs on every idle queue timeout (~1 s).  An answered PING lets the
+ * interval grow; an unanswered one (grpc_client closes the connection)
+ * shrinks it below the idle time that killed the link, and the reconnect
+ * happens here rather than on the next tap, once grpc_client's spread
+ * allows.
+ */
+static void keepalive_tick(void)
+{
+    if (s_grpc_handle == NULL) {
+        return;
+    }
+    if (!grpc_client_is_connected(s_grpc_handle)) {
+        if (s_reconnect_pending && wifi_mgr_is_connected() &&
+            grpc_client_connect_due(s_grpc_handle)) {
+            s_reconnect_pending = false;
+            wifi_mgr_awake_begin();
+            wifi_mgr_rpc_begin();
+            portunus_err_t cerr = grpc_client_connect(s_grpc_handle);
+            wifi_mgr_rpc_end(cerr == PORTUNUS_OK);
+            wifi_mgr_awake_end();
+            if (cerr != PORTUNUS_OK) {
+                ESP_LOGW(TAG, "Background reconnect failed: 0x%04x", (unsigned)cerr);
+            }
+        }
+        return;
+    }
+    int64_t now_us = esp_timer_get_time();
+    uint32_t idle_ms = (uint32_t)((now_us - s_last_traffic_us) / 1000);
+    if (!keepalive_due(&s_keepalive, idle_ms)) {
+        return;
+    }
+
+    wifi_mgr_rpc_begin();
+    portunus_err_t perr = grpc_client_send_ping(s_grpc_handle);
+    wifi_mgr_rpc_end(perr == PORTUNUS_OK);
+    s_last_traffic_us = esp_timer_get_time();
+    if (perr == PORTUNUS_OK) {
+        keepalive_on_ack(&s_keepalive);
+        return;
+    }
+
+    keepalive_on_dead(&s_keepalive, idle_ms);
+    ESP_LOGW(TAG, "Connection dead after %" PRIu32 " ms idle (0x%04x) — reconnecting, "
+             "keepalive now %" PRIu32 " ms",
+             idle_ms, (unsigned)perr, s_keepalive.interval_ms);
+    s_reconnect_pending = true;
+}
+
+/**
+ * @brief Connect as soon as WiFi has an IP (EVENT_NETWORK_UP).
+ *
+ * At boot this overlaps the TLS handshake with the rest of start-up, so
+ * the first tap does not pay for it.  A failure leaves the reconnect to
+ * keepalive_tick(), paced by grpc_client.
+ */
+static void connect_on_ip(void)
+{
+    if (grpc_client_is_connected(s_grpc_handle) || !grpc_client_connect_due(s_grpc_handle)) {
+        return;
+    }
+    wifi_mgr_awake_begin();
+    wifi_mgr_rpc_begin();
+    portunus_err_t err = grpc_client_connect(s_grpc_handle);
+    wifi_mgr_rpc_end(err == PORTUNUS_OK);
+    wifi_mgr_awake_end();
+    if (err != PORTUNUS_OK) {
+        ESP_LOGW(TAG, "Connect on IP failed: 0x%04x", (unsigned)err);
+        s_reconnect_pending = true;
+        return;
+    }
+    s_reconnect_pending = false;
+    boot_timeline_mark(BOOT_PHASE_SERVER, (uint32_t)(esp_timer_get_time() / 1000));
+    ESP_LOGI(TAG, "Connected to server on IP");
+}
+
 static void comm_task(void *arg)
 {
     (void)arg;
@@ -758,36 +1763,55 @@ static void comm_task(void *arg)
 
     for (;;) {
         if (xQueueReceive(s_comm_queue, &event, pdMS_TO_TICKS(1000)) != pdTRUE) {
-            if (++s_idle_ticks >= GRPC_PING_INTERVAL_TICKS) {
-                s_idle_ticks = 0;
-                if (s_grpc_handle != NULL && grpc_client_is_connected(s_grpc_handle)) {
-                    portunus_err_t perr = grpc_client_send_ping(s_grpc_handle);
-                    if (perr != PORTUNUS_OK) {
-                        ESP_LOGW(TAG, "keepalive PING failed: 0x%04x", (unsigned)perr);
-                    }
-                }
-            }
+            keepalive_tick();
             continue;   /* Idle tick — nothing queued */
         }
 
-        s_idle_ticks = 0;  /* Reset on any RPC activity */
+        /* Drop taps that went stale waiting in the queue before spending
+           a round trip on them. */
+        if (event.id == EVENT_CREDENTIAL_READ &&
+            tap_remaining_ms(event.payload.credential_read.deadline_ms) <= 0) {
+            char log_id[CREDENTIAL_LOG_ID_LEN];
+            credential_uid_to_log_id(&event.payload.credential_read.credential,
+                                     log_id, sizeof(log_id));
+            deny_stale_tap(log_id, "dequeue");
+            task_boost_release(&s_boost);
+            continue;
+        }
 
         if (!wifi_mgr_is_connected()) {
             ESP_LOGD(TAG, "WiFi not connected — dropping event 0x%04x",
                      (unsigned)event.id);
 
             /* Credential events need a deny so the FSM clears CARD_READ
-               feedback.  Heartbeats can be silently dropped. */
-            if (event.id == EVENT_CREDENTIAL_READ) {
+               feedback.  Heartbeats can be silently dropped; the first
+               tick after the link is back is sent. */
+            if (event.id == EVENT_HEARTBEAT) {
+                heartbeat_pacer_note_anomaly(&s_pacer);
+            }
+            if (event.id == EVENT_CREDENTIAL_READ && is_tap_request(&event)) {
                 char log_id[CREDENTIAL_LOG_ID_LEN];
                 credential_uid_to_log_id(&event.payload.credential_read.credential,
                                          log_id, sizeof(log_id));
-                publish_access_denied(log_id, "no_network");
+                publish_access_denied(log_id, ACCESS_REASON_NO_NETWORK);
+            }
+            if (is_tap_request(&event)) {
+                task_boost_release(&s_boost);
             }
             continue;
         }
 
+        /* A tick the pacer skips is not traffic; keepalive covers the link. */
+        if (event.id == EVENT_HEARTBEAT && !heartbeat_due(&event.payload.heartbeat)) {
+            continue;
+        }
+
+        s_last_traffic_us = esp_timer_get_time();  /* Reset on any RPC activity */
+
         switch (event.id) {
+        case EVENT_NETWORK_UP:
+            connect_on_ip();
+            break;
         case EVENT_HEARTBEAT:
             handle_heartbeat(&event.payload.heartbeat);
             break;
@@ -803,10 +1827,12 @@ static void comm_task(void *arg)
 #endif
         case EVENT_CREDENTIAL_READ_ERROR:
             s_reader_degraded = true;
+            heartbeat_pacer_note_anomaly(&s_pacer);
             ESP_LOGW(TAG, "Credential reader degraded — heartbeats will reflect fault");
             break;
         case EVENT_CREDENTIAL_READER_RECOVERED:
             s_reader_degraded = false;
+            heartbeat_pacer_note_anomaly(&s_pacer);
             ESP_LOGI(TAG, "Credential reader recovered — heartbeats nominal");
             break;
         default:
@@ -814,6 +1840,10 @@ static void comm_task(void *arg)
                      (unsigned)event.id);
             break;
         }
+
+        if (is_tap_request(&event)) {
+            task_boost_release(&s_boost);
+        }
     }
 }
 
@@ -821,7 +1851,8 @@ static void comm_task(void *arg)
 
 bool server_comm_clock_synced(void)
 {
-    return s_clock_synced;
+    int64_t now_us, error_us;
+    return clock_server_now(&now_us, &error_us) && clock_usable(error_us);
 }
 
 portunus_err_t server_comm_init(const portunus_device_config_t *cfg)
@@ -836,12 +1867,16 @@ portunus_err_t server_comm_init(const portunus_device_config_t *cfg)
     s_grpc_port = cfg->grpc_port;
 
 #if PORTUNUS_HMAC_ENABLED
-    strlcpy(s_hmac_secret, cfg->hmac_secret, sizeof(s_hmac_secret));
-    s_hmac_secret_len = strlen(cfg->hmac_secret);
-    if (s_hmac_secret_len == 0) {
+    size_t hmac_secret_len = strnlen(cfg->hmac_secret, sizeof(cfg->hmac_secret));
+    if (hmac_secret_len == 0) {
         ESP_LOGE(TAG, "HMAC is enabled but hmac_secret is empty in NVS");
         return PORTUNUS_FAIL;
     }
+    /* Keyed with the secret's characters, as the server keys its HMAC. */
+    if (!sig_engine_init(&s_sig_engine, (const uint8_t *)cfg->hmac_secret, hmac_secret_len)) {
+        ESP_LOGE(TAG, "HMAC key set-up failed");
+        return PORTUNUS_FAIL;
+    }
 #endif
 
     /* Configure gRPC client (HTTP/2 + TLS). */
@@ -851,12 +1886,48 @@ portunus_err_t server_comm_init(const portunus_device_config_t *cfg)
         grpc_cfg.port               = s_grpc_port;
         grpc_cfg.connect_timeout_ms = PORTUNUS_SERVER_REQUEST_TIMEOUT_MS;
         grpc_cfg.rpc_timeout_ms     = PORTUNUS_SERVER_REQUEST_TIMEOUT_MS;
+        grpc_cfg.min_rpc_timeout_ms = PORTUNUS_GRPC_MIN_RPC_TIMEOUT_MS;
+        grpc_cfg.reconnect_base_ms  = PORTUNUS_GRPC_RECONNECT_BASE_MS;
+        grpc_cfg.reconnect_max_ms   = PORTUNUS_GRPC_RECONNECT_MAX_MS;
+        grpc_cfg.dns_ttl_ms         = PORTUNUS_GRPC_DNS_TTL_S * 1000U;
+        grpc_cfg.dns_stale_fallback = PORTUNUS_GRPC_DNS_STALE_FALLBACK;
+        grpc_cfg.session_arena_bytes = PORTUNUS_GRPC_SESSION_ARENA_SIZE;
         grpc_cfg.skip_cert_verify   = PORTUNUS_TLS_SKIP_VERIFY;
 
       #if PORTUNUS_TLS_USE_CUSTOM_CA
-        grpc_cfg.ca_cert_pem = ca_cert_pem_start;
+        grpc_cfg.ca_cert_der     = ca_cert_der_start;
+        grpc_cfg.ca_cert_der_len = (size_t)(ca_cert_der_end - ca_cert_der_start);
       #else
-        grpc_cfg.ca_cert_pem = NULL; /* Use ESP-IDF cert bundle */
+        grpc_cfg.ca_cert_der = NULL; /* Use ESP-IDF cert bundle */
+      #endif
+
+      #if PORTUNUS_USE_TLS
+        static uint8_t spki_pin[TLS_TRUST_PIN_LEN];
+        if (PORTUNUS_TLS_SPKI_PIN[0] != '\0') {
+            if (!tls_trust_parse_pin(PORTUNUS_TLS_SPKI_PIN, spki_pin)) {
+                ESP_LOGE(TAG, "PORTUNUS_TLS_SPKI_PIN is not 64 hex digits");
+                return PORTUNUS_FAIL;
+            }
+            grpc_cfg.spki_pin_sha256 = spki_pin;
+            ESP_LOGI(TAG, "TLS: server key pinned (SPKI SHA-256)");
+        }
+      #endif
+
+      #if PORTUNUS_USE_TLS && PORTUNUS_TLS_PROFILE == 2
+        /* PSK: 32 bytes from NVS, written as 64 hex digits like the pin. */
+        static uint8_t tls_psk[TLS_PROFILE_PSK_MAX_LEN];
+        size_t tls_psk_len = tls_trust_parse_hex(cfg->tls_psk, tls_psk, sizeof(tls_psk));
+        if (tls_psk_len != sizeof(tls_psk)) {
+            ESP_LOGE(TAG, "PSK transport profile needs tls_psk (64 hex chars) in NVS");
+            return PORTUNUS_FAIL;
+        }
+        grpc_cfg.tls_profile.id           = TLS_PROFILE_PSK;
+        grpc_cfg.tls_profile.psk          = tls_psk;
+        grpc_cfg.tls_profile.psk_len      = tls_psk_len;
+        grpc_cfg.tls_profile.psk_identity = s_module_id;
+        grpc_cfg.tls_profile.psk_dhe      = PORTUNUS_TLS_PSK_DHE;
+      #elif PORTUNUS_USE_TLS && PORTUNUS_TLS_PROFILE == 1
+        grpc_cfg.tls_profile.id = TLS_PROFILE_ECC;
       #endif
 
         portunus_err_t grpc_err = grpc_client_init(&grpc_cfg, &s_grpc_handle);
@@ -871,6 +1942,10 @@ portunus_err_t server_comm_init(const portunus_device_config_t *cfg)
     /* Clock: operate in UTC so mktime() in parse_server_time() is correct. */
     setenv("TZ", "UTC0", 1);
     tzset();
+    clock_discipline_init(&s_clock, &s_clock_cfg);
+
+    const heartbeat_pacer_config_t pacer_cfg = {HEARTBEAT_INTERVAL_MS, HEARTBEAT_MAX_INTERVAL_MS};
+    heartbeat_pacer_init(&s_pacer, &pacer_cfg);
 
     /* Create internal queue */
     s_comm_queue = xQueueCreate(COMM_QUEUE_LENGTH, sizeof(portunus_event_t));
@@ -897,6 +1972,11 @@ portunus_err_t server_comm_init(const portunus_device_config_t *cfg)
         ESP_LOGE(TAG, "Failed to subscribe to reader recovery events: 0x%04x", (unsigned)sub_err);
     }
 
+    sub_err = event_bus_subscribe(EVENT_NETWORK_UP, on_network_up_event, NULL);
+    if (sub_err != PORTUNUS_OK) {
+        ESP_LOGE(TAG, "Failed to subscribe to network-up events: 0x%04x", (unsigned)sub_err);
+    }
+
 #ifdef CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT
     sub_err = event_bus_subscribe(EVENT_CREDENTIAL_READ, on_credential_event, NULL);
     if (sub_err != PORTUNUS_OK) {
@@ -910,19 +1990,45 @@ portunus_err_t server_comm_init(const portunus_device_config_t *cfg)
     }
 #endif
 
+#ifdef CONFIG_PORTUNUS_MODULE_TYPE_ACCESS_POINT
+    decision_cache_init(&s_decision_cache, PORTUNUS_DECISION_CACHE_ENTRIES);
+    {
+        uint8_t cache_key_secret[32];
+        esp_fill_random(cache_key_secret, sizeof(cache_key_secret));
+        bool keyed = sig_engine_init(&s_cache_key_engine, cache_key_secret,
+                                     sizeof(cache_key_secret));
+        memset(cache_key_secret, 0, sizeof(cache_key_secret));
+        if (!keyed) {
+            /* decision_cache_key() then fails and every tap asks the server. */
+            ESP_LOGE(TAG, "Decision cache key set-up failed — cache disabled");
+        }
+    }
+#endif
+
+    keepalive_init(&s_keepalive,
+                   PORTUNUS_GRPC_KEEPALIVE_MIN_S * 1000u,
+                   PORTUNUS_GRPC_KEEPALIVE_MAX_S * 1000u,
+                   GRPC_KEEPALIVE_INITIAL_MS);
+    s_last_traffic_us = esp_timer_get_time();
+
     /* Start task */
-    BaseType_t ret = xTaskCreate(
+    BaseType_t ret = xTaskCreatePinnedToCore(
         comm_task,
         "server_comm",
         COMM_TASK_STACK_SIZE,
         NULL,
-        COMM_TASK_PRIORITY,
-        &s_comm_task
+        SERVER_COMM_TASK_PRIORITY,
+        &s_comm_task,
+        TASK_CORE_NET
     );
     if (ret != pdPASS) {
         ESP_LOGE(TAG, "Failed to create comm task");
         return PORTUNUS_ERR_TASK_CREATE;
     }
+    task_boost_init(&s_boost, s_comm_task,
+                    SERVER_COMM_TASK_PRIORITY, SERVER_COMM_BOOST_PRIORITY);
+
+    wifi_mgr_set_ip_callback(on_ip_obtained, NULL);
 
     s_initialized = true;
     ESP_LOGI(TAG, "Server comm initialised");
@@ -935,12 +2041,16 @@ void server_comm_deinit(void)
         return;
     }
 
+    wifi_mgr_set_ip_callback(NULL, NULL);
+
     /* Delete the network task first so it stops pulling from the queue. */
     if (s_comm_task != NULL) {
         vTaskDelete(s_comm_task);
         s_comm_task = NULL;
     }
 
+    task_boost_init(&s_boost, NULL, SERVER_COMM_TASK_PRIORITY, SERVER_COMM_BOOST_PRIORITY);
+
     /* Drain and delete the internal queue. */
     if (s_comm_queue != NULL) {
         portunus_event_t discarded;
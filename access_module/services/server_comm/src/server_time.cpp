@@ -0,0 +1,51 @@
+/**
+ * @file server_time.cpp
+ * @brief Parse the server's RFC 3339 timestamps — implementation.
+ */
+
+#include "server_time.hpp"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+bool parse_server_time(const char *s, struct timeval *out)
+{
+    if (s == NULL || s[0] == '\0') { return false; }
+
+    int year, mon, mday, hour, min, sec;
+    if (sscanf(s, "%4d-%2d-%2dT%2d:%2d:%2d",
+               &year, &mon, &mday, &hour, &min, &sec) < 6) {
+        return false;
+    }
+
+    struct tm tm = {};
+    tm.tm_year  = year - 1900;
+    tm.tm_mon   = mon - 1;
+    tm.tm_mday  = mday;
+    tm.tm_hour  = hour;
+    tm.tm_min   = min;
+    tm.tm_sec   = sec;
+    tm.tm_isdst = 0;
+
+    /* TZ=UTC0 ensures mktime() treats this as UTC, not local time. */
+    time_t t = mktime(&tm);
+    if (t == (time_t)-1) { return false; }
+
+    /* Parse fractional seconds (e.g. ".123456789") → microseconds. */
+    long usec = 0;
+    const char *dot = strchr(s, '.');
+    if (dot != NULL) {
+        /* Copy up to 9 digits, right-pad with '0' to get nanoseconds. */
+        char frac[10] = {'0','0','0','0','0','0','0','0','0','\0'};
+        int i = 0;
+        const char *p = dot + 1;
+        while (i < 9 && *p >= '0' && *p <= '9') { frac[i++] = *p++; }
+        usec = strtol(frac, NULL, 10) / 1000;  /* ns → µs */
+    }
+
+    out->tv_sec  = t;
+    out->tv_usec = (suseconds_t)usec;
+    return true;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file sig_engine.cpp
+ * @brief HMAC-SHA256 with a precomputed key schedule — implementation.
+ */
+
+#include "sig_engine.hpp"
+
+#include "mbedtls/platform_util.h"
+
+#include <string.h>
+
+#define SHA256_BLOCK_LEN 64
+
+static bool absorb_pad(mbedtls_sha256_context *ctx, const uint8_t *key, uint8_t pad)
+{
+    uint8_t block[SHA256_BLOCK_LEN];
+    for (size_t i = 0; i < SHA256_BLOCK_LEN; i++) {
+        block[i] = key[i] ^ pad;
+    }
+    bool ok = mbedtls_sha256_starts(ctx, 0) == 0 &&
+              mbedtls_sha256_update(ctx, block, sizeof(block)) == 0;
+    mbedtls_platform_zeroize(block, sizeof(block));
+    return ok;
+}
+
+bool sig_engine_init(sig_engine_t *e, const uint8_t *key, size_t key_len)
+{
+    mbedtls_sha256_init(&e->inner);
+    mbedtls_sha256_init(&e->outer);
+    e->ready = false;
+
+    /* A key longer than a block is replaced by its hash (RFC 2104). */
+    uint8_t k[SHA256_BLOCK_LEN] = {};
+    bool ok = true;
+    if (key_len > SHA256_BLOCK_LEN) {
+        ok = mbedtls_sha256(key, key_len, k, 0) == 0;
+    } else if (key_len > 0) {
+        memcpy(k, key, key_len);
+    }
+    ok = ok && absorb_pad(&e->inner, k, 0x36) && absorb_pad(&e->outer, k, 0x5c);
+    mbedtls_platform_zeroize(k, sizeof(k));
+
+    if (!ok) {
+        sig_engine_free(e);
+        return false;
+    }
+    e->ready = true;
+    return true;
+}
+
+void sig_engine_free(sig_engine_t *e)
+{
+    mbedtls_sha256_free(&e->inner);
+    mbedtls_sha256_free(&e->outer);
+    mbedtls_platform_zeroize(e, sizeof(*e));
+}
+
+bool sig_engine_mac(const sig_engine_t *e, const uint8_t *data, size_t len,
+                    uint8_t mac[SIG_ENGINE_MAC_LEN])
+{
+    if (!e->ready) {
+        return false;
+    }
+    mbedtls_sha256_context ctx;
+    mbedtls_sha256_init(&ctx);
+
+    uint8_t inner[SIG_ENGINE_MAC_LEN];
+    mbedtls_sha256_clone(&ctx, &e->inner);
+    bool ok = mbedtls_sha256_update(&ctx, data, len) == 0 &&
+              mbedtls_sha256_finish(&ctx, inner) == 0;
+    if (ok) {
+        mbedtls_sha256_clone(&ctx, &e->outer);
+        ok = mbedtls_sha256_update(&ctx, inner, sizeof(inner)) == 0 &&
+             mbedtls_sha256_finish(&ctx, mac) == 0;
+    }
+    mbedtls_sha256_free(&ctx);
+    return ok;
+}
+
+bool sig_engine_sign_hex(const sig_engine_t *e, const uint8_t *data, size_t len,
+                         char out_hex[SIG_ENGINE_HEX_LEN])
+{
+    uint8_t mac[SIG_ENGINE_MAC_LEN];
+    if (!sig_engine_mac(e, data, len, mac)) {
+        return false;
+    }
+    static const char hex_chars[] = "0123456789abcdef";
+    for (size_t i = 0; i < SIG_ENGINE_MAC_LEN; i++) {
+        out_hex[i * 2]     = hex_chars[mac[i] >> 4];
+        out_hex[i * 2 + 1] = hex_chars[mac[i] & 0x0F];
+    }
+    out_hex[SIG_ENGINE_HEX_LEN - 1] = '\0';
+    return true;
+}
+
+bool sig_engine_verify_hex(const sig_engine_t *e, const uint8_t *data, size_t len,
+                           const char *sig_hex)
+{
+    char expected[SIG_ENGINE_HEX_LEN];
+    if (!sig_engine_sign_hex(e, data, len, expected)) {
+        return false;
+    }
+    uint8_t diff = 0;
+    for (size_t i = 0; i < SIG_ENGINE_HEX_LEN - 1; i++) {
+        diff |= (uint8_t)expected[i] ^ (uint8_t)sig_hex[i];
+    }
+    return diff == 0;
+}
@@ -0,0 +1,59 @@
+/**
+ * @file tap_retry.cpp
+ * @brief Retry policy for access requests that hit a dead connection — implementation.
+ */
+
+#include "tap_retry.hpp"
+
+bool tap_retry_is_retryable(portunus_err_t err)
+{
+    return err == PORTUNUS_ERR_HTTP_CONNECT || err == PORTUNUS_ERR_TIMEOUT;
+}
+
+uint32_t tap_retry_attempt_ms(const tap_retry_policy_t *policy, uint8_t attempt,
+                              int64_t remaining_ms, bool reused)
+{
+    if (remaining_ms <= 0) {
+        return 0;
+    }
+    if (attempt > 0 && remaining_ms < (int64_t)policy->min_attempt_ms) {
+        return 0;
+    }
+
+    uint32_t budget = (remaining_ms < (int64_t)policy->max_attempt_ms)
+                      ? (uint32_t)remaining_ms : policy->max_attempt_ms;
+
+    /* Probe a possibly half-open connection briefly, but only if a full
+       retry still fits behind the probe. */
+    bool last = (uint32_t)attempt + 1 >= policy->max_attempts;
+    if (reused && !last && policy->probe_ms < budget &&
+        remaining_ms - (int64_t)policy->probe_ms >= (int64_t)policy->min_attempt_ms) {
+        budget = policy->probe_ms;
+    }
+    return budget;
+}
+
+tap_retry_result_t tap_retry_run(const tap_retry_policy_t *policy,
+                                 const tap_retry_ops_t *ops, void *ctx)
+{
+    tap_retry_result_t result = { PORTUNUS_ERR_TIMEOUT, 0 };
+    uint8_t max_attempts = (policy->max_attempts == 0) ? 1 : policy->max_attempts;
+
+    for (uint8_t i = 0; i < max_attempts; i++) {
+        uint32_t budget = tap_retry_attempt_ms(policy, i, ops->remaining_ms(ctx),
+                                               ops->connection_open(ctx));
+        if (budget == 0) {
+            break;
+        }
+
+        result.err = ops->attempt(ctx, budget);
+        result.attempts++;
+        if (!tap_retry_is_retryable(result.err)) {
+            break;
+        }
+        /* A timed-out stream leaves the connection nominally open; make
+           sure nothing reuses it. */
+        ops->drop_connection(ctx);
+    }
+    return result;
+}
@@ -0,0 +1,105 @@
+/**
+ * @file wire_sig.cpp
+ * @brief Binary signing projections — implementation.
+ */
+
+#include "wire_sig.hpp"
+
+#include <string.h>
+
+namespace {
+
+/** Append cursor; len goes past cap on overflow so finish() can reject it. */
+struct Writer {
+    uint8_t *out;
+    size_t   cap;
+    size_t   len;
+    bool     bad;
+
+    void put(const void *p, size_t n)
+    {
+        if (len + n <= cap) {
+            memcpy(out + len, p, n);
+        }
+        len += n;
+    }
+
+    void byte(uint8_t b) { put(&b, 1); }
+
+    void field(const void *p, size_t n)
+    {
+        if (n > 255) {
+            bad = true;
+            return;
+        }
+        byte((uint8_t)n);
+        put(p, n);
+    }
+
+    void str(const char *s) { field(s, s ? strlen(s) : 0); }
+
+    void le(uint64_t v, size_t width)
+    {
+        for (size_t i = 0; i < width; i++) {
+            byte((uint8_t)(v >> (8 * i)));
+        }
+    }
+
+    size_t finish() const { return (bad || len > cap) ? 0 : len; }
+};
+
+Writer start(uint8_t *out, size_t cap, char kind)
+{
+    Writer w = {out, cap, 0, false};
+    w.byte((uint8_t)kind);
+    w.byte(WIRE_SIG_VERSION);
+    return w;
+}
+
+} // namespace
+
+size_t wire_sig_heartbeat(uint8_t *out, size_t cap,
+                          const char *module_id, uint32_t sequence)
+{
+    Writer w = start(out, cap, 'H');
+    w.str(module_id);
+    w.le(sequence, 4);
+    return w.finish();
+}
+
+size_t wire_sig_access(uint8_t *out, size_t cap,
+                       const char *module_id, const char *credential_id,
+                       const uint8_t *nonce, size_t nonce_len,
+                       int64_t requested_at_us)
+{
+    Writer w = start(out, cap, 'A');
+    w.str(module_id);
+    w.str(credential_id);
+    w.field(nonce, nonce_len);
+    w.le((uint64_t)requested_at_us, 8);
+    return w.finish();
+}
+
+size_t wire_sig_access_response(uint8_t *out, size_t cap,
+                                const char *module_id, const char *credential_id,
+                                bool granted, uint32_t cache_ttl_s,
+                                uint32_t policy_version)
+{
+    Writer w = start(out, cap, 'a');
+    w.str(module_id);
+    w.str(credential_id);
+    w.byte(granted ? 1 : 0);
+    w.le(cache_ttl_s, 4);
+    w.le(policy_version, 4);
+    return w.finish();
+}
+
+size_t wire_sig_provision(uint8_t *out, size_t cap,
+                          const char *module_id,
+                          const uint8_t *credential_uid, size_t uid_len)
+{
+    Writer w = start(out, cap, 'P');
+    w.str(module_id);
+    w.field(credential_uid, uid_len);
+    return w.finish();
+}
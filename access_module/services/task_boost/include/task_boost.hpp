@@ -0,0 +1,44 @@
+/**
+ * @file task_boost.hpp
+ * @brief Raise a worker task's priority while latency-critical work is pending.
+ *
+ * The worker normally runs at @c base.  A producer calls task_boost_hold()
+ * just before queueing urgent work; the worker calls task_boost_release()
+ * once that item is handled.  While at least one hold is outstanding the
+ * worker runs at @c boost, including any unrelated item it is already
+ * part-way through, so urgent work is never stuck behind a slow
+ * low-priority request.
+ *
+ * Holds are counted, not nested by caller: N holds need N releases.  Both
+ * calls are safe from any task (not from ISRs) and never block.
+ */
+
+#pragma once
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include <atomic>
+#include <stdint.h>
+
+typedef struct {
+    TaskHandle_t          task;
+    UBaseType_t           base;
+    UBaseType_t           boost;
+    std::atomic<uint32_t> holds;
+} task_boost_t;
+
+/** Bind @p tb to @p task.  Sets the task to @p base.  @p boost == @p base disables boosting. */
+void task_boost_init(task_boost_t *tb, TaskHandle_t task, UBaseType_t base, UBaseType_t boost);
+
+/** Mark one urgent item pending; raises the task on the first hold. */
+void task_boost_hold(task_boost_t *tb);
+
+/** One urgent item handled (or dropped); restores @c base on the last release. */
+void task_boost_release(task_boost_t *tb);
+
+/** Drop every outstanding hold and restore @c base (queue flushed / task restarted). */
+void task_boost_reset(task_boost_t *tb);
+
+/** Outstanding holds. */
+uint32_t task_boost_pending(const task_boost_t *tb);
@@ -0,0 +1,66 @@
+/**
+ * @file task_boost.cpp
+ * @brief Worker priority boost — implementation.
+ *
+ * No lock: hold/release only touch the atomic counter, then apply() sets
+ * the priority matching it.  A hold and a release racing can each read the
+ * counter and then call vTaskPrioritySet() in the opposite order, so
+ * apply() re-reads the counter afterwards and repeats until the priority
+ * it set still matches.  The last caller to finish therefore always
+ * leaves the priority the current count calls for.
+ */
+
+#include "task_boost.hpp"
+
+static void apply(task_boost_t *tb)
+{
+    if (tb->task == NULL || tb->boost == tb->base) {
+        return;
+    }
+    for (;;) {
+        uint32_t holds = tb->holds.load();
+        vTaskPrioritySet(tb->task, (holds > 0) ? tb->boost : tb->base);
+        if (tb->holds.load() == holds) {
+            return;
+        }
+    }
+}
+
+void task_boost_init(task_boost_t *tb, TaskHandle_t task, UBaseType_t base, UBaseType_t boost)
+{
+    tb->task  = task;
+    tb->base  = base;
+    tb->boost = boost;
+    tb->holds.store(0);
+    if (task != NULL) {
+        vTaskPrioritySet(task, base);
+    }
+}
+
+void task_boost_hold(task_boost_t *tb)
+{
+    if (tb->holds.fetch_add(1) == 0) {
+        apply(tb);
+    }
+}
+
+void task_boost_release(task_boost_t *tb)
+{
+    uint32_t holds = tb->holds.load();
+    while (holds > 0 && !tb->holds.compare_exchange_weak(holds, holds - 1)) {
+    }
+    if (holds == 1) {
+        apply(tb);
+    }
+}
+
+void task_boost_reset(task_boost_t *tb)
+{
+    tb->holds.store(0);
+    apply(tb);
+}
+
+uint32_t task_boost_pending(const task_boost_t *tb)
+{
+    return tb->holds.load();
+}
@@ -0,0 +1,158 @@
+/**
+ * @file link_monitor.hpp
+ * @brief Link quality from RSSI, beacon loss and RPC failures; when to roam.
+ *
+ * A module at the edge of coverage stays on a weak AP until the link drops
+ * outright, and meanwhile its RPCs time out.  wifi_mgr feeds this monitor a
+ * RSSI sample every few seconds, each beacon timeout, and the outcome of
+ * every server RPC (server_comm reports them).  The monitor asks for a
+ * background scan (or an 802.11v transition query) when:
+ *
+ *   - the averaged RSSI falls below scan_below_dbm, or
+ *   - beacon_loss_burst beacon timeouts land within a minute, or
+ *   - rpc_fail_streak RPCs in a row fail while RSSI is below fair_dbm
+ *     (failures on a strong link are the server's problem, not the AP's),
+ *
+ * at most once per scan_cooldown_ms, and never while an RPC is in flight:
+ * going off-channel to scan would stall it.  A scan result that beats the
+ * current AP by roam_gain_db becomes a pending roam, carried out as soon as
+ * no RPC is in flight, or after roam_defer_max_ms regardless.
+ *
+ * Quality is 0-100: the averaged RSSI mapped from -90 dBm (0) to -50 dBm
+ * (100), less 15 per beacon timeout in the last minute and 10 per RPC in
+ * the current failure streak.
+ *
+ * Not thread-safe; wifi_mgr serialises calls with a spinlock.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    int8_t   scan_below_dbm;        /**< Scan when the average drops below this */
+    int8_t   fair_dbm;              /**< RPC failures count against the link below this */
+    uint8_t  rpc_fail_streak;       /**< Failed RPCs in a row that trigger a scan */
+    uint8_t  beacon_loss_burst;     /**< Beacon timeouts within a minute that trigger a scan */
+    uint8_t  roam_gain_db;          /**< A candidate must be this much stronger */
+    uint32_t scan_cooldown_ms;      /**< Least time between scans */
+    uint32_t roam_defer_max_ms;     /**< Longest a roam waits for an RPC to finish */
+} link_monitor_config_t;
+
+typedef struct {
+    uint8_t  quality;               /**< 0-100, see above */
+    int32_t  rssi_avg_dbm;          /**< Averaged RSSI (0 = no samples yet) */
+    int32_t  rssi_trend_db_per_min; /**< Smoothed slope of the average */
+    uint32_t beacon_losses;         /**< Beacon timeouts since boot */
+    uint32_t rpc_failures;          /**< Failed RPCs since boot */
+    uint32_t roam_scans;            /**< Scans or transition queries started */
+    uint32_t roams;                 /**< Moves to another AP after a scan or query */
+    int32_t  last_roam_gain_db;     /**< RSSI gained by the last roam */
+} link_monitor_stats_t;
+
+typedef struct {
+    uint8_t  bssid[6];
+    uint8_t  channel;
+    int8_t   rssi_dbm;
+} link_candidate_t;
+
+#define LINK_MONITOR_BEACON_WINDOW  4   /**< Beacon timeouts remembered */
+
+typedef struct {
+    link_monitor_config_t cfg;
+    link_monitor_stats_t  stats;
+
+    /* RSSI average and trend, in 1/16 dB */
+    uint32_t samples;
+    int32_t  avg_q4;
+    int32_t  trend_q4;              /**< 1/16 dB per minute */
+    int64_t  last_sample_ms;
+
+    int64_t  beacon_loss_ms[LINK_MONITOR_BEACON_WINDOW];
+    uint8_t  beacon_loss_next;
+
+    uint8_t  rpc_streak;
+    uint8_t  rpcs_in_flight;
+
+    bool     scanned;               /**< A scan has been started */
+    int64_t  last_scan_ms;
+
+    bool             roam_pending;
+    link_candidate_t roam_target;
+    int64_t          roam_since_ms;
+
+    bool     roam_started;          /**< Waiting to see where we land */
+    int64_t  roam_started_ms;
+    int32_t  roam_from_dbm;
+    bool     gain_pending;          /**< Landed; next RSSI sample gives the gain */
+    uint8_t  bssid[6];              /**< AP we are associated with */
+} link_monitor_t;
+
+/** Defaults: -72 dBm, -67 dBm, 3 RPCs, 2 beacons, 8 dB, 60 s, 3 s. */
+void link_monitor_default_config(link_monitor_config_t *cfg);
+
+void link_monitor_init(link_monitor_t *m, const link_monitor_config_t *cfg);
+
+/**
+ * Associated with @p bssid.  Starts the averages over; counts a roam if
+ * a roam was started in the last 10 s and this is a different AP.
+ */
+void link_monitor_associated(link_monitor_t *m, int64_t now_ms, const uint8_t bssid[6]);
+
+/** One RSSI reading of the current AP. */
+void link_monitor_rssi(link_monitor_t *m, int64_t now_ms, int8_t rssi_dbm);
+
+/** The station missed the AP's beacons (WIFI_EVENT_STA_BEACON_TIMEOUT). */
+void link_monitor_beacon_lost(link_monitor_t *m, int64_t now_ms);
+
+/** A server RPC is starting / has finished (@p ok: transport succeeded). */
+void link_monitor_rpc_begin(link_monitor_t *m);
+void link_monitor_rpc_end(link_monitor_t *m, bool ok);
+
+/**
+ * True if a scan should start now; the caller starts it.  Counts the scan
+ * and starts the cooldown.
+ */
+bool link_monitor_scan_due(link_monitor_t *m, int64_t now_ms);
+
+/**
+ * Best other AP a scan found (none: @p best NULL).  Returns true if it is
+ * worth moving to; the roam is then pending.
+ */
+bool link_monitor_scan_result(link_monitor_t *m, int64_t now_ms,
+                              const link_candidate_t *best);
+
+/**
+ * True if the pending roam should be carried out now (no RPC in flight,
+ * or it has waited roam_defer_max_ms); @p out receives the target.
+ */
+bool link_monitor_roam_due(link_monitor_t *m, int64_t now_ms, link_candidate_t *out);
+
+/**
+ * Last check before leaving for the roam link_monitor_roam_due() gave out.
+ * False if an RPC has started since and the roam may still wait for it;
+ * the roam is then pending again, with its original deadline.
+ */
+bool link_monitor_roam_go(link_monitor_t *m, int64_t now_ms);
+
+/**
+ * A roam is under way by other means (an 802.11v transition the AP
+ * directs); the next association to a new AP counts as a roam.
+ */
+void link_monitor_roam_started(link_monitor_t *m, int64_t now_ms);
+
+/** True while an RPC is in flight. */
+bool link_monitor_busy(const link_monitor_t *m);
+
+/** Stats with quality and averages brought up to date. */
+void link_monitor_get_stats(const link_monitor_t *m, int64_t now_ms,
+                            link_monitor_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
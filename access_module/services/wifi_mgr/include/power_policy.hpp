@@ -0,0 +1,98 @@
+/**
+ * @file power_policy.hpp
+ * @brief When the radio stays fully awake and when it may doze.
+ *
+ * In modem sleep the AP buffers frames for the station until the next DTIM
+ * beacon, which adds up to a beacon interval or more to every server
+ * response.  Keeping the radio awake all the time costs power the module
+ * may not have to spare.  wifi_mgr asks this policy which to use:
+ *
+ *   - POWER_MODE_AWAKE while anything holds the radio awake (server_comm
+ *     holds it across a credential RPC and a TLS handshake), and for
+ *     activity_window_ms after the last RF activity at the reader, so a
+ *     second tap or a retry finds the radio already up;
+ *   - POWER_MODE_SAVE otherwise.
+ *
+ * Each call returns the mode now wanted; wifi_mgr applies it when it
+ * differs from the one in force.  The policy adds up the time spent in
+ * each mode and the access RPC round trips, split by whether the radio was
+ * already awake when the tap came or was woken for it.  The gap between
+ * the two averages is what waking costs; power save that is never woken
+ * for a tap costs nothing on the access path.
+ *
+ * Not thread-safe; wifi_mgr serialises calls with a mutex.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    POWER_MODE_SAVE = 0,        /**< Modem sleep between beacons */
+    POWER_MODE_AWAKE,           /**< Radio on all the time */
+} power_mode_t;
+
+typedef struct {
+    uint32_t activity_window_ms;    /**< Stay awake this long after RF activity */
+} power_policy_config_t;
+
+typedef struct {
+    uint64_t awake_ms;              /**< Time spent fully awake */
+    uint64_t saving_ms;             /**< Time spent in power save */
+    uint32_t wakes;                 /**< Switches from power save to awake */
+    uint32_t rpcs_awake;            /**< Access RPCs on a radio already awake */
+    uint32_t rpc_awake_avg_ms;
+    uint32_t rpc_awake_max_ms;
+    uint32_t rpcs_woken;            /**< Access RPCs that woke the radio */
+    uint32_t rpc_woken_avg_ms;
+    uint32_t rpc_woken_max_ms;
+} power_policy_stats_t;
+
+typedef struct {
+    power_policy_config_t cfg;
+    power_policy_stats_t  stats;
+
+    power_mode_t mode;
+    int64_t      mode_since_ms;
+    int64_t      awake_until_ms;    /**< End of the activity window */
+    uint8_t      holds;
+    bool         fresh;             /**< Woken, and no access RPC since */
+
+    uint64_t     rpc_awake_total_ms;
+    uint64_t     rpc_woken_total_ms;
+} power_policy_t;
+
+/** Defaults: awake for 10 s after RF activity. */
+void power_policy_default_config(power_policy_config_t *cfg);
+
+/** Start in power save at @p now_ms. */
+void power_policy_init(power_policy_t *p, const power_policy_config_t *cfg, int64_t now_ms);
+
+/** RF activity at the reader: stay awake for the activity window. */
+power_mode_t power_policy_activity(power_policy_t *p, int64_t now_ms);
+
+/** Keep the radio awake until the matching power_policy_release(). */
+power_mode_t power_policy_hold(power_policy_t *p, int64_t now_ms);
+power_mode_t power_policy_release(power_policy_t *p, int64_t now_ms);
+
+/** Time has passed: the activity window may have closed. */
+power_mode_t power_policy_tick(power_policy_t *p, int64_t now_ms);
+
+/**
+ * An access RPC took @p latency_ms.  The first one after a wake counts as
+ * woken, the rest as awake.
+ */
+void power_policy_access_rpc(power_policy_t *p, uint32_t latency_ms);
+
+/** Stats with the time in the current mode added in. */
+void power_policy_get_stats(const power_policy_t *p, int64_t now_ms,
+                            power_policy_stats_t *out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,127 @@
+/**
+ * @file wifi_hint.hpp
+ * @brief Where the AP was last time, and whether to trust that on the next connect.
+ *
+ * A full connect scans every channel before it associates.  Our APs rarely
+ * move, so wifi_mgr keeps the BSSID and channel of the last AP that gave it
+ * an IP address (a wifi_hint_t, saved to RTC memory and NVS) and points the
+ * next connect straight at them.  A hinted attempt that fails is retried
+ * once more and then the hint is dropped and the next attempt scans; the
+ * AP found by that scan becomes the new hint.
+ *
+ * The tracker also times each connect from association to IP address and
+ * counts what happened, for the heartbeat.
+ *
+ * Not thread-safe; wifi_mgr serialises calls with a spinlock.
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Failed hinted attempts in a row before the hint is dropped. */
+#define WIFI_HINT_MAX_MISSES  2
+
+/**
+ * Saved AP location.  Plain bytes so it can be stored as-is; @c check
+ * guards against uninitialised RTC memory and a torn NVS blob, and
+ * @c ssid_hash against a hint learned before the module was re-provisioned.
+ */
+typedef struct {
+    uint32_t magic;
+    uint32_t ssid_hash;
+    uint8_t  bssid[6];
+    uint8_t  channel;
+    uint8_t  reserved;
+    uint32_t check;
+} wifi_hint_t;
+
+/** Fill @p h for the AP at @p bssid / @p channel on network @p ssid. */
+void wifi_hint_set(wifi_hint_t *h, const char *ssid,
+                   const uint8_t bssid[6], uint8_t channel);
+
+/** True if @p h was filled by wifi_hint_set() for @p ssid and is intact. */
+bool wifi_hint_valid(const wifi_hint_t *h, const char *ssid);
+
+/** True if @p a and @p b name the same AP and channel. */
+bool wifi_hint_same(const wifi_hint_t *a, const wifi_hint_t *b);
+
+typedef enum {
+    WIFI_CONNECT_HINTED = 0,    /**< Saved BSSID and channel, no scan */
+    WIFI_CONNECT_SCAN,          /**< Scan, then the best AP for the SSID */
+} wifi_connect_mode_t;
+
+typedef struct {
+    uint32_t connects;          /**< IP addresses obtained */
+    uint32_t hinted_connects;   /**< ...of which on the saved AP without a scan */
+    uint32_t scan_fallbacks;    /**< Hints dropped after WIFI_HINT_MAX_MISSES */
+    uint32_t assoc_to_ip_ms;    /**< Association to IP, last connect */
+    uint32_t assoc_to_ip_max_ms;/**< Association to IP, slowest connect */
+} wifi_connect_stats_t;
+
+typedef struct {
+    const char          *ssid;
+    wifi_hint_t          hint;          /**< Where the next hinted attempt goes */
+    bool                 have_hint;
+    wifi_hint_t          stored;        /**< What the caller last saved */
+    bool                 have_stored;
+    uint8_t              misses;        /**< Hinted attempts failed in a row */
+    bool                 attempting;    /**< A connect is under way */
+    bool                 roaming;       /**< We are leaving the AP on purpose */
+    wifi_connect_mode_t  mode;          /**< ...and how */
+    bool                 associated;
+    int64_t              assoc_ms;
+    uint8_t              assoc_bssid[6];
+    uint8_t              assoc_channel;
+    wifi_connect_stats_t stats;
+} wifi_hint_tracker_t;
+
+/**
+ * Start tracking connects to @p ssid (kept by pointer).  @p saved is the
+ * stored hint, if any; it is used only if it is valid for @p ssid.
+ */
+void wifi_hint_tracker_init(wifi_hint_tracker_t *t, const char *ssid,
+                            const wifi_hint_t *saved);
+
+/**
+ * A connect attempt is starting.  Returns how to make it; for
+ * WIFI_CONNECT_HINTED, t->hint holds the BSSID and channel.
+ */
+wifi_connect_mode_t wifi_hint_tracker_begin(wifi_hint_tracker_t *t);
+
+/** The station associated with @p bssid on @p channel. */
+void wifi_hint_tracker_associated(wifi_hint_tracker_t *t, int64_t now_ms,
+                                  const uint8_t bssid[6], uint8_t channel);
+
+/**
+ * The station obtained an IP address.  Records the timing and makes the
+ * AP it associated with the hint.  Returns true when the hint changed and
+ * should be saved.  An address change on a standing link is ignored.
+ */
+bool wifi_hint_tracker_connected(wifi_hint_tracker_t *t, int64_t now_ms);
+
+/**
+ * The station disconnected.  Returns true if that ended a hinted attempt,
+ * in which case the caller retries at once (with the hint again, or with a
+ * scan once it has been dropped) instead of backing off; false for a lost
+ * link or a failed scan.
+ */
+bool wifi_hint_tracker_disconnected(wifi_hint_tracker_t *t);
+
+/**
+ * Roam to @p bssid / @p channel (link_monitor.hpp): it becomes the hint,
+ * and the disconnect the caller is about to cause returns true so the
+ * connect to it follows at once.  If it does not answer, the usual misses
+ * and scan fallback apply.
+ */
+void wifi_hint_tracker_roam(wifi_hint_tracker_t *t,
+                            const uint8_t bssid[6], uint8_t channel);
+
+#ifdef __cplusplus
+}
+#endif
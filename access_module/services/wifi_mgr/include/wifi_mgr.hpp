@@ -7,28 +7,53 @@
  *
  *   1. wifi_mgr_init()   — create netif, register event handlers, start
  *                           background reconnect task
- *   2. wifi_mgr_start()  — connect to the configured AP, block until
- *                           an IP is obtained or the timeout expires
+ *   2. wifi_mgr_start()  — start connecting to the configured AP and
+ *                           return; association and DHCP run on the WiFi
+ *                           and lwIP tasks while the caller brings up the
+ *                           rest of the module
+ *
+ * Whoever needs the link learns it is up from wifi_mgr_set_ip_callback()
+ * or wifi_mgr_is_connected().
  *
  * On disconnection the manager automatically attempts to reconnect with
  * exponential backoff (base interval from Kconfig, ceiling at 60 s).
+ * Connects go straight to the AP and channel that last worked, without a
+ * scan, and fall back to a scan if that AP does not answer (wifi_hint.hpp);
+ * a provisioned static address skips DHCP.  wifi_mgr_get_stats() reports
+ * how that went.
+ *
+ * While connected the manager watches the link (RSSI trend, beacon loss,
+ * and RPC outcomes reported by server_comm through wifi_mgr_rpc_begin/end)
+ * and roams to a better AP when it degrades, never during an RPC
+ * (link_monitor.hpp).  wifi_mgr_get_link() reports link quality and roams.
+ *
+ * The radio sits in modem sleep except while server_comm holds it awake
+ * (wifi_mgr_awake_begin/end, around credential RPCs and TLS handshakes)
+ * and for a while after a card read (wifi_mgr_note_activity);
+ * wifi_mgr_get_power() reports the time in each mode and what access RPCs
+ * took (power_policy.hpp).
  * Reconnection runs in a dedicated FreeRTOS task ("wifi_reconn") so that
  * the backoff delay never blocks the ESP-IDF default event loop.
  *
  * Thread safety:
  *   - wifi_mgr_init() and wifi_mgr_start() must be called from a single
- *     task during startup (typically app_main).
- *   - wifi_mgr_is_connected() is safe to call from any task.
+ *     task during startup (main.cpp's network boot task).
+ *   - wifi_mgr_is_connected() and wifi_mgr_set_ip_callback() are safe to
+ *     call from any task, before or after wifi_mgr_init().
  *
  * Internal tasks (created by wifi_mgr_init):
- *   - "wifi_reconn" — reconnect with exponential backoff (2.5 KB stack,
- *     priority 3). Sleeps until woken by a disconnect event notification.
+ *   - "wifi_reconn" — reconnect with exponential backoff (3 KB stack,
+ *     priority 3). Woken by a disconnect event notification, a card read,
+ *     and every 2 s to sample the link and close the awake window.
  */
 
 #pragma once
 
 #include "portunus_types.hpp"
 #include "portunus_nvs.hpp"
+#include "wifi_hint.hpp"
+#include "link_monitor.hpp"
+#include "power_policy.hpp"
 
 #ifdef __cplusplus
 extern "C" {
@@ -44,10 +69,11 @@ extern "C" {
  * Credentials (SSID and PSK) are taken from @p cfg rather than Kconfig so
  * that they can be stored in NVS instead of baked into the firmware binary.
  *
- * Requires NVS to be initialised first (for WiFi calibration data).
+ * Requires NVS to be initialised first (for WiFi calibration data and the
+ * saved AP hint).
  *
- * @param cfg  Device configuration loaded from NVS; only wifi_ssid and
- *             wifi_psk fields are consumed here.
+ * @param cfg  Device configuration loaded from NVS; only the wifi_ and
+ *             static_ fields are consumed here.
  * @return PORTUNUS_OK on success.
  *         PORTUNUS_ERR_ALREADY_INIT if called more than once.
  *         PORTUNUS_ERR_TASK_CREATE if the reconnect task could not start.
@@ -56,22 +82,33 @@ extern "C" {
 portunus_err_t wifi_mgr_init(const portunus_device_config_t *cfg);
 
 /**
- * @brief Connect to the configured access point.
+ * @brief Start connecting to the configured access point.
  *
- * Starts the WiFi driver and initiates a connection.  Blocks until one of:
- *   - An IP address is obtained (returns PORTUNUS_OK), or
- *   - The timeout (PORTUNUS_WIFI_CONNECT_TIMEOUT_MS) expires
- *     (returns PORTUNUS_ERR_TIMEOUT).
+ * Configures the station and starts the WiFi driver, which associates and
+ * runs DHCP in the background.  Returns without waiting for either; an
+ * obtained IP address is signalled through wifi_mgr_set_ip_callback() and
+ * wifi_mgr_is_connected().  Marks BOOT_PHASE_WIFI_START, and the first IP
+ * marks BOOT_PHASE_IP (boot_timeline.hpp).
  *
- * After a successful return, wifi_mgr_is_connected() will return true.
  * If the connection drops later, the manager reconnects automatically.
  *
- * @return PORTUNUS_OK            Connected and IP obtained.
- *         PORTUNUS_ERR_TIMEOUT   Timed out waiting for IP.
+ * @return PORTUNUS_OK            WiFi started.
  *         PORTUNUS_ERR_NOT_INIT  wifi_mgr_init() was not called.
  */
 portunus_err_t wifi_mgr_start(void);
 
+/** Called on the default event loop task each time an IP is obtained. */
+typedef void (*wifi_mgr_ip_cb_t)(void *ctx);
+
+/**
+ * @brief Register the callback for "IP obtained" (one; a second replaces it).
+ *
+ * The callback runs on the default event loop and must not block.  If the
+ * station already has an IP, it is also called once right away, on the
+ * caller's task, so a late subscriber does not miss the first connection.
+ */
+void wifi_mgr_set_ip_callback(wifi_mgr_ip_cb_t cb, void *ctx);
+
 /**
  * @brief Stop the WiFi driver and release resources.
  *
@@ -90,6 +127,64 @@ void wifi_mgr_stop(void);
  */
 bool wifi_mgr_is_connected(void);
 
+/**
+ * @brief Connect counters since boot, and association-to-IP times.
+ *
+ * Safe to call from any task.
+ */
+void wifi_mgr_get_stats(wifi_connect_stats_t *out);
+
+/**
+ * @brief A server RPC is starting / has finished.
+ *
+ * Background scans wait for RPCs in flight and roams do for up to
+ * roam_defer_max_ms, a roam scan already running is aborted, and
+ * transport failures on a middling link count
+ * towards a roam.  server_comm brackets TLS connects and keepalive pings
+ * too.  @p ok is false only when the RPC did not reach the server or got
+ * no answer.  Any task.
+ */
+void wifi_mgr_rpc_begin(void);
+void wifi_mgr_rpc_end(bool ok);
+
+/**
+ * @brief Link quality, RSSI average and trend, beacon losses and roams.
+ *
+ * Safe to call from any task.
+ */
+void wifi_mgr_get_link(link_monitor_stats_t *out);
+
+/**
+ * @brief Keep the radio out of power save until the matching _end().
+ *
+ * For a credential RPC or a TLS handshake: in modem sleep the response
+ * waits at the AP for the next DTIM beacon.  Calls nest.  Blocks briefly
+ * while the driver switches mode; not for the event bus dispatcher.
+ */
+void wifi_mgr_awake_begin(void);
+void wifi_mgr_awake_end(void);
+
+/**
+ * @brief A card was read: keep the radio awake for the configured window.
+ *
+ * Does not block; safe from the event bus dispatcher.
+ */
+void wifi_mgr_note_activity(void);
+
+/**
+ * @brief An access RPC took @p latency_ms, for the power-save report.
+ *
+ * Any task.
+ */
+void wifi_mgr_note_access_rpc(uint32_t latency_ms);
+
+/**
+ * @brief Time awake and in power save, wakes, and access RPC times.
+ *
+ * Safe to call from any task.
+ */
+void wifi_mgr_get_power(power_policy_stats_t *out);
+
 #ifdef __cplusplus
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,223 @@
+/**
+ * @file link_monitor.cpp
+ * @brief Link quality and roaming decisions — implementation.
+ */
+
+#include "link_monitor.hpp"
+
+#include <string.h>
+
+#define BEACON_WINDOW_MS   60000
+#define ROAM_SETTLE_MS     10000    /* a roam counts if we land within this */
+#define NO_TIME            INT64_MIN
+
+void link_monitor_default_config(link_monitor_config_t *cfg)
+{
+    cfg->scan_below_dbm    = -72;
+    cfg->fair_dbm          = -67;
+    cfg->rpc_fail_streak   = 3;
+    cfg->beacon_loss_burst = 2;
+    cfg->roam_gain_db      = 8;
+    cfg->scan_cooldown_ms  = 60000;
+    cfg->roam_defer_max_ms = 3000;
+}
+
+static void reset_link(link_monitor_t *m)
+{
+    m->samples        = 0;
+    m->avg_q4         = 0;
+    m->trend_q4       = 0;
+    m->last_sample_ms = NO_TIME;
+    for (int i = 0; i < LINK_MONITOR_BEACON_WINDOW; i++) {
+        m->beacon_loss_ms[i] = NO_TIME;
+    }
+    m->rpc_streak   = 0;
+    m->roam_pending = false;
+}
+
+void link_monitor_init(link_monitor_t *m, const link_monitor_config_t *cfg)
+{
+    memset(m, 0, sizeof(*m));
+    m->cfg = *cfg;
+    reset_link(m);
+}
+
+void link_monitor_associated(link_monitor_t *m, int64_t now_ms, const uint8_t bssid[6])
+{
+    if (m->roam_started && now_ms - m->roam_started_ms <= ROAM_SETTLE_MS &&
+        memcmp(bssid, m->bssid, sizeof(m->bssid)) != 0) {
+        m->stats.roams++;
+        m->gain_pending = true;
+    }
+    m->roam_started = false;
+    memcpy(m->bssid, bssid, sizeof(m->bssid));
+    reset_link(m);
+}
+
+void link_monitor_rssi(link_monitor_t *m, int64_t now_ms, int8_t rssi_dbm)
+{
+    int32_t x = (int32_t)rssi_dbm * 16;
+
+    if (m->gain_pending) {
+        m->gain_pending = false;
+        m->stats.last_roam_gain_db = rssi_dbm - m->roam_from_dbm;
+    }
+
+    if (m->samples == 0) {
+        m->avg_q4 = x;
+    } else {
+        int32_t prev = m->avg_q4;
+        m->avg_q4 += (x - m->avg_q4) / 4;
+
+        int64_t dt = now_ms - m->last_sample_ms;
+        if (dt > 0) {
+            int32_t inst = (int32_t)((int64_t)(m->avg_q4 - prev) * 60000 / dt);
+            m->trend_q4 += (inst - m->trend_q4) / 4;
+        }
+    }
+    m->samples++;
+    m->last_sample_ms = now_ms;
+}
+
+void link_monitor_beacon_lost(link_monitor_t *m, int64_t now_ms)
+{
+    m->stats.beacon_losses++;
+    m->beacon_loss_ms[m->beacon_loss_next] = now_ms;
+    m->beacon_loss_next = (uint8_t)((m->beacon_loss_next + 1) % LINK_MONITOR_BEACON_WINDOW);
+}
+
+void link_monitor_rpc_begin(link_monitor_t *m)
+{
+    if (m->rpcs_in_flight < UINT8_MAX) {
+        m->rpcs_in_flight++;
+    }
+}
+
+void link_monitor_rpc_end(link_monitor_t *m, bool ok)
+{
+    if (m->rpcs_in_flight > 0) {
+        m->rpcs_in_flight--;
+    }
+    if (ok) {
+        m->rpc_streak = 0;
+    } else {
+        m->stats.rpc_failures++;
+        if (m->rpc_streak < UINT8_MAX) {
+            m->rpc_streak++;
+        }
+    }
+}
+
+bool link_monitor_busy(const link_monitor_t *m)
+{
+    return m->rpcs_in_flight > 0;
+}
+
+static int recent_beacon_losses(const link_monitor_t *m, int64_t now_ms)
+{
+    int n = 0;
+    for (int i = 0; i < LINK_MONITOR_BEACON_WINDOW; i++) {
+        if (m->beacon_loss_ms[i] != NO_TIME && now_ms - m->beacon_loss_ms[i] < BEACON_WINDOW_MS) {
+            n++;
+        }
+    }
+    return n;
+}
+
+bool link_monitor_scan_due(link_monitor_t *m, int64_t now_ms)
+{
+    if (m->rpcs_in_flight > 0 || m->roam_pending || m->roam_started) {
+        return false;
+    }
+    if (m->scanned && now_ms - m->last_scan_ms < (int64_t)m->cfg.scan_cooldown_ms) {
+        return false;
+    }
+
+    bool weak  = m->samples >= 3 && m->avg_q4 < (int32_t)m->cfg.scan_below_dbm * 16;
+    bool lossy = recent_beacon_losses(m, now_ms) >= m->cfg.beacon_loss_burst;
+    bool rpcs  = m->rpc_streak >= m->cfg.rpc_fail_streak &&
+                 m->samples > 0 && m->avg_q4 < (int32_t)m->cfg.fair_dbm * 16;
+    if (!weak && !lossy && !rpcs) {
+        return false;
+    }
+
+    m->scanned      = true;
+    m->last_scan_ms = now_ms;
+    m->stats.roam_scans++;
+    return true;
+}
+
+bool link_monitor_scan_result(link_monitor_t *m, int64_t now_ms,
+                              const link_candidate_t *best)
+{
+    if (best == NULL || memcmp(best->bssid, m->bssid, sizeof(m->bssid)) == 0) {
+        return false;
+    }
+    int32_t current = m->samples > 0 ? m->avg_q4 : INT32_MIN / 2;
+    if ((int32_t)best->rssi_dbm * 16 < current + (int32_t)m->cfg.roam_gain_db * 16) {
+        return false;
+    }
+
+    m->roam_pending  = true;
+    m->roam_target   = *best;
+    m->roam_since_ms = now_ms;
+    return true;
+}
+
+void link_monitor_roam_started(link_monitor_t *m, int64_t now_ms)
+{
+    m->roam_started    = true;
+    m->roam_started_ms = now_ms;
+    m->roam_from_dbm   = (m->avg_q4 - 8) / 16;
+}
+
+bool link_monitor_roam_due(link_monitor_t *m, int64_t now_ms, link_candidate_t *out)
+{
+    if (m->roam_started && now_ms - m->roam_started_ms > ROAM_SETTLE_MS) {
+        m->roam_started = false;    /* never landed anywhere new */
+    }
+    if (!m->roam_pending) {
+        return false;
+    }
+    if (m->rpcs_in_flight > 0 &&
+        now_ms - m->roam_since_ms < (int64_t)m->cfg.roam_defer_max_ms) {
+        return false;
+    }
+
+    m->roam_pending = false;
+    *out = m->roam_target;
+    link_monitor_roam_started(m, now_ms);
+    return true;
+}
+
+bool link_monitor_roam_go(link_monitor_t *m, int64_t now_ms)
+{
+    if (m->rpcs_in_flight > 0 &&
+        now_ms - m->roam_since_ms < (int64_t)m->cfg.roam_defer_max_ms) {
+        m->roam_pending = true;
+        m->roam_started = false;
+        return false;
+    }
+    return true;
+}
+
+void link_monitor_get_stats(const link_monitor_t *m, int64_t now_ms,
+                            link_monitor_stats_t *out)
+{
+    *out = m->stats;
+    if (m->samples == 0) {
+        out->quality               = 0;
+        out->rssi_avg_dbm          = 0;
+        out->rssi_trend_db_per_min = 0;
+        return;
+    }
+
+    /* Round to the nearest dB, away from zero on halves. */
+    out->rssi_avg_dbm          = (m->avg_q4 - 8) / 16;
+    out->rssi_trend_db_per_min = (m->trend_q4 + (m->trend_q4 < 0 ? -8 : 8)) / 16;
+
+    int32_t q = (m->avg_q4 + 90 * 16) * 100 / (40 * 16);
+    q -= 15 * recent_beacon_losses(m, now_ms);
+    q -= 10 * m->rpc_streak;
+    out->quality = (uint8_t)(q < 0 ? 0 : q > 100 ? 100 : q);
+}
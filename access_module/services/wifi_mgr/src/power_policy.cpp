@@ -0,0 +1,110 @@
+/**
+ * @file power_policy.cpp
+ * @brief Radio power-save policy — implementation.
+ */
+
+#include "power_policy.hpp"
+
+#include <string.h>
+
+void power_policy_default_config(power_policy_config_t *cfg)
+{
+    cfg->activity_window_ms = 10000;
+}
+
+void power_policy_init(power_policy_t *p, const power_policy_config_t *cfg, int64_t now_ms)
+{
+    memset(p, 0, sizeof(*p));
+    p->cfg            = *cfg;
+    p->mode           = POWER_MODE_SAVE;
+    p->mode_since_ms  = now_ms;
+    p->awake_until_ms = now_ms;
+}
+
+static void add_time(power_policy_stats_t *s, power_mode_t mode, int64_t ms)
+{
+    if (ms <= 0) {
+        return;
+    }
+    if (mode == POWER_MODE_AWAKE) {
+        s->awake_ms += (uint64_t)ms;
+    } else {
+        s->saving_ms += (uint64_t)ms;
+    }
+}
+
+static power_mode_t update(power_policy_t *p, int64_t now_ms)
+{
+    power_mode_t want = (p->holds > 0 || now_ms < p->awake_until_ms)
+                        ? POWER_MODE_AWAKE : POWER_MODE_SAVE;
+    if (want == p->mode) {
+        return want;
+    }
+
+    add_time(&p->stats, p->mode, now_ms - p->mode_since_ms);
+    if (want == POWER_MODE_AWAKE) {
+        p->stats.wakes++;
+        p->fresh = true;
+    }
+    p->mode          = want;
+    p->mode_since_ms = now_ms;
+    return want;
+}
+
+power_mode_t power_policy_activity(power_policy_t *p, int64_t now_ms)
+{
+    int64_t until = now_ms + (int64_t)p->cfg.activity_window_ms;
+    if (until > p->awake_until_ms) {
+        p->awake_until_ms = until;
+    }
+    return update(p, now_ms);
+}
+
+power_mode_t power_policy_hold(power_policy_t *p, int64_t now_ms)
+{
+    if (p->holds < UINT8_MAX) {
+        p->holds++;
+    }
+    return update(p, now_ms);
+}
+
+power_mode_t power_policy_release(power_policy_t *p, int64_t now_ms)
+{
+    if (p->holds > 0) {
+        p->holds--;
+    }
+    return update(p, now_ms);
+}
+
+power_mode_t power_policy_tick(power_policy_t *p, int64_t now_ms)
+{
+    return update(p, now_ms);
+}
+
+void power_policy_access_rpc(power_policy_t *p, uint32_t latency_ms)
+{
+    power_policy_stats_t *s = &p->stats;
+    if (p->fresh) {
+        p->fresh = false;
+        s->rpcs_woken++;
+        p->rpc_woken_total_ms += latency_ms;
+        s->rpc_woken_avg_ms = (uint32_t)(p->rpc_woken_total_ms / s->rpcs_woken);
+        if (latency_ms > s->rpc_woken_max_ms) {
+            s->rpc_woken_max_ms = latency_ms;
+        }
+    } else {
+        s->rpcs_awake++;
+        p->rpc_awake_total_ms += latency_ms;
+        s->rpc_awake_avg_ms = (uint32_t)(p->rpc_awake_total_ms / s->rpcs_awake);
+        if (latency_ms > s->rpc_awake_max_ms) {
+            s->rpc_awake_max_ms = latency_ms;
+        }
+    }
+}
+
+void power_policy_get_stats(const power_policy_t *p, int64_t now_ms,
+                            power_policy_stats_t *out)
+{
+    *out = p->stats;
+    add_time(out, p->mode, now_ms - p->mode_since_ms);
+}
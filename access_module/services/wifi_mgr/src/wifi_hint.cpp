@@ -0,0 +1,162 @@
+/**
+ * @file wifi_hint.cpp
+ * @brief Saved AP location and connect tracking — implementation.
+ */
+
+#include "wifi_hint.hpp"
+
+#include <stddef.h>
+#include <string.h>
+
+#define WIFI_HINT_MAGIC  0x57484e54u   /* "WHNT" */
+
+/* FNV-1a, 32-bit */
+static uint32_t fnv1a(uint32_t h, const void *data, size_t len)
+{
+    const uint8_t *p = static_cast<const uint8_t *>(data);
+    for (size_t i = 0; i < len; i++) {
+        h ^= p[i];
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static uint32_t ssid_hash(const char *ssid)
+{
+    return fnv1a(2166136261u, ssid, strlen(ssid));
+}
+
+static uint32_t hint_check(const wifi_hint_t *h)
+{
+    return fnv1a(2166136261u, h, offsetof(wifi_hint_t, check));
+}
+
+void wifi_hint_set(wifi_hint_t *h, const char *ssid,
+                   const uint8_t bssid[6], uint8_t channel)
+{
+    memset(h, 0, sizeof(*h));
+    h->magic     = WIFI_HINT_MAGIC;
+    h->ssid_hash = ssid_hash(ssid);
+    memcpy(h->bssid, bssid, sizeof(h->bssid));
+    h->channel   = channel;
+    h->check     = hint_check(h);
+}
+
+bool wifi_hint_valid(const wifi_hint_t *h, const char *ssid)
+{
+    return h->magic == WIFI_HINT_MAGIC &&
+           h->check == hint_check(h) &&
+           h->ssid_hash == ssid_hash(ssid) &&
+           h->channel != 0;
+}
+
+bool wifi_hint_same(const wifi_hint_t *a, const wifi_hint_t *b)
+{
+    return a->channel == b->channel &&
+           memcmp(a->bssid, b->bssid, sizeof(a->bssid)) == 0;
+}
+
+void wifi_hint_tracker_init(wifi_hint_tracker_t *t, const char *ssid,
+                            const wifi_hint_t *saved)
+{
+    memset(t, 0, sizeof(*t));
+    t->ssid = ssid;
+    if (saved != NULL && wifi_hint_valid(saved, ssid)) {
+        t->hint        = *saved;
+        t->have_hint   = true;
+        t->stored      = *saved;
+        t->have_stored = true;
+    }
+}
+
+wifi_connect_mode_t wifi_hint_tracker_begin(wifi_hint_tracker_t *t)
+{
+    t->attempting = true;
+    t->associated = false;
+    t->mode       = t->have_hint ? WIFI_CONNECT_HINTED : WIFI_CONNECT_SCAN;
+    return t->mode;
+}
+
+void wifi_hint_tracker_associated(wifi_hint_tracker_t *t, int64_t now_ms,
+                                  const uint8_t bssid[6], uint8_t channel)
+{
+    t->associated    = true;
+    t->assoc_ms      = now_ms;
+    memcpy(t->assoc_bssid, bssid, sizeof(t->assoc_bssid));
+    t->assoc_channel = channel;
+}
+
+bool wifi_hint_tracker_connected(wifi_hint_tracker_t *t, int64_t now_ms)
+{
+    if (!t->attempting && !t->associated) {
+        return false;   /* address change on a standing link, not a connect */
+    }
+
+    bool hinted = t->attempting && t->mode == WIFI_CONNECT_HINTED;
+    t->attempting = false;
+    t->misses     = 0;
+
+    t->stats.connects++;
+    if (hinted) {
+        t->stats.hinted_connects++;
+    }
+
+    if (!t->associated) {
+        return false;   /* association event missed: nothing to time or learn */
+    }
+    t->associated = false;
+
+    int64_t took = now_ms - t->assoc_ms;
+    if (took < 0) {
+        took = 0;
+    }
+    t->stats.assoc_to_ip_ms = took > (int64_t)UINT32_MAX ? UINT32_MAX : (uint32_t)took;
+    if (t->stats.assoc_to_ip_ms > t->stats.assoc_to_ip_max_ms) {
+        t->stats.assoc_to_ip_max_ms = t->stats.assoc_to_ip_ms;
+    }
+
+    if (t->assoc_channel == 0) {
+        return false;
+    }
+    wifi_hint_t learned;
+    wifi_hint_set(&learned, t->ssid, t->assoc_bssid, t->assoc_channel);
+    bool changed = !t->have_stored || !wifi_hint_same(&learned, &t->stored);
+    t->hint        = learned;
+    t->have_hint   = true;
+    t->stored      = learned;
+    t->have_stored = true;
+    return changed;
+}
+
+bool wifi_hint_tracker_disconnected(wifi_hint_tracker_t *t)
+{
+    t->associated = false;
+    if (t->roaming) {
+        t->roaming    = false;
+        t->attempting = false;
+        return true;
+    }
+    if (!t->attempting) {
+        return false;   /* link lost after a connect */
+    }
+    t->attempting = false;
+    if (t->mode != WIFI_CONNECT_HINTED) {
+        return false;
+    }
+
+    if (++t->misses >= WIFI_HINT_MAX_MISSES) {
+        t->have_hint = false;
+        t->misses    = 0;
+        t->stats.scan_fallbacks++;
+    }
+    return true;
+}
+
+void wifi_hint_tracker_roam(wifi_hint_tracker_t *t,
+                            const uint8_t bssid[6], uint8_t channel)
+{
+    wifi_hint_set(&t->hint, t->ssid, bssid, channel);
+    t->have_hint = true;
+    t->misses    = 0;
+    t->roaming   = true;
+}
@@ -4,7 +4,8 @@
  *
  * Lifecycle:
  *   wifi_mgr_init()  → creates netif + event handlers + reconnect task
- *   wifi_mgr_start() → esp_wifi_start/connect, blocks until IP or timeout
+ *   wifi_mgr_start() → esp_wifi_start/connect, returns at once; the IP
+ *                      arrives on the event loop (wifi_mgr_set_ip_callback)
  *
  * On WIFI_EVENT_STA_DISCONNECTED the event handler notifies a dedicated
  * reconnect task (via FreeRTOS task notification) which applies exponential
@@ -13,18 +14,57 @@
  * continue to be dispatched normally during backoff.
  *
  * The backoff resets on a successful connection (IP_EVENT_STA_GOT_IP).
+ * Each wait is jittered (jitter.h) so modules that lost the same AP do
+ * not all come back to it at the same instant.
+ *
+ * Fast reconnect: the BSSID and channel of the AP that last gave us an IP
+ * are kept in RTC memory (survives a software reset) and NVS (survives a
+ * power cut), and each connect goes straight to them without a scan
+ * (wifi_hint.hpp).  A hinted attempt that fails is retried at once rather
+ * than after the backoff; after WIFI_HINT_MAX_MISSES the hint is dropped
+ * and the connect scans as before.  With a provisioned static address
+ * (portunus_nvs.hpp) DHCP is skipped too; otherwise lwIP asks for the last
+ * lease back (CONFIG_LWIP_DHCP_RESTORE_LAST_IP) instead of starting over.
+ *
+ * Roaming: while connected, the reconnect task samples RSSI every
+ * LINK_SAMPLE_MS and feeds it, beacon timeouts and server_comm's RPC
+ * outcomes to the link monitor (link_monitor.hpp).  When the link degrades
+ * it asks an 802.11v-capable AP to steer us (BSS transition query; the
+ * supplicant follows the AP's answer), or else scans for the SSID in the
+ * background and moves to a clearly stronger AP through the hint path
+ * above.  A scan never overlaps an RPC: one starting aborts it.  A roam
+ * waits for the RPCs in flight, checked again just before it disconnects,
+ * but for no longer than roam_defer_max_ms; an RPC it then cuts off fails
+ * and server_comm retries it on the new link (tap_retry.hpp).
+ *
+ * Power save: the radio is in modem sleep unless server_comm holds it
+ * awake for a credential RPC or TLS handshake, or a card was read within
+ * PORTUNUS_WIFI_AWAKE_WINDOW_MS (power_policy.hpp).  The reconnect task
+ * closes the window on its next wake, so it may run up to LINK_SAMPLE_MS
+ * long.
  */
 
 #include "wifi_mgr.hpp"
 #include "network_config.hpp"
+#include "task_config.hpp"
 #include "error_codes.hpp"
+#include "boot_timeline.hpp"
+#include "jitter.h"
+#include "wifi_hint.hpp"
+#include "link_monitor.hpp"
+#include "power_policy.hpp"
 
+#include "esp_attr.h"
 #include "esp_wifi.h"
 #include "esp_netif.h"
 #include "esp_event.h"
 #include "esp_log.h"
+#include "esp_random.h"
+#include "esp_timer.h"
+#include "esp_wnm.h"
+#include "nvs.h"
 #include "freertos/FreeRTOS.h"
-#include "freertos/event_groups.h"
+#include "freertos/semphr.h"
 #include "freertos/task.h"
 
 #include <string.h>
@@ -34,27 +74,72 @@
 
 static const char *TAG = "wifi_mgr";
 
-/* ── Event-group bits ──────────────────────────────────────────────────────── */
-#define WIFI_CONNECTED_BIT   BIT0   /* IP obtained  */
-#define WIFI_FAIL_BIT        BIT1   /* connect gave up (unused for now) */
-
 /* ── Module state ──────────────────────────────────────────────────────────── */
-static EventGroupHandle_t  s_wifi_event_group = NULL;
 static esp_netif_t        *s_sta_netif        = NULL;
 static bool                s_initialized      = false;
 static std::atomic<bool>   s_connected{false};
 
+/* "IP obtained" subscriber (server_comm) */
+static std::atomic<wifi_mgr_ip_cb_t> s_ip_cb{nullptr};
+static void                         *s_ip_cb_ctx = NULL;
+
 /* WiFi credentials stored at init from NVS, used at connect time */
 static char s_wifi_ssid[PORTUNUS_NVS_WIFI_SSID_LEN];
 static char s_wifi_psk[PORTUNUS_NVS_WIFI_PSK_LEN];
 
+/* ── Fast reconnect ────────────────────────────────────────────────────────── */
+#define HINT_NVS_NAMESPACE  "wifi_mgr"
+#define HINT_NVS_KEY        "hint"
+
+/* Guards s_tracker: used from the event loop and the reconnect task. */
+static portMUX_TYPE         s_hint_lock = portMUX_INITIALIZER_UNLOCKED;
+static wifi_hint_tracker_t  s_tracker;
+RTC_NOINIT_ATTR static wifi_hint_t s_rtc_hint;
+
+/* ── Link monitoring and roaming ───────────────────────────────────────────── */
+#define LINK_SAMPLE_MS       2000
+#define ROAM_SCAN_MAX_APS    8
+
+/* Guards s_link: fed from the event loop, server_comm and the reconnect task. */
+static portMUX_TYPE    s_link_lock = portMUX_INITIALIZER_UNLOCKED;
+static link_monitor_t  s_link;
+
+/* Set by the reconnect task; cleared by whoever aborts or finishes the scan. */
+static std::atomic<bool> s_roam_scanning{false};
+
+/* Reconnect task only */
+static int64_t          s_last_sample_ms = 0;
+static wifi_ap_record_t s_scan_records[ROAM_SCAN_MAX_APS];
+
+/* ── Power save ────────────────────────────────────────────────────────────── */
+#ifdef CONFIG_PORTUNUS_WIFI_IDLE_MAX_MODEM
+  #define IDLE_PS_TYPE  WIFI_PS_MAX_MODEM
+#else
+  #define IDLE_PS_TYPE  WIFI_PS_MIN_MODEM
+#endif
+
+/* Guards s_power and the mode set in the driver.  A mutex, not a spinlock:
+   esp_wifi_set_ps() is called with it held, so the driver always ends up
+   in the mode the policy last asked for. */
+static SemaphoreHandle_t s_power_mutex  = NULL;
+static power_policy_t    s_power;
+static bool              s_ps_started   = false;    /* driver accepts esp_wifi_set_ps() */
+static power_mode_t      s_ps_applied   = POWER_MODE_SAVE;
+
 /* ── Reconnect task ────────────────────────────────────────────────────────── */
 static TaskHandle_t  s_reconnect_task   = NULL;
 static uint32_t      s_reconnect_interval_ms = PORTUNUS_WIFI_RECONNECT_INTERVAL_MS;
 static const uint32_t RECONNECT_CEILING_MS   = 60000;   /* 60 s hard ceiling */
 
-#define RECONNECT_TASK_STACK_SIZE  2560
-#define RECONNECT_TASK_PRIORITY    3     /* Below event dispatcher (5) */
+/* Reconnect task notification bits */
+#define RECONN_DISCONNECTED  BIT0   /* link lost or a scan failed: back off */
+#define RECONN_RETRY_NOW     BIT1   /* a hinted attempt failed: retry at once */
+#define RECONN_SAVE_HINT     BIT2   /* a new hint to write to NVS */
+#define RECONN_SCAN_DONE     BIT3   /* a roam scan finished */
+#define RECONN_RPC_DONE      BIT4   /* an RPC ended with a roam waiting on it */
+#define RECONN_ACTIVITY      BIT5   /* a card was read: keep the radio awake */
+
+#define RECONNECT_TASK_STACK_SIZE  3072
 
 /* ── Forward declarations ──────────────────────────────────────────────────── */
 static void wifi_event_handler(void *arg, esp_event_base_t base,
@@ -63,16 +148,292 @@ static void ip_event_handler(void *arg, esp_event_base_t base,
                              int32_t event_id, void *event_data);
 static void reconnect_task(void *arg);
 
-/* ── Reconnect task ────────────────────────────────────────────────────────── */
+static int64_t now_ms(void)
+{
+    return esp_timer_get_time() / 1000;
+}
+
+/* ── Hint storage ──────────────────────────────────────────────────────────── */
+
+/** The saved hint for the configured SSID: RTC memory first, then NVS. */
+static bool load_hint(wifi_hint_t *out)
+{
+    if (wifi_hint_valid(&s_rtc_hint, s_wifi_ssid)) {
+        *out = s_rtc_hint;
+        return true;
+    }
+
+    nvs_handle_t h;
+    if (nvs_open(HINT_NVS_NAMESPACE, NVS_READONLY, &h) != ESP_OK) {
+        return false;
+    }
+    size_t len = sizeof(*out);
+    esp_err_t err = nvs_get_blob(h, HINT_NVS_KEY, out, &len);
+    nvs_close(h);
+    return err == ESP_OK && len == sizeof(*out) && wifi_hint_valid(out, s_wifi_ssid);
+}
+
+/** Write @p hint to NVS.  Flash write: reconnect task only, and only on change. */
+static void store_hint(const wifi_hint_t *hint)
+{
+    nvs_handle_t h;
+    esp_err_t err = nvs_open(HINT_NVS_NAMESPACE, NVS_READWRITE, &h);
+    if (err == ESP_OK) {
+        err = nvs_set_blob(h, HINT_NVS_KEY, hint, sizeof(*hint));
+        if (err == ESP_OK) {
+            err = nvs_commit(h);
+        }
+        nvs_close(h);
+    }
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "Could not save AP hint: %s", esp_err_to_name(err));
+    }
+}
+
+/* ── Connecting ────────────────────────────────────────────────────────────── */
+
+/**
+ * @brief Point the station at the saved AP, or let it scan, and connect.
+ *
+ * Called from the event loop (STA_START) and the reconnect task; the
+ * station is disconnected at both, so its config may be changed.
+ */
+static void connect_now(void)
+{
+    portENTER_CRITICAL(&s_hint_lock);
+    wifi_connect_mode_t mode = wifi_hint_tracker_begin(&s_tracker);
+    wifi_hint_t hint = s_tracker.hint;
+    portEXIT_CRITICAL(&s_hint_lock);
+
+    wifi_config_t wifi_cfg;
+    if (esp_wifi_get_config(WIFI_IF_STA, &wifi_cfg) == ESP_OK) {
+        if (mode == WIFI_CONNECT_HINTED) {
+            wifi_cfg.sta.bssid_set = true;
+            memcpy(wifi_cfg.sta.bssid, hint.bssid, sizeof(wifi_cfg.sta.bssid));
+            wifi_cfg.sta.channel   = hint.channel;
+            ESP_LOGI(TAG, "Connecting to saved AP on channel %u", hint.channel);
+        } else {
+            wifi_cfg.sta.bssid_set = false;
+            wifi_cfg.sta.channel   = 0;
+            ESP_LOGI(TAG, "Connecting with a scan");
+        }
+        esp_wifi_set_config(WIFI_IF_STA, &wifi_cfg);
+    }
+
+    esp_err_t err = esp_wifi_connect();
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "esp_wifi_connect() failed: %s", esp_err_to_name(err));
+    }
+}
+
+/**
+ * @brief Use the provisioned static address, if any, instead of DHCP.
+ *
+ * An unusable address is logged and ignored: DHCP is slower, not broken.
+ */
+static void apply_static_ip(const portunus_device_config_t *cfg)
+{
+    if (cfg->static_ip[0] == '\0') {
+        return;
+    }
+
+    esp_netif_ip_info_t ip = {};
+    esp_ip4_addr_t      dns = {};
+    const char *mask = cfg->static_netmask[0] ? cfg->static_netmask : "255.255.255.0";
+    const char *dns_str = cfg->static_dns[0] ? cfg->static_dns : cfg->static_gateway;
+    if (esp_netif_str_to_ip4(cfg->static_ip, &ip.ip) != ESP_OK ||
+        esp_netif_str_to_ip4(mask, &ip.netmask) != ESP_OK ||
+        esp_netif_str_to_ip4(cfg->static_gateway, &ip.gw) != ESP_OK ||
+        esp_netif_str_to_ip4(dns_str, &dns) != ESP_OK) {
+        ESP_LOGW(TAG, "Static address \"%s\" (gateway \"%s\") unusable — using DHCP",
+                 cfg->static_ip, cfg->static_gateway);
+        return;
+    }
+
+    esp_netif_dhcpc_stop(s_sta_netif);
+    if (esp_netif_set_ip_info(s_sta_netif, &ip) != ESP_OK) {
+        ESP_LOGW(TAG, "Could not set static address — using DHCP");
+        esp_netif_dhcpc_start(s_sta_netif);
+        return;
+    }
+    esp_netif_dns_info_t dns_info = {};
+    dns_info.ip.type            = ESP_IPADDR_TYPE_V4;
+    dns_info.ip.u_addr.ip4      = dns;
+    esp_netif_set_dns_info(s_sta_netif, ESP_NETIF_DNS_MAIN, &dns_info);
+    ESP_LOGI(TAG, "Static address %s, DHCP off", cfg->static_ip);
+}
+
+/* ── Power save ────────────────────────────────────────────────────────────── */
+
+/** Set the driver to @p mode.  Caller holds s_power_mutex. */
+static void apply_power_mode(power_mode_t mode)
+{
+    esp_err_t err = esp_wifi_set_ps(mode == POWER_MODE_AWAKE ? WIFI_PS_NONE : IDLE_PS_TYPE);
+    if (err != ESP_OK) {
+        ESP_LOGW(TAG, "esp_wifi_set_ps() failed: %s", esp_err_to_name(err));
+        return;
+    }
+    s_ps_applied = mode;
+}
+
+/** Run one power-policy step and apply the mode it asks for, if new. */
+static void power_step(power_mode_t (*step)(power_policy_t *, int64_t))
+{
+    if (s_power_mutex == NULL) {
+        return;
+    }
+    xSemaphoreTake(s_power_mutex, portMAX_DELAY);
+    power_mode_t mode = step(&s_power, now_ms());
+    if (s_ps_started && mode != s_ps_applied) {
+        apply_power_mode(mode);
+    }
+    xSemaphoreGive(s_power_mutex);
+}
+
+/* ── Roaming ───────────────────────────────────────────────────────────────── */
+
+/** Ask the AP to steer us (802.11v), or else scan for a better AP. */
+static void start_roam_scan(int64_t now)
+{
+    if (esp_wnm_is_btm_supported_connection() &&
+        esp_wnm_send_bss_transition_mgmt_query(REASON_FRAME_LOSS, NULL, 0) == 0) {
+        portENTER_CRITICAL(&s_link_lock);
+        link_monitor_roam_started(&s_link, now);
+        portEXIT_CRITICAL(&s_link_lock);
+        ESP_LOGI(TAG, "Link degraded — sent BSS transition query");
+        return;
+    }
+
+    wifi_scan_config_t scan = {};
+    scan.ssid                 = (uint8_t *)s_wifi_ssid;
+    scan.scan_type            = WIFI_SCAN_TYPE_ACTIVE;
+    scan.scan_time.active.min = 20;
+    scan.scan_time.active.max = 60;
+    s_roam_scanning = true;
+    esp_err_t err = esp_wifi_scan_start(&scan, false);
+    if (err != ESP_OK) {
+        s_roam_scanning = false;
+        ESP_LOGW(TAG, "Roam scan not started: %s", esp_err_to_name(err));
+        return;
+    }
+
+    /* An RPC that began while the scan was starting may have missed it. */
+    portENTER_CRITICAL(&s_link_lock);
+    bool busy = link_monitor_busy(&s_link);
+    portEXIT_CRITICAL(&s_link_lock);
+    if (busy) {
+        s_roam_scanning = false;
+        esp_wifi_scan_stop();
+        return;
+    }
+    ESP_LOGI(TAG, "Link degraded — scanning for a better AP");
+}
+
+/** Offer the strongest other AP the scan found to the link monitor. */
+static void finish_roam_scan(int64_t now)
+{
+    if (!s_roam_scanning.exchange(false)) {
+        esp_wifi_clear_ap_list();       /* aborted for an RPC */
+        return;
+    }
+
+    uint16_t n = ROAM_SCAN_MAX_APS;
+    if (esp_wifi_scan_get_ap_records(&n, s_scan_records) != ESP_OK) {
+        return;
+    }
+    wifi_ap_record_t current;
+    bool have_current = esp_wifi_sta_get_ap_info(&current) == ESP_OK;
+
+    const wifi_ap_record_t *best = NULL;
+    for (uint16_t i = 0; i < n; i++) {
+        const wifi_ap_record_t *r = &s_scan_records[i];
+        if (have_current && memcmp(r->bssid, current.bssid, sizeof(r->bssid)) == 0) {
+            continue;
+        }
+        if (best == NULL || r->rssi > best->rssi) {
+            best = r;
+        }
+    }
+
+    link_candidate_t cand;
+    if (best != NULL) {
+        memcpy(cand.bssid, best->bssid, sizeof(cand.bssid));
+        cand.channel  = best->primary;
+        cand.rssi_dbm = best->rssi;
+    }
+    portENTER_CRITICAL(&s_link_lock);
+    bool go = link_monitor_scan_result(&s_link, now, best != NULL ? &cand : NULL);
+    portEXIT_CRITICAL(&s_link_lock);
+
+    if (go) {
+        ESP_LOGI(TAG, "Better AP on channel %u at %d dBm", cand.channel, cand.rssi_dbm);
+    } else {
+        ESP_LOGI(TAG, "Roam scan: %u AP(s), none clearly better", n);
+    }
+}
+
+/**
+ * Leave for @p target; the disconnect handler reconnects to it at once.
+ * An RPC that started since the roam came due puts it back to wait.
+ */
+static void roam_to(const link_candidate_t *target)
+{
+    ESP_LOGI(TAG, "Roaming to AP on channel %u (%d dBm)",
+             target->channel, target->rssi_dbm);
+
+    portENTER_CRITICAL(&s_link_lock);
+    bool go = link_monitor_roam_go(&s_link, now_ms());
+    portEXIT_CRITICAL(&s_link_lock);
+    if (!go) {
+        ESP_LOGI(TAG, "Roam deferred: an RPC started");
+        return;
+    }
+
+    portENTER_CRITICAL(&s_hint_lock);
+    wifi_hint_tracker_roam(&s_tracker, target->bssid, target->channel);
+    portEXIT_CRITICAL(&s_hint_lock);
+    esp_wifi_disconnect();
+}
+
+/** Sample RSSI when due, then start a scan or a roam if the monitor wants one. */
+static void link_tick(void)
+{
+    int64_t now = now_ms();
+    if (now - s_last_sample_ms >= LINK_SAMPLE_MS) {
+        s_last_sample_ms = now;
+        int rssi;
+        if (esp_wifi_sta_get_rssi(&rssi) == ESP_OK) {
+            portENTER_CRITICAL(&s_link_lock);
+            link_monitor_rssi(&s_link, now, (int8_t)rssi);
+            portEXIT_CRITICAL(&s_link_lock);
+        }
+    }
+
+    link_candidate_t target;
+    portENTER_CRITICAL(&s_link_lock);
+    bool scan = !s_roam_scanning && link_monitor_scan_due(&s_link, now);
+    bool roam = link_monitor_roam_due(&s_link, now, &target);
+    portEXIT_CRITICAL(&s_link_lock);
+
+    if (roam) {
+        roam_to(&target);
+    } else if (scan) {
+        start_roam_scan(now);
+    }
+}
 
 /**
  * @brief Dedicated task for WiFi reconnection with exponential backoff.
  *
- * Waits for a task notification from the disconnect event handler, sleeps
- * for the current backoff interval, then calls esp_wifi_connect().
+ * Waits for a task notification from the event handlers, sleeps for the
+ * current backoff interval (not after a failed hinted attempt), then
+ * reconnects.  Also writes a changed AP hint to NVS, applies the power-save
+ * policy, and while connected wakes every LINK_SAMPLE_MS to monitor the
+ * link and roam.
  *
- * This keeps the backoff delay OFF the default event loop task, which
- * must remain responsive for all ESP-IDF system event dispatching.
+ * This keeps the backoff delay and flash writes OFF the default event loop
+ * task, which must remain responsive for all ESP-IDF system event
+ * dispatching.
  */
 static void reconnect_task(void *arg)
 {
@@ -81,15 +442,44 @@ static void reconnect_task(void *arg)
     ESP_LOGI(TAG, "Reconnect task started");
 
     for (;;) {
-        /* Block until notified by the disconnect handler.
-           ulTaskNotifyTake clears the notification on exit. */
-        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        /* Block until notified.  Bits set while we are busy below stay
+           pending, so a disconnect during the delay is handled right
+           after this attempt. */
+        uint32_t bits = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &bits, pdMS_TO_TICKS(LINK_SAMPLE_MS));
+
+        power_step((bits & RECONN_ACTIVITY) ? power_policy_activity : power_policy_tick);
+        if (bits & RECONN_SCAN_DONE) {
+            finish_roam_scan(now_ms());
+        }
+        if (s_connected) {
+            link_tick();
+        }
+
+        if (bits & RECONN_SAVE_HINT) {
+            portENTER_CRITICAL(&s_hint_lock);
+            wifi_hint_t hint = s_tracker.hint;
+            portEXIT_CRITICAL(&s_hint_lock);
+            store_hint(&hint);
+        }
+
+        if ((bits & (RECONN_DISCONNECTED | RECONN_RETRY_NOW)) == 0) {
+            continue;
+        }
+
+        if (!(bits & RECONN_DISCONNECTED)) {
+            /* The saved AP did not answer; it usually has just not been
+               heard yet.  Try again, or scan once the hint is dropped. */
+            if (!s_connected) {
+                connect_now();
+            }
+            continue;
+        }
 
-        /* Capture the current interval before sleeping.  If a second
-           disconnect fires while we're in the delay, the notification
-           count increments and we'll loop again immediately after
-           this attempt completes. */
-        uint32_t delay_ms = s_reconnect_interval_ms;
+        /* Capture the current interval before sleeping.  The wait is
+           somewhere in the upper half of the interval, different on every
+           module. */
+        uint32_t delay_ms = jitter_equal_ms(s_reconnect_interval_ms, esp_random());
 
         ESP_LOGI(TAG, "Reconnect: waiting %" PRIu32 " ms before retry", delay_ms);
         vTaskDelay(pdMS_TO_TICKS(delay_ms));
@@ -107,11 +497,7 @@ static void reconnect_task(void *arg)
         s_reconnect_interval_ms =
             std::min(s_reconnect_interval_ms * 2, RECONNECT_CEILING_MS);
 
-        ESP_LOGI(TAG, "Reconnect: calling esp_wifi_connect()");
-        esp_err_t err = esp_wifi_connect();
-        if (err != ESP_OK) {
-            ESP_LOGW(TAG, "esp_wifi_connect() failed: %s", esp_err_to_name(err));
-        }
+        connect_now();
     }
 }
 
@@ -133,29 +519,63 @@ static void wifi_event_handler(void *arg, esp_event_base_t base,
 
     case WIFI_EVENT_STA_START:
         ESP_LOGI(TAG, "STA started — initiating connection");
-        esp_wifi_connect();
+        connect_now();
         break;
 
     case WIFI_EVENT_STA_DISCONNECTED: {
         s_connected = false;
 
+        portENTER_CRITICAL(&s_hint_lock);
+        bool roaming   = s_tracker.roaming;
+        bool retry_now = wifi_hint_tracker_disconnected(&s_tracker);
+        portEXIT_CRITICAL(&s_hint_lock);
+
         wifi_event_sta_disconnected_t *info =
             (wifi_event_sta_disconnected_t *)event_data;
-        ESP_LOGW(TAG, "Disconnected (reason=%d) — notifying reconnect task "
-                 "(next backoff=%" PRIu32 " ms)",
-                 info->reason, s_reconnect_interval_ms);
+        if (roaming) {
+            ESP_LOGI(TAG, "Left AP to roam");
+        } else if (retry_now) {
+            ESP_LOGW(TAG, "Saved AP not reached (reason=%d) — retrying", info->reason);
+        } else {
+            ESP_LOGW(TAG, "Disconnected (reason=%d) — notifying reconnect task "
+                     "(next backoff=%" PRIu32 " ms)",
+                     info->reason, s_reconnect_interval_ms);
+        }
 
         /* Wake the reconnect task.  If it's already handling a previous
-           disconnect, the notification count increments and the task
-           will process it on the next loop iteration. */
+           disconnect, the bit stays set and the task will process it on
+           the next loop iteration. */
         if (s_reconnect_task != NULL) {
-            xTaskNotifyGive(s_reconnect_task);
+            xTaskNotify(s_reconnect_task,
+                        retry_now ? RECONN_RETRY_NOW : RECONN_DISCONNECTED, eSetBits);
         }
         break;
     }
 
-    case WIFI_EVENT_STA_CONNECTED:
-        ESP_LOGI(TAG, "Associated with AP — waiting for IP");
+    case WIFI_EVENT_STA_CONNECTED: {
+        wifi_event_sta_connected_t *info = (wifi_event_sta_connected_t *)event_data;
+        int64_t now = now_ms();
+        portENTER_CRITICAL(&s_hint_lock);
+        wifi_hint_tracker_associated(&s_tracker, now, info->bssid, info->channel);
+        portEXIT_CRITICAL(&s_hint_lock);
+        portENTER_CRITICAL(&s_link_lock);
+        link_monitor_associated(&s_link, now, info->bssid);
+        portEXIT_CRITICAL(&s_link_lock);
+        ESP_LOGI(TAG, "Associated with AP on channel %u — waiting for IP", info->channel);
+        break;
+    }
+
+    case WIFI_EVENT_STA_BEACON_TIMEOUT:
+        ESP_LOGW(TAG, "Beacon timeout");
+        portENTER_CRITICAL(&s_link_lock);
+        link_monitor_beacon_lost(&s_link, now_ms());
+        portEXIT_CRITICAL(&s_link_lock);
+        break;
+
+    case WIFI_EVENT_SCAN_DONE:
+        if (s_reconnect_task != NULL) {
+            xTaskNotify(s_reconnect_task, RECONN_SCAN_DONE, eSetBits);
+        }
         break;
 
     default:
@@ -174,13 +594,27 @@ static void ip_event_handler(void *arg, esp_event_base_t base,
         ESP_LOGI(TAG, "Obtained IP: " IPSTR, IP2STR(&info->ip_info.ip));
 
         s_connected = true;
+        boot_timeline_mark(BOOT_PHASE_IP, (uint32_t)now_ms());
+
+        portENTER_CRITICAL(&s_hint_lock);
+        bool hint_changed = wifi_hint_tracker_connected(&s_tracker, now_ms());
+        wifi_hint_t hint  = s_tracker.hint;
+        uint32_t took_ms  = s_tracker.stats.assoc_to_ip_ms;
+        portEXIT_CRITICAL(&s_hint_lock);
+        ESP_LOGI(TAG, "Association to IP: %" PRIu32 " ms", took_ms);
+        if (hint_changed) {
+            s_rtc_hint = hint;
+            if (s_reconnect_task != NULL) {
+                xTaskNotify(s_reconnect_task, RECONN_SAVE_HINT, eSetBits);
+            }
+        }
 
         /* Reset backoff on successful connection */
         s_reconnect_interval_ms = PORTUNUS_WIFI_RECONNECT_INTERVAL_MS;
 
-        /* Unblock wifi_mgr_start() */
-        if (s_wifi_event_group) {
-            xEventGroupSetBits(s_wifi_event_group, WIFI_CONNECTED_BIT);
+        wifi_mgr_ip_cb_t cb = s_ip_cb.load();
+        if (cb != nullptr) {
+            cb(s_ip_cb_ctx);
         }
     }
 }
@@ -197,12 +631,6 @@ portunus_err_t wifi_mgr_init(const portunus_device_config_t *cfg)
     strlcpy(s_wifi_ssid, cfg->wifi_ssid, sizeof(s_wifi_ssid));
     strlcpy(s_wifi_psk,  cfg->wifi_psk,  sizeof(s_wifi_psk));
 
-    s_wifi_event_group = xEventGroupCreate();
-    if (s_wifi_event_group == NULL) {
-        ESP_LOGE(TAG, "Failed to create WiFi event group");
-        return PORTUNUS_FAIL;
-    }
-
     /* Initialise the TCP/IP stack (idempotent in ESP-IDF ≥ 4.1) */
     ESP_ERROR_CHECK(esp_netif_init());
 
@@ -223,10 +651,38 @@ portunus_err_t wifi_mgr_init(const portunus_device_config_t *cfg)
         return PORTUNUS_FAIL;
     }
 
+    apply_static_ip(cfg);
+
+    wifi_hint_t saved;
+    bool have_saved = load_hint(&saved);
+    wifi_hint_tracker_init(&s_tracker, s_wifi_ssid, have_saved ? &saved : NULL);
+
+    link_monitor_config_t link_cfg;
+    link_monitor_default_config(&link_cfg);
+    link_monitor_init(&s_link, &link_cfg);
+    if (have_saved) {
+        ESP_LOGI(TAG, "Saved AP hint: channel %u", saved.channel);
+    }
+
+    s_power_mutex = xSemaphoreCreateMutex();
+    if (s_power_mutex == NULL) {
+        ESP_LOGE(TAG, "Failed to create power-save mutex");
+        return PORTUNUS_FAIL;
+    }
+    power_policy_config_t power_cfg;
+    power_policy_default_config(&power_cfg);
+    power_cfg.activity_window_ms = PORTUNUS_WIFI_AWAKE_WINDOW_MS;
+    power_policy_init(&s_power, &power_cfg, now_ms());
+
     /* Initialise WiFi driver with default config */
     wifi_init_config_t wifi_init_cfg = WIFI_INIT_CONFIG_DEFAULT();
     ESP_ERROR_CHECK(esp_wifi_init(&wifi_init_cfg));
 
+    /* The station config comes from NVS on every start and changes with
+       each hinted or scanning connect; keep the driver from writing it to
+       flash each time. */
+    ESP_ERROR_CHECK(esp_wifi_set_storage(WIFI_STORAGE_RAM));
+
     /* Register event handlers */
     ESP_ERROR_CHECK(esp_event_handler_instance_register(
         WIFI_EVENT, ESP_EVENT_ANY_ID,
@@ -238,13 +694,14 @@ portunus_err_t wifi_mgr_init(const portunus_device_config_t *cfg)
 
     /* Create the reconnect task — it starts blocked on ulTaskNotifyTake,
        consuming no CPU until a disconnect event fires. */
-    BaseType_t ret = xTaskCreate(
+    BaseType_t ret = xTaskCreatePinnedToCore(
         reconnect_task,
         "wifi_reconn",
         RECONNECT_TASK_STACK_SIZE,
         NULL,
-        RECONNECT_TASK_PRIORITY,
-        &s_reconnect_task
+        WIFI_RECONNECT_TASK_PRIORITY,
+        &s_reconnect_task,
+        TASK_CORE_NET
     );
     if (ret != pdPASS) {
         ESP_LOGE(TAG, "Failed to create WiFi reconnect task");
@@ -279,39 +736,39 @@ portunus_err_t wifi_mgr_start(void)
         wifi_cfg.sta.threshold.authmode = WIFI_AUTH_WPA2_PSK;
     }
 
+    /* 802.11k/v: let the AP report neighbours and steer us to them */
+    wifi_cfg.sta.rm_enabled  = 1;
+    wifi_cfg.sta.btm_enabled = 1;
+
     ESP_ERROR_CHECK(esp_wifi_set_mode(WIFI_MODE_STA));
     ESP_ERROR_CHECK(esp_wifi_set_config(WIFI_IF_STA, &wifi_cfg));
 
-    /* Clear any previous event bits */
-    xEventGroupClearBits(s_wifi_event_group,
-                         WIFI_CONNECTED_BIT | WIFI_FAIL_BIT);
+    /* Power save from the start; the policy wakes the radio when needed. */
+    xSemaphoreTake(s_power_mutex, portMAX_DELAY);
+    s_ps_started = true;
+    apply_power_mode(power_policy_tick(&s_power, now_ms()));
+    xSemaphoreGive(s_power_mutex);
 
     /* Reset backoff for a fresh start */
     s_reconnect_interval_ms = PORTUNUS_WIFI_RECONNECT_INTERVAL_MS;
 
     /* Start the WiFi driver — this triggers WIFI_EVENT_STA_START which
-       calls esp_wifi_connect() in the event handler. */
+       calls connect_now() in the event handler.  Association and
+       DHCP proceed on the WiFi and lwIP tasks from here. */
     ESP_ERROR_CHECK(esp_wifi_start());
+    boot_timeline_mark(BOOT_PHASE_WIFI_START, (uint32_t)(esp_timer_get_time() / 1000));
 
     ESP_LOGI(TAG, "Connecting to AP \"%s\" ...", s_wifi_ssid);
+    return PORTUNUS_OK;
+}
 
-    /* Block until connected or timeout */
-    EventBits_t bits = xEventGroupWaitBits(
-        s_wifi_event_group,
-        WIFI_CONNECTED_BIT | WIFI_FAIL_BIT,
-        pdFALSE,          /* don't clear on exit */
-        pdFALSE,          /* wait for ANY bit    */
-        pdMS_TO_TICKS(PORTUNUS_WIFI_CONNECT_TIMEOUT_MS));
-
-    if (bits & WIFI_CONNECTED_BIT) {
-        ESP_LOGI(TAG, "WiFi connected successfully");
-        return PORTUNUS_OK;
+void wifi_mgr_set_ip_callback(wifi_mgr_ip_cb_t cb, void *ctx)
+{
+    s_ip_cb_ctx = ctx;
+    s_ip_cb.store(cb);
+    if (cb != nullptr && s_connected) {
+        cb(ctx);
     }
-
-    ESP_LOGW(TAG, "WiFi connection timed out after %d ms "
-             "(reconnect will continue in background)",
-             PORTUNUS_WIFI_CONNECT_TIMEOUT_MS);
-    return PORTUNUS_ERR_TIMEOUT;
 }
 
 void wifi_mgr_stop(void)
@@ -322,10 +779,91 @@ void wifi_mgr_stop(void)
     esp_wifi_disconnect();
     esp_wifi_stop();
     s_connected.store(false);
+    xSemaphoreTake(s_power_mutex, portMAX_DELAY);
+    s_ps_started = false;
+    xSemaphoreGive(s_power_mutex);
     ESP_LOGI(TAG, "WiFi manager stopped");
 }
 
 bool wifi_mgr_is_connected(void)
 {
     return s_connected;
-}
\ No newline at end of file
+}
+
+void wifi_mgr_rpc_begin(void)
+{
+    portENTER_CRITICAL(&s_link_lock);
+    link_monitor_rpc_begin(&s_link);
+    portEXIT_CRITICAL(&s_link_lock);
+
+    /* An off-channel scan would stall the RPC for its whole dwell. */
+    if (s_roam_scanning.exchange(false)) {
+        esp_wifi_scan_stop();
+        ESP_LOGI(TAG, "Roam scan aborted for an RPC");
+    }
+}
+
+void wifi_mgr_rpc_end(bool ok)
+{
+    portENTER_CRITICAL(&s_link_lock);
+    link_monitor_rpc_end(&s_link, ok);
+    bool roam_waiting = s_link.roam_pending && !link_monitor_busy(&s_link);
+    portEXIT_CRITICAL(&s_link_lock);
+
+    if (roam_waiting && s_reconnect_task != NULL) {
+        xTaskNotify(s_reconnect_task, RECONN_RPC_DONE, eSetBits);
+    }
+}
+
+void wifi_mgr_get_link(link_monitor_stats_t *out)
+{
+    int64_t now = now_ms();
+    portENTER_CRITICAL(&s_link_lock);
+    link_monitor_get_stats(&s_link, now, out);
+    portEXIT_CRITICAL(&s_link_lock);
+}
+
+void wifi_mgr_get_stats(wifi_connect_stats_t *out)
+{
+    portENTER_CRITICAL(&s_hint_lock);
+    *out = s_tracker.stats;
+    portEXIT_CRITICAL(&s_hint_lock);
+}
+
+void wifi_mgr_awake_begin(void)
+{
+    power_step(power_policy_hold);
+}
+
+void wifi_mgr_awake_end(void)
+{
+    power_step(power_policy_release);
+}
+
+void wifi_mgr_note_activity(void)
+{
+    if (s_reconnect_task != NULL) {
+        xTaskNotify(s_reconnect_task, RECONN_ACTIVITY, eSetBits);
+    }
+}
+
+void wifi_mgr_note_access_rpc(uint32_t latency_ms)
+{
+    if (s_power_mutex == NULL) {
+        return;
+    }
+    xSemaphoreTake(s_power_mutex, portMAX_DELAY);
+    power_policy_access_rpc(&s_power, latency_ms);
+    xSemaphoreGive(s_power_mutex);
+}
+
+void wifi_mgr_get_power(power_policy_stats_t *out)
+{
+    if (s_power_mutex == NULL) {
+        memset(out, 0, sizeof(*out));
+        return;
+    }
+    xSemaphoreTake(s_power_mutex, portMAX_DELAY);
+    power_policy_get_stats(&s_power, now_ms(), out);
+    xSemaphoreGive(s_power_mutex);
+}
@@ -0,0 +1,25 @@
+/**
+ * @file esp_wifi.h
+ * @brief The slice of the ESP-IDF WiFi API server_comm uses, for the
+ *        fleet load simulator.
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    int8_t rssi;    /**< Signal strength of the AP, dBm */
+} wifi_ap_record_t;
+
+/** Reports a fixed, healthy RSSI. */
+esp_err_t esp_wifi_sta_get_ap_info(wifi_ap_record_t *ap_info);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,10 @@
+#include "esp_wifi.h"
+
+#include <string.h>
+
+esp_err_t esp_wifi_sta_get_ap_info(wifi_ap_record_t *ap_info)
+{
+    memset(ap_info, 0, sizeof(*ap_info));
+    ap_info->rssi = -55;
+    return ESP_OK;
+}
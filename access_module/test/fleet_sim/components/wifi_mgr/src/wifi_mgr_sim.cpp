@@ -0,0 +1,65 @@
+/**
+ * @file wifi_mgr_sim.cpp
+ * @brief wifi_mgr for the fleet load simulator: always connected.
+ */
+
+#include "wifi_mgr.hpp"
+
+portunus_err_t wifi_mgr_init(const portunus_device_config_t *cfg)
+{
+    (void)cfg;
+    return PORTUNUS_OK;
+}
+
+portunus_err_t wifi_mgr_start(void)
+{
+    return PORTUNUS_OK;
+}
+
+/* Already connected, so the callback runs once, now. */
+void wifi_mgr_set_ip_callback(wifi_mgr_ip_cb_t cb, void *ctx)
+{
+    if (cb != nullptr) {
+        cb(ctx);
+    }
+}
+
+void wifi_mgr_stop(void) {}
+
+bool wifi_mgr_is_connected(void)
+{
+    return true;
+}
+
+void wifi_mgr_get_stats(wifi_connect_stats_t *out)
+{
+    *out = {};
+}
+
+void wifi_mgr_rpc_begin(void) {}
+
+void wifi_mgr_rpc_end(bool ok)
+{
+    (void)ok;
+}
+
+void wifi_mgr_get_link(link_monitor_stats_t *out)
+{
+    *out = {};
+}
+
+void wifi_mgr_awake_begin(void) {}
+
+void wifi_mgr_awake_end(void) {}
+
+void wifi_mgr_note_activity(void) {}
+
+void wifi_mgr_note_access_rpc(uint32_t latency_ms)
+{
+    (void)latency_ms;
+}
+
+void wifi_mgr_get_power(power_policy_stats_t *out)
+{
+    *out = {};
+}
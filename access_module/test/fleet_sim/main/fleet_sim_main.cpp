@@ -0,0 +1,252 @@
+/* Fleet load simulator — one virtual module per process, ESP-IDF linux target.
+ *
+ * Runs the production event bus, reactor, heartbeat_service, grpc_client
+ * and server_comm against a real server and stands in for the reader: taps
+ * arrive as a Poisson process and are published as EVENT_CREDENTIAL_READ,
+ * exactly as the SystemFSM would.  The latency of a tap is the time from
+ * that event to the EVENT_ACCESS_GRANTED / EVENT_ACCESS_DENIED server_comm
+ * publishes for it.
+ *
+ * Configured from the environment, which scripts/fleet_sim.py fills in from
+ * its fleet file for each module it starts:
+ *
+ *   PORTUNUS_SIM_MODULE_ID     module identity (must be known to the server)
+ *   PORTUNUS_SIM_HMAC_SECRET   HMAC key (the server's PORTUNUS_HMAC_SECRET)
+ *   PORTUNUS_SIM_SERVER_HOST   default 127.0.0.1
+ *   PORTUNUS_SIM_GRPC_PORT     default 50051
+ *   PORTUNUS_SIM_TAPS_PER_MIN  mean tap rate, default 6
+ *   PORTUNUS_SIM_DURATION_S    how long to tap, default 60
+ *   PORTUNUS_SIM_UIDS          comma-separated hex UIDs to tap, default one
+ *
+ * One tap is in flight at a time, as at a real door; a tap due while the
+ * last is still waiting goes out as soon as it is decided.  When the run
+ * ends the process prints one line, "FLEET_RESULT {json}", and exits.
+ */
+
+#include "event_bus.hpp"
+#include "event_types.hpp"
+#include "error_codes.hpp"
+#include "timing_config.hpp"
+#include "reactor.hpp"
+#include "heartbeat_service.hpp"
+#include "server_comm.hpp"
+#include "portunus_nvs.hpp"
+#include "credential_types.h"
+#include "access_reason.h"
+#include "boot_timeline.hpp"
+
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "esp_random.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#include <inttypes.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "fleet_sim";
+
+#define MAX_UIDS       16
+#define MAX_SAMPLES    4096
+
+/* A decision that never comes is counted once the tap deadline and the
+   longest retry server_comm could still be in have both passed. */
+#define DECISION_WAIT_MS  (TAP_DEADLINE_MS + 2000)
+
+typedef struct {
+    uint32_t taps;
+    uint32_t granted;
+    uint32_t denied;
+    uint32_t errors;        /**< Module-local failures (no network, gRPC, signature…) */
+    uint32_t timeouts;      /**< No decision at all */
+    uint32_t local;         /**< Decided on the module (cache, revocation filter) */
+    uint32_t samples;
+    uint32_t latency_ms[MAX_SAMPLES];
+} sim_stats_t;
+
+static sim_stats_t       s_stats;
+static TaskHandle_t      s_tap_task;
+static volatile int64_t  s_tap_start_us;
+static access_reason_t   s_last_reason;
+static bool              s_last_granted;
+
+static const char *env_or(const char *name, const char *fallback)
+{
+    const char *v = getenv(name);
+    return (v != NULL && v[0] != '\0') ? v : fallback;
+}
+
+/* "04A32B1C,04:5F:22:1A:9B:80:33" → credentials; separators inside a UID
+   are ignored. */
+static size_t parse_uids(const char *list, credential_t *out, size_t cap)
+{
+    size_t n = 0;
+    int nibble = -1;
+    memset(out, 0, cap * sizeof(*out));
+    for (const char *p = list; n < cap; p++) {
+        if (*p == ',' || *p == '\0') {
+            if (out[n].uid_len > 0) {
+                n++;
+            }
+            nibble = -1;
+            if (*p == '\0') {
+                break;
+            }
+            continue;
+        }
+        int v = (*p >= '0' && *p <= '9') ? *p - '0'
+              : (*p >= 'a' && *p <= 'f') ? *p - 'a' + 10
+              : (*p >= 'A' && *p <= 'F') ? *p - 'A' + 10 : -1;
+        if (v < 0 || out[n].uid_len == CREDENTIAL_UID_MAX_LEN) {
+            continue;
+        }
+        if (nibble < 0) {
+            nibble = v;
+        } else {
+            out[n].uid[out[n].uid_len++] = (uint8_t)(nibble << 4 | v);
+            nibble = -1;
+        }
+    }
+    return n;
+}
+
+/* Reactor task: hand the decision back to the tap loop. */
+static void on_decision(const portunus_event_t *event, void *ctx)
+{
+    (void)ctx;
+    if (s_tap_start_us == 0) {
+        return;
+    }
+    s_last_granted = event->payload.access_decision.granted;
+    s_last_reason  = event->payload.access_decision.reason;
+    xTaskNotifyGive(s_tap_task);
+}
+
+static void record(int64_t latency_us)
+{
+    s_stats.taps++;
+    if (latency_us < 0) {
+        s_stats.timeouts++;
+        return;
+    }
+    if (s_last_reason == ACCESS_REASON_CACHED || s_last_reason == ACCESS_REASON_REVOKED) {
+        s_stats.local++;
+        return;
+    }
+    if (s_last_reason >= ACCESS_REASON_NO_NETWORK) {
+        s_stats.errors++;
+        return;
+    }
+    if (s_last_granted) {
+        s_stats.granted++;
+    } else {
+        s_stats.denied++;
+    }
+    if (s_stats.samples < MAX_SAMPLES) {
+        s_stats.latency_ms[s_stats.samples++] = (uint32_t)((latency_us + 500) / 1000);
+    }
+}
+
+static void print_result(const char *module_id, double elapsed_s)
+{
+    printf("FLEET_RESULT {\"module_id\":\"%s\",\"elapsed_s\":%.3f,\"taps\":%u,"
+           "\"granted\":%u,\"denied\":%u,\"errors\":%u,\"timeouts\":%u,\"local\":%u,"
+           "\"latency_ms\":[",
+           module_id, elapsed_s, (unsigned)s_stats.taps, (unsigned)s_stats.granted,
+           (unsigned)s_stats.denied, (unsigned)s_stats.errors, (unsigned)s_stats.timeouts,
+           (unsigned)s_stats.local);
+    for (uint32_t i = 0; i < s_stats.samples; i++) {
+        printf(i == 0 ? "%u" : ",%u", (unsigned)s_stats.latency_ms[i]);
+    }
+    printf("]}\n");
+    fflush(stdout);
+}
+
+extern "C" void app_main(void)
+{
+    static portunus_device_config_t cfg;
+    memset(&cfg, 0, sizeof(cfg));
+    strlcpy(cfg.module_id, env_or("PORTUNUS_SIM_MODULE_ID", "sim-0001"), sizeof(cfg.module_id));
+    strlcpy(cfg.hmac_secret, env_or("PORTUNUS_SIM_HMAC_SECRET", ""), sizeof(cfg.hmac_secret));
+    strlcpy(cfg.server_host, env_or("PORTUNUS_SIM_SERVER_HOST", "127.0.0.1"), sizeof(cfg.server_host));
+    cfg.grpc_port = (uint16_t)atoi(env_or("PORTUNUS_SIM_GRPC_PORT", "50051"));
+
+    double taps_per_min = atof(env_or("PORTUNUS_SIM_TAPS_PER_MIN", "6"));
+    int64_t duration_us = (int64_t)atoi(env_or("PORTUNUS_SIM_DURATION_S", "60")) * 1000000;
+
+    static credential_t uids[MAX_UIDS];
+    size_t uid_count = parse_uids(env_or("PORTUNUS_SIM_UIDS", "04A32B1C"), uids, MAX_UIDS);
+    if (uid_count == 0 || taps_per_min <= 0.0) {
+        ESP_LOGE(TAG, "Need at least one UID and a positive tap rate");
+        exit(2);
+    }
+
+    /* The host network is up before the process starts. */
+    uint32_t boot_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    boot_timeline_mark(BOOT_PHASE_CONFIG, boot_ms);
+    boot_timeline_mark(BOOT_PHASE_WIFI_START, boot_ms);
+    boot_timeline_mark(BOOT_PHASE_IP, boot_ms);
+
+    s_tap_task = xTaskGetCurrentTaskHandle();
+    if (reactor_init() != PORTUNUS_OK || event_bus_init() != PORTUNUS_OK) {
+        ESP_LOGE(TAG, "Reactor / event bus init failed");
+        exit(1);
+    }
+    event_bus_subscribe(EVENT_ACCESS_GRANTED, on_decision, NULL);
+    event_bus_subscribe(EVENT_ACCESS_DENIED, on_decision, NULL);
+    /* This loop stands in for the reader and FSM. */
+    boot_ms = (uint32_t)(esp_timer_get_time() / 1000);
+    boot_timeline_mark(BOOT_PHASE_IO_READY, boot_ms);
+    boot_timeline_mark(BOOT_PHASE_FSM, boot_ms);
+    if (heartbeat_service_start() != PORTUNUS_OK) {
+        ESP_LOGW(TAG, "Heartbeat service start failed — taps only");
+    }
+    if (server_comm_init(&cfg) != PORTUNUS_OK) {
+        ESP_LOGE(TAG, "server_comm init failed");
+        exit(1);
+    }
+    ESP_LOGI(TAG, "%s: %.1f taps/min for %" PRId64 " s against %s:%u",
+             cfg.module_id, taps_per_min, duration_us / 1000000, cfg.server_host, cfg.grpc_port);
+
+    int64_t start_us = esp_timer_get_time();
+    int64_t next_tap_us = start_us;
+    while (true) {
+        /* Exponential gap: a Poisson stream of taps. */
+        double u = ((double)esp_random() + 1.0) / 4294967297.0;
+        next_tap_us += (int64_t)(-log(u) * 60e6 / taps_per_min);
+        if (next_tap_us - start_us >= duration_us) {
+            break;
+        }
+        int64_t now_us = esp_timer_get_time();
+        if (next_tap_us > now_us) {
+            vTaskDelay(pdMS_TO_TICKS((next_tap_us - now_us) / 1000));
+        }
+
+        portunus_event_t ev;
+        memset(&ev, 0, sizeof(ev));
+        ev.id = EVENT_CREDENTIAL_READ;
+        ev.payload.credential_read.credential = uids[esp_random() % uid_count];
+        ev.payload.credential_read.timestamp_ms = esp_timer_get_time() / 1000;
+        ev.payload.credential_read.deadline_ms =
+            ev.payload.credential_read.timestamp_ms + TAP_DEADLINE_MS;
+
+        ulTaskNotifyTake(pdTRUE, 0);
+        s_tap_start_us = esp_timer_get_time();
+        if (event_bus_publish(&ev) != PORTUNUS_OK) {
+            s_tap_start_us = 0;
+            s_stats.taps++;
+            s_stats.errors++;
+            continue;
+        }
+        bool decided = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(DECISION_WAIT_MS)) > 0;
+        int64_t latency_us = decided ? esp_timer_get_time() - s_tap_start_us : -1;
+        s_tap_start_us = 0;
+        record(latency_us);
+    }
+
+    print_result(cfg.module_id, (double)(esp_timer_get_time() - start_us) / 1e6);
+    exit(0);
+}
@@ -0,0 +1,664 @@
+/* Tier A host microbenchmarks: the functions every tap and heartbeat runs.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig.  Links upstream nanopb and mbedtls.
+ *
+ * Each benchmark is calibrated to run for at least --min-time-ms, timed
+ * --reps times, and reported as the fastest run (the one least disturbed
+ * by the host).  Allocations are counted over the calibrated run: malloc
+ * and friends on glibc, operator new everywhere.
+ *
+ * Results go to stdout, one JSON object per line:
+ *
+ *   {"bench":"credential_uid_to_hex","iters":4194304,"ns_per_op":21.37,"allocs_per_op":0.000}
+ *
+ * Save a run as a baseline and compare a later one against it:
+ *
+ *   bench_hot_path --out baseline.jsonl
+ *   bench_hot_path --baseline baseline.jsonl [--tolerance 15]
+ *
+ * A comparison prints a table on stderr and exits 1 if any benchmark got
+ * slower by more than the tolerance (percent) or allocates more than it
+ * did.  Baselines are only comparable on the same host and build type.
+ *
+ * --quick runs every benchmark once, briefly; ctest uses it to check the
+ * benchmarks still build and their results still check out.
+ */
+#include "credential_types.h"
+#include "grpc_frame.hpp"
+#include "revocation_filter.hpp"
+#include "server_time.hpp"
+#include "sig_engine.hpp"
+#include "system_fsm_decide.hpp"
+#include "wire_sig.hpp"
+
+#include "portunus/v1/portunus.pb.h"
+#include <pb_decode.h>
+#include <pb_encode.h>
+
+#include "mbedtls/md.h"
+
+#include <chrono>
+#include <new>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ── Allocation counting ────────────────────────────────────────────────── */
+
+static uint64_t s_allocs;
+
+#if defined(__GLIBC__)
+extern "C" {
+void *__libc_malloc(size_t);
+void *__libc_calloc(size_t, size_t);
+void *__libc_realloc(void *, size_t);
+void  __libc_free(void *);
+
+void *malloc(size_t n)            { s_allocs++; return __libc_malloc(n); }
+void *calloc(size_t c, size_t n)  { s_allocs++; return __libc_calloc(c, n); }
+void *realloc(void *p, size_t n)  { s_allocs++; return __libc_realloc(p, n); }
+void  free(void *p)               { __libc_free(p); }
+}
+#endif
+
+void *operator new(size_t n)
+{
+#if !defined(__GLIBC__)
+    s_allocs++;
+#endif
+    void *p = malloc(n);
+    if (p == NULL) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+
+/* Keeps the compiler from proving a result unused. */
+static inline void keep(const void *p)
+{
+    __asm__ __volatile__("" : : "g"(p) : "memory");
+}
+
+/* ── Fixtures ───────────────────────────────────────────────────────────── */
+
+static const char k_secret[] = "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef";
+static const char k_module_id[] = "door-lobby-01";
+
+static const uint8_t k_nonce[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+
+static credential_t                 s_cred;
+static char                         s_cred_hex[CREDENTIAL_UID_HEX_STR_LEN];
+static sig_engine_t                 s_sig;
+static portunus_v1_AccessRequest    s_access_req = portunus_v1_AccessRequest_init_zero;
+static portunus_v1_HeartbeatRequest s_heartbeat  = portunus_v1_HeartbeatRequest_init_zero;
+static uint8_t                      s_access_resp_pb[portunus_v1_AccessResponse_size];
+static size_t                       s_access_resp_pb_len;
+static uint8_t                      s_resp_frame[GRPC_FRAME_HEADER_LEN + portunus_v1_AccessResponse_size];
+static size_t                       s_resp_frame_len;
+static char                         s_resp_sig[SIG_ENGINE_HEX_LEN];
+
+/* A fleet-sized revocation filter: 10000 revoked tags. */
+#define FILTER_ENTRIES 10000u
+static uint64_t                     s_filter_tags[FILTER_ENTRIES];
+static uint8_t                      s_filter_buf[12330];
+static revocation_filter_t          s_filter;
+
+/* Well-spread distinct tags (the filter's own finaliser). */
+static uint64_t tag_for(uint64_t i)
+{
+    i ^= i >> 33;
+    i *= 0xff51afd7ed558ccdULL;
+    i ^= i >> 33;
+    i *= 0xc4ceb9fe1a85ec53ULL;
+    i ^= i >> 33;
+    return i;
+}
+
+static bool fixtures_init(void)
+{
+    static const uint8_t uid[] = { 0x04, 0x5F, 0x22, 0x1A, 0x9B, 0x80, 0x33 };
+    memcpy(s_cred.uid, uid, sizeof(uid));
+    s_cred.uid_len = sizeof(uid);
+    credential_uid_to_hex(&s_cred, s_cred_hex, sizeof(s_cred_hex));
+
+    if (!sig_engine_init(&s_sig, (const uint8_t *)k_secret, strlen(k_secret))) {
+        return false;
+    }
+
+    /* As server_comm builds them for a protocol v2 tap and heartbeat. */
+    strcpy(s_access_req.module_id, k_module_id);
+    strcpy(s_access_req.credential_id, s_cred_hex);
+    s_access_req.has_door_closed  = true;
+    s_access_req.door_closed      = true;
+    s_access_req.nonce.size       = sizeof(k_nonce);
+    memcpy(s_access_req.nonce.bytes, k_nonce, sizeof(k_nonce));
+    s_access_req.protocol_version = WIRE_SIG_VERSION;
+    s_access_req.requested_at_us  = 1792310142123456LL;
+
+    strcpy(s_heartbeat.module_id, k_module_id);
+    strcpy(s_heartbeat.firmware_version, "0.9.0");
+    strcpy(s_heartbeat.ip, "192.168.1.42");
+    s_heartbeat.uptime_s                   = 86400;
+    s_heartbeat.has_door_closed            = true;
+    s_heartbeat.door_closed                = true;
+    s_heartbeat.has_rssi_dbm               = true;
+    s_heartbeat.rssi_dbm                   = -61;
+    s_heartbeat.free_heap_bytes            = 183424;
+    s_heartbeat.sequence                   = 2880;
+    s_heartbeat.cpu_cores                  = 2;
+    s_heartbeat.core_isolation             = true;
+    s_heartbeat.rtt_p50_ms                 = 12;
+    s_heartbeat.rtt_p90_ms                 = 19;
+    s_heartbeat.rtt_p99_ms                 = 41;
+    s_heartbeat.rpc_timeout_ms             = 180;
+    s_heartbeat.decision_cache_hits        = 37;
+    s_heartbeat.decision_cache_misses      = 112;
+    s_heartbeat.revocation_filter_version  = 7;
+    s_heartbeat.revocation_filter_capacity = 1024;
+    s_heartbeat.protocol_version           = WIRE_SIG_VERSION;
+    s_heartbeat.clock_offset_us            = -1830;
+    s_heartbeat.clock_error_us             = 2400;
+    s_heartbeat.clock_drift_ppb            = 11500;
+    s_heartbeat.heartbeat_interval_s       = 240;
+    s_heartbeat.heartbeats_skipped         = 2300;
+    s_heartbeat.heartbeat_bytes_saved      = 412000;
+
+    /* A protocol v2 grant as the server sends it, framed and signed. */
+    portunus_v1_AccessResponse resp = portunus_v1_AccessResponse_init_zero;
+    resp.ok             = true;
+    resp.known          = true;
+    resp.granted        = true;
+    strcpy(resp.module_id, k_module_id);
+    resp.cache_ttl_s    = 300;
+    resp.policy_version = 42;
+    resp.reason_code    = portunus_v1_AccessReason_ACCESS_REASON_CREDENTIAL_ALLOWED;
+    resp.server_time_us = 1792310142125000LL;
+    pb_ostream_t os = pb_ostream_from_buffer(s_access_resp_pb, sizeof(s_access_resp_pb));
+    if (!pb_encode(&os, portunus_v1_AccessResponse_fields, &resp)) {
+        return false;
+    }
+    s_access_resp_pb_len = os.bytes_written;
+    if (!grpc_frame_encode(s_access_resp_pb, s_access_resp_pb_len,
+                           s_resp_frame, sizeof(s_resp_frame), &s_resp_frame_len)) {
+        return false;
+    }
+
+    for (uint32_t i = 0; i < FILTER_ENTRIES; i++) {
+        s_filter_tags[i] = tag_for(i + 1);
+    }
+    if (revocation_filter_bytes(FILTER_ENTRIES) != sizeof(s_filter_buf) ||
+        !revocation_filter_build(&s_filter, s_filter_buf, sizeof(s_filter_buf),
+                                 s_filter_tags, FILTER_ENTRIES, 1)) {
+        return false;
+    }
+
+    uint8_t proj[WIRE_SIG_MAX_LEN];
+    size_t n = wire_sig_access_response(proj, sizeof(proj), k_module_id, s_cred_hex, true,
+                                        300, 42);
+    return n > 0 && sig_engine_sign_hex(&s_sig, proj, n, s_resp_sig);
+}
+
+/* ── Benchmarks ─────────────────────────────────────────────────────────── */
+/* Each runs @p iters operations and returns false if a result is wrong. */
+
+static bool bench_uid_to_hex(uint64_t iters)
+{
+    char buf[CREDENTIAL_UID_HEX_STR_LEN];
+    for (uint64_t i = 0; i < iters; i++) {
+        credential_uid_to_hex(&s_cred, buf, sizeof(buf));
+        keep(buf);
+    }
+    return strcmp(buf, "04:5F:22:1A:9B:80:33") == 0;
+}
+
+static bool bench_uid_to_log_id(uint64_t iters)
+{
+    char buf[CREDENTIAL_LOG_ID_LEN];
+    for (uint64_t i = 0; i < iters; i++) {
+        credential_uid_to_log_id(&s_cred, buf, sizeof(buf));
+        keep(buf);
+    }
+    return strlen(buf) == CREDENTIAL_LOG_ID_LEN - 1;
+}
+
+static bool bench_encode_access_request(uint64_t iters)
+{
+    uint8_t buf[portunus_v1_AccessRequest_size];
+    bool ok = true;
+    for (uint64_t i = 0; i < iters; i++) {
+        pb_ostream_t os = pb_ostream_from_buffer(buf, sizeof(buf));
+        ok &= pb_encode(&os, portunus_v1_AccessRequest_fields, &s_access_req);
+        keep(buf);
+    }
+    return ok;
+}
+
+static bool bench_decode_access_response(uint64_t iters)
+{
+    portunus_v1_AccessResponse resp;
+    bool ok = true;
+    for (uint64_t i = 0; i < iters; i++) {
+        pb_istream_t is = pb_istream_from_buffer(s_access_resp_pb, s_access_resp_pb_len);
+        ok &= pb_decode(&is, portunus_v1_AccessResponse_fields, &resp);
+        keep(&resp);
+    }
+    return ok && resp.granted && resp.policy_version == 42;
+}
+
+static bool bench_encode_heartbeat_request(uint64_t iters)
+{
+    uint8_t buf[portunus_v1_HeartbeatRequest_size];
+    bool ok = true;
+    for (uint64_t i = 0; i < iters; i++) {
+        pb_ostream_t os = pb_ostream_from_buffer(buf, sizeof(buf));
+        ok &= pb_encode(&os, portunus_v1_HeartbeatRequest_fields, &s_heartbeat);
+        keep(buf);
+    }
+    return ok;
+}
+
+/* The request signature: projection plus HMAC, as server_comm signs a tap. */
+static bool bench_sign_access_request(uint64_t iters)
+{
+    uint8_t proj[WIRE_SIG_MAX_LEN];
+    char hex[SIG_ENGINE_HEX_LEN];
+    bool ok = true;
+    for (uint64_t i = 0; i < iters; i++) {
+        size_t n = wire_sig_access(proj, sizeof(proj), k_module_id, s_cred_hex,
+                                   k_nonce, sizeof(k_nonce), s_access_req.requested_at_us);
+        ok &= sig_engine_sign_hex(&s_sig, proj, n, hex);
+        keep(hex);
+    }
+    return ok;
+}
+
+/* What sig_sign_access_request replaced, one step at a time: the v2
+   projection signed with a one-shot mbedtls_md_hmac(), then the v0 text
+   projection (strftime, hex nonce, "|"-joined) signed the same way. */
+static void hex_encode(const uint8_t *mac, char *hex)
+{
+    static const char digits[] = "0123456789abcdef";
+    for (size_t i = 0; i < SIG_ENGINE_MAC_LEN; i++) {
+        hex[2 * i]     = digits[mac[i] >> 4];
+        hex[2 * i + 1] = digits[mac[i] & 0x0f];
+    }
+    hex[2 * SIG_ENGINE_MAC_LEN] = '\0';
+}
+
+static bool bench_md_hmac_access_request(uint64_t iters)
+{
+    const mbedtls_md_info_t *info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+    uint8_t proj[WIRE_SIG_MAX_LEN];
+    uint8_t mac[SIG_ENGINE_MAC_LEN];
+    char hex[SIG_ENGINE_HEX_LEN];
+    bool ok = true;
+    for (uint64_t i = 0; i < iters; i++) {
+        size_t n = wire_sig_access(proj, sizeof(proj), k_module_id, s_cred_hex,
+                                   k_nonce, sizeof(k_nonce), s_access_req.requested_at_us);
+        ok &= mbedtls_md_hmac(info, (const uint8_t *)k_secret, strlen(k_secret),
+                              proj, n, mac) == 0;
+        hex_encode(mac, hex);
+        keep(hex);
+    }
+    return ok;
+}
+
+static bool bench_sign_access_request_v0(uint64_t iters)
+{
+    const mbedtls_md_info_t *info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+    const time_t sec = (time_t)(s_access_req.requested_at_us / 1000000);
+    const long usec = (long)(s_access_req.requested_at_us % 1000000);
+    char proj[160];
+    uint8_t mac[SIG_ENGINE_MAC_LEN];
+    char hex[SIG_ENGINE_HEX_LEN];
+    bool ok = true;
+    for (uint64_t i = 0; i < iters; i++) {
+        char requested_at[40];
+        struct tm tm;
+        gmtime_r(&sec, &tm);
+        size_t t = strftime(requested_at, sizeof(requested_at) - 1, "%Y-%m-%dT%H:%M:%S", &tm);
+        snprintf(requested_at + t, sizeof(requested_at) - t, ".%06ldZ", usec);
+        char nonce_hex[2 * sizeof(k_nonce) + 1];
+        for (size_t j = 0; j < sizeof(k_nonce); j++) {
+            snprintf(&nonce_hex[j * 2], 3, "%02x", k_nonce[j]);
+        }
+        int n = snprintf(proj, sizeof(proj), "access|%s|%s|%s|%s",
+                         k_module_id, s_cred_hex, nonce_hex, requested_at);
+        ok &= mbedtls_md_hmac(info, (const uint8_t *)k_secret, strlen(k_secret),
+                              (const uint8_t *)proj, (size_t)n, mac) == 0;
+        hex_encode(mac, hex);
+        keep(hex);
+    }
+    return ok && strstr(proj, "|2026-10-18T") != NULL;
+}
+
+/* The response check: projection plus constant-time compare of the MAC. */
+static bool bench_verify_access_response(uint64_t iters)
+{
+    uint8_t proj[WIRE_SIG_MAX_LEN];
+    bool ok = true;
+    for (uint64_t i = 0; i < iters; i++) {
+        size_t n = wire_sig_access_response(proj, sizeof(proj), k_module_id, s_cred_hex, true,
+                                        300, 42);
+        ok &= sig_engine_verify_hex(&s_sig, proj, n, s_resp_sig);
+    }
+    return ok;
+}
+
+static bool bench_parse_server_time(uint64_t iters)
+{
+    struct timeval tv = {};
+    bool ok = true;
+    for (uint64_t i = 0; i < iters; i++) {
+        ok &= parse_server_time("2026-10-18T09:15:42.123456789Z", &tv);
+        keep(&tv);
+    }
+    return ok && tv.tv_sec == 1792314942 && tv.tv_usec == 123456;
+}
+
+/* Half revoked tags, half strangers, as server_comm checks a tap. */
+static bool bench_revocation_filter_contains(uint64_t iters)
+{
+    uint64_t hits = 0;
+    for (uint64_t i = 0; i < iters; i++) {
+        uint64_t tag = (i & 1) ? s_filter_tags[i % FILTER_ENTRIES]
+                               : tag_for(0x100000000ULL + i);
+        hits += revocation_filter_contains(&s_filter, tag) ? 1 : 0;
+    }
+    return hits >= iters / 2;
+}
+
+static bool bench_grpc_frame_encode(uint64_t iters)
+{
+    uint8_t out[GRPC_FRAME_HEADER_LEN + portunus_v1_AccessResponse_size];
+    size_t len = 0;
+    bool ok = true;
+    for (uint64_t i = 0; i < iters; i++) {
+        ok &= grpc_frame_encode(s_access_resp_pb, s_access_resp_pb_len, out, sizeof(out), &len);
+        keep(out);
+    }
+    return ok && len == s_resp_frame_len;
+}
+
+static bool bench_grpc_frame_decode(uint64_t iters)
+{
+    const uint8_t *pb = NULL;
+    size_t len = 0;
+    bool ok = true;
+    for (uint64_t i = 0; i < iters; i++) {
+        ok &= grpc_frame_decode(s_resp_frame, s_resp_frame_len, &pb, &len);
+        keep(pb);
+    }
+    return ok && len == s_access_resp_pb_len;
+}
+
+static bool bench_decide_system_event(uint64_t iters)
+{
+    system_capabilities_t caps;
+    caps.has_reader       = true;
+    caps.has_access_point = true;
+    caps.has_feedback     = true;
+    caps.has_network      = true;
+    portunus_event_t ev;
+    memset(&ev, 0, sizeof(ev));
+    ev.id = EVENT_ACCESS_GRANTED;
+    ev.payload.access_decision.granted     = true;
+    ev.payload.access_decision.deadline_ms = 3000;
+
+    fsm_actions_t a;
+    for (uint64_t i = 0; i < iters; i++) {
+        a = decide_system_event(caps, ev, (int64_t)(i & 1023));
+        keep(&a);
+    }
+    return a.door == door_cmd_t::UNLOCK_AND_HOLD;
+}
+
+typedef struct {
+    const char *name;
+    bool      (*run)(uint64_t iters);
+} bench_t;
+
+static const bench_t k_benches[] = {
+    { "credential_uid_to_hex",        bench_uid_to_hex },
+    { "credential_uid_to_log_id",     bench_uid_to_log_id },
+    { "pb_encode_access_request",     bench_encode_access_request },
+    { "pb_decode_access_response",    bench_decode_access_response },
+    { "pb_encode_heartbeat_request",  bench_encode_heartbeat_request },
+    { "sig_sign_access_request",      bench_sign_access_request },
+    { "sig_md_hmac_access_request",   bench_md_hmac_access_request },
+    { "sig_sign_access_request_v0",   bench_sign_access_request_v0 },
+    { "sig_verify_access_response",   bench_verify_access_response },
+    { "parse_server_time",            bench_parse_server_time },
+    { "revocation_filter_contains",   bench_revocation_filter_contains },
+    { "grpc_frame_encode",            bench_grpc_frame_encode },
+    { "grpc_frame_decode",            bench_grpc_frame_decode },
+    { "decide_system_event",          bench_decide_system_event },
+};
+
+/* ── Runner ─────────────────────────────────────────────────────────────── */
+
+typedef struct {
+    char     name[64];
+    uint64_t iters;
+    double   ns_per_op;
+    double   allocs_per_op;
+} result_t;
+
+#define MAX_RESULTS  64
+
+static int64_t now_ns(void)
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/* Returns false if the benchmark's own check failed. */
+static bool run_bench(const bench_t *b, int64_t min_ns, int reps, result_t *out)
+{
+    /* Calibrate: double the count until one run takes min_ns. */
+    uint64_t iters = 1;
+    int64_t  took  = 0;
+    for (;;) {
+        int64_t t0 = now_ns();
+        if (!b->run(iters)) {
+            return false;
+        }
+        took = now_ns() - t0;
+        if (took >= min_ns || iters >= (1ULL << 40)) {
+            break;
+        }
+        iters *= 2;
+    }
+
+    int64_t best = took;
+    for (int r = 1; r < reps; r++) {
+        int64_t t0 = now_ns();
+        b->run(iters);
+        int64_t t = now_ns() - t0;
+        if (t < best) {
+            best = t;
+        }
+    }
+
+    uint64_t a0 = s_allocs;
+    b->run(iters);
+    uint64_t allocs = s_allocs - a0;
+
+    snprintf(out->name, sizeof(out->name), "%s", b->name);
+    out->iters         = iters;
+    out->ns_per_op     = (double)best / (double)iters;
+    out->allocs_per_op = (double)allocs / (double)iters;
+    return true;
+}
+
+static void print_result(FILE *f, const result_t *r)
+{
+    fprintf(f, "{\"bench\":\"%s\",\"iters\":%llu,\"ns_per_op\":%.2f,\"allocs_per_op\":%.3f}\n",
+            r->name, (unsigned long long)r->iters, r->ns_per_op, r->allocs_per_op);
+}
+
+static size_t load_results(const char *path, result_t *out, size_t cap)
+{
+    FILE *f = fopen(path, "r");
+    if (f == NULL) {
+        return 0;
+    }
+    char line[256];
+    size_t n = 0;
+    while (n < cap && fgets(line, sizeof(line), f) != NULL) {
+        unsigned long long iters;
+        result_t *r = &out[n];
+        if (sscanf(line, "{\"bench\":\"%63[^\"]\",\"iters\":%llu,\"ns_per_op\":%lf,\"allocs_per_op\":%lf}",
+                   r->name, &iters, &r->ns_per_op, &r->allocs_per_op) == 4) {
+            r->iters = iters;
+            n++;
+        }
+    }
+    fclose(f);
+    return n;
+}
+
+/* Prints the comparison on stderr; returns the number of regressions. */
+static int compare(const result_t *cur, size_t n_cur, const result_t *base, size_t n_base,
+                   double tolerance_pct)
+{
+    int regressions = 0;
+    fprintf(stderr, "%-30s %12s %12s %8s %10s %10s\n",
+            "bench", "base ns/op", "ns/op", "change", "base alloc", "alloc");
+    for (size_t i = 0; i < n_cur; i++) {
+        const result_t *b = NULL;
+        for (size_t j = 0; j < n_base; j++) {
+            if (strcmp(base[j].name, cur[i].name) == 0) {
+                b = &base[j];
+                break;
+            }
+        }
+        if (b == NULL) {
+            fprintf(stderr, "%-30s %12s %12.2f %8s %10s %10.3f  new\n",
+                    cur[i].name, "-", cur[i].ns_per_op, "-", "-", cur[i].allocs_per_op);
+            continue;
+        }
+        double change = b->ns_per_op > 0.0 ? (cur[i].ns_per_op / b->ns_per_op - 1.0) * 100.0 : 0.0;
+        bool slower = change > tolerance_pct;
+        bool allocs = cur[i].allocs_per_op > b->allocs_per_op + 0.0005;
+        if (slower || allocs) {
+            regressions++;
+        }
+        fprintf(stderr, "%-30s %12.2f %12.2f %+7.1f%% %10.3f %10.3f%s%s\n",
+                cur[i].name, b->ns_per_op, cur[i].ns_per_op, change,
+                b->allocs_per_op, cur[i].allocs_per_op,
+                slower ? "  SLOWER" : "", allocs ? "  ALLOCS" : "");
+    }
+    return regressions;
+}
+
+static void usage(void)
+{
+    fprintf(stderr,
+            "usage: bench_hot_path [--filter SUBSTR] [--min-time-ms N] [--reps N]\n"
+            "                      [--out FILE] [--baseline FILE] [--tolerance PCT] [--quick]\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter   = NULL;
+    const char *out_path = NULL;
+    const char *baseline = NULL;
+    long   min_time_ms   = 50;
+    int    reps          = 5;
+    double tolerance     = 15.0;
+
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        const char *v = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(a, "--quick") == 0) {
+            min_time_ms = 1;
+            reps = 1;
+            continue;
+        }
+        if (v == NULL) {
+            usage();
+            return 2;
+        }
+        if (strcmp(a, "--filter") == 0) {
+            filter = v;
+        } else if (strcmp(a, "--min-time-ms") == 0) {
+            min_time_ms = strtol(v, NULL, 10);
+        } else if (strcmp(a, "--reps") == 0) {
+            reps = (int)strtol(v, NULL, 10);
+        } else if (strcmp(a, "--out") == 0) {
+            out_path = v;
+        } else if (strcmp(a, "--baseline") == 0) {
+            baseline = v;
+        } else if (strcmp(a, "--tolerance") == 0) {
+            tolerance = strtod(v, NULL);
+        } else {
+            usage();
+            return 2;
+        }
+        i++;
+    }
+    if (reps < 1) {
+        reps = 1;
+    }
+
+    /* parse_server_time relies on mktime() reading UTC, as on the device. */
+    setenv("TZ", "UTC0", 1);
+    tzset();
+
+    if (!fixtures_init()) {
+        fprintf(stderr, "fixture setup failed\n");
+        return 2;
+    }
+
+    static result_t results[MAX_RESULTS];
+    size_t n = 0;
+    bool failed = false;
+    for (const bench_t &b : k_benches) {
+        if (filter != NULL && strstr(b.name, filter) == NULL) {
+            continue;
+        }
+        if (!run_bench(&b, (int64_t)min_time_ms * 1000000, reps, &results[n])) {
+            fprintf(stderr, "%s: wrong result\n", b.name);
+            failed = true;
+            continue;
+        }
+        print_result(stdout, &results[n]);
+        fflush(stdout);
+        n++;
+    }
+    sig_engine_free(&s_sig);
+
+    if (out_path != NULL) {
+        FILE *f = fopen(out_path, "w");
+        if (f == NULL) {
+            fprintf(stderr, "cannot write %s\n", out_path);
+            return 2;
+        }
+        for (size_t i = 0; i < n; i++) {
+            print_result(f, &results[i]);
+        }
+        fclose(f);
+    }
+
+    if (baseline != NULL) {
+        static result_t base[MAX_RESULTS];
+        size_t n_base = load_results(baseline, base, MAX_RESULTS);
+        if (n_base == 0) {
+            fprintf(stderr, "no results in baseline %s\n", baseline);
+            return 2;
+        }
+        int regressions = compare(results, n, base, n_base, tolerance);
+        if (regressions > 0) {
+            fprintf(stderr, "%d regression(s) beyond %.0f%%\n", regressions, tolerance);
+            return 1;
+        }
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,360 @@
+/* Tier A host benchmark: client CPU time of a TLS handshake, per way of
+ * setting up server trust.  No ESP-IDF, no FreeRTOS, no sdkconfig.  Links
+ * upstream mbedtls.
+ *
+ * A client and a server mbedtls context handshake in one process over a
+ * pair of in-memory pipes, stepping in turn; the client's share is timed
+ * with the thread CPU clock, so the server's work and the pipe are not
+ * counted.  Each handshake builds a fresh client config and context, as
+ * esp-tls does per connect.  Certificates are the RSA-2048 fixtures in
+ * tls_fixtures.h, shaped like scripts/generate_certs.sh output, and the
+ * client is held to TLS 1.2 as on the device.
+ *
+ *   pem_per_connect   the CA PEM parsed into a new chain for every
+ *                     handshake: esp-tls with cacert_buf, as grpc_client
+ *                     used to connect
+ *   der_parsed_once   the DER CA parsed once into a tls_trust_t and
+ *                     attached to every handshake
+ *   spki_pin          tls_trust_t with only the server's SPKI pin
+ *
+ * One JSON object per line on stdout:
+ *
+ *   {"bench":"tls_handshake_der_parsed_once","handshakes":200,"client_cpu_us":2112.4,
+ *    "client_cpu_us_min":2071.9,"server_cpu_us":5630.2,"vs_pem_pct":-4.1}
+ *
+ * client_cpu_us is the median; vs_pem_pct compares it with pem_per_connect.
+ * Host numbers rank the setups; the device's absolute cost is higher and
+ * its RSA is hardware-assisted.
+ *
+ * --quick runs two handshakes per setup; ctest uses it to check they all
+ * still complete and verify.
+ */
+#include "tls_trust.hpp"
+#include "tls_fixtures.h"
+
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/pk.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/x509_crt.h"
+#include "psa/crypto.h"
+
+#include <algorithm>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/* ── In-memory transport ────────────────────────────────────────────────── */
+
+typedef struct {
+    unsigned char buf[32768];
+    size_t        len;
+} pipe_t;
+
+typedef struct {
+    pipe_t *tx;
+    pipe_t *rx;
+} end_t;
+
+static int pipe_send(void *ctx, const unsigned char *data, size_t n)
+{
+    pipe_t *p = static_cast<end_t *>(ctx)->tx;
+    size_t room = sizeof(p->buf) - p->len;
+    if (room == 0) {
+        return MBEDTLS_ERR_SSL_WANT_WRITE;
+    }
+    n = std::min(n, room);
+    memcpy(p->buf + p->len, data, n);
+    p->len += n;
+    return (int)n;
+}
+
+static int pipe_recv(void *ctx, unsigned char *data, size_t n)
+{
+    pipe_t *p = static_cast<end_t *>(ctx)->rx;
+    if (p->len == 0) {
+        return MBEDTLS_ERR_SSL_WANT_READ;
+    }
+    n = std::min(n, p->len);
+    memcpy(data, p->buf, n);
+    memmove(p->buf, p->buf + n, p->len - n);
+    p->len -= n;
+    return (int)n;
+}
+
+/* ── Fixtures ───────────────────────────────────────────────────────────── */
+
+static const char *k_alpn[] = { "h2", NULL };
+
+static mbedtls_entropy_context  s_entropy;
+static mbedtls_ctr_drbg_context s_drbg;
+static mbedtls_x509_crt         s_srv_cert;
+static mbedtls_pk_context       s_srv_key;
+static mbedtls_ssl_config       s_srv_conf;
+static tls_trust_t              s_trust_der;
+static tls_trust_t              s_trust_pin;
+
+static bool fixtures_init(void)
+{
+    if (psa_crypto_init() != PSA_SUCCESS) {
+        return false;
+    }
+    mbedtls_entropy_init(&s_entropy);
+    mbedtls_ctr_drbg_init(&s_drbg);
+    if (mbedtls_ctr_drbg_seed(&s_drbg, mbedtls_entropy_func, &s_entropy, NULL, 0) != 0) {
+        return false;
+    }
+
+    mbedtls_x509_crt_init(&s_srv_cert);
+    mbedtls_pk_init(&s_srv_key);
+    if (mbedtls_x509_crt_parse_der(&s_srv_cert, k_rsa_server_der, sizeof(k_rsa_server_der)) != 0 ||
+        mbedtls_pk_parse_key(&s_srv_key, k_rsa_server_key_der, sizeof(k_rsa_server_key_der),
+                             NULL, 0, mbedtls_ctr_drbg_random, &s_drbg) != 0) {
+        return false;
+    }
+
+    mbedtls_ssl_config_init(&s_srv_conf);
+    if (mbedtls_ssl_config_defaults(&s_srv_conf, MBEDTLS_SSL_IS_SERVER,
+                                    MBEDTLS_SSL_TRANSPORT_STREAM, MBEDTLS_SSL_PRESET_DEFAULT) != 0 ||
+        mbedtls_ssl_conf_own_cert(&s_srv_conf, &s_srv_cert, &s_srv_key) != 0 ||
+        mbedtls_ssl_conf_alpn_protocols(&s_srv_conf, k_alpn) != 0) {
+        return false;
+    }
+    mbedtls_ssl_conf_rng(&s_srv_conf, mbedtls_ctr_drbg_random, &s_drbg);
+
+    return tls_trust_init(&s_trust_der, k_rsa_ca_der, sizeof(k_rsa_ca_der), NULL) &&
+           tls_trust_init(&s_trust_pin, NULL, 0, k_rsa_server_spki_sha256);
+}
+
+static void fixtures_free(void)
+{
+    tls_trust_free(&s_trust_der);
+    tls_trust_free(&s_trust_pin);
+    mbedtls_ssl_config_free(&s_srv_conf);
+    mbedtls_pk_free(&s_srv_key);
+    mbedtls_x509_crt_free(&s_srv_cert);
+    mbedtls_ctr_drbg_free(&s_drbg);
+    mbedtls_entropy_free(&s_entropy);
+    mbedtls_psa_crypto_free();
+}
+
+/* ── Trust setups ───────────────────────────────────────────────────────── */
+
+typedef enum { TRUST_PEM_PER_CONNECT, TRUST_DER_ONCE, TRUST_SPKI_PIN } trust_kind_t;
+
+typedef struct {
+    const char  *name;
+    trust_kind_t kind;
+} setup_t;
+
+static const setup_t k_setups[] = {
+    { "tls_handshake_pem_per_connect", TRUST_PEM_PER_CONNECT },
+    { "tls_handshake_der_parsed_once", TRUST_DER_ONCE },
+    { "tls_handshake_spki_pin",        TRUST_SPKI_PIN },
+};
+
+static int64_t cpu_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+typedef struct {
+    int64_t client_ns;
+    int64_t server_ns;
+} handshake_cost_t;
+
+/* One full handshake; false if it fails or the server is not verified. */
+static bool handshake(trust_kind_t kind, handshake_cost_t *cost)
+{
+    static pipe_t c2s;
+    static pipe_t s2c;
+    c2s.len = 0;
+    s2c.len = 0;
+    end_t cli_end = { &c2s, &s2c };
+    end_t srv_end = { &s2c, &c2s };
+
+    mbedtls_ssl_context srv;
+    mbedtls_ssl_init(&srv);
+    bool ok = mbedtls_ssl_setup(&srv, &s_srv_conf) == 0;
+    mbedtls_ssl_set_bio(&srv, &srv_end, pipe_send, pipe_recv, NULL);
+
+    /* Client setup is on the client's clock: it is per connect on the device. */
+    int64_t t0 = cpu_ns();
+    mbedtls_ssl_config  conf;
+    mbedtls_ssl_context cli;
+    mbedtls_x509_crt    pem_chain;
+    mbedtls_ssl_config_init(&conf);
+    mbedtls_ssl_init(&cli);
+    mbedtls_x509_crt_init(&pem_chain);
+    ok = ok && mbedtls_ssl_config_defaults(&conf, MBEDTLS_SSL_IS_CLIENT,
+                                           MBEDTLS_SSL_TRANSPORT_STREAM,
+                                           MBEDTLS_SSL_PRESET_DEFAULT) == 0;
+    mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &s_drbg);
+    mbedtls_ssl_conf_max_tls_version(&conf, MBEDTLS_SSL_VERSION_TLS1_2);
+    ok = ok && mbedtls_ssl_conf_alpn_protocols(&conf, k_alpn) == 0;
+    switch (kind) {
+    case TRUST_PEM_PER_CONNECT:
+        /* esp-tls: cacert_buf with its terminating NUL, parsed per connect. */
+        ok = ok && mbedtls_x509_crt_parse(&pem_chain,
+                                          reinterpret_cast<const unsigned char *>(k_rsa_ca_pem),
+                                          strlen(k_rsa_ca_pem) + 1) == 0;
+        mbedtls_ssl_conf_authmode(&conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+        mbedtls_ssl_conf_ca_chain(&conf, &pem_chain, NULL);
+        break;
+    case TRUST_DER_ONCE:
+        tls_trust_attach(&s_trust_der, &conf);
+        break;
+    case TRUST_SPKI_PIN:
+        tls_trust_attach(&s_trust_pin, &conf);
+        break;
+    }
+    ok = ok && mbedtls_ssl_setup(&cli, &conf) == 0 &&
+         mbedtls_ssl_set_hostname(&cli, TLS_FIXTURE_HOST) == 0;
+    mbedtls_ssl_set_bio(&cli, &cli_end, pipe_send, pipe_recv, NULL);
+    cost->client_ns = cpu_ns() - t0;
+    cost->server_ns = 0;
+
+    bool cli_done = false;
+    bool srv_done = false;
+    for (int round = 0; ok && (!cli_done || !srv_done); round++) {
+        if (round > 64) {
+            ok = false;
+            break;
+        }
+        if (!cli_done) {
+            t0 = cpu_ns();
+            int ret = mbedtls_ssl_handshake(&cli);
+            cost->client_ns += cpu_ns() - t0;
+            cli_done = (ret == 0);
+            ok = cli_done || ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE;
+        }
+        if (ok && !srv_done) {
+            t0 = cpu_ns();
+            int ret = mbedtls_ssl_handshake(&srv);
+            cost->server_ns += cpu_ns() - t0;
+            srv_done = (ret == 0);
+            ok = srv_done || ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE;
+        }
+    }
+    ok = ok && mbedtls_ssl_get_verify_result(&cli) == 0;
+
+    t0 = cpu_ns();
+    mbedtls_ssl_free(&cli);
+    mbedtls_ssl_config_free(&conf);
+    mbedtls_x509_crt_free(&pem_chain);
+    cost->client_ns += cpu_ns() - t0;
+    mbedtls_ssl_free(&srv);
+    return ok;
+}
+
+/* ── Runner ─────────────────────────────────────────────────────────────── */
+
+typedef struct {
+    double client_us;
+    double client_us_min;
+    double server_us;
+} result_t;
+
+static double median_us(int64_t *ns, int n)
+{
+    std::sort(ns, ns + n);
+    int64_t m = (n % 2) ? ns[n / 2] : (ns[n / 2 - 1] + ns[n / 2]) / 2;
+    return (double)m / 1000.0;
+}
+
+static bool run_setup(const setup_t *s, int n, result_t *out)
+{
+    int64_t *cli = static_cast<int64_t *>(calloc((size_t)n, sizeof(int64_t)));
+    int64_t *srv = static_cast<int64_t *>(calloc((size_t)n, sizeof(int64_t)));
+    bool ok = cli != NULL && srv != NULL;
+
+    handshake_cost_t warm;
+    ok = ok && handshake(s->kind, &warm);
+    for (int i = 0; ok && i < n; i++) {
+        handshake_cost_t c;
+        ok = handshake(s->kind, &c);
+        cli[i] = c.client_ns;
+        srv[i] = c.server_ns;
+    }
+    if (ok) {
+        out->client_us     = median_us(cli, n);
+        out->client_us_min = (double)cli[0] / 1000.0;
+        out->server_us     = median_us(srv, n);
+    }
+    free(cli);
+    free(srv);
+    return ok;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: bench_tls_handshake [--filter SUBSTR] [--handshakes N] [--quick]\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter = NULL;
+    int handshakes     = 200;
+
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        const char *v = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(a, "--quick") == 0) {
+            handshakes = 2;
+            continue;
+        }
+        if (v == NULL) {
+            usage();
+            return 2;
+        }
+        if (strcmp(a, "--filter") == 0) {
+            filter = v;
+        } else if (strcmp(a, "--handshakes") == 0) {
+            handshakes = (int)strtol(v, NULL, 10);
+        } else {
+            usage();
+            return 2;
+        }
+        i++;
+    }
+    if (handshakes < 1) {
+        handshakes = 1;
+    }
+
+    if (!fixtures_init()) {
+        fprintf(stderr, "fixture setup failed\n");
+        return 2;
+    }
+
+    bool   failed  = false;
+    double pem_us  = 0.0;
+    for (const setup_t &s : k_setups) {
+        if (filter != NULL && strstr(s.name, filter) == NULL) {
+            continue;
+        }
+        result_t r;
+        if (!run_setup(&s, handshakes, &r)) {
+            fprintf(stderr, "%s: handshake failed\n", s.name);
+            failed = true;
+            continue;
+        }
+        if (s.kind == TRUST_PEM_PER_CONNECT) {
+            pem_us = r.client_us;
+        }
+        printf("{\"bench\":\"%s\",\"handshakes\":%d,\"client_cpu_us\":%.1f,"
+               "\"client_cpu_us_min\":%.1f,\"server_cpu_us\":%.1f",
+               s.name, handshakes, r.client_us, r.client_us_min, r.server_us);
+        if (pem_us > 0.0) {
+            printf(",\"vs_pem_pct\":%.1f", (r.client_us / pem_us - 1.0) * 100.0);
+        }
+        printf("}\n");
+        fflush(stdout);
+    }
+
+    fixtures_free();
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,518 @@
+/* Tier A host benchmark: TLS handshake cost per transport profile.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig.  Links upstream mbedtls.
+ *
+ * A stand-in server runs in a child process on 127.0.0.1 (its own
+ * process, as PSA crypto is not thread-safe in the default mbedtls
+ * build), answering every connection with a handshake and nothing else.
+ * The client configures each connection as grpc_client's attach hook
+ * does: tls_profile_apply(), then the pre-parsed trust unless the profile
+ * uses a PSK.  Certificates come from tls_fixtures.h.
+ *
+ *   compat        RSA-2048 certificate, TLS 1.2: the device's default
+ *                 mbedTLS build under the compat profile
+ *   compat_ecdsa  the same with an ECDSA P-256 certificate
+ *   ecc           the ECC profile: TLS 1.3, AES-128-GCM, X25519, ECDSA
+ *   psk           the PSK profile, psk_ke: no certificates, no ECDHE
+ *   psk_dhe       the PSK profile with psk_dhe_ke (X25519)
+ *
+ * One JSON object per line on stdout:
+ *
+ *   {"bench":"tls_profile_ecc","handshakes":100,"latency_us":1830.2,
+ *    "latency_us_p90":1911.7,"client_cpu_us":905.1,"client_peak_heap_bytes":41320,
+ *    "version":"TLSv1.3","ciphersuite":"TLS1-3-AES-128-GCM-SHA256"}
+ *
+ * latency_us (median) runs from the TCP connect to the client's handshake
+ * completing, so it includes the server's work; client_cpu_us (median) is
+ * the client thread's CPU from config setup to teardown.  Peak heap is the
+ * client's largest live heap during a handshake, in malloc usable sizes
+ * (glibc only, else -1).  Host numbers rank the profiles; the device's
+ * absolute costs are higher, and it has AES and RSA hardware but no ECC.
+ *
+ * --quick runs two handshakes per profile; ctest uses it to check they
+ * all still complete.
+ */
+#include "tls_profile.hpp"
+#include "tls_trust.hpp"
+#include "tls_fixtures.h"
+
+#include "mbedtls/ctr_drbg.h"
+#include "mbedtls/entropy.h"
+#include "mbedtls/pk.h"
+#include "mbedtls/ssl.h"
+#include "mbedtls/x509_crt.h"
+#include "psa/crypto.h"
+
+#include <algorithm>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+/* ── Client heap tracking ───────────────────────────────────────────────── */
+
+static bool    s_track;
+static int64_t s_live;
+static int64_t s_peak;
+
+#if defined(__GLIBC__)
+extern "C" {
+void *__libc_malloc(size_t);
+void *__libc_calloc(size_t, size_t);
+void *__libc_realloc(void *, size_t);
+void  __libc_free(void *);
+
+static void note_alloc(void *p)
+{
+    if (s_track && p != NULL) {
+        s_live += (int64_t)malloc_usable_size(p);
+        s_peak  = std::max(s_peak, s_live);
+    }
+}
+static void note_free(void *p)
+{
+    if (s_track && p != NULL) {
+        s_live -= (int64_t)malloc_usable_size(p);
+    }
+}
+
+void *malloc(size_t n)            { void *p = __libc_malloc(n); note_alloc(p); return p; }
+void *calloc(size_t c, size_t n)  { void *p = __libc_calloc(c, n); note_alloc(p); return p; }
+void *realloc(void *p, size_t n)
+{
+    note_free(p);
+    void *q = __libc_realloc(p, n);
+    note_alloc(q != NULL ? q : p);
+    return q;
+}
+void  free(void *p)               { note_free(p); __libc_free(p); }
+}
+#endif
+
+static void heap_track_begin(void)
+{
+    s_live  = 0;
+    s_peak  = 0;
+    s_track = true;
+}
+
+static int64_t heap_track_end(void)
+{
+    s_track = false;
+#if defined(__GLIBC__)
+    return s_peak;
+#else
+    return -1;
+#endif
+}
+
+/* ── Socket I/O ─────────────────────────────────────────────────────────── */
+
+static int fd_send(void *ctx, const unsigned char *buf, size_t n)
+{
+    ssize_t r = send(*static_cast<int *>(ctx), buf, n, MSG_NOSIGNAL);
+    if (r < 0) {
+        return errno == EINTR ? MBEDTLS_ERR_SSL_WANT_WRITE : MBEDTLS_ERR_SSL_INTERNAL_ERROR;
+    }
+    return (int)r;
+}
+
+static int fd_recv(void *ctx, unsigned char *buf, size_t n)
+{
+    ssize_t r = recv(*static_cast<int *>(ctx), buf, n, 0);
+    if (r < 0) {
+        return errno == EINTR ? MBEDTLS_ERR_SSL_WANT_READ : MBEDTLS_ERR_SSL_INTERNAL_ERROR;
+    }
+    return (int)r;
+}
+
+/* Handshake messages go out as separate writes; without this, Nagle and
+ * delayed ACKs put 40 ms stalls into the latency. */
+static void no_delay(int fd)
+{
+    int one = 1;
+    setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+}
+
+static const char *k_alpn[] = { "h2", NULL };
+
+/* The module's PSK identity and key, as generate_certs.sh --psk issues them. */
+static const char    k_psk_identity[] = "door-001";
+static const uint8_t k_psk[32] = {
+    0x35, 0x26, 0x0d, 0x68, 0xd3, 0x16, 0xe4, 0x9f, 0xdd, 0x29, 0x27, 0x52,
+    0x28, 0x46, 0xa9, 0x37, 0x66, 0x61, 0xc6, 0xea, 0x94, 0x67, 0x45, 0x4f,
+    0x2c, 0x52, 0x3f, 0x20, 0x0f, 0xec, 0x3e, 0x03,
+};
+
+/* ── Stand-in server ────────────────────────────────────────────────────── */
+
+typedef enum { SERVER_RSA, SERVER_ECDSA, SERVER_PSK } server_kind_t;
+
+/* Per-module key lookup, as a PSK-terminating front end would do it. */
+static int server_psk(void *ctx, mbedtls_ssl_context *ssl, const unsigned char *id, size_t id_len)
+{
+    (void)ctx;
+    if (id_len != strlen(k_psk_identity) || memcmp(id, k_psk_identity, id_len) != 0) {
+        return -1;
+    }
+    return mbedtls_ssl_set_hs_psk(ssl, k_psk, sizeof(k_psk));
+}
+
+/* Child process: handshake every connection on @p lfd until killed. */
+static void serve(int lfd, server_kind_t kind)
+{
+    mbedtls_entropy_context  entropy;
+    mbedtls_ctr_drbg_context drbg;
+    mbedtls_x509_crt         cert;
+    mbedtls_pk_context       key;
+    mbedtls_ssl_config       conf;
+
+    mbedtls_entropy_init(&entropy);
+    mbedtls_ctr_drbg_init(&drbg);
+    mbedtls_x509_crt_init(&cert);
+    mbedtls_pk_init(&key);
+    mbedtls_ssl_config_init(&conf);
+
+    bool ok = psa_crypto_init() == PSA_SUCCESS &&
+              mbedtls_ctr_drbg_seed(&drbg, mbedtls_entropy_func, &entropy, NULL, 0) == 0 &&
+              mbedtls_ssl_config_defaults(&conf, MBEDTLS_SSL_IS_SERVER,
+                                          MBEDTLS_SSL_TRANSPORT_STREAM,
+                                          MBEDTLS_SSL_PRESET_DEFAULT) == 0 &&
+              mbedtls_ssl_conf_alpn_protocols(&conf, k_alpn) == 0;
+    mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &drbg);
+
+    if (kind == SERVER_PSK) {
+        mbedtls_ssl_conf_psk_cb(&conf, server_psk, NULL);
+    } else {
+        bool rsa = kind == SERVER_RSA;
+        ok = ok &&
+             mbedtls_x509_crt_parse_der(&cert, rsa ? k_rsa_server_der : k_ec_server_der,
+                                        rsa ? sizeof(k_rsa_server_der) : sizeof(k_ec_server_der)) == 0 &&
+             mbedtls_pk_parse_key(&key, rsa ? k_rsa_server_key_der : k_ec_server_key_der,
+                                  rsa ? sizeof(k_rsa_server_key_der) : sizeof(k_ec_server_key_der),
+                                  NULL, 0, mbedtls_ctr_drbg_random, &drbg) == 0 &&
+             mbedtls_ssl_conf_own_cert(&conf, &cert, &key) == 0;
+    }
+    if (!ok) {
+        fprintf(stderr, "stand-in server setup failed\n");
+        _exit(1);
+    }
+
+    for (;;) {
+        int fd = accept(lfd, NULL, NULL);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            _exit(1);
+        }
+        no_delay(fd);
+
+        mbedtls_ssl_context ssl;
+        mbedtls_ssl_init(&ssl);
+        int ret = mbedtls_ssl_setup(&ssl, &conf);
+        mbedtls_ssl_set_bio(&ssl, &fd, fd_send, fd_recv, NULL);
+        if (ret == 0) {
+            do {
+                ret = mbedtls_ssl_handshake(&ssl);
+            } while (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE);
+        }
+        if (ret == 0) {
+            /* Until the client's close_notify or EOF. */
+            unsigned char buf[64];
+            while (mbedtls_ssl_read(&ssl, buf, sizeof(buf)) > 0) {
+            }
+        }
+        mbedtls_ssl_free(&ssl);
+        close(fd);
+    }
+}
+
+typedef struct {
+    pid_t pid;
+    int   port;
+} server_t;
+
+static bool server_start(server_kind_t kind, server_t *out)
+{
+    int lfd = socket(AF_INET, SOCK_STREAM, 0);
+    if (lfd < 0) {
+        return false;
+    }
+    int one = 1;
+    setsockopt(lfd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    struct sockaddr_in addr = {};
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port        = 0;
+    socklen_t len = sizeof(addr);
+    if (bind(lfd, (struct sockaddr *)&addr, sizeof(addr)) != 0 || listen(lfd, 16) != 0 ||
+        getsockname(lfd, (struct sockaddr *)&addr, &len) != 0) {
+        close(lfd);
+        return false;
+    }
+
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        close(lfd);
+        return false;
+    }
+    if (pid == 0) {
+        serve(lfd, kind);
+    }
+    close(lfd);
+    out->pid  = pid;
+    out->port = ntohs(addr.sin_port);
+    return true;
+}
+
+static void server_stop(const server_t *s)
+{
+    kill(s->pid, SIGTERM);
+    waitpid(s->pid, NULL, 0);
+}
+
+/* ── Profiles ───────────────────────────────────────────────────────────── */
+
+typedef struct {
+    const char   *name;
+    tls_profile_t profile;
+    server_kind_t server;
+    bool          tls12_only;  /* the device's default mbedTLS build */
+} setup_t;
+
+static const setup_t k_setups[] = {
+    { "tls_profile_compat",       { TLS_PROFILE_COMPAT, NULL, 0, NULL, false }, SERVER_RSA,   true  },
+    { "tls_profile_compat_ecdsa", { TLS_PROFILE_COMPAT, NULL, 0, NULL, false }, SERVER_ECDSA, true  },
+    { "tls_profile_ecc",          { TLS_PROFILE_ECC,    NULL, 0, NULL, false }, SERVER_ECDSA, false },
+    { "tls_profile_psk",          { TLS_PROFILE_PSK, k_psk, sizeof(k_psk), k_psk_identity, false },
+      SERVER_PSK, false },
+    { "tls_profile_psk_dhe",      { TLS_PROFILE_PSK, k_psk, sizeof(k_psk), k_psk_identity, true },
+      SERVER_PSK, false },
+};
+
+/* ── Client ─────────────────────────────────────────────────────────────── */
+
+static mbedtls_entropy_context  s_entropy;
+static mbedtls_ctr_drbg_context s_drbg;
+static tls_trust_t              s_trust_rsa;
+static tls_trust_t              s_trust_ec;
+
+static bool client_init(void)
+{
+    mbedtls_entropy_init(&s_entropy);
+    mbedtls_ctr_drbg_init(&s_drbg);
+    return psa_crypto_init() == PSA_SUCCESS &&
+           mbedtls_ctr_drbg_seed(&s_drbg, mbedtls_entropy_func, &s_entropy, NULL, 0) == 0 &&
+           tls_trust_init(&s_trust_rsa, k_rsa_ca_der, sizeof(k_rsa_ca_der), NULL) &&
+           tls_trust_init(&s_trust_ec, k_ec_ca_der, sizeof(k_ec_ca_der), NULL);
+}
+
+static void client_free(void)
+{
+    tls_trust_free(&s_trust_rsa);
+    tls_trust_free(&s_trust_ec);
+    mbedtls_ctr_drbg_free(&s_drbg);
+    mbedtls_entropy_free(&s_entropy);
+    mbedtls_psa_crypto_free();
+}
+
+static int64_t clock_ns(clockid_t id)
+{
+    struct timespec ts;
+    clock_gettime(id, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+typedef struct {
+    int64_t latency_ns;
+    int64_t cpu_ns;
+    int64_t peak_heap;
+    char    version[16];
+    char    suite[64];
+} handshake_cost_t;
+
+/* One handshake to @p port; false if it fails or the server is not verified. */
+static bool handshake(const setup_t *s, int port, handshake_cost_t *cost)
+{
+    int64_t w0 = clock_ns(CLOCK_MONOTONIC);
+    int64_t c0 = clock_ns(CLOCK_THREAD_CPUTIME_ID);
+    heap_track_begin();
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    struct sockaddr_in addr = {};
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port        = htons((uint16_t)port);
+    bool ok = fd >= 0 && connect(fd, (struct sockaddr *)&addr, sizeof(addr)) == 0;
+    no_delay(fd);
+
+    mbedtls_ssl_config  conf;
+    mbedtls_ssl_context cli;
+    mbedtls_ssl_config_init(&conf);
+    mbedtls_ssl_init(&cli);
+    ok = ok && mbedtls_ssl_config_defaults(&conf, MBEDTLS_SSL_IS_CLIENT,
+                                           MBEDTLS_SSL_TRANSPORT_STREAM,
+                                           MBEDTLS_SSL_PRESET_DEFAULT) == 0;
+    mbedtls_ssl_conf_rng(&conf, mbedtls_ctr_drbg_random, &s_drbg);
+    ok = ok && mbedtls_ssl_conf_alpn_protocols(&conf, k_alpn) == 0;
+    if (s->tls12_only) {
+        mbedtls_ssl_conf_max_tls_version(&conf, MBEDTLS_SSL_VERSION_TLS1_2);
+    }
+    /* As grpc_client's transport_attach(). */
+    ok = ok && tls_profile_apply(&s->profile, &conf) == 0;
+    bool certs = !tls_profile_skips_certificates(&s->profile);
+    if (certs) {
+        tls_trust_attach(s->server == SERVER_RSA ? &s_trust_rsa : &s_trust_ec, &conf);
+    }
+    ok = ok && mbedtls_ssl_setup(&cli, &conf) == 0 &&
+         mbedtls_ssl_set_hostname(&cli, TLS_FIXTURE_HOST) == 0;
+    mbedtls_ssl_set_bio(&cli, &fd, fd_send, fd_recv, NULL);
+
+    int ret = ok ? MBEDTLS_ERR_SSL_WANT_READ : -1;
+    while (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) {
+        ret = mbedtls_ssl_handshake(&cli);
+    }
+    cost->latency_ns = clock_ns(CLOCK_MONOTONIC) - w0;
+    ok = ret == 0 && (!certs || mbedtls_ssl_get_verify_result(&cli) == 0);
+    if (ok) {
+        snprintf(cost->version, sizeof(cost->version), "%s", mbedtls_ssl_get_version(&cli));
+        snprintf(cost->suite, sizeof(cost->suite), "%s", mbedtls_ssl_get_ciphersuite(&cli));
+        mbedtls_ssl_close_notify(&cli);
+    }
+
+    mbedtls_ssl_free(&cli);
+    mbedtls_ssl_config_free(&conf);
+    if (fd >= 0) {
+        close(fd);
+    }
+    cost->cpu_ns    = clock_ns(CLOCK_THREAD_CPUTIME_ID) - c0;
+    cost->peak_heap = heap_track_end();
+    return ok;
+}
+
+/* ── Runner ─────────────────────────────────────────────────────────────── */
+
+typedef struct {
+    double  latency_us;
+    double  latency_us_p90;
+    double  cpu_us;
+    int64_t peak_heap;
+    char    version[16];
+    char    suite[64];
+} result_t;
+
+static double pct_us(int64_t *ns, int n, int pct)
+{
+    std::sort(ns, ns + n);
+    int i = (n - 1) * pct / 100;
+    return (double)ns[i] / 1000.0;
+}
+
+static bool run_setup(const setup_t *s, int n, result_t *out)
+{
+    server_t srv;
+    if (!server_start(s->server, &srv)) {
+        return false;
+    }
+    int64_t *lat = static_cast<int64_t *>(calloc((size_t)n, sizeof(int64_t)));
+    int64_t *cpu = static_cast<int64_t *>(calloc((size_t)n, sizeof(int64_t)));
+    bool ok = lat != NULL && cpu != NULL;
+
+    handshake_cost_t c;
+    ok = ok && handshake(s, srv.port, &c);             /* warm-up */
+    out->peak_heap = 0;
+    for (int i = 0; ok && i < n; i++) {
+        ok = handshake(s, srv.port, &c);
+        lat[i] = c.latency_ns;
+        cpu[i] = c.cpu_ns;
+        out->peak_heap = std::max(out->peak_heap, c.peak_heap);
+    }
+    if (ok) {
+        out->latency_us     = pct_us(lat, n, 50);
+        out->latency_us_p90 = pct_us(lat, n, 90);
+        out->cpu_us         = pct_us(cpu, n, 50);
+        snprintf(out->version, sizeof(out->version), "%s", c.version);
+        snprintf(out->suite, sizeof(out->suite), "%s", c.suite);
+    }
+    free(lat);
+    free(cpu);
+    server_stop(&srv);
+    return ok;
+}
+
+static void usage(void)
+{
+    fprintf(stderr, "usage: bench_tls_profiles [--filter SUBSTR] [--handshakes N] [--quick]\n");
+}
+
+int main(int argc, char **argv)
+{
+    const char *filter = NULL;
+    int handshakes     = 100;
+
+    for (int i = 1; i < argc; i++) {
+        const char *a = argv[i];
+        const char *v = i + 1 < argc ? argv[i + 1] : NULL;
+        if (strcmp(a, "--quick") == 0) {
+            handshakes = 2;
+            continue;
+        }
+        if (v == NULL) {
+            usage();
+            return 2;
+        }
+        if (strcmp(a, "--filter") == 0) {
+            filter = v;
+        } else if (strcmp(a, "--handshakes") == 0) {
+            handshakes = (int)strtol(v, NULL, 10);
+        } else {
+            usage();
+            return 2;
+        }
+        i++;
+    }
+    if (handshakes < 1) {
+        handshakes = 1;
+    }
+
+    if (!client_init()) {
+        fprintf(stderr, "client setup failed\n");
+        return 2;
+    }
+
+    bool failed = false;
+    for (const setup_t &s : k_setups) {
+        if (filter != NULL && strstr(s.name, filter) == NULL) {
+            continue;
+        }
+        result_t r;
+        if (!run_setup(&s, handshakes, &r)) {
+            fprintf(stderr, "%s: handshake failed\n", s.name);
+            failed = true;
+            continue;
+        }
+        printf("{\"bench\":\"%s\",\"handshakes\":%d,\"latency_us\":%.1f,\"latency_us_p90\":%.1f,"
+               "\"client_cpu_us\":%.1f,\"client_peak_heap_bytes\":%lld,"
+               "\"version\":\"%s\",\"ciphersuite\":\"%s\"}\n",
+               s.name, handshakes, r.latency_us, r.latency_us_p90, r.cpu_us,
+               (long long)r.peak_heap, r.version, r.suite);
+        fflush(stdout);
+    }
+
+    client_free();
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,100 @@
+#!/usr/bin/env python3
+"""Regenerate tls_fixtures.h: test CAs and server certificates for the host
+TLS tests and benchmarks.
+
+Same shape as scripts/generate_certs.sh (CA:TRUE pathlen:0, serverAuth
+leaf with a SAN), but for the fixed name "portunus.test" and valid
+2020-2100 so the fixtures never expire under a test.
+
+    python3 gen_tls_fixtures.py > tls_fixtures.h
+
+Requires the `cryptography` package.
+"""
+import datetime
+import hashlib
+
+from cryptography import x509
+from cryptography.hazmat.primitives import hashes, serialization
+from cryptography.hazmat.primitives.asymmetric import ec, rsa
+from cryptography.x509.oid import ExtendedKeyUsageOID, NameOID
+
+HOST = "portunus.test"
+NOT_BEFORE = datetime.datetime(2020, 1, 1, tzinfo=datetime.timezone.utc)
+NOT_AFTER = datetime.datetime(2100, 1, 1, tzinfo=datetime.timezone.utc)
+DER = serialization.Encoding.DER
+
+
+def name(cn):
+    return x509.Name([
+        x509.NameAttribute(NameOID.COUNTRY_NAME, "US"),
+        x509.NameAttribute(NameOID.ORGANIZATION_NAME, "Portunus"),
+        x509.NameAttribute(NameOID.COMMON_NAME, cn),
+    ])
+
+
+def cert(subject, issuer, pub, signer, serial, ca):
+    b = (x509.CertificateBuilder()
+         .subject_name(subject).issuer_name(issuer).public_key(pub)
+         .serial_number(serial)
+         .not_valid_before(NOT_BEFORE).not_valid_after(NOT_AFTER))
+    if ca:
+        b = (b.add_extension(x509.BasicConstraints(ca=True, path_length=0), critical=True)
+             .add_extension(x509.KeyUsage(False, False, False, False, False, True, True, False, False),
+                            critical=True))
+    else:
+        b = (b.add_extension(x509.BasicConstraints(ca=False, path_length=None), critical=False)
+             .add_extension(x509.ExtendedKeyUsage([ExtendedKeyUsageOID.SERVER_AUTH]), critical=False)
+             .add_extension(x509.SubjectAlternativeName([x509.DNSName(HOST)]), critical=False))
+    return b.sign(signer, hashes.SHA256())
+
+
+def c_bytes(ident, data):
+    lines = ["static const unsigned char %s[%d] = {" % (ident, len(data))]
+    for i in range(0, len(data), 12):
+        lines.append("    " + " ".join("0x%02x," % x for x in data[i:i + 12]))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def c_string(ident, text):
+    body = "\n".join('    "%s\\n"' % line for line in text.strip().splitlines())
+    return "static const char %s[] =\n%s;" % (ident, body)
+
+
+def family(prefix, new_key):
+    ca_key = new_key()
+    ca = cert(name("Portunus Test CA"), name("Portunus Test CA"),
+              ca_key.public_key(), ca_key, 1, True)
+    srv_key = new_key()
+    srv = cert(name(HOST), ca.subject, srv_key.public_key(), ca_key, 2, False)
+    spki = srv_key.public_key().public_bytes(DER, serialization.PublicFormat.SubjectPublicKeyInfo)
+    key_der = srv_key.private_bytes(DER, serialization.PrivateFormat.PKCS8,
+                                    serialization.NoEncryption())
+    return "\n\n".join([
+        c_bytes("k_%s_ca_der" % prefix, ca.public_bytes(DER)),
+        c_string("k_%s_ca_pem" % prefix, ca.public_bytes(serialization.Encoding.PEM).decode()),
+        c_bytes("k_%s_server_der" % prefix, srv.public_bytes(DER)),
+        c_bytes("k_%s_server_key_der" % prefix, key_der),
+        "/* SHA-256 of the server certificate's SubjectPublicKeyInfo. */\n" +
+        c_bytes("k_%s_server_spki_sha256" % prefix, hashlib.sha256(spki).digest()),
+    ])
+
+
+def main():
+    rsa2048 = lambda: rsa.generate_private_key(public_exponent=65537, key_size=2048)
+    p256 = lambda: ec.generate_private_key(ec.SECP256R1())
+    print("/* Generated by gen_tls_fixtures.py — do not edit. */")
+    print("#pragma once\n")
+    print('#define TLS_FIXTURE_HOST "%s"\n' % HOST)
+    print("/* RSA-2048, as scripts/generate_certs.sh issues them. */")
+    print(family("rsa", rsa2048))
+    print()
+    print("/* A second, unrelated CA and server: a server the module must not trust. */")
+    print(family("rogue", rsa2048))
+    print()
+    print("/* ECDSA P-256, as scripts/generate_certs.sh --key-type ecdsa issues them. */")
+    print(family("ec", p256))
+
+
+if __name__ == "__main__":
+    main()
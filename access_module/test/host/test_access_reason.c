@@ -0,0 +1,56 @@
+/* Tier A host test: access decision reason codes.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "access_reason.h"
+
+#include <string.h>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_server_codes_pass_through(void) {
+    TEST_ASSERT_EQUAL(ACCESS_REASON_CREDENTIAL_NOT_FOUND, access_reason_from_server(6));
+    TEST_ASSERT_EQUAL(ACCESS_REASON_AUTHORIZATION_EXPIRED, access_reason_from_server(13));
+}
+
+void test_unknown_server_code_is_unspecified(void) {
+    /* A newer server must not be able to name a module-local reason. */
+    TEST_ASSERT_EQUAL(ACCESS_REASON_UNSPECIFIED, access_reason_from_server(14));
+    TEST_ASSERT_EQUAL(ACCESS_REASON_UNSPECIFIED,
+                      access_reason_from_server(ACCESS_REASON_CACHED));
+}
+
+void test_names_match_server_strings(void) {
+    TEST_ASSERT_EQUAL_STRING("allow_all", access_reason_name(ACCESS_REASON_ALLOW_ALL));
+    TEST_ASSERT_EQUAL_STRING("credential_not_found",
+                             access_reason_name(ACCESS_REASON_CREDENTIAL_NOT_FOUND));
+    TEST_ASSERT_EQUAL_STRING("authorization_expired",
+                             access_reason_name(ACCESS_REASON_AUTHORIZATION_EXPIRED));
+}
+
+void test_module_names(void) {
+    TEST_ASSERT_EQUAL_STRING("cached", access_reason_name(ACCESS_REASON_CACHED));
+    TEST_ASSERT_EQUAL_STRING("stale", access_reason_name(ACCESS_REASON_STALE));
+    TEST_ASSERT_EQUAL_STRING("invalid_response_sig",
+                             access_reason_name(ACCESS_REASON_INVALID_RESPONSE_SIG));
+}
+
+void test_every_value_has_a_name(void) {
+    for (int r = 0; r <= ACCESS_REASON_INVALID_RESPONSE_SIG; r++) {
+        const char *name = access_reason_name((access_reason_t)r);
+        TEST_ASSERT_NOT_NULL(name);
+        TEST_ASSERT_TRUE(strlen(name) > 0);
+    }
+    TEST_ASSERT_EQUAL_STRING("unspecified", access_reason_name((access_reason_t)30));
+    TEST_ASSERT_EQUAL_STRING("unspecified", access_reason_name((access_reason_t)200));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_server_codes_pass_through);
+    RUN_TEST(test_unknown_server_code_is_unspecified);
+    RUN_TEST(test_names_match_server_strings);
+    RUN_TEST(test_module_names);
+    RUN_TEST(test_every_value_has_a_name);
+    return UNITY_END();
+}
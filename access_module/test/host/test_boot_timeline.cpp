@@ -0,0 +1,74 @@
+/* Tier A host test: boot phase timestamps.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "boot_timeline.hpp"
+
+#include <string.h>
+
+void setUp(void) { boot_timeline_reset(); }
+void tearDown(void) {}
+
+void test_unmarked_phases_read_zero(void) {
+    for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+        TEST_ASSERT_EQUAL_UINT32(0, boot_timeline_get((boot_phase_t)i));
+    }
+    TEST_ASSERT_FALSE(boot_timeline_complete());
+    TEST_ASSERT_EQUAL_UINT32(0, boot_timeline_ready_ms());
+}
+
+void test_first_mark_wins(void) {
+    /* A reconnect later in the boot must not move the first IP time. */
+    boot_timeline_mark(BOOT_PHASE_IP, 2150);
+    boot_timeline_mark(BOOT_PHASE_IP, 95000);
+    TEST_ASSERT_EQUAL_UINT32(2150, boot_timeline_get(BOOT_PHASE_IP));
+}
+
+void test_mark_at_zero_still_counts_as_reached(void) {
+    boot_timeline_mark(BOOT_PHASE_CONFIG, 0);
+    TEST_ASSERT_NOT_EQUAL(0, boot_timeline_get(BOOT_PHASE_CONFIG));
+}
+
+void test_ready_is_later_of_fsm_and_server(void) {
+    boot_timeline_mark(BOOT_PHASE_FSM, 495);
+    TEST_ASSERT_EQUAL_UINT32(0, boot_timeline_ready_ms());
+    boot_timeline_mark(BOOT_PHASE_SERVER, 2390);
+    TEST_ASSERT_EQUAL_UINT32(2390, boot_timeline_ready_ms());
+
+    /* Server reachable before the FSM ran (slow reader reset). */
+    boot_timeline_reset();
+    boot_timeline_mark(BOOT_PHASE_SERVER, 1800);
+    boot_timeline_mark(BOOT_PHASE_FSM, 2100);
+    TEST_ASSERT_EQUAL_UINT32(2100, boot_timeline_ready_ms());
+}
+
+void test_complete_needs_every_phase(void) {
+    for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+        TEST_ASSERT_FALSE(boot_timeline_complete());
+        boot_timeline_mark((boot_phase_t)i, 100u * (uint32_t)(i + 1));
+    }
+    TEST_ASSERT_TRUE(boot_timeline_complete());
+}
+
+void test_out_of_range_phase_is_ignored(void) {
+    boot_timeline_mark(BOOT_PHASE_COUNT, 10);
+    TEST_ASSERT_EQUAL_UINT32(0, boot_timeline_get(BOOT_PHASE_COUNT));
+    TEST_ASSERT_EQUAL_STRING("?", boot_phase_name(BOOT_PHASE_COUNT));
+}
+
+void test_every_phase_has_a_name(void) {
+    for (int i = 0; i < BOOT_PHASE_COUNT; i++) {
+        TEST_ASSERT_NOT_EQUAL(0, strcmp("?", boot_phase_name((boot_phase_t)i)));
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_unmarked_phases_read_zero);
+    RUN_TEST(test_first_mark_wins);
+    RUN_TEST(test_mark_at_zero_still_counts_as_reached);
+    RUN_TEST(test_ready_is_later_of_fsm_and_server);
+    RUN_TEST(test_complete_needs_every_phase);
+    RUN_TEST(test_out_of_range_phase_is_ignored);
+    RUN_TEST(test_every_phase_has_a_name);
+    return UNITY_END();
+}
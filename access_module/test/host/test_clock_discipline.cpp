@@ -0,0 +1,237 @@
+/* Tier A host test: clock discipline, plus a simulation with synthetic RTT
+ * jitter comparing it with the old step-on-every-heartbeat sync.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "clock_discipline.hpp"
+
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static const clock_discipline_config_t k_cfg = {
+    128000,             /* step over 128 ms */
+    120000000LL,        /* one sample per 2 min */
+    600000000LL,        /* fit drift once the window spans 10 min */
+    100,                /* crystal tolerance */
+    1000,               /* 1 ppm floor */
+};
+
+#define T0_US 1700000000000000LL
+
+/* ── Basics ─────────────────────────────────────────────────────────────── */
+
+void test_no_estimate_before_first_sample(void) {
+    clock_discipline_t c;
+    clock_discipline_init(&c, &k_cfg);
+    int64_t est, err;
+    TEST_ASSERT_FALSE(clock_discipline_now(&c, 0, &est, &err));
+}
+
+void test_first_sample_steps_to_midpoint(void) {
+    clock_discipline_t c;
+    clock_discipline_init(&c, &k_cfg);
+    /* Sent at 1 s, answered at 1.010 s; server said T0 + 5 ms. */
+    clock_correction_t k = clock_discipline_sample(&c, 1000000, 1010000, T0_US + 5000, 0);
+    TEST_ASSERT_EQUAL(CLOCK_CORRECT_STEP, k.kind);
+    /* At receive the server is 5 ms later than at the midpoint. */
+    TEST_ASSERT_EQUAL_INT64(T0_US + 10000, k.delta_us);
+
+    int64_t est, err;
+    TEST_ASSERT_TRUE(clock_discipline_now(&c, 1005000, &est, &err));
+    TEST_ASSERT_EQUAL_INT64(T0_US + 5000, est);
+    TEST_ASSERT_EQUAL_INT64(5001, err);
+}
+
+void test_small_error_is_slewed_large_is_stepped(void) {
+    clock_discipline_t c;
+    clock_discipline_init(&c, &k_cfg);
+    clock_correction_t k = clock_discipline_sample(&c, 0, 2000, T0_US, T0_US);
+    TEST_ASSERT_EQUAL(CLOCK_CORRECT_STEP, k.kind);
+
+    /* Wall 3 ms fast at the next exchange: slew. */
+    int64_t m = 60000000;
+    k = clock_discipline_sample(&c, m, m + 2000, T0_US + m + 1000, T0_US + m + 2000 + 3000);
+    TEST_ASSERT_EQUAL(CLOCK_CORRECT_SLEW, k.kind);
+    TEST_ASSERT_INT64_WITHIN(100, -3000, k.delta_us);
+
+    /* Wall 1 s fast: step. */
+    m = 120000000;
+    k = clock_discipline_sample(&c, m, m + 2000, T0_US + m + 1000, T0_US + m + 2000 + 1000000);
+    TEST_ASSERT_EQUAL(CLOCK_CORRECT_STEP, k.kind);
+}
+
+void test_bound_grows_with_age_at_crystal_tolerance(void) {
+    clock_discipline_t c;
+    clock_discipline_init(&c, &k_cfg);
+    clock_discipline_sample(&c, 0, 4000, T0_US, T0_US);
+    int64_t est, err;
+    clock_discipline_now(&c, 2000 + 10000000, &est, &err);   /* 10 s later */
+    TEST_ASSERT_EQUAL_INT64(2000 + 1000 + 1, err);           /* RTT/2 + 10 s x 100 ppm */
+}
+
+void test_tighter_sample_replaces_within_interval(void) {
+    clock_discipline_t c;
+    clock_discipline_init(&c, &k_cfg);
+    clock_discipline_sample(&c, 0, 40000, T0_US, T0_US);          /* 40 ms RTT */
+    clock_discipline_sample(&c, 10000000, 10002000, T0_US + 10000000 - 19000, T0_US);
+    TEST_ASSERT_EQUAL_UINT8(1, c.count);
+    TEST_ASSERT_EQUAL_INT64(2000, c.samples[0].rtt_us);
+    clock_discipline_sample(&c, 20000000, 20090000, T0_US + 20000000 - 19000, T0_US);
+    TEST_ASSERT_EQUAL_INT64(2000, c.samples[0].rtt_us);          /* slower one dropped */
+    clock_discipline_sample(&c, 130000000, 130002000, T0_US + 130000000 - 19000, T0_US);
+    TEST_ASSERT_EQUAL_UINT8(2, c.count);                          /* next interval */
+}
+
+void test_server_clock_step_restarts_window(void) {
+    clock_discipline_t c;
+    clock_discipline_init(&c, &k_cfg);
+    for (int i = 0; i < 5; i++) {
+        int64_t m = (int64_t)i * 120000000LL;
+        clock_discipline_sample(&c, m, m + 2000, T0_US + m + 1000, T0_US + m);
+    }
+    TEST_ASSERT_EQUAL_UINT8(5, c.count);
+    int64_t m = 5 * 120000000LL;
+    clock_discipline_sample(&c, m, m + 2000, T0_US + m + 1000 + 3600000000LL, T0_US + m);
+    TEST_ASSERT_EQUAL_UINT32(1, c.restarts);
+    TEST_ASSERT_EQUAL_UINT8(1, c.count);
+}
+
+void test_drift_is_learned(void) {
+    clock_discipline_t c;
+    clock_discipline_init(&c, &k_cfg);
+    /* Monotonic runs 40 ppm fast against the server; clean 2 ms RTTs. */
+    for (int i = 0; i < 16; i++) {
+        int64_t m = (int64_t)i * 120000000LL;
+        int64_t server = T0_US + (int64_t)((double)(m + 1000) * (1.0 - 40e-6));
+        clock_discipline_sample(&c, m, m + 2000, server, server);
+    }
+    TEST_ASSERT_TRUE(c.drift_known);
+    TEST_ASSERT_INT64_WITHIN(2000, -40000, c.drift_ppb);
+    TEST_ASSERT_TRUE(c.drift_err_ppb < 10000);
+}
+
+/* ── Simulation ─────────────────────────────────────────────────────────── */
+
+static uint64_t s_rng = 0x9E3779B97F4A7C15ULL;
+
+static double uniform(void) {
+    s_rng ^= s_rng << 13; s_rng ^= s_rng >> 7; s_rng ^= s_rng << 17;
+    return (double)(s_rng >> 11) / 9007199254740992.0;
+}
+
+/* One-way delay in µs: 1.5 ms wire + exponential queueing (mean 3 ms), and
+   one packet in 20 caught behind a 50-300 ms stall (Wi-Fi retries, a
+   power-save beacon) — on either leg independently, so RTTs are
+   asymmetric exactly when they are large. */
+static double one_way_us(void) {
+    double d = 1500.0 - 3000.0 * log(1.0 - uniform());
+    if (uniform() < 0.05) {
+        d += 50000.0 + 250000.0 * uniform();
+    }
+    return d;
+}
+
+static int cmp_double(const void *a, const void *b) {
+    double x = *(const double *)a, y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static double pct(double *v, size_t n, double p) {
+    return v[(size_t)(p * (double)(n - 1))];
+}
+
+/* Six hours of a module whose crystal runs 40 ppm fast: a heartbeat every
+   10 s and a tap about once a minute, all with jittered RTTs.  Once a
+   second the timestamp a tap would carry is compared with the true server
+   time, for the disciplined estimate and for the old sync (step to
+   server_time + RTT/2 on every heartbeat, then free-run). */
+void test_simulation_offset_error_distribution(void) {
+    const double drift = 40e-6;
+    const int64_t hours = 6, heartbeat_us = 10000000, tap_mean_us = 60000000;
+    const size_t n_q = (size_t)(hours * 3600);
+
+    clock_discipline_t c;
+    clock_discipline_init(&c, &k_cfg);
+    double *err_new = (double *)malloc(n_q * sizeof(double));
+    double *err_old = (double *)malloc(n_q * sizeof(double));
+    double *bounds  = (double *)malloc(n_q * sizeof(double));
+    size_t covered = 0, q = 0;
+
+    /* True time t (µs from start).  Server = T0 + t; mono = t * (1 + drift). */
+    double old_base_server = 0, old_base_mono = 0;
+    bool old_synced = false;
+    double next_hb = 0, next_tap = 5e6, next_q = 60e6;   /* first minute: warm-up */
+    const double end = (double)hours * 3600e6;
+
+    for (double t = 0; t < end;) {
+        double next_rpc = next_hb < next_tap ? next_hb : next_tap;
+        if (next_q <= next_rpc) {
+            t = next_q;
+            next_q += 1e6;
+            double mono = t * (1.0 + drift);
+            double truth = (double)T0_US + t;
+            int64_t est, bound;
+            if (q < n_q && clock_discipline_now(&c, (int64_t)mono, &est, &bound) && old_synced) {
+                double e_new = (double)est - truth;
+                double e_old = old_base_server + (mono - old_base_mono) - truth;
+                err_new[q] = fabs(e_new);
+                err_old[q] = fabs(e_old);
+                bounds[q]  = (double)bound;
+                covered   += fabs(e_new) <= (double)bound;
+                q++;
+            }
+            continue;
+        }
+
+        bool is_hb = next_hb <= next_tap;
+        t = next_rpc;
+        if (is_hb) {
+            next_hb += (double)heartbeat_us;
+        } else {
+            next_tap += -(double)tap_mean_us * log(1.0 - uniform());
+        }
+
+        double fwd = one_way_us(), back = one_way_us();
+        double sent_mono = t * (1.0 + drift);
+        double server_us = (double)T0_US + t + fwd;
+        double recv_t = t + fwd + back;
+        double recv_mono = recv_t * (1.0 + drift);
+
+        clock_discipline_sample(&c, (int64_t)sent_mono, (int64_t)recv_mono,
+                                (int64_t)server_us, 0);
+        if (is_hb) {
+            old_base_server = server_us + (recv_mono - sent_mono) / 2.0;
+            old_base_mono   = recv_mono;
+            old_synced      = true;
+        }
+    }
+
+    qsort(err_new, q, sizeof(double), cmp_double);
+    qsort(err_old, q, sizeof(double), cmp_double);
+    qsort(bounds, q, sizeof(double), cmp_double);
+    /* Drift learned to within its own error bar (server time per mono tick). */
+    TEST_ASSERT_INT64_WITHIN(c.drift_err_ppb, -40000, c.drift_ppb);
+    TEST_ASSERT_EQUAL_size_t(q, covered);
+    TEST_ASSERT_TRUE(pct(err_new, q, 0.5) < pct(err_old, q, 0.5));
+    TEST_ASSERT_TRUE(pct(err_new, q, 0.99) < pct(err_old, q, 0.99));
+    TEST_ASSERT_TRUE(err_new[q - 1] < err_old[q - 1]);
+    free(err_new);
+    free(err_old);
+    free(bounds);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_no_estimate_before_first_sample);
+    RUN_TEST(test_first_sample_steps_to_midpoint);
+    RUN_TEST(test_small_error_is_slewed_large_is_stepped);
+    RUN_TEST(test_bound_grows_with_age_at_crystal_tolerance);
+    RUN_TEST(test_tighter_sample_replaces_within_interval);
+    RUN_TEST(test_server_clock_step_restarts_window);
+    RUN_TEST(test_drift_is_learned);
+    RUN_TEST(test_simulation_offset_error_distribution);
+    return UNITY_END();
+}
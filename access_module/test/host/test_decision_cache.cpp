@@ -0,0 +1,236 @@
+/* Tier A host test: access decision cache.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "decision_cache.hpp"
+
+#include <string.h>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void key_for(uint32_t member, uint8_t key[DECISION_CACHE_KEY_LEN]) {
+    memset(key, 0, DECISION_CACHE_KEY_LEN);
+    memcpy(key, &member, sizeof(member));
+}
+
+/* ── Lookup / insert ────────────────────────────────────────────────────── */
+
+void test_miss_then_hit_within_ttl(void) {
+    decision_cache_t c;
+    decision_cache_init(&c, 8);
+    uint8_t k[DECISION_CACHE_KEY_LEN];
+    key_for(1, k);
+
+    TEST_ASSERT_FALSE(decision_cache_lookup(&c, k, 1000));
+    TEST_ASSERT_TRUE(decision_cache_insert(&c, k, 60000, 7, 1000));
+    TEST_ASSERT_TRUE(decision_cache_lookup(&c, k, 60999));
+    TEST_ASSERT_FALSE(decision_cache_lookup(&c, k, 61000));
+
+    TEST_ASSERT_EQUAL_UINT32(1, c.stats.hits);
+    TEST_ASSERT_EQUAL_UINT32(2, c.stats.misses);
+}
+
+void test_zero_ttl_or_capacity_stores_nothing(void) {
+    decision_cache_t c;
+    uint8_t k[DECISION_CACHE_KEY_LEN];
+    key_for(1, k);
+
+    decision_cache_init(&c, 8);
+    TEST_ASSERT_FALSE(decision_cache_insert(&c, k, 0, 7, 0));
+    TEST_ASSERT_FALSE(decision_cache_lookup(&c, k, 0));
+
+    decision_cache_init(&c, 0);
+    TEST_ASSERT_FALSE(decision_cache_insert(&c, k, 60000, 7, 0));
+    TEST_ASSERT_FALSE(decision_cache_lookup(&c, k, 0));
+    /* A disabled cache does not count misses either. */
+    TEST_ASSERT_EQUAL_UINT32(0, c.stats.misses);
+}
+
+void test_capacity_is_clamped(void) {
+    decision_cache_t c;
+    decision_cache_init(&c, 200);
+    TEST_ASSERT_EQUAL_UINT8(DECISION_CACHE_MAX_ENTRIES, c.capacity);
+}
+
+void test_reinsert_refreshes_ttl(void) {
+    decision_cache_t c;
+    decision_cache_init(&c, 2);
+    uint8_t k[DECISION_CACHE_KEY_LEN];
+    key_for(1, k);
+
+    decision_cache_insert(&c, k, 1000, 7, 0);
+    decision_cache_insert(&c, k, 1000, 7, 900);
+    TEST_ASSERT_TRUE(decision_cache_lookup(&c, k, 1500));
+    TEST_ASSERT_EQUAL_UINT32(0, c.stats.evictions);
+}
+
+/* ── Eviction ───────────────────────────────────────────────────────────── */
+
+void test_full_cache_evicts_least_recently_used(void) {
+    decision_cache_t c;
+    decision_cache_init(&c, 3);
+    uint8_t k1[DECISION_CACHE_KEY_LEN], k2[DECISION_CACHE_KEY_LEN];
+    uint8_t k3[DECISION_CACHE_KEY_LEN], k4[DECISION_CACHE_KEY_LEN];
+    key_for(1, k1); key_for(2, k2); key_for(3, k3); key_for(4, k4);
+
+    decision_cache_insert(&c, k1, 60000, 7, 0);
+    decision_cache_insert(&c, k2, 60000, 7, 0);
+    decision_cache_insert(&c, k3, 60000, 7, 0);
+    TEST_ASSERT_TRUE(decision_cache_lookup(&c, k1, 10));   /* k2 is now oldest */
+
+    decision_cache_insert(&c, k4, 60000, 7, 20);
+    TEST_ASSERT_EQUAL_UINT32(1, c.stats.evictions);
+    TEST_ASSERT_TRUE(decision_cache_lookup(&c, k1, 30));
+    TEST_ASSERT_FALSE(decision_cache_lookup(&c, k2, 30));
+    TEST_ASSERT_TRUE(decision_cache_lookup(&c, k3, 30));
+    TEST_ASSERT_TRUE(decision_cache_lookup(&c, k4, 30));
+}
+
+void test_expired_entry_is_reused_before_eviction(void) {
+    decision_cache_t c;
+    decision_cache_init(&c, 2);
+    uint8_t k1[DECISION_CACHE_KEY_LEN], k2[DECISION_CACHE_KEY_LEN], k3[DECISION_CACHE_KEY_LEN];
+    key_for(1, k1); key_for(2, k2); key_for(3, k3);
+
+    decision_cache_insert(&c, k1, 60000, 7, 0);
+    decision_cache_insert(&c, k2, 1000, 7, 0);   /* expires first, but is newer */
+    decision_cache_insert(&c, k3, 60000, 7, 5000);
+
+    TEST_ASSERT_EQUAL_UINT32(0, c.stats.evictions);
+    TEST_ASSERT_TRUE(decision_cache_lookup(&c, k1, 5000));
+    TEST_ASSERT_TRUE(decision_cache_lookup(&c, k3, 5000));
+}
+
+/* ── Invalidation ───────────────────────────────────────────────────────── */
+
+void test_remove_drops_entry_and_counts(void) {
+    decision_cache_t c;
+    decision_cache_init(&c, 4);
+    uint8_t k[DECISION_CACHE_KEY_LEN];
+    key_for(1, k);
+
+    decision_cache_insert(&c, k, 60000, 7, 0);
+    TEST_ASSERT_TRUE(decision_cache_remove(&c, k));
+    TEST_ASSERT_FALSE(decision_cache_remove(&c, k));
+    TEST_ASSERT_FALSE(decision_cache_lookup(&c, k, 1));
+    TEST_ASSERT_EQUAL_UINT32(1, c.stats.invalidations);
+}
+
+void test_version_change_drops_everything(void) {
+    decision_cache_t c;
+    decision_cache_init(&c, 4);
+    uint8_t k1[DECISION_CACHE_KEY_LEN], k2[DECISION_CACHE_KEY_LEN];
+    key_for(1, k1); key_for(2, k2);
+
+    decision_cache_insert(&c, k1, 60000, 7, 0);
+    decision_cache_insert(&c, k2, 60000, 7, 0);
+
+    TEST_ASSERT_EQUAL_UINT32(0, decision_cache_set_version(&c, 7));
+    TEST_ASSERT_EQUAL_UINT32(0, decision_cache_set_version(&c, 0));
+    TEST_ASSERT_EQUAL_UINT32(2, decision_cache_set_version(&c, 8));
+    TEST_ASSERT_FALSE(decision_cache_lookup(&c, k1, 1));
+    TEST_ASSERT_FALSE(decision_cache_lookup(&c, k2, 1));
+    TEST_ASSERT_EQUAL_UINT32(2, c.stats.invalidations);
+}
+
+void test_first_version_seen_keeps_entries(void) {
+    decision_cache_t c;
+    decision_cache_init(&c, 4);
+    uint8_t k[DECISION_CACHE_KEY_LEN];
+    key_for(1, k);
+
+    decision_cache_insert(&c, k, 60000, 0, 0);   /* server sent no version */
+    TEST_ASSERT_EQUAL_UINT32(0, decision_cache_set_version(&c, 7));
+    TEST_ASSERT_TRUE(decision_cache_lookup(&c, k, 1));
+}
+
+void test_grant_from_older_version_is_refused(void) {
+    /* A heartbeat already reported a revocation (version 8); an answer
+       decided before it (version 7) must not re-open the cache. */
+    decision_cache_t c;
+    decision_cache_init(&c, 4);
+    uint8_t k[DECISION_CACHE_KEY_LEN];
+    key_for(1, k);
+
+    decision_cache_set_version(&c, 8);
+    TEST_ASSERT_FALSE(decision_cache_insert(&c, k, 60000, 7, 0));
+    TEST_ASSERT_FALSE(decision_cache_lookup(&c, k, 1));
+}
+
+void test_grant_from_newer_version_adopts_it(void) {
+    decision_cache_t c;
+    decision_cache_init(&c, 4);
+    uint8_t k1[DECISION_CACHE_KEY_LEN], k2[DECISION_CACHE_KEY_LEN];
+    key_for(1, k1); key_for(2, k2);
+
+    decision_cache_insert(&c, k1, 60000, 7, 0);
+    TEST_ASSERT_TRUE(decision_cache_insert(&c, k2, 60000, 8, 0));
+    TEST_ASSERT_EQUAL_UINT32(8, c.version);
+    TEST_ASSERT_FALSE(decision_cache_lookup(&c, k1, 1));
+    TEST_ASSERT_TRUE(decision_cache_lookup(&c, k2, 1));
+}
+
+void test_version_compare_survives_wrap(void) {
+    decision_cache_t c;
+    decision_cache_init(&c, 4);
+    uint8_t k[DECISION_CACHE_KEY_LEN];
+    key_for(1, k);
+
+    decision_cache_set_version(&c, 0xFFFFFFFEu);
+    TEST_ASSERT_TRUE(decision_cache_insert(&c, k, 60000, 2, 0));
+    TEST_ASSERT_EQUAL_UINT32(2, c.version);
+}
+
+/* ── Busy door ──────────────────────────────────────────────────────────── */
+
+/* 40 members; each comes through in a burst of 1..4 taps spread over
+   under a minute (carts, tools), bursts a few minutes apart.  With a 60 s
+   TTL every tap after the first in a burst should be local. */
+void test_busy_door_hit_rate(void) {
+    decision_cache_t c;
+    decision_cache_init(&c, 16);
+
+    uint32_t lcg = 4242;
+    int64_t now_ms = 0;
+    uint32_t taps = 0, repeats = 0;
+    for (int burst = 0; burst < 500; burst++) {
+        lcg = lcg * 1103515245u + 12345u;
+        uint32_t member = (lcg >> 8) % 40;
+        uint32_t n = 1 + (lcg >> 20) % 4;
+        uint8_t k[DECISION_CACHE_KEY_LEN];
+        key_for(member, k);
+
+        for (uint32_t i = 0; i < n; i++) {
+            taps++;
+            if (!decision_cache_lookup(&c, k, now_ms)) {
+                decision_cache_insert(&c, k, 60000, 1, now_ms);
+            }
+            if (i > 0) {
+                repeats++;
+            }
+            now_ms += 5000 + (int64_t)((lcg >> 4) % 10000);
+        }
+        now_ms += 60000 + (int64_t)((lcg >> 12) % 240000);
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(taps, c.stats.hits + c.stats.misses);
+    TEST_ASSERT_EQUAL_UINT32(repeats, c.stats.hits);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_miss_then_hit_within_ttl);
+    RUN_TEST(test_zero_ttl_or_capacity_stores_nothing);
+    RUN_TEST(test_capacity_is_clamped);
+    RUN_TEST(test_reinsert_refreshes_ttl);
+    RUN_TEST(test_full_cache_evicts_least_recently_used);
+    RUN_TEST(test_expired_entry_is_reused_before_eviction);
+    RUN_TEST(test_remove_drops_entry_and_counts);
+    RUN_TEST(test_version_change_drops_everything);
+    RUN_TEST(test_first_version_seen_keeps_entries);
+    RUN_TEST(test_grant_from_older_version_is_refused);
+    RUN_TEST(test_grant_from_newer_version_adopts_it);
+    RUN_TEST(test_version_compare_survives_wrap);
+    RUN_TEST(test_busy_door_hit_rate);
+    return UNITY_END();
+}
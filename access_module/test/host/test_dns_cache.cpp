@@ -0,0 +1,229 @@
+/* Tier A host test: server address cache and background refresh.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler.
+ *
+ * A stub resolver stands in for lwIP's DNS: it answers a query after a
+ * configurable delay (or never), on a simulated clock, the way a slow LAN
+ * DNS server would.  connect_lookup() does what grpc_client does before a
+ * connect: start a refresh if one is due, then take whatever is cached. */
+#include "unity.h"
+#include "dns_cache.hpp"
+
+#define A1  0x0a00000au
+#define A2  0x0b00000au
+#define A3  0x0c00000au
+#define A4  0x0d00000au
+#define A5  0x0e00000au
+
+typedef struct {
+    uint32_t delay_ms;      /* answer this long after the query */
+    bool     fail;          /* answer NXDOMAIN / SERVFAIL */
+    bool     silent;        /* never answer */
+    uint32_t next_addr;     /* what the next answer carries */
+    bool     pending;
+    int64_t  answer_at_ms;
+    uint32_t queries;
+} stub_resolver_t;
+
+static dns_cache_t     c;
+static stub_resolver_t dns;
+
+void setUp(void) {
+    dns_cache_config_t cfg;
+    dns_cache_default_config(&cfg);
+    dns_cache_init(&c, &cfg);
+    dns = stub_resolver_t{};
+    dns.delay_ms  = 50;
+    dns.next_addr = A1;
+}
+void tearDown(void) {}
+
+/* Deliver the stub's answer if it is due by @p now_ms. */
+static void run_resolver(int64_t now_ms) {
+    if (!dns.pending || dns.silent || now_ms < dns.answer_at_ms) {
+        return;
+    }
+    dns.pending = false;
+    if (dns.fail) {
+        dns_cache_resolve_failed(&c, dns.answer_at_ms);
+    } else {
+        dns_cache_resolved(&c, dns.answer_at_ms, dns.next_addr);
+    }
+}
+
+/* Before a connect: kick a refresh if due, then look up without waiting. */
+static size_t connect_lookup(int64_t now_ms, uint32_t *out) {
+    run_resolver(now_ms);
+    if (dns_cache_refresh_due(&c, now_ms)) {
+        dns_cache_resolve_started(&c, now_ms);
+        dns.pending      = true;
+        dns.answer_at_ms = now_ms + dns.delay_ms;
+        dns.queries++;
+    }
+    return dns_cache_lookup(&c, now_ms, out, DNS_CACHE_MAX_ADDRS);
+}
+
+void test_cold_start_waits_for_the_first_answer(void) {
+    uint32_t out[DNS_CACHE_MAX_ADDRS];
+    TEST_ASSERT_EQUAL_UINT32(0, connect_lookup(0, out));
+    TEST_ASSERT_EQUAL_UINT32(0, connect_lookup(30, out));     /* still in flight */
+    TEST_ASSERT_EQUAL_UINT32(1, dns.queries);
+
+    TEST_ASSERT_EQUAL_UINT32(1, connect_lookup(50, out));
+    TEST_ASSERT_EQUAL_HEX32(A1, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(50, c.stats.last_resolve_ms);
+}
+
+void test_cached_address_is_used_without_a_query(void) {
+    uint32_t out[DNS_CACHE_MAX_ADDRS];
+    connect_lookup(0, out);
+    run_resolver(50);
+    for (int64_t t = 1000; t < 200000; t += 10000) {
+        TEST_ASSERT_EQUAL_UINT32(1, connect_lookup(t, out));
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, dns.queries);
+}
+
+void test_slow_dns_refreshes_behind_the_tap_path(void) {
+    uint32_t out[DNS_CACHE_MAX_ADDRS];
+    connect_lookup(0, out);
+    run_resolver(50);
+
+    /* Past three quarters of the TTL the next connect starts a refresh,
+       and a 4 s DNS answer does not hold up that connect or the next. */
+    dns.delay_ms = 4000;
+    TEST_ASSERT_EQUAL_UINT32(1, connect_lookup(226000, out));
+    TEST_ASSERT_EQUAL_UINT32(2, dns.queries);
+    TEST_ASSERT_EQUAL_UINT32(1, connect_lookup(228000, out));
+    TEST_ASSERT_EQUAL_UINT32(2, dns.queries);
+
+    /* The answer renews the address before it expires. */
+    run_resolver(230000);
+    TEST_ASSERT_EQUAL_UINT32(1, connect_lookup(500000, out));
+    TEST_ASSERT_EQUAL_UINT32(0, c.stats.stale_uses);
+    TEST_ASSERT_EQUAL_UINT32(4000, c.stats.last_resolve_ms);
+}
+
+void test_dns_down_falls_back_to_the_last_good_address(void) {
+    uint32_t out[DNS_CACHE_MAX_ADDRS];
+    connect_lookup(0, out);
+    run_resolver(50);
+    dns_cache_connected(&c, A1);
+
+    dns.fail = true;
+    connect_lookup(230000, out);                    /* refresh fails */
+    run_resolver(230050);
+    TEST_ASSERT_EQUAL_UINT32(1, connect_lookup(400000, out));
+    TEST_ASSERT_EQUAL_HEX32(A1, out[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, c.stats.stale_uses);
+    TEST_ASSERT_TRUE(c.stats.failures >= 1);
+}
+
+void test_without_fallback_an_expired_address_is_not_used(void) {
+    dns_cache_config_t cfg;
+    dns_cache_default_config(&cfg);
+    cfg.stale_fallback = false;
+    dns_cache_init(&c, &cfg);
+
+    uint32_t out[DNS_CACHE_MAX_ADDRS];
+    connect_lookup(0, out);
+    run_resolver(50);
+    dns.fail = true;
+    TEST_ASSERT_EQUAL_UINT32(0, connect_lookup(301000, out));
+    TEST_ASSERT_TRUE(c.stats.misses > 0);
+}
+
+void test_failed_resolve_is_not_retried_at_once(void) {
+    uint32_t out[DNS_CACHE_MAX_ADDRS];
+    dns.fail = true;
+    connect_lookup(0, out);
+    run_resolver(50);
+    connect_lookup(1000, out);
+    connect_lookup(4000, out);
+    TEST_ASSERT_EQUAL_UINT32(1, dns.queries);
+    connect_lookup(5100, out);
+    TEST_ASSERT_EQUAL_UINT32(2, dns.queries);
+}
+
+void test_silent_dns_times_out(void) {
+    uint32_t out[DNS_CACHE_MAX_ADDRS];
+    dns.silent = true;
+    connect_lookup(0, out);
+    connect_lookup(14000, out);
+    TEST_ASSERT_EQUAL_UINT32(1, dns.queries);
+    TEST_ASSERT_EQUAL_UINT32(0, c.stats.failures);
+
+    /* Timed out at 15 s; the retry delay starts from there. */
+    connect_lookup(15000, out);
+    TEST_ASSERT_EQUAL_UINT32(1, c.stats.failures);
+    TEST_ASSERT_EQUAL_UINT32(1, dns.queries);
+    connect_lookup(20000, out);
+    TEST_ASSERT_EQUAL_UINT32(2, dns.queries);
+}
+
+void test_round_robin_answers_collect_and_the_good_one_leads(void) {
+    uint32_t out[DNS_CACHE_MAX_ADDRS];
+    dns_cache_resolved(&c, 0, A1);
+    dns_cache_resolved(&c, 10, A2);
+    dns_cache_resolved(&c, 20, A3);
+    dns_cache_connected(&c, A2);
+
+    TEST_ASSERT_EQUAL_UINT32(3, dns_cache_lookup(&c, 100, out, DNS_CACHE_MAX_ADDRS));
+    TEST_ASSERT_EQUAL_HEX32(A2, out[0]);
+    TEST_ASSERT_EQUAL_HEX32(A3, out[1]);        /* then the most recently seen */
+    TEST_ASSERT_EQUAL_HEX32(A1, out[2]);
+}
+
+void test_an_address_that_fails_to_connect_goes_last(void) {
+    uint32_t out[DNS_CACHE_MAX_ADDRS];
+    dns_cache_resolved(&c, 0, A1);
+    dns_cache_resolved(&c, 10, A2);
+    dns_cache_connect_failed(&c, A2);
+
+    dns_cache_lookup(&c, 100, out, DNS_CACHE_MAX_ADDRS);
+    TEST_ASSERT_EQUAL_HEX32(A1, out[0]);
+    TEST_ASSERT_EQUAL_HEX32(A2, out[1]);
+
+    dns_cache_connected(&c, A2);                /* it came back */
+    dns_cache_lookup(&c, 100, out, DNS_CACHE_MAX_ADDRS);
+    TEST_ASSERT_EQUAL_HEX32(A2, out[0]);
+}
+
+void test_full_cache_drops_the_oldest_but_keeps_the_good_one(void) {
+    uint32_t out[DNS_CACHE_MAX_ADDRS];
+    dns_cache_resolved(&c, 0, A1);
+    dns_cache_connected(&c, A1);
+    dns_cache_resolved(&c, 10, A2);
+    dns_cache_resolved(&c, 20, A3);
+    dns_cache_resolved(&c, 30, A4);
+    dns_cache_resolved(&c, 40, A5);             /* A2 goes */
+
+    TEST_ASSERT_EQUAL_UINT32(4, dns_cache_lookup(&c, 100, out, DNS_CACHE_MAX_ADDRS));
+    TEST_ASSERT_EQUAL_HEX32(A1, out[0]);
+    for (int i = 0; i < 4; i++) {
+        TEST_ASSERT_TRUE(out[i] != A2);
+    }
+}
+
+void test_only_fresh_addresses_while_any_are_fresh(void) {
+    uint32_t out[DNS_CACHE_MAX_ADDRS];
+    dns_cache_resolved(&c, 0, A1);
+    dns_cache_resolved(&c, 200000, A2);
+    TEST_ASSERT_EQUAL_UINT32(1, dns_cache_lookup(&c, 350000, out, DNS_CACHE_MAX_ADDRS));
+    TEST_ASSERT_EQUAL_HEX32(A2, out[0]);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_cold_start_waits_for_the_first_answer);
+    RUN_TEST(test_cached_address_is_used_without_a_query);
+    RUN_TEST(test_slow_dns_refreshes_behind_the_tap_path);
+    RUN_TEST(test_dns_down_falls_back_to_the_last_good_address);
+    RUN_TEST(test_without_fallback_an_expired_address_is_not_used);
+    RUN_TEST(test_failed_resolve_is_not_retried_at_once);
+    RUN_TEST(test_silent_dns_times_out);
+    RUN_TEST(test_round_robin_answers_collect_and_the_good_one_leads);
+    RUN_TEST(test_an_address_that_fails_to_connect_goes_last);
+    RUN_TEST(test_full_cache_drops_the_oldest_but_keeps_the_good_one);
+    RUN_TEST(test_only_fresh_addresses_while_any_are_fresh);
+    return UNITY_END();
+}
@@ -0,0 +1,198 @@
+/* Tier A host test: per-task health report.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "health_stats.hpp"
+
+#include <string.h>
+
+static health_stats_t       h;
+static health_report_t      r;
+static health_task_sample_t t[HEALTH_MAX_TASKS];
+static size_t               n;
+
+void setUp(void) {
+    health_stats_init(&h);
+    memset(t, 0, sizeof(t));
+    n = 0;
+}
+void tearDown(void) {}
+
+static health_task_sample_t *task(const char *name, uint32_t number, uint32_t stack_free) {
+    health_task_sample_t *s = &t[n++];
+    strncpy(s->name, name, sizeof(s->name) - 1);
+    s->number           = number;
+    s->stack_free_bytes = stack_free;
+    s->core             = -1;
+    s->priority         = 5;
+    return s;
+}
+
+/* Five tasks on two cores: IDLE0/IDLE1, and three with varied headroom. */
+static void five_tasks(void) {
+    task("IDLE0", 1, 800)->idle = true;
+    task("IDLE1", 2, 800)->idle = true;
+    task("reactor", 3, 1200);
+    task("server_comm", 4, 400);
+    task("wifi", 5, 2000);
+}
+
+static void run(uint32_t total, bool detailed, size_t compact) {
+    health_stats_update(&h, t, n, total, 2, detailed, compact, &r);
+}
+
+void test_first_sample_has_no_cpu_shares(void) {
+    five_tasks();
+    t[2].run_time = 5000;
+    run(10000, false, 4);
+    TEST_ASSERT_FALSE(r.cpu_valid);
+    TEST_ASSERT_EQUAL_UINT32(5, r.task_count);
+    TEST_ASSERT_EQUAL_UINT16(0, r.idle_permille);
+    /* Without CPU shares every slot goes to stack headroom. */
+    TEST_ASSERT_EQUAL_UINT8(3, r.n_tasks);
+    TEST_ASSERT_EQUAL_STRING("server_comm", r.tasks[0].name);
+    TEST_ASSERT_EQUAL_STRING("reactor", r.tasks[1].name);
+    TEST_ASSERT_EQUAL_STRING("wifi", r.tasks[2].name);
+}
+
+void test_cpu_share_is_over_the_interval_and_all_cores(void) {
+    five_tasks();
+    run(0, true, 4);
+
+    /* 1000 µs of wall time on 2 cores: 2000 µs of CPU. */
+    t[0].run_time = 900;   /* IDLE0 */
+    t[1].run_time = 500;   /* IDLE1 */
+    t[2].run_time = 100;   /* reactor */
+    t[3].run_time = 500;   /* server_comm */
+    run(1000, true, 4);
+
+    TEST_ASSERT_TRUE(r.cpu_valid);
+    TEST_ASSERT_TRUE(r.detailed);
+    TEST_ASSERT_EQUAL_UINT8(5, r.n_tasks);
+    TEST_ASSERT_EQUAL_UINT16(450, r.tasks[0].cpu_permille);
+    TEST_ASSERT_EQUAL_UINT16(250, r.tasks[1].cpu_permille);
+    TEST_ASSERT_EQUAL_UINT16(50, r.tasks[2].cpu_permille);
+    TEST_ASSERT_EQUAL_UINT16(250, r.tasks[3].cpu_permille);
+    TEST_ASSERT_EQUAL_UINT16(0, r.tasks[4].cpu_permille);
+    TEST_ASSERT_EQUAL_UINT16(700, r.idle_permille);
+
+    /* The next interval counts only what ran since. */
+    t[3].run_time = 500 + 1000;
+    run(2000, true, 4);
+    TEST_ASSERT_EQUAL_UINT16(500, r.tasks[3].cpu_permille);
+    TEST_ASSERT_EQUAL_UINT16(0, r.tasks[2].cpu_permille);
+}
+
+void test_counter_wrap_is_one_interval(void) {
+    task("spinner", 7, 1000)->run_time = 0xFFFFFF00u;
+    run(0xFFFFFF00u, true, 4);
+
+    t[0].run_time = 0x00000100u;   /* ran 0x200 */
+    run(0x00000300u, true, 4);     /* 0x400 elapsed */
+    TEST_ASSERT_EQUAL_UINT16(250, r.tasks[0].cpu_permille);
+}
+
+void test_new_task_counts_from_its_creation(void) {
+    five_tasks();
+    run(0, true, 8);
+
+    task("ota", 9, 3000)->run_time = 400;   /* created during the interval */
+    run(1000, true, 8);
+    TEST_ASSERT_EQUAL_UINT8(6, r.n_tasks);
+    TEST_ASSERT_EQUAL_STRING("ota", r.tasks[5].name);
+    TEST_ASSERT_EQUAL_UINT16(200, r.tasks[5].cpu_permille);
+}
+
+void test_task_number_not_name_identifies_a_task(void) {
+    task("worker", 3, 1000)->run_time = 900;
+    run(0, true, 4);
+
+    /* The worker exited and a new one of the same name started. */
+    t[0].number   = 4;
+    t[0].run_time = 100;
+    run(1000, true, 4);
+    TEST_ASSERT_EQUAL_UINT16(50, r.tasks[0].cpu_permille);
+}
+
+void test_compact_names_least_headroom_then_busiest(void) {
+    five_tasks();
+    task("reader", 6, 3000);
+    run(0, false, 4);
+
+    t[0].run_time = 1000;  /* IDLE0: busiest of all, never named */
+    t[2].run_time = 10;    /* reactor */
+    t[4].run_time = 300;   /* wifi */
+    t[5].run_time = 200;   /* reader */
+    run(1000, false, 4);
+
+    TEST_ASSERT_FALSE(r.detailed);
+    TEST_ASSERT_EQUAL_UINT32(6, r.task_count);
+    TEST_ASSERT_EQUAL_UINT8(4, r.n_tasks);
+    TEST_ASSERT_EQUAL_STRING("server_comm", r.tasks[0].name);  /* 400 B free */
+    TEST_ASSERT_EQUAL_STRING("reactor", r.tasks[1].name);      /* 1200 B free */
+    TEST_ASSERT_EQUAL_STRING("wifi", r.tasks[2].name);         /* 150 ‰ */
+    TEST_ASSERT_EQUAL_UINT16(150, r.tasks[2].cpu_permille);
+    TEST_ASSERT_EQUAL_STRING("reader", r.tasks[3].name);       /* 100 ‰ */
+    TEST_ASSERT_EQUAL_UINT16(500, r.idle_permille);
+}
+
+void test_compact_of_zero_names_no_task(void) {
+    five_tasks();
+    run(0, false, 0);
+    TEST_ASSERT_EQUAL_UINT8(0, r.n_tasks);
+    TEST_ASSERT_EQUAL_UINT32(5, r.task_count);
+}
+
+void test_long_names_stay_terminated(void) {
+    health_task_sample_t *s = task("", 1, 100);
+    memset(s->name, 'x', sizeof(s->name));
+    run(0, true, 4);
+    TEST_ASSERT_EQUAL_UINT32(HEALTH_TASK_NAME_LEN - 1, strlen(r.tasks[0].name));
+}
+
+void test_empty_sample_keeps_previous_counters(void) {
+    five_tasks();
+    run(0, true, 4);
+
+    /* The task list could not be read at 1000: nothing to report. */
+    health_stats_update(&h, t, 0, 1000, 2, true, 4, &r);
+    TEST_ASSERT_FALSE(r.cpu_valid);
+    TEST_ASSERT_EQUAL_UINT32(0, r.task_count);
+    TEST_ASSERT_EQUAL_UINT8(0, r.n_tasks);
+
+    /* The next sample spans both intervals. */
+    t[3].run_time = 1000;
+    run(2000, true, 4);
+    TEST_ASSERT_TRUE(r.cpu_valid);
+    TEST_ASSERT_EQUAL_UINT16(250, r.tasks[3].cpu_permille);
+}
+
+void test_more_tasks_than_fit_are_truncated(void) {
+    five_tasks();
+    while (n < HEALTH_MAX_TASKS) {
+        task("worker", (uint32_t)n + 1, 1000);
+    }
+    health_stats_update(&h, t, HEALTH_MAX_TASKS + 6, 0, 2, true, 4, &r);
+    TEST_ASSERT_TRUE(r.detailed);
+    TEST_ASSERT_EQUAL_UINT32(HEALTH_MAX_TASKS + 6, r.task_count);
+    TEST_ASSERT_EQUAL_UINT8(HEALTH_MAX_TASKS, r.n_tasks);
+
+    t[3].run_time = 500;
+    health_stats_update(&h, t, HEALTH_MAX_TASKS + 6, 1000, 2, true, 4, &r);
+    TEST_ASSERT_TRUE(r.cpu_valid);
+    TEST_ASSERT_EQUAL_UINT16(250, r.tasks[3].cpu_permille);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_first_sample_has_no_cpu_shares);
+    RUN_TEST(test_cpu_share_is_over_the_interval_and_all_cores);
+    RUN_TEST(test_counter_wrap_is_one_interval);
+    RUN_TEST(test_new_task_counts_from_its_creation);
+    RUN_TEST(test_task_number_not_name_identifies_a_task);
+    RUN_TEST(test_compact_names_least_headroom_then_busiest);
+    RUN_TEST(test_compact_of_zero_names_no_task);
+    RUN_TEST(test_long_names_stay_terminated);
+    RUN_TEST(test_empty_sample_keeps_previous_counters);
+    RUN_TEST(test_more_tasks_than_fit_are_truncated);
+    return UNITY_END();
+}
@@ -0,0 +1,361 @@
+/* Tier A host test: heartbeat pacing, plus a one-day simulation of a
+ * door's heartbeat traffic with and without it, and of a building's
+ * modules coming back from a power cut with and without jitter.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "heartbeat_pacer.hpp"
+#include "jitter.h"
+
+#include <math.h>
+#include <string.h>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static const heartbeat_pacer_config_t k_cfg = {10000, 60000};
+
+static heartbeat_pacer_t started_pacer(void) {
+    heartbeat_pacer_t p;
+    heartbeat_pacer_init(&p, &k_cfg);
+    TEST_ASSERT_TRUE(heartbeat_pacer_due(&p, 0));
+    heartbeat_pacer_sent(&p, 0, true, 100, 30, 0);
+    return p;
+}
+
+/* Send every due tick from @p t_ms up to @p end_ms; return how many went. */
+static int run_ticks(heartbeat_pacer_t *p, int64_t t_ms, int64_t end_ms) {
+    int sent = 0;
+    for (; t_ms <= end_ms; t_ms += k_cfg.base_ms) {
+        if (heartbeat_pacer_due(p, t_ms)) {
+            heartbeat_pacer_sent(p, t_ms, true, 80, 30, 20);
+            sent++;
+        }
+    }
+    return sent;
+}
+
+/* ── Behaviour ──────────────────────────────────────────────────────────── */
+
+void test_first_tick_sends(void) {
+    heartbeat_pacer_t p;
+    heartbeat_pacer_init(&p, &k_cfg);
+    TEST_ASSERT_TRUE(heartbeat_pacer_due(&p, 123));
+}
+
+void test_interval_doubles_to_max_when_healthy(void) {
+    heartbeat_pacer_t p = started_pacer();
+    TEST_ASSERT_EQUAL_UINT32(20000, p.interval_ms);
+    TEST_ASSERT_FALSE(heartbeat_pacer_due(&p, 10000));
+    TEST_ASSERT_TRUE(heartbeat_pacer_due(&p, 20000));
+    heartbeat_pacer_sent(&p, 20000, true, 80, 30, 20);
+    TEST_ASSERT_EQUAL_UINT32(40000, p.interval_ms);
+    heartbeat_pacer_sent(&p, 60000, true, 80, 30, 20);
+    TEST_ASSERT_EQUAL_UINT32(60000, p.interval_ms);
+    heartbeat_pacer_sent(&p, 120000, true, 80, 30, 20);
+    TEST_ASSERT_EQUAL_UINT32(60000, p.interval_ms);
+}
+
+void test_other_rpcs_defer_the_heartbeat(void) {
+    heartbeat_pacer_t p = started_pacer();                 /* due at 20 s */
+    heartbeat_pacer_note_rpc(&p, 25000);                   /* a tap */
+    TEST_ASSERT_FALSE(heartbeat_pacer_due(&p, 20000));
+    TEST_ASSERT_FALSE(heartbeat_pacer_due(&p, 30000));
+    TEST_ASSERT_TRUE(heartbeat_pacer_due(&p, 40000));      /* nearest tick to tap + 20 s */
+}
+
+void test_busy_door_still_heartbeats_every_max(void) {
+    heartbeat_pacer_t p = started_pacer();
+    int sent = 0;
+    for (int64_t t = 10000; t <= 600000; t += 10000) {
+        heartbeat_pacer_note_rpc(&p, t - 1000);           /* a tap before every tick */
+        if (heartbeat_pacer_due(&p, t)) {
+            heartbeat_pacer_sent(&p, t, true, 80, 30, 20);
+            sent++;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(10, sent);                        /* once a minute */
+}
+
+void test_anomaly_sends_at_once_and_resets_interval(void) {
+    heartbeat_pacer_t p = started_pacer();
+    run_ticks(&p, 10000, 300000);
+    TEST_ASSERT_EQUAL_UINT32(60000, p.interval_ms);
+
+    heartbeat_pacer_note_anomaly(&p);
+    TEST_ASSERT_TRUE(heartbeat_pacer_due(&p, 310000));
+    heartbeat_pacer_sent(&p, 310000, true, 100, 30, 0);
+    TEST_ASSERT_EQUAL_UINT32(20000, p.interval_ms);
+    TEST_ASSERT_EQUAL_UINT32(1, p.stats.anomalies);
+}
+
+void test_unanswered_heartbeat_retries_at_base(void) {
+    heartbeat_pacer_t p = started_pacer();
+    run_ticks(&p, 10000, 300000);
+    TEST_ASSERT_TRUE(heartbeat_pacer_due(&p, 360000));
+    heartbeat_pacer_sent(&p, 360000, false, 80, 0, 20);
+    TEST_ASSERT_TRUE(heartbeat_pacer_due(&p, 370000));
+}
+
+void test_max_below_base_is_clamped(void) {
+    heartbeat_pacer_config_t cfg = {10000, 5000};
+    heartbeat_pacer_t p;
+    heartbeat_pacer_init(&p, &cfg);
+    TEST_ASSERT_EQUAL_UINT32(10000, p.cfg.max_ms);
+    heartbeat_pacer_sent(&p, 0, true, 100, 30, 0);
+    TEST_ASSERT_TRUE(heartbeat_pacer_due(&p, 10000));       /* every tick, as before */
+}
+
+void test_savings_are_counted(void) {
+    heartbeat_pacer_t p = started_pacer();                 /* 100 + 30 bytes */
+    TEST_ASSERT_FALSE(heartbeat_pacer_due(&p, 10000));
+    TEST_ASSERT_EQUAL_UINT32(1, p.stats.skipped);
+    TEST_ASSERT_EQUAL_UINT32(130, p.stats.bytes_saved);
+    heartbeat_pacer_sent(&p, 20000, true, 80, 30, 20);      /* static fields omitted */
+    TEST_ASSERT_EQUAL_UINT32(150, p.stats.bytes_saved);
+}
+
+void test_server_delay_pushes_the_schedule_back(void) {
+    heartbeat_pacer_t p = started_pacer();                 /* due at 20 s */
+    heartbeat_pacer_defer(&p, 30000);
+    TEST_ASSERT_FALSE(heartbeat_pacer_due(&p, 20000));
+    TEST_ASSERT_FALSE(heartbeat_pacer_due(&p, 40000));
+    TEST_ASSERT_TRUE(heartbeat_pacer_due(&p, 50000));
+    heartbeat_pacer_sent(&p, 50000, true, 80, 30, 20);
+    TEST_ASSERT_EQUAL_UINT32(0, p.defer_ms);               /* one round only */
+}
+
+void test_server_delay_holds_anomalies_and_is_capped(void) {
+    heartbeat_pacer_t p = started_pacer();
+    heartbeat_pacer_defer(&p, 30000);
+    heartbeat_pacer_note_anomaly(&p);
+    TEST_ASSERT_FALSE(heartbeat_pacer_due(&p, 10000));
+    TEST_ASSERT_TRUE(heartbeat_pacer_due(&p, 30000));
+
+    heartbeat_pacer_defer(&p, 3600000);
+    TEST_ASSERT_EQUAL_UINT32(k_cfg.max_ms, p.defer_ms);
+}
+
+/* ── One day ────────────────────────────────────────────────────────────── */
+
+static uint64_t s_rng = 0x2545F4914F6CDD1DULL;
+
+static double uniform(void) {
+    s_rng ^= s_rng << 13; s_rng ^= s_rng >> 7; s_rng ^= s_rng << 17;
+    return (double)(s_rng >> 11) / 9007199254740992.0;
+}
+
+/* Payload sizes from protoc --encode of a representative door heartbeat:
+   today's full request 99 bytes, with the pacing counters 111 (85 with
+   static_omitted), response 27. */
+#define REQ_TODAY      99
+#define REQ_FULL       111
+#define REQ_DELTA      85
+#define RESP           27
+
+/* A door on the default 10 s tick with the default 60 s ceiling: 300
+   taps between 07:00 and 19:00, a reconnect every 6 hours, one reader
+   fault and recovery. */
+void test_one_day_of_heartbeats(void) {
+    const int64_t day_ms = 24LL * 3600 * 1000;
+    heartbeat_pacer_t p;
+    heartbeat_pacer_init(&p, &k_cfg);
+
+    double next_tap_ms = 7.0 * 3600e3;
+    int64_t next_reconnect_ms = 6LL * 3600 * 1000;
+    bool static_acked = false;
+    uint32_t rpcs = 0, taps = 0, bytes = 0;
+
+    for (int64_t t = 0; t < day_ms; t += k_cfg.base_ms) {
+        while (next_tap_ms < (double)t) {
+            heartbeat_pacer_note_rpc(&p, (int64_t)next_tap_ms);
+            taps++;
+            next_tap_ms += -(12.0 * 3600e3 / 300.0) * log(1.0 - uniform());
+            if (next_tap_ms > 19.0 * 3600e3 && next_tap_ms < 31.0 * 3600e3) {
+                next_tap_ms = 31.0 * 3600e3;
+            }
+        }
+        if (t >= next_reconnect_ms) {
+            heartbeat_pacer_note_anomaly(&p);
+            next_reconnect_ms += 6LL * 3600 * 1000;
+        }
+        if (t == 14LL * 3600 * 1000 || t == 14LL * 3600 * 1000 + 300000) {
+            heartbeat_pacer_note_anomaly(&p);       /* reader fault, recovery */
+        }
+
+        if (!heartbeat_pacer_due(&p, t)) {
+            continue;
+        }
+        uint32_t req = static_acked ? REQ_DELTA : REQ_FULL;
+        heartbeat_pacer_sent(&p, t, true, req, RESP, static_acked ? REQ_FULL - REQ_DELTA : 0);
+        static_acked = true;
+        rpcs++;
+        bytes += req + RESP;
+    }
+
+    uint32_t ticks = (uint32_t)(day_ms / k_cfg.base_ms);
+    uint32_t bytes_today = ticks * (REQ_TODAY + RESP);
+    TEST_ASSERT_TRUE(taps > 250);
+    TEST_ASSERT_EQUAL_UINT32(ticks - rpcs, p.stats.skipped);
+    TEST_ASSERT_TRUE(rpcs < ticks / 5);                /* at least 80% fewer */
+    TEST_ASSERT_TRUE(rpcs >= (uint32_t)(day_ms / k_cfg.max_ms));
+    TEST_ASSERT_TRUE(bytes < bytes_today / 5);
+    /* The pacer counts a skipped tick at a full exchange, and the static
+       fields every delta heartbeat left out. */
+    TEST_ASSERT_EQUAL_UINT32((ticks - rpcs) * (REQ_FULL + RESP) + (rpcs - 1) * (REQ_FULL - REQ_DELTA),
+                             p.stats.bytes_saved);
+}
+
+/* ── Power cut ──────────────────────────────────────────────────────── */
+
+static uint32_t rnd32(void) {
+    return (uint32_t)(uniform() * 4294967296.0);
+}
+
+/* What the server does: service.HeartbeatPacing at 100/s, 1 s burst. */
+typedef struct {
+    int64_t next_ms;
+} server_pacing_t;
+
+static uint32_t server_delay_ms(server_pacing_t *s, int64_t now_ms) {
+    if (s->next_ms < now_ms) {
+        s->next_ms = now_ms;
+    }
+    int64_t ahead_ms = s->next_ms - now_ms;
+    s->next_ms += 10;
+    return ahead_ms <= 1000 ? 0 : (uint32_t)ahead_ms;
+}
+
+#define FLEET        2000
+#define AP_UP_MS     20000      /* the AP takes longer to boot than the modules */
+#define AP_ADMITS    20         /* associations the AP completes per 100 ms */
+#define SIM_MS       600000
+
+typedef struct {
+    int64_t  assoc_ms;          /* next association attempt, -1 once connected */
+    uint32_t failures;
+    int64_t  tick_ms;           /* next heartbeat_service tick */
+    heartbeat_pacer_t pacer;
+} sim_module_t;
+
+typedef struct {
+    uint32_t assoc_peak_100ms;
+    uint32_t hb_peak_100ms;
+    uint32_t hb_peak_1s;
+    int64_t  all_connected_ms;  /* -1: not within SIM_MS */
+    uint32_t connected_at_60s;
+} fleet_result_t;
+
+/* Every module boots within a second of the power coming back.  Without
+   jitter that is the whole spread the fleet ever gets: WiFi retries back
+   off on the same schedule, heartbeat_service ticks from boot, and the
+   server's heartbeat_delay_ms is ignored. */
+static fleet_result_t power_cut(bool jitter) {
+    static sim_module_t m[FLEET];
+    static uint16_t hb_per_100ms[SIM_MS / 100];
+    server_pacing_t server = {0};
+    fleet_result_t r = {0, 0, 0, -1, 0};
+    memset(hb_per_100ms, 0, sizeof(hb_per_100ms));
+
+    for (int i = 0; i < FLEET; i++) {
+        int64_t boot_ms = (int64_t)(uniform() * 1000.0);
+        m[i].assoc_ms = boot_ms;
+        m[i].failures = 0;
+        m[i].tick_ms = boot_ms + (jitter ? k_cfg.base_ms - jitter_phase_ms(k_cfg.base_ms, rnd32())
+                                         : k_cfg.base_ms);
+        heartbeat_pacer_init(&m[i].pacer, &k_cfg);
+    }
+
+    uint32_t connected = 0;
+    for (int64_t slot_ms = 0; slot_ms < SIM_MS; slot_ms += 100) {
+        uint32_t attempts = 0, admitted = 0;
+        for (int i = 0; i < FLEET; i++) {
+            if (m[i].assoc_ms < 0 || m[i].assoc_ms >= slot_ms + 100) {
+                continue;
+            }
+            attempts++;
+            if (slot_ms >= AP_UP_MS && admitted < AP_ADMITS) {
+                admitted++;
+                connected++;
+                m[i].assoc_ms = -1;
+                continue;
+            }
+            m[i].failures++;
+            uint32_t base = 1000u << (m[i].failures - 1 < 6 ? m[i].failures - 1 : 6);
+            if (base > 60000) {
+                base = 60000;
+            }
+            m[i].assoc_ms += jitter ? jitter_equal_ms(base, rnd32()) : base;
+        }
+        if (slot_ms >= AP_UP_MS && attempts > r.assoc_peak_100ms) {
+            r.assoc_peak_100ms = attempts;
+        }
+        if (slot_ms == 60000) {
+            r.connected_at_60s = connected;
+        }
+        if (connected == FLEET && r.all_connected_ms < 0) {
+            r.all_connected_ms = slot_ms;
+        }
+
+        for (int i = 0; i < FLEET; i++) {
+            while (m[i].tick_ms < slot_ms + 100) {
+                int64_t t = m[i].tick_ms;
+                m[i].tick_ms += k_cfg.base_ms;
+                if (m[i].assoc_ms >= 0 || !heartbeat_pacer_due(&m[i].pacer, t)) {
+                    continue;
+                }
+                heartbeat_pacer_sent(&m[i].pacer, t, true, REQ_FULL, RESP, 0);
+                uint32_t delay_ms = server_delay_ms(&server, t);
+                if (jitter && delay_ms > 0) {
+                    heartbeat_pacer_defer(&m[i].pacer, delay_ms);
+                }
+                hb_per_100ms[t / 100]++;
+            }
+        }
+    }
+
+    uint32_t second = 0;
+    for (int b = 0; b < SIM_MS / 100; b++) {
+        if (hb_per_100ms[b] > r.hb_peak_100ms) {
+            r.hb_peak_100ms = hb_per_100ms[b];
+        }
+        second += hb_per_100ms[b];
+        if (b >= 10) {
+            second -= hb_per_100ms[b - 10];
+        }
+        if (second > r.hb_peak_1s) {
+            r.hb_peak_1s = second;
+        }
+    }
+    return r;
+}
+
+/* 2000 modules, the AP back 20 s after them and completing 200
+   associations a second, the server pacing heartbeats to 100 a second. */
+void test_power_cut_fleet_spreads_out(void) {
+    fleet_result_t before = power_cut(false);
+    fleet_result_t after = power_cut(true);
+
+    TEST_ASSERT_TRUE(after.all_connected_ms >= 0);
+    TEST_ASSERT_TRUE(after.connected_at_60s >= before.connected_at_60s);
+    TEST_ASSERT_TRUE(before.all_connected_ms < 0 || after.all_connected_ms < before.all_connected_ms);
+    TEST_ASSERT_TRUE(after.assoc_peak_100ms * 4 <= before.assoc_peak_100ms);
+    TEST_ASSERT_TRUE(after.hb_peak_100ms * 4 <= before.hb_peak_100ms);
+    TEST_ASSERT_TRUE(after.hb_peak_1s * 2 <= before.hb_peak_1s);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_first_tick_sends);
+    RUN_TEST(test_interval_doubles_to_max_when_healthy);
+    RUN_TEST(test_other_rpcs_defer_the_heartbeat);
+    RUN_TEST(test_busy_door_still_heartbeats_every_max);
+    RUN_TEST(test_anomaly_sends_at_once_and_resets_interval);
+    RUN_TEST(test_unanswered_heartbeat_retries_at_base);
+    RUN_TEST(test_max_below_base_is_clamped);
+    RUN_TEST(test_savings_are_counted);
+    RUN_TEST(test_server_delay_pushes_the_schedule_back);
+    RUN_TEST(test_server_delay_holds_anomalies_and_is_capped);
+    RUN_TEST(test_one_day_of_heartbeats);
+    RUN_TEST(test_power_cut_fleet_spreads_out);
+    return UNITY_END();
+}
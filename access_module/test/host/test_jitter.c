@@ -0,0 +1,58 @@
+/* Tier A host test: jittered delays.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "jitter.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_phase_spans_the_period(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, jitter_phase_ms(10000, 0));
+    TEST_ASSERT_EQUAL_UINT32(5000, jitter_phase_ms(10000, 0x80000000u));
+    TEST_ASSERT_EQUAL_UINT32(9999, jitter_phase_ms(10000, 0xFFFFFFFFu));
+    TEST_ASSERT_EQUAL_UINT32(0, jitter_phase_ms(0, 0xFFFFFFFFu));
+}
+
+void test_phase_is_uniform(void) {
+    /* Every word in a full sweep of the top bits lands in its own bucket. */
+    unsigned buckets[10] = {0};
+    for (uint32_t i = 0; i < 1000; i++) {
+        buckets[jitter_phase_ms(10, (uint32_t)((((uint64_t)i << 32) + 999) / 1000))]++;
+    }
+    for (int b = 0; b < 10; b++) {
+        TEST_ASSERT_EQUAL_UINT(100, buckets[b]);
+    }
+}
+
+void test_equal_jitter_keeps_half(void) {
+    TEST_ASSERT_EQUAL_UINT32(5000, jitter_equal_ms(10000, 0));
+    TEST_ASSERT_EQUAL_UINT32(10000, jitter_equal_ms(10000, 0xFFFFFFFFu));
+    TEST_ASSERT_EQUAL_UINT32(2, jitter_equal_ms(3, 0));          /* odd: ceil half */
+    TEST_ASSERT_EQUAL_UINT32(3, jitter_equal_ms(3, 0xFFFFFFFFu));
+    TEST_ASSERT_EQUAL_UINT32(0, jitter_equal_ms(0, 0xFFFFFFFFu));
+}
+
+void test_backoff_doubles_to_max(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, jitter_backoff_ms(2000, 30000, 0, 0xFFFFFFFFu));
+    TEST_ASSERT_EQUAL_UINT32(2000, jitter_backoff_ms(2000, 30000, 1, 0xFFFFFFFFu));
+    TEST_ASSERT_EQUAL_UINT32(4000, jitter_backoff_ms(2000, 30000, 2, 0xFFFFFFFFu));
+    TEST_ASSERT_EQUAL_UINT32(16000, jitter_backoff_ms(2000, 30000, 4, 0xFFFFFFFFu));
+    TEST_ASSERT_EQUAL_UINT32(30000, jitter_backoff_ms(2000, 30000, 5, 0xFFFFFFFFu));
+    TEST_ASSERT_EQUAL_UINT32(15000, jitter_backoff_ms(2000, 30000, 5, 0));
+}
+
+void test_backoff_survives_many_failures(void) {
+    /* No overflow however long the server stays away. */
+    TEST_ASSERT_EQUAL_UINT32(600000, jitter_backoff_ms(60000, 600000, 0xFFFFFFFFu, 0xFFFFFFFFu));
+    TEST_ASSERT_EQUAL_UINT32(0, jitter_backoff_ms(0, 30000, 7, 0xFFFFFFFFu));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_phase_spans_the_period);
+    RUN_TEST(test_phase_is_uniform);
+    RUN_TEST(test_equal_jitter_keeps_half);
+    RUN_TEST(test_backoff_doubles_to_max);
+    RUN_TEST(test_backoff_survives_many_failures);
+    return UNITY_END();
+}
@@ -0,0 +1,234 @@
+/* Tier A host test: link quality and roaming decisions.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "link_monitor.hpp"
+
+#include <string.h>
+
+static const uint8_t k_home[6]  = {0x24, 0x0a, 0xc4, 0x01, 0x02, 0x03};
+static const uint8_t k_other[6] = {0x24, 0x0a, 0xc4, 0x0a, 0x0b, 0x0c};
+
+static link_monitor_t m;
+
+void setUp(void) {
+    link_monitor_config_t cfg;
+    link_monitor_default_config(&cfg);
+    link_monitor_init(&m, &cfg);
+    link_monitor_associated(&m, 0, k_home);
+}
+void tearDown(void) {}
+
+/* Feed @p n samples of @p rssi, 2 s apart, starting at @p t_ms; returns the next time. */
+static int64_t feed(int64_t t_ms, int n, int8_t rssi) {
+    for (int i = 0; i < n; i++, t_ms += 2000) {
+        link_monitor_rssi(&m, t_ms, rssi);
+    }
+    return t_ms;
+}
+
+static link_candidate_t candidate(const uint8_t bssid[6], int8_t rssi) {
+    link_candidate_t c;
+    memcpy(c.bssid, bssid, 6);
+    c.channel  = 11;
+    c.rssi_dbm = rssi;
+    return c;
+}
+
+void test_strong_link_never_scans(void) {
+    int64_t t = feed(0, 20, -55);
+    TEST_ASSERT_FALSE(link_monitor_scan_due(&m, t));
+
+    link_monitor_stats_t s;
+    link_monitor_get_stats(&m, t, &s);
+    TEST_ASSERT_EQUAL_INT32(-55, s.rssi_avg_dbm);
+    TEST_ASSERT_EQUAL_UINT8(87, s.quality);
+}
+
+void test_weak_average_scans_once_per_cooldown(void) {
+    int64_t t = feed(0, 10, -78);
+    TEST_ASSERT_TRUE(link_monitor_scan_due(&m, t));
+    TEST_ASSERT_FALSE(link_monitor_scan_due(&m, t + 2000));
+    TEST_ASSERT_TRUE(link_monitor_scan_due(&m, t + 60000));
+
+    link_monitor_stats_t s;
+    link_monitor_get_stats(&m, t, &s);
+    TEST_ASSERT_EQUAL_UINT32(2, s.roam_scans);
+}
+
+void test_a_single_dip_is_averaged_away(void) {
+    int64_t t = feed(0, 10, -60);
+    t = feed(t, 1, -85);
+    TEST_ASSERT_FALSE(link_monitor_scan_due(&m, t));
+}
+
+void test_no_scan_while_an_rpc_is_in_flight(void) {
+    int64_t t = feed(0, 10, -80);
+    link_monitor_rpc_begin(&m);
+    TEST_ASSERT_FALSE(link_monitor_scan_due(&m, t));
+    link_monitor_rpc_end(&m, true);
+    TEST_ASSERT_TRUE(link_monitor_scan_due(&m, t));
+}
+
+void test_rpc_failures_scan_only_on_a_middling_link(void) {
+    int64_t t = feed(0, 10, -60);       /* strong: the server is the problem */
+    for (int i = 0; i < 5; i++) {
+        link_monitor_rpc_begin(&m);
+        link_monitor_rpc_end(&m, false);
+    }
+    TEST_ASSERT_FALSE(link_monitor_scan_due(&m, t));
+
+    setUp();
+    t = feed(0, 10, -69);               /* fair, not yet below -72 */
+    TEST_ASSERT_FALSE(link_monitor_scan_due(&m, t));
+    for (int i = 0; i < 3; i++) {
+        link_monitor_rpc_begin(&m);
+        link_monitor_rpc_end(&m, false);
+    }
+    TEST_ASSERT_TRUE(link_monitor_scan_due(&m, t));
+}
+
+void test_beacon_loss_burst_scans(void) {
+    int64_t t = feed(0, 10, -62);
+    link_monitor_beacon_lost(&m, t);
+    TEST_ASSERT_FALSE(link_monitor_scan_due(&m, t));
+    link_monitor_beacon_lost(&m, t + 20000);
+    TEST_ASSERT_TRUE(link_monitor_scan_due(&m, t + 20000));
+
+    link_monitor_stats_t s;
+    link_monitor_get_stats(&m, t + 20000, &s);
+    TEST_ASSERT_EQUAL_UINT32(2, s.beacon_losses);
+    TEST_ASSERT_TRUE(s.quality < 70);
+}
+
+void test_old_beacon_losses_do_not_count(void) {
+    int64_t t = feed(0, 10, -62);
+    link_monitor_beacon_lost(&m, t);
+    link_monitor_beacon_lost(&m, t + 90000);
+    TEST_ASSERT_FALSE(link_monitor_scan_due(&m, t + 90000));
+}
+
+void test_candidate_must_clear_the_gain(void) {
+    int64_t t = feed(0, 10, -76);
+    link_monitor_scan_due(&m, t);
+    link_candidate_t c = candidate(k_other, -70);
+    TEST_ASSERT_FALSE(link_monitor_scan_result(&m, t, &c));
+    c = candidate(k_other, -62);
+    TEST_ASSERT_TRUE(link_monitor_scan_result(&m, t, &c));
+}
+
+void test_current_ap_is_not_a_candidate(void) {
+    int64_t t = feed(0, 10, -80);
+    link_candidate_t c = candidate(k_home, -50);
+    TEST_ASSERT_FALSE(link_monitor_scan_result(&m, t, &c));
+    TEST_ASSERT_FALSE(link_monitor_scan_result(&m, t, NULL));
+}
+
+void test_roam_waits_for_the_rpc_then_goes(void) {
+    int64_t t = feed(0, 10, -80);
+    link_candidate_t c = candidate(k_other, -60);
+    link_monitor_scan_result(&m, t, &c);
+
+    link_monitor_rpc_begin(&m);
+    link_candidate_t out;
+    TEST_ASSERT_FALSE(link_monitor_roam_due(&m, t + 500, &out));
+    link_monitor_rpc_end(&m, true);
+    TEST_ASSERT_TRUE(link_monitor_roam_due(&m, t + 800, &out));
+    TEST_ASSERT_EQUAL_MEMORY(k_other, out.bssid, 6);
+    TEST_ASSERT_FALSE(link_monitor_roam_due(&m, t + 900, &out));
+}
+
+void test_roam_does_not_wait_forever(void) {
+    int64_t t = feed(0, 10, -80);
+    link_candidate_t c = candidate(k_other, -60);
+    link_monitor_scan_result(&m, t, &c);
+    link_monitor_rpc_begin(&m);
+    link_candidate_t out;
+    TEST_ASSERT_TRUE(link_monitor_roam_due(&m, t + 3000, &out));
+}
+
+void test_rpc_started_after_roam_due_puts_it_back(void) {
+    int64_t t = feed(0, 10, -80);
+    link_candidate_t c = candidate(k_other, -60);
+    link_monitor_scan_result(&m, t, &c);
+    link_candidate_t out;
+    TEST_ASSERT_TRUE(link_monitor_roam_due(&m, t + 100, &out));
+
+    link_monitor_rpc_begin(&m);
+    TEST_ASSERT_FALSE(link_monitor_roam_go(&m, t + 100));
+    TEST_ASSERT_FALSE(link_monitor_roam_due(&m, t + 500, &out));
+    link_monitor_rpc_end(&m, true);
+    TEST_ASSERT_TRUE(link_monitor_roam_due(&m, t + 600, &out));
+    TEST_ASSERT_EQUAL_MEMORY(k_other, out.bssid, 6);
+    TEST_ASSERT_TRUE(link_monitor_roam_go(&m, t + 600));
+
+    /* Past the deadline the roam goes even with an RPC in flight. */
+    link_monitor_scan_result(&m, t + 1000, &c);
+    TEST_ASSERT_TRUE(link_monitor_roam_due(&m, t + 1000, &out));
+    link_monitor_rpc_begin(&m);
+    TEST_ASSERT_TRUE(link_monitor_roam_go(&m, t + 4000));
+}
+
+void test_landing_on_the_new_ap_counts_a_roam_and_its_gain(void) {
+    int64_t t = feed(0, 10, -80);
+    link_candidate_t c = candidate(k_other, -60);
+    link_monitor_scan_result(&m, t, &c);
+    link_candidate_t out;
+    link_monitor_roam_due(&m, t, &out);
+
+    link_monitor_associated(&m, t + 400, k_other);
+    link_monitor_rssi(&m, t + 2400, -61);
+
+    link_monitor_stats_t s;
+    link_monitor_get_stats(&m, t + 2400, &s);
+    TEST_ASSERT_EQUAL_UINT32(1, s.roams);
+    TEST_ASSERT_EQUAL_INT32(19, s.last_roam_gain_db);
+    TEST_ASSERT_EQUAL_INT32(-61, s.rssi_avg_dbm);
+}
+
+void test_rejoining_the_same_ap_is_not_a_roam(void) {
+    int64_t t = feed(0, 10, -80);
+    link_monitor_roam_started(&m, t);
+    link_monitor_associated(&m, t + 400, k_home);
+
+    link_monitor_stats_t s;
+    link_monitor_get_stats(&m, t + 400, &s);
+    TEST_ASSERT_EQUAL_UINT32(0, s.roams);
+}
+
+void test_trend_follows_a_fading_link(void) {
+    int64_t t = 0;
+    for (int i = 0; i < 60; i++, t += 2000) {
+        link_monitor_rssi(&m, t, (int8_t)(-55 - i / 6));    /* -1 dB every 12 s */
+    }
+    link_monitor_stats_t s;
+    link_monitor_get_stats(&m, t, &s);
+    TEST_ASSERT_INT32_WITHIN(2, -5, s.rssi_trend_db_per_min);
+}
+
+void test_no_samples_reports_nothing(void) {
+    link_monitor_stats_t s;
+    link_monitor_get_stats(&m, 0, &s);
+    TEST_ASSERT_EQUAL_UINT8(0, s.quality);
+    TEST_ASSERT_EQUAL_INT32(0, s.rssi_avg_dbm);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_strong_link_never_scans);
+    RUN_TEST(test_weak_average_scans_once_per_cooldown);
+    RUN_TEST(test_a_single_dip_is_averaged_away);
+    RUN_TEST(test_no_scan_while_an_rpc_is_in_flight);
+    RUN_TEST(test_rpc_failures_scan_only_on_a_middling_link);
+    RUN_TEST(test_beacon_loss_burst_scans);
+    RUN_TEST(test_old_beacon_losses_do_not_count);
+    RUN_TEST(test_candidate_must_clear_the_gain);
+    RUN_TEST(test_current_ap_is_not_a_candidate);
+    RUN_TEST(test_roam_waits_for_the_rpc_then_goes);
+    RUN_TEST(test_roam_does_not_wait_forever);
+    RUN_TEST(test_rpc_started_after_roam_due_puts_it_back);
+    RUN_TEST(test_landing_on_the_new_ap_counts_a_roam_and_its_gain);
+    RUN_TEST(test_rejoining_the_same_ap_is_not_a_roam);
+    RUN_TEST(test_trend_follows_a_fading_link);
+    RUN_TEST(test_no_samples_reports_nothing);
+    return UNITY_END();
+}
@@ -0,0 +1,154 @@
+/* Tier A host test: RTT estimator and keepalive pacing.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "link_timing.hpp"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/* ── RTT estimator ─────────────────────────────────────────────────────── */
+
+void test_rto_is_ceiling_before_first_sample(void) {
+    rtt_estimator_t e;
+    rtt_estimator_init(&e, 200, 5000);
+    TEST_ASSERT_EQUAL_UINT32(5000, rtt_estimator_rto_ms(&e));
+    TEST_ASSERT_EQUAL_UINT32(0, rtt_estimator_percentile(&e, 50));
+}
+
+void test_first_sample_sets_srtt_and_half_variance(void) {
+    rtt_estimator_t e;
+    rtt_estimator_init(&e, 10, 5000);
+    rtt_estimator_sample(&e, 100);
+    TEST_ASSERT_EQUAL_UINT32(100, rtt_estimator_srtt_ms(&e));
+    /* RTO = SRTT + 4 * (R/2) = 3R */
+    TEST_ASSERT_EQUAL_UINT32(300, rtt_estimator_rto_ms(&e));
+}
+
+void test_steady_rtt_converges_to_floor(void) {
+    rtt_estimator_t e;
+    rtt_estimator_init(&e, 200, 5000);
+    for (int i = 0; i < 50; i++) {
+        rtt_estimator_sample(&e, 40);
+    }
+    TEST_ASSERT_EQUAL_UINT32(40, rtt_estimator_srtt_ms(&e));
+    /* Variance decays to ~0, so the floor applies. */
+    TEST_ASSERT_EQUAL_UINT32(200, rtt_estimator_rto_ms(&e));
+}
+
+void test_jitter_widens_rto(void) {
+    rtt_estimator_t steady, jittery;
+    rtt_estimator_init(&steady, 1, 5000);
+    rtt_estimator_init(&jittery, 1, 5000);
+    for (int i = 0; i < 40; i++) {
+        rtt_estimator_sample(&steady, 60);
+        rtt_estimator_sample(&jittery, (i & 1) ? 20 : 100);
+    }
+    TEST_ASSERT_GREATER_THAN_UINT32(rtt_estimator_rto_ms(&steady),
+                                    rtt_estimator_rto_ms(&jittery));
+    /* Still well under the static ceiling: failures surface in ms. */
+    TEST_ASSERT_LESS_THAN_UINT32(400, rtt_estimator_rto_ms(&jittery));
+}
+
+void test_timeout_doubles_until_next_sample(void) {
+    rtt_estimator_t e;
+    rtt_estimator_init(&e, 10, 5000);
+    rtt_estimator_sample(&e, 100);
+    rtt_estimator_timeout(&e);
+    TEST_ASSERT_EQUAL_UINT32(600, rtt_estimator_rto_ms(&e));
+    rtt_estimator_timeout(&e);
+    rtt_estimator_timeout(&e);
+    rtt_estimator_timeout(&e);
+    TEST_ASSERT_EQUAL_UINT32(4800, rtt_estimator_rto_ms(&e));
+    rtt_estimator_timeout(&e);
+    TEST_ASSERT_EQUAL_UINT32(5000, rtt_estimator_rto_ms(&e));
+
+    rtt_estimator_sample(&e, 100);
+    TEST_ASSERT_LESS_THAN_UINT32(600, rtt_estimator_rto_ms(&e));
+}
+
+void test_percentiles_over_window(void) {
+    rtt_estimator_t e;
+    rtt_estimator_init(&e, 1, 5000);
+    for (uint32_t i = 1; i <= 10; i++) {
+        rtt_estimator_sample(&e, i * 10);
+    }
+    TEST_ASSERT_EQUAL_UINT32(50,  rtt_estimator_percentile(&e, 50));
+    TEST_ASSERT_EQUAL_UINT32(90,  rtt_estimator_percentile(&e, 90));
+    TEST_ASSERT_EQUAL_UINT32(100, rtt_estimator_percentile(&e, 99));
+    TEST_ASSERT_EQUAL_UINT32(10,  rtt_estimator_percentile(&e, 1));
+}
+
+void test_percentiles_forget_old_samples(void) {
+    rtt_estimator_t e;
+    rtt_estimator_init(&e, 1, 5000);
+    rtt_estimator_sample(&e, 900);
+    for (int i = 0; i < RTT_WINDOW; i++) {
+        rtt_estimator_sample(&e, 30);
+    }
+    TEST_ASSERT_EQUAL_UINT32(30, rtt_estimator_percentile(&e, 99));
+}
+
+/* ── Keepalive pacing ──────────────────────────────────────────────────── */
+
+void test_keepalive_starts_clamped(void) {
+    keepalive_t k;
+    keepalive_init(&k, 10000, 120000, 30000);
+    TEST_ASSERT_EQUAL_UINT32(30000, k.interval_ms);
+    keepalive_init(&k, 10000, 120000, 500000);
+    TEST_ASSERT_EQUAL_UINT32(120000, k.interval_ms);
+}
+
+void test_keepalive_grows_after_streak(void) {
+    keepalive_t k;
+    keepalive_init(&k, 10000, 120000, 30000);
+    for (int i = 0; i < KEEPALIVE_GROW_STREAK - 1; i++) {
+        keepalive_on_ack(&k);
+    }
+    TEST_ASSERT_EQUAL_UINT32(30000, k.interval_ms);
+    keepalive_on_ack(&k);
+    TEST_ASSERT_EQUAL_UINT32(45000, k.interval_ms);
+
+    for (int i = 0; i < 10 * KEEPALIVE_GROW_STREAK; i++) {
+        keepalive_on_ack(&k);
+    }
+    TEST_ASSERT_EQUAL_UINT32(120000, k.interval_ms);
+}
+
+void test_dead_link_halves_and_caps_growth(void) {
+    keepalive_t k;
+    keepalive_init(&k, 10000, 120000, 60000);
+    keepalive_on_dead(&k, 60000);
+    TEST_ASSERT_EQUAL_UINT32(30000, k.interval_ms);
+    TEST_ASSERT_EQUAL_UINT32(60000, k.ceiling_ms);
+
+    for (int i = 0; i < 10 * KEEPALIVE_GROW_STREAK; i++) {
+        keepalive_on_ack(&k);
+    }
+    /* Never back up to the idle time that killed the link. */
+    TEST_ASSERT_EQUAL_UINT32(45000, k.interval_ms);
+}
+
+void test_dead_link_respects_floor(void) {
+    keepalive_t k;
+    keepalive_init(&k, 10000, 120000, 30000);
+    keepalive_on_dead(&k, 12000);
+    TEST_ASSERT_EQUAL_UINT32(10000, k.interval_ms);
+    TEST_ASSERT_TRUE(keepalive_due(&k, 10000));
+    TEST_ASSERT_FALSE(keepalive_due(&k, 9999));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_rto_is_ceiling_before_first_sample);
+    RUN_TEST(test_first_sample_sets_srtt_and_half_variance);
+    RUN_TEST(test_steady_rtt_converges_to_floor);
+    RUN_TEST(test_jitter_widens_rto);
+    RUN_TEST(test_timeout_doubles_until_next_sample);
+    RUN_TEST(test_percentiles_over_window);
+    RUN_TEST(test_percentiles_forget_old_samples);
+    RUN_TEST(test_keepalive_starts_clamped);
+    RUN_TEST(test_keepalive_grows_after_streak);
+    RUN_TEST(test_dead_link_halves_and_caps_growth);
+    RUN_TEST(test_dead_link_respects_floor);
+    return UNITY_END();
+}
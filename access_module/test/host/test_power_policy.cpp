@@ -0,0 +1,137 @@
+/* Tier A host test: radio power-save policy.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "power_policy.hpp"
+
+static power_policy_t p;
+
+void setUp(void) {
+    power_policy_config_t cfg;
+    power_policy_default_config(&cfg);
+    power_policy_init(&p, &cfg, 0);
+}
+void tearDown(void) {}
+
+void test_idle_module_saves_power(void) {
+    TEST_ASSERT_EQUAL(POWER_MODE_SAVE, power_policy_tick(&p, 60000));
+
+    power_policy_stats_t s;
+    power_policy_get_stats(&p, 60000, &s);
+    TEST_ASSERT_EQUAL_UINT64(60000, s.saving_ms);
+    TEST_ASSERT_EQUAL_UINT64(0, s.awake_ms);
+    TEST_ASSERT_EQUAL_UINT32(0, s.wakes);
+}
+
+void test_rf_activity_wakes_for_the_window(void) {
+    TEST_ASSERT_EQUAL(POWER_MODE_AWAKE, power_policy_activity(&p, 1000));
+    TEST_ASSERT_EQUAL(POWER_MODE_AWAKE, power_policy_tick(&p, 10999));
+    TEST_ASSERT_EQUAL(POWER_MODE_SAVE, power_policy_tick(&p, 11000));
+
+    power_policy_stats_t s;
+    power_policy_get_stats(&p, 20000, &s);
+    TEST_ASSERT_EQUAL_UINT64(10000, s.awake_ms);
+    TEST_ASSERT_EQUAL_UINT64(10000, s.saving_ms);
+    TEST_ASSERT_EQUAL_UINT32(1, s.wakes);
+}
+
+void test_more_activity_extends_the_window(void) {
+    power_policy_activity(&p, 0);
+    power_policy_activity(&p, 8000);
+    TEST_ASSERT_EQUAL(POWER_MODE_AWAKE, power_policy_tick(&p, 15000));
+    TEST_ASSERT_EQUAL(POWER_MODE_SAVE, power_policy_tick(&p, 18000));
+
+    power_policy_stats_t s;
+    power_policy_get_stats(&p, 18000, &s);
+    TEST_ASSERT_EQUAL_UINT32(1, s.wakes);
+}
+
+void test_hold_outlasts_the_window(void) {
+    power_policy_activity(&p, 0);
+    power_policy_hold(&p, 500);                 /* a slow RPC */
+    TEST_ASSERT_EQUAL(POWER_MODE_AWAKE, power_policy_tick(&p, 30000));
+    TEST_ASSERT_EQUAL(POWER_MODE_SAVE, power_policy_release(&p, 31000));
+}
+
+void test_hold_without_activity_wakes_only_for_the_call(void) {
+    TEST_ASSERT_EQUAL(POWER_MODE_AWAKE, power_policy_hold(&p, 5000));   /* TLS handshake */
+    TEST_ASSERT_EQUAL(POWER_MODE_SAVE, power_policy_release(&p, 5400));
+}
+
+void test_nested_holds_release_in_turn(void) {
+    power_policy_hold(&p, 0);
+    power_policy_hold(&p, 10);
+    TEST_ASSERT_EQUAL(POWER_MODE_AWAKE, power_policy_release(&p, 20));
+    TEST_ASSERT_EQUAL(POWER_MODE_SAVE, power_policy_release(&p, 30));
+    TEST_ASSERT_EQUAL(POWER_MODE_SAVE, power_policy_release(&p, 40));  /* unmatched */
+}
+
+void test_first_rpc_after_a_wake_counts_as_woken(void) {
+    power_policy_activity(&p, 0);               /* tap wakes the radio */
+    power_policy_hold(&p, 5);
+    power_policy_access_rpc(&p, 180);
+    power_policy_release(&p, 185);
+
+    power_policy_activity(&p, 4000);            /* second tap, radio still up */
+    power_policy_hold(&p, 4005);
+    power_policy_access_rpc(&p, 40);
+    power_policy_release(&p, 4045);
+    power_policy_activity(&p, 6000);
+    power_policy_access_rpc(&p, 60);
+
+    power_policy_stats_t s;
+    power_policy_get_stats(&p, 6100, &s);
+    TEST_ASSERT_EQUAL_UINT32(1, s.rpcs_woken);
+    TEST_ASSERT_EQUAL_UINT32(180, s.rpc_woken_avg_ms);
+    TEST_ASSERT_EQUAL_UINT32(2, s.rpcs_awake);
+    TEST_ASSERT_EQUAL_UINT32(50, s.rpc_awake_avg_ms);
+    TEST_ASSERT_EQUAL_UINT32(60, s.rpc_awake_max_ms);
+}
+
+void test_each_wake_starts_a_new_woken_rpc(void) {
+    power_policy_activity(&p, 0);
+    power_policy_access_rpc(&p, 100);
+    power_policy_tick(&p, 20000);               /* back to power save */
+    power_policy_activity(&p, 30000);
+    power_policy_access_rpc(&p, 300);
+
+    power_policy_stats_t s;
+    power_policy_get_stats(&p, 30500, &s);
+    TEST_ASSERT_EQUAL_UINT32(2, s.wakes);
+    TEST_ASSERT_EQUAL_UINT32(2, s.rpcs_woken);
+    TEST_ASSERT_EQUAL_UINT32(200, s.rpc_woken_avg_ms);
+    TEST_ASSERT_EQUAL_UINT32(300, s.rpc_woken_max_ms);
+    TEST_ASSERT_EQUAL_UINT32(0, s.rpcs_awake);
+}
+
+void test_zero_window_keeps_only_the_holds(void) {
+    power_policy_config_t cfg;
+    cfg.activity_window_ms = 0;
+    power_policy_init(&p, &cfg, 0);
+    TEST_ASSERT_EQUAL(POWER_MODE_SAVE, power_policy_activity(&p, 1000));
+    TEST_ASSERT_EQUAL(POWER_MODE_AWAKE, power_policy_hold(&p, 1005));
+    TEST_ASSERT_EQUAL(POWER_MODE_SAVE, power_policy_release(&p, 1200));
+}
+
+void test_stats_include_the_current_stretch(void) {
+    power_policy_hold(&p, 1000);
+
+    power_policy_stats_t s;
+    power_policy_get_stats(&p, 4000, &s);
+    TEST_ASSERT_EQUAL_UINT64(3000, s.awake_ms);
+    TEST_ASSERT_EQUAL_UINT64(1000, s.saving_ms);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_idle_module_saves_power);
+    RUN_TEST(test_rf_activity_wakes_for_the_window);
+    RUN_TEST(test_more_activity_extends_the_window);
+    RUN_TEST(test_hold_outlasts_the_window);
+    RUN_TEST(test_hold_without_activity_wakes_only_for_the_call);
+    RUN_TEST(test_nested_holds_release_in_turn);
+    RUN_TEST(test_first_rpc_after_a_wake_counts_as_woken);
+    RUN_TEST(test_each_wake_starts_a_new_woken_rpc);
+    RUN_TEST(test_zero_window_keeps_only_the_holds);
+    RUN_TEST(test_stats_include_the_current_stretch);
+    return UNITY_END();
+}
@@ -0,0 +1,236 @@
+/* Tier A host test: revocation xor filter.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "revocation_filter.hpp"
+
+#include <stdlib.h>
+#include <string.h>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/* Distinct, well-spread test tags (same finaliser as the filter). */
+static uint64_t tag_for(uint64_t i) {
+    uint64_t h = i;
+    h ^= h >> 33;
+    h *= 0xff51afd7ed558ccdULL;
+    h ^= h >> 33;
+    h *= 0xc4ceb9fe1a85ec53ULL;
+    h ^= h >> 33;
+    return h;
+}
+
+static uint32_t fnv1a(const uint8_t *p, size_t n) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < n; i++) {
+        h = (h ^ p[i]) * 16777619u;
+    }
+    return h;
+}
+
+static uint64_t *tags_from(uint64_t first, uint32_t n) {
+    uint64_t *t = (uint64_t *)malloc(n * sizeof(uint64_t));
+    for (uint32_t i = 0; i < n; i++) {
+        t[i] = tag_for(first + i);
+    }
+    return t;
+}
+
+/* ── Sizing and wire format ─────────────────────────────────────────────── */
+
+void test_size_is_about_ten_bits_per_entry(void) {
+    TEST_ASSERT_EQUAL_size_t(0, revocation_filter_bytes(0));
+    TEST_ASSERT_EQUAL_size_t(153, revocation_filter_bytes(100));
+    /* 1.23 bytes per entry once the fixed slack is amortised. */
+    TEST_ASSERT_EQUAL_size_t(12330, revocation_filter_bytes(10000));
+}
+
+void test_tag_is_little_endian_and_never_zero(void) {
+    const uint8_t d[8] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    TEST_ASSERT_TRUE(revocation_filter_tag(d) == 0x0807060504030201ULL);
+    const uint8_t z[8] = {0};
+    TEST_ASSERT_TRUE(revocation_filter_tag(z) == 1);
+}
+
+/* Must match TestGoldenFilter in server/internal/revfilter/xor_test.go:
+   any change to hashing, sizing or peeling order breaks one of them. */
+void test_golden_filter_matches_server(void) {
+    uint64_t *tags = tags_from(1, 100);
+    uint8_t out[153];
+    revocation_filter_t f;
+    TEST_ASSERT_TRUE(revocation_filter_build(&f, out, sizeof(out), tags, 100, 0x5eed));
+    TEST_ASSERT_EQUAL_UINT32(51, f.block_length);
+    TEST_ASSERT_TRUE(f.seed == 0x457f21d36f8e2858ULL);
+    TEST_ASSERT_EQUAL_HEX32(0x3cc9a9abu, fnv1a(out, sizeof(out)));
+    free(tags);
+}
+
+void test_load_rejects_bad_lengths(void) {
+    uint8_t fp[9] = {0};
+    uint8_t ex[8 * (REVOCATION_FILTER_MAX_EXCEPTIONS + 1)] = {0};
+    revocation_filter_t f;
+    TEST_ASSERT_FALSE(revocation_filter_load(&f, fp, 8, 1, NULL, 0));
+    TEST_ASSERT_EQUAL_UINT32(0, f.block_length);
+    TEST_ASSERT_FALSE(revocation_filter_load(&f, fp, 9, 1, ex, 7));
+    TEST_ASSERT_FALSE(revocation_filter_load(&f, fp, 9, 1, ex, sizeof(ex)));
+    TEST_ASSERT_TRUE(revocation_filter_load(&f, fp, 9, 1, ex, 8 * REVOCATION_FILTER_MAX_EXCEPTIONS));
+    TEST_ASSERT_EQUAL_UINT32(3, f.block_length);
+}
+
+void test_loaded_filter_matches_built(void) {
+    uint64_t *tags = tags_from(1, 500);
+    size_t n = revocation_filter_bytes(500);
+    uint8_t *out = (uint8_t *)malloc(n);
+    revocation_filter_t built, loaded;
+    TEST_ASSERT_TRUE(revocation_filter_build(&built, out, n, tags, 500, 7));
+    TEST_ASSERT_TRUE(revocation_filter_load(&loaded, out, n, built.seed, NULL, 0));
+    for (uint32_t i = 0; i < 500; i++) {
+        TEST_ASSERT_TRUE(revocation_filter_contains(&loaded, tags[i]));
+    }
+    free(out);
+    free(tags);
+}
+
+/* ── Membership ─────────────────────────────────────────────────────────── */
+
+void test_empty_filter_matches_nothing(void) {
+    revocation_filter_t f;
+    revocation_filter_clear(&f);
+    TEST_ASSERT_FALSE(revocation_filter_contains(&f, 42));
+
+    uint8_t out[1];
+    TEST_ASSERT_TRUE(revocation_filter_build(&f, out, sizeof(out), NULL, 0, 1));
+    TEST_ASSERT_FALSE(revocation_filter_contains(&f, 42));
+}
+
+void test_no_false_negatives(void) {
+    const uint32_t n = 10000;
+    uint64_t *tags = tags_from(1000, n);
+    size_t bytes = revocation_filter_bytes(n);
+    uint8_t *out = (uint8_t *)malloc(bytes);
+    revocation_filter_t f;
+    TEST_ASSERT_TRUE(revocation_filter_build(&f, out, bytes, tags, n, 99));
+    for (uint32_t i = 0; i < n; i++) {
+        TEST_ASSERT_TRUE(revocation_filter_contains(&f, tags[i]));
+    }
+    free(out);
+    free(tags);
+}
+
+void test_false_positive_rate_near_one_in_256(void) {
+    const uint32_t n = 10000, probes = 200000;
+    uint64_t *tags = tags_from(1, n);
+    size_t bytes = revocation_filter_bytes(n);
+    uint8_t *out = (uint8_t *)malloc(bytes);
+    revocation_filter_t f;
+    TEST_ASSERT_TRUE(revocation_filter_build(&f, out, bytes, tags, n, 3));
+    uint32_t fp = 0;
+    for (uint32_t i = 0; i < probes; i++) {
+        fp += revocation_filter_contains(&f, tag_for(1000000 + i)) ? 1 : 0;
+    }
+    /* Expect 200000 / 256 ≈ 781. */
+    TEST_ASSERT_GREATER_THAN_UINT32(600, fp);
+    TEST_ASSERT_LESS_THAN_UINT32(980, fp);
+    free(out);
+    free(tags);
+}
+
+void test_duplicates_are_ignored(void) {
+    uint64_t tags[6] = {tag_for(1), tag_for(2), tag_for(1), tag_for(3), tag_for(2), tag_for(1)};
+    uint8_t out[64];
+    revocation_filter_t f;
+    TEST_ASSERT_TRUE(revocation_filter_build(&f, out, sizeof(out), tags, 6, 5));
+    TEST_ASSERT_EQUAL_size_t(revocation_filter_bytes(3), 3 * f.block_length);
+    TEST_ASSERT_TRUE(revocation_filter_contains(&f, tag_for(3)));
+}
+
+void test_build_refuses_small_buffer(void) {
+    uint64_t *tags = tags_from(1, 100);
+    uint8_t out[152];
+    revocation_filter_t f;
+    TEST_ASSERT_FALSE(revocation_filter_build(&f, out, sizeof(out), tags, 100, 1));
+    free(tags);
+}
+
+/* ── Exceptions ─────────────────────────────────────────────────────────── */
+
+void test_exceptions_pass_collisions_through(void) {
+    const uint32_t n = 2000;
+    uint64_t *tags = tags_from(1, n);
+    size_t bytes = revocation_filter_bytes(n);
+    uint8_t *out = (uint8_t *)malloc(bytes);
+    revocation_filter_t f;
+    TEST_ASSERT_TRUE(revocation_filter_build(&f, out, bytes, tags, n, 11));
+
+    /* Find an outsider that collides, then list it as an exception. */
+    uint64_t victim = 0;
+    for (uint64_t i = 500000; victim == 0; i++) {
+        if (revocation_filter_contains(&f, tag_for(i))) {
+            victim = tag_for(i);
+        }
+    }
+    uint8_t ex[8];
+    for (int b = 0; b < 8; b++) {
+        ex[b] = (uint8_t)(victim >> (8 * b));
+    }
+    revocation_filter_t loaded;
+    TEST_ASSERT_TRUE(revocation_filter_load(&loaded, out, bytes, f.seed, ex, sizeof(ex)));
+    TEST_ASSERT_FALSE(revocation_filter_contains(&loaded, victim));
+    TEST_ASSERT_TRUE(revocation_filter_contains(&loaded, tags[0]));
+    free(out);
+    free(tags);
+}
+
+void test_add_exception_until_full(void) {
+    revocation_filter_t f;
+    revocation_filter_clear(&f);
+    for (uint64_t i = 1; i <= REVOCATION_FILTER_MAX_EXCEPTIONS; i++) {
+        TEST_ASSERT_TRUE(revocation_filter_add_exception(&f, i));
+    }
+    TEST_ASSERT_TRUE(revocation_filter_add_exception(&f, 1));     /* already held */
+    TEST_ASSERT_FALSE(revocation_filter_add_exception(&f, 999));
+    TEST_ASSERT_EQUAL_UINT8(REVOCATION_FILTER_MAX_EXCEPTIONS, f.exception_count);
+}
+
+/* ── Fleet sizes ────────────────────────────────────────────────────────── */
+
+/* Memory per entry at a few fleet-realistic sizes, and no member missed.
+   bench_hot_path times the lookup. */
+void test_fleet_sizes_stay_near_ten_bits_per_entry(void) {
+    const uint32_t sizes[] = {100, 1000, 10000, 100000};
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t n = sizes[s];
+        uint64_t *tags = tags_from(1, n);
+        size_t bytes = revocation_filter_bytes(n);
+        uint8_t *out = (uint8_t *)malloc(bytes);
+        revocation_filter_t f;
+        TEST_ASSERT_TRUE(revocation_filter_build(&f, out, bytes, tags, n, 1));
+
+        uint32_t hits = 0;
+        for (uint32_t i = 0; i < n; i++) {
+            hits += revocation_filter_contains(&f, tags[i]) ? 1 : 0;
+        }
+        TEST_ASSERT_EQUAL_UINT32(n, hits);
+        TEST_ASSERT_TRUE(8.0 * (double)bytes / n < (n >= 1000 ? 10.2 : 12.5));
+        free(out);
+        free(tags);
+    }
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_size_is_about_ten_bits_per_entry);
+    RUN_TEST(test_tag_is_little_endian_and_never_zero);
+    RUN_TEST(test_golden_filter_matches_server);
+    RUN_TEST(test_load_rejects_bad_lengths);
+    RUN_TEST(test_loaded_filter_matches_built);
+    RUN_TEST(test_empty_filter_matches_nothing);
+    RUN_TEST(test_no_false_negatives);
+    RUN_TEST(test_false_positive_rate_near_one_in_256);
+    RUN_TEST(test_duplicates_are_ignored);
+    RUN_TEST(test_build_refuses_small_buffer);
+    RUN_TEST(test_exceptions_pass_collisions_through);
+    RUN_TEST(test_add_exception_until_full);
+    RUN_TEST(test_fleet_sizes_stay_near_ten_bits_per_entry);
+    return UNITY_END();
+}
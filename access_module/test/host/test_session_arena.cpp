@@ -0,0 +1,168 @@
+/* Tier A host test: nghttp2 session arena.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler.
+ *
+ * The reconnect soak replays the allocation shape of one nghttp2 client
+ * session (session object, outbound frame buffer, HPACK tables that grow by
+ * realloc, per-RPC stream objects) and tears it down the way
+ * nghttp2_session_del() + session_arena_reset() do, 1,000 times. */
+#include "unity.h"
+#include "session_arena.hpp"
+#include <stdlib.h>
+#include <string.h>
+
+/* Matches the CONFIG_PORTUNUS_GRPC_SESSION_ARENA_SIZE default. */
+static constexpr size_t ARENA_CAP = 28672;
+static constexpr int    SOAK_RECONNECTS = 1000;
+
+static uint8_t         s_region[ARENA_CAP] __attribute__((aligned(8)));
+static session_arena_t s_arena;
+
+void setUp(void) { session_arena_init(&s_arena, s_region, sizeof(s_region)); }
+void tearDown(void) {}
+
+static session_arena_stats_t stats(void) {
+    session_arena_stats_t st;
+    session_arena_get_stats(&s_arena, &st);
+    return st;
+}
+
+void test_freed_block_is_reused_by_same_class(void) {
+    void *keep = session_arena_alloc(&s_arena, 64);
+    void *a    = session_arena_alloc(&s_arena, 40);
+    void *top  = session_arena_alloc(&s_arena, 8);
+    (void)keep; (void)top;
+    session_arena_free(&s_arena, a);
+    void *b = session_arena_alloc(&s_arena, 33);  /* same 64 B class */
+    TEST_ASSERT_EQUAL_PTR(a, b);
+}
+
+void test_top_block_returns_to_bump_region(void) {
+    void *a = session_arena_alloc(&s_arena, 100);
+    size_t before = stats().largest_free;
+    void *b = session_arena_alloc(&s_arena, 500);
+    session_arena_free(&s_arena, b);
+    TEST_ASSERT_EQUAL_size_t(before, stats().largest_free);
+    session_arena_free(&s_arena, a);
+    TEST_ASSERT_EQUAL_size_t(0, stats().in_use);
+}
+
+void test_realloc_grows_last_block_in_place(void) {
+    uint8_t *p = static_cast<uint8_t *>(session_arena_alloc(&s_arena, 16));
+    memset(p, 0xA5, 16);
+    uint8_t *q = static_cast<uint8_t *>(session_arena_realloc(&s_arena, p, 600));
+    TEST_ASSERT_EQUAL_PTR(p, q);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0xA5, q, 16);
+}
+
+void test_realloc_moves_and_preserves_contents(void) {
+    uint8_t *p = static_cast<uint8_t *>(session_arena_alloc(&s_arena, 32));
+    memset(p, 0x5A, 32);
+    void *pin = session_arena_alloc(&s_arena, 16);  /* p is no longer on top */
+    uint8_t *q = static_cast<uint8_t *>(session_arena_realloc(&s_arena, p, 200));
+    TEST_ASSERT_NOT_EQUAL(p, q);
+    TEST_ASSERT_EACH_EQUAL_HEX8(0x5A, q, 32);
+    session_arena_free(&s_arena, pin);
+    session_arena_free(&s_arena, q);
+}
+
+void test_calloc_zeroes_and_rejects_overflow(void) {
+    uint8_t *p = static_cast<uint8_t *>(session_arena_alloc(&s_arena, 64));
+    memset(p, 0xFF, 64);
+    session_arena_free(&s_arena, p);
+    uint8_t *z = static_cast<uint8_t *>(session_arena_calloc(&s_arena, 8, 8));
+    TEST_ASSERT_EACH_EQUAL_HEX8(0, z, 64);
+    TEST_ASSERT_NULL(session_arena_calloc(&s_arena, SIZE_MAX / 2, 4));
+}
+
+void test_exhaustion_falls_back_to_heap_and_frees_there(void) {
+    void *big = session_arena_alloc(&s_arena, ARENA_CAP - 64);
+    void *spill = session_arena_alloc(&s_arena, 256);
+    TEST_ASSERT_NOT_NULL(spill);
+    TEST_ASSERT_EQUAL_UINT32(1, stats().heap_fallbacks);
+    TEST_ASSERT_EQUAL_UINT32(1, s_arena.heap_live);
+    session_arena_free(&s_arena, spill);
+    TEST_ASSERT_EQUAL_UINT32(0, s_arena.heap_live);
+    session_arena_free(&s_arena, big);
+}
+
+void test_unbacked_arena_uses_heap_only(void) {
+    session_arena_t a;
+    session_arena_init(&a, nullptr, ARENA_CAP);
+    void *p = session_arena_alloc(&a, 32);
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_EQUAL_UINT32(1, a.heap_fallbacks);
+    session_arena_free(&a, p);
+    TEST_ASSERT_EQUAL_UINT32(0, a.heap_live);
+}
+
+/* ── Reconnect soak ──────────────────────────────────────────────────────── */
+
+static uint32_t s_lcg = 12345;
+static uint32_t next_rand(void) {
+    s_lcg = s_lcg * 1103515245u + 12345u;
+    return s_lcg >> 16;
+}
+
+/** One connect → N RPCs → disconnect, shaped like an nghttp2 client session. */
+static void run_one_session(void) {
+    session_arena_t *a = &s_arena;
+
+    void *session   = session_arena_calloc(a, 1, 2400);       /* nghttp2_session */
+    void *framebuf  = session_arena_alloc(a, 16384 + 9 + 1);   /* aob frame buffer chunk */
+    void *bufchain  = session_arena_alloc(a, 40);
+    void *deflate   = session_arena_alloc(a, 128);             /* HPACK ring, grows */
+    void *inflate   = session_arena_alloc(a, 128);
+    void *settings  = session_arena_calloc(a, 6, 8);           /* inbound SETTINGS iv */
+
+    int rpcs = 1 + static_cast<int>(next_rand() % 12);
+    for (int i = 0; i < rpcs; i++) {
+        void *stream = session_arena_calloc(a, 1, 240);        /* nghttp2_stream */
+        void *nva    = session_arena_alloc(a, 9 * 24 + 256);   /* copied request headers */
+        void *item   = session_arena_alloc(a, 96);             /* outbound item */
+        if (i < 3) {
+            deflate = session_arena_realloc(a, deflate, 128u << (i + 1));
+            inflate = session_arena_realloc(a, inflate, 128u << (i + 1));
+        }
+        void *trailer = session_arena_alloc(a, 64 + next_rand() % 96);
+        session_arena_free(a, nva);
+        session_arena_free(a, item);
+        session_arena_free(a, trailer);
+        session_arena_free(a, stream);
+    }
+
+    /* nghttp2_session_del() order: inbound state, HPACK, buffers, session. */
+    session_arena_free(a, settings);
+    session_arena_free(a, inflate);
+    session_arena_free(a, deflate);
+    session_arena_free(a, bufchain);
+    session_arena_free(a, framebuf);
+    session_arena_free(a, session);
+    session_arena_reset(a);
+}
+
+void test_reconnect_soak_reclaims_everything(void) {
+    for (int i = 0; i < SOAK_RECONNECTS; i++) {
+        run_one_session();
+        session_arena_stats_t st = stats();
+        TEST_ASSERT_EQUAL_size_t(0, st.in_use);
+        TEST_ASSERT_EQUAL_size_t(ARENA_CAP - 8, st.largest_free);
+    }
+
+    session_arena_stats_t st = stats();
+    TEST_ASSERT_EQUAL_UINT32(SOAK_RECONNECTS, st.resets);
+    TEST_ASSERT_EQUAL_UINT32(0, st.heap_fallbacks);
+    TEST_ASSERT_TRUE(st.peak <= ARENA_CAP);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_freed_block_is_reused_by_same_class);
+    RUN_TEST(test_top_block_returns_to_bump_region);
+    RUN_TEST(test_realloc_grows_last_block_in_place);
+    RUN_TEST(test_realloc_moves_and_preserves_contents);
+    RUN_TEST(test_calloc_zeroes_and_rejects_overflow);
+    RUN_TEST(test_exhaustion_falls_back_to_heap_and_frees_there);
+    RUN_TEST(test_unbacked_arena_uses_heap_only);
+    RUN_TEST(test_reconnect_soak_reclaims_everything);
+    return UNITY_END();
+}
@@ -0,0 +1,147 @@
+/* Tier A host test: precomputed-key HMAC-SHA256.  bench_hot_path times it
+ * against the per-call mbedtls_md_hmac() path it replaces.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig.  Links upstream mbedtls. */
+#include "unity.h"
+#include "sig_engine.hpp"
+#include "wire_sig.hpp"
+
+#include "mbedtls/md.h"
+
+#include <string.h>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/* A provisioned secret: 64 hex chars, keyed as the ASCII string, the way
+   the server keys it. */
+static const char k_secret[] = "0123456789abcdef0123456789abcdef0123456789abcdef0123456789abcdef";
+
+static const uint8_t k_nonce[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+
+static void init_engine(sig_engine_t *e, const void *key, size_t len) {
+    TEST_ASSERT_TRUE(sig_engine_init(e, (const uint8_t *)key, len));
+}
+
+/* ── RFC 4231 ───────────────────────────────────────────────────────────── */
+
+void test_rfc4231_short_key(void) {
+    uint8_t key[20];
+    memset(key, 0x0b, sizeof(key));
+    sig_engine_t e;
+    init_engine(&e, key, sizeof(key));
+    char hex[SIG_ENGINE_HEX_LEN];
+    TEST_ASSERT_TRUE(sig_engine_sign_hex(&e, (const uint8_t *)"Hi There", 8, hex));
+    TEST_ASSERT_EQUAL_STRING("b0344c61d8db38535ca8afceaf0bf12b881dc200c9833da726e9376c2e32cff7", hex);
+    sig_engine_free(&e);
+}
+
+void test_rfc4231_key_shorter_than_data(void) {
+    sig_engine_t e;
+    init_engine(&e, "Jefe", 4);
+    const char *msg = "what do ya want for nothing?";
+    char hex[SIG_ENGINE_HEX_LEN];
+    TEST_ASSERT_TRUE(sig_engine_sign_hex(&e, (const uint8_t *)msg, strlen(msg), hex));
+    TEST_ASSERT_EQUAL_STRING("5bdcc146bf60754e6a042426089575c75a003f089d2739839dec58b964ec3843", hex);
+    sig_engine_free(&e);
+}
+
+void test_rfc4231_key_longer_than_block(void) {
+    uint8_t key[131];
+    memset(key, 0xaa, sizeof(key));
+    sig_engine_t e;
+    init_engine(&e, key, sizeof(key));
+    const char *msg = "Test Using Larger Than Block-Size Key - Hash Key First";
+    char hex[SIG_ENGINE_HEX_LEN];
+    TEST_ASSERT_TRUE(sig_engine_sign_hex(&e, (const uint8_t *)msg, strlen(msg), hex));
+    TEST_ASSERT_EQUAL_STRING("60e431591ee0b67f0d8a26aacbf5b77f8e0bc6213728c5140546040f0ee37f54", hex);
+    sig_engine_free(&e);
+}
+
+/* ── Against the old path ───────────────────────────────────────────────── */
+
+/* The golden access projection from test_wire_sig.cpp, signed with a
+   provisioned-style secret; the server computes the same value. */
+void test_signs_projection_like_the_server(void) {
+    uint8_t proj[WIRE_SIG_MAX_LEN];
+    size_t n = wire_sig_access(proj, sizeof(proj), "door-1", "04:A3:2B:1C",
+                               k_nonce, sizeof(k_nonce), 1700000000123456LL);
+    sig_engine_t e;
+    init_engine(&e, k_secret, strlen(k_secret));
+    char hex[SIG_ENGINE_HEX_LEN];
+    TEST_ASSERT_TRUE(sig_engine_sign_hex(&e, proj, n, hex));
+    TEST_ASSERT_EQUAL_STRING("6906abdb120b2bdef2229d7311f7409c0a46be944e8358deddf7d4f1ebf3ea96", hex);
+    sig_engine_free(&e);
+}
+
+void test_matches_md_hmac_for_every_length(void) {
+    const mbedtls_md_info_t *info = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+    sig_engine_t e;
+    init_engine(&e, k_secret, strlen(k_secret));
+    uint8_t data[200];
+    for (size_t i = 0; i < sizeof(data); i++) {
+        data[i] = (uint8_t)(i * 7 + 1);
+    }
+    /* Around the 55/56/64-byte padding edges and past two blocks. */
+    for (size_t len = 0; len <= sizeof(data); len++) {
+        uint8_t want[32], got[32];
+        TEST_ASSERT_EQUAL_INT(0, mbedtls_md_hmac(info, (const uint8_t *)k_secret,
+                                                 strlen(k_secret), data, len, want));
+        TEST_ASSERT_TRUE(sig_engine_mac(&e, data, len, got));
+        TEST_ASSERT_EQUAL_MEMORY(want, got, 32);
+    }
+    sig_engine_free(&e);
+}
+
+/* ── Verify ─────────────────────────────────────────────────────────────── */
+
+void test_verify_accepts_only_the_exact_signature(void) {
+    sig_engine_t e;
+    init_engine(&e, k_secret, strlen(k_secret));
+    const uint8_t msg[] = "a\x02payload";
+    char sig[SIG_ENGINE_HEX_LEN];
+    TEST_ASSERT_TRUE(sig_engine_sign_hex(&e, msg, sizeof(msg), sig));
+    TEST_ASSERT_TRUE(sig_engine_verify_hex(&e, msg, sizeof(msg), sig));
+
+    /* Any single character off, first or last, fails. */
+    for (size_t i = 0; i < SIG_ENGINE_HEX_LEN - 1; i += SIG_ENGINE_HEX_LEN - 2) {
+        char bad[SIG_ENGINE_HEX_LEN];
+        memcpy(bad, sig, sizeof(bad));
+        bad[i] = bad[i] == '0' ? '1' : '0';
+        TEST_ASSERT_FALSE(sig_engine_verify_hex(&e, msg, sizeof(msg), bad));
+    }
+
+    /* Empty (missing) and upper-case signatures fail. */
+    char empty[SIG_ENGINE_HEX_LEN] = {};
+    TEST_ASSERT_FALSE(sig_engine_verify_hex(&e, msg, sizeof(msg), empty));
+    char upper[SIG_ENGINE_HEX_LEN];
+    for (size_t i = 0; i < sizeof(upper); i++) {
+        upper[i] = (sig[i] >= 'a' && sig[i] <= 'f') ? (char)(sig[i] - 32) : sig[i];
+    }
+    if (strcmp(upper, sig) != 0) {
+        TEST_ASSERT_FALSE(sig_engine_verify_hex(&e, msg, sizeof(msg), upper));
+    }
+    sig_engine_free(&e);
+}
+
+void test_uninitialised_engine_refuses(void) {
+    sig_engine_t e;
+    init_engine(&e, k_secret, strlen(k_secret));
+    sig_engine_free(&e);
+    uint8_t mac[SIG_ENGINE_MAC_LEN];
+    TEST_ASSERT_FALSE(sig_engine_mac(&e, (const uint8_t *)"x", 1, mac));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_rfc4231_short_key);
+    RUN_TEST(test_rfc4231_key_shorter_than_data);
+    RUN_TEST(test_rfc4231_key_longer_than_block);
+    RUN_TEST(test_signs_projection_like_the_server);
+    RUN_TEST(test_matches_md_hmac_for_every_length);
+    RUN_TEST(test_verify_accepts_only_the_exact_signature);
+    RUN_TEST(test_uninitialised_engine_refuses);
+    return UNITY_END();
+}
@@ -25,7 +25,7 @@ static portunus_event_t ev(portunus_event_id_t id) {
 
 void test_granted_with_access_point_unlocks_and_holds(void) {
     fsm_actions_t a = decide_system_event(
-        caps(true, true, true, true), ev(EVENT_ACCESS_GRANTED));
+        caps(true, true, true, true), ev(EVENT_ACCESS_GRANTED), 0);
     TEST_ASSERT_EQUAL(door_cmd_t::UNLOCK_AND_HOLD, a.door);
     TEST_ASSERT_EQUAL_UINT8(1, a.feedback_count);
     TEST_ASSERT_EQUAL(feedback_type_t::ACCESS_GRANTED, a.feedback[0]);
@@ -33,7 +33,7 @@ void test_granted_with_access_point_unlocks_and_holds(void) {
 
 void test_granted_without_access_point_does_not_unlock(void) {
     fsm_actions_t a = decide_system_event(
-        caps(true, false, true, true), ev(EVENT_ACCESS_GRANTED));
+        caps(true, false, true, true), ev(EVENT_ACCESS_GRANTED), 0);
     TEST_ASSERT_EQUAL(door_cmd_t::NONE, a.door);
     TEST_ASSERT_EQUAL_UINT8(1, a.feedback_count);
     TEST_ASSERT_EQUAL(feedback_type_t::ACCESS_GRANTED, a.feedback[0]);
@@ -41,7 +41,7 @@ void test_granted_without_access_point_does_not_unlock(void) {
 
 void test_denied_never_touches_strike(void) {
     fsm_actions_t a = decide_system_event(
-        caps(true, true, true, true), ev(EVENT_ACCESS_DENIED));
+        caps(true, true, true, true), ev(EVENT_ACCESS_DENIED), 0);
     TEST_ASSERT_EQUAL(door_cmd_t::NONE, a.door);
     TEST_ASSERT_EQUAL_UINT8(1, a.feedback_count);
     TEST_ASSERT_EQUAL(feedback_type_t::ACCESS_DENIED, a.feedback[0]);
@@ -49,7 +49,7 @@ void test_denied_never_touches_strike(void) {
 
 void test_credential_read_online_shows_card_read_only(void) {
     fsm_actions_t a = decide_system_event(
-        caps(true, true, true, true), ev(EVENT_CREDENTIAL_READ));
+        caps(true, true, true, true), ev(EVENT_CREDENTIAL_READ), 0);
     TEST_ASSERT_EQUAL(door_cmd_t::NONE, a.door);
     TEST_ASSERT_EQUAL_UINT8(1, a.feedback_count);
     TEST_ASSERT_EQUAL(feedback_type_t::CARD_READ, a.feedback[0]);
@@ -57,7 +57,7 @@ void test_credential_read_online_shows_card_read_only(void) {
 
 void test_credential_read_offline_appends_system_error(void) {
     fsm_actions_t a = decide_system_event(
-        caps(true, true, true, false), ev(EVENT_CREDENTIAL_READ));
+        caps(true, true, true, false), ev(EVENT_CREDENTIAL_READ), 0);
     TEST_ASSERT_EQUAL(door_cmd_t::NONE, a.door);
     TEST_ASSERT_EQUAL_UINT8(2, a.feedback_count);
     TEST_ASSERT_EQUAL(feedback_type_t::CARD_READ,    a.feedback[0]);
@@ -66,18 +66,49 @@ void test_credential_read_offline_appends_system_error(void) {
 
 void test_feedback_absent_emits_no_indications(void) {
     fsm_actions_t a = decide_system_event(
-        caps(true, true, false, false), ev(EVENT_CREDENTIAL_READ));
+        caps(true, true, false, false), ev(EVENT_CREDENTIAL_READ), 0);
     TEST_ASSERT_EQUAL(door_cmd_t::NONE, a.door);
     TEST_ASSERT_EQUAL_UINT8(0, a.feedback_count);
 }
 
 void test_unknown_event_is_inert(void) {
     fsm_actions_t a = decide_system_event(
-        caps(true, true, true, true), ev(EVENT_HEARTBEAT));
+        caps(true, true, true, true), ev(EVENT_HEARTBEAT), 0);
     TEST_ASSERT_EQUAL(door_cmd_t::NONE, a.door);
     TEST_ASSERT_EQUAL_UINT8(0, a.feedback_count);
 }
 
+static portunus_event_t grant_with_deadline(int64_t deadline_ms) {
+    portunus_event_t e = ev(EVENT_ACCESS_GRANTED);
+    e.payload.access_decision.granted     = true;
+    e.payload.access_decision.deadline_ms = deadline_ms;
+    return e;
+}
+
+void test_grant_within_deadline_unlocks(void) {
+    fsm_actions_t a = decide_system_event(
+        caps(true, true, true, true), grant_with_deadline(3000), 2999);
+    TEST_ASSERT_FALSE(a.stale);
+    TEST_ASSERT_EQUAL(door_cmd_t::UNLOCK_AND_HOLD, a.door);
+    TEST_ASSERT_EQUAL(feedback_type_t::ACCESS_GRANTED, a.feedback[0]);
+}
+
+void test_grant_past_deadline_is_refused_as_deny(void) {
+    fsm_actions_t a = decide_system_event(
+        caps(true, true, true, true), grant_with_deadline(3000), 3000);
+    TEST_ASSERT_TRUE(a.stale);
+    TEST_ASSERT_EQUAL(door_cmd_t::NONE, a.door);
+    TEST_ASSERT_EQUAL_UINT8(1, a.feedback_count);
+    TEST_ASSERT_EQUAL(feedback_type_t::ACCESS_DENIED, a.feedback[0]);
+}
+
+void test_grant_without_deadline_never_goes_stale(void) {
+    fsm_actions_t a = decide_system_event(
+        caps(true, true, true, true), grant_with_deadline(0), 1000000);
+    TEST_ASSERT_FALSE(a.stale);
+    TEST_ASSERT_EQUAL(door_cmd_t::UNLOCK_AND_HOLD, a.door);
+}
+
 int main(void) {
     UNITY_BEGIN();
     RUN_TEST(test_granted_with_access_point_unlocks_and_holds);
@@ -87,5 +118,8 @@ int main(void) {
     RUN_TEST(test_credential_read_offline_appends_system_error);
     RUN_TEST(test_feedback_absent_emits_no_indications);
     RUN_TEST(test_unknown_event_is_inert);
+    RUN_TEST(test_grant_within_deadline_unlocks);
+    RUN_TEST(test_grant_past_deadline_is_refused_as_deny);
+    RUN_TEST(test_grant_without_deadline_never_goes_stale);
     return UNITY_END();
 }
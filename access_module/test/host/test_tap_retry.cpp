@@ -0,0 +1,280 @@
+/* Tier A host test: access-request retry policy.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler.
+ *
+ * The second half drives tap_retry_run() against a stand-in server on a
+ * simulated clock.  The stand-in silently drops connections that sit idle
+ * longer than its idle limit (no FIN, no RST — the client still thinks the
+ * connection is open) and answers a repeated nonce with the decision it
+ * already made, like the real server's replay store.  A repeat that arrives
+ * while that decision is still being made waits for it. */
+#include "unity.h"
+#include "tap_retry.hpp"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static const tap_retry_policy_t POLICY = { 2, 1000, 800, 5000 };
+
+/* ── Budget per attempt ─────────────────────────────────────────────────── */
+
+void test_reused_connection_gets_probe_budget(void) {
+    TEST_ASSERT_EQUAL_UINT32(1000, tap_retry_attempt_ms(&POLICY, 0, 3000, true));
+}
+
+void test_fresh_connection_gets_everything_left(void) {
+    TEST_ASSERT_EQUAL_UINT32(3000, tap_retry_attempt_ms(&POLICY, 0, 3000, false));
+}
+
+void test_last_attempt_is_not_capped(void) {
+    TEST_ASSERT_EQUAL_UINT32(2000, tap_retry_attempt_ms(&POLICY, 1, 2000, true));
+}
+
+void test_no_probe_when_retry_would_not_fit(void) {
+    /* 1500 - 1000 leaves less than min_attempt_ms, so spend it all now. */
+    TEST_ASSERT_EQUAL_UINT32(1500, tap_retry_attempt_ms(&POLICY, 0, 1500, true));
+}
+
+void test_budget_capped_at_rpc_timeout(void) {
+    TEST_ASSERT_EQUAL_UINT32(5000, tap_retry_attempt_ms(&POLICY, 0, INT64_MAX, false));
+}
+
+void test_retry_not_started_below_minimum(void) {
+    TEST_ASSERT_EQUAL_UINT32(0, tap_retry_attempt_ms(&POLICY, 1, 799, false));
+    TEST_ASSERT_EQUAL_UINT32(0, tap_retry_attempt_ms(&POLICY, 0, 0, false));
+    /* The first attempt is always made while any budget is left. */
+    TEST_ASSERT_EQUAL_UINT32(500, tap_retry_attempt_ms(&POLICY, 0, 500, false));
+}
+
+void test_only_connection_failures_are_retryable(void) {
+    TEST_ASSERT_TRUE(tap_retry_is_retryable(PORTUNUS_ERR_HTTP_CONNECT));
+    TEST_ASSERT_TRUE(tap_retry_is_retryable(PORTUNUS_ERR_TIMEOUT));
+    TEST_ASSERT_FALSE(tap_retry_is_retryable(PORTUNUS_OK));
+    TEST_ASSERT_FALSE(tap_retry_is_retryable(PORTUNUS_ERR_PROTO_DECODE));
+    TEST_ASSERT_FALSE(tap_retry_is_retryable(PORTUNUS_ERR_NO_MEMORY));
+}
+
+/* ── Stand-in server on a simulated clock ───────────────────────────────── */
+
+#define CONNECT_MS       400    /* TCP + TLS + HTTP/2 SETTINGS */
+#define RTT_MS            60
+#define TAP_BUDGET_MS   3000
+
+typedef struct {
+    /* stand-in server */
+    int64_t  idle_limit_ms;     /* silently forget connections idle this long */
+    int64_t  decide_ms;         /* time to reach a decision */
+    bool     reset_dead;        /* answer a dead connection with RST instead of silence */
+    uint32_t decisions;         /* fresh decisions made (repeats excluded) */
+    uint32_t decided_nonce;     /* nonce of the last decision */
+    int64_t  decided_at_ms;     /* when that decision is (or will be) made */
+    /* client */
+    int64_t  now_ms;
+    bool     open;              /* client's view of the connection */
+    int64_t  last_used_ms;
+    int64_t  deadline_ms;
+    uint32_t nonce;
+    uint32_t drops;
+} sim_t;
+
+static int64_t sim_remaining(void *ctx) {
+    sim_t *s = (sim_t *)ctx;
+    return s->deadline_ms - s->now_ms;
+}
+
+static bool sim_open(void *ctx) {
+    return ((sim_t *)ctx)->open;
+}
+
+static void sim_drop(void *ctx) {
+    sim_t *s = (sim_t *)ctx;
+    s->open = false;
+    s->drops++;
+}
+
+static portunus_err_t sim_attempt(void *ctx, uint32_t budget_ms) {
+    sim_t *s = (sim_t *)ctx;
+    int64_t spent = 0;
+
+    if (s->open && s->now_ms - s->last_used_ms >= s->idle_limit_ms) {
+        /* Half-open: the server forgot this connection long ago. */
+        if (s->reset_dead) {
+            s->now_ms += RTT_MS;
+            s->open = false;
+            return PORTUNUS_ERR_HTTP_CONNECT;
+        }
+        s->now_ms += budget_ms;
+        return PORTUNUS_ERR_TIMEOUT;
+    }
+    if (!s->open) {
+        if (CONNECT_MS > (int64_t)budget_ms) {
+            s->now_ms += budget_ms;
+            return PORTUNUS_ERR_TIMEOUT;
+        }
+        spent += CONNECT_MS;
+        s->open = true;
+    }
+
+    /* The request reaches the server even if the answer comes too late. */
+    int64_t arrive_ms = s->now_ms + spent + RTT_MS / 2;
+    bool repeat = (s->decisions > 0 && s->decided_nonce == s->nonce);
+    if (!repeat) {
+        s->decisions++;
+        s->decided_nonce = s->nonce;
+        s->decided_at_ms = arrive_ms + s->decide_ms;
+    }
+    int64_t done_ms = (s->decided_at_ms > arrive_ms) ? s->decided_at_ms : arrive_ms;
+    int64_t answer_ms = done_ms + RTT_MS / 2 - (s->now_ms + spent);
+    if (spent + answer_ms > (int64_t)budget_ms) {
+        s->now_ms += budget_ms;
+        return PORTUNUS_ERR_TIMEOUT;
+    }
+    s->now_ms += spent + answer_ms;
+    s->last_used_ms = s->now_ms;
+    return PORTUNUS_OK;
+}
+
+static const tap_retry_ops_t SIM_OPS = { sim_remaining, sim_open, sim_attempt, sim_drop };
+
+/** Tap at now_ms; true if the member got an answer (i.e. was not falsely denied). */
+static bool sim_tap(sim_t *s, const tap_retry_policy_t *policy, tap_retry_result_t *out) {
+    s->nonce++;
+    s->deadline_ms = s->now_ms + TAP_BUDGET_MS;
+    tap_retry_result_t r = tap_retry_run(policy, &SIM_OPS, s);
+    if (out != NULL) {
+        *out = r;
+    }
+    return r.err == PORTUNUS_OK && s->now_ms <= s->deadline_ms;
+}
+
+static sim_t sim_new(void) {
+    sim_t s = {};
+    s.idle_limit_ms = 30000;
+    s.decide_ms     = 40;
+    s.open          = true;
+    return s;
+}
+
+void test_half_open_connection_is_rescued_within_budget(void) {
+    sim_t s = sim_new();
+    s.now_ms = 60000;   /* idle past the server's limit */
+
+    tap_retry_result_t r;
+    TEST_ASSERT_TRUE(sim_tap(&s, &POLICY, &r));
+    TEST_ASSERT_EQUAL_UINT8(2, r.attempts);
+    TEST_ASSERT_EQUAL_UINT32(1, s.drops);
+    TEST_ASSERT_EQUAL_UINT32(1, s.decisions);
+}
+
+void test_reset_connection_is_retried_immediately(void) {
+    sim_t s = sim_new();
+    s.reset_dead = true;
+    s.now_ms = 60000;
+
+    tap_retry_result_t r;
+    TEST_ASSERT_TRUE(sim_tap(&s, &POLICY, &r));
+    TEST_ASSERT_EQUAL_UINT8(2, r.attempts);
+    TEST_ASSERT_LESS_THAN_UINT32(1000, (uint32_t)(TAP_BUDGET_MS - sim_remaining(&s)));
+}
+
+void test_slow_server_retry_gets_the_same_decision(void) {
+    /* Live connection but the server takes longer than the probe: the
+       retry carries the same nonce, so the server answers from its first
+       decision instead of deciding twice. */
+    sim_t s = sim_new();
+    s.decide_ms = 1200;
+
+    tap_retry_result_t r;
+    TEST_ASSERT_TRUE(sim_tap(&s, &POLICY, &r));
+    TEST_ASSERT_EQUAL_UINT8(2, r.attempts);
+    TEST_ASSERT_EQUAL_UINT32(1, s.decisions);
+}
+
+void test_retry_during_first_decision_waits_for_it(void) {
+    /* The retry reaches the server while the first attempt is still being
+       decided: it is answered when that decision is made, not at once. */
+    const tap_retry_policy_t fast_retry = { 2, 1000, 200, 5000 };
+    sim_t s = sim_new();
+    s.decide_ms = 2000;
+
+    tap_retry_result_t r;
+    int64_t tap_ms = s.now_ms;
+    TEST_ASSERT_TRUE(sim_tap(&s, &fast_retry, &r));
+    TEST_ASSERT_EQUAL_UINT8(2, r.attempts);
+    TEST_ASSERT_EQUAL_UINT32(1, s.decisions);
+    TEST_ASSERT_EQUAL_INT64(s.decided_at_ms + RTT_MS / 2, s.now_ms);
+    TEST_ASSERT_TRUE(s.now_ms - tap_ms > 2000);
+}
+
+void test_non_retryable_error_stops_after_one_attempt(void) {
+    struct ctx_t { uint32_t calls; } c = { 0 };
+    tap_retry_ops_t ops = {
+        [](void *) -> int64_t { return TAP_BUDGET_MS; },
+        [](void *) -> bool { return true; },
+        [](void *ctx, uint32_t) -> portunus_err_t {
+            ((ctx_t *)ctx)->calls++;
+            return PORTUNUS_ERR_PROTO_DECODE;
+        },
+        [](void *) {},
+    };
+    tap_retry_result_t r = tap_retry_run(&POLICY, &ops, &c);
+    TEST_ASSERT_EQUAL_HEX32(PORTUNUS_ERR_PROTO_DECODE, r.err);
+    TEST_ASSERT_EQUAL_UINT8(1, r.attempts);
+    TEST_ASSERT_EQUAL_UINT32(1, c.calls);
+}
+
+void test_spent_budget_makes_no_attempt(void) {
+    sim_t s = sim_new();
+    s.deadline_ms = s.now_ms;
+    tap_retry_result_t r = tap_retry_run(&POLICY, &SIM_OPS, &s);
+    TEST_ASSERT_EQUAL_UINT8(0, r.attempts);
+    TEST_ASSERT_EQUAL_HEX32(PORTUNUS_ERR_TIMEOUT, r.err);
+}
+
+/* Taps spaced 1 s .. 120 s apart against a server that forgets connections
+   after 30 s idle.  About three in four gaps outlive the connection; with a
+   single attempt the failed tap at least leaves a fresh connection for the
+   next one, so a bit under half of all taps are denied. */
+static uint32_t false_denies(const tap_retry_policy_t *policy, uint32_t taps) {
+    sim_t s = sim_new();
+    uint32_t lcg = 12345;
+    uint32_t denied = 0;
+    for (uint32_t i = 0; i < taps; i++) {
+        lcg = lcg * 1103515245u + 12345u;
+        s.now_ms += 1000 + (int64_t)((lcg >> 8) % 119000);
+        if (!sim_tap(&s, policy, NULL)) {
+            denied++;
+        }
+    }
+    return denied;
+}
+
+void test_false_deny_rate_before_and_after(void) {
+    const uint32_t taps = 1000;
+    const tap_retry_policy_t single = { 1, 1000, 800, 5000 };
+
+    uint32_t before = false_denies(&single, taps);
+    uint32_t after  = false_denies(&POLICY, taps);
+
+    TEST_ASSERT_GREATER_THAN_UINT32(taps / 4, before);
+    TEST_ASSERT_LESS_THAN_UINT32(taps / 2, before);
+    TEST_ASSERT_EQUAL_UINT32(0, after);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_reused_connection_gets_probe_budget);
+    RUN_TEST(test_fresh_connection_gets_everything_left);
+    RUN_TEST(test_last_attempt_is_not_capped);
+    RUN_TEST(test_no_probe_when_retry_would_not_fit);
+    RUN_TEST(test_budget_capped_at_rpc_timeout);
+    RUN_TEST(test_retry_not_started_below_minimum);
+    RUN_TEST(test_only_connection_failures_are_retryable);
+    RUN_TEST(test_half_open_connection_is_rescued_within_budget);
+    RUN_TEST(test_reset_connection_is_retried_immediately);
+    RUN_TEST(test_slow_server_retry_gets_the_same_decision);
+    RUN_TEST(test_retry_during_first_decision_waits_for_it);
+    RUN_TEST(test_non_retryable_error_stops_after_one_attempt);
+    RUN_TEST(test_spent_budget_makes_no_attempt);
+    RUN_TEST(test_false_deny_rate_before_and_after);
+    return UNITY_END();
+}
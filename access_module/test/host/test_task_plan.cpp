@@ -0,0 +1,123 @@
+/* Tier A host test: task affinity plan check.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "task_plan.hpp"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/* Default dual-core plan: network on core 0, I/O on core 1. */
+static const task_plan_entry_t PLAN[] = {
+    { "reactor",         TASK_GROUP_IO,  1, 5 },
+    { "credential_poll", TASK_GROUP_IO,  1, 4 },
+    { "server_comm",     TASK_GROUP_NET, 0, 2 },
+    { "wifi",            TASK_GROUP_NET, 0, TASK_PLAN_ANY_PRIO },
+};
+static const size_t N = sizeof(PLAN) / sizeof(PLAN[0]);
+
+static task_plan_report_t check(const task_plan_entry_t *plan, const task_observed_t *seen,
+                                uint8_t cores) {
+    task_plan_report_t r;
+    task_plan_check(plan, seen, N, cores, &r);
+    return r;
+}
+
+void test_matching_placement_confirms_isolation(void) {
+    const task_observed_t seen[] = {
+        { true, 1, 5 }, { true, 1, 4 }, { true, 0, 2 }, { true, 0, 23 },
+    };
+    task_plan_report_t r = check(PLAN, seen, 2);
+    TEST_ASSERT_TRUE(r.isolation);
+    TEST_ASSERT_EQUAL_UINT8(0, r.faults);
+    TEST_ASSERT_EQUAL_UINT8(2, r.cores);
+}
+
+void test_task_on_wrong_core_is_a_fault_and_breaks_isolation(void) {
+    const task_observed_t seen[] = {
+        { true, 1, 5 }, { true, 1, 4 }, { true, 1, 2 }, { true, 0, 23 },
+    };
+    task_plan_report_t r = check(PLAN, seen, 2);
+    TEST_ASSERT_FALSE(r.isolation);
+    TEST_ASSERT_EQUAL_UINT8(1, r.faults);
+    TEST_ASSERT_EQUAL_HEX32(1u << 2, r.fault_mask);
+}
+
+void test_priority_mismatch_is_a_fault(void) {
+    const task_observed_t seen[] = {
+        { true, 1, 9 }, { true, 1, 4 }, { true, 0, 2 }, { true, 0, 23 },
+    };
+    task_plan_report_t r = check(PLAN, seen, 2);
+    TEST_ASSERT_EQUAL_UINT8(1, r.faults);
+    TEST_ASSERT_EQUAL_HEX32(1u << 0, r.fault_mask);
+    TEST_ASSERT_FALSE(r.isolation);
+}
+
+void test_absent_tasks_are_skipped(void) {
+    const task_observed_t seen[] = {
+        { true, 1, 5 }, { false, 0, 0 }, { true, 0, 2 }, { false, 0, 0 },
+    };
+    task_plan_report_t r = check(PLAN, seen, 2);
+    TEST_ASSERT_EQUAL_UINT8(0, r.faults);
+    TEST_ASSERT_TRUE(r.isolation);
+}
+
+void test_same_core_for_both_groups_is_not_isolation(void) {
+    const task_plan_entry_t plan[] = {
+        { "reactor",         TASK_GROUP_IO,  0, 5 },
+        { "credential_poll", TASK_GROUP_IO,  0, 4 },
+        { "server_comm",     TASK_GROUP_NET, 0, 2 },
+        { "wifi",            TASK_GROUP_NET, 0, TASK_PLAN_ANY_PRIO },
+    };
+    const task_observed_t seen[] = {
+        { true, 0, 5 }, { true, 0, 4 }, { true, 0, 2 }, { true, 0, 23 },
+    };
+    task_plan_report_t r = check(plan, seen, 2);
+    TEST_ASSERT_EQUAL_UINT8(0, r.faults);
+    TEST_ASSERT_FALSE(r.isolation);
+}
+
+void test_single_core_unpinned_plan_degrades_without_faults(void) {
+    const task_plan_entry_t plan[] = {
+        { "reactor",         TASK_GROUP_IO,  TASK_PLAN_ANY_CORE, 5 },
+        { "credential_poll", TASK_GROUP_IO,  TASK_PLAN_ANY_CORE, 4 },
+        { "server_comm",     TASK_GROUP_NET, TASK_PLAN_ANY_CORE, 2 },
+        { "wifi",            TASK_GROUP_NET, TASK_PLAN_ANY_CORE, TASK_PLAN_ANY_PRIO },
+    };
+    const task_observed_t seen[] = {
+        { true, 0, 5 }, { true, 0, 4 }, { true, 0, 2 }, { true, 0, 23 },
+    };
+    task_plan_report_t r = check(plan, seen, 1);
+    TEST_ASSERT_EQUAL_UINT8(0, r.faults);
+    TEST_ASSERT_FALSE(r.isolation);
+    TEST_ASSERT_EQUAL_UINT8(1, r.cores);
+}
+
+void test_plan_naming_missing_core_is_a_fault(void) {
+    const task_observed_t seen[] = {
+        { true, 0, 5 }, { true, 0, 4 }, { true, 0, 2 }, { true, 0, 23 },
+    };
+    task_plan_report_t r = check(PLAN, seen, 1);
+    TEST_ASSERT_EQUAL_UINT8(2, r.faults);
+    TEST_ASSERT_FALSE(r.isolation);
+}
+
+void test_report_is_stored_for_heartbeat(void) {
+    TEST_ASSERT_EQUAL_UINT8(0, task_plan_get_report()->cores);
+    task_plan_report_t r = { 2, true, 0, 0 };
+    task_plan_set_report(&r);
+    TEST_ASSERT_TRUE(task_plan_get_report()->isolation);
+    TEST_ASSERT_EQUAL_UINT8(2, task_plan_get_report()->cores);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_matching_placement_confirms_isolation);
+    RUN_TEST(test_task_on_wrong_core_is_a_fault_and_breaks_isolation);
+    RUN_TEST(test_priority_mismatch_is_a_fault);
+    RUN_TEST(test_absent_tasks_are_skipped);
+    RUN_TEST(test_same_core_for_both_groups_is_not_isolation);
+    RUN_TEST(test_single_core_unpinned_plan_degrades_without_faults);
+    RUN_TEST(test_plan_naming_missing_core_is_a_fault);
+    RUN_TEST(test_report_is_stored_for_heartbeat);
+    return UNITY_END();
+}
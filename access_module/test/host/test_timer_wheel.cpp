@@ -0,0 +1,193 @@
+/* Tier A host test: reactor timer wheel.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "timer_wheel.hpp"
+
+static timer_wheel_t s_wheel;
+
+void setUp(void) { timer_wheel_init(&s_wheel); }
+void tearDown(void) {}
+
+static void count_cb(void *ctx) { (*static_cast<int *>(ctx))++; }
+
+/** Advance @p ticks, running every expired callback. */
+static void run_ticks(uint32_t ticks) {
+    for (uint32_t i = 0; i < ticks; i++) {
+        for (wheel_timer_t *t = timer_wheel_advance(&s_wheel); t != nullptr; t = t->fire_next) {
+            if (timer_wheel_still_due(t)) {
+                t->cb(t->ctx);
+            }
+        }
+    }
+}
+
+static void arm(wheel_timer_t *t, int *counter, uint32_t delay, uint32_t period) {
+    t->cb  = count_cb;
+    t->ctx = counter;
+    timer_wheel_arm(&s_wheel, t, delay, period);
+}
+
+void test_one_shot_fires_once_on_its_tick(void) {
+    wheel_timer_t t = {};
+    int fired = 0;
+    arm(&t, &fired, 5, 0);
+    run_ticks(4);
+    TEST_ASSERT_EQUAL_INT(0, fired);
+    run_ticks(1);
+    TEST_ASSERT_EQUAL_INT(1, fired);
+    TEST_ASSERT_FALSE(t.armed);
+    run_ticks(200);
+    TEST_ASSERT_EQUAL_INT(1, fired);
+}
+
+void test_zero_delay_means_next_tick(void) {
+    wheel_timer_t t = {};
+    int fired = 0;
+    arm(&t, &fired, 0, 0);
+    run_ticks(1);
+    TEST_ASSERT_EQUAL_INT(1, fired);
+}
+
+void test_delay_beyond_one_revolution_waits_full_rounds(void) {
+    wheel_timer_t t = {};
+    int fired = 0;
+    const uint32_t delay = 3 * TIMER_WHEEL_SLOTS + 7;
+    arm(&t, &fired, delay, 0);
+    TEST_ASSERT_EQUAL_UINT32(delay, timer_wheel_ticks_to_next(&s_wheel));
+    run_ticks(delay - 1);
+    TEST_ASSERT_EQUAL_INT(0, fired);
+    run_ticks(1);
+    TEST_ASSERT_EQUAL_INT(1, fired);
+}
+
+void test_periodic_timer_does_not_drift(void) {
+    wheel_timer_t t = {};
+    int fired = 0;
+    arm(&t, &fired, 5, 5);
+    run_ticks(1000);
+    TEST_ASSERT_EQUAL_INT(200, fired);
+}
+
+void test_period_equal_to_ring_size(void) {
+    wheel_timer_t t = {};
+    int fired = 0;
+    arm(&t, &fired, TIMER_WHEEL_SLOTS, TIMER_WHEEL_SLOTS);
+    run_ticks(10 * TIMER_WHEEL_SLOTS);
+    TEST_ASSERT_EQUAL_INT(10, fired);
+}
+
+void test_disarm_prevents_expiry(void) {
+    wheel_timer_t a = {}, b = {}, c = {};
+    int fa = 0, fb = 0, fc = 0;
+    arm(&a, &fa, 3, 0);
+    arm(&b, &fb, 3, 0);  /* same bucket as a */
+    arm(&c, &fc, 3, 0);
+    timer_wheel_disarm(&s_wheel, &b);
+    timer_wheel_disarm(&s_wheel, &b);  /* idempotent */
+    run_ticks(3);
+    TEST_ASSERT_EQUAL_INT(1, fa);
+    TEST_ASSERT_EQUAL_INT(0, fb);
+    TEST_ASSERT_EQUAL_INT(1, fc);
+    TEST_ASSERT_EQUAL_UINT32(0, s_wheel.armed);
+}
+
+void test_rearm_replaces_pending_expiry(void) {
+    wheel_timer_t t = {};
+    int fired = 0;
+    arm(&t, &fired, 2, 0);
+    run_ticks(1);
+    arm(&t, &fired, 10, 0);
+    run_ticks(5);
+    TEST_ASSERT_EQUAL_INT(0, fired);
+    run_ticks(5);
+    TEST_ASSERT_EQUAL_INT(1, fired);
+    TEST_ASSERT_EQUAL_UINT32(0, s_wheel.armed);
+}
+
+void test_ticks_to_next_tracks_earliest_timer(void) {
+    wheel_timer_t far = {}, near = {};
+    int f = 0;
+    TEST_ASSERT_EQUAL_UINT32(TIMER_WHEEL_NONE, timer_wheel_ticks_to_next(&s_wheel));
+    arm(&far, &f, 2 * TIMER_WHEEL_SLOTS + 1, 0);  /* same bucket as `near`, later round */
+    arm(&near, &f, 40, 0);
+    TEST_ASSERT_EQUAL_UINT32(40, timer_wheel_ticks_to_next(&s_wheel));
+    run_ticks(40);
+    TEST_ASSERT_EQUAL_UINT32(2 * TIMER_WHEEL_SLOTS + 1 - 40, timer_wheel_ticks_to_next(&s_wheel));
+}
+
+/* A callback stopping another timer due on the same tick must not corrupt
+ * the expired list handed back by advance(). */
+static wheel_timer_t s_victim;
+static void stop_victim_cb(void *ctx) {
+    (*static_cast<int *>(ctx))++;
+    timer_wheel_disarm(&s_wheel, &s_victim);
+}
+
+void test_callback_may_disarm_timer_in_same_batch(void) {
+    wheel_timer_t killer = {};
+    int fk = 0, fv = 0;
+    s_victim = {};
+    arm(&s_victim, &fv, 4, 4);
+    killer.cb  = stop_victim_cb;
+    killer.ctx = &fk;
+    timer_wheel_arm(&s_wheel, &killer, 4, 0);
+    run_ticks(4);
+    TEST_ASSERT_EQUAL_INT(1, fk);
+    TEST_ASSERT_FALSE(s_victim.armed);
+    run_ticks(20);
+    TEST_ASSERT_TRUE(fv <= 1);
+    TEST_ASSERT_EQUAL_UINT32(0, s_wheel.armed);
+}
+
+void test_timer_stopped_after_expiry_is_not_due(void) {
+    wheel_timer_t a = {}, b = {};
+    int fa = 0, fb = 0;
+    arm(&a, &fa, 3, 0);
+    arm(&b, &fb, 3, 3);
+    run_ticks(2);
+    wheel_timer_t *expired = timer_wheel_advance(&s_wheel);
+    TEST_ASSERT_NOT_NULL(expired);
+    TEST_ASSERT_NOT_NULL(expired->fire_next);
+    TEST_ASSERT_TRUE(timer_wheel_still_due(&a));
+    TEST_ASSERT_TRUE(timer_wheel_still_due(&b));
+
+    /* Stopped or restarted while the batch is being run. */
+    timer_wheel_disarm(&s_wheel, &a);
+    timer_wheel_arm(&s_wheel, &b, 10, 0);
+    TEST_ASSERT_FALSE(timer_wheel_still_due(&a));
+    TEST_ASSERT_FALSE(timer_wheel_still_due(&b));
+
+    run_ticks(10);
+    TEST_ASSERT_EQUAL_INT(0, fa);
+    TEST_ASSERT_EQUAL_INT(1, fb);
+}
+
+void test_victim_stopped_earlier_in_batch_does_not_fire(void) {
+    wheel_timer_t killer = {};
+    int fk = 0, fv = 0;
+    s_victim = {};
+    /* Armed first, so the victim sits behind the killer in the batch. */
+    killer.cb  = stop_victim_cb;
+    killer.ctx = &fk;
+    timer_wheel_arm(&s_wheel, &killer, 4, 0);
+    arm(&s_victim, &fv, 4, 4);
+    run_ticks(24);
+    TEST_ASSERT_EQUAL_INT(1, fk);
+    TEST_ASSERT_EQUAL_INT(0, fv);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_one_shot_fires_once_on_its_tick);
+    RUN_TEST(test_zero_delay_means_next_tick);
+    RUN_TEST(test_delay_beyond_one_revolution_waits_full_rounds);
+    RUN_TEST(test_periodic_timer_does_not_drift);
+    RUN_TEST(test_period_equal_to_ring_size);
+    RUN_TEST(test_disarm_prevents_expiry);
+    RUN_TEST(test_rearm_replaces_pending_expiry);
+    RUN_TEST(test_ticks_to_next_tracks_earliest_timer);
+    RUN_TEST(test_callback_may_disarm_timer_in_same_batch);
+    RUN_TEST(test_timer_stopped_after_expiry_is_not_due);
+    RUN_TEST(test_victim_stopped_earlier_in_batch_does_not_fire);
+    return UNITY_END();
+}
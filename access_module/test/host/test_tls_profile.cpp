@@ -0,0 +1,94 @@
+/* Tier A host test: transport profiles.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig.  Links upstream mbedtls.
+ *
+ * What each profile offers is checked on the wire by bench_tls_profiles
+ * (ctest runs it --quick against its stand-in server); this covers the
+ * choices made before a handshake starts. */
+#include "unity.h"
+#include "tls_profile.hpp"
+
+#include <string.h>
+
+static const uint8_t k_key[32] = { 1, 2, 3, 4 };
+
+static mbedtls_ssl_config conf;
+
+void setUp(void) {
+    mbedtls_ssl_config_init(&conf);
+    mbedtls_ssl_config_defaults(&conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                MBEDTLS_SSL_PRESET_DEFAULT);
+}
+void tearDown(void) {
+    mbedtls_ssl_config_free(&conf);
+}
+
+static tls_profile_t psk(const uint8_t *key, size_t len, const char *id, bool dhe) {
+    tls_profile_t p = {};
+    p.id           = TLS_PROFILE_PSK;
+    p.psk          = key;
+    p.psk_len      = len;
+    p.psk_identity = id;
+    p.psk_dhe      = dhe;
+    return p;
+}
+
+void test_zeroed_config_is_compat(void) {
+    tls_profile_t p = {};
+    TEST_ASSERT_EQUAL_INT(TLS_PROFILE_COMPAT, p.id);
+    TEST_ASSERT_TRUE(tls_profile_valid(&p));
+    TEST_ASSERT_FALSE(tls_profile_skips_certificates(&p));
+    TEST_ASSERT_EQUAL_STRING("compat", tls_profile_name(&p));
+    TEST_ASSERT_EQUAL_INT(0, tls_profile_apply(&p, &conf));
+}
+
+void test_ecc_keeps_certificates(void) {
+    tls_profile_t p = {};
+    p.id = TLS_PROFILE_ECC;
+    TEST_ASSERT_TRUE(tls_profile_valid(&p));
+    TEST_ASSERT_FALSE(tls_profile_skips_certificates(&p));
+    TEST_ASSERT_EQUAL_STRING("ecc", tls_profile_name(&p));
+    TEST_ASSERT_EQUAL_INT(0, tls_profile_apply(&p, &conf));
+}
+
+void test_psk_needs_a_key_and_an_identity(void) {
+    tls_profile_t p = psk(k_key, sizeof(k_key), "door-001", false);
+    TEST_ASSERT_TRUE(tls_profile_valid(&p));
+    TEST_ASSERT_TRUE(tls_profile_skips_certificates(&p));
+
+    p = psk(NULL, 0, "door-001", false);
+    TEST_ASSERT_FALSE(tls_profile_valid(&p));
+    p = psk(k_key, sizeof(k_key), "", false);
+    TEST_ASSERT_FALSE(tls_profile_valid(&p));
+    p = psk(k_key, sizeof(k_key), NULL, false);
+    TEST_ASSERT_FALSE(tls_profile_valid(&p));
+    p = psk(k_key, TLS_PROFILE_PSK_MAX_LEN + 1, "door-001", false);
+    TEST_ASSERT_FALSE(tls_profile_valid(&p));
+}
+
+void test_invalid_profile_is_not_applied(void) {
+    tls_profile_t p = psk(NULL, 0, "door-001", false);
+    TEST_ASSERT_EQUAL_INT(MBEDTLS_ERR_SSL_BAD_INPUT_DATA, tls_profile_apply(&p, &conf));
+}
+
+void test_psk_applies(void) {
+    tls_profile_t p = psk(k_key, sizeof(k_key), "door-001", false);
+    TEST_ASSERT_EQUAL_STRING("psk", tls_profile_name(&p));
+    TEST_ASSERT_EQUAL_INT(0, tls_profile_apply(&p, &conf));
+}
+
+void test_psk_dhe_applies(void) {
+    tls_profile_t p = psk(k_key, sizeof(k_key), "door-001", true);
+    TEST_ASSERT_EQUAL_STRING("psk_dhe", tls_profile_name(&p));
+    TEST_ASSERT_EQUAL_INT(0, tls_profile_apply(&p, &conf));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_zeroed_config_is_compat);
+    RUN_TEST(test_ecc_keeps_certificates);
+    RUN_TEST(test_psk_needs_a_key_and_an_identity);
+    RUN_TEST(test_invalid_profile_is_not_applied);
+    RUN_TEST(test_psk_applies);
+    RUN_TEST(test_psk_dhe_applies);
+    return UNITY_END();
+}
@@ -0,0 +1,149 @@
+/* Tier A host test: server trust anchors and the SPKI pin.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig.  Links upstream mbedtls.
+ *
+ * Certificates come from tls_fixtures.h: a CA and a server certificate
+ * for TLS_FIXTURE_HOST, and an unrelated "rogue" pair.  Chain checks run
+ * mbedtls_x509_crt_verify() with the CA chain and verify callback
+ * tls_trust_attach() put in an ssl config, as the handshake would;
+ * bench_tls_handshake runs real handshakes. */
+#include "unity.h"
+#include "tls_trust.hpp"
+#include "tls_fixtures.h"
+
+#include <string.h>
+
+static tls_trust_t        t;
+static mbedtls_x509_crt   server;
+static mbedtls_x509_crt   rogue;
+static mbedtls_ssl_config conf;
+
+/* Verify @p crt for @p host as a handshake under tls_trust_attach() would. */
+static int attached_verify(mbedtls_x509_crt *crt, const char *host, uint32_t *flags) {
+    mbedtls_ssl_config_init(&conf);
+    tls_trust_attach(&t, &conf);
+    int ret = mbedtls_x509_crt_verify(crt, conf.MBEDTLS_PRIVATE(ca_chain), NULL, host, flags,
+                                      conf.MBEDTLS_PRIVATE(f_vrfy), conf.MBEDTLS_PRIVATE(p_vrfy));
+    mbedtls_ssl_config_free(&conf);
+    return ret;
+}
+
+void setUp(void) {
+    memset(&t, 0, sizeof(t));
+    mbedtls_x509_crt_init(&t.chain);
+    mbedtls_x509_crt_init(&t.no_chain);
+    mbedtls_x509_crt_init(&server);
+    mbedtls_x509_crt_init(&rogue);
+    TEST_ASSERT_EQUAL_INT(0, mbedtls_x509_crt_parse_der(&server, k_rsa_server_der,
+                                                        sizeof(k_rsa_server_der)));
+    TEST_ASSERT_EQUAL_INT(0, mbedtls_x509_crt_parse_der(&rogue, k_rogue_server_der,
+                                                        sizeof(k_rogue_server_der)));
+}
+void tearDown(void) {
+    tls_trust_free(&t);
+    mbedtls_x509_crt_free(&server);
+    mbedtls_x509_crt_free(&rogue);
+}
+
+void test_ca_is_parsed_in_place(void) {
+    TEST_ASSERT_TRUE(tls_trust_init(&t, k_rsa_ca_der, sizeof(k_rsa_ca_der), NULL));
+    TEST_ASSERT_TRUE(t.has_chain);
+    TEST_ASSERT_FALSE(t.has_pin);
+    TEST_ASSERT_TRUE(tls_trust_configured(&t));
+    /* No copy: the chain points at the embedded DER. */
+    TEST_ASSERT_TRUE(t.chain.raw.p == k_rsa_ca_der);
+}
+
+void test_garbage_ca_is_refused(void) {
+    static const uint8_t junk[] = { 0x30, 0x82, 0x01, 0x00, 0xde, 0xad };
+    TEST_ASSERT_FALSE(tls_trust_init(&t, junk, sizeof(junk), NULL));
+    TEST_ASSERT_FALSE(tls_trust_configured(&t));
+}
+
+void test_nothing_configured(void) {
+    TEST_ASSERT_TRUE(tls_trust_init(&t, NULL, 0, NULL));
+    TEST_ASSERT_FALSE(tls_trust_configured(&t));
+}
+
+void test_chain_accepts_its_server_only(void) {
+    tls_trust_init(&t, k_rsa_ca_der, sizeof(k_rsa_ca_der), NULL);
+    uint32_t flags = 0;
+    TEST_ASSERT_EQUAL_INT(0, attached_verify(&server, TLS_FIXTURE_HOST, &flags));
+    TEST_ASSERT_NOT_EQUAL(0, attached_verify(&rogue, TLS_FIXTURE_HOST, &flags));
+    TEST_ASSERT_NOT_EQUAL(0, attached_verify(&server, "other.test", &flags));
+}
+
+void test_spki_hash_matches_the_openssl_pin(void) {
+    uint8_t h[TLS_TRUST_PIN_LEN];
+    TEST_ASSERT_TRUE(tls_trust_spki_sha256(&server, h));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(k_rsa_server_spki_sha256, h, TLS_TRUST_PIN_LEN);
+}
+
+void test_pin_alone_accepts_the_pinned_key(void) {
+    tls_trust_init(&t, NULL, 0, k_rsa_server_spki_sha256);
+    uint32_t flags = 0;
+    /* No CA at all: the pin is the anchor, and the name is not checked. */
+    TEST_ASSERT_EQUAL_INT(0, attached_verify(&server, "other.test", &flags));
+    TEST_ASSERT_EQUAL_UINT32(0, flags);
+    TEST_ASSERT_EQUAL_UINT32(0, t.pin_mismatches);
+}
+
+void test_pin_refuses_any_other_key(void) {
+    tls_trust_init(&t, NULL, 0, k_rsa_server_spki_sha256);
+    uint32_t flags = 0;
+    TEST_ASSERT_EQUAL_INT(MBEDTLS_ERR_X509_FATAL_ERROR,
+                          attached_verify(&rogue, TLS_FIXTURE_HOST, &flags));
+    TEST_ASSERT_EQUAL_UINT32(1, t.pin_mismatches);
+}
+
+void test_pin_wins_over_a_ca_that_would_refuse(void) {
+    /* The rogue CA is configured too, but with a pin it is not consulted. */
+    tls_trust_init(&t, k_rogue_ca_der, sizeof(k_rogue_ca_der), k_rsa_server_spki_sha256);
+    uint32_t flags = 0;
+    TEST_ASSERT_EQUAL_INT(0, attached_verify(&server, TLS_FIXTURE_HOST, &flags));
+}
+
+void test_parse_pin(void) {
+    uint8_t pin[TLS_TRUST_PIN_LEN];
+    TEST_ASSERT_TRUE(tls_trust_parse_pin(
+        "00112233445566778899AABBCCDDEEFF00112233445566778899aabbccddeeff", pin));
+    TEST_ASSERT_EQUAL_HEX8(0x00, pin[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xaa, pin[10]);
+    TEST_ASSERT_EQUAL_HEX8(0xff, pin[31]);
+
+    TEST_ASSERT_FALSE(tls_trust_parse_pin("", pin));
+    TEST_ASSERT_FALSE(tls_trust_parse_pin("0011", pin));
+    TEST_ASSERT_FALSE(tls_trust_parse_pin(
+        "00112233445566778899AABBCCDDEEFF00112233445566778899aabbccddeefg", pin));
+    TEST_ASSERT_FALSE(tls_trust_parse_pin(
+        "00112233445566778899AABBCCDDEEFF00112233445566778899aabbccddeeff00", pin));
+    TEST_ASSERT_FALSE(tls_trust_parse_pin(NULL, pin));
+}
+
+void test_parse_hex_returns_length(void) {
+    uint8_t buf[4];
+    TEST_ASSERT_EQUAL_size_t(2, tls_trust_parse_hex("a0Ff", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_HEX8(0xa0, buf[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xff, buf[1]);
+    TEST_ASSERT_EQUAL_size_t(4, tls_trust_parse_hex("0011aabb", buf, sizeof(buf)));
+
+    TEST_ASSERT_EQUAL_size_t(0, tls_trust_parse_hex("0011aabbcc", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_size_t(0, tls_trust_parse_hex("001", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_size_t(0, tls_trust_parse_hex("0x", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_size_t(0, tls_trust_parse_hex("", buf, sizeof(buf)));
+    TEST_ASSERT_EQUAL_size_t(0, tls_trust_parse_hex(NULL, buf, sizeof(buf)));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_ca_is_parsed_in_place);
+    RUN_TEST(test_garbage_ca_is_refused);
+    RUN_TEST(test_nothing_configured);
+    RUN_TEST(test_chain_accepts_its_server_only);
+    RUN_TEST(test_spki_hash_matches_the_openssl_pin);
+    RUN_TEST(test_pin_alone_accepts_the_pinned_key);
+    RUN_TEST(test_pin_refuses_any_other_key);
+    RUN_TEST(test_pin_wins_over_a_ca_that_would_refuse);
+    RUN_TEST(test_parse_pin);
+    RUN_TEST(test_parse_hex_returns_length);
+    return UNITY_END();
+}
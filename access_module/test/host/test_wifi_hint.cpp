@@ -0,0 +1,203 @@
+/* Tier A host test: saved AP hint and fast-reconnect policy.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "wifi_hint.hpp"
+
+#include <string.h>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static const uint8_t k_ap1[6] = {0x24, 0x0a, 0xc4, 0x01, 0x02, 0x03};
+static const uint8_t k_ap2[6] = {0x24, 0x0a, 0xc4, 0x0a, 0x0b, 0x0c};
+
+/* One connect that associates with @p bssid and gets an IP 300 ms later. */
+static bool connect_to(wifi_hint_tracker_t *t, int64_t now_ms,
+                       const uint8_t bssid[6], uint8_t channel) {
+    wifi_hint_tracker_associated(t, now_ms, bssid, channel);
+    return wifi_hint_tracker_connected(t, now_ms + 300);
+}
+
+void test_hint_round_trips_for_its_ssid_only(void) {
+    wifi_hint_t h;
+    wifi_hint_set(&h, "site-net", k_ap1, 6);
+    TEST_ASSERT_TRUE(wifi_hint_valid(&h, "site-net"));
+    TEST_ASSERT_FALSE(wifi_hint_valid(&h, "other-net"));
+}
+
+void test_corrupt_or_blank_hint_is_invalid(void) {
+    wifi_hint_t h;
+    memset(&h, 0, sizeof(h));
+    TEST_ASSERT_FALSE(wifi_hint_valid(&h, "site-net"));
+
+    wifi_hint_set(&h, "site-net", k_ap1, 6);
+    h.channel = 11;     /* a torn write */
+    TEST_ASSERT_FALSE(wifi_hint_valid(&h, "site-net"));
+}
+
+void test_no_saved_hint_scans_and_learns_the_ap(void) {
+    wifi_hint_tracker_t t;
+    wifi_hint_tracker_init(&t, "site-net", NULL);
+    TEST_ASSERT_EQUAL(WIFI_CONNECT_SCAN, wifi_hint_tracker_begin(&t));
+    TEST_ASSERT_TRUE(connect_to(&t, 1000, k_ap1, 6));
+
+    /* The next connect goes straight to it. */
+    TEST_ASSERT_EQUAL(WIFI_CONNECT_HINTED, wifi_hint_tracker_begin(&t));
+    TEST_ASSERT_EQUAL_UINT8(6, t.hint.channel);
+    TEST_ASSERT_EQUAL_MEMORY(k_ap1, t.hint.bssid, 6);
+}
+
+void test_saved_hint_is_used_and_not_rewritten_when_unchanged(void) {
+    wifi_hint_t saved;
+    wifi_hint_set(&saved, "site-net", k_ap1, 6);
+    wifi_hint_tracker_t t;
+    wifi_hint_tracker_init(&t, "site-net", &saved);
+
+    TEST_ASSERT_EQUAL(WIFI_CONNECT_HINTED, wifi_hint_tracker_begin(&t));
+    TEST_ASSERT_FALSE(connect_to(&t, 1000, k_ap1, 6));
+    TEST_ASSERT_EQUAL_UINT32(1, t.stats.connects);
+    TEST_ASSERT_EQUAL_UINT32(1, t.stats.hinted_connects);
+}
+
+void test_hint_for_another_ssid_is_ignored(void) {
+    wifi_hint_t saved;
+    wifi_hint_set(&saved, "old-net", k_ap1, 6);
+    wifi_hint_tracker_t t;
+    wifi_hint_tracker_init(&t, "site-net", &saved);
+    TEST_ASSERT_EQUAL(WIFI_CONNECT_SCAN, wifi_hint_tracker_begin(&t));
+}
+
+void test_failed_hint_is_retried_then_dropped_for_a_scan(void) {
+    wifi_hint_t saved;
+    wifi_hint_set(&saved, "site-net", k_ap1, 6);
+    wifi_hint_tracker_t t;
+    wifi_hint_tracker_init(&t, "site-net", &saved);
+
+    for (int i = 0; i < WIFI_HINT_MAX_MISSES; i++) {
+        TEST_ASSERT_EQUAL(WIFI_CONNECT_HINTED, wifi_hint_tracker_begin(&t));
+        TEST_ASSERT_TRUE(wifi_hint_tracker_disconnected(&t));   /* retry now */
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, t.stats.scan_fallbacks);
+
+    /* The AP moved to channel 11; the scan finds it and it is saved. */
+    TEST_ASSERT_EQUAL(WIFI_CONNECT_SCAN, wifi_hint_tracker_begin(&t));
+    TEST_ASSERT_TRUE(connect_to(&t, 5000, k_ap1, 11));
+    TEST_ASSERT_EQUAL(WIFI_CONNECT_HINTED, wifi_hint_tracker_begin(&t));
+    TEST_ASSERT_EQUAL_UINT8(11, t.hint.channel);
+}
+
+void test_failed_scan_backs_off(void) {
+    wifi_hint_tracker_t t;
+    wifi_hint_tracker_init(&t, "site-net", NULL);
+    wifi_hint_tracker_begin(&t);
+    TEST_ASSERT_FALSE(wifi_hint_tracker_disconnected(&t));
+}
+
+void test_lost_link_keeps_the_hint(void) {
+    wifi_hint_t saved;
+    wifi_hint_set(&saved, "site-net", k_ap1, 6);
+    wifi_hint_tracker_t t;
+    wifi_hint_tracker_init(&t, "site-net", &saved);
+    wifi_hint_tracker_begin(&t);
+    connect_to(&t, 1000, k_ap1, 6);
+
+    /* The AP rebooted: not a failed attempt, no immediate retry. */
+    TEST_ASSERT_FALSE(wifi_hint_tracker_disconnected(&t));
+    TEST_ASSERT_EQUAL(WIFI_CONNECT_HINTED, wifi_hint_tracker_begin(&t));
+}
+
+void test_one_miss_then_success_resets_the_count(void) {
+    wifi_hint_t saved;
+    wifi_hint_set(&saved, "site-net", k_ap1, 6);
+    wifi_hint_tracker_t t;
+    wifi_hint_tracker_init(&t, "site-net", &saved);
+
+    wifi_hint_tracker_begin(&t);
+    wifi_hint_tracker_disconnected(&t);
+    wifi_hint_tracker_begin(&t);
+    connect_to(&t, 1000, k_ap1, 6);
+
+    wifi_hint_tracker_disconnected(&t);         /* lost link */
+    wifi_hint_tracker_begin(&t);
+    wifi_hint_tracker_disconnected(&t);         /* one miss again */
+    TEST_ASSERT_EQUAL(WIFI_CONNECT_HINTED, wifi_hint_tracker_begin(&t));
+    TEST_ASSERT_EQUAL_UINT32(0, t.stats.scan_fallbacks);
+}
+
+void test_roamed_ap_replaces_the_hint(void) {
+    wifi_hint_t saved;
+    wifi_hint_set(&saved, "site-net", k_ap1, 6);
+    wifi_hint_tracker_t t;
+    wifi_hint_tracker_init(&t, "site-net", &saved);
+    wifi_hint_tracker_begin(&t);
+    TEST_ASSERT_TRUE(connect_to(&t, 1000, k_ap2, 1));
+    TEST_ASSERT_EQUAL_MEMORY(k_ap2, t.hint.bssid, 6);
+    TEST_ASSERT_TRUE(wifi_hint_valid(&t.hint, "site-net"));
+}
+
+void test_assoc_to_ip_is_timed_per_connect(void) {
+    wifi_hint_tracker_t t;
+    wifi_hint_tracker_init(&t, "site-net", NULL);
+
+    wifi_hint_tracker_begin(&t);
+    wifi_hint_tracker_associated(&t, 1000, k_ap1, 6);
+    wifi_hint_tracker_connected(&t, 3400);          /* DHCP: 2.4 s */
+    TEST_ASSERT_EQUAL_UINT32(2400, t.stats.assoc_to_ip_ms);
+
+    wifi_hint_tracker_disconnected(&t);
+    wifi_hint_tracker_begin(&t);
+    wifi_hint_tracker_associated(&t, 90000, k_ap1, 6);
+    wifi_hint_tracker_connected(&t, 90040);         /* static IP */
+    TEST_ASSERT_EQUAL_UINT32(40, t.stats.assoc_to_ip_ms);
+    TEST_ASSERT_EQUAL_UINT32(2400, t.stats.assoc_to_ip_max_ms);
+    TEST_ASSERT_EQUAL_UINT32(2, t.stats.connects);
+}
+
+void test_ip_without_a_connect_is_not_counted(void) {
+    wifi_hint_tracker_t t;
+    wifi_hint_tracker_init(&t, "site-net", NULL);
+    wifi_hint_tracker_begin(&t);
+    connect_to(&t, 1000, k_ap1, 6);
+
+    /* DHCP handed out a new address on the standing link. */
+    TEST_ASSERT_FALSE(wifi_hint_tracker_connected(&t, 60000));
+    TEST_ASSERT_EQUAL_UINT32(1, t.stats.connects);
+    TEST_ASSERT_EQUAL_UINT32(300, t.stats.assoc_to_ip_ms);
+}
+
+void test_roam_reconnects_at_once_to_the_target(void) {
+    wifi_hint_t saved;
+    wifi_hint_set(&saved, "site-net", k_ap1, 6);
+    wifi_hint_tracker_t t;
+    wifi_hint_tracker_init(&t, "site-net", &saved);
+    wifi_hint_tracker_begin(&t);
+    connect_to(&t, 1000, k_ap1, 6);
+
+    wifi_hint_tracker_roam(&t, k_ap2, 11);
+    TEST_ASSERT_TRUE(wifi_hint_tracker_disconnected(&t));
+    TEST_ASSERT_EQUAL(WIFI_CONNECT_HINTED, wifi_hint_tracker_begin(&t));
+    TEST_ASSERT_EQUAL_MEMORY(k_ap2, t.hint.bssid, 6);
+    TEST_ASSERT_EQUAL_UINT8(11, t.hint.channel);
+
+    /* Landing there saves it. */
+    TEST_ASSERT_TRUE(connect_to(&t, 9000, k_ap2, 11));
+    TEST_ASSERT_EQUAL_UINT32(0, t.stats.scan_fallbacks);
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_hint_round_trips_for_its_ssid_only);
+    RUN_TEST(test_corrupt_or_blank_hint_is_invalid);
+    RUN_TEST(test_no_saved_hint_scans_and_learns_the_ap);
+    RUN_TEST(test_saved_hint_is_used_and_not_rewritten_when_unchanged);
+    RUN_TEST(test_hint_for_another_ssid_is_ignored);
+    RUN_TEST(test_failed_hint_is_retried_then_dropped_for_a_scan);
+    RUN_TEST(test_failed_scan_backs_off);
+    RUN_TEST(test_lost_link_keeps_the_hint);
+    RUN_TEST(test_one_miss_then_success_resets_the_count);
+    RUN_TEST(test_roamed_ap_replaces_the_hint);
+    RUN_TEST(test_assoc_to_ip_is_timed_per_connect);
+    RUN_TEST(test_ip_without_a_connect_is_not_counted);
+    RUN_TEST(test_roam_reconnects_at_once_to_the_target);
+    return UNITY_END();
+}
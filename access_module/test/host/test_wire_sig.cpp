@@ -0,0 +1,105 @@
+/* Tier A host test: protocol v2 signing projections.  bench_hot_path times
+ * them against the v0 text path they replace.
+ * No ESP-IDF, no FreeRTOS, no sdkconfig. Bare host compiler. */
+#include "unity.h"
+#include "wire_sig.hpp"
+
+#include <stdio.h>
+#include <string.h>
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static const uint8_t k_nonce[16] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+    0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+};
+
+static void assert_hex(const char *want, const uint8_t *got, size_t len) {
+    char hex[2 * WIRE_SIG_MAX_LEN + 1];
+    for (size_t i = 0; i < len; i++) {
+        snprintf(&hex[i * 2], 3, "%02x", got[i]);
+    }
+    hex[len * 2] = '\0';
+    TEST_ASSERT_EQUAL_STRING(want, hex);
+}
+
+/* ── Layout ─────────────────────────────────────────────────────────────── */
+
+/* Same inputs and bytes as TestGoldenProjections in
+   server/internal/wiresig/wiresig_test.go. */
+void test_golden_projections_match_server(void) {
+    uint8_t b[WIRE_SIG_MAX_LEN];
+    size_t n;
+
+    n = wire_sig_heartbeat(b, sizeof(b), "door-1", 0x01020304);
+    assert_hex("4802" "06646f6f722d31" "04030201", b, n);
+
+    n = wire_sig_access(b, sizeof(b), "door-1", "04:A3:2B:1C",
+                        k_nonce, sizeof(k_nonce), 1700000000123456LL);
+    assert_hex("4102" "06646f6f722d31" "0b30343a41333a32423a3143"
+               "10000102030405060708090a0b0c0d0e0f" "40222018240a0600", b, n);
+
+    n = wire_sig_access_response(b, sizeof(b), "door-1", "04:A3:2B:1C", true, 60, 7);
+    assert_hex("6102" "06646f6f722d31" "0b30343a41333a32423a3143" "01"
+               "3c000000" "07000000", b, n);
+
+    const uint8_t uid[] = {0x04, 0xa3, 0x2b, 0x1c};
+    n = wire_sig_provision(b, sizeof(b), "console", uid, sizeof(uid));
+    assert_hex("5002" "07636f6e736f6c65" "0404a32b1c", b, n);
+}
+
+void test_field_boundaries_are_encoded(void) {
+    uint8_t a[WIRE_SIG_MAX_LEN], b[WIRE_SIG_MAX_LEN];
+    size_t na = wire_sig_access(a, sizeof(a), "door-1", "AB", k_nonce, 16, 1);
+    size_t nb = wire_sig_access(b, sizeof(b), "door-1A", "B", k_nonce, 16, 1);
+    TEST_ASSERT_EQUAL_size_t(na, nb);
+    TEST_ASSERT_NOT_EQUAL(0, memcmp(a, b, na));
+}
+
+void test_grant_and_deny_differ(void) {
+    uint8_t g[WIRE_SIG_MAX_LEN], d[WIRE_SIG_MAX_LEN];
+    size_t n = wire_sig_access_response(g, sizeof(g), "door-1", "04:A3", true, 60, 7);
+    wire_sig_access_response(d, sizeof(d), "door-1", "04:A3", false, 60, 7);
+    TEST_ASSERT_NOT_EQUAL(0, memcmp(g, d, n));
+}
+
+void test_cache_terms_are_signed(void) {
+    uint8_t a[WIRE_SIG_MAX_LEN], b[WIRE_SIG_MAX_LEN], c[WIRE_SIG_MAX_LEN];
+    size_t n = wire_sig_access_response(a, sizeof(a), "door-1", "04:A3", true, 60, 7);
+    wire_sig_access_response(b, sizeof(b), "door-1", "04:A3", true, 86400, 7);
+    wire_sig_access_response(c, sizeof(c), "door-1", "04:A3", true, 60, 8);
+    TEST_ASSERT_NOT_EQUAL(0, memcmp(a, b, n));
+    TEST_ASSERT_NOT_EQUAL(0, memcmp(a, c, n));
+}
+
+void test_max_sized_fields_fit(void) {
+    char module_id[33], cred[30];
+    memset(module_id, 'm', 32); module_id[32] = '\0';
+    memset(cred, 'c', 29);      cred[29] = '\0';
+    uint8_t b[WIRE_SIG_MAX_LEN];
+    TEST_ASSERT_EQUAL_size_t(90, wire_sig_access(b, sizeof(b), module_id, cred,
+                                                 k_nonce, 16, INT64_MAX));
+}
+
+void test_short_buffer_or_long_field_returns_zero(void) {
+    uint8_t b[WIRE_SIG_MAX_LEN];
+    TEST_ASSERT_EQUAL_size_t(0, wire_sig_heartbeat(b, 12, "door-1", 1));
+    TEST_ASSERT_EQUAL_size_t(13, wire_sig_heartbeat(b, 13, "door-1", 1));
+
+    uint8_t big[300] = {0};
+    uint8_t out[400];
+    TEST_ASSERT_EQUAL_size_t(0, wire_sig_provision(out, sizeof(out), "m", big, 256));
+    TEST_ASSERT_EQUAL_size_t(260, wire_sig_provision(out, sizeof(out), "m", big, 255));
+}
+
+int main(void) {
+    UNITY_BEGIN();
+    RUN_TEST(test_golden_projections_match_server);
+    RUN_TEST(test_field_boundaries_are_encoded);
+    RUN_TEST(test_grant_and_deny_differ);
+    RUN_TEST(test_cache_terms_are_signed);
+    RUN_TEST(test_max_sized_fields_fit);
+    RUN_TEST(test_short_buffer_or_long_field_returns_zero);
+    return UNITY_END();
+}
@@ -0,0 +1,665 @@
+/* Generated by gen_tls_fixtures.py — do not edit. */
+#pragma once
+
+#define TLS_FIXTURE_HOST "portunus.test"
+
+/* RSA-2048, as scripts/generate_certs.sh issues them. */
+static const unsigned char k_rsa_ca_der[797] = {
+    0x30, 0x82, 0x03, 0x19, 0x30, 0x82, 0x02, 0x01, 0xa0, 0x03, 0x02, 0x01,
+    0x02, 0x02, 0x01, 0x01, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86,
+    0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x30, 0x3b, 0x31, 0x0b, 0x30,
+    0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11,
+    0x30, 0x0f, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72,
+    0x74, 0x75, 0x6e, 0x75, 0x73, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55,
+    0x04, 0x03, 0x0c, 0x10, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73,
+    0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x20, 0x17, 0x0d,
+    0x32, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x5a, 0x18, 0x0f, 0x32, 0x31, 0x30, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x30, 0x3b, 0x31, 0x0b, 0x30, 0x09,
+    0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11, 0x30,
+    0x0f, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72, 0x74,
+    0x75, 0x6e, 0x75, 0x73, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55, 0x04,
+    0x03, 0x0c, 0x10, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73, 0x20,
+    0x54, 0x65, 0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x82, 0x01, 0x22, 0x30,
+    0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01,
+    0x05, 0x00, 0x03, 0x82, 0x01, 0x0f, 0x00, 0x30, 0x82, 0x01, 0x0a, 0x02,
+    0x82, 0x01, 0x01, 0x00, 0xb9, 0x9c, 0x6d, 0x77, 0x7e, 0x8b, 0xce, 0x8f,
+    0x69, 0x80, 0x1e, 0xab, 0x73, 0x8e, 0x79, 0x7a, 0xe5, 0xa2, 0x26, 0x27,
+    0x67, 0x1f, 0x99, 0xd9, 0xa0, 0x92, 0xaa, 0x50, 0x65, 0x48, 0x0e, 0xa4,
+    0xaa, 0xf9, 0x4c, 0xee, 0xff, 0x0e, 0x2a, 0x8e, 0xf0, 0x33, 0xe8, 0xca,
+    0x22, 0x56, 0xe8, 0x4c, 0xb4, 0x7a, 0x6c, 0x2f, 0x78, 0x6f, 0xad, 0x6e,
+    0x28, 0xbe, 0xbb, 0x13, 0x2e, 0xac, 0x35, 0x53, 0x13, 0x13, 0x45, 0x7a,
+    0x0a, 0x1a, 0x95, 0x59, 0x51, 0xbc, 0x85, 0x8c, 0x67, 0x8b, 0xd2, 0xf7,
+    0x20, 0x59, 0x94, 0x6d, 0x8d, 0x64, 0x37, 0x98, 0x66, 0x01, 0x51, 0x17,
+    0x25, 0x99, 0xaf, 0x40, 0x32, 0x2f, 0xc8, 0xef, 0xbe, 0x9d, 0x21, 0x59,
+    0x7e, 0x36, 0xd2, 0x8a, 0x2c, 0xf8, 0xea, 0xa4, 0xb8, 0xec, 0x9d, 0x06,
+    0xfe, 0x7c, 0x98, 0x62, 0x8b, 0xa3, 0xa2, 0x1b, 0x0c, 0x82, 0xea, 0x88,
+    0x0e, 0xcd, 0x00, 0x17, 0xd2, 0xf5, 0x78, 0x99, 0x43, 0x8c, 0x9f, 0x32,
+    0xf9, 0xb4, 0x52, 0x1e, 0x70, 0xae, 0xfd, 0x29, 0x36, 0x47, 0x40, 0xaf,
+    0xeb, 0xac, 0x9e, 0xcd, 0x65, 0xe0, 0xe8, 0x74, 0xd1, 0xe7, 0x04, 0x1b,
+    0x60, 0x0b, 0x7c, 0xa6, 0xcb, 0x7c, 0x44, 0x93, 0x13, 0xa5, 0x3c, 0x87,
+    0x23, 0xbf, 0x78, 0xc7, 0x2e, 0xf4, 0xea, 0x94, 0x4b, 0x6b, 0x93, 0x4f,
+    0x64, 0xc4, 0x41, 0x65, 0x0e, 0x5c, 0xb9, 0xd9, 0x04, 0x81, 0x8d, 0x5d,
+    0x9f, 0x3a, 0x72, 0x67, 0x1f, 0xef, 0x87, 0x5d, 0xaf, 0xaf, 0xce, 0x55,
+    0x86, 0xd5, 0x2c, 0x37, 0x45, 0x8e, 0x05, 0x3e, 0xb7, 0x5b, 0x0e, 0xc4,
+    0x00, 0xa9, 0xd7, 0x02, 0x50, 0xb5, 0xa3, 0x00, 0x02, 0x4c, 0x64, 0x84,
+    0x36, 0x90, 0x35, 0x62, 0x72, 0x0b, 0x47, 0x32, 0x1b, 0xc6, 0xc9, 0xb4,
+    0xc3, 0xfa, 0x08, 0x4c, 0xfc, 0xbd, 0x05, 0xb9, 0x02, 0x03, 0x01, 0x00,
+    0x01, 0xa3, 0x26, 0x30, 0x24, 0x30, 0x12, 0x06, 0x03, 0x55, 0x1d, 0x13,
+    0x01, 0x01, 0xff, 0x04, 0x08, 0x30, 0x06, 0x01, 0x01, 0xff, 0x02, 0x01,
+    0x00, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04,
+    0x04, 0x03, 0x02, 0x01, 0x06, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48,
+    0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01,
+    0x00, 0xa1, 0xd4, 0xa9, 0x3a, 0x40, 0xea, 0x73, 0xd1, 0xa6, 0x28, 0xa4,
+    0x17, 0x45, 0x57, 0x06, 0x86, 0x0b, 0x45, 0x0e, 0xd1, 0x3b, 0xd4, 0xa9,
+    0x67, 0x61, 0x2f, 0xe2, 0xc8, 0x2b, 0x05, 0x73, 0xf9, 0x56, 0xf7, 0xb0,
+    0x76, 0x3b, 0xdd, 0xa7, 0x93, 0x28, 0xe7, 0x0f, 0xc2, 0xd8, 0x14, 0xf9,
+    0x1d, 0x11, 0x67, 0x9d, 0x90, 0xec, 0x2d, 0xb4, 0x7f, 0xcd, 0xb1, 0x3e,
+    0xd0, 0xf2, 0x8f, 0x76, 0x9c, 0x71, 0xcd, 0xa6, 0xfa, 0x1f, 0x46, 0xe4,
+    0x2d, 0xe0, 0xe2, 0x1a, 0x2e, 0x23, 0x84, 0xb3, 0x4a, 0x4f, 0x15, 0xc2,
+    0x91, 0x4d, 0x1f, 0xc2, 0x60, 0xac, 0x27, 0x5b, 0x33, 0x87, 0x5e, 0x95,
+    0x61, 0x02, 0xf2, 0x52, 0x90, 0xbd, 0x20, 0x7e, 0xce, 0xec, 0x04, 0xc1,
+    0xd3, 0xd7, 0x44, 0x26, 0x44, 0xa5, 0xeb, 0xe2, 0x4f, 0x72, 0xce, 0x86,
+    0x41, 0xa4, 0xf8, 0x58, 0x41, 0x86, 0x23, 0x07, 0x3b, 0xcb, 0x77, 0x9f,
+    0xed, 0x02, 0xb9, 0x6b, 0x7e, 0xfc, 0xc5, 0xec, 0xd5, 0xd2, 0x34, 0xba,
+    0x3f, 0xea, 0xec, 0xcb, 0x36, 0x5a, 0x72, 0xac, 0x1c, 0xac, 0x86, 0x6f,
+    0x51, 0x41, 0x9a, 0x33, 0x6c, 0x08, 0xe6, 0xc7, 0x40, 0x25, 0xd4, 0xfc,
+    0x5c, 0x83, 0xdb, 0x24, 0xd4, 0xf1, 0x08, 0x86, 0x54, 0xe6, 0xa8, 0xa0,
+    0x26, 0x63, 0x99, 0x85, 0x1a, 0x0a, 0xe9, 0x4a, 0x9e, 0xb7, 0xc4, 0x93,
+    0xb2, 0xba, 0xf1, 0x01, 0x1f, 0xb3, 0x0e, 0xd2, 0xeb, 0x31, 0x6c, 0x1a,
+    0x7d, 0x8f, 0x45, 0x51, 0x54, 0xe7, 0xa1, 0x65, 0x85, 0xf0, 0xea, 0x94,
+    0x83, 0x0a, 0xd5, 0xb1, 0x90, 0xb2, 0x62, 0xd4, 0x25, 0xe0, 0x8f, 0x78,
+    0x49, 0x27, 0x69, 0xe5, 0xc2, 0xf0, 0xa8, 0x33, 0x7b, 0xbe, 0x9d, 0x1c,
+    0xb6, 0x04, 0x83, 0xab, 0x7c, 0x8e, 0x1b, 0xc8, 0xb1, 0xc1, 0xbd, 0x76,
+    0xbd, 0x88, 0x95, 0x00, 0x75,
+};
+
+static const char k_rsa_ca_pem[] =
+    "-----BEGIN CERTIFICATE-----\n"
+    "MIIDGTCCAgGgAwIBAgIBATANBgkqhkiG9w0BAQsFADA7MQswCQYDVQQGEwJVUzER\n"
+    "MA8GA1UECgwIUG9ydHVudXMxGTAXBgNVBAMMEFBvcnR1bnVzIFRlc3QgQ0EwIBcN\n"
+    "MjAwMTAxMDAwMDAwWhgPMjEwMDAxMDEwMDAwMDBaMDsxCzAJBgNVBAYTAlVTMREw\n"
+    "DwYDVQQKDAhQb3J0dW51czEZMBcGA1UEAwwQUG9ydHVudXMgVGVzdCBDQTCCASIw\n"
+    "DQYJKoZIhvcNAQEBBQADggEPADCCAQoCggEBALmcbXd+i86PaYAeq3OOeXrloiYn\n"
+    "Zx+Z2aCSqlBlSA6kqvlM7v8OKo7wM+jKIlboTLR6bC94b61uKL67Ey6sNVMTE0V6\n"
+    "ChqVWVG8hYxni9L3IFmUbY1kN5hmAVEXJZmvQDIvyO++nSFZfjbSiiz46qS47J0G\n"
+    "/nyYYoujohsMguqIDs0AF9L1eJlDjJ8y+bRSHnCu/Sk2R0Cv66yezWXg6HTR5wQb\n"
+    "YAt8pst8RJMTpTyHI794xy706pRLa5NPZMRBZQ5cudkEgY1dnzpyZx/vh12vr85V\n"
+    "htUsN0WOBT63Ww7EAKnXAlC1owACTGSENpA1YnILRzIbxsm0w/oITPy9BbkCAwEA\n"
+    "AaMmMCQwEgYDVR0TAQH/BAgwBgEB/wIBADAOBgNVHQ8BAf8EBAMCAQYwDQYJKoZI\n"
+    "hvcNAQELBQADggEBAKHUqTpA6nPRpiikF0VXBoYLRQ7RO9SpZ2Ev4sgrBXP5Vvew\n"
+    "djvdp5Mo5w/C2BT5HRFnnZDsLbR/zbE+0PKPdpxxzab6H0bkLeDiGi4jhLNKTxXC\n"
+    "kU0fwmCsJ1szh16VYQLyUpC9IH7O7ATB09dEJkSl6+JPcs6GQaT4WEGGIwc7y3ef\n"
+    "7QK5a378xezV0jS6P+rsyzZacqwcrIZvUUGaM2wI5sdAJdT8XIPbJNTxCIZU5qig\n"
+    "JmOZhRoK6Uqet8STsrrxAR+zDtLrMWwafY9FUVTnoWWF8OqUgwrVsZCyYtQl4I94\n"
+    "SSdp5cLwqDN7vp0ctgSDq3yOG8ixwb12vYiVAHU=\n"
+    "-----END CERTIFICATE-----\n";
+
+static const unsigned char k_rsa_server_der[816] = {
+    0x30, 0x82, 0x03, 0x2c, 0x30, 0x82, 0x02, 0x14, 0xa0, 0x03, 0x02, 0x01,
+    0x02, 0x02, 0x01, 0x02, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86,
+    0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x30, 0x3b, 0x31, 0x0b, 0x30,
+    0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11,
+    0x30, 0x0f, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72,
+    0x74, 0x75, 0x6e, 0x75, 0x73, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55,
+    0x04, 0x03, 0x0c, 0x10, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73,
+    0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x20, 0x17, 0x0d,
+    0x32, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x5a, 0x18, 0x0f, 0x32, 0x31, 0x30, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x30, 0x38, 0x31, 0x0b, 0x30, 0x09,
+    0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11, 0x30,
+    0x0f, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72, 0x74,
+    0x75, 0x6e, 0x75, 0x73, 0x31, 0x16, 0x30, 0x14, 0x06, 0x03, 0x55, 0x04,
+    0x03, 0x0c, 0x0d, 0x70, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73, 0x2e,
+    0x74, 0x65, 0x73, 0x74, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0d, 0x06, 0x09,
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03,
+    0x82, 0x01, 0x0f, 0x00, 0x30, 0x82, 0x01, 0x0a, 0x02, 0x82, 0x01, 0x01,
+    0x00, 0xa8, 0x51, 0xce, 0x45, 0xda, 0x09, 0xc0, 0x7b, 0x80, 0x81, 0x1c,
+    0xc4, 0x92, 0x57, 0xbd, 0x5d, 0x2c, 0x8a, 0xc5, 0xf0, 0xa2, 0x8a, 0xed,
+    0xdf, 0x94, 0x45, 0x39, 0x83, 0xb6, 0xea, 0x51, 0x14, 0xf6, 0xa0, 0x6a,
+    0xe9, 0xb7, 0x2b, 0xc4, 0x27, 0x34, 0xcd, 0xf5, 0xc8, 0x2a, 0x32, 0x67,
+    0x87, 0x66, 0x69, 0x05, 0xd8, 0x98, 0xe5, 0x81, 0x0b, 0x2a, 0xdd, 0x35,
+    0xaf, 0x61, 0x4f, 0x68, 0x63, 0xb4, 0x3e, 0xe4, 0x96, 0xb9, 0x54, 0xc0,
+    0xaf, 0x95, 0x1a, 0x05, 0x97, 0xf0, 0x68, 0x3c, 0x3b, 0x7c, 0x20, 0xd9,
+    0x3e, 0x70, 0x0a, 0x4d, 0xfb, 0x46, 0xf8, 0x20, 0xe9, 0x5d, 0x54, 0x58,
+    0x15, 0x77, 0x26, 0xc2, 0xd7, 0x6b, 0x8b, 0xea, 0x1b, 0x2a, 0x7d, 0x5e,
+    0x5e, 0x87, 0x3f, 0x31, 0xc2, 0x9f, 0x52, 0x37, 0x0b, 0xb3, 0xb7, 0xca,
+    0x26, 0x40, 0xf9, 0x5f, 0xc7, 0x16, 0xe9, 0xcc, 0xcf, 0xd6, 0x4b, 0x04,
+    0x39, 0x5e, 0x07, 0x63, 0xce, 0x6b, 0x7d, 0x12, 0x97, 0x0b, 0x41, 0x35,
+    0x9f, 0x51, 0x1b, 0xb1, 0xcf, 0x52, 0xb7, 0x53, 0x16, 0x99, 0x38, 0x56,
+    0xae, 0x03, 0xc5, 0x52, 0x79, 0x15, 0x58, 0x43, 0xf4, 0xbb, 0xd1, 0x21,
+    0x15, 0xc2, 0x66, 0x65, 0xd8, 0xd9, 0x23, 0x33, 0x76, 0x2d, 0x01, 0x68,
+    0x14, 0xb9, 0x01, 0xbe, 0xef, 0x76, 0xae, 0x36, 0xc6, 0x41, 0x1e, 0x61,
+    0x81, 0xe1, 0x39, 0x54, 0x22, 0x0c, 0xda, 0x0d, 0xa5, 0xa2, 0xae, 0x28,
+    0xd4, 0x64, 0xec, 0x90, 0xf9, 0x67, 0xf4, 0xa4, 0x63, 0x7a, 0xfb, 0x83,
+    0x79, 0x17, 0xe4, 0x14, 0x5e, 0x27, 0x6a, 0x93, 0x11, 0x8b, 0x64, 0x20,
+    0x1c, 0xa5, 0x4b, 0x52, 0x07, 0xde, 0xe7, 0x30, 0xf0, 0x43, 0x09, 0xdb,
+    0xef, 0xf1, 0x70, 0x71, 0x2d, 0xd8, 0xa7, 0xaa, 0xa3, 0x4f, 0x70, 0xe5,
+    0x85, 0x44, 0xff, 0xd0, 0x99, 0x02, 0x03, 0x01, 0x00, 0x01, 0xa3, 0x3c,
+    0x30, 0x3a, 0x30, 0x09, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x04, 0x02, 0x30,
+    0x00, 0x30, 0x13, 0x06, 0x03, 0x55, 0x1d, 0x25, 0x04, 0x0c, 0x30, 0x0a,
+    0x06, 0x08, 0x2b, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x01, 0x30, 0x18,
+    0x06, 0x03, 0x55, 0x1d, 0x11, 0x04, 0x11, 0x30, 0x0f, 0x82, 0x0d, 0x70,
+    0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73, 0x2e, 0x74, 0x65, 0x73, 0x74,
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01,
+    0x0b, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x5f, 0x21, 0x83, 0x22,
+    0x32, 0x27, 0xad, 0xc4, 0x6a, 0xb7, 0x4d, 0x9f, 0x60, 0xb8, 0x0f, 0x6f,
+    0x94, 0x0d, 0x42, 0xe2, 0x1d, 0x1d, 0x1e, 0xbc, 0x24, 0xb7, 0x46, 0xbc,
+    0xd3, 0xfd, 0x34, 0x12, 0xc0, 0x1a, 0x2e, 0x62, 0x58, 0x28, 0x39, 0xf8,
+    0x93, 0xed, 0x25, 0x9f, 0xc0, 0x40, 0x11, 0x93, 0xb4, 0x8d, 0x48, 0xe5,
+    0x95, 0x45, 0xf7, 0x6d, 0xf3, 0x24, 0x0a, 0xe1, 0x7a, 0x1d, 0x3e, 0xef,
+    0xc0, 0x72, 0x4b, 0xfd, 0xad, 0x6e, 0x64, 0xe1, 0x98, 0x0f, 0xef, 0xf8,
+    0xc2, 0xe7, 0x36, 0xb9, 0x48, 0xb1, 0x17, 0xf1, 0xef, 0xd3, 0xa1, 0x65,
+    0x9e, 0x81, 0x01, 0xd6, 0x99, 0x42, 0x5d, 0x76, 0x67, 0x8f, 0x29, 0xfc,
+    0xb7, 0xf0, 0x85, 0xfb, 0x9a, 0xf1, 0xab, 0x8e, 0xfb, 0xd7, 0x27, 0xa5,
+    0x8a, 0x98, 0x16, 0xc7, 0x7f, 0x45, 0xe6, 0x85, 0x23, 0x2c, 0x79, 0xcf,
+    0xfd, 0x3e, 0xc7, 0x01, 0x6a, 0xfa, 0xef, 0x14, 0xdc, 0x9d, 0x44, 0xf0,
+    0x36, 0xd9, 0x97, 0x22, 0x8a, 0x67, 0xb8, 0xaf, 0x13, 0x7f, 0x2d, 0xa4,
+    0xc2, 0x43, 0xe8, 0x8b, 0x4b, 0xad, 0x4c, 0x1c, 0xad, 0xf4, 0x67, 0xe7,
+    0x57, 0x89, 0xd8, 0x42, 0x91, 0x2a, 0xc0, 0x31, 0x87, 0xca, 0xf3, 0x5f,
+    0x7a, 0x43, 0xd7, 0xd3, 0x8f, 0x41, 0x17, 0xe7, 0x3e, 0x72, 0x7f, 0x2f,
+    0xcd, 0xd8, 0x61, 0xc7, 0x33, 0x67, 0xa0, 0xa8, 0xef, 0xf0, 0x21, 0xa5,
+    0xcd, 0x50, 0xa9, 0x66, 0xfe, 0xa9, 0x6f, 0x8c, 0x82, 0xc5, 0x24, 0x01,
+    0xa2, 0x2d, 0x87, 0x2e, 0x6d, 0x73, 0xed, 0x41, 0xca, 0xb4, 0x7f, 0x05,
+    0x6b, 0xef, 0x17, 0x20, 0x00, 0x5e, 0x66, 0x97, 0x94, 0x25, 0x39, 0x8c,
+    0x35, 0xb5, 0xc8, 0xe5, 0x8f, 0xe4, 0x0a, 0xe7, 0xbb, 0x11, 0xb5, 0x7f,
+    0x87, 0x44, 0x81, 0xbc, 0xa3, 0x3b, 0x83, 0x80, 0x9a, 0x0a, 0xd8, 0x6c,
+};
+
+static const unsigned char k_rsa_server_key_der[1217] = {
+    0x30, 0x82, 0x04, 0xbd, 0x02, 0x01, 0x00, 0x30, 0x0d, 0x06, 0x09, 0x2a,
+    0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x04, 0x82,
+    0x04, 0xa7, 0x30, 0x82, 0x04, 0xa3, 0x02, 0x01, 0x00, 0x02, 0x82, 0x01,
+    0x01, 0x00, 0xa8, 0x51, 0xce, 0x45, 0xda, 0x09, 0xc0, 0x7b, 0x80, 0x81,
+    0x1c, 0xc4, 0x92, 0x57, 0xbd, 0x5d, 0x2c, 0x8a, 0xc5, 0xf0, 0xa2, 0x8a,
+    0xed, 0xdf, 0x94, 0x45, 0x39, 0x83, 0xb6, 0xea, 0x51, 0x14, 0xf6, 0xa0,
+    0x6a, 0xe9, 0xb7, 0x2b, 0xc4, 0x27, 0x34, 0xcd, 0xf5, 0xc8, 0x2a, 0x32,
+    0x67, 0x87, 0x66, 0x69, 0x05, 0xd8, 0x98, 0xe5, 0x81, 0x0b, 0x2a, 0xdd,
+    0x35, 0xaf, 0x61, 0x4f, 0x68, 0x63, 0xb4, 0x3e, 0xe4, 0x96, 0xb9, 0x54,
+    0xc0, 0xaf, 0x95, 0x1a, 0x05, 0x97, 0xf0, 0x68, 0x3c, 0x3b, 0x7c, 0x20,
+    0xd9, 0x3e, 0x70, 0x0a, 0x4d, 0xfb, 0x46, 0xf8, 0x20, 0xe9, 0x5d, 0x54,
+    0x58, 0x15, 0x77, 0x26, 0xc2, 0xd7, 0x6b, 0x8b, 0xea, 0x1b, 0x2a, 0x7d,
+    0x5e, 0x5e, 0x87, 0x3f, 0x31, 0xc2, 0x9f, 0x52, 0x37, 0x0b, 0xb3, 0xb7,
+    0xca, 0x26, 0x40, 0xf9, 0x5f, 0xc7, 0x16, 0xe9, 0xcc, 0xcf, 0xd6, 0x4b,
+    0x04, 0x39, 0x5e, 0x07, 0x63, 0xce, 0x6b, 0x7d, 0x12, 0x97, 0x0b, 0x41,
+    0x35, 0x9f, 0x51, 0x1b, 0xb1, 0xcf, 0x52, 0xb7, 0x53, 0x16, 0x99, 0x38,
+    0x56, 0xae, 0x03, 0xc5, 0x52, 0x79, 0x15, 0x58, 0x43, 0xf4, 0xbb, 0xd1,
+    0x21, 0x15, 0xc2, 0x66, 0x65, 0xd8, 0xd9, 0x23, 0x33, 0x76, 0x2d, 0x01,
+    0x68, 0x14, 0xb9, 0x01, 0xbe, 0xef, 0x76, 0xae, 0x36, 0xc6, 0x41, 0x1e,
+    0x61, 0x81, 0xe1, 0x39, 0x54, 0x22, 0x0c, 0xda, 0x0d, 0xa5, 0xa2, 0xae,
+    0x28, 0xd4, 0x64, 0xec, 0x90, 0xf9, 0x67, 0xf4, 0xa4, 0x63, 0x7a, 0xfb,
+    0x83, 0x79, 0x17, 0xe4, 0x14, 0x5e, 0x27, 0x6a, 0x93, 0x11, 0x8b, 0x64,
+    0x20, 0x1c, 0xa5, 0x4b, 0x52, 0x07, 0xde, 0xe7, 0x30, 0xf0, 0x43, 0x09,
+    0xdb, 0xef, 0xf1, 0x70, 0x71, 0x2d, 0xd8, 0xa7, 0xaa, 0xa3, 0x4f, 0x70,
+    0xe5, 0x85, 0x44, 0xff, 0xd0, 0x99, 0x02, 0x03, 0x01, 0x00, 0x01, 0x02,
+    0x82, 0x01, 0x00, 0x48, 0x46, 0x0c, 0x20, 0xc1, 0x3d, 0x53, 0xb9, 0x94,
+    0x15, 0x9c, 0x71, 0x29, 0x77, 0x64, 0x37, 0xb8, 0x53, 0x04, 0x28, 0x4d,
+    0xdb, 0x02, 0xc5, 0xf0, 0x68, 0x03, 0x08, 0xb4, 0x07, 0x8b, 0xf6, 0x48,
+    0xe9, 0xdb, 0xce, 0x6c, 0x18, 0xee, 0x5a, 0x79, 0x59, 0x80, 0x92, 0x48,
+    0xd0, 0x28, 0xd5, 0x22, 0x5b, 0xb1, 0x27, 0x6e, 0x8b, 0x89, 0x6b, 0xee,
+    0xa5, 0x5a, 0x92, 0x6a, 0x61, 0xca, 0xec, 0x98, 0xee, 0x32, 0x80, 0x27,
+    0xa7, 0x25, 0x2f, 0x9f, 0x81, 0xb3, 0x6a, 0x28, 0xcf, 0xd1, 0x21, 0x27,
+    0xad, 0x01, 0x2b, 0x46, 0xb7, 0x9e, 0x01, 0x69, 0xd9, 0x4c, 0x64, 0x77,
+    0xef, 0x29, 0xfd, 0x59, 0x92, 0xba, 0xb1, 0xfe, 0x1b, 0x6f, 0x53, 0xe7,
+    0xdc, 0x3a, 0x23, 0xb3, 0xc6, 0x26, 0x4b, 0x2f, 0xd7, 0x01, 0x0c, 0xd4,
+    0xc7, 0xf3, 0x94, 0x96, 0x6c, 0x9d, 0xbc, 0x22, 0x72, 0x14, 0xbf, 0x6c,
+    0xe6, 0xd4, 0x13, 0x7f, 0x79, 0xff, 0x5c, 0x1f, 0x1b, 0x8e, 0x2a, 0x72,
+    0x88, 0x00, 0x4f, 0x1f, 0xf4, 0x17, 0x41, 0xa2, 0x04, 0x55, 0x5a, 0x10,
+    0xf4, 0xa8, 0xb3, 0x9e, 0x24, 0xb1, 0x85, 0xb0, 0x67, 0x11, 0x5e, 0x85,
+    0xee, 0x60, 0x00, 0x01, 0xeb, 0x26, 0x00, 0xad, 0x8b, 0x17, 0x94, 0xb9,
+    0xa7, 0x43, 0x52, 0xdf, 0x0e, 0x31, 0x4e, 0x88, 0x1f, 0xd0, 0xed, 0xeb,
+    0x49, 0x31, 0xa4, 0x0c, 0x95, 0xf2, 0xca, 0xb1, 0xf3, 0x67, 0x95, 0xdb,
+    0x20, 0x11, 0x40, 0xf0, 0x68, 0xaa, 0x49, 0xce, 0xa3, 0x24, 0x3b, 0xa5,
+    0xee, 0x99, 0xc0, 0xe2, 0xbc, 0xd6, 0xe3, 0x50, 0x17, 0x88, 0x1a, 0xaa,
+    0xa5, 0x40, 0x91, 0x76, 0x21, 0xc9, 0x94, 0x09, 0x9d, 0x1b, 0x59, 0xf9,
+    0xaa, 0xbc, 0x4f, 0xcf, 0x86, 0xa0, 0xc7, 0x1a, 0x39, 0xb1, 0xd4, 0x29,
+    0xa1, 0x3d, 0x0f, 0xa0, 0x9e, 0xb3, 0x8b, 0x02, 0x81, 0x81, 0x00, 0xdc,
+    0xa4, 0x76, 0x1f, 0x20, 0x8d, 0x2f, 0x48, 0xa5, 0x02, 0x4d, 0xc9, 0x7f,
+    0xd9, 0xd1, 0xaf, 0x46, 0x5a, 0xab, 0x3f, 0xd5, 0x71, 0x79, 0x12, 0x98,
+    0xb0, 0x04, 0xce, 0x7b, 0x76, 0xde, 0x19, 0x0e, 0x47, 0xca, 0xa8, 0x22,
+    0xfa, 0x7f, 0x72, 0xc3, 0xc1, 0x9d, 0x7d, 0x2e, 0xf2, 0x6c, 0x5c, 0x09,
+    0xf0, 0xed, 0xdf, 0xc8, 0xac, 0x8c, 0x6f, 0x7f, 0xf7, 0x73, 0x66, 0x76,
+    0x3b, 0x8e, 0x9e, 0xd8, 0x93, 0x45, 0xf7, 0xd5, 0xf5, 0x50, 0x08, 0x37,
+    0x05, 0xa8, 0xdc, 0xec, 0xd5, 0xa9, 0xf3, 0x32, 0x14, 0x31, 0xa2, 0x24,
+    0xab, 0xde, 0x12, 0xa6, 0x75, 0x43, 0x23, 0x4a, 0xbe, 0x35, 0x3e, 0x8c,
+    0x42, 0x7b, 0x5b, 0x65, 0x43, 0xa4, 0x7a, 0xff, 0x6f, 0x66, 0x35, 0xec,
+    0x7e, 0xe8, 0x37, 0x04, 0x1a, 0xca, 0x77, 0xf3, 0x4d, 0x97, 0x8d, 0xe2,
+    0xdb, 0x10, 0xf9, 0xc5, 0x0a, 0xd9, 0x27, 0x02, 0x81, 0x81, 0x00, 0xc3,
+    0x4a, 0xdf, 0xa5, 0x9b, 0xe1, 0x0f, 0x48, 0x34, 0xa8, 0xa7, 0x10, 0x69,
+    0x6a, 0xcb, 0x50, 0x09, 0xb4, 0xb3, 0x98, 0xb2, 0xa2, 0x01, 0xee, 0x38,
+    0x76, 0xf2, 0x80, 0x04, 0x88, 0xfd, 0x33, 0xe6, 0xfb, 0x0f, 0xa2, 0x61,
+    0x87, 0x3e, 0xc7, 0x45, 0x43, 0x8e, 0x94, 0x27, 0x4c, 0x25, 0x43, 0xb0,
+    0xde, 0x01, 0x9a, 0x97, 0x94, 0x71, 0x3b, 0x6f, 0x61, 0x74, 0x20, 0x52,
+    0xea, 0x62, 0x5c, 0x7b, 0xe7, 0xdf, 0xef, 0xa6, 0x20, 0xf4, 0x6c, 0x59,
+    0x28, 0xe3, 0xce, 0xf8, 0xad, 0x74, 0x74, 0x4a, 0xba, 0x5f, 0x81, 0xe7,
+    0xc5, 0xf1, 0xcb, 0x4a, 0x50, 0x15, 0xf6, 0x66, 0xb1, 0x69, 0xe6, 0x21,
+    0x5c, 0x43, 0x98, 0x41, 0x9b, 0x28, 0xf3, 0x72, 0x5e, 0x4c, 0x1b, 0x8e,
+    0x22, 0x47, 0x9d, 0xcc, 0xf9, 0xf2, 0xd6, 0xa3, 0x00, 0xd2, 0x43, 0x48,
+    0x97, 0xd3, 0x4a, 0x6d, 0x04, 0xa0, 0x3f, 0x02, 0x81, 0x81, 0x00, 0x90,
+    0x7b, 0x35, 0x4a, 0x4e, 0xc3, 0x84, 0xf9, 0xf9, 0xeb, 0x97, 0x4a, 0x62,
+    0x69, 0x1d, 0x10, 0xbc, 0x6e, 0x35, 0x03, 0x78, 0xde, 0x74, 0x5c, 0xc4,
+    0x15, 0x47, 0x20, 0x7a, 0xe2, 0xac, 0xaf, 0x15, 0x95, 0xd7, 0x53, 0xe0,
+    0x8b, 0xce, 0x17, 0x35, 0xae, 0xbc, 0x55, 0x33, 0xff, 0xd5, 0x0b, 0x34,
+    0x0b, 0x4b, 0x89, 0x25, 0xdc, 0x2f, 0x9d, 0xf7, 0xda, 0xee, 0xfb, 0x62,
+    0x62, 0xbf, 0x92, 0xae, 0xd9, 0x49, 0x90, 0xef, 0xcf, 0x52, 0x97, 0xfe,
+    0x87, 0xbb, 0x3a, 0xe7, 0xef, 0x45, 0xf9, 0x95, 0x8a, 0x79, 0xb1, 0xe6,
+    0x77, 0x90, 0xd4, 0xff, 0xa1, 0x7b, 0xd4, 0x49, 0x66, 0x62, 0x71, 0x51,
+    0xe1, 0x5a, 0xeb, 0xcf, 0x54, 0xcb, 0x09, 0x2b, 0xe9, 0x23, 0xb2, 0x1d,
+    0xea, 0x40, 0x5f, 0x7e, 0x55, 0x98, 0xcd, 0x91, 0x49, 0xf6, 0xfb, 0x17,
+    0x59, 0x42, 0x35, 0x7c, 0x5d, 0x0d, 0x33, 0x02, 0x81, 0x80, 0x42, 0x0e,
+    0xd9, 0x87, 0x93, 0x2a, 0x95, 0x98, 0xbe, 0xf7, 0x2d, 0x4b, 0x87, 0xdc,
+    0xef, 0xd8, 0xaa, 0xef, 0xcc, 0xb0, 0x21, 0xfc, 0x5a, 0xda, 0xd1, 0x8e,
+    0xaa, 0x88, 0x53, 0x00, 0x63, 0x65, 0x63, 0x04, 0x19, 0x4d, 0xbb, 0xdf,
+    0x9b, 0x84, 0x9c, 0x11, 0x35, 0xf1, 0x37, 0x39, 0xb2, 0x81, 0x2b, 0x1a,
+    0x6d, 0x40, 0x75, 0x75, 0x68, 0xb7, 0xc9, 0xfd, 0x14, 0xe2, 0xba, 0x29,
+    0x3e, 0x0c, 0x3a, 0x7d, 0x3c, 0x6a, 0x3b, 0xaf, 0x79, 0xfe, 0x0c, 0x4a,
+    0xa0, 0x84, 0x29, 0xe9, 0xc2, 0x32, 0x73, 0xf4, 0x86, 0xc9, 0xd2, 0x34,
+    0x4a, 0x8d, 0x91, 0x1d, 0x75, 0xd0, 0x5a, 0xfc, 0x37, 0xed, 0xf7, 0xea,
+    0xd5, 0x92, 0x72, 0xde, 0xa1, 0x03, 0x77, 0xf4, 0x1d, 0x9a, 0x54, 0x81,
+    0x93, 0xe7, 0xf4, 0xa5, 0xb7, 0x56, 0x92, 0xdc, 0x7c, 0x42, 0xf6, 0x13,
+    0x25, 0x0d, 0x4f, 0xc2, 0xf8, 0xd1, 0x02, 0x81, 0x80, 0x53, 0x74, 0x88,
+    0x5a, 0x45, 0x5b, 0xe8, 0xae, 0x2f, 0x9f, 0xf1, 0xb7, 0x20, 0xba, 0x67,
+    0x13, 0x71, 0x65, 0xa0, 0x37, 0xd7, 0xc2, 0xe5, 0x13, 0x8a, 0xff, 0x3d,
+    0xd0, 0xcd, 0xdc, 0xc7, 0xda, 0xc3, 0xb2, 0xaa, 0x51, 0x0c, 0x86, 0x6d,
+    0x42, 0x13, 0xc9, 0xd4, 0xfe, 0x1b, 0x38, 0x1f, 0x9e, 0x4b, 0x95, 0xa1,
+    0xb7, 0xc1, 0xde, 0xda, 0xbc, 0xc3, 0x52, 0x43, 0x62, 0x93, 0x27, 0x3b,
+    0x3d, 0xd8, 0x6f, 0xff, 0xc2, 0x6b, 0xc1, 0x24, 0x08, 0x0a, 0x39, 0x2e,
+    0xa2, 0x79, 0x4a, 0x18, 0x9c, 0x5f, 0xe8, 0x6c, 0x97, 0x06, 0xf2, 0x42,
+    0x05, 0xe6, 0x74, 0x58, 0x40, 0xa6, 0xbd, 0xda, 0x68, 0xef, 0x07, 0x19,
+    0x09, 0xb0, 0x9a, 0x55, 0x1a, 0x57, 0x9b, 0xd5, 0x2f, 0x05, 0xe7, 0xe6,
+    0x88, 0xe5, 0xb9, 0xe0, 0x9c, 0xea, 0x07, 0xec, 0x46, 0x45, 0x65, 0xb3,
+    0xd5, 0xcc, 0x2c, 0x25, 0xfe,
+};
+
+/* SHA-256 of the server certificate's SubjectPublicKeyInfo. */
+static const unsigned char k_rsa_server_spki_sha256[32] = {
+    0xf8, 0x5e, 0xc0, 0xac, 0x99, 0x92, 0xb1, 0x18, 0x2f, 0xa3, 0xb4, 0x7d,
+    0x5b, 0x2c, 0x63, 0x9e, 0xd3, 0x6f, 0xf4, 0x61, 0x24, 0x0b, 0x64, 0x20,
+    0x22, 0x1b, 0xdd, 0x5c, 0x23, 0xe2, 0x98, 0xd9,
+};
+
+/* A second, unrelated CA and server: a server the module must not trust. */
+static const unsigned char k_rogue_ca_der[797] = {
+    0x30, 0x82, 0x03, 0x19, 0x30, 0x82, 0x02, 0x01, 0xa0, 0x03, 0x02, 0x01,
+    0x02, 0x02, 0x01, 0x01, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86,
+    0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x30, 0x3b, 0x31, 0x0b, 0x30,
+    0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11,
+    0x30, 0x0f, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72,
+    0x74, 0x75, 0x6e, 0x75, 0x73, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55,
+    0x04, 0x03, 0x0c, 0x10, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73,
+    0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x20, 0x17, 0x0d,
+    0x32, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x5a, 0x18, 0x0f, 0x32, 0x31, 0x30, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x30, 0x3b, 0x31, 0x0b, 0x30, 0x09,
+    0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11, 0x30,
+    0x0f, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72, 0x74,
+    0x75, 0x6e, 0x75, 0x73, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55, 0x04,
+    0x03, 0x0c, 0x10, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73, 0x20,
+    0x54, 0x65, 0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x82, 0x01, 0x22, 0x30,
+    0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01,
+    0x05, 0x00, 0x03, 0x82, 0x01, 0x0f, 0x00, 0x30, 0x82, 0x01, 0x0a, 0x02,
+    0x82, 0x01, 0x01, 0x00, 0xc7, 0x30, 0x29, 0x91, 0x63, 0x8b, 0x20, 0x4b,
+    0xfe, 0xda, 0xb9, 0xeb, 0x2d, 0xcc, 0x16, 0x4f, 0xba, 0xe9, 0x62, 0xdf,
+    0x56, 0x3f, 0x68, 0xd9, 0x99, 0xd3, 0x10, 0x6e, 0xe9, 0x1e, 0x99, 0xe9,
+    0x3e, 0xf9, 0x45, 0xe4, 0x02, 0xdc, 0x7e, 0x9e, 0x2a, 0x20, 0x99, 0x3c,
+    0xa3, 0x0f, 0xb6, 0xfb, 0xe3, 0x35, 0x55, 0x01, 0xa6, 0x9b, 0x5c, 0x95,
+    0xa3, 0xe3, 0x14, 0xe5, 0x1c, 0x96, 0x98, 0x9a, 0x53, 0xb1, 0xaf, 0xea,
+    0x6e, 0x46, 0x0f, 0x78, 0x1a, 0xb8, 0xf0, 0x27, 0x42, 0xa9, 0x59, 0xc6,
+    0x2f, 0xa7, 0x60, 0x40, 0x71, 0x93, 0x9d, 0x28, 0x52, 0xbe, 0x61, 0xd9,
+    0x79, 0xe2, 0xd6, 0x68, 0x75, 0xfe, 0xf1, 0x71, 0xc2, 0xbc, 0xc6, 0x23,
+    0x97, 0x6a, 0xee, 0xb0, 0x8d, 0x97, 0xa3, 0x03, 0x58, 0x4e, 0xcc, 0x39,
+    0x01, 0x3d, 0xe0, 0x98, 0x29, 0xdc, 0x8a, 0x68, 0x5a, 0x1b, 0xb5, 0xcf,
+    0x08, 0x0d, 0xd5, 0x3e, 0x61, 0xc3, 0xfd, 0x66, 0x24, 0xca, 0xe3, 0x6b,
+    0xe0, 0x10, 0xd4, 0xa3, 0x10, 0x43, 0x11, 0x55, 0x45, 0x23, 0x5f, 0xb3,
+    0x7f, 0x72, 0x59, 0xe6, 0x1a, 0x65, 0x9c, 0x3c, 0xf9, 0x43, 0x16, 0x77,
+    0xf0, 0xe3, 0x1b, 0x49, 0x2f, 0x58, 0xec, 0x89, 0x32, 0x7a, 0xe3, 0xbc,
+    0x17, 0x3e, 0x08, 0x8c, 0x50, 0xad, 0xba, 0xec, 0xd0, 0x8e, 0x86, 0x74,
+    0xcf, 0x0e, 0x0e, 0x5b, 0xe9, 0xfc, 0x23, 0xa5, 0xd1, 0xda, 0x2f, 0x03,
+    0x21, 0x04, 0x24, 0x8e, 0xc3, 0x0c, 0xf9, 0x30, 0x2e, 0xe7, 0x14, 0xae,
+    0xd5, 0x59, 0x54, 0x6a, 0xb7, 0xbc, 0x88, 0x70, 0x28, 0x66, 0x1a, 0x6e,
+    0x11, 0x18, 0xb1, 0x25, 0x1f, 0xdc, 0xd1, 0x8e, 0x7e, 0x99, 0x20, 0x9d,
+    0xb5, 0x90, 0x82, 0xdb, 0x38, 0x88, 0xab, 0xa3, 0x23, 0x05, 0x47, 0x79,
+    0x70, 0x1d, 0x12, 0xdb, 0x1d, 0xff, 0x51, 0xa7, 0x02, 0x03, 0x01, 0x00,
+    0x01, 0xa3, 0x26, 0x30, 0x24, 0x30, 0x12, 0x06, 0x03, 0x55, 0x1d, 0x13,
+    0x01, 0x01, 0xff, 0x04, 0x08, 0x30, 0x06, 0x01, 0x01, 0xff, 0x02, 0x01,
+    0x00, 0x30, 0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04,
+    0x04, 0x03, 0x02, 0x01, 0x06, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48,
+    0x86, 0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01,
+    0x00, 0xb2, 0x36, 0x65, 0xbf, 0xf4, 0xbb, 0x96, 0x75, 0x99, 0xc5, 0x13,
+    0x80, 0x1c, 0xc6, 0x4a, 0x70, 0x93, 0xc8, 0x74, 0x44, 0xe4, 0xba, 0x58,
+    0x8e, 0x60, 0xcf, 0x3e, 0x15, 0xaa, 0x90, 0xb2, 0x1c, 0x83, 0xcd, 0x6f,
+    0x2c, 0x38, 0x6a, 0x80, 0x01, 0x18, 0xc6, 0xb9, 0xf3, 0x28, 0xf8, 0x57,
+    0x33, 0x5d, 0x02, 0xf0, 0xf0, 0xb7, 0x43, 0x86, 0x1b, 0xe8, 0x3e, 0x47,
+    0x9e, 0x70, 0x24, 0x02, 0x02, 0x88, 0x2f, 0x70, 0xae, 0x54, 0xa1, 0xd1,
+    0x02, 0x42, 0xfb, 0xc2, 0x2e, 0xb5, 0x2e, 0xc4, 0x65, 0x42, 0xbd, 0x16,
+    0x97, 0xac, 0xce, 0x0a, 0x3f, 0xc9, 0xef, 0x22, 0x95, 0x9a, 0x03, 0xec,
+    0x8e, 0xe3, 0x5b, 0x2a, 0xfd, 0x5d, 0x9e, 0x5f, 0x06, 0x6c, 0x54, 0x38,
+    0x2d, 0xac, 0xe8, 0xf6, 0x94, 0x49, 0xbb, 0x87, 0x47, 0xb6, 0x5d, 0xf1,
+    0x8a, 0x34, 0x55, 0x2c, 0xde, 0xa5, 0xa3, 0xca, 0xde, 0xc8, 0x7e, 0xde,
+    0x67, 0xc8, 0x4a, 0xf8, 0xd1, 0x29, 0xd8, 0x1d, 0x1a, 0xb0, 0xaf, 0x86,
+    0x42, 0xd2, 0xfb, 0x44, 0x29, 0x63, 0x03, 0x20, 0x09, 0x3a, 0x92, 0x48,
+    0x3d, 0xf1, 0x2d, 0xd4, 0x07, 0x15, 0xba, 0x2c, 0xcd, 0xf4, 0x08, 0x70,
+    0x1d, 0x83, 0x94, 0x59, 0x67, 0x7e, 0x9b, 0x71, 0xc6, 0x2d, 0x52, 0x82,
+    0x07, 0xb8, 0x42, 0x56, 0xd9, 0x65, 0x7a, 0x76, 0x40, 0xb0, 0x2c, 0x59,
+    0x29, 0x34, 0xba, 0x0b, 0x86, 0x82, 0xf5, 0xb9, 0x8e, 0x00, 0x6a, 0x99,
+    0xe1, 0xa5, 0x31, 0x41, 0x9b, 0xf7, 0x96, 0x0b, 0x93, 0x93, 0x73, 0x12,
+    0xdf, 0x9d, 0x17, 0xb2, 0x5c, 0x56, 0x63, 0x7a, 0x77, 0xbf, 0x5c, 0xdb,
+    0x80, 0xcb, 0xd0, 0x0d, 0xac, 0xab, 0xef, 0x4f, 0x98, 0x61, 0xdd, 0x00,
+    0x28, 0xcd, 0x4b, 0xc5, 0x72, 0x79, 0x56, 0x1e, 0x41, 0xf1, 0x92, 0xd1,
+    0x77, 0xac, 0x84, 0x76, 0xe5,
+};
+
+static const char k_rogue_ca_pem[] =
+    "-----BEGIN CERTIFICATE-----\n"
+    "MIIDGTCCAgGgAwIBAgIBATANBgkqhkiG9w0BAQsFADA7MQswCQYDVQQGEwJVUzER\n"
+    "MA8GA1UECgwIUG9ydHVudXMxGTAXBgNVBAMMEFBvcnR1bnVzIFRlc3QgQ0EwIBcN\n"
+    "MjAwMTAxMDAwMDAwWhgPMjEwMDAxMDEwMDAwMDBaMDsxCzAJBgNVBAYTAlVTMREw\n"
+    "DwYDVQQKDAhQb3J0dW51czEZMBcGA1UEAwwQUG9ydHVudXMgVGVzdCBDQTCCASIw\n"
+    "DQYJKoZIhvcNAQEBBQADggEPADCCAQoCggEBAMcwKZFjiyBL/tq56y3MFk+66WLf\n"
+    "Vj9o2ZnTEG7pHpnpPvlF5ALcfp4qIJk8ow+2++M1VQGmm1yVo+MU5RyWmJpTsa/q\n"
+    "bkYPeBq48CdCqVnGL6dgQHGTnShSvmHZeeLWaHX+8XHCvMYjl2rusI2XowNYTsw5\n"
+    "AT3gmCncimhaG7XPCA3VPmHD/WYkyuNr4BDUoxBDEVVFI1+zf3JZ5hplnDz5QxZ3\n"
+    "8OMbSS9Y7IkyeuO8Fz4IjFCtuuzQjoZ0zw4OW+n8I6XR2i8DIQQkjsMM+TAu5xSu\n"
+    "1VlUare8iHAoZhpuERixJR/c0Y5+mSCdtZCC2ziIq6MjBUd5cB0S2x3/UacCAwEA\n"
+    "AaMmMCQwEgYDVR0TAQH/BAgwBgEB/wIBADAOBgNVHQ8BAf8EBAMCAQYwDQYJKoZI\n"
+    "hvcNAQELBQADggEBALI2Zb/0u5Z1mcUTgBzGSnCTyHRE5LpYjmDPPhWqkLIcg81v\n"
+    "LDhqgAEYxrnzKPhXM10C8PC3Q4Yb6D5HnnAkAgKIL3CuVKHRAkL7wi61LsRlQr0W\n"
+    "l6zOCj/J7yKVmgPsjuNbKv1dnl8GbFQ4Lazo9pRJu4dHtl3xijRVLN6lo8reyH7e\n"
+    "Z8hK+NEp2B0asK+GQtL7RCljAyAJOpJIPfEt1AcVuizN9AhwHYOUWWd+m3HGLVKC\n"
+    "B7hCVtllenZAsCxZKTS6C4aC9bmOAGqZ4aUxQZv3lguTk3MS350XslxWY3p3v1zb\n"
+    "gMvQDayr70+YYd0AKM1LxXJ5Vh5B8ZLRd6yEduU=\n"
+    "-----END CERTIFICATE-----\n";
+
+static const unsigned char k_rogue_server_der[816] = {
+    0x30, 0x82, 0x03, 0x2c, 0x30, 0x82, 0x02, 0x14, 0xa0, 0x03, 0x02, 0x01,
+    0x02, 0x02, 0x01, 0x02, 0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86,
+    0xf7, 0x0d, 0x01, 0x01, 0x0b, 0x05, 0x00, 0x30, 0x3b, 0x31, 0x0b, 0x30,
+    0x09, 0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11,
+    0x30, 0x0f, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72,
+    0x74, 0x75, 0x6e, 0x75, 0x73, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55,
+    0x04, 0x03, 0x0c, 0x10, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73,
+    0x20, 0x54, 0x65, 0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x20, 0x17, 0x0d,
+    0x32, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+    0x5a, 0x18, 0x0f, 0x32, 0x31, 0x30, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30,
+    0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x30, 0x38, 0x31, 0x0b, 0x30, 0x09,
+    0x06, 0x03, 0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11, 0x30,
+    0x0f, 0x06, 0x03, 0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72, 0x74,
+    0x75, 0x6e, 0x75, 0x73, 0x31, 0x16, 0x30, 0x14, 0x06, 0x03, 0x55, 0x04,
+    0x03, 0x0c, 0x0d, 0x70, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73, 0x2e,
+    0x74, 0x65, 0x73, 0x74, 0x30, 0x82, 0x01, 0x22, 0x30, 0x0d, 0x06, 0x09,
+    0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x03,
+    0x82, 0x01, 0x0f, 0x00, 0x30, 0x82, 0x01, 0x0a, 0x02, 0x82, 0x01, 0x01,
+    0x00, 0x88, 0x39, 0x52, 0x9f, 0xb0, 0x9f, 0xb8, 0x9c, 0xee, 0x76, 0xd4,
+    0x6f, 0xed, 0x67, 0xfc, 0x2d, 0x62, 0xd0, 0x47, 0x4c, 0xfa, 0x0c, 0x05,
+    0x1f, 0xf4, 0x32, 0xcd, 0xa3, 0xb1, 0xd7, 0xe5, 0x09, 0x7c, 0x31, 0xf5,
+    0x73, 0x78, 0xc8, 0xd2, 0xaa, 0x48, 0x65, 0x88, 0x1e, 0x4e, 0xec, 0xa0,
+    0x47, 0x74, 0x79, 0x73, 0x2d, 0x88, 0x59, 0xac, 0x5d, 0x72, 0x4a, 0x57,
+    0xba, 0x1a, 0x94, 0x7f, 0x2b, 0xbc, 0xdf, 0x0a, 0xaf, 0xdb, 0x93, 0xef,
+    0x3d, 0x27, 0x8d, 0x4b, 0x05, 0x7b, 0xb0, 0x9d, 0x19, 0x05, 0x4f, 0x5b,
+    0x31, 0xa7, 0x6c, 0xc5, 0xc4, 0xa5, 0x0a, 0xfa, 0x84, 0xfa, 0xe2, 0xa2,
+    0xbe, 0x68, 0x2a, 0x92, 0x76, 0xca, 0x13, 0xcf, 0xc8, 0x90, 0x4a, 0xbc,
+    0x5b, 0x20, 0xb8, 0x0e, 0x3a, 0xc4, 0xd2, 0xe1, 0xc4, 0x63, 0xc3, 0x1f,
+    0xc0, 0x93, 0x07, 0x5d, 0x7f, 0xd7, 0xbd, 0xf1, 0x25, 0x2b, 0x8e, 0x81,
+    0x26, 0x25, 0xf4, 0xc3, 0x0a, 0xc7, 0xe4, 0xfc, 0xfe, 0x71, 0xe5, 0x85,
+    0x08, 0xc6, 0x83, 0x94, 0xfe, 0x16, 0xa4, 0xa3, 0x1f, 0x7c, 0x96, 0xe4,
+    0x37, 0x4d, 0x28, 0xcf, 0x5e, 0x52, 0x78, 0xcb, 0xe7, 0xbc, 0x47, 0xb8,
+    0x7a, 0xbc, 0x21, 0x9a, 0x27, 0xdc, 0xd2, 0x50, 0xcf, 0x7b, 0xde, 0x72,
+    0xc7, 0x83, 0x39, 0x12, 0x3b, 0x26, 0x0e, 0xad, 0xfe, 0x9d, 0xf8, 0x66,
+    0xa7, 0x01, 0x54, 0x56, 0x53, 0xda, 0xd2, 0x5d, 0xac, 0xe6, 0x2f, 0xf3,
+    0x8a, 0xba, 0x99, 0x08, 0xa4, 0xf4, 0xc3, 0x43, 0x64, 0xba, 0x8e, 0xd8,
+    0xd3, 0xa2, 0x8c, 0xad, 0xdf, 0x71, 0xe6, 0x48, 0xbf, 0xb6, 0x31, 0x9c,
+    0x6f, 0x5c, 0x0f, 0x85, 0x2f, 0x11, 0xd5, 0x6d, 0xe9, 0x5d, 0xe7, 0x65,
+    0x2c, 0x85, 0x21, 0x49, 0x55, 0x81, 0x1e, 0x26, 0x4e, 0x1e, 0x80, 0x9f,
+    0xd0, 0x15, 0x49, 0x99, 0xc9, 0x02, 0x03, 0x01, 0x00, 0x01, 0xa3, 0x3c,
+    0x30, 0x3a, 0x30, 0x09, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x04, 0x02, 0x30,
+    0x00, 0x30, 0x13, 0x06, 0x03, 0x55, 0x1d, 0x25, 0x04, 0x0c, 0x30, 0x0a,
+    0x06, 0x08, 0x2b, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x01, 0x30, 0x18,
+    0x06, 0x03, 0x55, 0x1d, 0x11, 0x04, 0x11, 0x30, 0x0f, 0x82, 0x0d, 0x70,
+    0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73, 0x2e, 0x74, 0x65, 0x73, 0x74,
+    0x30, 0x0d, 0x06, 0x09, 0x2a, 0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01,
+    0x0b, 0x05, 0x00, 0x03, 0x82, 0x01, 0x01, 0x00, 0x9c, 0x1b, 0xfd, 0xee,
+    0xb1, 0x52, 0x0c, 0x62, 0xc9, 0xed, 0x79, 0xf5, 0x7c, 0x9f, 0x9d, 0x69,
+    0x68, 0x7f, 0xc7, 0x04, 0x53, 0x4b, 0xb9, 0xd1, 0x7b, 0x0d, 0xfd, 0x3f,
+    0x45, 0x0d, 0x9b, 0xa5, 0x5f, 0xaa, 0x9a, 0x56, 0x0e, 0x14, 0xd6, 0x51,
+    0x4a, 0x9f, 0x50, 0xde, 0xfc, 0x46, 0x20, 0x66, 0xa9, 0x63, 0xa5, 0x94,
+    0x15, 0x76, 0x84, 0xab, 0x65, 0x9a, 0xc9, 0xbc, 0xfc, 0xf9, 0x06, 0x4a,
+    0xbc, 0x3b, 0x11, 0xac, 0x5f, 0x95, 0xe3, 0xb9, 0x44, 0x91, 0xf7, 0xc0,
+    0xba, 0x68, 0x39, 0x75, 0xdb, 0xda, 0xc3, 0xfb, 0xd8, 0xc0, 0x14, 0xd3,
+    0xab, 0x4a, 0xaf, 0xf9, 0x55, 0xf1, 0x1b, 0xec, 0x40, 0xaf, 0x38, 0x7f,
+    0xed, 0x12, 0x1e, 0x5e, 0x6a, 0x05, 0x88, 0xf6, 0x10, 0x27, 0x4f, 0x40,
+    0x3c, 0xcc, 0x37, 0xc0, 0x88, 0xc3, 0xed, 0x55, 0x0a, 0x12, 0xcf, 0x51,
+    0x33, 0xee, 0xe0, 0xb7, 0x26, 0x5c, 0x4d, 0x9c, 0x62, 0x64, 0x87, 0x75,
+    0x0c, 0x75, 0xcc, 0xc1, 0x19, 0xdf, 0x3a, 0x1f, 0xd9, 0x22, 0x75, 0xd6,
+    0x22, 0xc1, 0xaf, 0xa9, 0xca, 0x03, 0x56, 0x37, 0x9b, 0x30, 0x4a, 0x54,
+    0xa8, 0xf2, 0xef, 0x00, 0xc7, 0x32, 0x7b, 0x28, 0x87, 0x9a, 0xf5, 0xf5,
+    0x0f, 0x89, 0xcd, 0xd9, 0x02, 0x46, 0x6d, 0xa0, 0xa3, 0x79, 0x0a, 0x61,
+    0x18, 0x37, 0xd6, 0x8a, 0xe6, 0x5d, 0x98, 0x6e, 0xaa, 0x39, 0x20, 0x93,
+    0xdd, 0x47, 0xba, 0x50, 0x42, 0x69, 0xa3, 0x62, 0x8f, 0xb7, 0xdb, 0x1e,
+    0xb3, 0x4d, 0x13, 0xde, 0x56, 0xf3, 0xe9, 0xf9, 0x8d, 0x65, 0x33, 0x03,
+    0xa1, 0x07, 0x72, 0x45, 0x0a, 0x95, 0x5d, 0xe0, 0x97, 0xe8, 0x45, 0xb5,
+    0x9e, 0xb9, 0x36, 0xbd, 0x5d, 0x8b, 0x52, 0xd1, 0x9b, 0x20, 0xe9, 0x61,
+    0xbe, 0x00, 0x2f, 0x35, 0x9b, 0x82, 0xed, 0xf3, 0xf5, 0x43, 0x3d, 0xe2,
+};
+
+static const unsigned char k_rogue_server_key_der[1217] = {
+    0x30, 0x82, 0x04, 0xbd, 0x02, 0x01, 0x00, 0x30, 0x0d, 0x06, 0x09, 0x2a,
+    0x86, 0x48, 0x86, 0xf7, 0x0d, 0x01, 0x01, 0x01, 0x05, 0x00, 0x04, 0x82,
+    0x04, 0xa7, 0x30, 0x82, 0x04, 0xa3, 0x02, 0x01, 0x00, 0x02, 0x82, 0x01,
+    0x01, 0x00, 0x88, 0x39, 0x52, 0x9f, 0xb0, 0x9f, 0xb8, 0x9c, 0xee, 0x76,
+    0xd4, 0x6f, 0xed, 0x67, 0xfc, 0x2d, 0x62, 0xd0, 0x47, 0x4c, 0xfa, 0x0c,
+    0x05, 0x1f, 0xf4, 0x32, 0xcd, 0xa3, 0xb1, 0xd7, 0xe5, 0x09, 0x7c, 0x31,
+    0xf5, 0x73, 0x78, 0xc8, 0xd2, 0xaa, 0x48, 0x65, 0x88, 0x1e, 0x4e, 0xec,
+    0xa0, 0x47, 0x74, 0x79, 0x73, 0x2d, 0x88, 0x59, 0xac, 0x5d, 0x72, 0x4a,
+    0x57, 0xba, 0x1a, 0x94, 0x7f, 0x2b, 0xbc, 0xdf, 0x0a, 0xaf, 0xdb, 0x93,
+    0xef, 0x3d, 0x27, 0x8d, 0x4b, 0x05, 0x7b, 0xb0, 0x9d, 0x19, 0x05, 0x4f,
+    0x5b, 0x31, 0xa7, 0x6c, 0xc5, 0xc4, 0xa5, 0x0a, 0xfa, 0x84, 0xfa, 0xe2,
+    0xa2, 0xbe, 0x68, 0x2a, 0x92, 0x76, 0xca, 0x13, 0xcf, 0xc8, 0x90, 0x4a,
+    0xbc, 0x5b, 0x20, 0xb8, 0x0e, 0x3a, 0xc4, 0xd2, 0xe1, 0xc4, 0x63, 0xc3,
+    0x1f, 0xc0, 0x93, 0x07, 0x5d, 0x7f, 0xd7, 0xbd, 0xf1, 0x25, 0x2b, 0x8e,
+    0x81, 0x26, 0x25, 0xf4, 0xc3, 0x0a, 0xc7, 0xe4, 0xfc, 0xfe, 0x71, 0xe5,
+    0x85, 0x08, 0xc6, 0x83, 0x94, 0xfe, 0x16, 0xa4, 0xa3, 0x1f, 0x7c, 0x96,
+    0xe4, 0x37, 0x4d, 0x28, 0xcf, 0x5e, 0x52, 0x78, 0xcb, 0xe7, 0xbc, 0x47,
+    0xb8, 0x7a, 0xbc, 0x21, 0x9a, 0x27, 0xdc, 0xd2, 0x50, 0xcf, 0x7b, 0xde,
+    0x72, 0xc7, 0x83, 0x39, 0x12, 0x3b, 0x26, 0x0e, 0xad, 0xfe, 0x9d, 0xf8,
+    0x66, 0xa7, 0x01, 0x54, 0x56, 0x53, 0xda, 0xd2, 0x5d, 0xac, 0xe6, 0x2f,
+    0xf3, 0x8a, 0xba, 0x99, 0x08, 0xa4, 0xf4, 0xc3, 0x43, 0x64, 0xba, 0x8e,
+    0xd8, 0xd3, 0xa2, 0x8c, 0xad, 0xdf, 0x71, 0xe6, 0x48, 0xbf, 0xb6, 0x31,
+    0x9c, 0x6f, 0x5c, 0x0f, 0x85, 0x2f, 0x11, 0xd5, 0x6d, 0xe9, 0x5d, 0xe7,
+    0x65, 0x2c, 0x85, 0x21, 0x49, 0x55, 0x81, 0x1e, 0x26, 0x4e, 0x1e, 0x80,
+    0x9f, 0xd0, 0x15, 0x49, 0x99, 0xc9, 0x02, 0x03, 0x01, 0x00, 0x01, 0x02,
+    0x82, 0x01, 0x00, 0x18, 0x42, 0x55, 0x13, 0x79, 0x29, 0xc8, 0x7f, 0xb1,
+    0xfb, 0xd9, 0x73, 0x21, 0x4d, 0x2e, 0x5c, 0x8a, 0xc7, 0x5a, 0x9b, 0x3b,
+    0xc0, 0x5e, 0x3d, 0x45, 0x88, 0xb2, 0x94, 0x5f, 0x3c, 0x7a, 0x5e, 0x49,
+    0x0e, 0xc0, 0x8e, 0x52, 0xc9, 0x38, 0xb2, 0xf8, 0x77, 0x94, 0x59, 0x09,
+    0x67, 0x1c, 0x57, 0xfd, 0x47, 0x0f, 0x9a, 0xe1, 0x38, 0x4e, 0xf8, 0xc9,
+    0x3c, 0xb2, 0x08, 0xc3, 0x69, 0x04, 0x88, 0xae, 0x76, 0xed, 0xf9, 0x49,
+    0x5a, 0x3b, 0xf5, 0xa1, 0x10, 0x89, 0x76, 0xad, 0x83, 0x53, 0x46, 0xbc,
+    0x6a, 0x58, 0x6c, 0x2c, 0x4b, 0xb3, 0xa0, 0x84, 0x5f, 0xc3, 0x23, 0x61,
+    0x66, 0x70, 0xe3, 0x05, 0xbb, 0xe7, 0x1f, 0x5e, 0x77, 0x4e, 0xbe, 0x81,
+    0xeb, 0xbd, 0x45, 0x61, 0x3b, 0x45, 0xd5, 0x73, 0x6d, 0xb6, 0xa4, 0xf9,
+    0xbb, 0x2a, 0xf1, 0x69, 0x7d, 0x9b, 0x4a, 0x04, 0x0a, 0xa0, 0x61, 0xe2,
+    0xad, 0xa5, 0x32, 0xef, 0x4a, 0x3f, 0x1e, 0x01, 0xfa, 0x5c, 0x19, 0x0f,
+    0x9e, 0xd0, 0xf0, 0xec, 0x73, 0xc3, 0x97, 0x44, 0x94, 0xe5, 0x5f, 0xe1,
+    0xa8, 0x76, 0x41, 0x92, 0x92, 0x68, 0x20, 0x15, 0x3e, 0xcc, 0x91, 0x9f,
+    0x19, 0x11, 0x99, 0x5a, 0x40, 0xeb, 0x49, 0xd5, 0x1d, 0xdd, 0x8b, 0x41,
+    0xfc, 0xff, 0x03, 0x55, 0x22, 0xb7, 0x0b, 0x8f, 0xee, 0x92, 0xfb, 0xd9,
+    0x79, 0x29, 0xc9, 0xd9, 0xf8, 0x29, 0x52, 0x00, 0x6d, 0xe0, 0x92, 0x8b,
+    0x6c, 0x21, 0xe1, 0x9b, 0x21, 0x7a, 0xef, 0x54, 0x25, 0xad, 0x93, 0x45,
+    0x71, 0x93, 0x7f, 0x1f, 0xa5, 0x71, 0x1a, 0xd6, 0x4f, 0x86, 0xdd, 0x86,
+    0xd2, 0xd8, 0x53, 0x78, 0x48, 0x51, 0x2b, 0xb2, 0x4c, 0x34, 0xeb, 0xd7,
+    0xa9, 0x57, 0xec, 0xe9, 0x89, 0xba, 0x9e, 0xc8, 0x7e, 0xa8, 0xf9, 0x87,
+    0x23, 0xa0, 0xe8, 0xe4, 0x8d, 0x4b, 0xdd, 0x02, 0x81, 0x81, 0x00, 0xbd,
+    0x97, 0x96, 0xb9, 0x3b, 0x89, 0x77, 0x54, 0x11, 0xd6, 0x86, 0xa3, 0x68,
+    0x27, 0x8a, 0x9e, 0x20, 0x2f, 0x3a, 0x21, 0x88, 0xbe, 0x6c, 0xf6, 0x85,
+    0x56, 0x2f, 0xee, 0x58, 0xf1, 0xcb, 0x9a, 0x54, 0x13, 0x16, 0xf1, 0xf3,
+    0xe8, 0xf2, 0x02, 0xe9, 0x0f, 0x24, 0x35, 0xeb, 0x5e, 0x24, 0x11, 0x4d,
+    0xe6, 0xc1, 0xeb, 0xb2, 0xc3, 0x69, 0xed, 0x1b, 0xcb, 0x16, 0x68, 0x51,
+    0x9c, 0xef, 0x40, 0x92, 0xa1, 0x44, 0x29, 0xe1, 0x64, 0x9c, 0x41, 0xfe,
+    0x29, 0x78, 0xa1, 0x6d, 0xe5, 0x52, 0x25, 0xbf, 0xc0, 0x9c, 0x22, 0xf6,
+    0xa7, 0x37, 0x02, 0x39, 0x2e, 0x34, 0xad, 0xc1, 0x08, 0xf8, 0x38, 0xb5,
+    0xb2, 0x98, 0x1e, 0xa9, 0x1f, 0x96, 0xb8, 0x0a, 0x65, 0x7e, 0x97, 0x43,
+    0xcb, 0x0c, 0x3d, 0x1d, 0x83, 0xa3, 0x45, 0x7a, 0xc3, 0x23, 0x61, 0x60,
+    0x44, 0x19, 0xdc, 0x04, 0xfd, 0xa3, 0x83, 0x02, 0x81, 0x81, 0x00, 0xb7,
+    0xf0, 0x4b, 0x4c, 0x60, 0x34, 0x5c, 0xc0, 0x5c, 0x3f, 0x6b, 0x3f, 0x57,
+    0x37, 0xdb, 0x68, 0x18, 0xbf, 0x70, 0x71, 0xd0, 0xf3, 0x38, 0x45, 0x48,
+    0x67, 0x55, 0x48, 0xf5, 0x2e, 0x34, 0x1e, 0xf2, 0xe7, 0xf5, 0x92, 0x0d,
+    0x89, 0x82, 0xbf, 0x12, 0x59, 0x08, 0xe4, 0x23, 0x2a, 0x1b, 0xd4, 0x1a,
+    0x43, 0xbd, 0x0c, 0x11, 0x40, 0xf1, 0xc2, 0x13, 0x41, 0x17, 0xea, 0xf4,
+    0xcb, 0x2c, 0x94, 0x9c, 0x3c, 0x54, 0xfe, 0xd5, 0x91, 0x71, 0x7a, 0x6f,
+    0xad, 0x38, 0x9b, 0xc2, 0x99, 0x63, 0xc9, 0x09, 0x99, 0xf7, 0x0e, 0x75,
+    0xa5, 0x26, 0x38, 0xf6, 0x54, 0xbd, 0x67, 0xa9, 0xbf, 0xeb, 0x0e, 0x63,
+    0xc9, 0x54, 0x10, 0x1c, 0x1e, 0x6c, 0x53, 0x76, 0x6d, 0xd3, 0x06, 0x1b,
+    0x7d, 0x11, 0x0c, 0xad, 0x6b, 0x80, 0xa1, 0x78, 0xab, 0x64, 0x4f, 0x8e,
+    0x75, 0x8d, 0x6b, 0xf2, 0xdb, 0x2f, 0xc3, 0x02, 0x81, 0x80, 0x0e, 0x6e,
+    0xc4, 0xc5, 0x93, 0x17, 0xb2, 0xe2, 0xce, 0x7c, 0xd3, 0x41, 0x0b, 0x43,
+    0xbf, 0x54, 0xac, 0x44, 0x8c, 0x1b, 0x53, 0x6a, 0x93, 0xa6, 0xec, 0x9d,
+    0x94, 0x06, 0x83, 0xf4, 0xdc, 0x38, 0x02, 0x60, 0x75, 0xa5, 0xb3, 0x98,
+    0xaf, 0x1b, 0xb3, 0x9c, 0x38, 0x78, 0x76, 0x53, 0x73, 0x51, 0x71, 0xe9,
+    0xb8, 0x27, 0x76, 0x33, 0x54, 0x13, 0xfd, 0xc2, 0xa7, 0x11, 0x07, 0xed,
+    0x77, 0x75, 0x25, 0xf4, 0x6a, 0xd8, 0xf9, 0x54, 0x8c, 0x64, 0xa5, 0xb1,
+    0x88, 0x82, 0x59, 0x78, 0x54, 0x99, 0x95, 0x10, 0x57, 0x92, 0x7d, 0xce,
+    0x5a, 0xec, 0xab, 0x67, 0xae, 0x10, 0xf0, 0x19, 0xfb, 0xb3, 0x6d, 0x79,
+    0x8c, 0x05, 0x01, 0x80, 0xeb, 0x1b, 0x55, 0x87, 0x46, 0x6c, 0xc3, 0x77,
+    0x68, 0x96, 0x1a, 0x72, 0x13, 0xf2, 0xcd, 0x16, 0x9f, 0xd1, 0xe0, 0xdf,
+    0x2e, 0x4c, 0xc6, 0x80, 0x7c, 0x7b, 0x02, 0x81, 0x80, 0x5c, 0xdd, 0xb5,
+    0x26, 0x9a, 0x6b, 0xd5, 0x68, 0x49, 0x2a, 0xbb, 0xba, 0xff, 0x0d, 0xf4,
+    0x78, 0x5a, 0x06, 0x4d, 0x7f, 0x29, 0x3f, 0xa2, 0xe9, 0x57, 0xe4, 0xd3,
+    0xea, 0x41, 0xdf, 0x51, 0xf1, 0x4e, 0x32, 0x4e, 0x89, 0xae, 0xcb, 0xfe,
+    0x76, 0xf9, 0x8c, 0x7a, 0x30, 0xb4, 0x90, 0x4d, 0xfc, 0x88, 0x46, 0x2a,
+    0xec, 0x2c, 0xc9, 0xdd, 0x45, 0x5e, 0xf3, 0x3e, 0x60, 0x21, 0xb7, 0x72,
+    0x8a, 0x95, 0x56, 0xe0, 0x92, 0xc8, 0xc0, 0xe5, 0xca, 0x2b, 0x18, 0x09,
+    0xbc, 0x9a, 0x43, 0x57, 0x5d, 0xe8, 0xbb, 0x13, 0x40, 0xf9, 0xa4, 0xa7,
+    0xe7, 0x9a, 0x76, 0xae, 0x29, 0xe8, 0x4a, 0x3d, 0x22, 0xc6, 0xbe, 0x9e,
+    0xf2, 0x83, 0x3f, 0xd8, 0xf1, 0x4a, 0x99, 0xa8, 0x31, 0x2d, 0x2f, 0xb7,
+    0xab, 0xee, 0xe2, 0x97, 0xce, 0xee, 0x5d, 0x9a, 0x07, 0x90, 0xa5, 0x49,
+    0x01, 0x77, 0x5b, 0xb2, 0x81, 0x02, 0x81, 0x81, 0x00, 0x9c, 0x7b, 0x21,
+    0xd8, 0x9d, 0x5a, 0x6c, 0x8e, 0x17, 0x1d, 0x66, 0x54, 0x40, 0xda, 0xa1,
+    0xd6, 0xff, 0xe5, 0xe1, 0xc5, 0x2f, 0xb5, 0xba, 0x3d, 0xd1, 0x7b, 0x73,
+    0xfd, 0x36, 0x55, 0xc9, 0x9c, 0xa8, 0x25, 0xf4, 0x65, 0xa9, 0x83, 0xc1,
+    0x80, 0x5c, 0x11, 0x05, 0x72, 0x9c, 0x10, 0x3f, 0x79, 0x81, 0x9d, 0xd3,
+    0xb6, 0x8c, 0x2f, 0x76, 0x29, 0x7e, 0xa6, 0xe6, 0xe4, 0x78, 0x13, 0x7e,
+    0xee, 0xaa, 0x88, 0x0a, 0x45, 0x09, 0x1f, 0x28, 0x0b, 0x29, 0x65, 0x8e,
+    0x21, 0xcf, 0x03, 0x41, 0x48, 0x38, 0xdc, 0x02, 0x5f, 0x1c, 0x77, 0xe3,
+    0xfc, 0xaf, 0x36, 0x57, 0xb3, 0x5d, 0xf9, 0x44, 0x4c, 0x8d, 0xf3, 0xd0,
+    0xa0, 0x36, 0xd9, 0xc3, 0x32, 0xa2, 0x33, 0x5e, 0x2e, 0xf2, 0x35, 0x9c,
+    0x6f, 0x6a, 0xc5, 0x5c, 0xfd, 0x4e, 0xdd, 0xaa, 0x14, 0xbd, 0x54, 0x4d,
+    0xa2, 0xdd, 0x92, 0x21, 0xfe,
+};
+
+/* SHA-256 of the server certificate's SubjectPublicKeyInfo. */
+static const unsigned char k_rogue_server_spki_sha256[32] = {
+    0xc3, 0x79, 0x8f, 0x78, 0xc5, 0x4b, 0x53, 0x4b, 0xda, 0x0d, 0x01, 0xfc,
+    0xda, 0x69, 0x26, 0x3f, 0x15, 0x72, 0xe2, 0x2d, 0x6a, 0xc6, 0x80, 0x44,
+    0xfb, 0x3e, 0x59, 0x6a, 0xf1, 0x30, 0xc6, 0xf5,
+};
+
+/* ECDSA P-256, as scripts/generate_certs.sh --key-type ecdsa issues them. */
+static const unsigned char k_ec_ca_der[400] = {
+    0x30, 0x82, 0x01, 0x8c, 0x30, 0x82, 0x01, 0x33, 0xa0, 0x03, 0x02, 0x01,
+    0x02, 0x02, 0x01, 0x01, 0x30, 0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce,
+    0x3d, 0x04, 0x03, 0x02, 0x30, 0x3b, 0x31, 0x0b, 0x30, 0x09, 0x06, 0x03,
+    0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11, 0x30, 0x0f, 0x06,
+    0x03, 0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e,
+    0x75, 0x73, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c,
+    0x10, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73, 0x20, 0x54, 0x65,
+    0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x20, 0x17, 0x0d, 0x32, 0x30, 0x30,
+    0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x18, 0x0f,
+    0x32, 0x31, 0x30, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x5a, 0x30, 0x3b, 0x31, 0x0b, 0x30, 0x09, 0x06, 0x03, 0x55,
+    0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11, 0x30, 0x0f, 0x06, 0x03,
+    0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75,
+    0x73, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x10,
+    0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73, 0x20, 0x54, 0x65, 0x73,
+    0x74, 0x20, 0x43, 0x41, 0x30, 0x59, 0x30, 0x13, 0x06, 0x07, 0x2a, 0x86,
+    0x48, 0xce, 0x3d, 0x02, 0x01, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d,
+    0x03, 0x01, 0x07, 0x03, 0x42, 0x00, 0x04, 0xb5, 0x8d, 0xa2, 0xe3, 0xdb,
+    0x7e, 0x3c, 0x7d, 0x29, 0xb5, 0x16, 0xb2, 0x5f, 0x20, 0xfc, 0x39, 0xeb,
+    0xd3, 0xaa, 0x79, 0x9d, 0xd7, 0x20, 0x4f, 0x77, 0xf5, 0x3f, 0x3b, 0x8d,
+    0x83, 0xdd, 0x93, 0x21, 0xd0, 0x11, 0x5d, 0x52, 0xc2, 0xf3, 0xd1, 0x65,
+    0x4a, 0xc4, 0x2a, 0x18, 0xcf, 0xd7, 0xe7, 0xe5, 0x05, 0xcf, 0x28, 0x63,
+    0x15, 0x2d, 0x0f, 0x61, 0xbf, 0x2a, 0x52, 0x5b, 0x77, 0x08, 0x5c, 0xa3,
+    0x26, 0x30, 0x24, 0x30, 0x12, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x01, 0x01,
+    0xff, 0x04, 0x08, 0x30, 0x06, 0x01, 0x01, 0xff, 0x02, 0x01, 0x00, 0x30,
+    0x0e, 0x06, 0x03, 0x55, 0x1d, 0x0f, 0x01, 0x01, 0xff, 0x04, 0x04, 0x03,
+    0x02, 0x01, 0x06, 0x30, 0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d,
+    0x04, 0x03, 0x02, 0x03, 0x47, 0x00, 0x30, 0x44, 0x02, 0x20, 0x25, 0x3d,
+    0x2f, 0x83, 0xa5, 0xa3, 0xbf, 0x01, 0x66, 0x72, 0x79, 0x95, 0x75, 0x23,
+    0xb4, 0x9e, 0xac, 0xaf, 0xaf, 0x97, 0xd6, 0x27, 0xb2, 0xcf, 0x8e, 0x6b,
+    0x21, 0xdf, 0x40, 0x1f, 0x01, 0x57, 0x02, 0x20, 0x61, 0x98, 0x89, 0xfa,
+    0xb8, 0xea, 0xb9, 0x2e, 0x3f, 0xa0, 0x40, 0x89, 0xf7, 0x63, 0xee, 0x0a,
+    0x05, 0xc3, 0x97, 0x47, 0x60, 0x31, 0xe5, 0x3b, 0xb2, 0xed, 0x99, 0x0f,
+    0x57, 0x9c, 0x1e, 0xdf,
+};
+
+static const char k_ec_ca_pem[] =
+    "-----BEGIN CERTIFICATE-----\n"
+    "MIIBjDCCATOgAwIBAgIBATAKBggqhkjOPQQDAjA7MQswCQYDVQQGEwJVUzERMA8G\n"
+    "A1UECgwIUG9ydHVudXMxGTAXBgNVBAMMEFBvcnR1bnVzIFRlc3QgQ0EwIBcNMjAw\n"
+    "MTAxMDAwMDAwWhgPMjEwMDAxMDEwMDAwMDBaMDsxCzAJBgNVBAYTAlVTMREwDwYD\n"
+    "VQQKDAhQb3J0dW51czEZMBcGA1UEAwwQUG9ydHVudXMgVGVzdCBDQTBZMBMGByqG\n"
+    "SM49AgEGCCqGSM49AwEHA0IABLWNouPbfjx9KbUWsl8g/Dnr06p5ndcgT3f1PzuN\n"
+    "g92TIdARXVLC89FlSsQqGM/X5+UFzyhjFS0PYb8qUlt3CFyjJjAkMBIGA1UdEwEB\n"
+    "/wQIMAYBAf8CAQAwDgYDVR0PAQH/BAQDAgEGMAoGCCqGSM49BAMCA0cAMEQCICU9\n"
+    "L4Olo78BZnJ5lXUjtJ6sr6+X1ieyz45rId9AHwFXAiBhmIn6uOq5Lj+gQIn3Y+4K\n"
+    "BcOXR2Ax5Tuy7ZkPV5we3w==\n"
+    "-----END CERTIFICATE-----\n";
+
+static const unsigned char k_ec_server_der[420] = {
+    0x30, 0x82, 0x01, 0xa0, 0x30, 0x82, 0x01, 0x46, 0xa0, 0x03, 0x02, 0x01,
+    0x02, 0x02, 0x01, 0x02, 0x30, 0x0a, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce,
+    0x3d, 0x04, 0x03, 0x02, 0x30, 0x3b, 0x31, 0x0b, 0x30, 0x09, 0x06, 0x03,
+    0x55, 0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11, 0x30, 0x0f, 0x06,
+    0x03, 0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e,
+    0x75, 0x73, 0x31, 0x19, 0x30, 0x17, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c,
+    0x10, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73, 0x20, 0x54, 0x65,
+    0x73, 0x74, 0x20, 0x43, 0x41, 0x30, 0x20, 0x17, 0x0d, 0x32, 0x30, 0x30,
+    0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x5a, 0x18, 0x0f,
+    0x32, 0x31, 0x30, 0x30, 0x30, 0x31, 0x30, 0x31, 0x30, 0x30, 0x30, 0x30,
+    0x30, 0x30, 0x5a, 0x30, 0x38, 0x31, 0x0b, 0x30, 0x09, 0x06, 0x03, 0x55,
+    0x04, 0x06, 0x13, 0x02, 0x55, 0x53, 0x31, 0x11, 0x30, 0x0f, 0x06, 0x03,
+    0x55, 0x04, 0x0a, 0x0c, 0x08, 0x50, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75,
+    0x73, 0x31, 0x16, 0x30, 0x14, 0x06, 0x03, 0x55, 0x04, 0x03, 0x0c, 0x0d,
+    0x70, 0x6f, 0x72, 0x74, 0x75, 0x6e, 0x75, 0x73, 0x2e, 0x74, 0x65, 0x73,
+    0x74, 0x30, 0x59, 0x30, 0x13, 0x06, 0x07, 0x2a, 0x86, 0x48, 0xce, 0x3d,
+    0x02, 0x01, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x03, 0x01, 0x07,
+    0x03, 0x42, 0x00, 0x04, 0xce, 0xff, 0x14, 0x06, 0x1a, 0x33, 0x21, 0x4f,
+    0xa0, 0xc8, 0xdb, 0x55, 0x62, 0x9a, 0x82, 0xf8, 0x7c, 0xb3, 0x09, 0x2f,
+    0xb5, 0xc3, 0xa1, 0x74, 0x76, 0xb9, 0x0e, 0xe6, 0xf8, 0x34, 0x2d, 0xac,
+    0x54, 0xa2, 0x73, 0x17, 0x9f, 0x23, 0x7d, 0x37, 0x1d, 0x4e, 0x55, 0x56,
+    0xa4, 0x83, 0xde, 0x74, 0x09, 0x08, 0xea, 0xd3, 0xbf, 0x1b, 0xb3, 0x26,
+    0x7c, 0xc7, 0x5e, 0xd5, 0xa5, 0x48, 0x15, 0x61, 0xa3, 0x3c, 0x30, 0x3a,
+    0x30, 0x09, 0x06, 0x03, 0x55, 0x1d, 0x13, 0x04, 0x02, 0x30, 0x00, 0x30,
+    0x13, 0x06, 0x03, 0x55, 0x1d, 0x25, 0x04, 0x0c, 0x30, 0x0a, 0x06, 0x08,
+    0x2b, 0x06, 0x01, 0x05, 0x05, 0x07, 0x03, 0x01, 0x30, 0x18, 0x06, 0x03,
+    0x55, 0x1d, 0x11, 0x04, 0x11, 0x30, 0x0f, 0x82, 0x0d, 0x70, 0x6f, 0x72,
+    0x74, 0x75, 0x6e, 0x75, 0x73, 0x2e, 0x74, 0x65, 0x73, 0x74, 0x30, 0x0a,
+    0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d, 0x04, 0x03, 0x02, 0x03, 0x48,
+    0x00, 0x30, 0x45, 0x02, 0x21, 0x00, 0xda, 0x34, 0xe6, 0x04, 0xfe, 0x91,
+    0x11, 0x0d, 0xc9, 0x84, 0x6c, 0x98, 0x31, 0x0f, 0xae, 0xaa, 0xd9, 0x4a,
+    0x3a, 0xe6, 0x4b, 0xda, 0x04, 0xa0, 0x0d, 0xab, 0x12, 0x47, 0x63, 0x09,
+    0x91, 0xa9, 0x02, 0x20, 0x1e, 0xe1, 0x8f, 0x52, 0xb3, 0x77, 0xc3, 0x96,
+    0x92, 0xb3, 0xbd, 0xcd, 0x2e, 0x17, 0x9c, 0x64, 0xeb, 0x3e, 0x0c, 0x66,
+    0x8f, 0xd9, 0xf9, 0x56, 0xbe, 0x7e, 0x13, 0x5e, 0x2b, 0xa7, 0x2c, 0x36,
+};
+
+static const unsigned char k_ec_server_key_der[138] = {
+    0x30, 0x81, 0x87, 0x02, 0x01, 0x00, 0x30, 0x13, 0x06, 0x07, 0x2a, 0x86,
+    0x48, 0xce, 0x3d, 0x02, 0x01, 0x06, 0x08, 0x2a, 0x86, 0x48, 0xce, 0x3d,
+    0x03, 0x01, 0x07, 0x04, 0x6d, 0x30, 0x6b, 0x02, 0x01, 0x01, 0x04, 0x20,
+    0xe4, 0x0c, 0x6a, 0xfd, 0x67, 0xb7, 0xff, 0x9f, 0x3a, 0x39, 0xa3, 0x4a,
+    0x58, 0x43, 0xee, 0x8e, 0x74, 0x91, 0xf9, 0xa0, 0x0a, 0x78, 0x52, 0x76,
+    0x84, 0x33, 0xd6, 0x7a, 0x20, 0x12, 0x0f, 0x40, 0xa1, 0x44, 0x03, 0x42,
+    0x00, 0x04, 0xce, 0xff, 0x14, 0x06, 0x1a, 0x33, 0x21, 0x4f, 0xa0, 0xc8,
+    0xdb, 0x55, 0x62, 0x9a, 0x82, 0xf8, 0x7c, 0xb3, 0x09, 0x2f, 0xb5, 0xc3,
+    0xa1, 0x74, 0x76, 0xb9, 0x0e, 0xe6, 0xf8, 0x34, 0x2d, 0xac, 0x54, 0xa2,
+    0x73, 0x17, 0x9f, 0x23, 0x7d, 0x37, 0x1d, 0x4e, 0x55, 0x56, 0xa4, 0x83,
+    0xde, 0x74, 0x09, 0x08, 0xea, 0xd3, 0xbf, 0x1b, 0xb3, 0x26, 0x7c, 0xc7,
+    0x5e, 0xd5, 0xa5, 0x48, 0x15, 0x61,
+};
+
+/* SHA-256 of the server certificate's SubjectPublicKeyInfo. */
+static const unsigned char k_ec_server_spki_sha256[32] = {
+    0x53, 0x05, 0x92, 0x87, 0x97, 0xe9, 0x24, 0x29, 0xed, 0xb0, 0xbd, 0xe1,
+    0x6d, 0x24, 0x55, 0x5c, 0x79, 0x21, 0x2f, 0x71, 0xd2, 0x2f, 0xf7, 0x03,
+    0x16, 0x88, 0x47, 0x51, 0x9a, 0xbc, 0x42, 0xdb,
+};
@@ -15,6 +15,8 @@
 #include "timing_config.hpp"
 #include "error_codes.hpp"
 #include "event_types.hpp"
+#include "task_config.hpp"
+#include "task_boost.hpp"
 
 #include "../support/fake_clock.hpp"
 #include "../support/fake_access_point.hpp"
@@ -26,6 +28,11 @@
 #include "../components/event_bus/include/event_bus_fake.hpp"
 #endif
 
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+
 #include <string.h>
 
 void setUp(void) {
@@ -115,6 +122,28 @@ void test_grant_without_access_point_shows_feedback(void) {
     TEST_ASSERT_FALSE(fix.strike_energized());
 }
 
+/* Grant past its tap deadline: strike untouched, shown as a deny. */
+void test_stale_grant_does_not_unlock(void) {
+    FakeAccessPoint access;
+    FakeFeedback    fb;
+    FakeClock       clk;
+
+    SystemFSM fsm(nullptr, &access, &fb, &clk);
+    TEST_ASSERT_EQUAL(PORTUNUS_OK, fsm.init());
+    SystemFSMTestFixture fix(fsm);
+
+    portunus_event_t grant = make_grant();
+    grant.payload.access_decision.deadline_ms = clk.now_ms() + TAP_DEADLINE_MS;
+    clk.advance(TAP_DEADLINE_MS);
+    fix.inject(grant);
+
+    TEST_ASSERT_EQUAL(0, access.unlocks);
+    TEST_ASSERT_TRUE(access.locked);
+    TEST_ASSERT_FALSE(fix.strike_energized());
+    TEST_ASSERT_EQUAL(0, fb.count_of(feedback_type_t::ACCESS_GRANTED));
+    TEST_ASSERT_EQUAL(1, fb.count_of(feedback_type_t::ACCESS_DENIED));
+}
+
 /* Deny: no strike interaction, ACCESS_DENIED feedback. */
 void test_deny_shows_feedback_only(void) {
     FakeAccessPoint access;
@@ -226,6 +255,108 @@ void test_relock_failure_retries_on_next_tick(void) {
     TEST_ASSERT_TRUE(access.locked);
 }
 
+/* ── Scheduling stress: server_comm priority boost ────────────────────────── */
+
+/*
+ * Models server_comm under load on one core.  An "led" hog at the reactor
+ * priority and a "poll" hog at the reader priority each spin for
+ * STRESS_HOG_MS.  A worker at SERVER_COMM_TASK_PRIORITY waits for a tap
+ * request that costs STRESS_WORK_MS of CPU (TLS record + protobuf).  A
+ * producer posts it STRESS_POST_MS into the saturation the way
+ * on_credential_event does: hold the boost, then send to the queue front.
+ */
+#define STRESS_HOG_MS    400
+#define STRESS_POST_MS   50
+#define STRESS_WORK_MS   20
+
+struct stress_ctx_t {
+    QueueHandle_t     queue;
+    SemaphoreHandle_t done;
+    task_boost_t      boost;
+    TickType_t        posted_at;
+    TickType_t        done_at;
+};
+
+static void spin_for(TickType_t ticks) {
+    TickType_t start = xTaskGetTickCount();
+    while ((TickType_t)(xTaskGetTickCount() - start) < ticks) {
+        /* busy */
+    }
+}
+
+static void stress_hog_task(void *arg) {
+    (void)arg;
+    spin_for(pdMS_TO_TICKS(STRESS_HOG_MS));
+    vTaskDelete(NULL);
+}
+
+static void stress_worker_task(void *arg) {
+    stress_ctx_t *ctx = static_cast<stress_ctx_t *>(arg);
+    int item;
+    for (;;) {
+        xQueueReceive(ctx->queue, &item, portMAX_DELAY);
+        spin_for(pdMS_TO_TICKS(STRESS_WORK_MS));
+        ctx->done_at = xTaskGetTickCount();
+        task_boost_release(&ctx->boost);
+        xSemaphoreGive(ctx->done);
+    }
+}
+
+static void stress_producer_task(void *arg) {
+    stress_ctx_t *ctx = static_cast<stress_ctx_t *>(arg);
+    vTaskDelay(pdMS_TO_TICKS(STRESS_POST_MS));
+    int item = 1;
+    ctx->posted_at = xTaskGetTickCount();
+    task_boost_hold(&ctx->boost);
+    xQueueSendToFront(ctx->queue, &item, 0);
+    vTaskDelete(NULL);
+}
+
+/** Run one saturated tap; returns post-to-done latency in ms. */
+static uint32_t run_stress(UBaseType_t boost_priority, UBaseType_t *prio_after) {
+    static stress_ctx_t ctx;
+    ctx.queue = xQueueCreate(4, sizeof(int));
+    ctx.done  = xSemaphoreCreateBinary();
+
+    TaskHandle_t worker = NULL;
+    xTaskCreate(stress_worker_task, "stress_comm", 4096, &ctx,
+                SERVER_COMM_TASK_PRIORITY, &worker);
+    task_boost_init(&ctx.boost, worker, SERVER_COMM_TASK_PRIORITY, boost_priority);
+
+    xTaskCreate(stress_producer_task, "stress_tap", 4096, &ctx,
+                SERVER_COMM_BOOST_PRIORITY + 1, NULL);
+    xTaskCreate(stress_hog_task, "stress_led",  4096, NULL, REACTOR_TASK_PRIORITY, NULL);
+    xTaskCreate(stress_hog_task, "stress_poll", 4096, NULL, READER_TASK_PRIORITY,  NULL);
+
+    TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(ctx.done, pdMS_TO_TICKS(5000)));
+    uint32_t latency_ms = (uint32_t)((ctx.done_at - ctx.posted_at) * portTICK_PERIOD_MS);
+    *prio_after = uxTaskPriorityGet(worker);
+
+    /* Let the hogs finish before the next test. */
+    vTaskDelay(pdMS_TO_TICKS(STRESS_HOG_MS));
+    vTaskDelete(worker);
+    vQueueDelete(ctx.queue);
+    vSemaphoreDelete(ctx.done);
+    return latency_ms;
+}
+
+void test_boosted_comm_meets_tap_deadline_under_saturation(void) {
+    UBaseType_t prio_after = 0;
+    uint32_t latency = run_stress(SERVER_COMM_BOOST_PRIORITY, &prio_after);
+
+    TEST_ASSERT_LESS_THAN_UINT32(STRESS_WORK_MS * 4, latency);
+    TEST_ASSERT_EQUAL(SERVER_COMM_TASK_PRIORITY, prio_after);
+}
+
+void test_unboosted_comm_starves_behind_led_and_polling(void) {
+    /* Baseline for the test above: boosting disabled (fixed policy). */
+    UBaseType_t prio_after = 0;
+    uint32_t latency = run_stress(SERVER_COMM_TASK_PRIORITY, &prio_after);
+
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(STRESS_HOG_MS - STRESS_POST_MS - 20, latency);
+    TEST_ASSERT_EQUAL(SERVER_COMM_TASK_PRIORITY, prio_after);
+}
+
 /* ── Concurrency tests (real bus, built with PORTUNUS_TEST_REAL_BUS=ON) ──── */
 
 #ifdef PORTUNUS_TEST_REAL_BUS
@@ -257,12 +388,17 @@ extern "C" void app_main(void) {
     RUN_TEST(test_grant_unlocks_and_starts_hold_timer);
     RUN_TEST(test_grant_unlock_failure_does_not_start_timer);
     RUN_TEST(test_grant_without_access_point_shows_feedback);
+    RUN_TEST(test_stale_grant_does_not_unlock);
     RUN_TEST(test_deny_shows_feedback_only);
     RUN_TEST(test_credential_read_offline_shows_card_read_and_error);
     RUN_TEST(test_no_feedback_hardware_emits_nothing);
     RUN_TEST(test_strike_relocks_after_hold_expires);
     RUN_TEST(test_relock_failure_retries_on_next_tick);
 
+    /* Scheduling stress */
+    RUN_TEST(test_boosted_comm_meets_tap_deadline_under_saturation);
+    RUN_TEST(test_unboosted_comm_starves_behind_led_and_polling);
+
 #ifdef PORTUNUS_TEST_REAL_BUS
     /* Concurrency suite — only meaningful with real async bus */
     RUN_TEST(test_real_bus_publish_reaches_subscriber);
@@ -0,0 +1,146 @@
+/**
+ * @file mfrc522_emu.hpp
+ * @brief Emulated MFRC522 and ISO 14443A cards behind an mfrc522_spi_t.
+ *
+ * Enough of the chip for the reader HAL to run unmodified:
+ *
+ *   - the 64 registers with their reset values, SPI address/burst framing,
+ *     the 64-byte FIFO (flush, overflow → BufferOvfl);
+ *   - ComIrqReg / DivIrqReg with Set1 / Set2 semantics;
+ *   - Idle, CalcCRC (preset from ModeReg), Transceive started by StartSend,
+ *     SoftReset; TxLastBits / RxLastBits, TxCRCEn / RxCRCEn, CollReg;
+ *   - the timer (TAuto start at end of transmission, prescaler and reload,
+ *     stop on the first received bit) raising TimerIRq;
+ *   - the antenna (TxControlReg Tx1RFEn / Tx2RFEn).
+ *
+ * Time is virtual.  Every SPI transaction advances it by its bits at
+ * MFRC522_SPI_CLOCK_HZ plus a fixed per-transaction overhead (the driver,
+ * chip select and interrupt cost of one spi_device_transmit()); frames on
+ * the air take their 106 kbit/s bit time plus the card's frame delay.  So
+ * the HAL's polling loops cost exactly as many transactions as they would
+ * on the device, and the counters give the bus time a read costs.
+ *
+ * Cards have 4-, 7- or 10-byte UIDs and follow the ISO 14443-3 state
+ * machine (IDLE, READY per cascade level, ACTIVE, HALT) for REQA, WUPA,
+ * ANTICOLLISION with NVB 0x20, SELECT and HLTA; a card outside its
+ * [enter_us, exit_us) window, or with the antenna off, is unpowered and
+ * comes back IDLE.  Cards answering the same frame with different bits
+ * collide: CollErr, CollPos, and (ValuesAfterColl=0) zeroed bits after it.
+ * Bit-oriented anticollision (NVB other than 0x20 / 0x70) is not modelled.
+ */
+
+#pragma once
+
+#include "mfrc522.hpp"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+/** One virtual card. */
+struct Mfrc522EmuCard {
+    uint8_t uid[10];
+    uint8_t uid_len;            /**< 4, 7 or 10 */
+    uint8_t sak;                /**< SAK of the final cascade level (0x08 = Classic 1K) */
+    int64_t enter_us;           /**< Enters the field (virtual time) */
+    int64_t exit_us;            /**< Leaves it; INT64_MAX to stay */
+};
+
+struct Mfrc522EmuStats {
+    uint32_t transactions;      /**< SPI transactions (chip-select cycles) */
+    uint32_t bytes;             /**< Bytes clocked, both directions counted once */
+    int64_t  wire_ns;           /**< Time the clock ran at MFRC522_SPI_CLOCK_HZ */
+    int64_t  bus_ns;            /**< wire_ns plus the per-transaction overhead */
+};
+
+class Mfrc522Emu {
+public:
+    /** Overhead charged per transaction, on top of the wire time. */
+    explicit Mfrc522Emu(int64_t txn_overhead_ns = 15000);
+
+    /** Transport for mfrc522_init(); valid for the emulator's lifetime. */
+    mfrc522_spi_t spi();
+
+    /** Adds a card; returns its index. */
+    size_t add_card(const Mfrc522EmuCard &card);
+    void   clear_cards();
+
+    /** Power-on reset: registers, FIFO, cards' states, clock and counters. */
+    void power_on();
+
+    int64_t now_us() const { return m_now_ns / 1000; }
+    /** Lets virtual time pass without bus traffic (the poll interval). */
+    void    advance_us(int64_t us) { m_now_ns += us * 1000; }
+
+    const Mfrc522EmuStats &stats() const { return m_stats; }
+    void  reset_stats() { m_stats = {}; }
+
+    /** Raw register value, without side effects (for assertions). */
+    uint8_t peek(uint8_t reg) const { return m_reg[reg & 0x3F]; }
+
+private:
+    enum class CardState : uint8_t { OFF, IDLE, READY, ACTIVE, HALT };
+
+    struct Card {
+        Mfrc522EmuCard cfg;
+        CardState      state;
+        uint8_t        level;       /**< Cascade level being resolved (0-based) */
+        bool           halted;      /**< Was in HALT before the current REQA/WUPA */
+    };
+
+    struct Frame {
+        uint8_t data[18];
+        uint8_t len;                /**< Bytes, including a partial last byte */
+        uint8_t last_bits;          /**< Valid bits in the last byte, 0 = 8 */
+    };
+
+    static portunus_err_t transfer_thunk(void *ctx, const uint8_t *tx, uint8_t *rx, size_t len);
+    portunus_err_t transfer(const uint8_t *tx, uint8_t *rx, size_t len);
+
+    uint8_t read_reg(uint8_t reg);
+    void    write_reg(uint8_t reg, uint8_t value);
+
+    void soft_reset();
+    void start_command(uint8_t cmd);
+    void start_transceive();
+    void update();                  /**< Runs pending events up to m_now_ns */
+
+    void fifo_push(uint8_t b);
+    void power_cards();
+    bool card_respond(Card &card, const Frame &in, Frame &out);
+
+    int64_t timer_tick_ns() const;
+
+    uint8_t  m_reg[64];
+    uint8_t  m_fifo[64];
+    uint8_t  m_fifo_len;
+    uint8_t  m_fifo_head;
+
+    int64_t  m_now_ns;
+    int64_t  m_overhead_ns;
+
+    /* Transceive in flight */
+    bool     m_tx_pending;
+    int64_t  m_tx_end_ns;
+    bool     m_rx_pending;
+    int64_t  m_rx_start_ns;
+    int64_t  m_rx_end_ns;
+    Frame    m_rx;
+    uint8_t  m_rx_error;            /**< ErrorReg bits for the pending frame */
+    uint8_t  m_rx_coll_pos;         /**< CollReg CollPos, 0 = none */
+
+    /* Timer */
+    bool     m_timer_running;
+    int64_t  m_timer_start_ns;
+    int64_t  m_timer_expire_ns;
+
+    /* CalcCRC in flight */
+    bool     m_crc_pending;
+    int64_t  m_crc_done_ns;
+
+    std::vector<Card> m_cards;
+    Mfrc522EmuStats   m_stats;
+};
+
+/** ISO 14443-3 CRC_A of @p len bytes from @p preset; low byte first on air. */
+uint16_t mfrc522_emu_crc_a(const uint8_t *data, size_t len, uint16_t preset);
@@ -0,0 +1,588 @@
+/**
+ * @file mfrc522_emu.cpp
+ * @brief Emulated MFRC522 and ISO 14443A cards — implementation.
+ *
+ * Register and command behaviour follows the MFRC522 datasheet (rev. 3.9);
+ * card behaviour follows ISO/IEC 14443-3 type A.
+ */
+
+#include "mfrc522_emu.hpp"
+#include "error_codes.hpp"
+
+#include <string.h>
+
+/* ── Registers, commands, bits ─────────────────────────────────────────────── */
+
+#define REG_COMMAND        0x01
+#define REG_COM_IRQ        0x04
+#define REG_DIV_IRQ        0x05
+#define REG_ERROR          0x06
+#define REG_STATUS1        0x07
+#define REG_FIFO_DATA      0x09
+#define REG_FIFO_LEVEL     0x0A
+#define REG_CONTROL        0x0C
+#define REG_BIT_FRAMING    0x0D
+#define REG_COLL           0x0E
+#define REG_MODE           0x11
+#define REG_TX_MODE        0x12
+#define REG_RX_MODE        0x13
+#define REG_TX_CONTROL     0x14
+#define REG_DEMOD          0x19
+#define REG_CRC_RESULT_H   0x21
+#define REG_CRC_RESULT_L   0x22
+#define REG_T_MODE         0x2A
+#define REG_T_PRESCALER    0x2B
+#define REG_T_RELOAD_H     0x2C
+#define REG_T_RELOAD_L     0x2D
+#define REG_T_COUNTER_H    0x2E
+#define REG_T_COUNTER_L    0x2F
+#define REG_VERSION        0x37
+
+#define CMD_IDLE           0x00
+#define CMD_CALC_CRC       0x03
+#define CMD_TRANSCEIVE     0x0C
+#define CMD_SOFT_RESET     0x0F
+
+#define IRQ_TX             0x40
+#define IRQ_RX             0x20
+#define IRQ_ERR            0x02
+#define IRQ_TIMER          0x01
+#define DIV_IRQ_CRC        0x04
+
+#define ERR_BUFFER_OVFL    0x10
+#define ERR_COLL           0x08
+#define ERR_CRC            0x04
+
+#define PICC_REQA          0x26
+#define PICC_WUPA          0x52
+#define PICC_SEL_CL1       0x93
+#define PICC_HLTA          0x50
+#define PICC_CASCADE_TAG   0x88
+
+/* ── Timing ────────────────────────────────────────────────────────────────── */
+
+#define FC_HZ              13560000LL
+#define BIT_NS             (128LL * 1000000000LL / FC_HZ)    /* 106 kbit/s: 9.44 µs */
+#define FDT_NS             (1172LL * 1000000000LL / FC_HZ)   /* PCD→PICC frame delay: 86 µs */
+#define CRC_BYTE_NS        (8LL * 1000000000LL / FC_HZ)      /* CRC coprocessor, per byte */
+
+/* Datasheet §9.3 reset values; registers not listed reset to 0x00. */
+static const struct { uint8_t reg; uint8_t value; } k_reset_values[] = {
+    { REG_COMMAND,      0x20 }, { 0x02,             0x80 }, { REG_COM_IRQ,      0x14 },
+    { REG_STATUS1,      0x21 }, { 0x0B,             0x08 }, { REG_CONTROL,      0x10 },
+    { REG_COLL,         0x80 }, { REG_MODE,         0x3F }, { REG_TX_CONTROL,   0x80 },
+    { 0x16,             0x10 }, { 0x17,             0x84 }, { 0x18,             0x84 },
+    { REG_DEMOD,        0x4D }, { 0x1C,             0x62 }, { 0x1F,             0xEB },
+    { REG_CRC_RESULT_H, 0xFF }, { REG_CRC_RESULT_L, 0xFF }, { 0x24,             0x26 },
+    { 0x26,             0x48 }, { 0x27,             0x88 }, { 0x28,             0x20 },
+    { 0x29,             0x20 }, { REG_VERSION,      0x92 },
+};
+
+uint16_t mfrc522_emu_crc_a(const uint8_t *data, size_t len, uint16_t preset)
+{
+    uint16_t crc = preset;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t ch = data[i] ^ (uint8_t)(crc & 0xFF);
+        ch ^= (uint8_t)(ch << 4);
+        crc = (uint16_t)((crc >> 8) ^ ((uint16_t)ch << 8) ^ ((uint16_t)ch << 3) ^ (ch >> 4));
+    }
+    return crc;
+}
+
+static uint16_t crc_preset(uint8_t mode_reg)
+{
+    static const uint16_t presets[] = { 0x0000, 0x6363, 0xA671, 0xFFFF };
+    return presets[mode_reg & 0x03];
+}
+
+/* Bits on the air for a frame: start and end of frame, 9 per byte (8 +
+   parity), a short frame's 7 without parity. */
+static int64_t frame_bits(uint8_t len, uint8_t last_bits)
+{
+    if (len == 0) {
+        return 0;
+    }
+    if (last_bits == 0) {
+        return 2 + 9LL * len;
+    }
+    return 2 + 9LL * (len - 1) + last_bits;
+}
+
+/* ── Construction and the transport ────────────────────────────────────────── */
+
+Mfrc522Emu::Mfrc522Emu(int64_t txn_overhead_ns)
+    : m_overhead_ns(txn_overhead_ns)
+{
+    power_on();
+}
+
+mfrc522_spi_t Mfrc522Emu::spi()
+{
+    mfrc522_spi_t s;
+    s.transfer = transfer_thunk;
+    s.ctx      = this;
+    return s;
+}
+
+size_t Mfrc522Emu::add_card(const Mfrc522EmuCard &card)
+{
+    Card c = {};
+    c.cfg   = card;
+    c.state = CardState::OFF;
+    m_cards.push_back(c);
+    return m_cards.size() - 1;
+}
+
+void Mfrc522Emu::clear_cards()
+{
+    m_cards.clear();
+}
+
+void Mfrc522Emu::power_on()
+{
+    m_now_ns = 0;
+    m_stats  = {};
+    soft_reset();
+    for (Card &c : m_cards) {
+        c.state  = CardState::OFF;
+        c.level  = 0;
+        c.halted = false;
+    }
+}
+
+portunus_err_t Mfrc522Emu::transfer_thunk(void *ctx, const uint8_t *tx, uint8_t *rx, size_t len)
+{
+    return static_cast<Mfrc522Emu *>(ctx)->transfer(tx, rx, len);
+}
+
+/*
+ * Datasheet §8.1.2: the first byte is the address ((reg << 1) | 0x80 to
+ * read).  A read returns, during each following byte, the register named
+ * by the byte before it, so a burst read sends the next address in place
+ * of data.  A write stores every following byte in the one register (a
+ * FIFO burst).
+ */
+portunus_err_t Mfrc522Emu::transfer(const uint8_t *tx, uint8_t *rx, size_t len)
+{
+    if (tx == NULL || len < 2) {
+        return PORTUNUS_ERR_INVALID_ARG;
+    }
+
+    int64_t wire_ns = (int64_t)len * 8 * 1000000000LL / MFRC522_SPI_CLOCK_HZ;
+    m_stats.transactions++;
+    m_stats.bytes   += (uint32_t)len;
+    m_stats.wire_ns += wire_ns;
+    m_stats.bus_ns  += wire_ns + m_overhead_ns;
+    m_now_ns        += wire_ns + m_overhead_ns;
+    update();
+
+    if (rx != NULL) {
+        rx[0] = 0x00;
+    }
+    bool    read = (tx[0] & 0x80) != 0;
+    uint8_t reg  = (tx[0] >> 1) & 0x3F;
+    if (read) {
+        for (size_t i = 0; i + 1 < len; i++) {
+            uint8_t v = read_reg((tx[i] >> 1) & 0x3F);
+            if (rx != NULL) {
+                rx[i + 1] = v;
+            }
+        }
+    } else {
+        for (size_t i = 1; i < len; i++) {
+            write_reg(reg, tx[i]);
+        }
+    }
+    return PORTUNUS_OK;
+}
+
+/* ── Registers ─────────────────────────────────────────────────────────────── */
+
+int64_t Mfrc522Emu::timer_tick_ns() const
+{
+    int64_t presc = ((int64_t)(m_reg[REG_T_MODE] & 0x0F) << 8) | m_reg[REG_T_PRESCALER];
+    int64_t div   = (m_reg[REG_DEMOD] & 0x10) ? 2 * presc + 2 : 2 * presc + 1;
+    return div * 1000000000LL / FC_HZ;
+}
+
+uint8_t Mfrc522Emu::read_reg(uint8_t reg)
+{
+    switch (reg) {
+    case REG_FIFO_DATA: {
+        if (m_fifo_len == 0) {
+            return 0x00;
+        }
+        uint8_t b = m_fifo[m_fifo_head];
+        m_fifo_head = (uint8_t)((m_fifo_head + 1) % sizeof(m_fifo));
+        m_fifo_len--;
+        return b;
+    }
+    case REG_FIFO_LEVEL:
+        return m_fifo_len & 0x7F;
+    case REG_STATUS1:
+        return (uint8_t)((m_reg[REG_STATUS1] & ~0x08) | (m_timer_running ? 0x08 : 0x00));
+    case REG_T_COUNTER_H:
+    case REG_T_COUNTER_L: {
+        uint16_t v = 0;
+        if (m_timer_running) {
+            v = (uint16_t)((m_timer_expire_ns - m_now_ns) / timer_tick_ns());
+        }
+        return reg == REG_T_COUNTER_H ? (uint8_t)(v >> 8) : (uint8_t)v;
+    }
+    default:
+        return m_reg[reg];
+    }
+}
+
+void Mfrc522Emu::write_reg(uint8_t reg, uint8_t value)
+{
+    switch (reg) {
+    case REG_COMMAND:
+        m_reg[REG_COMMAND] = (uint8_t)(value & 0x3F);
+        start_command(value & 0x0F);
+        break;
+    case REG_COM_IRQ:
+    case REG_DIV_IRQ:
+        /* Bit 7 (Set1 / Set2): 1 sets the marked bits, 0 clears them. */
+        if (value & 0x80) {
+            m_reg[reg] |= value & 0x7F;
+        } else {
+            m_reg[reg] &= (uint8_t)~(value & 0x7F);
+        }
+        break;
+    case REG_ERROR:
+    case REG_STATUS1:
+    case REG_VERSION:
+    case REG_T_COUNTER_H:
+    case REG_T_COUNTER_L:
+        break;  /* read-only */
+    case REG_FIFO_DATA:
+        fifo_push(value);
+        break;
+    case REG_FIFO_LEVEL:
+        if (value & 0x80) {  /* FlushBuffer */
+            m_fifo_len  = 0;
+            m_fifo_head = 0;
+            m_reg[REG_ERROR] &= (uint8_t)~ERR_BUFFER_OVFL;
+        }
+        break;
+    case REG_CONTROL:
+        if (value & 0x80) {  /* TStopNow */
+            m_timer_running = false;
+        }
+        if (value & 0x40) {  /* TStartNow */
+            uint16_t reload = (uint16_t)(m_reg[REG_T_RELOAD_H] << 8 | m_reg[REG_T_RELOAD_L]);
+            m_timer_running   = true;
+            m_timer_start_ns  = m_now_ns;
+            m_timer_expire_ns = m_now_ns + (int64_t)(reload + 1) * timer_tick_ns();
+        }
+        break;
+    case REG_BIT_FRAMING:
+        m_reg[REG_BIT_FRAMING] = value;
+        if ((value & 0x80) && (m_reg[REG_COMMAND] & 0x0F) == CMD_TRANSCEIVE) {
+            start_transceive();
+        }
+        break;
+    case REG_TX_CONTROL:
+        m_reg[REG_TX_CONTROL] = value;
+        power_cards();
+        break;
+    default:
+        m_reg[reg] = value;
+        break;
+    }
+}
+
+void Mfrc522Emu::fifo_push(uint8_t b)
+{
+    if (m_fifo_len == sizeof(m_fifo)) {
+        m_reg[REG_ERROR] |= ERR_BUFFER_OVFL;
+        return;
+    }
+    m_fifo[(m_fifo_head + m_fifo_len) % sizeof(m_fifo)] = b;
+    m_fifo_len++;
+}
+
+/* ── Commands ──────────────────────────────────────────────────────────────── */
+
+void Mfrc522Emu::soft_reset()
+{
+    memset(m_reg, 0, sizeof(m_reg));
+    for (const auto &r : k_reset_values) {
+        m_reg[r.reg] = r.value;
+    }
+    m_fifo_len      = 0;
+    m_fifo_head     = 0;
+    m_tx_pending    = false;
+    m_rx_pending    = false;
+    m_timer_running = false;
+    m_crc_pending   = false;
+    power_cards();
+}
+
+void Mfrc522Emu::start_command(uint8_t cmd)
+{
+    /* A new command ends the running one. */
+    m_tx_pending  = false;
+    m_rx_pending  = false;
+    m_crc_pending = false;
+    m_reg[REG_ERROR] &= ERR_BUFFER_OVFL;
+
+    switch (cmd) {
+    case CMD_SOFT_RESET:
+        soft_reset();
+        break;
+    case CMD_CALC_CRC: {
+        uint8_t data[sizeof(m_fifo)];
+        uint8_t n = 0;
+        while (m_fifo_len > 0) {
+            data[n++] = read_reg(REG_FIFO_DATA);
+        }
+        uint16_t crc = mfrc522_emu_crc_a(data, n, crc_preset(m_reg[REG_MODE]));
+        m_reg[REG_CRC_RESULT_L] = (uint8_t)crc;
+        m_reg[REG_CRC_RESULT_H] = (uint8_t)(crc >> 8);
+        m_crc_pending = true;
+        m_crc_done_ns = m_now_ns + n * CRC_BYTE_NS;
+        break;
+    }
+    default:
+        break;  /* Idle, Transceive (waits for StartSend), others never finish */
+    }
+}
+
+void Mfrc522Emu::start_transceive()
+{
+    Frame tx = {};
+    while (m_fifo_len > 0 && tx.len < sizeof(tx.data) - 2) {
+        tx.data[tx.len++] = read_reg(REG_FIFO_DATA);
+    }
+    m_fifo_len  = 0;
+    m_fifo_head = 0;
+    tx.last_bits = m_reg[REG_BIT_FRAMING] & 0x07;
+    if ((m_reg[REG_TX_MODE] & 0x80) && tx.last_bits == 0) {  /* TxCRCEn */
+        uint16_t crc = mfrc522_emu_crc_a(tx.data, tx.len, crc_preset(m_reg[REG_MODE]));
+        tx.data[tx.len++] = (uint8_t)crc;
+        tx.data[tx.len++] = (uint8_t)(crc >> 8);
+    }
+
+    m_tx_pending = true;
+    m_tx_end_ns  = m_now_ns + frame_bits(tx.len, tx.last_bits) * BIT_NS;
+    m_rx_pending = false;
+
+    /* Every powered card hears the frame; those that answer overlap on the air. */
+    power_cards();
+    Frame answer = {};
+    Frame out;
+    int   answers = 0;
+    m_rx_error    = 0;
+    m_rx_coll_pos = 0;
+    for (Card &c : m_cards) {
+        if (c.state == CardState::OFF || !card_respond(c, tx, out)) {
+            continue;
+        }
+        if (answers++ == 0) {
+            answer = out;
+            continue;
+        }
+        if (m_rx_error & ERR_COLL) {
+            continue;  /* Already garbled from the first collision on */
+        }
+        uint8_t n = out.len > answer.len ? out.len : answer.len;
+        for (uint8_t i = 0; i < n; i++) {
+            uint8_t diff = (uint8_t)(answer.data[i] ^ out.data[i]);
+            if (diff == 0) {
+                continue;
+            }
+            uint8_t bit = 0;
+            while (!(diff & (1u << bit))) {
+                bit++;
+            }
+            m_rx_error   |= ERR_COLL;
+            m_rx_coll_pos = (uint8_t)((i * 8 + bit + 1) & 0x1F);  /* 32 reads as 0 */
+            answer.data[i] |= (uint8_t)(1u << bit);
+            if (!(m_reg[REG_COLL] & 0x80)) {  /* ValuesAfterColl=0: clear what follows */
+                answer.data[i] &= (uint8_t)((2u << bit) - 1);
+                memset(&answer.data[i + 1], 0, sizeof(answer.data) - i - 1);
+            }
+            if (out.len > answer.len) {
+                answer.len = out.len;
+            }
+            break;
+        }
+    }
+    if (answers == 0) {
+        return;
+    }
+
+    if ((m_reg[REG_RX_MODE] & 0x80) && answer.len >= 2) {  /* RxCRCEn */
+        uint16_t crc = mfrc522_emu_crc_a(answer.data, answer.len - 2, crc_preset(m_reg[REG_MODE]));
+        if (answer.data[answer.len - 2] != (uint8_t)crc ||
+            answer.data[answer.len - 1] != (uint8_t)(crc >> 8)) {
+            m_rx_error |= ERR_CRC;
+        }
+        answer.len -= 2;
+    }
+    m_rx          = answer;
+    m_rx_pending  = true;
+    m_rx_start_ns = m_tx_end_ns + FDT_NS;
+    m_rx_end_ns   = m_rx_start_ns + frame_bits(answer.len, answer.last_bits) * BIT_NS;
+}
+
+/* Events of the running command that are due by now, in time order. */
+void Mfrc522Emu::update()
+{
+    if (m_tx_pending && m_now_ns >= m_tx_end_ns) {
+        m_tx_pending = false;
+        m_reg[REG_COM_IRQ] |= IRQ_TX;
+        if (m_reg[REG_T_MODE] & 0x80) {  /* TAuto: start at the end of transmission */
+            uint16_t reload = (uint16_t)(m_reg[REG_T_RELOAD_H] << 8 | m_reg[REG_T_RELOAD_L]);
+            m_timer_running   = true;
+            m_timer_start_ns  = m_tx_end_ns;
+            m_timer_expire_ns = m_tx_end_ns + (int64_t)(reload + 1) * timer_tick_ns();
+        }
+    }
+
+    bool rx_first = m_rx_pending && !m_tx_pending &&
+                    (!m_timer_running || m_rx_start_ns < m_timer_expire_ns);
+    if (m_timer_running && !rx_first && m_now_ns >= m_timer_expire_ns) {
+        m_reg[REG_COM_IRQ] |= IRQ_TIMER;
+        m_timer_running = false;
+        if (m_reg[REG_T_MODE] & 0x10) {  /* TAutoRestart */
+            m_timer_running   = true;
+            m_timer_expire_ns += m_timer_expire_ns - m_timer_start_ns;
+        }
+    }
+
+    if (m_rx_pending && !m_tx_pending && m_now_ns >= m_rx_start_ns) {
+        if (m_reg[REG_T_MODE] & 0x80) {  /* TAuto: stop on the first received bit */
+            m_timer_running = false;
+        }
+        if (m_now_ns >= m_rx_end_ns) {
+            m_rx_pending = false;
+            for (uint8_t i = 0; i < m_rx.len; i++) {
+                fifo_push(m_rx.data[i]);
+            }
+            m_reg[REG_CONTROL] = (uint8_t)((m_reg[REG_CONTROL] & ~0x07) | (m_rx.last_bits & 0x07));
+            m_reg[REG_ERROR] |= m_rx_error;
+            if (m_rx_error & ERR_COLL) {
+                m_reg[REG_COLL] = (uint8_t)((m_reg[REG_COLL] & 0x80) | m_rx_coll_pos);
+            } else {
+                m_reg[REG_COLL] = (uint8_t)((m_reg[REG_COLL] & 0x80) | 0x20);  /* CollPosNotValid */
+            }
+            m_reg[REG_COM_IRQ] |= IRQ_RX | (m_rx_error ? IRQ_ERR : 0);
+        }
+    }
+
+    if (m_crc_pending && m_now_ns >= m_crc_done_ns) {
+        m_crc_pending = false;
+        m_reg[REG_DIV_IRQ] |= DIV_IRQ_CRC;
+        m_reg[REG_STATUS1] |= 0x20;  /* CRCReady */
+    }
+}
+
+/* ── Cards ─────────────────────────────────────────────────────────────────── */
+
+void Mfrc522Emu::power_cards()
+{
+    bool field = (m_reg[REG_TX_CONTROL] & 0x03) != 0;
+    for (Card &c : m_cards) {
+        bool in = field && m_now_ns >= c.cfg.enter_us * 1000 &&
+                  (c.cfg.exit_us == INT64_MAX || m_now_ns < c.cfg.exit_us * 1000);
+        if (!in) {
+            c.state  = CardState::OFF;
+            c.level  = 0;
+            c.halted = false;
+        } else if (c.state == CardState::OFF) {
+            c.state = CardState::IDLE;
+        }
+    }
+}
+
+/* The UID bytes a card sends at cascade level @p level: the cascade tag and
+   three bytes while more levels follow, else the last four. */
+static void level_bytes(const Mfrc522EmuCard &cfg, uint8_t level, uint8_t out[5])
+{
+    uint8_t levels = cfg.uid_len == 4 ? 1 : cfg.uid_len == 7 ? 2 : 3;
+    if (level + 1 < levels) {
+        out[0] = PICC_CASCADE_TAG;
+        memcpy(&out[1], &cfg.uid[3 * level], 3);
+    } else {
+        memcpy(out, &cfg.uid[3 * level], 4);
+    }
+    out[4] = out[0] ^ out[1] ^ out[2] ^ out[3];
+}
+
+bool Mfrc522Emu::card_respond(Card &card, const Frame &in, Frame &out)
+{
+    memset(&out, 0, sizeof(out));
+    CardState rest = card.halted ? CardState::HALT : CardState::IDLE;
+
+    if (in.len == 1 && in.last_bits == 7) {
+        uint8_t cmd = in.data[0] & 0x7F;
+        bool wake = (cmd == PICC_WUPA) ||
+                    (cmd == PICC_REQA && card.state == CardState::IDLE);
+        if (!wake) {
+            if (card.state == CardState::READY || card.state == CardState::ACTIVE) {
+                card.state = rest;
+            }
+            return false;
+        }
+        card.halted = card.state == CardState::HALT || (card.halted && cmd == PICC_WUPA);
+        card.state  = CardState::READY;
+        card.level  = 0;
+        out.data[0] = card.cfg.uid_len == 4 ? 0x04 : card.cfg.uid_len == 7 ? 0x44 : 0x84;
+        out.data[1] = 0x00;
+        out.len     = 2;
+        return true;
+    }
+    if (in.last_bits != 0) {
+        if (card.state == CardState::READY || card.state == CardState::ACTIVE) {
+            card.state = rest;
+        }
+        return false;
+    }
+
+    uint16_t crc = in.len >= 2 ? mfrc522_emu_crc_a(in.data, in.len - 2, 0x6363) : 0;
+    bool crc_ok = in.len >= 2 && in.data[in.len - 2] == (uint8_t)crc &&
+                  in.data[in.len - 1] == (uint8_t)(crc >> 8);
+
+    switch (card.state) {
+    case CardState::READY: {
+        uint8_t lb[5];
+        level_bytes(card.cfg, card.level, lb);
+        if (in.len == 2 && in.data[0] == PICC_SEL_CL1 + 2 * card.level && in.data[1] == 0x20) {
+            memcpy(out.data, lb, 5);
+            out.len = 5;
+            return true;
+        }
+        if (in.len == 9 && in.data[0] == PICC_SEL_CL1 + 2 * card.level && in.data[1] == 0x70 &&
+            crc_ok && memcmp(&in.data[2], lb, 5) == 0) {
+            uint8_t levels = card.cfg.uid_len == 4 ? 1 : card.cfg.uid_len == 7 ? 2 : 3;
+            if (card.level + 1 < levels) {
+                out.data[0] = 0x04;  /* Cascade bit: UID not complete */
+                card.level++;
+            } else {
+                out.data[0] = (uint8_t)(card.cfg.sak & ~0x04);
+                card.state  = CardState::ACTIVE;
+            }
+            uint16_t sak_crc = mfrc522_emu_crc_a(out.data, 1, 0x6363);
+            out.data[1] = (uint8_t)sak_crc;
+            out.data[2] = (uint8_t)(sak_crc >> 8);
+            out.len     = 3;
+            return true;
+        }
+        card.state = rest;
+        return false;
+    }
+    case CardState::ACTIVE:
+        if (in.len == 4 && in.data[0] == PICC_HLTA && in.data[1] == 0x00 && crc_ok) {
+            card.state  = CardState::HALT;
+            card.halted = true;
+            return false;
+        }
+        card.state = rest;
+        return false;
+    default:
+        return false;  /* IDLE and HALT ignore everything but REQA / WUPA */
+    }
+}
@@ -0,0 +1,275 @@
+/* MFRC522 reader HAL against an emulated chip — ESP-IDF linux target.
+ *
+ * The production mfrc522_hal.cpp runs unmodified over Mfrc522Emu's SPI
+ * transport (components/mfrc522_emu).  The first group of tests checks the
+ * HAL reads what the cards in the field hold; the benchmark then runs one
+ * scenario per row and prints the SPI traffic it cost:
+ *
+ *   txns      SPI transactions (chip-select cycles)
+ *   bytes     bytes clocked
+ *   wire us   clock time at MFRC522_SPI_CLOCK_HZ
+ *   bus us    wire time plus TXN_OVERHEAD_NS per transaction, the cost of
+ *             one spi_device_transmit() on the ESP32-S3
+ *
+ * Each row is also held to a transaction budget, so a change that makes
+ * the HAL chattier fails here rather than on a door.  The empty-field poll
+ * and the halt are bound by the chip's timer, not the frames: the HAL
+ * polls ComIrqReg until the ~15.5 ms timeout fires.
+ */
+
+#include "unity.h"
+#include "mfrc522.hpp"
+#include "mfrc522_emu.hpp"
+#include "error_codes.hpp"
+#include "timing_config.hpp"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/* Interrupt-driven spi_device_transmit() of a 2-byte transaction: queueing,
+   chip select, the done interrupt and the task switch back. */
+#define TXN_OVERHEAD_NS  15000
+
+static const uint8_t UID4[]  = { 0xA3, 0x2B, 0x1C, 0x04 };
+static const uint8_t UID4B[] = { 0xA3, 0x2B, 0x1D, 0x04 };
+static const uint8_t UID7[]  = { 0x04, 0x5F, 0x22, 0x1A, 0x9B, 0x80, 0x33 };
+static const uint8_t UID10[] = { 0x04, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99 };
+
+static Mfrc522EmuCard make_card(const uint8_t *uid, uint8_t len)
+{
+    Mfrc522EmuCard c = {};
+    memcpy(c.uid, uid, len);
+    c.uid_len  = len;
+    c.sak      = 0x08;
+    c.enter_us = 0;
+    c.exit_us  = INT64_MAX;
+    return c;
+}
+
+/* A chip that has been through mfrc522_init(), counters cleared. */
+static void bring_up(Mfrc522Emu &emu)
+{
+    mfrc522_spi_t spi = emu.spi();
+    TEST_ASSERT_EQUAL(PORTUNUS_OK, mfrc522_init(&spi));
+    emu.reset_stats();
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+/* ── Reads ────────────────────────────────────────────────────────────────── */
+
+void test_init_detects_chip_and_turns_antenna_on(void)
+{
+    Mfrc522Emu emu(TXN_OVERHEAD_NS);
+    mfrc522_spi_t spi = emu.spi();
+    TEST_ASSERT_EQUAL(PORTUNUS_OK, mfrc522_init(&spi));
+    TEST_ASSERT_EQUAL_HEX8(0x92, mfrc522_get_version());
+    TEST_ASSERT_EQUAL_HEX8(0x03, emu.peek(0x14) & 0x03);  /* TxControlReg */
+}
+
+static void check_read(const uint8_t *uid, uint8_t len)
+{
+    Mfrc522Emu emu(TXN_OVERHEAD_NS);
+    emu.add_card(make_card(uid, len));
+    bring_up(emu);
+
+    credential_t cred;
+    TEST_ASSERT_EQUAL(PORTUNUS_OK, mfrc522_read_credential(&cred));
+    TEST_ASSERT_EQUAL_UINT8(len, cred.uid_len);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(uid, cred.uid, len);
+}
+
+void test_reads_4_byte_uid(void)  { check_read(UID4, sizeof(UID4)); }
+void test_reads_7_byte_uid(void)  { check_read(UID7, sizeof(UID7)); }
+void test_reads_10_byte_uid(void) { check_read(UID10, sizeof(UID10)); }
+
+void test_empty_field_reports_no_credential(void)
+{
+    Mfrc522Emu emu(TXN_OVERHEAD_NS);
+    bring_up(emu);
+
+    credential_t cred;
+    TEST_ASSERT_EQUAL(PORTUNUS_ERR_NO_CREDENTIAL, mfrc522_read_credential(&cred));
+}
+
+/* Different UID sizes collide in the ATQA, equal sizes in the UID itself. */
+void test_two_cards_collide(void)
+{
+    const uint8_t *others[] = { UID7, UID4B };
+    const uint8_t  lens[]   = { sizeof(UID7), sizeof(UID4B) };
+    for (size_t i = 0; i < 2; i++) {
+        Mfrc522Emu emu(TXN_OVERHEAD_NS);
+        emu.add_card(make_card(UID4, sizeof(UID4)));
+        emu.add_card(make_card(others[i], lens[i]));
+        bring_up(emu);
+
+        credential_t cred;
+        TEST_ASSERT_EQUAL(PORTUNUS_ERR_CREDENTIAL_COLLISION, mfrc522_read_credential(&cred));
+    }
+}
+
+void test_halted_card_is_not_read_again(void)
+{
+    Mfrc522Emu emu(TXN_OVERHEAD_NS);
+    emu.add_card(make_card(UID7, sizeof(UID7)));
+    bring_up(emu);
+
+    credential_t cred;
+    TEST_ASSERT_EQUAL(PORTUNUS_OK, mfrc522_read_credential(&cred));
+    mfrc522_halt_credential();
+    TEST_ASSERT_EQUAL(PORTUNUS_ERR_NO_CREDENTIAL, mfrc522_read_credential(&cred));
+}
+
+void test_card_read_again_after_leaving_and_reentering(void)
+{
+    Mfrc522Emu emu(TXN_OVERHEAD_NS);
+    Mfrc522EmuCard first = make_card(UID4, sizeof(UID4));
+    first.exit_us = 100000;
+    Mfrc522EmuCard again = first;
+    again.enter_us = 400000;
+    again.exit_us  = INT64_MAX;
+    emu.add_card(first);
+    emu.add_card(again);
+    bring_up(emu);
+
+    credential_t cred;
+    TEST_ASSERT_EQUAL(PORTUNUS_OK, mfrc522_read_credential(&cred));
+    mfrc522_halt_credential();
+
+    emu.advance_us(200000 - emu.now_us());  /* Out of the field */
+    TEST_ASSERT_EQUAL(PORTUNUS_ERR_NO_CREDENTIAL, mfrc522_read_credential(&cred));
+
+    emu.advance_us(500000 - emu.now_us());  /* Back, powered up fresh */
+    TEST_ASSERT_EQUAL(PORTUNUS_OK, mfrc522_read_credential(&cred));
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(UID4, cred.uid, sizeof(UID4));
+}
+
+void test_card_entering_between_polls_is_read(void)
+{
+    Mfrc522Emu emu(TXN_OVERHEAD_NS);
+    Mfrc522EmuCard late = make_card(UID10, sizeof(UID10));
+    late.enter_us = 100000;
+    emu.add_card(late);
+    bring_up(emu);
+
+    credential_t cred;
+    TEST_ASSERT_EQUAL(PORTUNUS_ERR_NO_CREDENTIAL, mfrc522_read_credential(&cred));
+    emu.advance_us(MFRC522_POLL_INTERVAL_MS * 1000);
+    TEST_ASSERT_EQUAL(PORTUNUS_OK, mfrc522_read_credential(&cred));
+    TEST_ASSERT_EQUAL_UINT8(sizeof(UID10), cred.uid_len);
+}
+
+/* ── Benchmark ────────────────────────────────────────────────────────────── */
+
+typedef struct {
+    const char     *name;
+    portunus_err_t  expect;
+    uint32_t        max_txns;       /**< Regression budget */
+} bench_row_t;
+
+static void bench_report(const bench_row_t *row, portunus_err_t got, const Mfrc522EmuStats &s)
+{
+    printf("  %-28s %6u %7u %9.1f %9.1f\n", row->name, (unsigned)s.transactions,
+           (unsigned)s.bytes, s.wire_ns / 1000.0, s.bus_ns / 1000.0);
+    TEST_ASSERT_EQUAL_MESSAGE(row->expect, got, row->name);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32_MESSAGE(row->max_txns, s.transactions, row->name);
+}
+
+static void bench_read(const bench_row_t *row, const uint8_t *uid, uint8_t len)
+{
+    Mfrc522Emu emu(TXN_OVERHEAD_NS);
+    if (uid != NULL) {
+        emu.add_card(make_card(uid, len));
+    }
+    bring_up(emu);
+    credential_t cred;
+    portunus_err_t err = mfrc522_read_credential(&cred);
+    bench_report(row, err, emu.stats());
+}
+
+void test_bench_spi_cost_per_scenario(void)
+{
+    printf("\nMFRC522 SPI cost at %d Hz, %d ns per transaction\n",
+           MFRC522_SPI_CLOCK_HZ, TXN_OVERHEAD_NS);
+    printf("  %-28s %6s %7s %9s %9s\n", "scenario", "txns", "bytes", "wire us", "bus us");
+
+    {
+        static const bench_row_t row = { "init", PORTUNUS_OK, 14 };
+        Mfrc522Emu emu(TXN_OVERHEAD_NS);
+        mfrc522_spi_t spi = emu.spi();
+        portunus_err_t err = mfrc522_init(&spi);
+        bench_report(&row, err, emu.stats());
+    }
+
+    static const bench_row_t no_card = { "poll, empty field", PORTUNUS_ERR_NO_CREDENTIAL, 900 };
+    static const bench_row_t uid4    = { "read 4-byte UID", PORTUNUS_OK, 210 };
+    static const bench_row_t uid7    = { "read 7-byte UID", PORTUNUS_OK, 380 };
+    static const bench_row_t uid10   = { "read 10-byte UID", PORTUNUS_OK, 550 };
+    bench_read(&no_card, NULL, 0);
+    bench_read(&uid4, UID4, sizeof(UID4));
+    bench_read(&uid7, UID7, sizeof(UID7));
+    bench_read(&uid10, UID10, sizeof(UID10));
+
+    {
+        static const bench_row_t row = { "two cards, collision", PORTUNUS_ERR_CREDENTIAL_COLLISION, 95 };
+        Mfrc522Emu emu(TXN_OVERHEAD_NS);
+        emu.add_card(make_card(UID4, sizeof(UID4)));
+        emu.add_card(make_card(UID4B, sizeof(UID4B)));
+        bring_up(emu);
+        credential_t cred;
+        portunus_err_t err = mfrc522_read_credential(&cred);
+        bench_report(&row, err, emu.stats());
+    }
+
+    {
+        static const bench_row_t halt = { "halt after read", PORTUNUS_OK, 930 };
+        static const bench_row_t poll = { "poll, halted card", PORTUNUS_ERR_NO_CREDENTIAL, 900 };
+        Mfrc522Emu emu(TXN_OVERHEAD_NS);
+        emu.add_card(make_card(UID4, sizeof(UID4)));
+        bring_up(emu);
+        credential_t cred;
+        TEST_ASSERT_EQUAL(PORTUNUS_OK, mfrc522_read_credential(&cred));
+        emu.reset_stats();
+        mfrc522_halt_credential();
+        bench_report(&halt, PORTUNUS_OK, emu.stats());
+        emu.reset_stats();
+        portunus_err_t err = mfrc522_read_credential(&cred);
+        bench_report(&poll, err, emu.stats());
+    }
+
+    {
+        /* What an idle door spends on the bus: one empty poll per interval. */
+        Mfrc522Emu emu(TXN_OVERHEAD_NS);
+        bring_up(emu);
+        credential_t cred;
+        mfrc522_read_credential(&cred);
+        printf("  idle bus occupancy at a %d ms poll interval: %.1f%%\n",
+               MFRC522_POLL_INTERVAL_MS,
+               100.0 * emu.stats().bus_ns / (MFRC522_POLL_INTERVAL_MS * 1e6));
+    }
+}
+
+/* ── Entry point ──────────────────────────────────────────────────────────── */
+
+extern "C" void app_main(void)
+{
+    UNITY_BEGIN();
+
+    RUN_TEST(test_init_detects_chip_and_turns_antenna_on);
+    RUN_TEST(test_reads_4_byte_uid);
+    RUN_TEST(test_reads_7_byte_uid);
+    RUN_TEST(test_reads_10_byte_uid);
+    RUN_TEST(test_empty_field_reports_no_credential);
+    RUN_TEST(test_two_cards_collide);
+    RUN_TEST(test_halted_card_is_not_read_again);
+    RUN_TEST(test_card_read_again_after_leaving_and_reentering);
+    RUN_TEST(test_card_entering_between_polls_is_read);
+
+    RUN_TEST(test_bench_spi_cost_per_scenario);
+
+    int failures = UNITY_END();
+    exit(failures);
+}
@@ -12,6 +12,14 @@
 #   ./scripts/generate_certs.sh --ip 192.168.1.100    # non-interactive
 #   ./scripts/generate_certs.sh --ip 192.168.1.100 --dns portunus.local
 #   ./scripts/generate_certs.sh --ip 192.168.1.100 --days 730
+#   ./scripts/generate_certs.sh --ip 192.168.1.100 --key-type ecdsa
+#   ./scripts/generate_certs.sh --psk door-001        # TLS-PSK key only
+#
+# --key-type ecdsa issues P-256 keys, as the ECC transport profile
+# (CONFIG_PORTUNUS_TLS_PROFILE_ECC) requires; the default is RSA-2048.
+# --psk generates a module's TLS pre-shared key for the PSK profile,
+# appends it to certs/tls_psk.txt (module_id:key) and prints the NVS
+# line for that module; no certificates are touched.
 #
 # Output (all files written to <repo>/certs/):
 #   ca.key          — CA private key           (KEEP SECRET)
@@ -20,9 +28,11 @@
 #   server.pem      — Server certificate        → PORTUNUS_TLS_CERT_FILE
 #   server.csr      — Server CSR (intermediate, can be deleted)
 #
-# The script also copies ca.pem into the firmware tree at:
+# The script also copies the CA into the firmware tree, as PEM and as the
+# DER the firmware embeds:
 #   access_module/certs/ca_cert.pem
-# so that CMakeLists.txt can embed it via EMBED_TXTFILES.
+#   access_module/certs/ca_cert.der
+# and prints the server's SPKI pin for CONFIG_PORTUNUS_TLS_SPKI_PIN.
 #
 # Requires: openssl >= 1.1.1
 # ──────────────────────────────────────────────────────────────────────────────
@@ -32,6 +42,8 @@ set -euo pipefail
 CA_DAYS=3650          # CA valid for 10 years (long-lived, rotated manually)
 SERVER_DAYS=825       # Server cert valid ~2.25 years (Apple max)
 KEY_BITS=2048         # RSA key size
+KEY_TYPE="rsa"        # rsa | ecdsa (P-256)
+PSK_MODULE=""
 SERVER_IP=""
 SERVER_DNS=""
 EXTRA_DAYS=""
@@ -48,8 +60,10 @@ while [[ $# -gt 0 ]]; do
         --ip)    SERVER_IP="$2";    shift 2 ;;
         --dns)   SERVER_DNS="$2";   shift 2 ;;
         --days)  EXTRA_DAYS="$2";   shift 2 ;;
+        --key-type) KEY_TYPE="$2";  shift 2 ;;
+        --psk)   PSK_MODULE="$2";   shift 2 ;;
         --help|-h)
-            head -30 "$0" | grep '^#' | sed 's/^# \?//'
+            head -40 "$0" | grep '^#' | sed 's/^# \?//'
             exit 0
             ;;
         *)
@@ -63,6 +77,39 @@ if [[ -n "$EXTRA_DAYS" ]]; then
     SERVER_DAYS="$EXTRA_DAYS"
 fi
 
+case "$KEY_TYPE" in
+    rsa|ecdsa) ;;
+    *)
+        echo "Error: --key-type must be rsa or ecdsa." >&2
+        exit 1
+        ;;
+esac
+
+# ── TLS-PSK key for one module (no certificates) ────────────────────────────
+if [[ -n "$PSK_MODULE" ]]; then
+    if ! [[ "$PSK_MODULE" =~ ^[A-Za-z0-9._-]{1,32}$ ]]; then
+        echo "Error: '$PSK_MODULE' is not a module_id (1-32 of A-Z a-z 0-9 . _ -)." >&2
+        exit 1
+    fi
+    mkdir -p "$OUT_DIR"
+    PSK_FILE="$OUT_DIR/tls_psk.txt"
+    if [[ -f "$PSK_FILE" ]] && grep -q "^${PSK_MODULE}:" "$PSK_FILE"; then
+        echo "Error: $PSK_FILE already has a key for $PSK_MODULE." >&2
+        exit 1
+    fi
+    PSK_HEX=$(openssl rand -hex 32)
+    ( umask 077; echo "${PSK_MODULE}:${PSK_HEX}" >> "$PSK_FILE" )
+    echo "→ TLS-PSK key for ${PSK_MODULE} appended to $PSK_FILE (KEEP SECRET)"
+    echo ""
+    echo "  NVS line for this module's nvs_config.csv:"
+    echo ""
+    echo "     tls_psk,data,string,${PSK_HEX}"
+    echo ""
+    echo "  The TLS endpoint the module connects to must accept identity"
+    echo "  \"${PSK_MODULE}\" with this key (TLS 1.3, TLS_AES_128_GCM_SHA256)."
+    exit 0
+fi
+
 # ── Prompt for IP if not provided ────────────────────────────────────────────
 if [[ -z "$SERVER_IP" ]]; then
     # Try to detect the default LAN IP for convenience
@@ -105,6 +152,7 @@ echo "║  Server DNS:   $SERVER_DNS"
 fi
 echo "║  CA validity:  $CA_DAYS days"
 echo "║  Cert validity: $SERVER_DAYS days"
+echo "║  Key type:     $KEY_TYPE"
 echo "║  Output:       $OUT_DIR/"
 echo "╚══════════════════════════════════════════════════╝"
 echo ""
@@ -124,21 +172,36 @@ fi
 SERVER_EXT_CNF=$(mktemp)
 trap 'rm -f "$SERVER_EXT_CNF"' EXIT
 
+# keyEncipherment only means something for RSA key transport.
+SERVER_KEY_USAGE="digitalSignature, keyEncipherment"
+if [[ "$KEY_TYPE" == "ecdsa" ]]; then
+    SERVER_KEY_USAGE="digitalSignature"
+fi
+
 cat > "$SERVER_EXT_CNF" <<EOF
 [v3_server]
 basicConstraints       = CA:FALSE
-keyUsage               = digitalSignature, keyEncipherment
+keyUsage               = ${SERVER_KEY_USAGE}
 extendedKeyUsage       = serverAuth
 subjectAltName         = ${SAN}
 subjectKeyIdentifier   = hash
 authorityKeyIdentifier = keyid,issuer
 EOF
 
+# new_key <file>: a private key of $KEY_TYPE.
+new_key() {
+    if [[ "$KEY_TYPE" == "ecdsa" ]]; then
+        openssl genpkey -algorithm EC -pkeyopt ec_paramgen_curve:P-256 -out "$1" 2>/dev/null
+    else
+        openssl genrsa -out "$1" "$KEY_BITS" 2>/dev/null
+    fi
+}
+
 # ══════════════════════════════════════════════════════════════════════════════
 #  Step 1: Certificate Authority
 # ══════════════════════════════════════════════════════════════════════════════
 echo "→ Generating CA private key..."
-openssl genrsa -out "$OUT_DIR/ca.key" "$KEY_BITS" 2>/dev/null
+new_key "$OUT_DIR/ca.key"
 
 echo "→ Generating CA certificate (self-signed, ${CA_DAYS}d)..."
 openssl req -new -x509 \
@@ -154,7 +217,7 @@ openssl req -new -x509 \
 #  Step 2: Server certificate
 # ══════════════════════════════════════════════════════════════════════════════
 echo "→ Generating server private key..."
-openssl genrsa -out "$OUT_DIR/server.key" "$KEY_BITS" 2>/dev/null
+new_key "$OUT_DIR/server.key"
 
 echo "→ Generating server CSR..."
 openssl req -new \
@@ -179,13 +242,14 @@ openssl x509 -req \
 #  Step 3: Copy CA cert into firmware tree for embedding
 # ══════════════════════════════════════════════════════════════════════════════
 cp "$OUT_DIR/ca.pem" "$FW_CERT_DIR/ca_cert.pem"
-echo "→ Copied CA cert to $FW_CERT_DIR/ca_cert.pem"
+openssl x509 -in "$OUT_DIR/ca.pem" -outform DER -out "$FW_CERT_DIR/ca_cert.der"
+echo "→ Copied CA cert to $FW_CERT_DIR/ca_cert.pem (and ca_cert.der)"
 
 # ══════════════════════════════════════════════════════════════════════════════
 #  Step 4: Set file permissions
 # ══════════════════════════════════════════════════════════════════════════════
 chmod 600 "$OUT_DIR/ca.key" "$OUT_DIR/server.key"
-chmod 644 "$OUT_DIR/ca.pem" "$OUT_DIR/server.pem" "$FW_CERT_DIR/ca_cert.pem"
+chmod 644 "$OUT_DIR/ca.pem" "$OUT_DIR/server.pem" "$FW_CERT_DIR/ca_cert.pem" "$FW_CERT_DIR/ca_cert.der"
 
 # ══════════════════════════════════════════════════════════════════════════════
 #  Step 5: Verify
@@ -209,6 +273,13 @@ else
     echo "  ✗ CHAIN VERIFICATION FAILED" >&2
     exit 1
 fi
+echo ""
+
+SPKI_PIN=$(openssl x509 -in "$OUT_DIR/server.pem" -pubkey -noout \
+    | openssl pkey -pubin -outform DER \
+    | openssl dgst -sha256 -hex | sed 's/^.* //')
+echo "Server SPKI pin (SHA-256 of the public key):"
+echo "  $SPKI_PIN"
 
 # ══════════════════════════════════════════════════════════════════════════════
 #  Summary
@@ -235,4 +306,13 @@ echo ""
 echo "     CONFIG_PORTUNUS_USE_TLS=y"
 echo "     CONFIG_PORTUNUS_TLS_SERVER_PORT=8443"
 echo "     CONFIG_PORTUNUS_TLS_SKIP_VERIFY=n     ← no longer needed!"
+echo ""
+if [[ "$KEY_TYPE" == "ecdsa" ]]; then
+echo "     CONFIG_PORTUNUS_TLS_PROFILE_ECC=y      ← ECDSA keys: TLS 1.3, ECC only"
+echo "     CONFIG_MBEDTLS_SSL_PROTO_TLS1_3=y"
+echo ""
+fi
+echo "     Optionally, to trust only this server key (no chain check):"
+echo ""
+echo "     CONFIG_PORTUNUS_TLS_SPKI_PIN=\"$SPKI_PIN\""
 echo ""
\ No newline at end of file
@@ -116,6 +116,91 @@ func (ProvisionStatus) EnumDescriptor() ([]byte, []int) {
 	return file_portunus_v1_portunus_proto_rawDescGZIP(), []int{0}
 }
 
+// Reason codes for AccessResponse.reason_code.  Each value is the reason
+// string upper-cased with the ACCESS_REASON_ prefix, so a reason the enum
+// does not list yet maps to UNSPECIFIED and travels as text.
+type AccessReason int32
+
+const (
+	AccessReason_ACCESS_REASON_UNSPECIFIED               AccessReason = 0
+	AccessReason_ACCESS_REASON_ALLOW_ALL                 AccessReason = 1
+	AccessReason_ACCESS_REASON_CREDENTIAL_ALLOWED        AccessReason = 2
+	AccessReason_ACCESS_REASON_DENIED                    AccessReason = 3
+	AccessReason_ACCESS_REASON_UNKNOWN_MODULE            AccessReason = 4
+	AccessReason_ACCESS_REASON_INVALID_CREDENTIAL_FORMAT AccessReason = 5
+	AccessReason_ACCESS_REASON_CREDENTIAL_NOT_FOUND      AccessReason = 6
+	AccessReason_ACCESS_REASON_MEMBER_EXPIRED            AccessReason = 7
+	AccessReason_ACCESS_REASON_MEMBER_SUSPENDED          AccessReason = 8
+	AccessReason_ACCESS_REASON_MEMBER_ARCHIVED           AccessReason = 9
+	AccessReason_ACCESS_REASON_MEMBER_DISABLED           AccessReason = 10
+	AccessReason_ACCESS_REASON_CREDENTIAL_NOT_AUTHORIZED AccessReason = 11
+	AccessReason_ACCESS_REASON_AUTHORIZATION_REVOKED     AccessReason = 12
+	AccessReason_ACCESS_REASON_AUTHORIZATION_EXPIRED     AccessReason = 13
+)
+
+// Enum value maps for AccessReason.
+var (
+	AccessReason_name = map[int32]string{
+		0:  "ACCESS_REASON_UNSPECIFIED",
+		1:  "ACCESS_REASON_ALLOW_ALL",
+		2:  "ACCESS_REASON_CREDENTIAL_ALLOWED",
+		3:  "ACCESS_REASON_DENIED",
+		4:  "ACCESS_REASON_UNKNOWN_MODULE",
+		5:  "ACCESS_REASON_INVALID_CREDENTIAL_FORMAT",
+		6:  "ACCESS_REASON_CREDENTIAL_NOT_FOUND",
+		7:  "ACCESS_REASON_MEMBER_EXPIRED",
+		8:  "ACCESS_REASON_MEMBER_SUSPENDED",
+		9:  "ACCESS_REASON_MEMBER_ARCHIVED",
+		10: "ACCESS_REASON_MEMBER_DISABLED",
+		11: "ACCESS_REASON_CREDENTIAL_NOT_AUTHORIZED",
+		12: "ACCESS_REASON_AUTHORIZATION_REVOKED",
+		13: "ACCESS_REASON_AUTHORIZATION_EXPIRED",
+	}
+	AccessReason_value = map[string]int32{
+		"ACCESS_REASON_UNSPECIFIED":               0,
+		"ACCESS_REASON_ALLOW_ALL":                 1,
+		"ACCESS_REASON_CREDENTIAL_ALLOWED":        2,
+		"ACCESS_REASON_DENIED":                    3,
+		"ACCESS_REASON_UNKNOWN_MODULE":            4,
+		"ACCESS_REASON_INVALID_CREDENTIAL_FORMAT": 5,
+		"ACCESS_REASON_CREDENTIAL_NOT_FOUND":      6,
+		"ACCESS_REASON_MEMBER_EXPIRED":            7,
+		"ACCESS_REASON_MEMBER_SUSPENDED":          8,
+		"ACCESS_REASON_MEMBER_ARCHIVED":           9,
+		"ACCESS_REASON_MEMBER_DISABLED":           10,
+		"ACCESS_REASON_CREDENTIAL_NOT_AUTHORIZED": 11,
+		"ACCESS_REASON_AUTHORIZATION_REVOKED":     12,
+		"ACCESS_REASON_AUTHORIZATION_EXPIRED":     13,
+	}
+)
+
+func (x AccessReason) Enum() *AccessReason {
+	p := new(AccessReason)
+	*p = x
+	return p
+}
+
+func (x AccessReason) String() string {
+	return protoimpl.X.EnumStringOf(x.Descriptor(), protoreflect.EnumNumber(x))
+}
+
+func (AccessReason) Descriptor() protoreflect.EnumDescriptor {
+	return file_portunus_v1_portunus_proto_enumTypes[1].Descriptor()
+}
+
+func (AccessReason) Type() protoreflect.EnumType {
+	return &file_portunus_v1_portunus_proto_enumTypes[1]
+}
+
+func (x AccessReason) Number() protoreflect.EnumNumber {
+	return protoreflect.EnumNumber(x)
+}
+
+// Deprecated: Use AccessReason.Descriptor instead.
+func (AccessReason) EnumDescriptor() ([]byte, []int) {
+	return file_portunus_v1_portunus_proto_rawDescGZIP(), []int{1}
+}
+
 // Sent by the access module at a regular interval to report health
 // telemetry and confirm connectivity.
 //
@@ -138,8 +223,122 @@ type HeartbeatRequest struct {
 	Ip string `protobuf:"bytes,6,opt,name=ip,proto3" json:"ip,omitempty"`
 	// Free heap in bytes at the time of the heartbeat.
 	FreeHeapBytes uint32 `protobuf:"varint,7,opt,name=free_heap_bytes,json=freeHeapBytes,proto3" json:"free_heap_bytes,omitempty"`
-	// Monotonically increasing heartbeat counter (resets on reboot).
-	Sequence      uint32 `protobuf:"varint,8,opt,name=sequence,proto3" json:"sequence,omitempty"`
+	// Monotonically increasing heartbeat counter (resets on reboot).  It
+	// counts ticks of the module's heartbeat timer, so a paced module
+	// (static_omitted, heartbeat_interval_s) leaves gaps for the ticks it
+	// did not send.
+	Sequence uint32 `protobuf:"varint,8,opt,name=sequence,proto3" json:"sequence,omitempty"`
+	// CPU cores the firmware schedules across (1 on single-core targets).
+	CpuCores uint32 `protobuf:"varint,9,opt,name=cpu_cores,json=cpuCores,proto3" json:"cpu_cores,omitempty"`
+	// True when the boot-time check confirmed network/TLS tasks and
+	// reader/FSM/actuation tasks are pinned to separate cores.
+	CoreIsolation bool `protobuf:"varint,10,opt,name=core_isolation,json=coreIsolation,proto3" json:"core_isolation,omitempty"`
+	// Tasks found on a different core or priority than configured at boot.
+	TaskPlanFaults uint32 `protobuf:"varint,11,opt,name=task_plan_faults,json=taskPlanFaults,proto3" json:"task_plan_faults,omitempty"`
+	// Taps whose per-tap deadline passed before a decision could act on them
+	// (dropped in the queue, before send, on a late response, or refused by the
+	// FSM), since boot.
+	StaleTaps uint32 `protobuf:"varint,12,opt,name=stale_taps,json=staleTaps,proto3" json:"stale_taps,omitempty"`
+	// Keepalive PING round trip percentiles over the last 32 PINGs, in ms.
+	// 0 until the first PING has been answered.
+	RttP50Ms uint32 `protobuf:"varint,13,opt,name=rtt_p50_ms,json=rttP50Ms,proto3" json:"rtt_p50_ms,omitempty"`
+	RttP90Ms uint32 `protobuf:"varint,14,opt,name=rtt_p90_ms,json=rttP90Ms,proto3" json:"rtt_p90_ms,omitempty"`
+	RttP99Ms uint32 `protobuf:"varint,15,opt,name=rtt_p99_ms,json=rttP99Ms,proto3" json:"rtt_p99_ms,omitempty"`
+	// Current RPC timeout derived from observed call times (SRTT + 4·RTTVAR).
+	RpcTimeoutMs uint32 `protobuf:"varint,16,opt,name=rpc_timeout_ms,json=rpcTimeoutMs,proto3" json:"rpc_timeout_ms,omitempty"`
+	// Connections closed because a keepalive PING went unanswered, since boot.
+	DeadLinks uint32 `protobuf:"varint,17,opt,name=dead_links,json=deadLinks,proto3" json:"dead_links,omitempty"`
+	// Decision cache counters since boot: taps granted from the cache, taps
+	// that had to ask the server, entries pushed out by newer grants, and
+	// entries dropped because the server said the grant no longer holds
+	// (policy_version change or a deny on the audit report).
+	DecisionCacheHits          uint32 `protobuf:"varint,18,opt,name=decision_cache_hits,json=decisionCacheHits,proto3" json:"decision_cache_hits,omitempty"`
+	DecisionCacheMisses        uint32 `protobuf:"varint,19,opt,name=decision_cache_misses,json=decisionCacheMisses,proto3" json:"decision_cache_misses,omitempty"`
+	DecisionCacheEvictions     uint32 `protobuf:"varint,20,opt,name=decision_cache_evictions,json=decisionCacheEvictions,proto3" json:"decision_cache_evictions,omitempty"`
+	DecisionCacheInvalidations uint32 `protobuf:"varint,21,opt,name=decision_cache_invalidations,json=decisionCacheInvalidations,proto3" json:"decision_cache_invalidations,omitempty"`
+	// Revocation filter the module holds (0 = none), the largest filter it
+	// can accept in bytes (0 = filtering disabled), and taps it has denied
+	// from the filter since boot.
+	RevocationFilterVersion  uint32 `protobuf:"varint,22,opt,name=revocation_filter_version,json=revocationFilterVersion,proto3" json:"revocation_filter_version,omitempty"`
+	RevocationFilterCapacity uint32 `protobuf:"varint,23,opt,name=revocation_filter_capacity,json=revocationFilterCapacity,proto3" json:"revocation_filter_capacity,omitempty"`
+	RevocationFilterDenials  uint32 `protobuf:"varint,24,opt,name=revocation_filter_denials,json=revocationFilterDenials,proto3" json:"revocation_filter_denials,omitempty"`
+	// Wire protocol the module speaks (see "Protocol versions" above).
+	// At 2 it signs the binary projection and reads server_time_us.
+	ProtocolVersion uint32 `protobuf:"varint,25,opt,name=protocol_version,json=protocolVersion,proto3" json:"protocol_version,omitempty"`
+	// Clock discipline, from the server times in heartbeat and access
+	// responses: the module's wall clock minus the server's at the last
+	// sample, the bound on the module's estimate of server time now (0 =
+	// not synced), and the measured crystal drift against the server in
+	// parts per billion (0 until known).
+	ClockOffsetUs int32  `protobuf:"zigzag32,26,opt,name=clock_offset_us,json=clockOffsetUs,proto3" json:"clock_offset_us,omitempty"`
+	ClockErrorUs  uint32 `protobuf:"varint,27,opt,name=clock_error_us,json=clockErrorUs,proto3" json:"clock_error_us,omitempty"`
+	ClockDriftPpb int32  `protobuf:"zigzag32,28,opt,name=clock_drift_ppb,json=clockDriftPpb,proto3" json:"clock_drift_ppb,omitempty"`
+	// Set when firmware_version, ip, cpu_cores, core_isolation,
+	// task_plan_faults and revocation_filter_capacity are left out because
+	// they have not changed since a heartbeat the server answered.  The
+	// server uses the values it holds, or asks for them with
+	// HeartbeatResponse.resend_static if it holds none.
+	StaticOmitted bool `protobuf:"varint,29,opt,name=static_omitted,json=staticOmitted,proto3" json:"static_omitted,omitempty"`
+	// Longest the module will now go without a heartbeat.  The interval
+	// stretches while the module is healthy and is cut back to the base
+	// interval on any anomaly; other RPCs also count as a sign of life.
+	HeartbeatIntervalS uint32 `protobuf:"varint,30,opt,name=heartbeat_interval_s,json=heartbeatIntervalS,proto3" json:"heartbeat_interval_s,omitempty"`
+	// Heartbeat ticks not sent to the server since boot, and the protobuf
+	// bytes (request and response) that pacing and static_omitted saved.
+	HeartbeatsSkipped   uint32 `protobuf:"varint,31,opt,name=heartbeats_skipped,json=heartbeatsSkipped,proto3" json:"heartbeats_skipped,omitempty"`
+	HeartbeatBytesSaved uint32 `protobuf:"varint,32,opt,name=heartbeat_bytes_saved,json=heartbeatBytesSaved,proto3" json:"heartbeat_bytes_saved,omitempty"`
+	// Boot timeline, in ms since the CPU started, at which the module had
+	// loaded its configuration, started WiFi, initialised the reader, strike,
+	// LED and FSM, started the FSM, obtained an IP address and first
+	// connected to the server (0 = not reached yet).  Sent until a heartbeat
+	// carrying all of them is answered, then left out.
+	BootConfigMs    uint32 `protobuf:"varint,33,opt,name=boot_config_ms,json=bootConfigMs,proto3" json:"boot_config_ms,omitempty"`
+	BootWifiStartMs uint32 `protobuf:"varint,34,opt,name=boot_wifi_start_ms,json=bootWifiStartMs,proto3" json:"boot_wifi_start_ms,omitempty"`
+	BootIoReadyMs   uint32 `protobuf:"varint,35,opt,name=boot_io_ready_ms,json=bootIoReadyMs,proto3" json:"boot_io_ready_ms,omitempty"`
+	BootFsmMs       uint32 `protobuf:"varint,36,opt,name=boot_fsm_ms,json=bootFsmMs,proto3" json:"boot_fsm_ms,omitempty"`
+	BootIpMs        uint32 `protobuf:"varint,37,opt,name=boot_ip_ms,json=bootIpMs,proto3" json:"boot_ip_ms,omitempty"`
+	BootServerMs    uint32 `protobuf:"varint,38,opt,name=boot_server_ms,json=bootServerMs,proto3" json:"boot_server_ms,omitempty"`
+	// WiFi connects since boot (an IP address obtained), how many of them
+	// went straight to the saved AP and channel without a scan, and how many
+	// times the saved AP did not answer and the module fell back to a scan.
+	WifiConnects       uint32 `protobuf:"varint,39,opt,name=wifi_connects,json=wifiConnects,proto3" json:"wifi_connects,omitempty"`
+	WifiHintedConnects uint32 `protobuf:"varint,40,opt,name=wifi_hinted_connects,json=wifiHintedConnects,proto3" json:"wifi_hinted_connects,omitempty"`
+	WifiScanFallbacks  uint32 `protobuf:"varint,41,opt,name=wifi_scan_fallbacks,json=wifiScanFallbacks,proto3" json:"wifi_scan_fallbacks,omitempty"`
+	// Association to IP address on the last connect, and the slowest since
+	// boot, in ms (0 = not connected yet).
+	WifiAssocToIpMs    uint32 `protobuf:"varint,42,opt,name=wifi_assoc_to_ip_ms,json=wifiAssocToIpMs,proto3" json:"wifi_assoc_to_ip_ms,omitempty"`
+	WifiAssocToIpMaxMs uint32 `protobuf:"varint,43,opt,name=wifi_assoc_to_ip_max_ms,json=wifiAssocToIpMaxMs,proto3" json:"wifi_assoc_to_ip_max_ms,omitempty"`
+	// Link quality (0-100, from the averaged RSSI less beacon losses and
+	// failing RPCs), the averaged RSSI in dBm and its trend in dB per minute
+	// (0 = not connected yet).
+	WifiLinkQuality       uint32 `protobuf:"varint,44,opt,name=wifi_link_quality,json=wifiLinkQuality,proto3" json:"wifi_link_quality,omitempty"`
+	WifiRssiAvgDbm        int32  `protobuf:"varint,45,opt,name=wifi_rssi_avg_dbm,json=wifiRssiAvgDbm,proto3" json:"wifi_rssi_avg_dbm,omitempty"`
+	WifiRssiTrendDbPerMin int32  `protobuf:"varint,46,opt,name=wifi_rssi_trend_db_per_min,json=wifiRssiTrendDbPerMin,proto3" json:"wifi_rssi_trend_db_per_min,omitempty"`
+	// Since boot: beacon timeouts, RPCs that got no answer, background scans
+	// or 802.11v transition queries made because the link degraded, moves
+	// to another AP that followed, and the RSSI the last of them gained.
+	WifiBeaconLosses   uint32 `protobuf:"varint,47,opt,name=wifi_beacon_losses,json=wifiBeaconLosses,proto3" json:"wifi_beacon_losses,omitempty"`
+	WifiRpcFailures    uint32 `protobuf:"varint,48,opt,name=wifi_rpc_failures,json=wifiRpcFailures,proto3" json:"wifi_rpc_failures,omitempty"`
+	WifiRoamScans      uint32 `protobuf:"varint,49,opt,name=wifi_roam_scans,json=wifiRoamScans,proto3" json:"wifi_roam_scans,omitempty"`
+	WifiRoams          uint32 `protobuf:"varint,50,opt,name=wifi_roams,json=wifiRoams,proto3" json:"wifi_roams,omitempty"`
+	WifiLastRoamGainDb int32  `protobuf:"varint,51,opt,name=wifi_last_roam_gain_db,json=wifiLastRoamGainDb,proto3" json:"wifi_last_roam_gain_db,omitempty"`
+	// Since boot, in seconds: radio fully awake (during credential RPCs and
+	// TLS handshakes, and for a while after each card read) and in power
+	// save; and how many times it was woken.
+	WifiAwakeS     uint32 `protobuf:"varint,52,opt,name=wifi_awake_s,json=wifiAwakeS,proto3" json:"wifi_awake_s,omitempty"`
+	WifiPowerSaveS uint32 `protobuf:"varint,53,opt,name=wifi_power_save_s,json=wifiPowerSaveS,proto3" json:"wifi_power_save_s,omitempty"`
+	WifiWakes      uint32 `protobuf:"varint,54,opt,name=wifi_wakes,json=wifiWakes,proto3" json:"wifi_wakes,omitempty"`
+	// Access RPCs since boot, and their average round trip in ms, split by
+	// whether the radio was already awake when the tap came or was woken
+	// from power save for it (0 = none yet).
+	AccessRpcsAwake     uint32 `protobuf:"varint,55,opt,name=access_rpcs_awake,json=accessRpcsAwake,proto3" json:"access_rpcs_awake,omitempty"`
+	AccessRpcAwakeAvgMs uint32 `protobuf:"varint,56,opt,name=access_rpc_awake_avg_ms,json=accessRpcAwakeAvgMs,proto3" json:"access_rpc_awake_avg_ms,omitempty"`
+	AccessRpcsWoken     uint32 `protobuf:"varint,57,opt,name=access_rpcs_woken,json=accessRpcsWoken,proto3" json:"access_rpcs_woken,omitempty"`
+	AccessRpcWokenAvgMs uint32 `protobuf:"varint,58,opt,name=access_rpc_woken_avg_ms,json=accessRpcWokenAvgMs,proto3" json:"access_rpc_woken_avg_ms,omitempty"`
+	// Runtime health: heap low-water marks, server connection and TLS
+	// counters, and per-task CPU share and stack headroom.  Omitted by
+	// firmware built without it (CONFIG_PORTUNUS_HEALTH_TELEMETRY).
+	Health        *HealthTelemetry `protobuf:"bytes,59,opt,name=health,proto3" json:"health,omitempty"`
 	unknownFields protoimpl.UnknownFields
 	sizeCache     protoimpl.SizeCache
 }
@@ -216,18 +415,375 @@ func (x *HeartbeatRequest) GetIp() string {
 	return ""
 }
 
-func (x *HeartbeatRequest) GetFreeHeapBytes() uint32 {
+func (x *HeartbeatRequest) GetFreeHeapBytes() uint32 {
+	if x != nil {
+		return x.FreeHeapBytes
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetSequence() uint32 {
+	if x != nil {
+		return x.Sequence
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetCpuCores() uint32 {
+	if x != nil {
+		return x.CpuCores
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetCoreIsolation() bool {
+	if x != nil {
+		return x.CoreIsolation
+	}
+	return false
+}
+
+func (x *HeartbeatRequest) GetTaskPlanFaults() uint32 {
+	if x != nil {
+		return x.TaskPlanFaults
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetStaleTaps() uint32 {
+	if x != nil {
+		return x.StaleTaps
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetRttP50Ms() uint32 {
+	if x != nil {
+		return x.RttP50Ms
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetRttP90Ms() uint32 {
+	if x != nil {
+		return x.RttP90Ms
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetRttP99Ms() uint32 {
+	if x != nil {
+		return x.RttP99Ms
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetRpcTimeoutMs() uint32 {
+	if x != nil {
+		return x.RpcTimeoutMs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetDeadLinks() uint32 {
+	if x != nil {
+		return x.DeadLinks
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetDecisionCacheHits() uint32 {
+	if x != nil {
+		return x.DecisionCacheHits
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetDecisionCacheMisses() uint32 {
+	if x != nil {
+		return x.DecisionCacheMisses
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetDecisionCacheEvictions() uint32 {
+	if x != nil {
+		return x.DecisionCacheEvictions
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetDecisionCacheInvalidations() uint32 {
+	if x != nil {
+		return x.DecisionCacheInvalidations
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetRevocationFilterVersion() uint32 {
+	if x != nil {
+		return x.RevocationFilterVersion
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetRevocationFilterCapacity() uint32 {
+	if x != nil {
+		return x.RevocationFilterCapacity
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetRevocationFilterDenials() uint32 {
+	if x != nil {
+		return x.RevocationFilterDenials
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetProtocolVersion() uint32 {
+	if x != nil {
+		return x.ProtocolVersion
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetClockOffsetUs() int32 {
+	if x != nil {
+		return x.ClockOffsetUs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetClockErrorUs() uint32 {
+	if x != nil {
+		return x.ClockErrorUs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetClockDriftPpb() int32 {
+	if x != nil {
+		return x.ClockDriftPpb
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetStaticOmitted() bool {
+	if x != nil {
+		return x.StaticOmitted
+	}
+	return false
+}
+
+func (x *HeartbeatRequest) GetHeartbeatIntervalS() uint32 {
+	if x != nil {
+		return x.HeartbeatIntervalS
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetHeartbeatsSkipped() uint32 {
+	if x != nil {
+		return x.HeartbeatsSkipped
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetHeartbeatBytesSaved() uint32 {
+	if x != nil {
+		return x.HeartbeatBytesSaved
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetBootConfigMs() uint32 {
+	if x != nil {
+		return x.BootConfigMs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetBootWifiStartMs() uint32 {
+	if x != nil {
+		return x.BootWifiStartMs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetBootIoReadyMs() uint32 {
+	if x != nil {
+		return x.BootIoReadyMs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetBootFsmMs() uint32 {
+	if x != nil {
+		return x.BootFsmMs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetBootIpMs() uint32 {
+	if x != nil {
+		return x.BootIpMs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetBootServerMs() uint32 {
+	if x != nil {
+		return x.BootServerMs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiConnects() uint32 {
+	if x != nil {
+		return x.WifiConnects
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiHintedConnects() uint32 {
+	if x != nil {
+		return x.WifiHintedConnects
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiScanFallbacks() uint32 {
+	if x != nil {
+		return x.WifiScanFallbacks
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiAssocToIpMs() uint32 {
+	if x != nil {
+		return x.WifiAssocToIpMs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiAssocToIpMaxMs() uint32 {
+	if x != nil {
+		return x.WifiAssocToIpMaxMs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiLinkQuality() uint32 {
+	if x != nil {
+		return x.WifiLinkQuality
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiRssiAvgDbm() int32 {
+	if x != nil {
+		return x.WifiRssiAvgDbm
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiRssiTrendDbPerMin() int32 {
+	if x != nil {
+		return x.WifiRssiTrendDbPerMin
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiBeaconLosses() uint32 {
+	if x != nil {
+		return x.WifiBeaconLosses
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiRpcFailures() uint32 {
+	if x != nil {
+		return x.WifiRpcFailures
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiRoamScans() uint32 {
+	if x != nil {
+		return x.WifiRoamScans
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiRoams() uint32 {
+	if x != nil {
+		return x.WifiRoams
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiLastRoamGainDb() int32 {
+	if x != nil {
+		return x.WifiLastRoamGainDb
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiAwakeS() uint32 {
+	if x != nil {
+		return x.WifiAwakeS
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiPowerSaveS() uint32 {
+	if x != nil {
+		return x.WifiPowerSaveS
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetWifiWakes() uint32 {
+	if x != nil {
+		return x.WifiWakes
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetAccessRpcsAwake() uint32 {
+	if x != nil {
+		return x.AccessRpcsAwake
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetAccessRpcAwakeAvgMs() uint32 {
+	if x != nil {
+		return x.AccessRpcAwakeAvgMs
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetAccessRpcsWoken() uint32 {
+	if x != nil {
+		return x.AccessRpcsWoken
+	}
+	return 0
+}
+
+func (x *HeartbeatRequest) GetAccessRpcWokenAvgMs() uint32 {
 	if x != nil {
-		return x.FreeHeapBytes
+		return x.AccessRpcWokenAvgMs
 	}
 	return 0
 }
 
-func (x *HeartbeatRequest) GetSequence() uint32 {
+func (x *HeartbeatRequest) GetHealth() *HealthTelemetry {
 	if x != nil {
-		return x.Sequence
+		return x.Health
 	}
-	return 0
+	return nil
 }
 
 // Returned by the server to acknowledge the heartbeat.
@@ -242,7 +798,42 @@ type HeartbeatResponse struct {
 	// Echoed module_id.
 	ModuleId string `protobuf:"bytes,3,opt,name=module_id,json=moduleId,proto3" json:"module_id,omitempty"`
 	// Server wall-clock time (RFC 3339 with nanoseconds).
-	ServerTime    string `protobuf:"bytes,4,opt,name=server_time,json=serverTime,proto3" json:"server_time,omitempty"`
+	ServerTime string `protobuf:"bytes,4,opt,name=server_time,json=serverTime,proto3" json:"server_time,omitempty"`
+	// Current access policy version.  Changes whenever a grant may have been
+	// withdrawn (revocation, member disabled/archived/expired); the module
+	// drops its whole decision cache when it sees a new value.
+	PolicyVersion uint32 `protobuf:"varint,5,opt,name=policy_version,json=policyVersion,proto3" json:"policy_version,omitempty"`
+	// Revocation filter: an 8-bit xor filter over the tags of credentials
+	// every door would deny (member disabled, expired or archived).  A tag is
+	// the first 8 bytes, little-endian, of HMAC-SHA256(key, raw UID).  The
+	// module denies a matching tap on the spot and reports it afterwards.
+	//
+	// The version is always set; 0 means "no filter" and the module drops
+	// its copy.  The other fields are only sent when the module's
+	// revocation_filter_version differs and the fingerprints fit its
+	// revocation_filter_capacity.  exceptions lists tags of active members
+	// that the filter matches (8 bytes each, little-endian, at most 16); the
+	// module must pass those through to the server.
+	RevocationFilterVersion      uint32 `protobuf:"varint,6,opt,name=revocation_filter_version,json=revocationFilterVersion,proto3" json:"revocation_filter_version,omitempty"`
+	RevocationFilterSeed         uint64 `protobuf:"varint,7,opt,name=revocation_filter_seed,json=revocationFilterSeed,proto3" json:"revocation_filter_seed,omitempty"`
+	RevocationFilterKey          []byte `protobuf:"bytes,8,opt,name=revocation_filter_key,json=revocationFilterKey,proto3" json:"revocation_filter_key,omitempty"`
+	RevocationFilterExceptions   []byte `protobuf:"bytes,9,opt,name=revocation_filter_exceptions,json=revocationFilterExceptions,proto3" json:"revocation_filter_exceptions,omitempty"`
+	RevocationFilterFingerprints []byte `protobuf:"bytes,10,opt,name=revocation_filter_fingerprints,json=revocationFilterFingerprints,proto3" json:"revocation_filter_fingerprints,omitempty"`
+	// Server wall-clock time in microseconds since the Unix epoch.  Sent
+	// alongside server_time; to a protocol_version 2 module it is sent
+	// instead of it.
+	ServerTimeUs int64 `protobuf:"varint,11,opt,name=server_time_us,json=serverTimeUs,proto3" json:"server_time_us,omitempty"`
+	// The server holds no static fields for this module (it restarted, or
+	// never saw a full heartbeat from it); the next heartbeat carries them.
+	ResendStatic bool `protobuf:"varint,12,opt,name=resend_static,json=resendStatic,proto3" json:"resend_static,omitempty"`
+	// Hold the next heartbeat this many ms past its normal schedule (0 =
+	// none).  Set while heartbeats arrive faster than the server's pacing
+	// rate, each module getting a different delay, so a fleet that came up
+	// in step is spread out over the following rounds.
+	HeartbeatDelayMs uint32 `protobuf:"varint,13,opt,name=heartbeat_delay_ms,json=heartbeatDelayMs,proto3" json:"heartbeat_delay_ms,omitempty"`
+	// Ask for a health dump: the module sends its next heartbeat at once,
+	// with HealthTelemetry.tasks listing every task (detailed set).
+	HealthDump    bool `protobuf:"varint,14,opt,name=health_dump,json=healthDump,proto3" json:"health_dump,omitempty"`
 	unknownFields protoimpl.UnknownFields
 	sizeCache     protoimpl.SizeCache
 }
@@ -305,6 +896,76 @@ func (x *HeartbeatResponse) GetServerTime() string {
 	return ""
 }
 
+func (x *HeartbeatResponse) GetPolicyVersion() uint32 {
+	if x != nil {
+		return x.PolicyVersion
+	}
+	return 0
+}
+
+func (x *HeartbeatResponse) GetRevocationFilterVersion() uint32 {
+	if x != nil {
+		return x.RevocationFilterVersion
+	}
+	return 0
+}
+
+func (x *HeartbeatResponse) GetRevocationFilterSeed() uint64 {
+	if x != nil {
+		return x.RevocationFilterSeed
+	}
+	return 0
+}
+
+func (x *HeartbeatResponse) GetRevocationFilterKey() []byte {
+	if x != nil {
+		return x.RevocationFilterKey
+	}
+	return nil
+}
+
+func (x *HeartbeatResponse) GetRevocationFilterExceptions() []byte {
+	if x != nil {
+		return x.RevocationFilterExceptions
+	}
+	return nil
+}
+
+func (x *HeartbeatResponse) GetRevocationFilterFingerprints() []byte {
+	if x != nil {
+		return x.RevocationFilterFingerprints
+	}
+	return nil
+}
+
+func (x *HeartbeatResponse) GetServerTimeUs() int64 {
+	if x != nil {
+		return x.ServerTimeUs
+	}
+	return 0
+}
+
+func (x *HeartbeatResponse) GetResendStatic() bool {
+	if x != nil {
+		return x.ResendStatic
+	}
+	return false
+}
+
+func (x *HeartbeatResponse) GetHeartbeatDelayMs() uint32 {
+	if x != nil {
+		return x.HeartbeatDelayMs
+	}
+	return 0
+}
+
+func (x *HeartbeatResponse) GetHealthDump() bool {
+	if x != nil {
+		return x.HealthDump
+	}
+	return false
+}
+
 // Sent by the access module when a credential is presented to the reader.
 //
 // Server Go equivalent: types.AccessRequest
@@ -324,7 +985,26 @@ type AccessRequest struct {
 	// and reject replayed access requests.  Always populated when HMAC is
 	// enabled; the server rejects requests with a missing or previously-seen
 	// nonce when replay protection is active.
-	Nonce         []byte `protobuf:"bytes,5,opt,name=nonce,proto3" json:"nonce,omitempty"`
+	Nonce []byte `protobuf:"bytes,5,opt,name=nonce,proto3" json:"nonce,omitempty"`
+	// Set on the report for a tap the module already granted from its
+	// decision cache.  The server decides afresh and audits the event as
+	// served from cache; a deny tells the module to drop the entry.
+	Cached bool `protobuf:"varint,6,opt,name=cached,proto3" json:"cached,omitempty"`
+	// Set on the report for a tap the module already denied from its
+	// revocation filter.  The server decides afresh and audits the event as
+	// denied by the filter; a grant means a false positive, and the module
+	// adds the credential to the filter's exceptions.
+	Filtered bool `protobuf:"varint,7,opt,name=filtered,proto3" json:"filtered,omitempty"`
+	// Wire protocol the module speaks.  At 2 the module sends
+	// requested_at_us instead of requested_at, signs the binary projection
+	// (see "Protocol versions" above), and expects the server to sign its
+	// response the same way and to send reason_code and server_time_us in
+	// place of the text fields.
+	ProtocolVersion uint32 `protobuf:"varint,8,opt,name=protocol_version,json=protocolVersion,proto3" json:"protocol_version,omitempty"`
+	// Device-local timestamp of the read in microseconds since the Unix
+	// epoch; 0 when the module's clock is not synced.  Used instead of
+	// requested_at when set.
+	RequestedAtUs int64 `protobuf:"varint,9,opt,name=requested_at_us,json=requestedAtUs,proto3" json:"requested_at_us,omitempty"`
 	unknownFields protoimpl.UnknownFields
 	sizeCache     protoimpl.SizeCache
 }
@@ -394,6 +1074,34 @@ func (x *AccessRequest) GetNonce() []byte {
 	return nil
 }
 
+func (x *AccessRequest) GetCached() bool {
+	if x != nil {
+		return x.Cached
+	}
+	return false
+}
+
+func (x *AccessRequest) GetFiltered() bool {
+	if x != nil {
+		return x.Filtered
+	}
+	return false
+}
+
+func (x *AccessRequest) GetProtocolVersion() uint32 {
+	if x != nil {
+		return x.ProtocolVersion
+	}
+	return 0
+}
+
+func (x *AccessRequest) GetRequestedAtUs() int64 {
+	if x != nil {
+		return x.RequestedAtUs
+	}
+	return 0
+}
+
 // Returned by the server with the access decision.
 //
 // Server Go equivalent: types.AccessResponse
@@ -424,7 +1132,19 @@ type AccessResponse struct {
 	// Echoed module_id.
 	ModuleId string `protobuf:"bytes,5,opt,name=module_id,json=moduleId,proto3" json:"module_id,omitempty"`
 	// Server wall-clock time (RFC 3339 with nanoseconds).
-	ServerTime    string `protobuf:"bytes,6,opt,name=server_time,json=serverTime,proto3" json:"server_time,omitempty"`
+	ServerTime string `protobuf:"bytes,6,opt,name=server_time,json=serverTime,proto3" json:"server_time,omitempty"`
+	// Seconds the module may reuse this grant for the same credential without
+	// asking again.  0 = do not cache.  Never set on a deny.
+	CacheTtlS uint32 `protobuf:"varint,7,opt,name=cache_ttl_s,json=cacheTtlS,proto3" json:"cache_ttl_s,omitempty"`
+	// Access policy version the decision was made under (see
+	// HeartbeatResponse.policy_version).
+	PolicyVersion uint32 `protobuf:"varint,8,opt,name=policy_version,json=policyVersion,proto3" json:"policy_version,omitempty"`
+	// The reason above as a code.  To a protocol_version 2 module the reason
+	// string is only sent when the code is ACCESS_REASON_UNSPECIFIED.
+	ReasonCode AccessReason `protobuf:"varint,9,opt,name=reason_code,json=reasonCode,proto3,enum=portunus.v1.AccessReason" json:"reason_code,omitempty"`
+	// Server wall-clock time in microseconds since the Unix epoch (see
+	// HeartbeatResponse.server_time_us).
+	ServerTimeUs  int64 `protobuf:"varint,10,opt,name=server_time_us,json=serverTimeUs,proto3" json:"server_time_us,omitempty"`
 	unknownFields protoimpl.UnknownFields
 	sizeCache     protoimpl.SizeCache
 }
@@ -501,6 +1221,34 @@ func (x *AccessResponse) GetServerTime() string {
 	return ""
 }
 
+func (x *AccessResponse) GetCacheTtlS() uint32 {
+	if x != nil {
+		return x.CacheTtlS
+	}
+	return 0
+}
+
+func (x *AccessResponse) GetPolicyVersion() uint32 {
+	if x != nil {
+		return x.PolicyVersion
+	}
+	return 0
+}
+
+func (x *AccessResponse) GetReasonCode() AccessReason {
+	if x != nil {
+		return x.ReasonCode
+	}
+	return AccessReason_ACCESS_REASON_UNSPECIFIED
+}
+
+func (x *AccessResponse) GetServerTimeUs() int64 {
+	if x != nil {
+		return x.ServerTimeUs
+	}
+	return 0
+}
+
 // Sent by a provisioning console (capture path only).
 // The device sends raw RFID UID bytes for the new member's card; the server
 // applies HMAC-SHA256 and parks the credential as pending_authorization.
@@ -513,8 +1261,11 @@ type ProvisionCredentialRequest struct {
 	// Raw RFID UID bytes read from the new-member card (1–10 bytes).
 	// The server computes HMAC-SHA256(secret, credential_uid) before storing.
 	CredentialUid []byte `protobuf:"bytes,5,opt,name=credential_uid,json=credentialUid,proto3" json:"credential_uid,omitempty"`
-	unknownFields protoimpl.UnknownFields
-	sizeCache     protoimpl.SizeCache
+	// Wire protocol the console speaks (see AccessRequest.protocol_version);
+	// at 2 it signs the binary projection.
+	ProtocolVersion uint32 `protobuf:"varint,8,opt,name=protocol_version,json=protocolVersion,proto3" json:"protocol_version,omitempty"`
+	unknownFields   protoimpl.UnknownFields
+	sizeCache       protoimpl.SizeCache
 }
 
 func (x *ProvisionCredentialRequest) Reset() {
@@ -561,6 +1312,13 @@ func (x *ProvisionCredentialRequest) GetCredentialUid() []byte {
 	return nil
 }
 
+func (x *ProvisionCredentialRequest) GetProtocolVersion() uint32 {
+	if x != nil {
+		return x.ProtocolVersion
+	}
+	return 0
+}
+
 // Returned by the server after processing a provisioning request.
 //
 // Server Go equivalent: types.ProvisionCredentialResponse
@@ -626,11 +1384,255 @@ func (x *ProvisionCredentialResponse) GetDetail() string {
 	return ""
 }
 
+// Runtime health of the module, sampled at each heartbeat tick and sent in
+// HeartbeatRequest.health.  Counters are since boot.  CPU shares cover the
+// time since the previous tick, in permille of all cores together; they
+// are 0 on the first sample and on firmware without run-time stats.
+//
+// Server Go equivalent: types.HealthTelemetry
+type HealthTelemetry struct {
+	state protoimpl.MessageState `protogen:"open.v1"`
+	// Lowest free heap since boot, and the largest block that can be
+	// allocated now, in bytes.  A largest block far below free_heap_bytes
+	// means the heap is fragmented.
+	MinFreeHeapBytes      uint32 `protobuf:"varint,1,opt,name=min_free_heap_bytes,json=minFreeHeapBytes,proto3" json:"min_free_heap_bytes,omitempty"`
+	LargestFreeBlockBytes uint32 `protobuf:"varint,2,opt,name=largest_free_block_bytes,json=largestFreeBlockBytes,proto3" json:"largest_free_block_bytes,omitempty"`
+	// Server connections established and connect attempts that failed;
+	// TLS handshakes that failed, those refused by the SPKI pin among them,
+	// and how long the last successful handshake took in ms.
+	ServerConnects        uint32 `protobuf:"varint,3,opt,name=server_connects,json=serverConnects,proto3" json:"server_connects,omitempty"`
+	ServerConnectFailures uint32 `protobuf:"varint,4,opt,name=server_connect_failures,json=serverConnectFailures,proto3" json:"server_connect_failures,omitempty"`
+	TlsFailures           uint32 `protobuf:"varint,5,opt,name=tls_failures,json=tlsFailures,proto3" json:"tls_failures,omitempty"`
+	TlsPinMismatches      uint32 `protobuf:"varint,6,opt,name=tls_pin_mismatches,json=tlsPinMismatches,proto3" json:"tls_pin_mismatches,omitempty"`
+	TlsHandshakeMs        uint32 `protobuf:"varint,7,opt,name=tls_handshake_ms,json=tlsHandshakeMs,proto3" json:"tls_handshake_ms,omitempty"`
+	// Tasks on the module (0 if there were too many to sample), and the
+	// share of CPU their idle tasks had.
+	TaskCount    uint32 `protobuf:"varint,8,opt,name=task_count,json=taskCount,proto3" json:"task_count,omitempty"`
+	IdlePermille uint32 `protobuf:"varint,9,opt,name=idle_permille,json=idlePermille,proto3" json:"idle_permille,omitempty"`
+	// What taking this sample cost the module, and the most any sample has
+	// cost since boot, in µs.
+	SampleUs    uint32 `protobuf:"varint,10,opt,name=sample_us,json=sampleUs,proto3" json:"sample_us,omitempty"`
+	SampleMaxUs uint32 `protobuf:"varint,11,opt,name=sample_max_us,json=sampleMaxUs,proto3" json:"sample_max_us,omitempty"`
+	// Set on a dump (HeartbeatResponse.health_dump): tasks lists every task.
+	// Otherwise it names a few: those with the least stack headroom, then
+	// the busiest.
+	Detailed      bool          `protobuf:"varint,12,opt,name=detailed,proto3" json:"detailed,omitempty"`
+	Tasks         []*TaskHealth `protobuf:"bytes,13,rep,name=tasks,proto3" json:"tasks,omitempty"`
+	unknownFields protoimpl.UnknownFields
+	sizeCache     protoimpl.SizeCache
+}
+
+func (x *HealthTelemetry) Reset() {
+	*x = HealthTelemetry{}
+	mi := &file_portunus_v1_portunus_proto_msgTypes[6]
+	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+	ms.StoreMessageInfo(mi)
+}
+
+func (x *HealthTelemetry) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*HealthTelemetry) ProtoMessage() {}
+
+func (x *HealthTelemetry) ProtoReflect() protoreflect.Message {
+	mi := &file_portunus_v1_portunus_proto_msgTypes[6]
+	if x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use HealthTelemetry.ProtoReflect.Descriptor instead.
+func (*HealthTelemetry) Descriptor() ([]byte, []int) {
+	return file_portunus_v1_portunus_proto_rawDescGZIP(), []int{6}
+}
+
+func (x *HealthTelemetry) GetMinFreeHeapBytes() uint32 {
+	if x != nil {
+		return x.MinFreeHeapBytes
+	}
+	return 0
+}
+
+func (x *HealthTelemetry) GetLargestFreeBlockBytes() uint32 {
+	if x != nil {
+		return x.LargestFreeBlockBytes
+	}
+	return 0
+}
+
+func (x *HealthTelemetry) GetServerConnects() uint32 {
+	if x != nil {
+		return x.ServerConnects
+	}
+	return 0
+}
+
+func (x *HealthTelemetry) GetServerConnectFailures() uint32 {
+	if x != nil {
+		return x.ServerConnectFailures
+	}
+	return 0
+}
+
+func (x *HealthTelemetry) GetTlsFailures() uint32 {
+	if x != nil {
+		return x.TlsFailures
+	}
+	return 0
+}
+
+func (x *HealthTelemetry) GetTlsPinMismatches() uint32 {
+	if x != nil {
+		return x.TlsPinMismatches
+	}
+	return 0
+}
+
+func (x *HealthTelemetry) GetTlsHandshakeMs() uint32 {
+	if x != nil {
+		return x.TlsHandshakeMs
+	}
+	return 0
+}
+
+func (x *HealthTelemetry) GetTaskCount() uint32 {
+	if x != nil {
+		return x.TaskCount
+	}
+	return 0
+}
+
+func (x *HealthTelemetry) GetIdlePermille() uint32 {
+	if x != nil {
+		return x.IdlePermille
+	}
+	return 0
+}
+
+func (x *HealthTelemetry) GetSampleUs() uint32 {
+	if x != nil {
+		return x.SampleUs
+	}
+	return 0
+}
+
+func (x *HealthTelemetry) GetSampleMaxUs() uint32 {
+	if x != nil {
+		return x.SampleMaxUs
+	}
+	return 0
+}
+
+func (x *HealthTelemetry) GetDetailed() bool {
+	if x != nil {
+		return x.Detailed
+	}
+	return false
+}
+
+func (x *HealthTelemetry) GetTasks() []*TaskHealth {
+	if x != nil {
+		return x.Tasks
+	}
+	return nil
+}
+
+// One task in HealthTelemetry.tasks.
+//
+// Server Go equivalent: types.TaskHealth
+type TaskHealth struct {
+	state protoimpl.MessageState `protogen:"open.v1"`
+	// FreeRTOS task name (at most 15 characters).
+	Name string `protobuf:"bytes,1,opt,name=name,proto3" json:"name,omitempty"`
+	// Share of all cores' time since the previous sample, in permille.
+	CpuPermille uint32 `protobuf:"varint,2,opt,name=cpu_permille,json=cpuPermille,proto3" json:"cpu_permille,omitempty"`
+	// Stack the task has never touched since it started (high-water mark),
+	// in bytes.  Near 0 means it is close to overflowing.
+	StackFreeBytes uint32 `protobuf:"varint,3,opt,name=stack_free_bytes,json=stackFreeBytes,proto3" json:"stack_free_bytes,omitempty"`
+	// Dumps only: core the task is pinned to (-1 = either) and its current
+	// priority.
+	Core          int32  `protobuf:"zigzag32,4,opt,name=core,proto3" json:"core,omitempty"`
+	Priority      uint32 `protobuf:"varint,5,opt,name=priority,proto3" json:"priority,omitempty"`
+	unknownFields protoimpl.UnknownFields
+	sizeCache     protoimpl.SizeCache
+}
+
+func (x *TaskHealth) Reset() {
+	*x = TaskHealth{}
+	mi := &file_portunus_v1_portunus_proto_msgTypes[7]
+	ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+	ms.StoreMessageInfo(mi)
+}
+
+func (x *TaskHealth) String() string {
+	return protoimpl.X.MessageStringOf(x)
+}
+
+func (*TaskHealth) ProtoMessage() {}
+
+func (x *TaskHealth) ProtoReflect() protoreflect.Message {
+	mi := &file_portunus_v1_portunus_proto_msgTypes[7]
+	if x != nil {
+		ms := protoimpl.X.MessageStateOf(protoimpl.Pointer(x))
+		if ms.LoadMessageInfo() == nil {
+			ms.StoreMessageInfo(mi)
+		}
+		return ms
+	}
+	return mi.MessageOf(x)
+}
+
+// Deprecated: Use TaskHealth.ProtoReflect.Descriptor instead.
+func (*TaskHealth) Descriptor() ([]byte, []int) {
+	return file_portunus_v1_portunus_proto_rawDescGZIP(), []int{7}
+}
+
+func (x *TaskHealth) GetName() string {
+	if x != nil {
+		return x.Name
+	}
+	return ""
+}
+
+func (x *TaskHealth) GetCpuPermille() uint32 {
+	if x != nil {
+		return x.CpuPermille
+	}
+	return 0
+}
+
+func (x *TaskHealth) GetStackFreeBytes() uint32 {
+	if x != nil {
+		return x.StackFreeBytes
+	}
+	return 0
+}
+
+func (x *TaskHealth) GetCore() int32 {
+	if x != nil {
+		return x.Core
+	}
+	return 0
+}
+
+func (x *TaskHealth) GetPriority() uint32 {
+	if x != nil {
+		return x.Priority
+	}
+	return 0
+}
+
 var File_portunus_v1_portunus_proto protoreflect.FileDescriptor
 
 const file_portunus_v1_portunus_proto_rawDesc = "" +
 	"\n" +
-	"\x1aportunus/v1/portunus.proto\x12\vportunus.v1\"\xac\x02\n" +
+	"\x1aportunus/v1/portunus.proto\x12\vportunus.v1\"\xe2\x13\n" +
 	"\x10HeartbeatRequest\x12\x1b\n" +
 	"\tmodule_id\x18\x01 \x01(\tR\bmoduleId\x12)\n" +
 	"\x10firmware_version\x18\x02 \x01(\tR\x0ffirmwareVersion\x12\x19\n" +
@@ -640,23 +1642,100 @@ const file_portunus_v1_portunus_proto_rawDesc = "" +
 	"\brssi_dbm\x18\x05 \x01(\x05H\x01R\arssiDbm\x88\x01\x01\x12\x0e\n" +
 	"\x02ip\x18\x06 \x01(\tR\x02ip\x12&\n" +
 	"\x0ffree_heap_bytes\x18\a \x01(\rR\rfreeHeapBytes\x12\x1a\n" +
-	"\bsequence\x18\b \x01(\rR\bsequenceB\x0e\n" +
+	"\bsequence\x18\b \x01(\rR\bsequence\x12\x1b\n" +
+	"\tcpu_cores\x18\t \x01(\rR\bcpuCores\x12%\n" +
+	"\x0ecore_isolation\x18\n" +
+	" \x01(\bR\rcoreIsolation\x12(\n" +
+	"\x10task_plan_faults\x18\v \x01(\rR\x0etaskPlanFaults\x12\x1d\n" +
+	"\n" +
+	"stale_taps\x18\f \x01(\rR\tstaleTaps\x12\x1c\n" +
+	"\n" +
+	"rtt_p50_ms\x18\r \x01(\rR\brttP50Ms\x12\x1c\n" +
+	"\n" +
+	"rtt_p90_ms\x18\x0e \x01(\rR\brttP90Ms\x12\x1c\n" +
+	"\n" +
+	"rtt_p99_ms\x18\x0f \x01(\rR\brttP99Ms\x12$\n" +
+	"\x0erpc_timeout_ms\x18\x10 \x01(\rR\frpcTimeoutMs\x12\x1d\n" +
+	"\n" +
+	"dead_links\x18\x11 \x01(\rR\tdeadLinks\x12.\n" +
+	"\x13decision_cache_hits\x18\x12 \x01(\rR\x11decisionCacheHits\x122\n" +
+	"\x15decision_cache_misses\x18\x13 \x01(\rR\x13decisionCacheMisses\x128\n" +
+	"\x18decision_cache_evictions\x18\x14 \x01(\rR\x16decisionCacheEvictions\x12@\n" +
+	"\x1cdecision_cache_invalidations\x18\x15 \x01(\rR\x1adecisionCacheInvalidations\x12:\n" +
+	"\x19revocation_filter_version\x18\x16 \x01(\rR\x17revocationFilterVersion\x12<\n" +
+	"\x1arevocation_filter_capacity\x18\x17 \x01(\rR\x18revocationFilterCapacity\x12:\n" +
+	"\x19revocation_filter_denials\x18\x18 \x01(\rR\x17revocationFilterDenials\x12)\n" +
+	"\x10protocol_version\x18\x19 \x01(\rR\x0fprotocolVersion\x12&\n" +
+	"\x0fclock_offset_us\x18\x1a \x01(\x11R\rclockOffsetUs\x12$\n" +
+	"\x0eclock_error_us\x18\x1b \x01(\rR\fclockErrorUs\x12&\n" +
+	"\x0fclock_drift_ppb\x18\x1c \x01(\x11R\rclockDriftPpb\x12%\n" +
+	"\x0estatic_omitted\x18\x1d \x01(\bR\rstaticOmitted\x120\n" +
+	"\x14heartbeat_interval_s\x18\x1e \x01(\rR\x12heartbeatIntervalS\x12-\n" +
+	"\x12heartbeats_skipped\x18\x1f \x01(\rR\x11heartbeatsSkipped\x122\n" +
+	"\x15heartbeat_bytes_saved\x18  \x01(\rR\x13heartbeatBytesSaved\x12$\n" +
+	"\x0eboot_config_ms\x18! \x01(\rR\fbootConfigMs\x12+\n" +
+	"\x12boot_wifi_start_ms\x18\" \x01(\rR\x0fbootWifiStartMs\x12'\n" +
+	"\x10boot_io_ready_ms\x18# \x01(\rR\rbootIoReadyMs\x12\x1e\n" +
+	"\vboot_fsm_ms\x18$ \x01(\rR\tbootFsmMs\x12\x1c\n" +
+	"\n" +
+	"boot_ip_ms\x18% \x01(\rR\bbootIpMs\x12$\n" +
+	"\x0eboot_server_ms\x18& \x01(\rR\fbootServerMs\x12#\n" +
+	"\rwifi_connects\x18' \x01(\rR\fwifiConnects\x120\n" +
+	"\x14wifi_hinted_connects\x18( \x01(\rR\x12wifiHintedConnects\x12.\n" +
+	"\x13wifi_scan_fallbacks\x18) \x01(\rR\x11wifiScanFallbacks\x12,\n" +
+	"\x13wifi_assoc_to_ip_ms\x18* \x01(\rR\x0fwifiAssocToIpMs\x123\n" +
+	"\x17wifi_assoc_to_ip_max_ms\x18+ \x01(\rR\x12wifiAssocToIpMaxMs\x12*\n" +
+	"\x11wifi_link_quality\x18, \x01(\rR\x0fwifiLinkQuality\x12)\n" +
+	"\x11wifi_rssi_avg_dbm\x18- \x01(\x05R\x0ewifiRssiAvgDbm\x129\n" +
+	"\x1awifi_rssi_trend_db_per_min\x18. \x01(\x05R\x15wifiRssiTrendDbPerMin\x12,\n" +
+	"\x12wifi_beacon_losses\x18/ \x01(\rR\x10wifiBeaconLosses\x12*\n" +
+	"\x11wifi_rpc_failures\x180 \x01(\rR\x0fwifiRpcFailures\x12&\n" +
+	"\x0fwifi_roam_scans\x181 \x01(\rR\rwifiRoamScans\x12\x1d\n" +
+	"\n" +
+	"wifi_roams\x182 \x01(\rR\twifiRoams\x122\n" +
+	"\x16wifi_last_roam_gain_db\x183 \x01(\x05R\x12wifiLastRoamGainDb\x12 \n" +
+	"\fwifi_awake_s\x184 \x01(\rR\n" +
+	"wifiAwakeS\x12)\n" +
+	"\x11wifi_power_save_s\x185 \x01(\rR\x0ewifiPowerSaveS\x12\x1d\n" +
+	"\n" +
+	"wifi_wakes\x186 \x01(\rR\twifiWakes\x12*\n" +
+	"\x11access_rpcs_awake\x187 \x01(\rR\x0faccessRpcsAwake\x124\n" +
+	"\x17access_rpc_awake_avg_ms\x188 \x01(\rR\x13accessRpcAwakeAvgMs\x12*\n" +
+	"\x11access_rpcs_woken\x189 \x01(\rR\x0faccessRpcsWoken\x124\n" +
+	"\x17access_rpc_woken_avg_ms\x18: \x01(\rR\x13accessRpcWokenAvgMs\x124\n" +
+	"\x06health\x18; \x01(\v2\x1c.portunus.v1.HealthTelemetryR\x06healthB\x0e\n" +
 	"\f_door_closedB\v\n" +
-	"\t_rssi_dbm\"w\n" +
+	"\t_rssi_dbm\"\xe6\x04\n" +
 	"\x11HeartbeatResponse\x12\x0e\n" +
 	"\x02ok\x18\x01 \x01(\bR\x02ok\x12\x14\n" +
 	"\x05known\x18\x02 \x01(\bR\x05known\x12\x1b\n" +
 	"\tmodule_id\x18\x03 \x01(\tR\bmoduleId\x12\x1f\n" +
 	"\vserver_time\x18\x04 \x01(\tR\n" +
-	"serverTime\"\xc0\x01\n" +
+	"serverTime\x12%\n" +
+	"\x0epolicy_version\x18\x05 \x01(\rR\rpolicyVersion\x12:\n" +
+	"\x19revocation_filter_version\x18\x06 \x01(\rR\x17revocationFilterVersion\x124\n" +
+	"\x16revocation_filter_seed\x18\a \x01(\x04R\x14revocationFilterSeed\x122\n" +
+	"\x15revocation_filter_key\x18\b \x01(\fR\x13revocationFilterKey\x12@\n" +
+	"\x1crevocation_filter_exceptions\x18\t \x01(\fR\x1arevocationFilterExceptions\x12D\n" +
+	"\x1erevocation_filter_fingerprints\x18\n" +
+	" \x01(\fR\x1crevocationFilterFingerprints\x12$\n" +
+	"\x0eserver_time_us\x18\v \x01(\x03R\fserverTimeUs\x12#\n" +
+	"\rresend_static\x18\f \x01(\bR\fresendStatic\x12,\n" +
+	"\x12heartbeat_delay_ms\x18\r \x01(\rR\x10heartbeatDelayMs\x12\x1f\n" +
+	"\vhealth_dump\x18\x0e \x01(\bR\n" +
+	"healthDump\"\xc7\x02\n" +
 	"\rAccessRequest\x12\x1b\n" +
 	"\tmodule_id\x18\x01 \x01(\tR\bmoduleId\x12#\n" +
 	"\rcredential_id\x18\x02 \x01(\tR\fcredentialId\x12$\n" +
 	"\vdoor_closed\x18\x03 \x01(\bH\x00R\n" +
 	"doorClosed\x88\x01\x01\x12!\n" +
 	"\frequested_at\x18\x04 \x01(\tR\vrequestedAt\x12\x14\n" +
-	"\x05nonce\x18\x05 \x01(\fR\x05nonceB\x0e\n" +
-	"\f_door_closed\"\xa6\x01\n" +
+	"\x05nonce\x18\x05 \x01(\fR\x05nonce\x12\x16\n" +
+	"\x06cached\x18\x06 \x01(\bR\x06cached\x12\x1a\n" +
+	"\bfiltered\x18\a \x01(\bR\bfiltered\x12)\n" +
+	"\x10protocol_version\x18\b \x01(\rR\x0fprotocolVersion\x12&\n" +
+	"\x0frequested_at_us\x18\t \x01(\x03R\rrequestedAtUsB\x0e\n" +
+	"\f_door_closed\"\xcf\x02\n" +
 	"\x0eAccessResponse\x12\x0e\n" +
 	"\x02ok\x18\x01 \x01(\bR\x02ok\x12\x14\n" +
 	"\x05known\x18\x02 \x01(\bR\x05known\x12\x18\n" +
@@ -664,22 +1743,68 @@ const file_portunus_v1_portunus_proto_rawDesc = "" +
 	"\x06reason\x18\x04 \x01(\tR\x06reason\x12\x1b\n" +
 	"\tmodule_id\x18\x05 \x01(\tR\bmoduleId\x12\x1f\n" +
 	"\vserver_time\x18\x06 \x01(\tR\n" +
-	"serverTime\"\xd0\x01\n" +
+	"serverTime\x12\x1e\n" +
+	"\vcache_ttl_s\x18\a \x01(\rR\tcacheTtlS\x12%\n" +
+	"\x0epolicy_version\x18\b \x01(\rR\rpolicyVersion\x12:\n" +
+	"\vreason_code\x18\t \x01(\x0e2\x19.portunus.v1.AccessReasonR\n" +
+	"reasonCode\x12$\n" +
+	"\x0eserver_time_us\x18\n" +
+	" \x01(\x03R\fserverTimeUs\"\xfb\x01\n" +
 	"\x1aProvisionCredentialRequest\x12\x1b\n" +
 	"\tmodule_id\x18\x02 \x01(\tR\bmoduleId\x12%\n" +
-	"\x0ecredential_uid\x18\x05 \x01(\fR\rcredentialUidJ\x04\b\x01\x10\x02J\x04\b\x03\x10\x04J\x04\b\x04\x10\x05J\x04\b\x06\x10\aJ\x04\b\a\x10\bR\roperator_uuidR\x0fcredential_hashR\arole_idR\x17operator_credential_uidR\x0eprovision_mode\"\x8c\x01\n" +
+	"\x0ecredential_uid\x18\x05 \x01(\fR\rcredentialUid\x12)\n" +
+	"\x10protocol_version\x18\b \x01(\rR\x0fprotocolVersionJ\x04\b\x01\x10\x02J\x04\b\x03\x10\x04J\x04\b\x04\x10\x05J\x04\b\x06\x10\aJ\x04\b\a\x10\bR\roperator_uuidR\x0fcredential_hashR\arole_idR\x17operator_credential_uidR\x0eprovision_mode\"\x8c\x01\n" +
 	"\x1bProvisionCredentialResponse\x12\x1f\n" +
 	"\vmember_uuid\x18\x01 \x01(\tR\n" +
 	"memberUuid\x124\n" +
 	"\x06status\x18\x02 \x01(\x0e2\x1c.portunus.v1.ProvisionStatusR\x06status\x12\x16\n" +
-	"\x06detail\x18\x03 \x01(\tR\x06detail*\xb9\x02\n" +
+	"\x06detail\x18\x03 \x01(\tR\x06detail\"\xa5\x04\n" +
+	"\x0fHealthTelemetry\x12-\n" +
+	"\x13min_free_heap_bytes\x18\x01 \x01(\rR\x10minFreeHeapBytes\x127\n" +
+	"\x18largest_free_block_bytes\x18\x02 \x01(\rR\x15largestFreeBlockBytes\x12'\n" +
+	"\x0fserver_connects\x18\x03 \x01(\rR\x0eserverConnects\x126\n" +
+	"\x17server_connect_failures\x18\x04 \x01(\rR\x15serverConnectFailures\x12!\n" +
+	"\ftls_failures\x18\x05 \x01(\rR\vtlsFailures\x12,\n" +
+	"\x12tls_pin_mismatches\x18\x06 \x01(\rR\x10tlsPinMismatches\x12(\n" +
+	"\x10tls_handshake_ms\x18\a \x01(\rR\x0etlsHandshakeMs\x12\x1d\n" +
+	"\n" +
+	"task_count\x18\b \x01(\rR\ttaskCount\x12#\n" +
+	"\ridle_permille\x18\t \x01(\rR\fidlePermille\x12\x1b\n" +
+	"\tsample_us\x18\n" +
+	" \x01(\rR\bsampleUs\x12\"\n" +
+	"\rsample_max_us\x18\v \x01(\rR\vsampleMaxUs\x12\x1a\n" +
+	"\bdetailed\x18\f \x01(\bR\bdetailed\x12-\n" +
+	"\x05tasks\x18\r \x03(\v2\x17.portunus.v1.TaskHealthR\x05tasks\"\x9d\x01\n" +
+	"\n" +
+	"TaskHealth\x12\x12\n" +
+	"\x04name\x18\x01 \x01(\tR\x04name\x12!\n" +
+	"\fcpu_permille\x18\x02 \x01(\rR\vcpuPermille\x12(\n" +
+	"\x10stack_free_bytes\x18\x03 \x01(\rR\x0estackFreeBytes\x12\x12\n" +
+	"\x04core\x18\x04 \x01(\x11R\x04core\x12\x1a\n" +
+	"\bpriority\x18\x05 \x01(\rR\bpriority*\xb9\x02\n" +
 	"\x0fProvisionStatus\x12 \n" +
 	"\x1cPROVISION_STATUS_UNSPECIFIED\x10\x00\x12%\n" +
 	"!PROVISION_STATUS_DUPLICATE_ACTIVE\x10\x02\x12'\n" +
 	"#PROVISION_STATUS_DUPLICATE_INACTIVE\x10\x03\x12&\n" +
 	"\"PROVISION_STATUS_DUPLICATE_PENDING\x10\x04\x12!\n" +
 	"\x1dPROVISION_STATUS_UNAUTHORIZED\x10\x05\x12$\n" +
-	" PROVISION_STATUS_PENDING_CREATED\x10\a\"\x04\b\x01\x10\x01\"\x04\b\x06\x10\x06*\x18PROVISION_STATUS_SUCCESS*\x1dPROVISION_STATUS_INVALID_ROLE2\x95\x02\n" +
+	" PROVISION_STATUS_PENDING_CREATED\x10\a\"\x04\b\x01\x10\x01\"\x04\b\x06\x10\x06*\x18PROVISION_STATUS_SUCCESS*\x1dPROVISION_STATUS_INVALID_ROLE*\x8c\x04\n" +
+	"\fAccessReason\x12\x1d\n" +
+	"\x19ACCESS_REASON_UNSPECIFIED\x10\x00\x12\x1b\n" +
+	"\x17ACCESS_REASON_ALLOW_ALL\x10\x01\x12$\n" +
+	" ACCESS_REASON_CREDENTIAL_ALLOWED\x10\x02\x12\x18\n" +
+	"\x14ACCESS_REASON_DENIED\x10\x03\x12 \n" +
+	"\x1cACCESS_REASON_UNKNOWN_MODULE\x10\x04\x12+\n" +
+	"'ACCESS_REASON_INVALID_CREDENTIAL_FORMAT\x10\x05\x12&\n" +
+	"\"ACCESS_REASON_CREDENTIAL_NOT_FOUND\x10\x06\x12 \n" +
+	"\x1cACCESS_REASON_MEMBER_EXPIRED\x10\a\x12\"\n" +
+	"\x1eACCESS_REASON_MEMBER_SUSPENDED\x10\b\x12!\n" +
+	"\x1dACCESS_REASON_MEMBER_ARCHIVED\x10\t\x12!\n" +
+	"\x1dACCESS_REASON_MEMBER_DISABLED\x10\n" +
+	"\x12+\n" +
+	"'ACCESS_REASON_CREDENTIAL_NOT_AUTHORIZED\x10\v\x12'\n" +
+	"#ACCESS_REASON_AUTHORIZATION_REVOKED\x10\f\x12'\n" +
+	"#ACCESS_REASON_AUTHORIZATION_EXPIRED\x10\r2\x95\x02\n" +
 	"\x0fPortunusService\x12N\n" +
 	"\rSendHeartbeat\x12\x1d.portunus.v1.HeartbeatRequest\x1a\x1e.portunus.v1.HeartbeatResponse\x12H\n" +
 	"\rRequestAccess\x12\x1a.portunus.v1.AccessRequest\x1a\x1b.portunus.v1.AccessResponse\x12h\n" +
@@ -697,30 +1822,36 @@ func file_portunus_v1_portunus_proto_rawDescGZIP() []byte {
 	return file_portunus_v1_portunus_proto_rawDescData
 }
 
-var file_portunus_v1_portunus_proto_enumTypes = make([]protoimpl.EnumInfo, 1)
-var file_portunus_v1_portunus_proto_msgTypes = make([]protoimpl.MessageInfo, 6)
+var file_portunus_v1_portunus_proto_enumTypes = make([]protoimpl.EnumInfo, 2)
+var file_portunus_v1_portunus_proto_msgTypes = make([]protoimpl.MessageInfo, 8)
 var file_portunus_v1_portunus_proto_goTypes = []any{
 	(ProvisionStatus)(0),                // 0: portunus.v1.ProvisionStatus
-	(*HeartbeatRequest)(nil),            // 1: portunus.v1.HeartbeatRequest
-	(*HeartbeatResponse)(nil),           // 2: portunus.v1.HeartbeatResponse
-	(*AccessRequest)(nil),               // 3: portunus.v1.AccessRequest
-	(*AccessResponse)(nil),              // 4: portunus.v1.AccessResponse
-	(*ProvisionCredentialRequest)(nil),  // 5: portunus.v1.ProvisionCredentialRequest
-	(*ProvisionCredentialResponse)(nil), // 6: portunus.v1.ProvisionCredentialResponse
+	(AccessReason)(0),                   // 1: portunus.v1.AccessReason
+	(*HeartbeatRequest)(nil),            // 2: portunus.v1.HeartbeatRequest
+	(*HeartbeatResponse)(nil),           // 3: portunus.v1.HeartbeatResponse
+	(*AccessRequest)(nil),               // 4: portunus.v1.AccessRequest
+	(*AccessResponse)(nil),              // 5: portunus.v1.AccessResponse
+	(*ProvisionCredentialRequest)(nil),  // 6: portunus.v1.ProvisionCredentialRequest
+	(*ProvisionCredentialResponse)(nil), // 7: portunus.v1.ProvisionCredentialResponse
+	(*HealthTelemetry)(nil),             // 8: portunus.v1.HealthTelemetry
+	(*TaskHealth)(nil),                  // 9: portunus.v1.TaskHealth
 }
 var file_portunus_v1_portunus_proto_depIdxs = []int32{
-	0, // 0: portunus.v1.ProvisionCredentialResponse.status:type_name -> portunus.v1.ProvisionStatus
-	1, // 1: portunus.v1.PortunusService.SendHeartbeat:input_type -> portunus.v1.HeartbeatRequest
-	3, // 2: portunus.v1.PortunusService.RequestAccess:input_type -> portunus.v1.AccessRequest
-	5, // 3: portunus.v1.PortunusService.ProvisionCredential:input_type -> portunus.v1.ProvisionCredentialRequest
-	2, // 4: portunus.v1.PortunusService.SendHeartbeat:output_type -> portunus.v1.HeartbeatResponse
-	4, // 5: portunus.v1.PortunusService.RequestAccess:output_type -> portunus.v1.AccessResponse
-	6, // 6: portunus.v1.PortunusService.ProvisionCredential:output_type -> portunus.v1.ProvisionCredentialResponse
-	4, // [4:7] is the sub-list for method output_type
-	1, // [1:4] is the sub-list for method input_type
-	1, // [1:1] is the sub-list for extension type_name
-	1, // [1:1] is the sub-list for extension extendee
-	0, // [0:1] is the sub-list for field type_name
+	8, // 0: portunus.v1.HeartbeatRequest.health:type_name -> portunus.v1.HealthTelemetry
+	1, // 1: portunus.v1.AccessResponse.reason_code:type_name -> portunus.v1.AccessReason
+	0, // 2: portunus.v1.ProvisionCredentialResponse.status:type_name -> portunus.v1.ProvisionStatus
+	9, // 3: portunus.v1.HealthTelemetry.tasks:type_name -> portunus.v1.TaskHealth
+	2, // 4: portunus.v1.PortunusService.SendHeartbeat:input_type -> portunus.v1.HeartbeatRequest
+	4, // 5: portunus.v1.PortunusService.RequestAccess:input_type -> portunus.v1.AccessRequest
+	6, // 6: portunus.v1.PortunusService.ProvisionCredential:input_type -> portunus.v1.ProvisionCredentialRequest
+	3, // 7: portunus.v1.PortunusService.SendHeartbeat:output_type -> portunus.v1.HeartbeatResponse
+	5, // 8: portunus.v1.PortunusService.RequestAccess:output_type -> portunus.v1.AccessResponse
+	7, // 9: portunus.v1.PortunusService.ProvisionCredential:output_type -> portunus.v1.ProvisionCredentialResponse
+	7, // [7:10] is the sub-list for method output_type
+	4, // [4:7] is the sub-list for method input_type
+	4, // [4:4] is the sub-list for extension type_name
+	4, // [4:4] is the sub-list for extension extendee
+	0, // [0:4] is the sub-list for field type_name
 }
 
 func init() { file_portunus_v1_portunus_proto_init() }
@@ -735,8 +1866,8 @@ func file_portunus_v1_portunus_proto_init() {
 		File: protoimpl.DescBuilder{
 			GoPackagePath: reflect.TypeOf(x{}).PkgPath(),
 			RawDescriptor: unsafe.Slice(unsafe.StringData(file_portunus_v1_portunus_proto_rawDesc), len(file_portunus_v1_portunus_proto_rawDesc)),
-			NumEnums:      1,
-			NumMessages:   6,
+			NumEnums:      2,
+			NumMessages:   8,
 			NumExtensions: 0,
 			NumServices:   1,
 		},
@@ -75,6 +75,7 @@ func main() {
 	// Services
 	registry := service.NewDeviceRegistry(deviceStore)
 	heartbeatSvc := service.NewHeartbeatService(heartbeatStore, registry)
+	heartbeatSvc.SetPacing(service.NewHeartbeatPacing(cfg.HeartbeatPacingRPS, time.Second))
 
 	// Heartbeat pruner (background goroutine)
 	pruner := service.NewHeartbeatPruner(heartbeatStore, service.PrunerConfig{
@@ -105,6 +106,23 @@ func main() {
 	memberAccessSvc := service.NewMemberAccessService(memberAccessStore)
 	moduleAuthSvc := service.NewModuleAuthorizationService(moduleAuthStore, memberAccessStore, auditStore)
 
+	// Module-side decision caching: grants carry a TTL, and anything that can
+	// withdraw a grant bumps the policy version modules see in access and
+	// heartbeat responses.
+	policyVersion := service.NewPolicyVersion()
+	accessSvc.SetDecisionCache(time.Duration(cfg.DecisionCacheTTLSeconds)*time.Second, policyVersion)
+	heartbeatSvc.SetPolicyVersion(policyVersion)
+	memberAccessSvc.SetPolicyVersion(policyVersion)
+	moduleAuthSvc.SetPolicyVersion(policyVersion)
+
+	// Revocation filter: modules deny revoked credentials locally, before any
+	// round trip. Rebuilt when the policy version moves; shipped on heartbeats.
+	revocationFilter := service.NewRevocationFilter(memberAccessStore, credentialHashSecret, policyVersion,
+		time.Duration(cfg.RevocationFilterRefreshSeconds)*time.Second)
+	revocationFilter.SetLogger(logger)
+	accessSvc.SetRevocationFilter(revocationFilter)
+	heartbeatSvc.SetRevocationFilter(revocationFilter)
+
 	// Enable member_access + module_authorizations path in the access service.
 	accessSvc.SetMemberAccessStore(memberAccessStore)
 	accessSvc.SetModuleAuthStore(moduleAuthStore)
@@ -117,11 +135,13 @@ func main() {
 		IntervalMinutes: cfg.ExpiryWorkerIntervalMinutes,
 		PendingTTLDays:  cfg.PendingTTLDays,
 	}, logger)
+	expiryWorker.SetPolicyVersion(policyVersion)
 	expiryWorker.Start(ctx)
 	defer expiryWorker.Stop()
 
 	// Provisioning service: handles device-initiated provisioning from PROVISIONING_CONSOLE modules.
 	provisionSvc := service.NewProvisionService(registry, memberAccessStore, accessEventStore, credentialHashSecret, auditStore)
+	provisionSvc.SetRevocationFilter(revocationFilter)
 
 	// Admin service for module and door management via REST API.
 	adminSvc := service.NewAdminService(moduleAdminStore, credentialHashSecret)
@@ -58,6 +58,21 @@ type Config struct {
 	ExpiryWorkerIntervalMinutes int // how often member expiry sweeps run (default 60)
 	PendingTTLDays              int // how many days before stale pending rows are archived; 0 disables (default 7)
 
+	// DecisionCacheTTLSeconds is how long a module may reuse a grant for the
+	// same credential without asking. Revocations reach an idle module within
+	// one heartbeat interval regardless. 0 disables module-side caching.
+	DecisionCacheTTLSeconds int // default 60
+
+	// RevocationFilterRefreshSeconds bounds how often the revocation filter
+	// is rebuilt when the policy version has not moved; that is how long a
+	// newly tagged credential waits to join it. Revocations rebuild at once.
+	RevocationFilterRefreshSeconds int // default 30
+
+	// HeartbeatPacingRPS is the heartbeat rate above which the server asks
+	// modules to push their next heartbeat back, spreading a fleet that
+	// booted together. One second's worth may arrive at once. 0 disables.
+	HeartbeatPacingRPS int // default 100
+
 	// TLS. When both files are set, the server serves HTTPS using them.
 	// When unset under the ci profile, the server generates an ephemeral
 	// self-signed cert in-process (see EphemeralCert). Under local, unset
@@ -133,10 +148,13 @@ func FromEnv() (Config, error) {
 		KnownModules: splitCSV(os.Getenv("PORTUNUS_KNOWN_MODULES")),
 		AllowAll:     allowAll,
 
-		HeartbeatRetentionDays:      getenvInt("PORTUNUS_HEARTBEAT_RETENTION_DAYS", 30),
-		PruneIntervalHours:          getenvInt("PORTUNUS_PRUNE_INTERVAL_HOURS", 6),
-		ExpiryWorkerIntervalMinutes: getenvInt("PORTUNUS_EXPIRY_WORKER_INTERVAL_MINUTES", 60),
-		PendingTTLDays:              getenvInt("PORTUNUS_PENDING_TTL_DAYS", 7),
+		HeartbeatRetentionDays:         getenvInt("PORTUNUS_HEARTBEAT_RETENTION_DAYS", 30),
+		PruneIntervalHours:             getenvInt("PORTUNUS_PRUNE_INTERVAL_HOURS", 6),
+		ExpiryWorkerIntervalMinutes:    getenvInt("PORTUNUS_EXPIRY_WORKER_INTERVAL_MINUTES", 60),
+		PendingTTLDays:                 getenvInt("PORTUNUS_PENDING_TTL_DAYS", 7),
+		DecisionCacheTTLSeconds:        getenvInt("PORTUNUS_DECISION_CACHE_TTL_S", 60),
+		RevocationFilterRefreshSeconds: getenvInt("PORTUNUS_REVOCATION_FILTER_REFRESH_S", 30),
+		HeartbeatPacingRPS:             getenvInt("PORTUNUS_HEARTBEAT_PACING_RPS", 100),
 
 		TLSCertFile:          strings.TrimSpace(os.Getenv("PORTUNUS_TLS_CERT_FILE")),
 		TLSKeyFile:           strings.TrimSpace(os.Getenv("PORTUNUS_TLS_KEY_FILE")),
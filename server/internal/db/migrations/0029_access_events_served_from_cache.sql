@@ -0,0 +1,7 @@
+-- Mark access events reported by a module that had already opened the door
+-- from its decision cache. decision_granted/decision_reason on such rows are
+-- the server's fresh decision at report time; a 0 there means the module
+-- acted on a grant that had since been withdrawn.
+ALTER TABLE access_events
+  ADD COLUMN served_from_cache INTEGER NOT NULL DEFAULT 0
+  CHECK (served_from_cache IN (0,1));
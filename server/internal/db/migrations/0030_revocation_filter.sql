@@ -0,0 +1,17 @@
+-- Revocation filter (see internal/revfilter).
+--
+-- member_access.revocation_tag is the member's credential tag under the
+-- filter key: 8 bytes of HMAC over the raw UID, stored as a signed 64-bit
+-- integer. Only the raw UID yields it, so it is filled in whenever one
+-- passes through the server (provisioning, admin enrolment, access
+-- requests) and stays NULL for credentials not seen since this migration;
+-- those are simply left out of the filter.
+ALTER TABLE member_access ADD COLUMN revocation_tag INTEGER;
+
+-- access_events.denied_by_filter marks taps the module already denied
+-- from its revocation filter and reported afterwards.
+-- decision_granted/decision_reason on such rows are the server's own
+-- decision; a 1 there is a filter false positive the module now passes.
+ALTER TABLE access_events
+  ADD COLUMN denied_by_filter INTEGER NOT NULL DEFAULT 0
+  CHECK (denied_by_filter IN (0,1));
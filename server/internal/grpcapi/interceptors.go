@@ -12,6 +12,7 @@ import (
 
 	pb "github.com/BrandonDHaskell/Portunus/server/api/portunus/v1"
 	"github.com/BrandonDHaskell/Portunus/server/internal/replay"
+	"github.com/BrandonDHaskell/Portunus/server/internal/wiresig"
 	"google.golang.org/grpc"
 	"google.golang.org/grpc/codes"
 	"google.golang.org/grpc/metadata"
@@ -24,23 +25,35 @@ import (
 // gRPC metadata keys are lowercase by convention.
 const hmacHeaderKey = "x-portunus-sig"
 
-// hmacProjection builds the canonical byte string that the firmware signs.
+// hmacProjection builds the canonical byte string that the firmware signed.
 //
-// Projection formats (must match grpc_post_proto() in services/server_comm):
+// A request with protocol_version 2 signs the binary projection from
+// internal/wiresig. Older firmware signs text (must match its
+// grpc_post_proto() callers):
 //
 //	Heartbeat:  "heartbeat|{module_id}|{sequence}"
 //	Access:     "access|{module_id}|{credential_id}|{nonce_hex}|{requested_at}"
 //	Provision:  "provision|{module_id}|{hex(credential_uid)}"
 //
-// The access projection includes the nonce (hex-encoded) and requested_at so
+// The access projection includes the nonce and the request timestamp so
 // that every request has a unique signed payload — a captured access request
-// cannot be replayed because the nonce is single-use.  requested_at must be
-// present when HMAC is enabled; the server rejects requests with empty timestamps.
+// cannot be replayed because the nonce is single-use.  The timestamp must be
+// present when HMAC is enabled; the server rejects requests without one.
+//
+// protocol_version is not itself signed, but it needs no signature: a
+// request relabelled with the other version is checked against the other
+// projection, which the device never signed.
 func hmacProjection(req interface{}) ([]byte, error) {
 	switch m := req.(type) {
 	case *pb.HeartbeatRequest:
+		if m.ProtocolVersion >= wiresig.Version {
+			return wiresig.Heartbeat(m.ModuleId, m.Sequence)
+		}
 		return []byte(fmt.Sprintf("heartbeat|%s|%d", m.ModuleId, m.Sequence)), nil
 	case *pb.AccessRequest:
+		if m.ProtocolVersion >= wiresig.Version {
+			return wiresig.Access(m.ModuleId, m.CredentialId, m.Nonce, m.RequestedAtUs)
+		}
 		return []byte(fmt.Sprintf("access|%s|%s|%s|%s",
 			m.ModuleId,
 			m.CredentialId,
@@ -50,32 +63,45 @@ func hmacProjection(req interface{}) ([]byte, error) {
 	case *pb.ProvisionCredentialRequest:
 		// credential_uid (raw RFID bytes of the new member's card) is the
 		// key field for the capture-only path. Matches the firmware projection.
+		if m.ProtocolVersion >= wiresig.Version {
+			return wiresig.Provision(m.ModuleId, m.CredentialUid)
+		}
 		return []byte(fmt.Sprintf("provision|%s|%x", m.ModuleId, m.CredentialUid)), nil
 	default:
 		return nil, fmt.Errorf("unsupported request type %T", req)
 	}
 }
 
-// accessResponseProjection returns the canonical string the server signs for an
-// AccessResponse and the device verifies before publishing EVENT_ACCESS_GRANTED.
-// Format: "access|{module_id}|{credential_id}|{1 or 0}"
-// Must match the snprintf in handle_credential() in server_comm.cpp.
-func accessResponseProjection(moduleID, credentialID string, granted bool) []byte {
+// accessResponseProjection returns the canonical bytes the server signs for
+// an AccessResponse and the device verifies before publishing
+// EVENT_ACCESS_GRANTED: wiresig.AccessResponse for a protocol_version 2
+// request, otherwise "access|{module_id}|{credential_id}|{1 or 0}".
+func accessResponseProjection(protocolVersion uint32, resp *pb.AccessResponse, moduleID, credentialID string) ([]byte, error) {
+	granted := resp.GetGranted()
+	if protocolVersion >= wiresig.Version {
+		return wiresig.AccessResponse(moduleID, credentialID, granted, resp.GetCacheTtlS(), resp.GetPolicyVersion())
+	}
 	v := 0
 	if granted {
 		v = 1
 	}
-	return []byte(fmt.Sprintf("access|%s|%s|%d", moduleID, credentialID, v))
+	return []byte(fmt.Sprintf("access|%s|%s|%d", moduleID, credentialID, v)), nil
 }
 
 // AccessResponseSig computes the HMAC-SHA256 signature the server attaches to
-// an AccessResponse.  Returns an empty string when secret is empty (HMAC
+// resp, in the form the request's protocol_version expects.  Sign the
+// response exactly as it is sent: version 2 covers its cache_ttl_s and
+// policy_version.  Returns an empty string when secret is empty (HMAC
 // disabled), so callers can gate on a non-empty result.
-func AccessResponseSig(secret, moduleID, credentialID string, granted bool) string {
+func AccessResponseSig(secret string, protocolVersion uint32, resp *pb.AccessResponse, moduleID, credentialID string) string {
 	if secret == "" {
 		return ""
 	}
-	projection := accessResponseProjection(moduleID, credentialID, granted)
+	projection, err := accessResponseProjection(protocolVersion, resp, moduleID, credentialID)
+	if err != nil {
+		// The request carrying these ids already verified, so they fit.
+		return ""
+	}
 	mac := hmac.New(sha256.New, []byte(secret))
 	mac.Write(projection)
 	return hex.EncodeToString(mac.Sum(nil))
@@ -84,6 +110,10 @@ func AccessResponseSig(secret, moduleID, credentialID string, granted bool) stri
 // HMACInterceptor returns a gRPC unary server interceptor that verifies
 // the HMAC-SHA256 signature attached as custom metadata by the ESP32, then
 // — for AccessRequests — checks the request against store to reject replays.
+// A repeated nonce waits for its first request to finish.  If that one was
+// answered, the repeat gets the same answer back (the firmware's fast retry);
+// if its caller gave up before a decision was made, the repeat decides;
+// otherwise it is rejected.
 //
 // The signature is computed over a canonical projection of key request fields
 // (see hmacProjection), not the raw protobuf bytes. This avoids spurious
@@ -124,6 +154,9 @@ func HMACInterceptor(secret string, replayStore *replay.Store) grpc.UnaryServerI
 
 		// Build the canonical projection the firmware signed.
 		projection, projErr := hmacProjection(req)
+		if errors.Is(projErr, wiresig.ErrFieldTooLong) {
+			return nil, status.Errorf(codes.InvalidArgument, "HMAC projection: %v", projErr)
+		}
 		if projErr != nil {
 			return nil, status.Errorf(codes.Internal, "HMAC projection: %v", projErr)
 		}
@@ -141,9 +174,23 @@ func HMACInterceptor(secret string, replayStore *replay.Store) grpc.UnaryServerI
 		if replayStore != nil {
 			if ar, ok := req.(*pb.AccessRequest); ok {
 				nonceHex := hex.EncodeToString(ar.Nonce)
-				if err := replayStore.Check(ar.ModuleId, nonceHex, ar.RequestedAt); err != nil {
-					return nil, replayErrToStatus(err)
+				if err := checkReplay(replayStore, ar, nonceHex); err != nil {
+					if !errors.Is(err, replay.ErrNonceSeen) {
+						return nil, replayErrToStatus(err)
+					}
+					resp, err := settledAccess(ctx, secret, replayStore, ar, nonceHex)
+					if err != nil {
+						return nil, err
+					}
+					if resp != nil {
+						return resp, nil
+					}
+					// The first request was released: decide here.
 				}
+
+				resp, err := handler(ctx, req)
+				settleAccess(replayStore, ar.ModuleId, nonceHex, resp, err)
+				return resp, err
 			}
 		}
 
@@ -151,6 +198,74 @@ func HMACInterceptor(secret string, replayStore *replay.Store) grpc.UnaryServerI
 	}
 }
 
+// settledAccess answers a retried access request — same nonce, same signed
+// fields — with the decision already made for it, waiting for that decision
+// if the first request is still in flight.  The firmware retries on a fresh
+// connection when the first one died before the answer arrived; deciding
+// again would double the audit trail, and a replayer gains nothing from a
+// copy of an answer bound to the original device's request.
+//
+// It returns nil and no error when the first request ended without a
+// decision; the caller then holds the nonce and decides.
+func settledAccess(ctx context.Context, secret string, store *replay.Store,
+	ar *pb.AccessRequest, nonceHex string) (*pb.AccessResponse, error) {
+	outcome, err := store.Await(ctx, ar.ModuleId, nonceHex)
+	switch {
+	case errors.Is(err, context.Canceled), errors.Is(err, context.DeadlineExceeded):
+		return nil, status.FromContextError(err).Err()
+	case err != nil:
+		return nil, replayErrToStatus(err)
+	case outcome == nil:
+		return nil, nil
+	}
+	resp, ok := outcome.(*pb.AccessResponse)
+	if !ok {
+		return nil, replayErrToStatus(replay.ErrNonceSeen)
+	}
+	if sig := AccessResponseSig(secret, ar.ProtocolVersion, resp, ar.ModuleId, ar.CredentialId); sig != "" {
+		// Fails only outside a real server stream (unit tests).
+		_ = grpc.SetTrailer(ctx, metadata.Pairs(hmacHeaderKey, sig))
+	}
+	return resp, nil
+}
+
+// settleAccess records how the access request carrying nonceHex ended.  A
+// request whose caller gave up before the handler decided is released so
+// the device's retry can decide; anything else settles, with the response
+// if there is one to hand back to a retry.
+func settleAccess(store *replay.Store, moduleID, nonceHex string, resp interface{}, err error) {
+	if err != nil {
+		if c := status.Code(err); c == codes.Canceled || c == codes.DeadlineExceeded {
+			store.Release(moduleID, nonceHex)
+			return
+		}
+		store.Settle(moduleID, nonceHex, nil)
+		return
+	}
+	if out, ok := resp.(*pb.AccessResponse); ok && out != nil {
+		store.Settle(moduleID, nonceHex, out)
+		return
+	}
+	store.Settle(moduleID, nonceHex, nil)
+}
+
+// errUnsignedTimestamp rejects requested_at_us on a request whose projection
+// does not sign it: anyone could freshen a captured request's timestamp.
+var errUnsignedTimestamp = errors.New("requested_at_us requires protocol_version 2")
+
+// checkReplay checks an access request's nonce and the timestamp its
+// projection signs: requested_at_us from protocol_version 2, requested_at
+// before.
+func checkReplay(store *replay.Store, ar *pb.AccessRequest, nonceHex string) error {
+	if ar.ProtocolVersion >= wiresig.Version {
+		return store.CheckMicros(ar.ModuleId, nonceHex, ar.RequestedAtUs)
+	}
+	if ar.RequestedAtUs != 0 {
+		return errUnsignedTimestamp
+	}
+	return store.Check(ar.ModuleId, nonceHex, ar.RequestedAt)
+}
+
 // replayErrToStatus converts a replay sentinel error into a gRPC status error.
 func replayErrToStatus(err error) error {
 	switch {
@@ -160,6 +275,8 @@ func replayErrToStatus(err error) error {
 		return status.Errorf(codes.Unauthenticated, "replay: request timestamp out of window")
 	case errors.Is(err, replay.ErrTimestampRequired):
 		return status.Errorf(codes.Unauthenticated, "replay: requested_at is required")
+	case errors.Is(err, errUnsignedTimestamp):
+		return status.Errorf(codes.Unauthenticated, "replay: %v", err)
 	case errors.Is(err, replay.ErrTimestampInvalid):
 		return status.Errorf(codes.InvalidArgument, "replay: invalid requested_at timestamp")
 	default:
@@ -6,12 +6,14 @@ import (
 	"crypto/sha256"
 	"encoding/hex"
 	"fmt"
+	"sync/atomic"
 	"testing"
 	"time"
 
 	pb "github.com/BrandonDHaskell/Portunus/server/api/portunus/v1"
 	"github.com/BrandonDHaskell/Portunus/server/internal/grpcapi"
 	"github.com/BrandonDHaskell/Portunus/server/internal/replay"
+	"github.com/BrandonDHaskell/Portunus/server/internal/wiresig"
 	"google.golang.org/grpc"
 	"google.golang.org/grpc/codes"
 	"google.golang.org/grpc/metadata"
@@ -25,20 +27,28 @@ const hmacSigHeader = "x-portunus-sig"
 
 // sign computes the HMAC signature for req using the same projection as the interceptor.
 func sign(req interface{}, secret string) string {
-	var proj string
+	var proj []byte
 	switch m := req.(type) {
 	case *pb.HeartbeatRequest:
-		proj = fmt.Sprintf("heartbeat|%s|%d", m.ModuleId, m.Sequence)
+		if m.ProtocolVersion >= wiresig.Version {
+			proj, _ = wiresig.Heartbeat(m.ModuleId, m.Sequence)
+		} else {
+			proj = []byte(fmt.Sprintf("heartbeat|%s|%d", m.ModuleId, m.Sequence))
+		}
 	case *pb.AccessRequest:
-		proj = fmt.Sprintf("access|%s|%s|%s|%s",
-			m.ModuleId,
-			m.CredentialId,
-			hex.EncodeToString(m.Nonce),
-			m.RequestedAt,
-		)
+		if m.ProtocolVersion >= wiresig.Version {
+			proj, _ = wiresig.Access(m.ModuleId, m.CredentialId, m.Nonce, m.RequestedAtUs)
+		} else {
+			proj = []byte(fmt.Sprintf("access|%s|%s|%s|%s",
+				m.ModuleId,
+				m.CredentialId,
+				hex.EncodeToString(m.Nonce),
+				m.RequestedAt,
+			))
+		}
 	}
 	mac := hmac.New(sha256.New, []byte(secret))
-	mac.Write([]byte(proj))
+	mac.Write(proj)
 	return hex.EncodeToString(mac.Sum(nil))
 }
 
@@ -118,6 +128,31 @@ func TestHMACInterceptor_ValidAccessRequest_Passes(t *testing.T) {
 	}
 }
 
+// binaryAccessRequest is freshAccessRequest in protocol v2 form: a µs
+// timestamp in place of the RFC 3339 string.
+func binaryAccessRequest(moduleID, credentialID string) *pb.AccessRequest {
+	req := freshAccessRequest(moduleID, credentialID)
+	req.ProtocolVersion = wiresig.Version
+	req.RequestedAt = ""
+	req.RequestedAtUs = time.Now().UnixMicro()
+	return req
+}
+
+func TestHMACInterceptor_BinaryProjections_Pass(t *testing.T) {
+	store := replay.NewStore(60 * time.Second)
+	interceptor := grpcapi.HMACInterceptor(testHMACSecret, store)
+	for _, req := range []interface{}{
+		&pb.HeartbeatRequest{ModuleId: "door-001", Sequence: 42, ProtocolVersion: wiresig.Version},
+		binaryAccessRequest("door-001", "AABBCCDD"),
+	} {
+		ctx := metadata.NewIncomingContext(context.Background(),
+			metadata.Pairs(hmacSigHeader, sign(req, testHMACSecret)))
+		if _, err := invoke(interceptor, ctx, req); err != nil {
+			t.Fatalf("valid binary-projection HMAC should pass for %T, got: %v", req, err)
+		}
+	}
+}
+
 // ── rejection cases ───────────────────────────────────────────────────────────
 
 func TestHMACInterceptor_MissingMetadata_Unauthenticated(t *testing.T) {
@@ -161,6 +196,20 @@ func TestHMACInterceptor_TamperedField_Unauthenticated(t *testing.T) {
 	assertCode(t, err, codes.Unauthenticated)
 }
 
+// TestHMACInterceptor_VersionRelabel_Unauthenticated: protocol_version is
+// not signed, but flipping it selects a projection the device never signed.
+func TestHMACInterceptor_VersionRelabel_Unauthenticated(t *testing.T) {
+	interceptor := grpcapi.HMACInterceptor(testHMACSecret, nil)
+	req := binaryAccessRequest("door-001", "AABBCCDD")
+	req.RequestedAt = time.UnixMicro(req.RequestedAtUs).UTC().Format(time.RFC3339Nano)
+	sig := sign(req, testHMACSecret)
+
+	req.ProtocolVersion = 0
+	ctx := metadata.NewIncomingContext(context.Background(), metadata.Pairs(hmacSigHeader, sig))
+	_, err := invoke(interceptor, ctx, req)
+	assertCode(t, err, codes.Unauthenticated)
+}
+
 func TestHMACInterceptor_BadHexSignature_Unauthenticated(t *testing.T) {
 	interceptor := grpcapi.HMACInterceptor(testHMACSecret, nil)
 	req := &pb.HeartbeatRequest{ModuleId: "door-001", Sequence: 1}
@@ -231,6 +280,37 @@ func TestHMACInterceptor_StaleTimestamp_Unauthenticated(t *testing.T) {
 	assertCode(t, err, codes.Unauthenticated)
 }
 
+func TestHMACInterceptor_StaleBinaryTimestamp_Unauthenticated(t *testing.T) {
+	store := replay.NewStore(60 * time.Second)
+	interceptor := grpcapi.HMACInterceptor(testHMACSecret, store)
+
+	req := binaryAccessRequest("door-001", "AABBCCDD")
+	req.RequestedAtUs = time.Now().Add(-90 * time.Second).UnixMicro()
+
+	ctx := metadata.NewIncomingContext(context.Background(),
+		metadata.Pairs(hmacSigHeader, sign(req, testHMACSecret)))
+
+	_, err := invoke(interceptor, ctx, req)
+	assertCode(t, err, codes.Unauthenticated)
+}
+
+// TestHMACInterceptor_UnsignedBinaryTimestamp_Unauthenticated: a v0
+// projection does not sign requested_at_us, so a captured v0 request must not
+// get past the replay window by carrying a fresh one.
+func TestHMACInterceptor_UnsignedBinaryTimestamp_Unauthenticated(t *testing.T) {
+	store := replay.NewStore(60 * time.Second)
+	interceptor := grpcapi.HMACInterceptor(testHMACSecret, store)
+
+	req := freshAccessRequest("door-001", "AABBCCDD")
+	req.RequestedAt = time.Now().UTC().Add(-90 * time.Second).Format(time.RFC3339Nano)
+	sig := sign(req, testHMACSecret)
+
+	req.RequestedAtUs = time.Now().UnixMicro()
+	ctx := metadata.NewIncomingContext(context.Background(), metadata.Pairs(hmacSigHeader, sig))
+	_, err := invoke(interceptor, ctx, req)
+	assertCode(t, err, codes.Unauthenticated)
+}
+
 func TestHMACInterceptor_EmptyTimestamp_Rejected(t *testing.T) {
 	// When HMAC is enabled, a missing requested_at is always rejected (F-5).
 	// Firmware must provide a synchronised clock timestamp.
@@ -262,3 +342,169 @@ func TestHMACInterceptor_NoStore_NoReplayCheck(t *testing.T) {
 		t.Fatalf("repeated request with no store should pass, got: %v", err)
 	}
 }
+
+// ── retried access requests ───────────────────────────────────────────────────
+
+// countingHandler answers AccessRequests with a grant and counts decisions.
+func countingHandler(calls *int, fail bool) grpc.UnaryHandler {
+	return func(_ context.Context, r interface{}) (interface{}, error) {
+		*calls++
+		if fail {
+			return nil, status.Errorf(codes.Internal, "decision failed")
+		}
+		ar := r.(*pb.AccessRequest)
+		return &pb.AccessResponse{Ok: true, Granted: true, ModuleId: ar.ModuleId}, nil
+	}
+}
+
+func TestHMACInterceptor_RetriedNonce_GetsSettledAnswer(t *testing.T) {
+	store := replay.NewStore(60 * time.Second)
+	interceptor := grpcapi.HMACInterceptor(testHMACSecret, store)
+	req := freshAccessRequest("door-001", "AABBCCDD")
+	info := &grpc.UnaryServerInfo{FullMethod: "/portunus.v1.PortunusService/RequestAccess"}
+
+	ctx := metadata.NewIncomingContext(context.Background(),
+		metadata.Pairs(hmacSigHeader, sign(req, testHMACSecret)))
+
+	calls := 0
+	first, err := interceptor(ctx, req, info, countingHandler(&calls, false))
+	if err != nil {
+		t.Fatalf("first request should pass, got: %v", err)
+	}
+
+	// The device lost the connection and retries with the same nonce.
+	retry, err := interceptor(ctx, req, info, countingHandler(&calls, false))
+	if err != nil {
+		t.Fatalf("retry of an answered request should get the answer, got: %v", err)
+	}
+	if calls != 1 {
+		t.Errorf("expected one decision, handler ran %d times", calls)
+	}
+	if retry != first {
+		t.Errorf("retry should get the settled response")
+	}
+}
+
+func TestHMACInterceptor_RetriedNonce_UnansweredIsRejected(t *testing.T) {
+	store := replay.NewStore(60 * time.Second)
+	interceptor := grpcapi.HMACInterceptor(testHMACSecret, store)
+	req := freshAccessRequest("door-001", "AABBCCDD")
+	info := &grpc.UnaryServerInfo{FullMethod: "/portunus.v1.PortunusService/RequestAccess"}
+
+	ctx := metadata.NewIncomingContext(context.Background(),
+		metadata.Pairs(hmacSigHeader, sign(req, testHMACSecret)))
+
+	calls := 0
+	if _, err := interceptor(ctx, req, info, countingHandler(&calls, true)); err == nil {
+		t.Fatalf("first request should fail")
+	}
+
+	// No answer was recorded, so the repeat is still a replay.
+	_, err := interceptor(ctx, req, info, countingHandler(&calls, false))
+	assertCode(t, err, codes.Unauthenticated)
+	if calls != 1 {
+		t.Errorf("replay must not reach the handler, handler ran %d times", calls)
+	}
+}
+
+func TestHMACInterceptor_RetryWhileFirstInFlight_WaitsForItsAnswer(t *testing.T) {
+	store := replay.NewStore(60 * time.Second)
+	interceptor := grpcapi.HMACInterceptor(testHMACSecret, store)
+	req := freshAccessRequest("door-001", "AABBCCDD")
+	info := &grpc.UnaryServerInfo{FullMethod: "/portunus.v1.PortunusService/RequestAccess"}
+	md := metadata.Pairs(hmacSigHeader, sign(req, testHMACSecret))
+
+	// The first attempt is cancelled by the device part-way through the
+	// decision; like RequestAccess, the handler finishes deciding anyway.
+	entered := make(chan struct{})
+	decide := make(chan struct{})
+	var calls atomic.Int32
+	slow := func(_ context.Context, r interface{}) (interface{}, error) {
+		calls.Add(1)
+		close(entered)
+		<-decide
+		return &pb.AccessResponse{Ok: true, Granted: true, ModuleId: r.(*pb.AccessRequest).ModuleId}, nil
+	}
+	firstCtx, cancel := context.WithCancel(metadata.NewIncomingContext(context.Background(), md))
+	type result struct {
+		resp interface{}
+		err  error
+	}
+	first := make(chan result, 1)
+	go func() {
+		resp, err := interceptor(firstCtx, req, info, slow)
+		first <- result{resp, err}
+	}()
+	<-entered
+	cancel()
+
+	// The retry arrives on a fresh connection before the decision is made.
+	retryCtx, retryCancel := context.WithTimeout(metadata.NewIncomingContext(context.Background(), md), 5*time.Second)
+	defer retryCancel()
+	retry := make(chan result, 1)
+	go func() {
+		resp, err := interceptor(retryCtx, req, info, func(_ context.Context, _ interface{}) (interface{}, error) {
+			calls.Add(1)
+			return nil, status.Errorf(codes.Internal, "retry must not decide")
+		})
+		retry <- result{resp, err}
+	}()
+
+	select {
+	case r := <-retry:
+		t.Fatalf("retry answered before the first decision was made: %v, %v", r.resp, r.err)
+	case <-time.After(50 * time.Millisecond):
+	}
+	close(decide)
+
+	f := <-first
+	r := <-retry
+	if r.err != nil {
+		t.Fatalf("retry should get the first attempt's answer, got: %v", r.err)
+	}
+	if r.resp != f.resp {
+		t.Errorf("retry should get the settled response")
+	}
+	if n := calls.Load(); n != 1 {
+		t.Errorf("expected one decision, handlers ran %d times", n)
+	}
+}
+
+func TestHMACInterceptor_RetryAfterFirstGaveUp_Decides(t *testing.T) {
+	store := replay.NewStore(60 * time.Second)
+	interceptor := grpcapi.HMACInterceptor(testHMACSecret, store)
+	req := freshAccessRequest("door-001", "AABBCCDD")
+	info := &grpc.UnaryServerInfo{FullMethod: "/portunus.v1.PortunusService/RequestAccess"}
+
+	ctx := metadata.NewIncomingContext(context.Background(),
+		metadata.Pairs(hmacSigHeader, sign(req, testHMACSecret)))
+
+	// The first attempt's deadline had passed before a decision was made.
+	calls := 0
+	expired := func(_ context.Context, _ interface{}) (interface{}, error) {
+		calls++
+		return nil, status.FromContextError(context.DeadlineExceeded).Err()
+	}
+	_, err := interceptor(ctx, req, info, expired)
+	assertCode(t, err, codes.DeadlineExceeded)
+
+	// Nothing was decided, so the retry decides.
+	resp, err := interceptor(ctx, req, info, countingHandler(&calls, false))
+	if err != nil {
+		t.Fatalf("retry of an undecided request should be decided, got: %v", err)
+	}
+	if out, ok := resp.(*pb.AccessResponse); !ok || !out.Granted {
+		t.Errorf("expected the retry's grant, got %v", resp)
+	}
+	if calls != 2 {
+		t.Errorf("expected the handler to run twice, ran %d times", calls)
+	}
+
+	// That answer is now settled: a third copy gets it without a decision.
+	if _, err := interceptor(ctx, req, info, countingHandler(&calls, false)); err != nil {
+		t.Fatalf("repeat of an answered request should get the answer, got: %v", err)
+	}
+	if calls != 2 {
+		t.Errorf("expected no third decision, handler ran %d times", calls)
+	}
+}
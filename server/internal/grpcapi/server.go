@@ -74,6 +74,64 @@ func (s *Server) SendHeartbeat(ctx context.Context, req *pb.HeartbeatRequest) (*
 		IP:              req.GetIp(),
 		FreeHeapBytes:   req.GetFreeHeapBytes(),
 		Sequence:        req.GetSequence(),
+		CPUCores:        req.GetCpuCores(),
+		CoreIsolation:   req.GetCoreIsolation(),
+		TaskPlanFaults:  req.GetTaskPlanFaults(),
+		StaleTaps:       req.GetStaleTaps(),
+		RTTP50Ms:        req.GetRttP50Ms(),
+		RTTP90Ms:        req.GetRttP90Ms(),
+		RTTP99Ms:        req.GetRttP99Ms(),
+		RPCTimeoutMs:    req.GetRpcTimeoutMs(),
+		DeadLinks:       req.GetDeadLinks(),
+
+		DecisionCacheHits:          req.GetDecisionCacheHits(),
+		DecisionCacheMisses:        req.GetDecisionCacheMisses(),
+		DecisionCacheEvictions:     req.GetDecisionCacheEvictions(),
+		DecisionCacheInvalidations: req.GetDecisionCacheInvalidations(),
+
+		RevocationFilterVersion:  req.GetRevocationFilterVersion(),
+		RevocationFilterCapacity: req.GetRevocationFilterCapacity(),
+		RevocationFilterDenials:  req.GetRevocationFilterDenials(),
+
+		ClockOffsetUS: req.GetClockOffsetUs(),
+		ClockErrorUS:  req.GetClockErrorUs(),
+		ClockDriftPPB: req.GetClockDriftPpb(),
+
+		StaticOmitted:       req.GetStaticOmitted(),
+		HeartbeatIntervalS:  req.GetHeartbeatIntervalS(),
+		HeartbeatsSkipped:   req.GetHeartbeatsSkipped(),
+		HeartbeatBytesSaved: req.GetHeartbeatBytesSaved(),
+
+		BootConfigMs:    req.GetBootConfigMs(),
+		BootWiFiStartMs: req.GetBootWifiStartMs(),
+		BootIOReadyMs:   req.GetBootIoReadyMs(),
+		BootFSMMs:       req.GetBootFsmMs(),
+		BootIPMs:        req.GetBootIpMs(),
+		BootServerMs:    req.GetBootServerMs(),
+
+		WiFiConnects:       req.GetWifiConnects(),
+		WiFiHintedConnects: req.GetWifiHintedConnects(),
+		WiFiScanFallbacks:  req.GetWifiScanFallbacks(),
+		WiFiAssocToIPMs:    req.GetWifiAssocToIpMs(),
+		WiFiAssocToIPMaxMs: req.GetWifiAssocToIpMaxMs(),
+
+		WiFiLinkQuality:       req.GetWifiLinkQuality(),
+		WiFiRSSIAvgDbm:        req.GetWifiRssiAvgDbm(),
+		WiFiRSSITrendDbPerMin: req.GetWifiRssiTrendDbPerMin(),
+		WiFiBeaconLosses:      req.GetWifiBeaconLosses(),
+		WiFiRPCFailures:       req.GetWifiRpcFailures(),
+		WiFiRoamScans:         req.GetWifiRoamScans(),
+		WiFiRoams:             req.GetWifiRoams(),
+		WiFiLastRoamGainDb:    req.GetWifiLastRoamGainDb(),
+		WiFiAwakeS:            req.GetWifiAwakeS(),
+		WiFiPowerSaveS:        req.GetWifiPowerSaveS(),
+		WiFiWakes:             req.GetWifiWakes(),
+		AccessRPCsAwake:       req.GetAccessRpcsAwake(),
+		AccessRPCAwakeAvgMs:   req.GetAccessRpcAwakeAvgMs(),
+		AccessRPCsWoken:       req.GetAccessRpcsWoken(),
+		AccessRPCWokenAvgMs:   req.GetAccessRpcWokenAvgMs(),
+
+		Health: pbconvert.HealthTelemetryFromProto(req.GetHealth()),
 	}
 	if req.DoorClosed != nil {
 		dc := req.GetDoorClosed()
@@ -95,12 +153,7 @@ func (s *Server) SendHeartbeat(ctx context.Context, req *pb.HeartbeatRequest) (*
 	}
 
 	// Convert domain response → protobuf.
-	return &pb.HeartbeatResponse{
-		Ok:         resp.OK,
-		Known:      resp.Known,
-		ModuleId:   resp.ModuleID,
-		ServerTime: resp.ServerTime,
-	}, nil
+	return pbconvert.HeartbeatResponseToProto(resp, req.GetProtocolVersion()), nil
 }
 
 // ─── Access ─────────────────────────────────────────────────────────────────
@@ -112,14 +165,27 @@ func (s *Server) RequestAccess(ctx context.Context, req *pb.AccessRequest) (*pb.
 		CredentialID: req.GetCredentialId(),
 		RequestedAt:  req.GetRequestedAt(),
 		Nonce:        req.GetNonce(),
+		Cached:       req.GetCached(),
+		Filtered:     req.GetFiltered(),
+
+		RequestedAtUS: req.GetRequestedAtUs(),
 	}
 	if req.DoorClosed != nil {
 		dc := req.GetDoorClosed()
 		domainReq.DoorClosed = &dc
 	}
 
-	// Delegate to the service layer.
-	resp, err := s.accessService.Decide(ctx, domainReq)
+	// The module sends its remaining tap budget as grpc-timeout. If that has
+	// already run out, the person at the door has given up and the module
+	// would discard the answer, so do not decide (or audit a grant) at all.
+	if err := ctx.Err(); err != nil {
+		return nil, status.FromContextError(err).Err()
+	}
+
+	// Delegate to the service layer.  Once started, the decision is made
+	// even if the module gives up on this attempt: it is recorded against
+	// the nonce, and the module's retry is answered with it.
+	resp, err := s.accessService.Decide(context.WithoutCancel(ctx), domainReq)
 	if err != nil {
 		switch {
 		case errors.Is(err, service.ErrInvalidModuleID):
@@ -132,16 +198,9 @@ func (s *Server) RequestAccess(ctx context.Context, req *pb.AccessRequest) (*pb.
 		}
 	}
 
-	pbResp := &pb.AccessResponse{
-		Ok:         resp.OK,
-		Known:      resp.Known,
-		Granted:    resp.Granted,
-		Reason:     resp.Reason,
-		ModuleId:   resp.ModuleID,
-		ServerTime: resp.ServerTime,
-	}
+	pbResp := pbconvert.AccessResponseToProto(resp, req.GetProtocolVersion())
 
-	if sig := AccessResponseSig(s.hmacSecret, domainReq.ModuleID, domainReq.CredentialID, resp.Granted); sig != "" {
+	if sig := AccessResponseSig(s.hmacSecret, req.GetProtocolVersion(), pbResp, domainReq.ModuleID, domainReq.CredentialID); sig != "" {
 		grpc.SetTrailer(ctx, metadata.Pairs(hmacHeaderKey, sig))
 	}
 
@@ -118,6 +118,45 @@ func (s *Server) handleAdminDeleteModule(w http.ResponseWriter, r *http.Request)
 	writeJSON(w, http.StatusOK, map[string]any{"ok": true, "module_id": moduleID, "deleted": true})
 }
 
+func (s *Server) handleAdminGetModuleHealth(w http.ResponseWriter, r *http.Request) {
+	moduleID := r.PathValue("module_id")
+	if moduleID == "" {
+		writeError(w, http.StatusBadRequest, "missing_module_id", "module_id path parameter is required")
+		return
+	}
+
+	h, ok := s.heartbeatService.Health(moduleID)
+	if !ok {
+		writeError(w, http.StatusNotFound, "not_found", "no health telemetry from this module")
+		return
+	}
+	writeJSON(w, http.StatusOK, map[string]any{"ok": true, "module_id": moduleID, "health": h})
+}
+
+// handleAdminRequestHealthDump asks the module for every task in its
+// health telemetry. It answers with its next heartbeat; the dump then
+// shows in GET .../health.
+func (s *Server) handleAdminRequestHealthDump(w http.ResponseWriter, r *http.Request) {
+	moduleID := r.PathValue("module_id")
+	if moduleID == "" {
+		writeError(w, http.StatusBadRequest, "missing_module_id", "module_id path parameter is required")
+		return
+	}
+
+	if err := s.heartbeatService.RequestHealthDump(r.Context(), moduleID); err != nil {
+		if errors.Is(err, service.ErrModuleNotFound) {
+			writeError(w, http.StatusNotFound, "not_found", "module not found")
+			return
+		}
+		s.logger.Printf("admin request health dump: %v", err)
+		writeError(w, http.StatusInternalServerError, "internal_error", "failed to request health dump")
+		return
+	}
+
+	s.logger.Printf("admin: requested a health dump from module %q", moduleID)
+	writeJSON(w, http.StatusAccepted, map[string]any{"ok": true, "module_id": moduleID, "dump_pending": true})
+}
+
 // ── Doors ───────────────────────────────────────────────────────────────────
 
 func (s *Server) handleAdminListDoors(w http.ResponseWriter, r *http.Request) {
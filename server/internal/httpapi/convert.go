@@ -16,6 +16,64 @@ func heartbeatRequestFromProto(p *pb.HeartbeatRequest) types.HeartbeatRequest {
 		IP:              p.GetIp(),
 		FreeHeapBytes:   p.GetFreeHeapBytes(),
 		Sequence:        p.GetSequence(),
+		CPUCores:        p.GetCpuCores(),
+		CoreIsolation:   p.GetCoreIsolation(),
+		TaskPlanFaults:  p.GetTaskPlanFaults(),
+		StaleTaps:       p.GetStaleTaps(),
+		RTTP50Ms:        p.GetRttP50Ms(),
+		RTTP90Ms:        p.GetRttP90Ms(),
+		RTTP99Ms:        p.GetRttP99Ms(),
+		RPCTimeoutMs:    p.GetRpcTimeoutMs(),
+		DeadLinks:       p.GetDeadLinks(),
+
+		DecisionCacheHits:          p.GetDecisionCacheHits(),
+		DecisionCacheMisses:        p.GetDecisionCacheMisses(),
+		DecisionCacheEvictions:     p.GetDecisionCacheEvictions(),
+		DecisionCacheInvalidations: p.GetDecisionCacheInvalidations(),
+
+		RevocationFilterVersion:  p.GetRevocationFilterVersion(),
+		RevocationFilterCapacity: p.GetRevocationFilterCapacity(),
+		RevocationFilterDenials:  p.GetRevocationFilterDenials(),
+
+		ClockOffsetUS: p.GetClockOffsetUs(),
+		ClockErrorUS:  p.GetClockErrorUs(),
+		ClockDriftPPB: p.GetClockDriftPpb(),
+
+		StaticOmitted:       p.GetStaticOmitted(),
+		HeartbeatIntervalS:  p.GetHeartbeatIntervalS(),
+		HeartbeatsSkipped:   p.GetHeartbeatsSkipped(),
+		HeartbeatBytesSaved: p.GetHeartbeatBytesSaved(),
+
+		BootConfigMs:    p.GetBootConfigMs(),
+		BootWiFiStartMs: p.GetBootWifiStartMs(),
+		BootIOReadyMs:   p.GetBootIoReadyMs(),
+		BootFSMMs:       p.GetBootFsmMs(),
+		BootIPMs:        p.GetBootIpMs(),
+		BootServerMs:    p.GetBootServerMs(),
+
+		WiFiConnects:       p.GetWifiConnects(),
+		WiFiHintedConnects: p.GetWifiHintedConnects(),
+		WiFiScanFallbacks:  p.GetWifiScanFallbacks(),
+		WiFiAssocToIPMs:    p.GetWifiAssocToIpMs(),
+		WiFiAssocToIPMaxMs: p.GetWifiAssocToIpMaxMs(),
+
+		WiFiLinkQuality:       p.GetWifiLinkQuality(),
+		WiFiRSSIAvgDbm:        p.GetWifiRssiAvgDbm(),
+		WiFiRSSITrendDbPerMin: p.GetWifiRssiTrendDbPerMin(),
+		WiFiBeaconLosses:      p.GetWifiBeaconLosses(),
+		WiFiRPCFailures:       p.GetWifiRpcFailures(),
+		WiFiRoamScans:         p.GetWifiRoamScans(),
+		WiFiRoams:             p.GetWifiRoams(),
+		WiFiLastRoamGainDb:    p.GetWifiLastRoamGainDb(),
+		WiFiAwakeS:            p.GetWifiAwakeS(),
+		WiFiPowerSaveS:        p.GetWifiPowerSaveS(),
+		WiFiWakes:             p.GetWifiWakes(),
+		AccessRPCsAwake:       p.GetAccessRpcsAwake(),
+		AccessRPCAwakeAvgMs:   p.GetAccessRpcAwakeAvgMs(),
+		AccessRPCsWoken:       p.GetAccessRpcsWoken(),
+		AccessRPCWokenAvgMs:   p.GetAccessRpcWokenAvgMs(),
+
+		Health: pbconvert.HealthTelemetryFromProto(p.GetHealth()),
 	}
 
 	if p.DoorClosed != nil {
@@ -30,13 +88,10 @@ func heartbeatRequestFromProto(p *pb.HeartbeatRequest) types.HeartbeatRequest {
 	return req
 }
 
+// heartbeatResponseToProto always uses the version 0 text fields: the HTTP
+// path signs raw bodies, and protocol v2 is a gRPC-only firmware feature.
 func heartbeatResponseToProto(r types.HeartbeatResponse) *pb.HeartbeatResponse {
-	return &pb.HeartbeatResponse{
-		Ok:         r.OK,
-		Known:      r.Known,
-		ModuleId:   r.ModuleID,
-		ServerTime: r.ServerTime,
-	}
+	return pbconvert.HeartbeatResponseToProto(r, 0)
 }
 
 // ── Access ───────────────────────────────────────────────────────────────────
@@ -47,6 +102,10 @@ func accessRequestFromProto(p *pb.AccessRequest) types.AccessRequest {
 		CredentialID: p.GetCredentialId(),
 		RequestedAt:  p.GetRequestedAt(),
 		Nonce:        p.GetNonce(),
+		Cached:       p.GetCached(),
+		Filtered:     p.GetFiltered(),
+
+		RequestedAtUS: p.GetRequestedAtUs(),
 	}
 
 	if p.DoorClosed != nil {
@@ -58,14 +117,7 @@ func accessRequestFromProto(p *pb.AccessRequest) types.AccessRequest {
 }
 
 func accessResponseToProto(r types.AccessResponse) *pb.AccessResponse {
-	return &pb.AccessResponse{
-		Ok:         r.OK,
-		Known:      r.Known,
-		Granted:    r.Granted,
-		Reason:     r.Reason,
-		ModuleId:   r.ModuleID,
-		ServerTime: r.ServerTime,
-	}
+	return pbconvert.AccessResponseToProto(r, 0)
 }
 
 // ── Provision ────────────────────────────────────────────────────────────────
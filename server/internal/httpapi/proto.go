@@ -8,9 +8,10 @@ import (
 )
 
 // maxRequestBody caps the request body size for both protobuf and JSON
-// payloads.  The largest ESP32 message (HeartbeatRequest) encodes to ~142
-// bytes in protobuf and ~250 bytes in JSON, so 4 KiB is generous.
-const maxRequestBody = 4096
+// payloads.  The largest ESP32 message (HeartbeatRequest with a health
+// dump of every task) encodes to at most 1.6 KB in protobuf and about
+// 4 KB in JSON, so 8 KiB leaves room.
+const maxRequestBody = 8192
 
 // isProtobuf returns true if the request's Content-Type indicates a
 // protobuf payload. The ESP32 sends "application/x-protobuf".
@@ -121,6 +121,10 @@ func NewServer(d Dependencies) *Server {
 			requirePermission(permissions.ModuleRevoke, s.handleAdminRevokeModule))
 		mux.HandleFunc("DELETE /admin/v1/modules/{module_id}",
 			requirePermission(permissions.ModuleDelete, s.handleAdminDeleteModule))
+		mux.HandleFunc("GET /admin/v1/modules/{module_id}/health",
+			requirePermission(permissions.ModuleGet, s.handleAdminGetModuleHealth))
+		mux.HandleFunc("POST /admin/v1/modules/{module_id}/health-dump",
+			requirePermission(permissions.ModuleGet, s.handleAdminRequestHealthDump))
 
 		// Doors
 		mux.HandleFunc("GET /admin/v1/doors",
@@ -345,10 +349,17 @@ func (s *Server) handleAccessRequest(w http.ResponseWriter, r *http.Request) {
 		}
 		if s.replayStore != nil {
 			nonceHex := hex.EncodeToString(req.Nonce)
-			if err := s.replayStore.Check(req.ModuleID, nonceHex, req.RequestedAt); err != nil {
+			var err error
+			if req.RequestedAtUS != 0 {
+				err = s.replayStore.CheckMicros(req.ModuleID, nonceHex, req.RequestedAtUS)
+			} else {
+				err = s.replayStore.Check(req.ModuleID, nonceHex, req.RequestedAt)
+			}
+			if err != nil {
 				writeError(w, http.StatusUnauthorized, "replay", err.Error())
 				return
 			}
+			defer s.replayStore.Settle(req.ModuleID, nonceHex, nil)
 		}
 	}
 
@@ -369,6 +380,9 @@ func (s *Server) handleAccessRequest(w http.ResponseWriter, r *http.Request) {
 	}
 
 	if s.hmacSecret != "" {
+		// This signature covers only the decision, so do not offer a cache
+		// TTL that could be raised in transit.
+		resp.CacheTTLS = 0
 		v := 0
 		if resp.Granted {
 			v = 1
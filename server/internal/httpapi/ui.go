@@ -57,6 +57,8 @@ type UIAccessEventInfo struct {
 	ReceivedAt string
 	Granted    bool
 	Reason     string
+	Cached     bool // door opened from the module's decision cache before this decision
+	Filtered   bool // tap already denied by the module's revocation filter
 }
 
 // HasPerm returns true if the given permission is in Role.Permissions.
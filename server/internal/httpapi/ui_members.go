@@ -525,6 +525,8 @@ func accessEventsToUI(recs []store.AccessEventRecord) []UIAccessEventInfo {
 			ReceivedAt: r.ReceivedAt.Format("2006-01-02 15:04:05 UTC"),
 			Granted:    r.Granted,
 			Reason:     r.Reason,
+			Cached:     r.Cached,
+			Filtered:   r.DeniedByFilter,
 		}
 	}
 	return out
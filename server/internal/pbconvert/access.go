@@ -0,0 +1,74 @@
+package pbconvert
+
+import (
+	"strings"
+
+	pb "github.com/BrandonDHaskell/Portunus/server/api/portunus/v1"
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/types"
+	"github.com/BrandonDHaskell/Portunus/server/internal/wiresig"
+)
+
+// AccessReasonToProto maps a decision reason string to its AccessReason
+// code. Codes are named after the strings, so a reason added to the service
+// before the enum maps to UNSPECIFIED and is sent as text instead.
+func AccessReasonToProto(reason string) pb.AccessReason {
+	if reason == "" {
+		return pb.AccessReason_ACCESS_REASON_UNSPECIFIED
+	}
+	return pb.AccessReason(pb.AccessReason_value["ACCESS_REASON_"+strings.ToUpper(reason)])
+}
+
+// AccessResponseToProto converts a decision for a device that speaks
+// protocolVersion. Version 2 devices read reason_code and server_time_us,
+// so the text forms are left out unless the reason has no code. Older
+// devices get no cache_ttl_s: their response signature does not cover it.
+func AccessResponseToProto(r types.AccessResponse, protocolVersion uint32) *pb.AccessResponse {
+	out := &pb.AccessResponse{
+		Ok:            r.OK,
+		Known:         r.Known,
+		Granted:       r.Granted,
+		Reason:        r.Reason,
+		ModuleId:      r.ModuleID,
+		ServerTime:    r.ServerTime,
+		CacheTtlS:     r.CacheTTLS,
+		PolicyVersion: r.PolicyVersion,
+		ReasonCode:    AccessReasonToProto(r.Reason),
+		ServerTimeUs:  r.ServerTimeUS,
+	}
+	if protocolVersion >= wiresig.Version {
+		out.ServerTime = ""
+		if out.ReasonCode != pb.AccessReason_ACCESS_REASON_UNSPECIFIED {
+			out.Reason = ""
+		}
+	} else {
+		out.CacheTtlS = 0
+	}
+	return out
+}
+
+// HeartbeatResponseToProto converts a heartbeat acknowledgement for a device
+// that speaks protocolVersion (see AccessResponseToProto).
+func HeartbeatResponseToProto(r types.HeartbeatResponse, protocolVersion uint32) *pb.HeartbeatResponse {
+	out := &pb.HeartbeatResponse{
+		Ok:            r.OK,
+		Known:         r.Known,
+		ModuleId:      r.ModuleID,
+		ServerTime:    r.ServerTime,
+		ServerTimeUs:  r.ServerTimeUS,
+		PolicyVersion: r.PolicyVersion,
+
+		RevocationFilterVersion:      r.RevocationFilterVersion,
+		RevocationFilterSeed:         r.RevocationFilterSeed,
+		RevocationFilterKey:          r.RevocationFilterKey,
+		RevocationFilterExceptions:   RevocationFilterExceptionsToProto(r.RevocationFilterExceptions),
+		RevocationFilterFingerprints: r.RevocationFilterFingerprints,
+
+		ResendStatic:     r.ResendStatic,
+		HeartbeatDelayMs: r.HeartbeatDelayMS,
+		HealthDump:       r.HealthDump,
+	}
+	if protocolVersion >= wiresig.Version {
+		out.ServerTime = ""
+	}
+	return out
+}
@@ -0,0 +1,48 @@
+package pbconvert
+
+import (
+	"testing"
+
+	pb "github.com/BrandonDHaskell/Portunus/server/api/portunus/v1"
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/types"
+	"github.com/BrandonDHaskell/Portunus/server/internal/wiresig"
+)
+
+// TestAccessReasonToProto_CoversServiceReasons lists every reason
+// AccessService.Decide puts on the wire; each must have a code, or v2
+// modules get the string after all.
+func TestAccessReasonToProto_CoversServiceReasons(t *testing.T) {
+	for _, reason := range []string{
+		"allow_all", "credential_allowed", "denied", "unknown_module",
+		"invalid_credential_format", "credential_not_found",
+		"member_expired", "member_suspended", "member_archived", "member_disabled",
+		"credential_not_authorized", "authorization_revoked", "authorization_expired",
+	} {
+		if AccessReasonToProto(reason) == pb.AccessReason_ACCESS_REASON_UNSPECIFIED {
+			t.Errorf("reason %q has no AccessReason code", reason)
+		}
+	}
+	if got := AccessReasonToProto("brand_new_reason"); got != pb.AccessReason_ACCESS_REASON_UNSPECIFIED {
+		t.Errorf("unknown reason mapped to %v", got)
+	}
+}
+
+func TestAccessResponseToProto_V2DropsTextFields(t *testing.T) {
+	r := types.AccessResponse{
+		OK: true, Known: true, Granted: true, Reason: "credential_allowed",
+		ModuleID: "door-1", ServerTime: "2026-01-01T00:00:00Z", ServerTimeUS: 1767225600000000,
+	}
+	v0 := AccessResponseToProto(r, 0)
+	if v0.Reason == "" || v0.ServerTime == "" || v0.ReasonCode != pb.AccessReason_ACCESS_REASON_CREDENTIAL_ALLOWED {
+		t.Fatalf("version 0 must keep the text fields and add the code: %+v", v0)
+	}
+	v2 := AccessResponseToProto(r, wiresig.Version)
+	if v2.Reason != "" || v2.ServerTime != "" || v2.ServerTimeUs != r.ServerTimeUS {
+		t.Fatalf("version 2 must send codes only: %+v", v2)
+	}
+
+	r.Reason = "brand_new_reason"
+	if v2 := AccessResponseToProto(r, wiresig.Version); v2.Reason != r.Reason {
+		t.Fatalf("a reason without a code must still travel as text: %+v", v2)
+	}
+}
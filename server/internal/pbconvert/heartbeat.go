@@ -0,0 +1,59 @@
+package pbconvert
+
+import (
+	"encoding/binary"
+
+	pb "github.com/BrandonDHaskell/Portunus/server/api/portunus/v1"
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/types"
+)
+
+// RevocationFilterExceptionsToProto packs exception tags the way
+// HeartbeatResponse.revocation_filter_exceptions carries them: 8 bytes each,
+// little-endian, in order.
+func RevocationFilterExceptionsToProto(tags []uint64) []byte {
+	if len(tags) == 0 {
+		return nil
+	}
+	out := make([]byte, 8*len(tags))
+	for i, t := range tags {
+		binary.LittleEndian.PutUint64(out[8*i:], t)
+	}
+	return out
+}
+
+// HealthTelemetryFromProto converts HeartbeatRequest.health; nil when the
+// module sent none.
+func HealthTelemetryFromProto(p *pb.HealthTelemetry) *types.HealthTelemetry {
+	if p == nil {
+		return nil
+	}
+	h := &types.HealthTelemetry{
+		MinFreeHeapBytes:      p.GetMinFreeHeapBytes(),
+		LargestFreeBlockBytes: p.GetLargestFreeBlockBytes(),
+
+		ServerConnects:        p.GetServerConnects(),
+		ServerConnectFailures: p.GetServerConnectFailures(),
+		TLSFailures:           p.GetTlsFailures(),
+		TLSPinMismatches:      p.GetTlsPinMismatches(),
+		TLSHandshakeMs:        p.GetTlsHandshakeMs(),
+
+		TaskCount:    p.GetTaskCount(),
+		IdlePermille: p.GetIdlePermille(),
+		SampleUS:     p.GetSampleUs(),
+		SampleMaxUS:  p.GetSampleMaxUs(),
+		Detailed:     p.GetDetailed(),
+	}
+	if len(p.GetTasks()) > 0 {
+		h.Tasks = make([]types.TaskHealth, 0, len(p.GetTasks()))
+		for _, t := range p.GetTasks() {
+			h.Tasks = append(h.Tasks, types.TaskHealth{
+				Name:           t.GetName(),
+				CPUPermille:    t.GetCpuPermille(),
+				StackFreeBytes: t.GetStackFreeBytes(),
+				Core:           t.GetCore(),
+				Priority:       t.GetPriority(),
+			})
+		}
+	}
+	return h
+}
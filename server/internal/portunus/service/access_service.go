@@ -47,6 +47,9 @@ type AccessService struct {
 	credentialHashSecret []byte
 	logger               *log.Logger
 	audit                auditState
+	cacheTTL             time.Duration
+	policyVersion        *PolicyVersion
+	revocationFilter     *RevocationFilter
 }
 
 func NewAccessService(reg *DeviceRegistry, policy AccessPolicy, es store.AccessEventStore) *AccessService {
@@ -94,6 +97,24 @@ func (s *AccessService) SetCredentialHashSecret(secret []byte) {
 	s.credentialHashSecret = secret
 }
 
+// SetDecisionCache lets modules reuse a grant for ttl without asking again.
+// Grants carry the TTL and every response carries pv's current version;
+// services that withdraw access bump pv so modules drop their caches. A zero
+// ttl tells modules not to cache; that is the service's state until this is
+// called, while the server itself configures PORTUNUS_DECISION_CACHE_TTL_S
+// (default 60 s).
+func (s *AccessService) SetDecisionCache(ttl time.Duration, pv *PolicyVersion) {
+	if ttl < 0 {
+		ttl = 0
+	}
+	s.cacheTTL = ttl
+	s.policyVersion = pv
+}
+
+// SetRevocationFilter makes Decide record each presented credential's filter
+// tag, so revoking its member puts it in the filter modules deny from.
+func (s *AccessService) SetRevocationFilter(f *RevocationFilter) { s.revocationFilter = f }
+
 // Validate returns an error if the service is not fully wired for production use.
 // Call this after all Set* calls and before serving traffic; treat a non-nil return
 // as a fatal configuration error.  AllowAll bypasses the check (dev/test only).
@@ -131,12 +152,13 @@ func (s *AccessService) Decide(ctx context.Context, req types.AccessRequest) (ty
 
 	if !known {
 		resp := types.AccessResponse{
-			OK:         false,
-			Known:      false,
-			Granted:    false,
-			Reason:     "unknown_module",
-			ModuleID:   moduleID,
-			ServerTime: now.Format(time.RFC3339Nano),
+			OK:           false,
+			Known:        false,
+			Granted:      false,
+			Reason:       "unknown_module",
+			ModuleID:     moduleID,
+			ServerTime:   now.Format(time.RFC3339Nano),
+			ServerTimeUS: now.UnixMicro(),
 		}
 
 		s.recordEvent(ctx, req, false, "unknown_module", now)
@@ -158,16 +180,17 @@ func (s *AccessService) Decide(ctx context.Context, req types.AccessRequest) (ty
 		if parseErr != nil {
 			s.recordEvent(ctx, req, false, "invalid_credential_format", now)
 			return types.AccessResponse{
-				OK:         true,
-				Known:      true,
-				Granted:    false,
-				Reason:     "invalid_credential_format",
-				ModuleID:   moduleID,
-				ServerTime: now.Format(time.RFC3339Nano),
+				OK:           true,
+				Known:        true,
+				Granted:      false,
+				Reason:       "invalid_credential_format",
+				ModuleID:     moduleID,
+				ServerTime:   now.Format(time.RFC3339Nano),
+				ServerTimeUS: now.UnixMicro(),
 			}, nil
 		}
 		credHash := HashCredentialID(rawUID, s.credentialHashSecret)
-		g, r, memberUUID, err := s.decideMemberAccess(ctx, credHash, moduleID, now)
+		g, r, memberUUID, err := s.decideMemberAccess(ctx, credHash, s.revocationFilter.Tag(rawUID), moduleID, now)
 		if err != nil {
 			s.recordEvent(ctx, req, false, "member_lookup_error", now)
 			return types.AccessResponse{}, err
@@ -188,14 +211,20 @@ func (s *AccessService) Decide(ctx context.Context, req types.AccessRequest) (ty
 
 	s.recordEvent(ctx, req, granted, reason, now)
 
-	return types.AccessResponse{
-		OK:         true,
-		Known:      true,
-		Granted:    granted,
-		Reason:     reason,
-		ModuleID:   moduleID,
-		ServerTime: now.Format(time.RFC3339Nano),
-	}, nil
+	resp := types.AccessResponse{
+		OK:            true,
+		Known:         true,
+		Granted:       granted,
+		Reason:        reason,
+		ModuleID:      moduleID,
+		ServerTime:    now.Format(time.RFC3339Nano),
+		ServerTimeUS:  now.UnixMicro(),
+		PolicyVersion: s.policyVersion.Current(),
+	}
+	if granted {
+		resp.CacheTTLS = uint32(s.cacheTTL / time.Second)
+	}
+	return resp, nil
 }
 
 // recordEvent persists the access decision to the audit log.
@@ -217,9 +246,15 @@ func (s *AccessService) recordEvent(
 		Granted:    granted,
 		Reason:     reason,
 		DecidedAt:  decidedAt,
+		Cached:     req.Cached,
+
+		DeniedByFilter: req.Filtered,
 	}
 
-	if t := parseOptionalTimestamp(req.RequestedAt); t != nil {
+	if req.RequestedAtUS != 0 {
+		t := time.UnixMicro(req.RequestedAtUS).UTC()
+		rec.RequestedAt = &t
+	} else if t := parseOptionalTimestamp(req.RequestedAt); t != nil {
 		rec.RequestedAt = t
 	}
 
@@ -258,9 +293,11 @@ func (s *AccessService) ListEventsByCredential(ctx context.Context, credentialHa
 
 // decideMemberAccess checks member_access + module_authorizations and returns
 // (granted, reason, memberUUID, error). memberUUID is non-empty only on grant.
+// A non-zero filterTag is stored on the member if it is not already.
 func (s *AccessService) decideMemberAccess(
 	ctx context.Context,
 	credHash []byte,
+	filterTag uint64,
 	moduleID string,
 	now time.Time,
 ) (granted bool, reason string, memberUUID string, err error) {
@@ -272,6 +309,14 @@ func (s *AccessService) decideMemberAccess(
 		return false, "", "", err
 	}
 
+	if filterTag != 0 && member.RevocationTag != filterTag {
+		// Best effort: an untagged member only misses the filter, and is
+		// tagged again on the next presentation.
+		if err := s.memberAccessStore.SetRevocationTag(ctx, member.UUID, filterTag); err != nil && s.logger != nil {
+			s.logger.Printf("WARN revocation tag for member %s: %v", member.UUID, err)
+		}
+	}
+
 	if member.Status != store.MemberStatusActive {
 		return false, "member_" + string(member.Status), "", nil
 	}
@@ -3,6 +3,7 @@ package service_test
 import (
 	"context"
 	"testing"
+	"time"
 
 	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/service"
 	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/store/memory"
@@ -306,3 +307,91 @@ func TestDecide_MissingCredentialID_NoEventRecorded(t *testing.T) {
 		t.Error("expected no event for validation failure")
 	}
 }
+
+// ── Decision cache ───────────────────────────────────────────────────────────
+
+func TestDecide_Grant_CarriesCacheTTLAndPolicyVersion(t *testing.T) {
+	svc, _ := newTestAccessService([]string{"door-001"}, service.AccessPolicy{AllowAll: true})
+	pv := service.NewPolicyVersion()
+	svc.SetDecisionCache(45*time.Second, pv)
+
+	resp, err := svc.Decide(context.Background(), types.AccessRequest{
+		ModuleID:     "door-001",
+		CredentialID: "AABBCCDD",
+	})
+	if err != nil {
+		t.Fatalf("Decide: %v", err)
+	}
+	if resp.CacheTTLS != 45 {
+		t.Errorf("cache_ttl_s = %d, want 45", resp.CacheTTLS)
+	}
+	if resp.PolicyVersion == 0 || resp.PolicyVersion != pv.Current() {
+		t.Errorf("policy_version = %d, want %d", resp.PolicyVersion, pv.Current())
+	}
+}
+
+func TestDecide_Deny_NeverCarriesCacheTTL(t *testing.T) {
+	svc, _ := newTestAccessService([]string{"door-001"}, service.AccessPolicy{AllowAll: true})
+	svc.SetDecisionCache(45*time.Second, service.NewPolicyVersion())
+
+	resp, err := svc.Decide(context.Background(), types.AccessRequest{
+		ModuleID:     "door-unknown",
+		CredentialID: "AABBCCDD",
+	})
+	if err != nil {
+		t.Fatalf("Decide: %v", err)
+	}
+	if resp.Granted {
+		t.Fatal("expected deny for unknown module")
+	}
+	if resp.CacheTTLS != 0 {
+		t.Errorf("cache_ttl_s = %d on a deny, want 0", resp.CacheTTLS)
+	}
+}
+
+func TestDecide_CacheDisabledByDefault(t *testing.T) {
+	svc, _ := newTestAccessService([]string{"door-001"}, service.AccessPolicy{AllowAll: true})
+
+	resp, err := svc.Decide(context.Background(), types.AccessRequest{
+		ModuleID:     "door-001",
+		CredentialID: "AABBCCDD",
+	})
+	if err != nil {
+		t.Fatalf("Decide: %v", err)
+	}
+	if resp.CacheTTLS != 0 || resp.PolicyVersion != 0 {
+		t.Errorf("got cache_ttl_s=%d policy_version=%d without SetDecisionCache, want 0/0",
+			resp.CacheTTLS, resp.PolicyVersion)
+	}
+}
+
+func TestDecide_CachedReport_RecordedAsServedFromCache(t *testing.T) {
+	svc, es := newTestAccessService([]string{"door-001"}, service.AccessPolicy{AllowAll: true})
+
+	if _, err := svc.Decide(context.Background(), types.AccessRequest{
+		ModuleID:     "door-001",
+		CredentialID: "AABBCCDD",
+		Cached:       true,
+	}); err != nil {
+		t.Fatalf("Decide: %v", err)
+	}
+	events := es.Events()
+	if len(events) != 1 || !events[0].Cached {
+		t.Fatalf("expected one event marked cached, got %+v", events)
+	}
+}
+
+func TestPolicyVersion_BumpChangesVersion(t *testing.T) {
+	pv := service.NewPolicyVersion()
+	before := pv.Current()
+	pv.Bump()
+	if pv.Current() == before {
+		t.Error("Bump did not change the version")
+	}
+
+	var unset *service.PolicyVersion
+	unset.Bump() // must not panic
+	if unset.Current() != 0 {
+		t.Errorf("nil PolicyVersion reports %d, want 0", unset.Current())
+	}
+}
@@ -22,6 +22,7 @@ type ExpiryWorker struct {
 	interval       time.Duration
 	pendingTTLDays int
 	logger         *log.Logger
+	policyVersion  *PolicyVersion // may be nil; bumped when a sweep expires anyone
 	cancel         context.CancelFunc
 	done           chan struct{}
 }
@@ -56,6 +57,10 @@ func NewExpiryWorker(s store.MemberAccessStore, audit store.AuditStore, cfg Expi
 	}
 }
 
+// SetPolicyVersion wires the version modules use to invalidate cached grants.
+// Call before Start.
+func (w *ExpiryWorker) SetPolicyVersion(pv *PolicyVersion) { w.policyVersion = pv }
+
 // Start begins the background expiry loop. Runs an immediate sweep on startup,
 // then repeats on the configured interval. The loop exits when ctx is cancelled
 // or Stop is called.
@@ -99,6 +104,7 @@ func (w *ExpiryWorker) sweep(ctx context.Context) {
 		w.logger.Printf("expiry worker: hard-deadline sweep error: %v", err)
 	} else if n > 0 {
 		w.logger.Printf("expiry worker: expired %d member(s) by hard deadline", n)
+		w.policyVersion.Bump()
 	}
 
 	n, err = w.store.ExpireByInactivity(ctx, now)
@@ -106,6 +112,7 @@ func (w *ExpiryWorker) sweep(ctx context.Context) {
 		w.logger.Printf("expiry worker: inactivity sweep error: %v", err)
 	} else if n > 0 {
 		w.logger.Printf("expiry worker: expired %d member(s) by inactivity", n)
+		w.policyVersion.Bump()
 	}
 
 	if w.pendingTTLDays == 0 {
@@ -0,0 +1,59 @@
+package service
+
+import (
+	"sync"
+	"time"
+)
+
+// maxHeartbeatDelay bounds one push-back; firmware also caps it at its own
+// longest heartbeat interval.
+const maxHeartbeatDelay = 10 * time.Minute
+
+// HeartbeatPacing spreads heartbeats that arrive in step. After a power cut
+// every module in a building boots, connects and heartbeats together, and
+// keeps doing so every interval. HeartbeatPacing gives each heartbeat the
+// next slot on a timeline that advances 1/rate per heartbeat (virtual
+// scheduling, as in GCRA). While heartbeats come no faster than the rate,
+// slots stay within the burst allowance of now and nothing changes. When a
+// crowd arrives, the slots run ahead of now; each heartbeat is answered with
+// how far ahead its slot is (HeartbeatResponse.heartbeat_delay_ms) and its
+// module pushes its next heartbeat back by that much. The crowd is spread
+// over the following round at the configured rate.
+type HeartbeatPacing struct {
+	mu    sync.Mutex
+	step  time.Duration
+	burst time.Duration
+	next  time.Time
+}
+
+// NewHeartbeatPacing paces heartbeats to ratePerSecond, letting burst's worth
+// of them through at once. A rate of 0 or less disables pacing (nil).
+func NewHeartbeatPacing(ratePerSecond int, burst time.Duration) *HeartbeatPacing {
+	if ratePerSecond <= 0 {
+		return nil
+	}
+	return &HeartbeatPacing{step: time.Second / time.Duration(ratePerSecond), burst: burst}
+}
+
+// Delay takes a slot for a heartbeat received at now and returns how long its
+// module should hold back the next one (0 if it is within the rate).
+func (p *HeartbeatPacing) Delay(now time.Time) time.Duration {
+	if p == nil {
+		return 0
+	}
+	p.mu.Lock()
+	defer p.mu.Unlock()
+
+	if p.next.Before(now) {
+		p.next = now
+	}
+	ahead := p.next.Sub(now)
+	p.next = p.next.Add(p.step)
+	if ahead <= p.burst {
+		return 0
+	}
+	if ahead > maxHeartbeatDelay {
+		return maxHeartbeatDelay
+	}
+	return ahead
+}
@@ -0,0 +1,71 @@
+package service_test
+
+import (
+	"context"
+	"testing"
+	"time"
+
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/service"
+)
+
+func TestHeartbeatPacing_SteadyFleetIsNotDelayed(t *testing.T) {
+	p := service.NewHeartbeatPacing(100, time.Second)
+	now := time.Unix(1_700_000_000, 0)
+	for i := 0; i < 1000; i++ {
+		if d := p.Delay(now); d != 0 {
+			t.Fatalf("heartbeat %d at the configured rate delayed by %v", i, d)
+		}
+		now = now.Add(10 * time.Millisecond)
+	}
+}
+
+func TestHeartbeatPacing_SpreadsABurst(t *testing.T) {
+	// 2000 modules heartbeat in the same instant after a power cut.
+	p := service.NewHeartbeatPacing(100, time.Second)
+	now := time.Unix(1_700_000_000, 0)
+	var delayed int
+	var last time.Duration
+	for i := 0; i < 2000; i++ {
+		d := p.Delay(now)
+		if d < last {
+			t.Fatalf("heartbeat %d delayed %v, less than the one before (%v)", i, d, last)
+		}
+		if d > 0 {
+			delayed++
+		}
+		last = d
+	}
+	if delayed != 2000-101 {
+		t.Errorf("delayed %d heartbeats, want all but the first second's worth (1899)", delayed)
+	}
+	if last != 19990*time.Millisecond {
+		t.Errorf("last heartbeat delayed %v, want 19.99s (2000 at 100/s)", last)
+	}
+}
+
+func TestHeartbeatPacing_DisabledIsNil(t *testing.T) {
+	p := service.NewHeartbeatPacing(0, time.Second)
+	if p != nil {
+		t.Fatal("rate 0 should disable pacing")
+	}
+	if d := p.Delay(time.Now()); d != 0 {
+		t.Errorf("nil pacing delayed by %v", d)
+	}
+}
+
+func TestHeartbeatService_ReportsPacingDelay(t *testing.T) {
+	ctx := context.Background()
+	svc, _ := newHeartbeatServiceFixture("door-1")
+	svc.SetPacing(service.NewHeartbeatPacing(1, 0))
+	req := fullHeartbeat("door-1")
+	if resp, err := svc.Record(ctx, req); err != nil || resp.HeartbeatDelayMS != 0 {
+		t.Fatalf("first heartbeat: delay %d, err %v", resp.HeartbeatDelayMS, err)
+	}
+	resp, err := svc.Record(ctx, req)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if resp.HeartbeatDelayMS < 900 || resp.HeartbeatDelayMS > 1000 {
+		t.Errorf("second heartbeat within a second at 1/s: delay %d ms, want ~1000", resp.HeartbeatDelayMS)
+	}
+}
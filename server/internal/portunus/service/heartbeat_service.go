@@ -4,6 +4,7 @@ import (
 	"context"
 	"errors"
 	"strings"
+	"sync"
 	"time"
 
 	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/store"
@@ -17,12 +18,66 @@ var (
 type HeartbeatService struct {
 	heartbeatStore store.HeartbeatStore
 	registry       *DeviceRegistry
+	policyVersion  *PolicyVersion
+	filter         *RevocationFilter
+	pacing         *HeartbeatPacing
+
+	// Static fields from each module's last full heartbeat, for the
+	// heartbeats that omit them (static_omitted).
+	staticMu sync.Mutex
+	statics  map[string]heartbeatStatics
+
+	// Each module's boot timeline, from the heartbeats that carry it.
+	boots map[string]bootTimeline
+
+	// Each module's last health telemetry and last dump, and the modules
+	// asked for a dump that has not arrived yet.
+	health      map[string]types.ModuleHealth
+	healthDumps map[string]struct{}
+}
+
+// heartbeatStatics are the HeartbeatRequest fields a module leaves out
+// once the server has them.
+type heartbeatStatics struct {
+	FirmwareVersion          string
+	IP                       string
+	CPUCores                 uint32
+	CoreIsolation            bool
+	TaskPlanFaults           uint32
+	RevocationFilterCapacity uint32
+}
+
+// bootTimeline is the HeartbeatRequest boot_*_ms fields. A module sends
+// them only until the server has answered a heartbeat with all of them.
+type bootTimeline struct {
+	ConfigMs, WiFiStartMs, IOReadyMs, FSMMs, IPMs, ServerMs uint32
 }
 
 func NewHeartbeatService(hs store.HeartbeatStore, reg *DeviceRegistry) *HeartbeatService {
-	return &HeartbeatService{heartbeatStore: hs, registry: reg}
+	return &HeartbeatService{
+		heartbeatStore: hs,
+		registry:       reg,
+		statics:        make(map[string]heartbeatStatics),
+		boots:          make(map[string]bootTimeline),
+		health:         make(map[string]types.ModuleHealth),
+		healthDumps:    make(map[string]struct{}),
+	}
 }
 
+// SetPolicyVersion makes heartbeat responses carry the access policy version,
+// so an idle module learns of a revocation within one heartbeat interval
+// and drops any cached grants.
+func (s *HeartbeatService) SetPolicyVersion(pv *PolicyVersion) { s.policyVersion = pv }
+
+// SetRevocationFilter makes heartbeat responses carry the revocation filter.
+// Every response names the current version; the filter itself is attached
+// only when the module holds a different one and has room for it.
+func (s *HeartbeatService) SetRevocationFilter(f *RevocationFilter) { s.filter = f }
+
+// SetPacing makes heartbeat responses carry heartbeat_delay_ms while
+// heartbeats arrive faster than p allows. nil disables it.
+func (s *HeartbeatService) SetPacing(p *HeartbeatPacing) { s.pacing = p }
+
 func (s *HeartbeatService) Record(ctx context.Context, req types.HeartbeatRequest) (types.HeartbeatResponse, error) {
 	moduleID := strings.TrimSpace(req.ModuleID)
 	if moduleID == "" {
@@ -35,19 +90,181 @@ func (s *HeartbeatService) Record(ctx context.Context, req types.HeartbeatReques
 	}
 	_ = s.registry.NoteSeen(ctx, moduleID, known)
 
+	// Only registered modules get per-module state (statics, boot timeline,
+	// health): those maps are never pruned, so an unknown id must not leave
+	// an entry behind. An unknown
+	// module's delta heartbeat is stored as sent and asked for the statics.
+	resendStatic := req.StaticOmitted
+	if known {
+		resendStatic = !s.mergeStatics(moduleID, &req)
+		s.mergeBoot(moduleID, &req)
+	}
+
 	rec := store.HeartbeatRecord{
 		ReceivedAt: time.Now().UTC(),
 		Request:    req,
 	}
+	healthDump := known && s.noteHealth(moduleID, req.Health, rec.ReceivedAt)
 
 	if err := s.heartbeatStore.UpsertHeartbeat(ctx, moduleID, rec); err != nil {
 		return types.HeartbeatResponse{}, err
 	}
 
-	return types.HeartbeatResponse{
-		OK:         true,
-		Known:      known,
-		ModuleID:   moduleID,
-		ServerTime: time.Now().UTC().Format(time.RFC3339Nano),
-	}, nil
+	now := time.Now().UTC()
+	resp := types.HeartbeatResponse{
+		OK:            true,
+		Known:         known,
+		ModuleID:      moduleID,
+		ServerTime:    now.Format(time.RFC3339Nano),
+		ServerTimeUS:  now.UnixMicro(),
+		PolicyVersion: s.policyVersion.Current(),
+		ResendStatic:  resendStatic,
+		HealthDump:    healthDump,
+
+		HeartbeatDelayMS: uint32(s.pacing.Delay(now) / time.Millisecond),
+	}
+	if known {
+		s.attachRevocationFilter(ctx, req, &resp)
+	}
+	return resp, nil
+}
+
+// mergeStatics remembers the static fields of a full heartbeat, or fills
+// them into one that omitted them. It returns false if req omitted them and
+// none are held for the module; req then goes on with them empty, which the
+// store leaves out of the module snapshot.
+func (s *HeartbeatService) mergeStatics(moduleID string, req *types.HeartbeatRequest) bool {
+	s.staticMu.Lock()
+	defer s.staticMu.Unlock()
+
+	if !req.StaticOmitted {
+		s.statics[moduleID] = heartbeatStatics{
+			FirmwareVersion:          req.FirmwareVersion,
+			IP:                       req.IP,
+			CPUCores:                 req.CPUCores,
+			CoreIsolation:            req.CoreIsolation,
+			TaskPlanFaults:           req.TaskPlanFaults,
+			RevocationFilterCapacity: req.RevocationFilterCapacity,
+		}
+		return true
+	}
+	st, ok := s.statics[moduleID]
+	if !ok {
+		return false
+	}
+	req.FirmwareVersion = st.FirmwareVersion
+	req.IP = st.IP
+	req.CPUCores = st.CPUCores
+	req.CoreIsolation = st.CoreIsolation
+	req.TaskPlanFaults = st.TaskPlanFaults
+	req.RevocationFilterCapacity = st.RevocationFilterCapacity
+	return true
+}
+
+// mergeBoot remembers the boot timeline of a heartbeat that carries one
+// (boot_config_ms is the first phase, so always set when any is), or fills
+// the last one into a heartbeat that does not.
+func (s *HeartbeatService) mergeBoot(moduleID string, req *types.HeartbeatRequest) {
+	s.staticMu.Lock()
+	defer s.staticMu.Unlock()
+
+	if req.BootConfigMs != 0 {
+		s.boots[moduleID] = bootTimeline{
+			ConfigMs:    req.BootConfigMs,
+			WiFiStartMs: req.BootWiFiStartMs,
+			IOReadyMs:   req.BootIOReadyMs,
+			FSMMs:       req.BootFSMMs,
+			IPMs:        req.BootIPMs,
+			ServerMs:    req.BootServerMs,
+		}
+		return
+	}
+	b, ok := s.boots[moduleID]
+	if !ok {
+		return
+	}
+	req.BootConfigMs = b.ConfigMs
+	req.BootWiFiStartMs = b.WiFiStartMs
+	req.BootIOReadyMs = b.IOReadyMs
+	req.BootFSMMs = b.FSMMs
+	req.BootIPMs = b.IPMs
+	req.BootServerMs = b.ServerMs
+}
+
+// RequestHealthDump asks a module for every task in its health telemetry.
+// Its heartbeat responses carry health_dump until a detailed report
+// arrives; the module answers with its next heartbeat, not its next tick.
+func (s *HeartbeatService) RequestHealthDump(ctx context.Context, moduleID string) error {
+	moduleID = strings.TrimSpace(moduleID)
+	if moduleID == "" {
+		return ErrInvalidModuleID
+	}
+	known, err := s.registry.IsKnown(ctx, moduleID)
+	if err != nil {
+		return err
+	}
+	if !known {
+		return ErrModuleNotFound
+	}
+
+	s.staticMu.Lock()
+	defer s.staticMu.Unlock()
+	s.healthDumps[moduleID] = struct{}{}
+	return nil
+}
+
+// Health returns a module's last health telemetry and last dump, as held
+// in memory since the server started. ok is false if it has sent neither
+// and no dump is pending.
+func (s *HeartbeatService) Health(moduleID string) (h types.ModuleHealth, ok bool) {
+	moduleID = strings.TrimSpace(moduleID)
+
+	s.staticMu.Lock()
+	defer s.staticMu.Unlock()
+	h, ok = s.health[moduleID]
+	if _, pending := s.healthDumps[moduleID]; pending {
+		h.DumpPending, ok = true, true
+	}
+	return h, ok
+}
+
+// noteHealth keeps the health telemetry of a heartbeat, closes a pending
+// dump if it is the detailed one, and returns whether a dump is still
+// wanted.
+func (s *HeartbeatService) noteHealth(moduleID string, h *types.HealthTelemetry, at time.Time) bool {
+	s.staticMu.Lock()
+	defer s.staticMu.Unlock()
+
+	if h != nil {
+		mh := s.health[moduleID]
+		mh.ReceivedAt, mh.Health = at.Format(time.RFC3339), h
+		if h.Detailed {
+			mh.DumpReceivedAt, mh.Dump = mh.ReceivedAt, h
+			delete(s.healthDumps, moduleID)
+		}
+		s.health[moduleID] = mh
+	}
+	_, pending := s.healthDumps[moduleID]
+	return pending
+}
+
+func (s *HeartbeatService) attachRevocationFilter(ctx context.Context, req types.HeartbeatRequest, resp *types.HeartbeatResponse) {
+	snap, err := s.filter.Current(ctx)
+	if err != nil || snap.Version == 0 {
+		// Version 0 tells the module to drop any filter it holds.
+		return
+	}
+	if uint32(len(snap.Fingerprints)) > req.RevocationFilterCapacity {
+		// Too big for this module: it keeps asking the server, which is
+		// always correct. Withhold the version too, so it drops a stale copy.
+		return
+	}
+	resp.RevocationFilterVersion = snap.Version
+	if req.RevocationFilterVersion == snap.Version {
+		return
+	}
+	resp.RevocationFilterSeed = snap.Seed
+	resp.RevocationFilterKey = snap.Key
+	resp.RevocationFilterFingerprints = snap.Fingerprints
+	resp.RevocationFilterExceptions = snap.Exceptions
 }
@@ -0,0 +1,284 @@
+package service_test
+
+import (
+	"context"
+	"sync"
+	"testing"
+	"time"
+
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/service"
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/store"
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/store/memory"
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/types"
+)
+
+// recordingHeartbeatStore keeps the last record stored per module.
+type recordingHeartbeatStore struct {
+	mu   sync.Mutex
+	last map[string]store.HeartbeatRecord
+}
+
+func (s *recordingHeartbeatStore) UpsertHeartbeat(_ context.Context, moduleID string, rec store.HeartbeatRecord) error {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+	s.last[moduleID] = rec
+	return nil
+}
+
+func (s *recordingHeartbeatStore) PruneOlderThan(context.Context, time.Time) (int64, error) {
+	return 0, nil
+}
+
+func newHeartbeatServiceFixture(moduleID string) (*service.HeartbeatService, *recordingHeartbeatStore) {
+	hs := &recordingHeartbeatStore{last: make(map[string]store.HeartbeatRecord)}
+	reg := service.NewDeviceRegistry(memory.NewDeviceStore([]string{moduleID}))
+	return service.NewHeartbeatService(hs, reg), hs
+}
+
+func fullHeartbeat(moduleID string) types.HeartbeatRequest {
+	return types.HeartbeatRequest{
+		ModuleID:                 moduleID,
+		FirmwareVersion:          "1.4.0",
+		IP:                       "10.0.0.17",
+		CPUCores:                 2,
+		CoreIsolation:            true,
+		RevocationFilterCapacity: 4096,
+		Sequence:                 1,
+	}
+}
+
+func TestHeartbeat_StaticOmittedIsFilledFromLastFull(t *testing.T) {
+	ctx := context.Background()
+	svc, hs := newHeartbeatServiceFixture("module-a")
+
+	resp, err := svc.Record(ctx, fullHeartbeat("module-a"))
+	if err != nil {
+		t.Fatalf("Record full: %v", err)
+	}
+	if resp.ResendStatic {
+		t.Fatal("full heartbeat answered with resend_static")
+	}
+
+	delta := types.HeartbeatRequest{ModuleID: "module-a", StaticOmitted: true, Sequence: 7, HeartbeatsSkipped: 5}
+	resp, err = svc.Record(ctx, delta)
+	if err != nil {
+		t.Fatalf("Record delta: %v", err)
+	}
+	if resp.ResendStatic {
+		t.Fatal("delta heartbeat answered with resend_static although statics are held")
+	}
+
+	got := hs.last["module-a"].Request
+	if got.FirmwareVersion != "1.4.0" || got.IP != "10.0.0.17" || got.CPUCores != 2 ||
+		!got.CoreIsolation || got.RevocationFilterCapacity != 4096 {
+		t.Errorf("static fields not merged: %+v", got)
+	}
+	if got.Sequence != 7 || got.HeartbeatsSkipped != 5 {
+		t.Errorf("dynamic fields overwritten: %+v", got)
+	}
+}
+
+func TestHeartbeat_StaticOmittedWithoutHistoryAsksForResend(t *testing.T) {
+	ctx := context.Background()
+	svc, hs := newHeartbeatServiceFixture("module-a")
+
+	resp, err := svc.Record(ctx, types.HeartbeatRequest{ModuleID: "module-a", StaticOmitted: true})
+	if err != nil {
+		t.Fatalf("Record: %v", err)
+	}
+	if !resp.ResendStatic {
+		t.Fatal("expected resend_static for a delta heartbeat with no statics held")
+	}
+	if got := hs.last["module-a"].Request; got.IP != "" || got.FirmwareVersion != "" {
+		t.Errorf("statics invented for an unknown module: %+v", got)
+	}
+
+	// The full heartbeat the module sends in reply satisfies the server.
+	resp, err = svc.Record(ctx, fullHeartbeat("module-a"))
+	if err != nil {
+		t.Fatalf("Record full: %v", err)
+	}
+	if resp.ResendStatic {
+		t.Fatal("resend_static repeated after a full heartbeat")
+	}
+}
+
+func TestHeartbeat_StaticsAreKeptPerModule(t *testing.T) {
+	ctx := context.Background()
+	svc, _ := newHeartbeatServiceFixture("module-a")
+
+	if _, err := svc.Record(ctx, fullHeartbeat("module-a")); err != nil {
+		t.Fatalf("Record: %v", err)
+	}
+	resp, err := svc.Record(ctx, types.HeartbeatRequest{ModuleID: "module-b", StaticOmitted: true})
+	if err != nil {
+		t.Fatalf("Record: %v", err)
+	}
+	if !resp.ResendStatic {
+		t.Fatal("module-b was answered from module-a's statics")
+	}
+}
+
+func TestHeartbeat_UnknownModuleLeavesNoStatics(t *testing.T) {
+	ctx := context.Background()
+	svc, hs := newHeartbeatServiceFixture("module-a")
+
+	full := fullHeartbeat("module-x")
+	full.BootConfigMs = 310
+	if _, err := svc.Record(ctx, full); err != nil {
+		t.Fatalf("Record full: %v", err)
+	}
+	resp, err := svc.Record(ctx, types.HeartbeatRequest{ModuleID: "module-x", StaticOmitted: true})
+	if err != nil {
+		t.Fatalf("Record delta: %v", err)
+	}
+	if !resp.ResendStatic {
+		t.Error("statics were kept for an unregistered module")
+	}
+	if got := hs.last["module-x"].Request; got.IP != "" || got.BootConfigMs != 0 {
+		t.Errorf("unregistered module's delta filled in: %+v", got)
+	}
+}
+
+func TestHeartbeat_BootTimelineIsKeptAfterTheModuleStopsSendingIt(t *testing.T) {
+	ctx := context.Background()
+	svc, hs := newHeartbeatServiceFixture("module-a")
+
+	first := fullHeartbeat("module-a")
+	first.BootConfigMs = 310
+	first.BootWiFiStartMs = 420
+	first.BootIOReadyMs = 480
+	first.BootFSMMs = 495
+	first.BootIPMs = 2150
+	first.BootServerMs = 2390
+	if _, err := svc.Record(ctx, first); err != nil {
+		t.Fatalf("Record first: %v", err)
+	}
+	if got := hs.last["module-a"].Request.BootReadyMs(); got != 2390 {
+		t.Errorf("BootReadyMs = %d, want 2390 (server connection after FSM start)", got)
+	}
+
+	later := types.HeartbeatRequest{ModuleID: "module-a", StaticOmitted: true, Sequence: 9}
+	if _, err := svc.Record(ctx, later); err != nil {
+		t.Fatalf("Record later: %v", err)
+	}
+	got := hs.last["module-a"].Request
+	if got.BootConfigMs != 310 || got.BootIOReadyMs != 480 || got.BootIPMs != 2150 || got.BootServerMs != 2390 {
+		t.Errorf("boot timeline not carried over: %+v", got)
+	}
+
+	// A reboot sends a new timeline, which replaces the old one.
+	reboot := fullHeartbeat("module-a")
+	reboot.BootConfigMs = 305
+	reboot.BootFSMMs = 490
+	if _, err := svc.Record(ctx, reboot); err != nil {
+		t.Fatalf("Record reboot: %v", err)
+	}
+	got = hs.last["module-a"].Request
+	if got.BootIPMs != 0 || got.BootReadyMs() != 0 {
+		t.Errorf("old boot timeline leaked into a new boot: %+v", got)
+	}
+}
+
+func TestHeartbeat_HealthDumpIsAskedForUntilADetailedReportArrives(t *testing.T) {
+	ctx := context.Background()
+	svc, _ := newHeartbeatServiceFixture("module-a")
+
+	if err := svc.RequestHealthDump(ctx, "module-z"); err != service.ErrModuleNotFound {
+		t.Fatalf("RequestHealthDump(unknown) = %v, want ErrModuleNotFound", err)
+	}
+	if err := svc.RequestHealthDump(ctx, "module-a"); err != nil {
+		t.Fatalf("RequestHealthDump: %v", err)
+	}
+	if h, ok := svc.Health("module-a"); !ok || !h.DumpPending {
+		t.Fatalf("Health before any report = %+v, %v; want a pending dump", h, ok)
+	}
+
+	// A compact report does not close the request.
+	hb := fullHeartbeat("module-a")
+	hb.Health = &types.HealthTelemetry{
+		MinFreeHeapBytes: 61000,
+		TaskCount:        18,
+		Tasks:            []types.TaskHealth{{Name: "server_comm", StackFreeBytes: 412}},
+	}
+	resp, err := svc.Record(ctx, hb)
+	if err != nil {
+		t.Fatalf("Record compact: %v", err)
+	}
+	if !resp.HealthDump {
+		t.Fatal("dump no longer asked for after a compact report")
+	}
+
+	hb.Health = &types.HealthTelemetry{Detailed: true, TaskCount: 18, Tasks: make([]types.TaskHealth, 18)}
+	if resp, err = svc.Record(ctx, hb); err != nil {
+		t.Fatalf("Record detailed: %v", err)
+	}
+	if resp.HealthDump {
+		t.Error("dump still asked for in the answer to the detailed report")
+	}
+	hb.Health = &types.HealthTelemetry{TaskCount: 18}
+	if resp, err = svc.Record(ctx, hb); err != nil {
+		t.Fatalf("Record after dump: %v", err)
+	}
+	if resp.HealthDump {
+		t.Error("dump asked for again after it arrived")
+	}
+
+	h, ok := svc.Health("module-a")
+	if !ok || h.DumpPending {
+		t.Fatalf("Health = %+v, %v; want no pending dump", h, ok)
+	}
+	if h.Dump == nil || len(h.Dump.Tasks) != 18 {
+		t.Errorf("dump not kept: %+v", h.Dump)
+	}
+	if h.Health == nil || h.Health.Detailed {
+		t.Errorf("last report should be the compact one after the dump: %+v", h.Health)
+	}
+}
+
+func TestHeartbeat_HealthIsKeptPerModule(t *testing.T) {
+	ctx := context.Background()
+	svc, _ := newHeartbeatServiceFixture("module-a")
+
+	if _, ok := svc.Health("module-a"); ok {
+		t.Fatal("Health before any heartbeat should report none")
+	}
+	hb := fullHeartbeat("module-a")
+	if _, err := svc.Record(ctx, hb); err != nil {
+		t.Fatalf("Record: %v", err)
+	}
+	if _, ok := svc.Health("module-a"); ok {
+		t.Error("a heartbeat without health telemetry should not create any")
+	}
+
+	hb.Health = &types.HealthTelemetry{LargestFreeBlockBytes: 30000}
+	if _, err := svc.Record(ctx, hb); err != nil {
+		t.Fatalf("Record: %v", err)
+	}
+	// Firmware that stops sending it keeps the last report.
+	hb.Health = nil
+	if _, err := svc.Record(ctx, hb); err != nil {
+		t.Fatalf("Record: %v", err)
+	}
+	h, ok := svc.Health("module-a")
+	if !ok || h.Health == nil || h.Health.LargestFreeBlockBytes != 30000 || h.ReceivedAt == "" {
+		t.Errorf("Health = %+v, %v", h, ok)
+	}
+	if h.Dump != nil || h.DumpPending {
+		t.Errorf("no dump was asked for: %+v", h)
+	}
+}
+
+func TestHeartbeat_UnknownModuleLeavesNoHealth(t *testing.T) {
+	ctx := context.Background()
+	svc, _ := newHeartbeatServiceFixture("module-a")
+
+	hb := fullHeartbeat("module-x")
+	hb.Health = &types.HealthTelemetry{LargestFreeBlockBytes: 30000, Detailed: true}
+	if _, err := svc.Record(ctx, hb); err != nil {
+		t.Fatalf("Record: %v", err)
+	}
+	if h, ok := svc.Health("module-x"); ok {
+		t.Errorf("health kept for an unregistered module: %+v", h)
+	}
+}
@@ -24,13 +24,17 @@ var (
 )
 
 type MemberAccessService struct {
-	memberStore store.MemberAccessStore
+	memberStore   store.MemberAccessStore
+	policyVersion *PolicyVersion // may be nil; bumped when access may have been withdrawn
 }
 
 func NewMemberAccessService(ms store.MemberAccessStore) *MemberAccessService {
 	return &MemberAccessService{memberStore: ms}
 }
 
+// SetPolicyVersion wires the version modules use to invalidate cached grants.
+func (s *MemberAccessService) SetPolicyVersion(pv *PolicyVersion) { s.policyVersion = pv }
+
 // ProvisionMember creates a new member_access record with a fresh v4 UUID.
 // createdByUUID may be empty for system-initiated provisioning.
 func (s *MemberAccessService) ProvisionMember(
@@ -120,6 +124,7 @@ func (s *MemberAccessService) Disable(ctx context.Context, memberUUID string) er
 		}
 		return fmt.Errorf("disable member: %w", err)
 	}
+	s.policyVersion.Bump()
 	return nil
 }
 
@@ -134,6 +139,9 @@ func (s *MemberAccessService) Enable(ctx context.Context, memberUUID string) err
 		}
 		return fmt.Errorf("enable member: %w", err)
 	}
+	// Re-enabling cannot stale a cached grant, but it must take the member
+	// out of the revocation filter modules deny from.
+	s.policyVersion.Bump()
 	return nil
 }
 
@@ -148,6 +156,7 @@ func (s *MemberAccessService) Archive(ctx context.Context, memberUUID, archivedB
 		}
 		return fmt.Errorf("archive member: %w", err)
 	}
+	s.policyVersion.Bump()
 	return nil
 }
 
@@ -162,6 +171,7 @@ func (s *MemberAccessService) SetProvisioningStatus(ctx context.Context, memberU
 		}
 		return fmt.Errorf("set provisioning status: %w", err)
 	}
+	s.policyVersion.Bump()
 	return nil
 }
 
@@ -196,6 +206,7 @@ func (s *MemberAccessService) UpdateMemberPolicy(ctx context.Context, memberUUID
 		}
 		return fmt.Errorf("update member policy: %w", err)
 	}
+	s.policyVersion.Bump()
 	return nil
 }
 
@@ -135,3 +135,35 @@ func TestApprovePending_MissingUUID_ReturnsError(t *testing.T) {
 		t.Errorf("expected ErrMemberUUIDRequired, got %v", err)
 	}
 }
+
+// ── Policy version ────────────────────────────────────────────────────────────
+
+func TestDisable_BumpsPolicyVersion(t *testing.T) {
+	svc, maStore := newMemberSvc(t)
+	ctx := context.Background()
+	pv := service.NewPolicyVersion()
+	svc.SetPolicyVersion(pv)
+
+	memberUUID := "member-disable-001"
+	if err := maStore.CreateMember(ctx, memberUUID, "",
+		store.ProvisioningStatusActive, nil, nil); err != nil {
+		t.Fatalf("CreateMember: %v", err)
+	}
+
+	before := pv.Current()
+	if err := svc.Disable(ctx, memberUUID); err != nil {
+		t.Fatalf("Disable: %v", err)
+	}
+	if pv.Current() == before {
+		t.Error("Disable must bump the policy version so modules drop cached grants")
+	}
+
+	// A failed change leaves the version alone.
+	before = pv.Current()
+	if err := svc.Disable(ctx, "no-such-member"); !errors.Is(err, service.ErrMemberNotFound) {
+		t.Fatalf("Disable(unknown) = %v, want ErrMemberNotFound", err)
+	}
+	if pv.Current() != before {
+		t.Error("failed Disable bumped the policy version")
+	}
+}
@@ -33,6 +33,8 @@ type ModuleAuthorizationService struct {
 	authStore   store.ModuleAuthorizationStore
 	memberStore store.MemberAccessStore
 	auditStore  store.AuditStore // may be nil; writes are best-effort
+
+	policyVersion *PolicyVersion // may be nil; bumped on revoke
 }
 
 func NewModuleAuthorizationService(
@@ -43,6 +45,9 @@ func NewModuleAuthorizationService(
 	return &ModuleAuthorizationService{authStore: as, memberStore: ms, auditStore: audit}
 }
 
+// SetPolicyVersion wires the version modules use to invalidate cached grants.
+func (s *ModuleAuthorizationService) SetPolicyVersion(pv *PolicyVersion) { s.policyVersion = pv }
+
 // GrantAuthorization creates a new active module authorization.
 // actor.AdminUUID is recorded as granted_by_uuid; it may be empty for
 // automated/system grants (pass a GrantActor with _any semantics explicitly).
@@ -134,6 +139,7 @@ func (s *ModuleAuthorizationService) RevokeAuthorization(ctx context.Context, ac
 		}
 		return fmt.Errorf("revoke authorization: %w", err)
 	}
+	s.policyVersion.Bump()
 	s.recordAudit(ctx, actor.AdminUUID, "module_auth.revoked", "module_authorization",
 		moduleID, "success",
 		fmt.Sprintf(`{"member_uuid":%q,"module_id":%q}`, memberUUID, moduleID))
@@ -0,0 +1,49 @@
+package service
+
+import (
+	"sync/atomic"
+	"time"
+)
+
+// PolicyVersion is a counter that changes whenever an access grant may have
+// been withdrawn. Modules cache grants for a short TTL and drop the whole
+// cache when the version they last saw (in an AccessResponse or
+// HeartbeatResponse) differs from the current one.
+//
+// The counter is seeded from the wall clock so a restarted server never
+// repeats a version a module may still hold — restarts invalidate caches,
+// which is the safe direction. Only grants are ever cached, so for the
+// decision cache only changes that can turn a grant into a deny need to Bump.
+// The revocation filter (RevocationFilter) also rebuilds on a new version, so
+// re-enabling a member Bumps as well; otherwise modules would keep denying
+// them until the next periodic rebuild.
+type PolicyVersion struct {
+	v atomic.Uint32
+}
+
+func NewPolicyVersion() *PolicyVersion {
+	p := &PolicyVersion{}
+	p.v.Store(uint32(time.Now().Unix()))
+	return p
+}
+
+// Current returns the version to report to modules. A nil receiver reports 0
+// ("no version"), which modules treat as unchanged.
+func (p *PolicyVersion) Current() uint32 {
+	if p == nil {
+		return 0
+	}
+	return p.v.Load()
+}
+
+// Bump moves to a new version. Safe on a nil receiver so services can call it
+// unconditionally whether or not decision caching is wired.
+func (p *PolicyVersion) Bump() {
+	if p == nil {
+		return
+	}
+	// Skip 0 on wrap-around; it means "no version" on the wire.
+	if p.v.Add(1) == 0 {
+		p.v.Add(1)
+	}
+}
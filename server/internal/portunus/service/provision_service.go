@@ -28,6 +28,7 @@ type ProvisionService struct {
 	accessEvents         store.AccessEventStore
 	auditStore           store.AuditStore // may be nil; writes are best-effort
 	credentialHashSecret []byte
+	revocationFilter     *RevocationFilter // may be nil; tags captured credentials
 }
 
 func NewProvisionService(
@@ -46,6 +47,10 @@ func NewProvisionService(
 	}
 }
 
+// SetRevocationFilter tags captured credentials so they can be filtered if
+// their member is later revoked, without waiting for a first tap.
+func (s *ProvisionService) SetRevocationFilter(f *RevocationFilter) { s.revocationFilter = f }
+
 // Provision validates the module and routes every valid PEU request to capture.
 func (s *ProvisionService) Provision(
 	ctx context.Context,
@@ -85,7 +90,7 @@ func (s *ProvisionService) Provision(
 		}, nil
 	}
 
-	return s.capture(ctx, moduleID, credHash)
+	return s.capture(ctx, moduleID, credHash, s.revocationFilter.Tag(req.CredentialUID))
 }
 
 // capture parks a single credential as pending_authorization.
@@ -93,6 +98,7 @@ func (s *ProvisionService) capture(
 	ctx context.Context,
 	moduleID string,
 	credHash []byte,
+	filterTag uint64,
 ) (types.ProvisionCredentialResponse, error) {
 	existing, err := s.memberStore.GetMemberByCredential(ctx, credHash)
 	if err != nil && !errors.Is(err, store.ErrNotFound) {
@@ -119,6 +125,10 @@ func (s *ProvisionService) capture(
 		}
 		return types.ProvisionCredentialResponse{}, fmt.Errorf("attach credential: %w", err)
 	}
+	if filterTag != 0 {
+		// Best effort: AccessService tags the credential on its first tap anyway.
+		_ = s.memberStore.SetRevocationTag(ctx, memberUUID, filterTag)
+	}
 
 	s.recordAudit(ctx, store.AuditEntry{
 		ActorType:    store.ActorTypeSystem,
@@ -0,0 +1,220 @@
+package service
+
+import (
+	"context"
+	"crypto/rand"
+	"encoding/binary"
+	"hash/fnv"
+	"log"
+	"sort"
+	"sync"
+	"time"
+
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/store"
+	"github.com/BrandonDHaskell/Portunus/server/internal/revfilter"
+)
+
+// MaxRevocationFilterExceptions is how many colliding active tags a filter
+// may list. Matches REVOCATION_FILTER_MAX_EXCEPTIONS in the firmware and the
+// nanopb max_size of HeartbeatResponse.revocation_filter_exceptions.
+const MaxRevocationFilterExceptions = 16
+
+// revocationFilterSeedAttempts bounds the search for a seed whose false
+// positives among active credentials fit the exception list.
+const revocationFilterSeedAttempts = 8
+
+// RevocationFilterSnapshot is one published filter. Version 0 means no
+// filter: modules drop theirs and ask the server about every tap.
+type RevocationFilterSnapshot struct {
+	Version      uint32
+	Seed         uint64
+	Key          []byte
+	Fingerprints []byte
+	Exceptions   []uint64 // active tags the filter matches; modules pass them through
+	Entries      int
+}
+
+// RevocationFilter maintains the filter of revoked credentials that access
+// modules check before any network I/O (see internal/revfilter). It is
+// rebuilt lazily: at most every refresh interval, and at once when the
+// policy version moves — every change that revokes or restores a member
+// bumps it. An unchanged set of tags keeps the published version, so
+// modules do not refetch for nothing.
+//
+// The tag needs the raw UID, so a credential enrolled before filters
+// existed is only tagged once it is next presented. Leaving a revoked tag
+// out costs a round trip, never a wrong answer. An untagged active
+// credential is another matter: it cannot be checked for collisions, and
+// about 1 tap in 256 would be denied locally. So no filter is published
+// while any active credential is untagged.
+type RevocationFilter struct {
+	members store.MemberAccessStore
+	key     []byte
+	pv      *PolicyVersion
+	refresh time.Duration
+	logger  *log.Logger
+
+	mu        sync.Mutex
+	snap      RevocationFilterSnapshot
+	built     bool
+	inputSum  uint64
+	builtPV   uint32
+	checkedAt time.Time
+	version   uint32
+}
+
+// NewRevocationFilter derives the filter key from the credential-hash secret.
+// refresh bounds how long a newly tagged credential waits to join the filter.
+func NewRevocationFilter(ms store.MemberAccessStore, credentialHashSecret []byte,
+	pv *PolicyVersion, refresh time.Duration) *RevocationFilter {
+	return &RevocationFilter{
+		members: ms,
+		key:     revfilter.DeriveKey(credentialHashSecret),
+		pv:      pv,
+		refresh: refresh,
+		// Seeded from the clock, like PolicyVersion, so a restarted server
+		// never republishes a version a module already holds.
+		version: uint32(time.Now().Unix()),
+	}
+}
+
+// SetLogger attaches a logger for rebuild notices.
+func (f *RevocationFilter) SetLogger(l *log.Logger) { f.logger = l }
+
+// Tag returns the filter tag for a raw UID, or 0 on a nil receiver.
+func (f *RevocationFilter) Tag(rawUID []byte) uint64 {
+	if f == nil {
+		return 0
+	}
+	return revfilter.Tag(f.key, rawUID)
+}
+
+// Current returns the filter to publish, rebuilding it if due. On a store
+// error it returns an empty snapshot — modules then fall back to the server
+// rather than trust a filter that may still list a restored member.
+func (f *RevocationFilter) Current(ctx context.Context) (RevocationFilterSnapshot, error) {
+	if f == nil {
+		return RevocationFilterSnapshot{}, nil
+	}
+	f.mu.Lock()
+	defer f.mu.Unlock()
+
+	now := time.Now()
+	pv := f.pv.Current()
+	if f.built && pv == f.builtPV && now.Sub(f.checkedAt) < f.refresh {
+		return f.snap, nil
+	}
+
+	recs, err := f.members.ListRevocationTags(ctx)
+	if err != nil {
+		f.built = false
+		return RevocationFilterSnapshot{}, err
+	}
+	var revoked, active []uint64
+	untagged := 0
+	for _, r := range recs {
+		switch {
+		case r.Tag == 0 && r.Revoked:
+			// Nothing to filter; the server denies it.
+		case r.Tag == 0:
+			untagged++
+		case r.Revoked:
+			revoked = append(revoked, r.Tag)
+		default:
+			active = append(active, r.Tag)
+		}
+	}
+	sum := tagSetSum(revoked, active, untagged)
+
+	f.checkedAt, f.builtPV = now, pv
+	if f.built && sum == f.inputSum {
+		return f.snap, nil
+	}
+	f.snap = f.build(revoked, active, untagged)
+	f.inputSum, f.built = sum, true
+	return f.snap, nil
+}
+
+func (f *RevocationFilter) build(revoked, active []uint64, untagged int) RevocationFilterSnapshot {
+	if len(revoked) == 0 {
+		return RevocationFilterSnapshot{}
+	}
+	if untagged > 0 {
+		f.logf("WARN revocation filter withheld: %d active credentials not yet tagged", untagged)
+		return RevocationFilterSnapshot{}
+	}
+	var best *revfilter.Filter
+	var bestExceptions []uint64
+	for attempt := 0; attempt < revocationFilterSeedAttempts; attempt++ {
+		flt, err := revfilter.Build(revoked, randomSeed())
+		if err != nil {
+			f.logf("WARN revocation filter build: %v", err)
+			return RevocationFilterSnapshot{}
+		}
+		exc := revfilter.Collisions(flt, active)
+		if best == nil || len(exc) < len(bestExceptions) {
+			best, bestExceptions = flt, exc
+		}
+		if len(bestExceptions) <= MaxRevocationFilterExceptions {
+			break
+		}
+	}
+	if len(bestExceptions) > MaxRevocationFilterExceptions {
+		f.logf("WARN revocation filter withheld: %d active credentials collide (max %d)",
+			len(bestExceptions), MaxRevocationFilterExceptions)
+		return RevocationFilterSnapshot{}
+	}
+	if err := revfilter.Verify(best, revoked); err != nil {
+		f.logf("WARN revocation filter withheld: %v", err)
+		return RevocationFilterSnapshot{}
+	}
+
+	f.version++
+	if f.version == 0 {
+		f.version++
+	}
+	f.logf("revocation filter v%d: %d revoked, %d bytes, %d exceptions",
+		f.version, len(revoked), len(best.Fingerprints), len(bestExceptions))
+	return RevocationFilterSnapshot{
+		Version:      f.version,
+		Seed:         best.Seed,
+		Key:          f.key,
+		Fingerprints: best.Fingerprints,
+		Exceptions:   bestExceptions,
+		Entries:      len(revoked),
+	}
+}
+
+func (f *RevocationFilter) logf(format string, args ...any) {
+	if f.logger != nil {
+		f.logger.Printf(format, args...)
+	}
+}
+
+// tagSetSum fingerprints the filter's input so an unchanged set is not
+// rebuilt (a rebuild picks a new seed and would force every module to
+// refetch).
+func tagSetSum(revoked, active []uint64, untagged int) uint64 {
+	h := fnv.New64a()
+	var b [8]byte
+	for i, set := range [][]uint64{revoked, active} {
+		sort.Slice(set, func(a, c int) bool { return set[a] < set[c] })
+		for _, t := range set {
+			binary.LittleEndian.PutUint64(b[:], t)
+			h.Write(b[:])
+		}
+		b[0] = byte(i) | 0x80
+		h.Write(b[:1])
+	}
+	binary.LittleEndian.PutUint64(b[:], uint64(untagged))
+	h.Write(b[:])
+	return h.Sum64()
+}
+
+func randomSeed() uint64 {
+	var b [8]byte
+	if _, err := rand.Read(b[:]); err != nil {
+		return uint64(time.Now().UnixNano())
+	}
+	return binary.LittleEndian.Uint64(b[:])
+}
@@ -0,0 +1,247 @@
+package service_test
+
+import (
+	"context"
+	"testing"
+	"time"
+
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/service"
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/store"
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/store/memory"
+	sqlitestore "github.com/BrandonDHaskell/Portunus/server/internal/portunus/store/sqlite"
+	"github.com/BrandonDHaskell/Portunus/server/internal/portunus/types"
+	"github.com/BrandonDHaskell/Portunus/server/internal/revfilter"
+)
+
+type revocationFilterFixture struct {
+	members  *service.MemberAccessService
+	access   *service.AccessService
+	events   *memory.AccessEventStore
+	filter   *service.RevocationFilter
+	maStore  store.MemberAccessStore
+	moduleID string
+}
+
+// newRevocationFilterFixture wires an access service, member service and
+// filter around one active, authorized member whose card is uid.
+func newRevocationFilterFixture(t *testing.T, memberUUID string, uid []byte) *revocationFilterFixture {
+	t.Helper()
+	ctx := context.Background()
+	dbConn, writer := openSvcTestDB(t)
+	maStore := sqlitestore.NewMemberAccessStore(dbConn, writer)
+	moStore := sqlitestore.NewModuleAuthorizationStore(dbConn, writer)
+	const moduleID = "module-a"
+
+	seedModule(t, dbConn, moduleID)
+	if err := maStore.CreateMember(ctx, memberUUID, "", store.ProvisioningStatusActive, nil, nil); err != nil {
+		t.Fatalf("CreateMember: %v", err)
+	}
+	if err := maStore.AttachCredential(ctx, memberUUID, service.HashCredentialID(uid, nil)); err != nil {
+		t.Fatalf("AttachCredential: %v", err)
+	}
+	if err := moStore.GrantAuthorization(ctx, memberUUID, moduleID, "", nil, ""); err != nil {
+		t.Fatalf("GrantAuthorization: %v", err)
+	}
+
+	pv := service.NewPolicyVersion()
+	filter := service.NewRevocationFilter(maStore, nil, pv, time.Hour)
+	events := memory.NewAccessEventStore()
+	access := service.NewAccessService(service.NewDeviceRegistry(memory.NewDeviceStore([]string{moduleID})),
+		service.AccessPolicy{}, events)
+	access.SetMemberAccessStore(maStore)
+	access.SetModuleAuthStore(moStore)
+	access.SetDecisionCache(0, pv)
+	access.SetRevocationFilter(filter)
+	members := service.NewMemberAccessService(maStore)
+	members.SetPolicyVersion(pv)
+
+	return &revocationFilterFixture{
+		members: members, access: access, events: events, filter: filter,
+		maStore: maStore, moduleID: moduleID,
+	}
+}
+
+func (f *revocationFilterFixture) current(t *testing.T) service.RevocationFilterSnapshot {
+	t.Helper()
+	snap, err := f.filter.Current(context.Background())
+	if err != nil {
+		t.Fatalf("Current: %v", err)
+	}
+	return snap
+}
+
+func snapshotContains(s service.RevocationFilterSnapshot, tag uint64) bool {
+	flt := revfilter.Filter{Seed: s.Seed, Fingerprints: s.Fingerprints}
+	return flt.Contains(tag)
+}
+
+// TestRevocationFilter_DisabledMemberJoinsFilter follows one card through
+// first tap (tagged), disable (filtered) and re-enable (dropped).
+func TestRevocationFilter_DisabledMemberJoinsFilter(t *testing.T) {
+	ctx := context.Background()
+	const memberUUID = "aaaaaaaa-0000-4000-8000-0000000000f1"
+	uid := []byte{0x04, 0x01, 0x00, 0xf1}
+	f := newRevocationFilterFixture(t, memberUUID, uid)
+	tag := f.filter.Tag(uid)
+
+	if _, err := f.access.Decide(ctx, types.AccessRequest{ModuleID: f.moduleID, CredentialID: "04:01:00:F1"}); err != nil {
+		t.Fatalf("Decide: %v", err)
+	}
+	m, err := f.maStore.GetMember(ctx, memberUUID)
+	if err != nil {
+		t.Fatalf("GetMember: %v", err)
+	}
+	if m.RevocationTag != tag {
+		t.Fatalf("RevocationTag = %#x, want %#x (set on first tap)", m.RevocationTag, tag)
+	}
+	if snap := f.current(t); snap.Version != 0 {
+		t.Fatalf("no revoked members: want no filter, got version %d", snap.Version)
+	}
+
+	if err := f.members.Disable(ctx, memberUUID); err != nil {
+		t.Fatalf("Disable: %v", err)
+	}
+	snap := f.current(t)
+	if snap.Version == 0 || !snapshotContains(snap, tag) {
+		t.Fatalf("disabled member must be in the filter, got %+v", snap)
+	}
+	if len(snap.Key) != 32 || snap.Entries != 1 {
+		t.Fatalf("key len %d, entries %d", len(snap.Key), snap.Entries)
+	}
+
+	if err := f.members.Enable(ctx, memberUUID); err != nil {
+		t.Fatalf("Enable: %v", err)
+	}
+	if snap := f.current(t); snap.Version != 0 {
+		t.Fatalf("re-enabled member must leave the filter at once, got version %d", snap.Version)
+	}
+}
+
+func TestRevocationFilter_UnchangedSetKeepsVersion(t *testing.T) {
+	ctx := context.Background()
+	const memberUUID = "aaaaaaaa-0000-4000-8000-0000000000f2"
+	uid := []byte{0x04, 0x01, 0x00, 0xf2}
+	f := newRevocationFilterFixture(t, memberUUID, uid)
+	if err := f.maStore.SetRevocationTag(ctx, memberUUID, f.filter.Tag(uid)); err != nil {
+		t.Fatalf("SetRevocationTag: %v", err)
+	}
+	if err := f.members.Disable(ctx, memberUUID); err != nil {
+		t.Fatalf("Disable: %v", err)
+	}
+	first := f.current(t)
+
+	// Disabling again bumps the policy version without changing the revoked
+	// set; that must not force every module to refetch.
+	if err := f.members.Disable(ctx, memberUUID); err != nil {
+		t.Fatalf("Disable again: %v", err)
+	}
+	if second := f.current(t); second.Version != first.Version || second.Seed != first.Seed {
+		t.Fatalf("version moved without a change: %d → %d", first.Version, second.Version)
+	}
+}
+
+// TestRevocationFilter_WithheldWhileActiveCredentialUntagged checks that a
+// card the server has never seen cannot be denied locally by a collision.
+func TestRevocationFilter_WithheldWhileActiveCredentialUntagged(t *testing.T) {
+	ctx := context.Background()
+	const revokedUUID = "aaaaaaaa-0000-4000-8000-0000000000f5"
+	const activeUUID = "aaaaaaaa-0000-4000-8000-0000000000f6"
+	revokedUID := []byte{0x04, 0x01, 0x00, 0xf5}
+	activeUID := []byte{0x04, 0x01, 0x00, 0xf6}
+	f := newRevocationFilterFixture(t, revokedUUID, revokedUID)
+	if err := f.maStore.SetRevocationTag(ctx, revokedUUID, f.filter.Tag(revokedUID)); err != nil {
+		t.Fatalf("SetRevocationTag: %v", err)
+	}
+	if err := f.maStore.CreateMember(ctx, activeUUID, "", store.ProvisioningStatusActive, nil, nil); err != nil {
+		t.Fatalf("CreateMember: %v", err)
+	}
+	if err := f.maStore.AttachCredential(ctx, activeUUID, service.HashCredentialID(activeUID, nil)); err != nil {
+		t.Fatalf("AttachCredential: %v", err)
+	}
+	if err := f.members.Disable(ctx, revokedUUID); err != nil {
+		t.Fatalf("Disable: %v", err)
+	}
+
+	// Refresh on every call: tagging a card does not move the policy version.
+	flt := service.NewRevocationFilter(f.maStore, nil, service.NewPolicyVersion(), 0)
+	snap, err := flt.Current(ctx)
+	if err != nil {
+		t.Fatalf("Current: %v", err)
+	}
+	if snap.Version != 0 {
+		t.Fatalf("untagged active credential: want no filter, got version %d", snap.Version)
+	}
+
+	if err := f.maStore.SetRevocationTag(ctx, activeUUID, flt.Tag(activeUID)); err != nil {
+		t.Fatalf("SetRevocationTag: %v", err)
+	}
+	if snap, err = flt.Current(ctx); err != nil {
+		t.Fatalf("Current: %v", err)
+	}
+	if snap.Version == 0 || !snapshotContains(snap, flt.Tag(revokedUID)) {
+		t.Fatalf("every active credential tagged: want the filter, got %+v", snap)
+	}
+}
+
+func TestAccessService_FilteredReport_RecordedAsDeniedByFilter(t *testing.T) {
+	ctx := context.Background()
+	const memberUUID = "aaaaaaaa-0000-4000-8000-0000000000f3"
+	f := newRevocationFilterFixture(t, memberUUID, []byte{0x04, 0x01, 0x00, 0xf3})
+
+	if _, err := f.access.Decide(ctx, types.AccessRequest{
+		ModuleID:     f.moduleID,
+		CredentialID: "04:01:00:F3",
+		Filtered:     true,
+	}); err != nil {
+		t.Fatalf("Decide: %v", err)
+	}
+	events := f.events.Events()
+	if len(events) != 1 || !events[0].DeniedByFilter {
+		t.Fatalf("expected one event marked denied_by_filter, got %+v", events)
+	}
+}
+
+func TestHeartbeat_RevocationFilterSentOnlyWhenStale(t *testing.T) {
+	ctx := context.Background()
+	const memberUUID = "aaaaaaaa-0000-4000-8000-0000000000f4"
+	uid := []byte{0x04, 0x01, 0x00, 0xf4}
+	f := newRevocationFilterFixture(t, memberUUID, uid)
+	if err := f.maStore.SetRevocationTag(ctx, memberUUID, f.filter.Tag(uid)); err != nil {
+		t.Fatalf("SetRevocationTag: %v", err)
+	}
+	if err := f.members.Disable(ctx, memberUUID); err != nil {
+		t.Fatalf("Disable: %v", err)
+	}
+
+	hb := service.NewHeartbeatService(memory.New(),
+		service.NewDeviceRegistry(memory.NewDeviceStore([]string{f.moduleID})))
+	hb.SetRevocationFilter(f.filter)
+
+	resp, err := hb.Record(ctx, types.HeartbeatRequest{ModuleID: f.moduleID, RevocationFilterCapacity: 2048})
+	if err != nil {
+		t.Fatalf("Record: %v", err)
+	}
+	if resp.RevocationFilterVersion == 0 || len(resp.RevocationFilterFingerprints) == 0 || len(resp.RevocationFilterKey) != 32 {
+		t.Fatalf("stale module must get the filter, got %+v", resp)
+	}
+
+	resp2, err := hb.Record(ctx, types.HeartbeatRequest{
+		ModuleID:                 f.moduleID,
+		RevocationFilterCapacity: 2048,
+		RevocationFilterVersion:  resp.RevocationFilterVersion,
+	})
+	if err != nil {
+		t.Fatalf("Record: %v", err)
+	}
+	if resp2.RevocationFilterVersion != resp.RevocationFilterVersion || resp2.RevocationFilterFingerprints != nil {
+		t.Fatalf("up-to-date module must get the version only, got %+v", resp2)
+	}
+
+	resp3, err := hb.Record(ctx, types.HeartbeatRequest{ModuleID: f.moduleID})
+	if err != nil {
+		t.Fatalf("Record: %v", err)
+	}
+	if resp3.RevocationFilterVersion != 0 || resp3.RevocationFilterFingerprints != nil {
+		t.Fatalf("module without filter capacity must get nothing, got %+v", resp3)
+	}
+}
@@ -15,6 +15,8 @@ type AccessEventRecord struct {
 	Granted        bool
 	Reason         string
 	DecidedAt      time.Time
+	Cached         bool // door already opened from the module's decision cache
+	DeniedByFilter bool // module already denied from its revocation filter
 }
 
 // AccessEventStore persists access decisions as an append-only audit log.
@@ -46,6 +46,15 @@ type MemberAccessRecord struct {
 	ProvisioningStatus  ProvisioningStatus
 	ArchivedAt          *time.Time
 	ArchivedByUUID      string
+	RevocationTag       uint64 // revocation filter tag; 0 until the raw UID has been seen
+}
+
+// RevocationTagRecord is one credential as the revocation filter sees it.
+// Tag is 0 until the server has seen the raw UID. Revoked means every door
+// denies it whatever the module: the member is not active, or is disabled.
+type RevocationTagRecord struct {
+	Tag     uint64
+	Revoked bool
 }
 
 // MemberAccessStore manages the member_access lifecycle.
@@ -88,6 +97,13 @@ type MemberAccessStore interface {
 	// UpdateLastAccess records the time of a granted access event.
 	UpdateLastAccess(ctx context.Context, uuid string, t time.Time) error
 
+	// SetRevocationTag records the member's revocation filter tag.
+	SetRevocationTag(ctx context.Context, uuid string, tag uint64) error
+
+	// ListRevocationTags returns every member with a credential or a
+	// revocation tag, and whether that credential is revoked.
+	ListRevocationTags(ctx context.Context) ([]RevocationTagRecord, error)
+
 	// ArchiveMember transitions a member to archived status and records who
 	// performed the action and when.
 	ArchiveMember(ctx context.Context, uuid, archivedByUUID string) error
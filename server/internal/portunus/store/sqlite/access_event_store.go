@@ -25,7 +25,8 @@ func (s *AccessEventStore) ListEventsByCredential(ctx context.Context, credentia
 	}
 	rows, err := s.db.QueryContext(ctx, `
 SELECT module_id, received_at_ms, requested_at_ms, door_closed,
-       credential_hash, decision_granted, decision_reason, decided_at_ms
+       credential_hash, decision_granted, decision_reason, decided_at_ms,
+       served_from_cache, denied_by_filter
 FROM access_events
 WHERE credential_hash = ?
 ORDER BY received_at_ms DESC
@@ -42,12 +43,13 @@ LIMIT ?;
 		var receivedMs, decidedMs int64
 		var requestedMs sql.NullInt64
 		var doorClosed sql.NullInt64
-		var granted int
+		var granted, cached, filtered int
 		var credHash []byte
 
 		if err := rows.Scan(
 			&rec.ModuleID, &receivedMs, &requestedMs, &doorClosed,
 			&credHash, &granted, &rec.Reason, &decidedMs,
+			&cached, &filtered,
 		); err != nil {
 			return nil, fmt.Errorf("ListEventsByCredential scan: %w", err)
 		}
@@ -63,6 +65,8 @@ LIMIT ?;
 			rec.DoorClosed = &b
 		}
 		rec.Granted = granted != 0
+		rec.Cached = cached != 0
+		rec.DeniedByFilter = filtered != 0
 		rec.CredentialHash = credHash
 		out = append(out, rec)
 	}
@@ -99,6 +103,16 @@ func (s *AccessEventStore) RecordEvent(ctx context.Context, rec store.AccessEven
 		granted = 1
 	}
 
+	var cached int
+	if rec.Cached {
+		cached = 1
+	}
+
+	var filtered int
+	if rec.DeniedByFilter {
+		filtered = 1
+	}
+
 	var credentialHash any
 	if len(rec.CredentialHash) == 32 {
 		credentialHash = rec.CredentialHash
@@ -118,11 +132,13 @@ SELECT door_id FROM modules WHERE module_id = ?;
 		if _, err := tx.ExecContext(ctx, `
 INSERT INTO access_events(
   module_id, door_id, received_at_ms, requested_at_ms, door_closed,
-  credential_hash, decision_granted, decision_reason, decided_at_ms
-) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?);
+  credential_hash, decision_granted, decision_reason, decided_at_ms,
+  served_from_cache, denied_by_filter
+) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?);
 `,
 			rec.ModuleID, doorID, receivedMs, requestedMs, doorClosed,
 			credentialHash, granted, rec.Reason, decidedMs,
+			cached, filtered,
 		); err != nil {
 			return fmt.Errorf("RecordEvent insert: %w", err)
 		}
@@ -80,12 +80,14 @@ INSERT INTO module_heartbeats(
 			return fmt.Errorf("UpsertHeartbeat insert heartbeat: %w", err)
 		}
 
-		// Update module snapshot (fast “current status” queries)
+		// Update module snapshot (fast “current status” queries). An empty
+		// IP or firmware version (a static_omitted heartbeat the service
+		// could not fill in) keeps the last known value.
 		if _, err := tx.ExecContext(ctx, `
 UPDATE modules
 SET last_seen_at_ms = ?,
-    last_ip = ?,
-    last_fw_version = ?,
+    last_ip = COALESCE(NULLIF(?, ''), last_ip),
+    last_fw_version = COALESCE(NULLIF(?, ''), last_fw_version),
     last_wifi_rssi = ?,
     updated_at_ms = ?
 WHERE module_id = ?;
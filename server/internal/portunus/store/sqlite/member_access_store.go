@@ -154,6 +154,39 @@ func (s *MemberAccessStore) UpdateLastAccess(ctx context.Context, uuid string, t
 	})
 }
 
+func (s *MemberAccessStore) SetRevocationTag(ctx context.Context, uuid string, tag uint64) error {
+	return s.writer.Do(ctx, func(ctx context.Context, tx *sql.Tx) error {
+		res, err := tx.ExecContext(ctx,
+			`UPDATE member_access SET revocation_tag = ? WHERE uuid = ?;`, int64(tag), uuid)
+		if err != nil {
+			return fmt.Errorf("SetRevocationTag: %w", err)
+		}
+		return requireOneRow(res, "SetRevocationTag")
+	})
+}
+
+func (s *MemberAccessStore) ListRevocationTags(ctx context.Context) ([]store.RevocationTagRecord, error) {
+	rows, err := s.db.QueryContext(ctx, `
+SELECT COALESCE(revocation_tag, 0), (status != 'active' OR enabled = 0)
+FROM member_access
+WHERE revocation_tag IS NOT NULL OR credential_hash IS NOT NULL;
+`)
+	if err != nil {
+		return nil, fmt.Errorf("ListRevocationTags: %w", err)
+	}
+	defer rows.Close()
+	var out []store.RevocationTagRecord
+	for rows.Next() {
+		var tag int64
+		var revoked int
+		if err := rows.Scan(&tag, &revoked); err != nil {
+			return nil, fmt.Errorf("ListRevocationTags scan: %w", err)
+		}
+		out = append(out, store.RevocationTagRecord{Tag: uint64(tag), Revoked: revoked != 0})
+	}
+	return out, rows.Err()
+}
+
 func (s *MemberAccessStore) ArchiveMember(ctx context.Context, uuid, archivedByUUID string) error {
 	now := time.Now().UTC().UnixMilli()
 	return s.writer.Do(ctx, func(ctx context.Context, tx *sql.Tx) error {
@@ -295,7 +328,8 @@ SELECT uuid, credential_hash, status, enabled,
        expires_at_ms, inactivity_limit_days, activated_at_ms, last_access_at_ms,
        created_at_ms, COALESCE(created_by_uuid,''),
        COALESCE(promoted_from_uuid,''), provisioning_status,
-       archived_at_ms, COALESCE(archived_by_uuid,'')
+       archived_at_ms, COALESCE(archived_by_uuid,''),
+       revocation_tag
 FROM member_access`
 
 type rowScanner interface {
@@ -314,12 +348,14 @@ func scanMemberAccessRow(row rowScanner) (*store.MemberAccessRecord, error) {
 		createdBy, promotedFrom     string
 		archivedMs                  sql.NullInt64
 		archivedBy                  string
+		revocationTag               sql.NullInt64
 	)
 	err := row.Scan(
 		&uuid, &credHash, &statusStr, &enabled,
 		&expiresMs, &inactivityDays, &activatedMs, &lastAccessMs,
 		&createdMs, &createdBy, &promotedFrom, &provStatus,
 		&archivedMs, &archivedBy,
+		&revocationTag,
 	)
 	if err != nil {
 		return nil, err
@@ -335,6 +371,7 @@ func scanMemberAccessRow(row rowScanner) (*store.MemberAccessRecord, error) {
 		PromotedFromUUID:   promotedFrom,
 		ProvisioningStatus: store.ProvisioningStatus(provStatus),
 		ArchivedByUUID:     archivedBy,
+		RevocationTag:      uint64(revocationTag.Int64),
 	}
 	if expiresMs.Valid {
 		t := time.UnixMilli(expiresMs.Int64).UTC()
@@ -1,18 +1,24 @@
 package types
 
 type AccessRequest struct {
-	ModuleID     string `json:"module_id"`
-	CredentialID string `json:"credential_id"`
-	DoorClosed   *bool  `json:"door_closed,omitempty"`
-	RequestedAt  string `json:"requested_at,omitempty"` // optional device timestamp (RFC 3339 UTC)
-	Nonce        []byte `json:"nonce,omitempty"`        // 16 random bytes for replay protection
+	ModuleID      string `json:"module_id"`
+	CredentialID  string `json:"credential_id"`
+	DoorClosed    *bool  `json:"door_closed,omitempty"`
+	RequestedAt   string `json:"requested_at,omitempty"`    // optional device timestamp (RFC 3339 UTC)
+	RequestedAtUS int64  `json:"requested_at_us,omitempty"` // same, µs since the Unix epoch; preferred when set
+	Nonce         []byte `json:"nonce,omitempty"`           // 16 random bytes for replay protection
+	Cached        bool   `json:"cached,omitempty"`          // report for a tap already granted from the module's decision cache
+	Filtered      bool   `json:"filtered,omitempty"`        // report for a tap already denied by the module's revocation filter
 }
 
 type AccessResponse struct {
-	OK         bool   `json:"ok"`
-	Known      bool   `json:"known"`
-	Granted    bool   `json:"granted"`
-	Reason     string `json:"reason,omitempty"`
-	ModuleID   string `json:"module_id"`
-	ServerTime string `json:"server_time"`
+	OK            bool   `json:"ok"`
+	Known         bool   `json:"known"`
+	Granted       bool   `json:"granted"`
+	Reason        string `json:"reason,omitempty"`
+	ModuleID      string `json:"module_id"`
+	ServerTime    string `json:"server_time"`
+	ServerTimeUS  int64  `json:"server_time_us,omitempty"` // same instant, µs since the Unix epoch
+	CacheTTLS     uint32 `json:"cache_ttl_s,omitempty"`    // grants only; 0 = module must not cache
+	PolicyVersion uint32 `json:"policy_version,omitempty"` // see service.PolicyVersion
 }
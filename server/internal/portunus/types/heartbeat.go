@@ -9,11 +9,156 @@ type HeartbeatRequest struct {
 	IP              string `json:"ip,omitempty"`
 	FreeHeapBytes   uint32 `json:"free_heap_bytes,omitempty"`
 	Sequence        uint32 `json:"sequence,omitempty"`
+	CPUCores        uint32 `json:"cpu_cores,omitempty"`
+	CoreIsolation   bool   `json:"core_isolation,omitempty"`
+	TaskPlanFaults  uint32 `json:"task_plan_faults,omitempty"`
+	StaleTaps       uint32 `json:"stale_taps,omitempty"`
+	RTTP50Ms        uint32 `json:"rtt_p50_ms,omitempty"`
+	RTTP90Ms        uint32 `json:"rtt_p90_ms,omitempty"`
+	RTTP99Ms        uint32 `json:"rtt_p99_ms,omitempty"`
+	RPCTimeoutMs    uint32 `json:"rpc_timeout_ms,omitempty"`
+	DeadLinks       uint32 `json:"dead_links,omitempty"`
+
+	DecisionCacheHits          uint32 `json:"decision_cache_hits,omitempty"`
+	DecisionCacheMisses        uint32 `json:"decision_cache_misses,omitempty"`
+	DecisionCacheEvictions     uint32 `json:"decision_cache_evictions,omitempty"`
+	DecisionCacheInvalidations uint32 `json:"decision_cache_invalidations,omitempty"`
+
+	RevocationFilterVersion  uint32 `json:"revocation_filter_version,omitempty"`  // filter the module holds (0 = none)
+	RevocationFilterCapacity uint32 `json:"revocation_filter_capacity,omitempty"` // largest filter it can take, bytes
+	RevocationFilterDenials  uint32 `json:"revocation_filter_denials,omitempty"`
+
+	ClockOffsetUS int32  `json:"clock_offset_us,omitempty"` // module wall clock minus server, last sample
+	ClockErrorUS  uint32 `json:"clock_error_us,omitempty"`  // bound on the module's estimate (0 = not synced)
+	ClockDriftPPB int32  `json:"clock_drift_ppb,omitempty"` // crystal drift against the server (0 = unknown)
+
+	// Heartbeat pacing. StaticOmitted means FirmwareVersion, IP, CPUCores,
+	// CoreIsolation, TaskPlanFaults and RevocationFilterCapacity were left
+	// out because they have not changed; HeartbeatService fills them in.
+	StaticOmitted       bool   `json:"static_omitted,omitempty"`
+	HeartbeatIntervalS  uint32 `json:"heartbeat_interval_s,omitempty"`  // interval this one was sent at
+	HeartbeatsSkipped   uint32 `json:"heartbeats_skipped,omitempty"`    // ticks not sent, since boot
+	HeartbeatBytesSaved uint32 `json:"heartbeat_bytes_saved,omitempty"` // protobuf bytes not sent, since boot
+
+	// Boot timeline, ms since the module's CPU started (0 = not reached).
+	// Only early heartbeats after a boot carry it; HeartbeatService keeps
+	// the last one and fills it into the rest.
+	BootConfigMs    uint32 `json:"boot_config_ms,omitempty"`     // NVS and device configuration loaded
+	BootWiFiStartMs uint32 `json:"boot_wifi_start_ms,omitempty"` // WiFi started, association under way
+	BootIOReadyMs   uint32 `json:"boot_io_ready_ms,omitempty"`   // reader, strike, LED and FSM initialised
+	BootFSMMs       uint32 `json:"boot_fsm_ms,omitempty"`        // FSM running: taps are read
+	BootIPMs        uint32 `json:"boot_ip_ms,omitempty"`         // first IP address
+	BootServerMs    uint32 `json:"boot_server_ms,omitempty"`     // first connection to the server
+
+	// WiFi connects since boot, and association-to-IP times in ms.
+	WiFiConnects       uint32 `json:"wifi_connects,omitempty"`
+	WiFiHintedConnects uint32 `json:"wifi_hinted_connects,omitempty"`    // to the saved AP, no scan
+	WiFiScanFallbacks  uint32 `json:"wifi_scan_fallbacks,omitempty"`     // saved AP did not answer
+	WiFiAssocToIPMs    uint32 `json:"wifi_assoc_to_ip_ms,omitempty"`     // last connect
+	WiFiAssocToIPMaxMs uint32 `json:"wifi_assoc_to_ip_max_ms,omitempty"` // slowest connect
+
+	// WiFi link quality (0-100) and RSSI average and trend; 0 = not connected.
+	WiFiLinkQuality       uint32 `json:"wifi_link_quality,omitempty"`
+	WiFiRSSIAvgDbm        int32  `json:"wifi_rssi_avg_dbm,omitempty"`
+	WiFiRSSITrendDbPerMin int32  `json:"wifi_rssi_trend_db_per_min,omitempty"`
+	WiFiBeaconLosses      uint32 `json:"wifi_beacon_losses,omitempty"`     // since boot
+	WiFiRPCFailures       uint32 `json:"wifi_rpc_failures,omitempty"`      // RPCs that got no answer, since boot
+	WiFiRoamScans         uint32 `json:"wifi_roam_scans,omitempty"`        // scans/transition queries on a degraded link
+	WiFiRoams             uint32 `json:"wifi_roams,omitempty"`             // moves to another AP that followed
+	WiFiLastRoamGainDb    int32  `json:"wifi_last_roam_gain_db,omitempty"` // RSSI the last roam gained
+
+	// Radio power save since boot, and access RPC round trips (average ms)
+	// on a radio already awake vs one woken from power save for the tap.
+	WiFiAwakeS          uint32 `json:"wifi_awake_s,omitempty"`
+	WiFiPowerSaveS      uint32 `json:"wifi_power_save_s,omitempty"`
+	WiFiWakes           uint32 `json:"wifi_wakes,omitempty"`
+	AccessRPCsAwake     uint32 `json:"access_rpcs_awake,omitempty"`
+	AccessRPCAwakeAvgMs uint32 `json:"access_rpc_awake_avg_ms,omitempty"`
+	AccessRPCsWoken     uint32 `json:"access_rpcs_woken,omitempty"`
+	AccessRPCWokenAvgMs uint32 `json:"access_rpc_woken_avg_ms,omitempty"`
+
+	// Runtime health; nil from firmware built without it.
+	Health *HealthTelemetry `json:"health,omitempty"`
+}
+
+// HealthTelemetry is the module's runtime health at one heartbeat (see
+// HealthTelemetry in portunus.proto). Counters are since boot; CPU shares
+// cover the last heartbeat interval, in permille of all cores.
+type HealthTelemetry struct {
+	MinFreeHeapBytes      uint32 `json:"min_free_heap_bytes"`
+	LargestFreeBlockBytes uint32 `json:"largest_free_block_bytes"` // far below free heap = fragmented
+
+	ServerConnects        uint32 `json:"server_connects"`
+	ServerConnectFailures uint32 `json:"server_connect_failures"`
+	TLSFailures           uint32 `json:"tls_failures"`
+	TLSPinMismatches      uint32 `json:"tls_pin_mismatches"` // among TLSFailures
+	TLSHandshakeMs        uint32 `json:"tls_handshake_ms"`   // last successful handshake
+
+	TaskCount    uint32 `json:"task_count"`
+	IdlePermille uint32 `json:"idle_permille"`
+	SampleUS     uint32 `json:"sample_us"`     // what this sample cost the module
+	SampleMaxUS  uint32 `json:"sample_max_us"` // most any sample has cost
+
+	// Detailed means Tasks lists every task (a dump), or the oldest ones
+	// when there are more than fit (fewer Tasks than TaskCount); otherwise
+	// it names those with the least stack headroom and the busiest.
+	Detailed bool         `json:"detailed"`
+	Tasks    []TaskHealth `json:"tasks,omitempty"`
+}
+
+// ModuleHealth is what the server holds of a module's health telemetry:
+// the last report, the last dump (a detailed report), and whether a dump
+// has been asked for and not yet received.
+type ModuleHealth struct {
+	ReceivedAt     string           `json:"received_at,omitempty"` // RFC 3339
+	Health         *HealthTelemetry `json:"health,omitempty"`
+	DumpReceivedAt string           `json:"dump_received_at,omitempty"`
+	Dump           *HealthTelemetry `json:"dump,omitempty"`
+	DumpPending    bool             `json:"dump_pending"`
+}
+
+type TaskHealth struct {
+	Name           string `json:"name"`
+	CPUPermille    uint32 `json:"cpu_permille"`
+	StackFreeBytes uint32 `json:"stack_free_bytes"`   // high-water mark
+	Core           int32  `json:"core,omitempty"`     // dumps only; -1 = either core
+	Priority       uint32 `json:"priority,omitempty"` // dumps only
+}
+
+// BootReadyMs is when the module could first grant a tap from the server:
+// its FSM was running and it had reached the server. 0 if it has not.
+func (r HeartbeatRequest) BootReadyMs() uint32 {
+	if r.BootFSMMs == 0 || r.BootServerMs == 0 {
+		return 0
+	}
+	return max(r.BootFSMMs, r.BootServerMs)
 }
 
 type HeartbeatResponse struct {
-	OK         bool   `json:"ok"`
-	Known      bool   `json:"known"`
-	ModuleID   string `json:"module_id"`
-	ServerTime string `json:"server_time"`
+	OK            bool   `json:"ok"`
+	Known         bool   `json:"known"`
+	ModuleID      string `json:"module_id"`
+	ServerTime    string `json:"server_time"`
+	ServerTimeUS  int64  `json:"server_time_us,omitempty"` // same instant, µs since the Unix epoch
+	PolicyVersion uint32 `json:"policy_version,omitempty"`
+
+	// Revocation filter (see service.RevocationFilter). Version is always
+	// set; the rest only when the module's copy is stale and the filter fits.
+	RevocationFilterVersion      uint32   `json:"revocation_filter_version,omitempty"`
+	RevocationFilterSeed         uint64   `json:"revocation_filter_seed,omitempty"`
+	RevocationFilterKey          []byte   `json:"revocation_filter_key,omitempty"`
+	RevocationFilterFingerprints []byte   `json:"revocation_filter_fingerprints,omitempty"`
+	RevocationFilterExceptions   []uint64 `json:"revocation_filter_exceptions,omitempty"`
+
+	// ResendStatic asks the module for a full heartbeat: it omitted the
+	// static fields and the server holds none for it (e.g. after a restart).
+	ResendStatic bool `json:"resend_static,omitempty"`
+
+	// HeartbeatDelayMS pushes the module's next heartbeat back past its
+	// schedule, to spread a fleet that is in step (see service.HeartbeatPacing).
+	HeartbeatDelayMS uint32 `json:"heartbeat_delay_ms,omitempty"`
+
+	// HealthDump asks the module to send its next heartbeat at once with
+	// every task in its health telemetry (see HeartbeatService.RequestHealthDump).
+	HealthDump bool `json:"health_dump,omitempty"`
 }
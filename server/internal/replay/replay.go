@@ -4,6 +4,7 @@
 package replay
 
 import (
+	"context"
 	"errors"
 	"sync"
 	"time"
@@ -31,7 +32,17 @@ var (
 type Store struct {
 	mu      sync.Mutex
 	window  time.Duration
-	entries map[string]time.Time // key: moduleID+":"+nonceHex  value: expiry
+	entries map[string]*entry // key: moduleID+":"+nonceHex
+}
+
+// entry is one recorded nonce and, once the request has been answered,
+// the answer (see Settle).  done is closed when the request carrying the
+// nonce finishes, so a repeat can wait for it (see Await).
+type entry struct {
+	expiry   time.Time
+	outcome  any
+	done     chan struct{}
+	released bool
 }
 
 // NewStore creates a Store with the given sliding-window duration.
@@ -39,7 +50,7 @@ type Store struct {
 func NewStore(window time.Duration) *Store {
 	return &Store{
 		window:  window,
-		entries: make(map[string]time.Time),
+		entries: make(map[string]*entry),
 	}
 }
 
@@ -48,21 +59,35 @@ func NewStore(window time.Duration) *Store {
 //  2. The timestamp is within ±window of now.
 //  3. nonceHex has not been seen before within the window.
 //
-// On success it records the nonce; subsequent calls with the same
-// moduleID+nonceHex are rejected until the entry expires.
+// On success it records the nonce as in flight; subsequent calls with the
+// same moduleID+nonceHex are rejected until the entry expires.  The caller
+// should Settle (or Release) the nonce once the request finishes, so that
+// a repeat waiting in Await is not held until its own deadline.
 //
 // moduleID namespaces nonces so different devices cannot collide.
 func (s *Store) Check(moduleID, nonceHex, requestedAt string) error {
-	now := time.Now().UTC()
-
 	if requestedAt == "" {
 		return ErrTimestampRequired
 	}
-
 	ts, err := time.Parse(time.RFC3339Nano, requestedAt)
 	if err != nil {
 		return ErrTimestampInvalid
 	}
+	return s.check(moduleID, nonceHex, ts)
+}
+
+// CheckMicros is Check for a protocol v2 timestamp: microseconds since the
+// Unix epoch, 0 meaning absent.
+func (s *Store) CheckMicros(moduleID, nonceHex string, requestedAtUS int64) error {
+	if requestedAtUS == 0 {
+		return ErrTimestampRequired
+	}
+	return s.check(moduleID, nonceHex, time.UnixMicro(requestedAtUS))
+}
+
+func (s *Store) check(moduleID, nonceHex string, ts time.Time) error {
+	now := time.Now().UTC()
+
 	age := now.Sub(ts.UTC())
 	if age > s.window || age < -s.window {
 		return ErrTimestampWindow
@@ -72,8 +97,8 @@ func (s *Store) Check(moduleID, nonceHex, requestedAt string) error {
 	defer s.mu.Unlock()
 
 	// Purge expired entries to keep the map bounded.
-	for k, expiry := range s.entries {
-		if now.After(expiry) {
+	for k, e := range s.entries {
+		if now.After(e.expiry) {
 			delete(s.entries, k)
 		}
 	}
@@ -83,8 +108,90 @@ func (s *Store) Check(moduleID, nonceHex, requestedAt string) error {
 		if _, seen := s.entries[key]; seen {
 			return ErrNonceSeen
 		}
-		s.entries[key] = now.Add(s.window)
+		s.entries[key] = &entry{expiry: now.Add(s.window), done: make(chan struct{})}
 	}
 
 	return nil
 }
+
+// Settle records that the request carrying nonceHex has finished, with
+// the answer it got (nil if there is none worth handing out again).  A
+// device that lost the connection before the answer arrived retries with
+// the same nonce; Check rejects that retry with ErrNonceSeen, and the
+// caller can hand back the settled answer (see Await) instead of deciding
+// a second time.  Unknown or expired nonces are ignored.
+func (s *Store) Settle(moduleID, nonceHex string, outcome any) {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	if e, ok := s.entries[moduleID+":"+nonceHex]; ok && !isClosed(e.done) {
+		e.outcome = outcome
+		close(e.done)
+	}
+}
+
+// Release records that the request carrying nonceHex ended without a
+// decision — its caller gave up before one was made — so a repeat may
+// make it instead (see Await).  Unknown or expired nonces are ignored.
+func (s *Store) Release(moduleID, nonceHex string) {
+	s.mu.Lock()
+	defer s.mu.Unlock()
+
+	if e, ok := s.entries[moduleID+":"+nonceHex]; ok && !isClosed(e.done) {
+		e.released = true
+		close(e.done)
+	}
+}
+
+// Await handles a repeat of nonceHex, one that Check rejected with
+// ErrNonceSeen.  While the first request is still being handled it waits
+// for it, so a device retrying on a fresh connection is not refused just
+// because its first attempt has not finished yet.  It then returns:
+//
+//   - the settled answer, to hand back instead of deciding again;
+//   - nil outcome and nil error if the first request was released: the
+//     caller now holds the nonce and must Settle or Release it in turn;
+//   - ErrNonceSeen if the first request finished without an answer to
+//     reuse, or the nonce is unknown or expired;
+//   - ctx.Err() if ctx ends first.
+func (s *Store) Await(ctx context.Context, moduleID, nonceHex string) (any, error) {
+	key := moduleID + ":" + nonceHex
+	for {
+		s.mu.Lock()
+		e, found := s.entries[key]
+		if !found || time.Now().UTC().After(e.expiry) {
+			s.mu.Unlock()
+			return nil, ErrNonceSeen
+		}
+		done := e.done
+		if isClosed(done) {
+			defer s.mu.Unlock()
+			switch {
+			case e.outcome != nil:
+				return e.outcome, nil
+			case e.released:
+				e.released = false
+				e.done = make(chan struct{})
+				return nil, nil
+			default:
+				return nil, ErrNonceSeen
+			}
+		}
+		s.mu.Unlock()
+
+		select {
+		case <-done:
+		case <-ctx.Done():
+			return nil, ctx.Err()
+		}
+	}
+}
+
+func isClosed(ch chan struct{}) bool {
+	select {
+	case <-ch:
+		return true
+	default:
+		return false
+	}
+}
@@ -0,0 +1,237 @@
+// Package revfilter builds the revocation filter access modules check before
+// asking the server: an 8-bit xor filter over the tags of credentials every
+// door would deny.
+//
+// A tag is the first 8 bytes (little-endian) of HMAC-SHA256(key, raw UID).
+// The key is derived from the credential-hash secret but is not that secret;
+// it ships with the filter so modules can tag a card themselves.
+//
+// Lookups never miss a filtered tag and match about 1 in 256 others. The
+// hashing, sizing and peeling order here must stay bit-for-bit identical to
+// access_module/services/server_comm/src/revocation_filter.cpp — both test
+// suites pin the same golden filter.
+package revfilter
+
+import (
+	"crypto/hmac"
+	"crypto/sha256"
+	"encoding/binary"
+	"errors"
+	"fmt"
+	"sort"
+)
+
+// ErrBuildFailed is returned when no seed produced a filter. With distinct
+// tags this does not happen in practice.
+var ErrBuildFailed = errors.New("revfilter: construction failed")
+
+const buildMaxAttempts = 64
+
+// keyLabel separates the filter key from other uses of the secret.
+const keyLabel = "portunus/revocation-filter/v1"
+
+// Filter is a built xor filter. An empty Fingerprints matches nothing.
+type Filter struct {
+	Seed         uint64
+	Fingerprints []byte
+}
+
+// DeriveKey returns the filter key for a credential-hash secret. An empty
+// secret (development only) gives an unkeyed SHA-256 of the label, matching
+// how credential hashes fall back.
+func DeriveKey(secret []byte) []byte {
+	if len(secret) == 0 {
+		h := sha256.Sum256([]byte(keyLabel))
+		return h[:]
+	}
+	mac := hmac.New(sha256.New, secret)
+	mac.Write([]byte(keyLabel))
+	return mac.Sum(nil)
+}
+
+// Tag returns the filter tag of a raw credential UID. Never 0.
+func Tag(key, rawUID []byte) uint64 {
+	mac := hmac.New(sha256.New, key)
+	mac.Write(rawUID)
+	t := binary.LittleEndian.Uint64(mac.Sum(nil)[:8])
+	if t == 0 {
+		return 1
+	}
+	return t
+}
+
+// Bytes is the fingerprint size of a filter over n distinct tags.
+func Bytes(n int) int {
+	return 3 * blockLength(n)
+}
+
+// Build returns a filter over tags (duplicates ignored). Seeds are tried
+// starting from seed; the one that worked is in the result.
+func Build(tags []uint64, seed uint64) (*Filter, error) {
+	keys := append([]uint64(nil), tags...)
+	sort.Slice(keys, func(i, j int) bool { return keys[i] < keys[j] })
+	unique := keys[:0]
+	for i, k := range keys {
+		if i == 0 || k != keys[i-1] {
+			unique = append(unique, k)
+		}
+	}
+	if len(unique) == 0 {
+		return &Filter{Seed: seed}, nil
+	}
+
+	bl := uint32(blockLength(len(unique)))
+	p := newPeeler(len(unique), bl)
+	for attempt := 0; attempt < buildMaxAttempts; attempt++ {
+		if fp, ok := p.peel(unique, seed); ok {
+			return &Filter{Seed: seed, Fingerprints: fp}, nil
+		}
+		seed = nextSeed(seed)
+	}
+	return nil, fmt.Errorf("%w: %d tags", ErrBuildFailed, len(unique))
+}
+
+// Contains reports whether tag is (probably) in the filter.
+func (f *Filter) Contains(tag uint64) bool {
+	bl := uint32(len(f.Fingerprints) / 3)
+	if bl == 0 {
+		return false
+	}
+	h := mix64(tag + f.Seed)
+	s := slots(h, bl)
+	return fingerprint(h) == f.Fingerprints[s[0]]^f.Fingerprints[s[1]]^f.Fingerprints[s[2]]
+}
+
+// Verify returns an error if any of tags is missing from f. An xor filter
+// has no false negatives, so an error means the filter is corrupt or was
+// built from a different set.
+func Verify(f *Filter, tags []uint64) error {
+	for _, t := range tags {
+		if !f.Contains(t) {
+			return fmt.Errorf("revfilter: tag %016x missing from filter", t)
+		}
+	}
+	return nil
+}
+
+// Collisions returns the tags that f matches although they were not added —
+// the false positives among a known set, which modules must pass through.
+func Collisions(f *Filter, tags []uint64) []uint64 {
+	var out []uint64
+	for _, t := range tags {
+		if f.Contains(t) {
+			out = append(out, t)
+		}
+	}
+	return out
+}
+
+// ─── Hashing ────────────────────────────────────────────────────────────────
+
+func mix64(h uint64) uint64 {
+	h ^= h >> 33
+	h *= 0xff51afd7ed558ccd
+	h ^= h >> 33
+	h *= 0xc4ceb9fe1a85ec53
+	h ^= h >> 33
+	return h
+}
+
+func nextSeed(seed uint64) uint64 { return mix64(seed + 0x9e3779b97f4a7c15) }
+
+func rotl64(x uint64, r uint) uint64 { return x<<r | x>>(64-r) }
+
+func reduce(x, n uint32) uint32 { return uint32(uint64(x) * uint64(n) >> 32) }
+
+func fingerprint(h uint64) byte { return byte(h ^ h>>32) }
+
+func slots(h uint64, bl uint32) [3]uint32 {
+	return [3]uint32{
+		reduce(uint32(h), bl),
+		reduce(uint32(rotl64(h, 21)), bl) + bl,
+		reduce(uint32(rotl64(h, 42)), bl) + 2*bl,
+	}
+}
+
+// blockLength sizes each of the three blocks: 1.23 slots per entry plus
+// slack, in integers so both implementations agree.
+func blockLength(n int) int {
+	if n == 0 {
+		return 0
+	}
+	capacity := 32 + (n*123+99)/100
+	return capacity / 3
+}
+
+// ─── Construction ───────────────────────────────────────────────────────────
+
+type peeler struct {
+	bl        uint32
+	xormask   []uint64
+	count     []uint32
+	queue     []uint32
+	stackHash []uint64
+	stackSlot []uint32
+}
+
+func newPeeler(n int, bl uint32) *peeler {
+	c := 3 * int(bl)
+	return &peeler{
+		bl:        bl,
+		xormask:   make([]uint64, c),
+		count:     make([]uint32, c),
+		queue:     make([]uint32, 0, c),
+		stackHash: make([]uint64, 0, n),
+		stackSlot: make([]uint32, 0, n),
+	}
+}
+
+func (p *peeler) peel(keys []uint64, seed uint64) ([]byte, bool) {
+	for i := range p.xormask {
+		p.xormask[i], p.count[i] = 0, 0
+	}
+	p.queue, p.stackHash, p.stackSlot = p.queue[:0], p.stackHash[:0], p.stackSlot[:0]
+
+	for _, k := range keys {
+		h := mix64(k + seed)
+		for _, s := range slots(h, p.bl) {
+			p.xormask[s] ^= h
+			p.count[s]++
+		}
+	}
+	for i, c := range p.count {
+		if c == 1 {
+			p.queue = append(p.queue, uint32(i))
+		}
+	}
+
+	for len(p.queue) > 0 {
+		i := p.queue[len(p.queue)-1]
+		p.queue = p.queue[:len(p.queue)-1]
+		if p.count[i] != 1 {
+			continue
+		}
+		h := p.xormask[i]
+		p.stackHash = append(p.stackHash, h)
+		p.stackSlot = append(p.stackSlot, i)
+		for _, s := range slots(h, p.bl) {
+			p.xormask[s] ^= h
+			p.count[s]--
+			if p.count[s] == 1 {
+				p.queue = append(p.queue, s)
+			}
+		}
+	}
+	if len(p.stackHash) != len(keys) {
+		return nil, false
+	}
+
+	fp := make([]byte, 3*p.bl)
+	for k := len(p.stackHash) - 1; k >= 0; k-- {
+		h, slot := p.stackHash[k], p.stackSlot[k]
+		s := slots(h, p.bl)
+		fp[slot] = 0
+		fp[slot] = fingerprint(h) ^ fp[s[0]] ^ fp[s[1]] ^ fp[s[2]]
+	}
+	return fp, true
+}
@@ -0,0 +1,152 @@
+package revfilter
+
+import (
+	"bytes"
+	"fmt"
+	"hash/fnv"
+	"testing"
+)
+
+func tagsFrom(first uint64, n int) []uint64 {
+	out := make([]uint64, n)
+	for i := range out {
+		out[i] = mix64(first + uint64(i))
+	}
+	return out
+}
+
+// TestGoldenFilter pins the construction to the firmware's: the same inputs
+// must give the same seed and fingerprints as test_golden_filter_matches_server
+// in access_module/test/host/test_revocation_filter.cpp.
+func TestGoldenFilter(t *testing.T) {
+	f, err := Build(tagsFrom(1, 100), 0x5eed)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if len(f.Fingerprints) != 153 {
+		t.Fatalf("len = %d, want 153", len(f.Fingerprints))
+	}
+	if f.Seed != 0x457f21d36f8e2858 {
+		t.Fatalf("seed = %#x", f.Seed)
+	}
+	h := fnv.New32a()
+	h.Write(f.Fingerprints)
+	if got := h.Sum32(); got != 0x3cc9a9ab {
+		t.Fatalf("fingerprint checksum = %#08x, want 0x3cc9a9ab", got)
+	}
+}
+
+func TestBytes(t *testing.T) {
+	for n, want := range map[int]int{0: 0, 100: 153, 10000: 12330} {
+		if got := Bytes(n); got != want {
+			t.Errorf("Bytes(%d) = %d, want %d", n, got, want)
+		}
+	}
+}
+
+func TestEmptyFilterMatchesNothing(t *testing.T) {
+	f, err := Build(nil, 1)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if f.Contains(42) || len(f.Fingerprints) != 0 {
+		t.Fatal("empty filter must match nothing")
+	}
+}
+
+func TestNoFalseNegatives(t *testing.T) {
+	tags := tagsFrom(1000, 10000)
+	f, err := Build(tags, 99)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if err := Verify(f, tags); err != nil {
+		t.Fatal(err)
+	}
+}
+
+func TestVerifyCatchesCorruption(t *testing.T) {
+	tags := tagsFrom(1, 1000)
+	f, err := Build(tags, 1)
+	if err != nil {
+		t.Fatal(err)
+	}
+	for i := range f.Fingerprints {
+		f.Fingerprints[i] ^= 0x5a
+	}
+	if Verify(f, tags) == nil {
+		t.Fatal("Verify accepted a corrupted filter")
+	}
+}
+
+func TestFalsePositiveRate(t *testing.T) {
+	f, err := Build(tagsFrom(1, 10000), 3)
+	if err != nil {
+		t.Fatal(err)
+	}
+	others := tagsFrom(1000000, 200000)
+	n := len(Collisions(f, others))
+	// Expect 200000/256 ≈ 781.
+	if n < 600 || n > 980 {
+		t.Fatalf("false positives = %d of %d", n, len(others))
+	}
+}
+
+func TestDuplicatesIgnored(t *testing.T) {
+	a, b := mix64(1), mix64(2)
+	f, err := Build([]uint64{a, b, a, a, b}, 5)
+	if err != nil {
+		t.Fatal(err)
+	}
+	if len(f.Fingerprints) != Bytes(2) {
+		t.Fatalf("len = %d, want %d", len(f.Fingerprints), Bytes(2))
+	}
+}
+
+func TestTagIsKeyedAndNonZero(t *testing.T) {
+	uid := []byte{0x04, 0xa1, 0xb2, 0xc3}
+	k1, k2 := DeriveKey([]byte("secret")), DeriveKey([]byte("other"))
+	if bytes.Equal(k1, k2) || len(k1) != 32 {
+		t.Fatal("keys must differ per secret and be 32 bytes")
+	}
+	if Tag(k1, uid) == Tag(k2, uid) {
+		t.Fatal("tag must depend on the key")
+	}
+	if Tag(k1, uid) == 0 {
+		t.Fatal("tag must never be 0")
+	}
+}
+
+// BenchmarkContains reports lookup cost and memory per entry; compare with
+// the firmware numbers from test_benchmark_memory_and_lookup.
+func BenchmarkContains(b *testing.B) {
+	for _, n := range []int{100, 1000, 10000, 100000} {
+		b.Run(fmt.Sprintf("n=%d", n), func(b *testing.B) {
+			tags := tagsFrom(1, n)
+			f, err := Build(tags, 1)
+			if err != nil {
+				b.Fatal(err)
+			}
+			b.ResetTimer()
+			hits := 0
+			for i := 0; i < b.N; i++ {
+				if f.Contains(tags[i%n]) {
+					hits++
+				}
+			}
+			if hits != b.N {
+				b.Fatal("false negative")
+			}
+			b.ReportMetric(8*float64(len(f.Fingerprints))/float64(n), "bits/entry")
+		})
+	}
+}
+
+func BenchmarkBuild(b *testing.B) {
+	tags := tagsFrom(1, 10000)
+	for i := 0; i < b.N; i++ {
+		if _, err := Build(tags, uint64(i)); err != nil {
+			b.Fatal(err)
+		}
+	}
+}
@@ -0,0 +1,99 @@
+// Package wiresig builds the binary projections that protocol_version 2
+// devices sign with the shared HMAC secret (see "Protocol versions" in
+// proto/portunus/v1/portunus.proto).
+//
+// A projection is a kind byte, the version byte, then the signed fields in a
+// fixed order: strings and byte slices as a 1-byte length and the bytes,
+// integers little-endian at fixed width. Nothing is formatted or escaped, so
+// the firmware builds one with a few memcpys. The layout must stay
+// byte-for-byte identical to access_module/services/server_comm/src/wire_sig.cpp;
+// both test suites pin the same golden projections.
+package wiresig
+
+import (
+	"encoding/binary"
+	"errors"
+)
+
+// Version is the protocol_version at which requests carry binary timestamps
+// and reason codes and are signed over these projections.
+const Version = 2
+
+// ErrFieldTooLong is returned for a string or byte field over 255 bytes,
+// which the 1-byte length prefix cannot describe.
+var ErrFieldTooLong = errors.New("wiresig: field longer than 255 bytes")
+
+const (
+	kindHeartbeat      = 'H'
+	kindAccess         = 'A'
+	kindAccessResponse = 'a'
+	kindProvision      = 'P'
+)
+
+// Heartbeat is the projection of a HeartbeatRequest.
+func Heartbeat(moduleID string, sequence uint32) ([]byte, error) {
+	b := start(kindHeartbeat, len(moduleID)+5)
+	b, err := appendField(b, []byte(moduleID))
+	if err != nil {
+		return nil, err
+	}
+	return binary.LittleEndian.AppendUint32(b, sequence), nil
+}
+
+// Access is the projection of an AccessRequest.
+func Access(moduleID, credentialID string, nonce []byte, requestedAtUS int64) ([]byte, error) {
+	b := start(kindAccess, len(moduleID)+len(credentialID)+len(nonce)+11)
+	var err error
+	for _, f := range [][]byte{[]byte(moduleID), []byte(credentialID), nonce} {
+		if b, err = appendField(b, f); err != nil {
+			return nil, err
+		}
+	}
+	return binary.LittleEndian.AppendUint64(b, uint64(requestedAtUS)), nil
+}
+
+// AccessResponse is the projection the server signs for an AccessResponse
+// and the device verifies before acting on the decision. It covers the
+// cache TTL and policy version too, since both decide how long the device
+// may reuse a grant.
+func AccessResponse(moduleID, credentialID string, granted bool, cacheTTLS, policyVersion uint32) ([]byte, error) {
+	b := start(kindAccessResponse, len(moduleID)+len(credentialID)+11)
+	var err error
+	for _, f := range [][]byte{[]byte(moduleID), []byte(credentialID)} {
+		if b, err = appendField(b, f); err != nil {
+			return nil, err
+		}
+	}
+	if granted {
+		b = append(b, 1)
+	} else {
+		b = append(b, 0)
+	}
+	b = binary.LittleEndian.AppendUint32(b, cacheTTLS)
+	return binary.LittleEndian.AppendUint32(b, policyVersion), nil
+}
+
+// Provision is the projection of a ProvisionCredentialRequest.
+func Provision(moduleID string, credentialUID []byte) ([]byte, error) {
+	b := start(kindProvision, len(moduleID)+len(credentialUID)+2)
+	var err error
+	for _, f := range [][]byte{[]byte(moduleID), credentialUID} {
+		if b, err = appendField(b, f); err != nil {
+			return nil, err
+		}
+	}
+	return b, nil
+}
+
+func start(kind byte, size int) []byte {
+	b := make([]byte, 0, 2+size)
+	return append(b, kind, Version)
+}
+
+func appendField(b, f []byte) ([]byte, error) {
+	if len(f) > 255 {
+		return nil, ErrFieldTooLong
+	}
+	b = append(b, byte(len(f)))
+	return append(b, f...), nil
+}
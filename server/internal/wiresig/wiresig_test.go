@@ -0,0 +1,108 @@
+package wiresig
+
+import (
+	"bytes"
+	"encoding/hex"
+	"errors"
+	"strings"
+	"testing"
+)
+
+var goldenNonce = []byte{
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+	0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+}
+
+// TestGoldenProjections pins the layout to the firmware's: the same inputs
+// must give the same bytes as test_golden_projections_match_server in
+// access_module/test/host/test_wire_sig.cpp.
+func TestGoldenProjections(t *testing.T) {
+	cases := []struct {
+		name string
+		got  func() ([]byte, error)
+		want string
+	}{
+		{"heartbeat", func() ([]byte, error) { return Heartbeat("door-1", 0x01020304) },
+			"4802" + "06646f6f722d31" + "04030201"},
+		{"access", func() ([]byte, error) {
+			return Access("door-1", "04:A3:2B:1C", goldenNonce, 1700000000123456)
+		}, "4102" + "06646f6f722d31" + "0b30343a41333a32423a3143" +
+			"10000102030405060708090a0b0c0d0e0f" + "40222018240a0600"},
+		{"access response", func() ([]byte, error) { return AccessResponse("door-1", "04:A3:2B:1C", true, 60, 7) },
+			"6102" + "06646f6f722d31" + "0b30343a41333a32423a3143" + "01" + "3c000000" + "07000000"},
+		{"provision", func() ([]byte, error) { return Provision("console", []byte{0x04, 0xa3, 0x2b, 0x1c}) },
+			"5002" + "07636f6e736f6c65" + "0404a32b1c"},
+	}
+	for _, c := range cases {
+		b, err := c.got()
+		if err != nil {
+			t.Fatalf("%s: %v", c.name, err)
+		}
+		if got := hex.EncodeToString(b); got != c.want {
+			t.Errorf("%s = %s, want %s", c.name, got, c.want)
+		}
+	}
+}
+
+func TestAccessResponseDistinguishesDecision(t *testing.T) {
+	g, _ := AccessResponse("door-1", "04:A3", true, 60, 7)
+	d, _ := AccessResponse("door-1", "04:A3", false, 60, 7)
+	if bytes.Equal(g, d) {
+		t.Fatal("grant and deny must not share a projection")
+	}
+}
+
+// TestAccessResponseSignsCacheTerms checks that a changed cache TTL or policy
+// version breaks the signature, so neither can be raised in transit.
+func TestAccessResponseSignsCacheTerms(t *testing.T) {
+	a, _ := AccessResponse("door-1", "04:A3", true, 60, 7)
+	for _, b := range [][]byte{
+		must(AccessResponse("door-1", "04:A3", true, 86400, 7)),
+		must(AccessResponse("door-1", "04:A3", true, 60, 8)),
+	} {
+		if bytes.Equal(a, b) {
+			t.Fatalf("projection %x ignores the cache terms", b)
+		}
+	}
+}
+
+// TestFieldBoundaries checks that moving bytes from one field to the next
+// changes the projection — the length prefixes keep fields apart where the
+// "|"-joined text form relied on ids never containing "|".
+func TestFieldBoundaries(t *testing.T) {
+	a, _ := Access("door-1", "AB", goldenNonce, 1)
+	b, _ := Access("door-1A", "B", goldenNonce, 1)
+	if bytes.Equal(a, b) {
+		t.Fatal("field boundary not encoded")
+	}
+}
+
+// TestVersionByteIsNotText checks that no projection can equal a version 0
+// text projection: those start with a word ("access|..."), these with a
+// kind byte and the control character 0x02.
+func TestVersionByteIsNotText(t *testing.T) {
+	for _, b := range [][]byte{
+		must(Heartbeat("m", 1)), must(Access("m", "c", nil, 1)),
+		must(AccessResponse("m", "c", true, 0, 0)), must(Provision("m", nil)),
+	} {
+		if b[1] != Version || Version >= 0x20 {
+			t.Fatalf("projection %x: version byte must be a control character", b)
+		}
+	}
+}
+
+func TestOverlongFieldRejected(t *testing.T) {
+	if _, err := Heartbeat(strings.Repeat("x", 256), 1); !errors.Is(err, ErrFieldTooLong) {
+		t.Fatalf("err = %v, want ErrFieldTooLong", err)
+	}
+	if _, err := Access("m", "c", make([]byte, 256), 1); !errors.Is(err, ErrFieldTooLong) {
+		t.Fatalf("err = %v, want ErrFieldTooLong", err)
+	}
+}
+
+func must(b []byte, err error) []byte {
+	if err != nil {
+		panic(err)
+	}
+	return b
+}